@@ -0,0 +1,284 @@
+/******************************************************************************
+* File Name:   adcstream.c
+*
+* Description: This file contains the double buffer of ADC samples filled by
+*              DMA, the packing of the samples into CAN FD frames and the bus
+*              time budget of the stream.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "adcstream.h"
+
+_Static_assert((ADCSTREAM_FRAME_SAMPLES % 2U) == 1U,
+               "the last sample of a frame is packed alone");
+_Static_assert((ADCSTREAM_HEADER_LEN + ((ADCSTREAM_FRAME_SAMPLES * 3U) + 1U) /
+                2U) <= ADCSTREAM_FRAME_LEN,
+               "ADCSTREAM_FRAME_SAMPLES do not fit the frame");
+
+/*******************************************************************************
+* Function Name: adcstream_dbuf_init
+********************************************************************************
+* Summary:
+* Empties the double buffer and clears its counters.
+*
+*******************************************************************************/
+void adcstream_dbuf_init(adcstream_dbuf_t *dbuf)
+{
+    memset(dbuf, 0, sizeof(*dbuf));
+}
+
+/*******************************************************************************
+* Function Name: adcstream_dbuf_complete
+********************************************************************************
+* Summary:
+* Called from the DMA interrupt at the end of each half. The DMA goes on
+* into the other half at the next sample, so the interrupt must run within
+* one sample period for adcstream_dbuf_take() to see an overwrite in time.
+*
+*******************************************************************************/
+void adcstream_dbuf_complete(adcstream_dbuf_t *dbuf)
+{
+    dbuf->done = dbuf->done + 1U;
+}
+
+/*******************************************************************************
+* Function Name: adcstream_dbuf_take
+********************************************************************************
+* Summary:
+* Copies out the oldest block the DMA completed that is still whole. Blocks
+* whose half the DMA went back into before they were taken are dropped:
+* those found overwritten, and the one being copied if the DMA returned to
+* its half during the copy.
+*
+* Parameters:
+*  dbuf         Double buffer
+*  samples      Set to the ADCSTREAM_BLOCK_SAMPLES samples of the block
+*  block        Set to the block number
+*
+* Return:
+*  true if a block was copied
+*
+*******************************************************************************/
+bool adcstream_dbuf_take(adcstream_dbuf_t *dbuf, uint16_t *samples,
+                         uint32_t *block)
+{
+    uint32_t done = dbuf->done;
+
+    if (done == dbuf->taken)
+    {
+        return false;
+    }
+
+    /* The DMA is writing into the half of block done - 2 */
+    if ((done - dbuf->taken) > 1U)
+    {
+        dbuf->dropped += done - 1U - dbuf->taken;
+        dbuf->taken = done - 1U;
+    }
+
+    memcpy(samples, dbuf->half[dbuf->taken & 1U],
+           sizeof(dbuf->half[0]));
+    *block = dbuf->taken;
+    dbuf->taken++;
+
+    if ((dbuf->done - *block) > 1U)
+    {
+        dbuf->dropped++;
+        return false;
+    }
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: adcstream_pack
+********************************************************************************
+* Summary:
+* Writes the header and ADCSTREAM_FRAME_SAMPLES samples as the
+* ADCSTREAM_FRAME_LEN bytes of a frame. Only the low 12 bits of the samples
+* are kept.
+*
+* Parameters:
+*  data         Frame payload
+*  seq          Frame number
+*  first        Number of the first sample
+*  samples      Samples
+*
+*******************************************************************************/
+void adcstream_pack(uint8_t *data, uint8_t seq, uint32_t first,
+                    const uint16_t *samples)
+{
+    uint8_t *out = &data[ADCSTREAM_HEADER_LEN];
+    uint32_t idx;
+
+    data[0] = seq;
+    data[1] = (uint8_t)first;
+    data[2] = (uint8_t)(first >> 8U);
+    data[3] = (uint8_t)(first >> 16U);
+    data[4] = (uint8_t)(first >> 24U);
+
+    for (idx = 0U; (idx + 1U) < ADCSTREAM_FRAME_SAMPLES; idx += 2U)
+    {
+        uint32_t pair = (samples[idx] & ADCSTREAM_SAMPLE_MASK) |
+                        ((samples[idx + 1U] & ADCSTREAM_SAMPLE_MASK) << 12U);
+
+        out[0] = (uint8_t)pair;
+        out[1] = (uint8_t)(pair >> 8U);
+        out[2] = (uint8_t)(pair >> 16U);
+        out += 3;
+    }
+    out[0] = (uint8_t)samples[idx];
+    out[1] = (uint8_t)((samples[idx] >> 8U) & 0x0FU);
+
+    /* Bytes past the samples, if any */
+    out += 2;
+    memset(out, 0, (size_t)(&data[ADCSTREAM_FRAME_LEN] - out));
+}
+
+/*******************************************************************************
+* Function Name: adcstream_unpack
+********************************************************************************
+* Summary:
+* Reads the header and the samples of a frame written by adcstream_pack().
+*
+* Parameters:
+*  data         Frame payload of ADCSTREAM_FRAME_LEN bytes
+*  seq          Set to the frame number
+*  first        Set to the number of the first sample
+*  samples      Set to the ADCSTREAM_FRAME_SAMPLES samples
+*
+*******************************************************************************/
+void adcstream_unpack(const uint8_t *data, uint8_t *seq, uint32_t *first,
+                      uint16_t *samples)
+{
+    const uint8_t *in = &data[ADCSTREAM_HEADER_LEN];
+    uint32_t idx;
+
+    *seq = data[0];
+    *first = (uint32_t)data[1] | ((uint32_t)data[2] << 8U) |
+             ((uint32_t)data[3] << 16U) | ((uint32_t)data[4] << 24U);
+
+    for (idx = 0U; (idx + 1U) < ADCSTREAM_FRAME_SAMPLES; idx += 2U)
+    {
+        uint32_t pair = (uint32_t)in[0] | ((uint32_t)in[1] << 8U) |
+                        ((uint32_t)in[2] << 16U);
+
+        samples[idx] = (uint16_t)(pair & ADCSTREAM_SAMPLE_MASK);
+        samples[idx + 1U] = (uint16_t)(pair >> 12U);
+        in += 3;
+    }
+    samples[idx] = (uint16_t)((uint32_t)in[0] |
+                              (((uint32_t)in[1] & 0x0FU) << 8U));
+}
+
+/*******************************************************************************
+* Function Name: adcstream_pacer_init
+********************************************************************************
+* Summary:
+* Sets the share of the bus the stream may take. The stream may send
+* burst_ns of bus time ahead of its share after an idle time, and falls
+* behind by at most one frame.
+*
+* Parameters:
+*  pacer        Pacer
+*  load_pct     Share of the bus time, 1 to 100 %
+*  burst_ns     Bus time that can be saved up
+*
+*******************************************************************************/
+void adcstream_pacer_init(adcstream_pacer_t *pacer, uint32_t load_pct,
+                          uint32_t burst_ns)
+{
+    pacer->credit_ns = 0;
+    pacer->burst_ns = burst_ns;
+    pacer->load_pct = (load_pct > 100U) ? 100U : load_pct;
+}
+
+/*******************************************************************************
+* Function Name: adcstream_pacer_advance
+********************************************************************************
+* Summary:
+* Earns the share of the time that passed.
+*
+* Parameters:
+*  pacer        Pacer
+*  elapsed_us   Time since the last call
+*
+*******************************************************************************/
+void adcstream_pacer_advance(adcstream_pacer_t *pacer, uint32_t elapsed_us)
+{
+    /* us * 1000 ns * load_pct / 100 */
+    pacer->credit_ns += (int64_t)elapsed_us * 10 * (int64_t)pacer->load_pct;
+    if (pacer->credit_ns > (int64_t)pacer->burst_ns)
+    {
+        pacer->credit_ns = (int64_t)pacer->burst_ns;
+    }
+}
+
+/*******************************************************************************
+* Function Name: adcstream_pacer_ready
+********************************************************************************
+* Summary:
+* Returns true if a frame may be sent now.
+*
+*******************************************************************************/
+bool adcstream_pacer_ready(const adcstream_pacer_t *pacer)
+{
+    return (pacer->credit_ns >= 0);
+}
+
+/*******************************************************************************
+* Function Name: adcstream_pacer_spend
+********************************************************************************
+* Summary:
+* Pays for a frame that was sent. The credit may go below zero, which holds
+* the next frames until the time is earned back.
+*
+* Parameters:
+*  pacer        Pacer
+*  frame_ns     Bus time of the frame
+*
+*******************************************************************************/
+void adcstream_pacer_spend(adcstream_pacer_t *pacer, uint32_t frame_ns)
+{
+    pacer->credit_ns -= (int64_t)frame_ns;
+}
+
+/* [] END OF FILE */
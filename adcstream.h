@@ -0,0 +1,138 @@
+/******************************************************************************
+* File Name:   adcstream.h
+*
+* Description: This file contains the double buffer of ADC samples filled by
+*              DMA, the packing of the samples into CAN FD frames and the bus
+*              time budget of the stream.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef ADCSTREAM_H_
+#define ADCSTREAM_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* Only the C library, so that host/ can build the simulator */
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make ADCSTREAM_ENABLE=1") to stream the ADC
+ * samples of ADCSTREAM_CAN_SOURCE_NODE to the other nodes */
+#ifndef ADCSTREAM_ENABLE
+#define ADCSTREAM_ENABLE        (0)
+#endif
+
+/* Sample frame payload, 64 bytes, little endian:
+ *   0  seq         frame number, counts up per frame
+ *   1  first       number of the first sample, counted by the sample clock
+ *                  (32 bits)
+ *   5  samples     ADCSTREAM_FRAME_SAMPLES 12-bit samples, two in three
+ *                  bytes: the low 8 bits of the first, its high 4 bits with
+ *                  the low 4 bits of the second, the high 8 bits of the
+ *                  second */
+#define ADCSTREAM_HEADER_LEN    (5U)
+#define ADCSTREAM_FRAME_LEN     (64U)
+#define ADCSTREAM_SAMPLE_BITS   (12U)
+#define ADCSTREAM_SAMPLE_MASK   ((1UL << ADCSTREAM_SAMPLE_BITS) - 1U)
+#define ADCSTREAM_FRAME_SAMPLES                                                \
+    ((((ADCSTREAM_FRAME_LEN - ADCSTREAM_HEADER_LEN) * 8U) /                    \
+      ADCSTREAM_SAMPLE_BITS))
+
+/* Frames per block. A block is what the DMA writes into one half of the
+ * double buffer, and what is dropped as a whole when the CPU falls behind. */
+#ifndef ADCSTREAM_BLOCK_FRAMES
+#define ADCSTREAM_BLOCK_FRAMES  (4U)
+#endif
+#define ADCSTREAM_BLOCK_SAMPLES                                                \
+    (ADCSTREAM_FRAME_SAMPLES * ADCSTREAM_BLOCK_FRAMES)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Double buffer written by DMA. The DMA fills the halves in turn, without
+ * stopping; done counts the blocks it completed, taken the blocks the CPU
+ * copied out or dropped. Block b is in half b % 2. */
+typedef struct
+{
+    uint16_t          half[2][ADCSTREAM_BLOCK_SAMPLES];
+    volatile uint32_t done;
+    uint32_t          taken;
+    uint32_t          dropped;
+} adcstream_dbuf_t;
+
+/* Bus time budget: credit in ns of bus time, earned at load_pct of the
+ * time that passes and spent by each frame sent */
+typedef struct
+{
+    int64_t  credit_ns;
+    uint32_t burst_ns;
+    uint32_t load_pct;
+} adcstream_pacer_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void adcstream_dbuf_init(adcstream_dbuf_t *dbuf);
+void adcstream_dbuf_complete(adcstream_dbuf_t *dbuf);
+bool adcstream_dbuf_take(adcstream_dbuf_t *dbuf, uint16_t *samples,
+                         uint32_t *block);
+void adcstream_pack(uint8_t *data, uint8_t seq, uint32_t first,
+                    const uint16_t *samples);
+void adcstream_unpack(const uint8_t *data, uint8_t *seq, uint32_t *first,
+                      uint16_t *samples);
+void adcstream_pacer_init(adcstream_pacer_t *pacer, uint32_t load_pct,
+                          uint32_t burst_ns);
+void adcstream_pacer_advance(adcstream_pacer_t *pacer, uint32_t elapsed_us);
+bool adcstream_pacer_ready(const adcstream_pacer_t *pacer);
+void adcstream_pacer_spend(adcstream_pacer_t *pacer, uint32_t frame_ns);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* ADCSTREAM_H_ */
+
+/* [] END OF FILE */
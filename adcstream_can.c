@@ -0,0 +1,495 @@
+/******************************************************************************
+* File Name:   adcstream_can.c
+*
+* Description: This file contains the ADC sample stream: sampling by DMA on
+*              the source node, frames paced to a bus load cap, and the
+*              counters of the receivers.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "adcstream_can.h"
+#include "txfmt.h"
+#include "stats.h"
+
+#if (ADCSTREAM_ENABLE)
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+_Static_assert(ADCSTREAM_BLOCK_SAMPLES <= CY_DMA_LOOP_COUNT_MAX,
+               "a block must fit the X loop of one descriptor");
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Source counters since start-up */
+typedef struct
+{
+    uint32_t blocks;            /* Blocks taken from the double buffer */
+    uint32_t frames;
+    uint32_t busy;              /* Frames held by a busy TX buffer */
+    uint64_t bus_ns;            /* Bus time of the frames sent */
+} adcstream_can_tx_stats_t;
+
+/* Receiver counters since the first frame */
+typedef struct
+{
+    uint32_t frames;
+    uint32_t lost_frames;       /* Frame numbers skipped */
+    uint32_t missing;           /* Samples skipped, dropped or lost */
+    uint64_t samples;
+    uint16_t min;
+    uint16_t max;
+} adcstream_can_rx_stats_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static adcstream_can_send_fn_t adcstream_can_send;
+static bool                    adcstream_can_source;
+static bool                    adcstream_can_running;
+static uint32_t                adcstream_can_start_ms;
+static uint32_t                adcstream_can_now_ms;
+
+/* Source: the double buffer, the block being sent and its next frame */
+static adcstream_dbuf_t        adcstream_can_dbuf;
+static adcstream_pacer_t       adcstream_can_pacer;
+static uint16_t                adcstream_can_block[ADCSTREAM_BLOCK_SAMPLES];
+static uint32_t                adcstream_can_block_num;
+static uint32_t                adcstream_can_frame_idx = ADCSTREAM_BLOCK_FRAMES;
+static uint8_t                 adcstream_can_tx_seq;
+static adcstream_can_tx_stats_t adcstream_can_tx;
+#if (STATS_ENABLE)
+/* Blocks dropped by the double buffer, as last added to the registry */
+static uint32_t                adcstream_can_dropped;
+#endif /* STATS_ENABLE */
+
+/* Receiver: next frame and sample numbers expected */
+static uint8_t                 adcstream_can_rx_seq;
+static uint32_t                adcstream_can_rx_next;
+static uint32_t                adcstream_can_first_ms;
+static adcstream_can_rx_stats_t adcstream_can_rx;
+
+/* Two descriptors that hand over to each other, one per half of the double
+ * buffer: the channel runs until it is disabled */
+static cy_stc_dma_descriptor_t adcstream_can_descriptors[2];
+
+static const cy_stc_dma_channel_config_t adcstream_can_channel_config =
+{
+    .descriptor  = &adcstream_can_descriptors[0],
+    .preemptable = false,
+    .priority    = 1U,
+    .enable      = false,
+    .bufferable  = false
+};
+
+/* Above the CAN FD interrupt: the interrupt must run within one sample
+ * period of the end of a half */
+static const cy_stc_sysint_t adcstream_can_irq_cfg =
+{
+    .intrSrc = ADCSTREAM_CAN_DW_IRQ,
+    .intrPriority = 0U,
+};
+
+/*******************************************************************************
+* Function Name: adcstream_can_dma_isr
+********************************************************************************
+* Summary:
+* Interrupt of the DataWire channel at the end of each half.
+*
+*******************************************************************************/
+static void adcstream_can_dma_isr(void)
+{
+    Cy_DMA_Channel_ClearInterrupt(ADCSTREAM_CAN_DW, ADCSTREAM_CAN_DW_CHANNEL);
+    adcstream_dbuf_complete(&adcstream_can_dbuf);
+}
+
+/*******************************************************************************
+* Function Name: adcstream_can_start
+********************************************************************************
+* Summary:
+* Sets up the descriptors and the DataWire channel, starts the SAR ADC and
+* then the timer that triggers its conversions.
+*
+* Return:
+*  true if the ADC started
+*
+*******************************************************************************/
+static bool adcstream_can_start(void)
+{
+    cy_stc_dma_descriptor_config_t config =
+    {
+        .retrigger       = CY_DMA_RETRIG_IM,
+        .interruptType   = CY_DMA_DESCR,
+        .triggerOutType  = CY_DMA_DESCR,
+        .channelState    = CY_DMA_CHANNEL_ENABLED,
+        .triggerInType   = CY_DMA_1ELEMENT,
+        .dataPrefetch    = false,
+        .dataSize        = CY_DMA_HALFWORD,
+        .srcTransferSize = CY_DMA_TRANSFER_SIZE_WORD,
+        .dstTransferSize = CY_DMA_TRANSFER_SIZE_DATA,
+        .descriptorType  = CY_DMA_1D_TRANSFER,
+        .srcAddress      = (void *)(uintptr_t)ADCSTREAM_CAN_ADC_RESULT,
+        .dstAddress      = NULL,
+        .xCount          = ADCSTREAM_BLOCK_SAMPLES,
+        .srcXincrement   = 0,
+        .dstXincrement   = 1,
+        .nextDescriptor  = NULL
+    };
+
+    adcstream_dbuf_init(&adcstream_can_dbuf);
+    for (uint32_t idx = 0U; idx < 2U; idx++)
+    {
+        config.dstAddress = adcstream_can_dbuf.half[idx];
+        config.nextDescriptor = &adcstream_can_descriptors[1U - idx];
+        (void)Cy_DMA_Descriptor_Init(&adcstream_can_descriptors[idx],
+                                     &config);
+    }
+    (void)Cy_DMA_Channel_Init(ADCSTREAM_CAN_DW, ADCSTREAM_CAN_DW_CHANNEL,
+                              &adcstream_can_channel_config);
+    Cy_DMA_Channel_SetInterruptMask(ADCSTREAM_CAN_DW,
+                                    ADCSTREAM_CAN_DW_CHANNEL,
+                                    CY_DMA_INTR_MASK);
+    Cy_DMA_Enable(ADCSTREAM_CAN_DW);
+    (void)Cy_SysInt_Init(&adcstream_can_irq_cfg, &adcstream_can_dma_isr);
+    NVIC_EnableIRQ(ADCSTREAM_CAN_DW_IRQ);
+    Cy_DMA_Channel_Enable(ADCSTREAM_CAN_DW, ADCSTREAM_CAN_DW_CHANNEL);
+
+    if ((CY_HPPASS_SUCCESS != Cy_HPPASS_Init(ADCSTREAM_CAN_ADC_CONFIG)) ||
+        (CY_HPPASS_SUCCESS != Cy_HPPASS_AC_Start(0U, 1000U)))
+    {
+        printf("ADCSTREAM: the SAR ADC did not start\r\n");
+        return false;
+    }
+    if (CY_TCPWM_SUCCESS !=
+        Cy_TCPWM_Counter_Init(ADCSTREAM_CAN_TIMER, ADCSTREAM_CAN_TIMER_NUM,
+                              ADCSTREAM_CAN_TIMER_CONFIG))
+    {
+        printf("ADCSTREAM: the sample timer did not start\r\n");
+        return false;
+    }
+    Cy_TCPWM_Counter_Enable(ADCSTREAM_CAN_TIMER, ADCSTREAM_CAN_TIMER_NUM);
+    Cy_TCPWM_TriggerStart_Single(ADCSTREAM_CAN_TIMER,
+                                 ADCSTREAM_CAN_TIMER_NUM);
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: adcstream_can_frame_ns
+********************************************************************************
+* Summary:
+* Returns the bus time of a sample frame at the current bit rates.
+*
+*******************************************************************************/
+static uint32_t adcstream_can_frame_ns(void)
+{
+    txfmt_rates_t rates;
+
+    txfmt_get_rates(&rates);
+    return txfmt_frame_ns(&rates, TXFMT_FD_BRS, ADCSTREAM_FRAME_LEN, false);
+}
+
+/*******************************************************************************
+* Function Name: adcstream_can_send_frames
+********************************************************************************
+* Summary:
+* Sends the frames of the current block that the bus time budget allows,
+* and takes the next block from the double buffer once all of them are
+* out. A frame the TX buffer cannot take is sent again on the next call.
+*
+*******************************************************************************/
+static void adcstream_can_send_frames(void)
+{
+    canfd_frame_t frame;
+    uint32_t frame_ns = adcstream_can_frame_ns();
+
+    memset(&frame, 0, sizeof(frame));
+    frame.id = ADCSTREAM_CAN_ID;
+    frame.len = ADCSTREAM_FRAME_LEN;
+    frame.flags = CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS;
+
+    while (adcstream_pacer_ready(&adcstream_can_pacer))
+    {
+        uint32_t offset;
+
+        if (ADCSTREAM_BLOCK_FRAMES <= adcstream_can_frame_idx)
+        {
+            if (!adcstream_dbuf_take(&adcstream_can_dbuf, adcstream_can_block,
+                                     &adcstream_can_block_num))
+            {
+                return;
+            }
+            adcstream_can_frame_idx = 0U;
+            adcstream_can_tx.blocks++;
+        }
+
+        offset = adcstream_can_frame_idx * ADCSTREAM_FRAME_SAMPLES;
+        adcstream_pack(frame.data, adcstream_can_tx_seq,
+                       (adcstream_can_block_num * ADCSTREAM_BLOCK_SAMPLES) +
+                       offset, &adcstream_can_block[offset]);
+        if (!adcstream_can_send(&frame))
+        {
+            adcstream_can_tx.busy++;
+            STATS_INC(ADCSTREAM_BUSY);
+            return;
+        }
+
+        adcstream_pacer_spend(&adcstream_can_pacer, frame_ns);
+        adcstream_can_tx.frames++;
+        adcstream_can_tx.bus_ns += frame_ns;
+        adcstream_can_tx_seq++;
+        adcstream_can_frame_idx++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: adcstream_can_rate
+********************************************************************************
+* Summary:
+* Returns count per second over a number of milliseconds.
+*
+*******************************************************************************/
+static uint32_t adcstream_can_rate(uint64_t count, uint32_t ms)
+{
+    return (0U == ms) ? 0U : (uint32_t)((count * 1000U) / ms);
+}
+#endif /* ADCSTREAM_ENABLE */
+
+/*******************************************************************************
+* Function Name: adcstream_can_init
+********************************************************************************
+* Summary:
+* On ADCSTREAM_CAN_SOURCE_NODE, starts the sampling; the other nodes only
+* receive.
+*
+* Parameters:
+*  node         Node number
+*  send         Sends a frame through the application TX buffer
+*  now_ms       Current time
+*
+*******************************************************************************/
+void adcstream_can_init(uint8_t node, adcstream_can_send_fn_t send,
+                        uint32_t now_ms)
+{
+#if (ADCSTREAM_ENABLE)
+    adcstream_can_send = send;
+    adcstream_can_source = (ADCSTREAM_CAN_SOURCE_NODE == node);
+    adcstream_can_start_ms = now_ms;
+    adcstream_can_now_ms = now_ms;
+    adcstream_can_rx.min = UINT16_MAX;
+    adcstream_pacer_init(&adcstream_can_pacer, ADCSTREAM_CAN_LOAD_PCT,
+                         ADCSTREAM_CAN_BURST_US * 10U *
+                         ADCSTREAM_CAN_LOAD_PCT);
+
+    if (adcstream_can_source && !adcstream_can_start())
+    {
+        return;
+    }
+    adcstream_can_running = true;
+#else
+    CY_UNUSED_PARAMETER(node);
+    CY_UNUSED_PARAMETER(send);
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* ADCSTREAM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: adcstream_can_set_load
+********************************************************************************
+* Summary:
+* Changes the share of the bus time the stream may take.
+*
+* Parameters:
+*  load_pct     1 to 100 %
+*
+*******************************************************************************/
+void adcstream_can_set_load(uint32_t load_pct)
+{
+#if (ADCSTREAM_ENABLE)
+    adcstream_pacer_init(&adcstream_can_pacer, load_pct,
+                         ADCSTREAM_CAN_BURST_US * 10U * load_pct);
+#else
+    CY_UNUSED_PARAMETER(load_pct);
+#endif /* ADCSTREAM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: adcstream_can_on_frame
+********************************************************************************
+* Summary:
+* Counts the samples of a received frame. A skipped frame number is a frame
+* lost on the bus; the sample numbers also show the blocks the source
+* dropped.
+*
+* Parameters:
+*  frame        Received frame
+*
+*******************************************************************************/
+void adcstream_can_on_frame(const canfd_frame_t *frame)
+{
+#if (ADCSTREAM_ENABLE)
+    uint16_t samples[ADCSTREAM_FRAME_SAMPLES];
+    uint32_t first;
+    uint8_t seq;
+
+    if ((!adcstream_can_running) || adcstream_can_source ||
+        (ADCSTREAM_CAN_ID != frame->id) || (ADCSTREAM_FRAME_LEN != frame->len))
+    {
+        return;
+    }
+
+    adcstream_unpack(frame->data, &seq, &first, samples);
+    if (0U == adcstream_can_rx.frames)
+    {
+        adcstream_can_first_ms = adcstream_can_now_ms;
+    }
+    else
+    {
+        adcstream_can_rx.lost_frames += (uint8_t)(seq - adcstream_can_rx_seq);
+        adcstream_can_rx.missing += first - adcstream_can_rx_next;
+    }
+    adcstream_can_rx_seq = (uint8_t)(seq + 1U);
+    adcstream_can_rx_next = first + ADCSTREAM_FRAME_SAMPLES;
+    adcstream_can_rx.frames++;
+    adcstream_can_rx.samples += ADCSTREAM_FRAME_SAMPLES;
+
+    for (uint32_t idx = 0U; idx < ADCSTREAM_FRAME_SAMPLES; idx++)
+    {
+        adcstream_can_rx.min = (samples[idx] < adcstream_can_rx.min) ?
+                               samples[idx] : adcstream_can_rx.min;
+        adcstream_can_rx.max = (samples[idx] > adcstream_can_rx.max) ?
+                               samples[idx] : adcstream_can_rx.max;
+    }
+#else
+    CY_UNUSED_PARAMETER(frame);
+#endif /* ADCSTREAM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: adcstream_can_poll
+********************************************************************************
+* Summary:
+* On the source, earns the bus time that passed and sends the frames it
+* pays for. Called by the main loop.
+*
+* Parameters:
+*  now_ms       Current time
+*
+*******************************************************************************/
+void adcstream_can_poll(uint32_t now_ms)
+{
+#if (ADCSTREAM_ENABLE)
+    adcstream_pacer_advance(&adcstream_can_pacer,
+                            (now_ms - adcstream_can_now_ms) * 1000U);
+    adcstream_can_now_ms = now_ms;
+    if (adcstream_can_running && adcstream_can_source)
+    {
+        adcstream_can_send_frames();
+    }
+    /* adcstream.c only uses the C library, so its count is followed here */
+    STATS_FOLLOW(ADCSTREAM_DROPS, adcstream_can_dbuf.dropped,
+                 &adcstream_can_dropped);
+#else
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* ADCSTREAM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: adcstream_can_report
+********************************************************************************
+* Summary:
+* Prints, on the source, the rate of the sample clock, the samples per
+* second sent, the dropped blocks and the bus load of the stream; on the
+* other nodes, the samples per second received and the samples missing.
+*
+*******************************************************************************/
+void adcstream_can_report(void)
+{
+#if (ADCSTREAM_ENABLE)
+    uint32_t ms;
+
+    if (!adcstream_can_running)
+    {
+        printf("ADCSTREAM: not running\r\n");
+        return;
+    }
+
+    if (adcstream_can_source)
+    {
+        uint32_t blocks = adcstream_can_dbuf.done;
+        uint32_t load;
+
+        ms = adcstream_can_now_ms - adcstream_can_start_ms;
+        load = (0U == ms) ? 0U :
+               (uint32_t)(adcstream_can_tx.bus_ns / ((uint64_t)ms * 100U));
+        printf("ADCSTREAM: sample clock %lu Hz, %lu samples/s sent, "
+               "%lu of %lu blocks dropped\r\n",
+               (unsigned long)adcstream_can_rate((uint64_t)blocks *
+                                                 ADCSTREAM_BLOCK_SAMPLES, ms),
+               (unsigned long)adcstream_can_rate(
+                   (uint64_t)adcstream_can_tx.frames *
+                   ADCSTREAM_FRAME_SAMPLES, ms),
+               (unsigned long)adcstream_can_dbuf.dropped,
+               (unsigned long)blocks);
+        printf("ADCSTREAM: %lu frames, bus load %lu.%02lu%% of %lu%%, "
+               "TX buffer busy %lu\r\n",
+               (unsigned long)adcstream_can_tx.frames,
+               (unsigned long)(load / 100U), (unsigned long)(load % 100U),
+               (unsigned long)adcstream_can_pacer.load_pct,
+               (unsigned long)adcstream_can_tx.busy);
+        return;
+    }
+
+    ms = adcstream_can_now_ms - adcstream_can_first_ms;
+    printf("ADCSTREAM: %lu frames, %lu samples/s received, %lu frames lost, "
+           "%lu samples missing, range %u to %u\r\n",
+           (unsigned long)adcstream_can_rx.frames,
+           (unsigned long)adcstream_can_rate(adcstream_can_rx.samples, ms),
+           (unsigned long)adcstream_can_rx.lost_frames,
+           (unsigned long)adcstream_can_rx.missing,
+           (0U == adcstream_can_rx.frames) ? 0U :
+           (unsigned int)adcstream_can_rx.min,
+           (unsigned int)adcstream_can_rx.max);
+#endif /* ADCSTREAM_ENABLE */
+}
+
+/* [] END OF FILE */
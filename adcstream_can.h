@@ -0,0 +1,120 @@
+/******************************************************************************
+* File Name:   adcstream_can.h
+*
+* Description: This file contains the ADC sample stream: sampling by DMA on
+*              the source node, frames paced to a bus load cap, and the
+*              counters of the receivers.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef ADCSTREAM_CAN_H_
+#define ADCSTREAM_CAN_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "canfd_frame.h"
+#include "adcstream.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Sample frames, see adcstream.h. The frames of a block go out one after
+ * the other, so a low-priority ID would leave the stream at the mercy of
+ * all other traffic; the bus load cap keeps room for that traffic. */
+#define ADCSTREAM_CAN_ID        (0x0E0U)
+
+/* The node that samples and sends; the other nodes receive */
+#ifndef ADCSTREAM_CAN_SOURCE_NODE
+#define ADCSTREAM_CAN_SOURCE_NODE   (1U)
+#endif
+
+/* Share of the bus time the stream may take, in %. It can be changed at run
+ * time with adcstream_can_set_load(). */
+#ifndef ADCSTREAM_CAN_LOAD_PCT
+#define ADCSTREAM_CAN_LOAD_PCT  (50U)
+#endif
+
+/* Time over which unused bus time can be saved up and sent at once */
+#ifndef ADCSTREAM_CAN_BURST_US
+#define ADCSTREAM_CAN_BURST_US  (2000U)
+#endif
+
+/* SAR ADC and the timer that triggers its conversions, as set in the
+ * design: the timer runs at the sample rate, each timer period converts
+ * one channel, and the SAR trigger output of each conversion is routed to
+ * the trigger input of the DataWire channel, which moves the result from
+ * ADCSTREAM_CAN_ADC_RESULT into the double buffer */
+#ifndef ADCSTREAM_CAN_DW
+#define ADCSTREAM_CAN_DW            DW0
+#define ADCSTREAM_CAN_DW_CHANNEL    (1U)
+#define ADCSTREAM_CAN_DW_IRQ        cpuss_interrupts_dw0_1_IRQn
+#define ADCSTREAM_CAN_ADC_CONFIG    (&pass_0_config)
+#define ADCSTREAM_CAN_ADC_RESULT    (&HPPASS_SAR_CHAN_RSLT(HPPASS_BASE, 0U))
+#define ADCSTREAM_CAN_TIMER         TCPWM0
+#define ADCSTREAM_CAN_TIMER_NUM     (0U)
+#define ADCSTREAM_CAN_TIMER_CONFIG  (&tcpwm_0_group_0_cnt_0_config)
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Sends a frame through the application TX buffer */
+typedef bool (*adcstream_can_send_fn_t)(const canfd_frame_t *frame);
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void adcstream_can_init(uint8_t node, adcstream_can_send_fn_t send,
+                        uint32_t now_ms);
+void adcstream_can_set_load(uint32_t load_pct);
+void adcstream_can_on_frame(const canfd_frame_t *frame);
+void adcstream_can_poll(uint32_t now_ms);
+void adcstream_can_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* ADCSTREAM_CAN_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,291 @@
+/******************************************************************************
+* File Name:   bench.c
+*
+* Description: This file contains the benchmark runner which times each case
+*              with the cycle counter and prints the results as JSON.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "bench.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+volatile uint32_t bench_sink;
+volatile uint32_t bench_stamps[BENCH_STAMP_COUNT];
+
+/* Number of results printed in the current block */
+static uint32_t bench_result_count;
+
+/*******************************************************************************
+* Function Name: bench_noop
+********************************************************************************
+* Summary:
+* Empty operation used to measure the loop and call overhead.
+*
+*******************************************************************************/
+static void bench_noop(void *arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+}
+
+/*******************************************************************************
+* Function Name: bench_measure
+********************************************************************************
+* Summary:
+* Times BENCH_ITERATIONS calls of an operation with interrupts masked.
+*
+* Return:
+*  Elapsed CPU cycles
+*
+*******************************************************************************/
+static uint32_t bench_measure(bench_fn_t fn, void *arg)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t start;
+    uint32_t cycles;
+
+    __disable_irq();
+    start = cycle_counter_get();
+    for (uint32_t iter = 0U; iter < BENCH_ITERATIONS; iter++)
+    {
+        fn(arg);
+    }
+    cycles = cycle_counter_get() - start;
+    __set_PRIMASK(primask);
+
+    return cycles;
+}
+
+/*******************************************************************************
+* Function Name: bench_begin
+********************************************************************************
+* Summary:
+* Starts the result block. All results up to bench_end() form one JSON
+* document between "BENCH BEGIN" and "BENCH END" lines, which
+* scripts/bench_compare.py reads directly from a UART log. The commit hash
+* lets results be tracked per firmware version.
+*
+*******************************************************************************/
+void bench_begin(void)
+{
+    cycle_counter_init();
+    bench_result_count = 0U;
+
+    printf("BENCH BEGIN\r\n");
+    printf("{\"suite\":\"canfd\",\"commit\":\"%07lx\",\"cpu_hz\":%lu,"
+           "\"iterations\":%lu,\"repeat\":%lu,\"results\":[\r\n",
+           (unsigned long)BENCH_COMMIT, (unsigned long)SystemCoreClock,
+           (unsigned long)BENCH_ITERATIONS, (unsigned long)BENCH_REPEAT);
+}
+
+/*******************************************************************************
+* Function Name: bench_report
+********************************************************************************
+* Summary:
+* Adds one result to the block.
+*
+* Parameters:
+*  group        Group of the case, e.g. "sw" or "hw"
+*  name         Case name, unique within the group
+*  bytes        Payload size processed per operation
+*  stats        Cycles per operation
+*
+*******************************************************************************/
+void bench_report(const char *group, const char *name, uint32_t bytes,
+                  const bench_stats_t *stats)
+{
+    uint32_t mean = 0U;
+
+    if (0U != stats->count)
+    {
+        mean = (uint32_t)(stats->sum / stats->count);
+    }
+
+    printf("%s{\"name\":\"%s.%s\",\"bytes\":%lu,\"cycles_min\":%lu,"
+           "\"cycles_mean\":%lu,\"cycles_max\":%lu,\"samples\":%lu}\r\n",
+           (0U != bench_result_count) ? "," : "", group, name,
+           (unsigned long)bytes, (unsigned long)stats->min,
+           (unsigned long)mean, (unsigned long)stats->max,
+           (unsigned long)stats->count);
+    bench_result_count++;
+}
+
+/*******************************************************************************
+* Function Name: bench_end
+********************************************************************************
+* Summary:
+* Closes the result block.
+*
+*******************************************************************************/
+void bench_end(void)
+{
+    printf("]}\r\n");
+    printf("BENCH END\r\n\r\n");
+}
+
+/*******************************************************************************
+* Function Name: bench_run
+********************************************************************************
+* Summary:
+* Runs a list of cases and reports the cycles per call with the loop
+* overhead removed.
+*
+* Parameters:
+*  group        Group name of the cases
+*  cases        Cases to run
+*  count        Number of cases
+*
+*******************************************************************************/
+void bench_run(const char *group, const bench_case_t *cases, uint32_t count)
+{
+    uint32_t overhead = UINT32_MAX;
+
+    for (uint32_t rep = 0U; rep < BENCH_REPEAT; rep++)
+    {
+        uint32_t cycles = bench_measure(bench_noop, NULL);
+        overhead = (cycles < overhead) ? cycles : overhead;
+    }
+
+    for (uint32_t idx = 0U; idx < count; idx++)
+    {
+        bench_stats_t stats;
+
+        bench_stats_init(&stats);
+
+        /* Warm up caches and branch predictors before timing */
+        (void)bench_measure(cases[idx].fn, cases[idx].arg);
+
+        for (uint32_t rep = 0U; rep < BENCH_REPEAT; rep++)
+        {
+            uint32_t cycles = bench_measure(cases[idx].fn, cases[idx].arg);
+            cycles = (cycles > overhead) ? (cycles - overhead) : 0U;
+            bench_stats_add(&stats, cycles / BENCH_ITERATIONS);
+        }
+
+        bench_report(group, cases[idx].name, cases[idx].bytes, &stats);
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_stats_init
+********************************************************************************
+* Summary:
+* Resets running statistics.
+*
+*******************************************************************************/
+void bench_stats_init(bench_stats_t *stats)
+{
+    stats->min = UINT32_MAX;
+    stats->max = 0U;
+    stats->sum = 0U;
+    stats->count = 0U;
+}
+
+/*******************************************************************************
+* Function Name: bench_stats_add
+********************************************************************************
+* Summary:
+* Adds one sample to running statistics.
+*
+*******************************************************************************/
+void bench_stats_add(bench_stats_t *stats, uint32_t cycles)
+{
+    stats->min = (cycles < stats->min) ? cycles : stats->min;
+    stats->max = (cycles > stats->max) ? cycles : stats->max;
+    stats->sum += cycles;
+    stats->count++;
+}
+
+/*******************************************************************************
+* Function Name: bench_stamps_clear
+********************************************************************************
+* Summary:
+* Re-arms all BENCH_STAMP() points for the next sample.
+*
+*******************************************************************************/
+void bench_stamps_clear(void)
+{
+    for (uint32_t idx = 0U; idx < (uint32_t)BENCH_STAMP_COUNT; idx++)
+    {
+        bench_stamps[idx] = 0U;
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_suite_run
+********************************************************************************
+* Summary:
+* Runs the complete benchmark suite and prints it as one result block: the
+* software hot paths followed by the hardware paths measured on the CAN FD
+* channel in internal loopback, the replays of the selective wake-up and
+* compression traces, the drain of RX FIFO 0 with and without DMA, and the
+* DSP kernels with and without the SIMD instructions, and the sealing and
+* opening of encrypted payloads. The counts, sizes, frame rates, sample
+* rates and frame times of the last five are printed after the block.
+*
+* Parameters:
+*  base         CAN FD block
+*  chan         CAN FD channel, initialized and with its interrupt enabled
+*  context      Channel context
+*
+*******************************************************************************/
+void bench_suite_run(CANFD_Type *base, uint32_t chan,
+                     cy_stc_canfd_context_t *context)
+{
+    bench_begin();
+    bench_sw_run(base, chan, context);
+    bench_hw_run(base, chan, context);
+    bench_wake_run(base, chan, context);
+    bench_fzip_run();
+    bench_rxdma_run(base, chan, context);
+    bench_dsp_run();
+    bench_cancrypt_run();
+    bench_end();
+    bench_wake_print();
+    bench_fzip_print();
+    bench_rxdma_print();
+    bench_dsp_print();
+    bench_cancrypt_print();
+}
+
+/* [] END OF FILE */
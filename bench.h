@@ -0,0 +1,178 @@
+/******************************************************************************
+* File Name:   bench.h
+*
+* Description: This file contains the interface of the benchmark runner.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "cycle_counter.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make BENCHMARK_ENABLE=1") to run the benchmark
+ * suite at start-up */
+#ifndef BENCHMARK_ENABLE
+#define BENCHMARK_ENABLE        (0)
+#endif
+
+/* Calls per timed repetition */
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS        (64U)
+#endif
+
+/* Timed repetitions per case; the minimum and the mean are reported */
+#ifndef BENCH_REPEAT
+#define BENCH_REPEAT            (8U)
+#endif
+
+/* Frames sent through internal loopback for the hardware path latencies */
+#ifndef BENCH_HW_SAMPLES
+#define BENCH_HW_SAMPLES        (32U)
+#endif
+
+/* Short commit hash of the firmware, set by the Makefile */
+#ifndef BENCH_COMMIT
+#define BENCH_COMMIT            (0x0)
+#endif
+
+/* Records the cycle count at an instrumented point of the application. Only
+ * the first hit per sample is kept; bench_stamps_clear() re-arms all points. */
+#if (BENCHMARK_ENABLE)
+#define BENCH_STAMP(point)                                                     \
+    do                                                                         \
+    {                                                                          \
+        if (0U == bench_stamps[(point)])                                       \
+        {                                                                      \
+            bench_stamps[(point)] = cycle_counter_get();                       \
+        }                                                                      \
+    } while (0)
+#else
+#define BENCH_STAMP(point)
+#endif /* BENCHMARK_ENABLE */
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Operation under test. Called BENCH_ITERATIONS times per repetition. */
+typedef void (*bench_fn_t)(void *arg);
+
+/* Instrumented points of the application */
+typedef enum
+{
+    BENCH_STAMP_ISR_ENTRY,      /* Entry of isr_canfd */
+    BENCH_STAMP_RX_CALLBACK,    /* Entry of the RX callback */
+    BENCH_STAMP_COUNT
+} bench_stamp_t;
+
+/* Running statistics of a per-sample measurement */
+typedef struct
+{
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t count;
+} bench_stats_t;
+
+/* One benchmark case */
+typedef struct
+{
+    const char *name;           /* Unique name, used to compare runs */
+    bench_fn_t  fn;             /* Operation under test */
+    void       *arg;            /* Argument passed to fn */
+    uint32_t    bytes;          /* Payload size processed per call */
+} bench_case_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Written by cases so that the compiler cannot drop the measured work */
+extern volatile uint32_t bench_sink;
+
+/* Cycle counts captured by BENCH_STAMP() */
+extern volatile uint32_t bench_stamps[BENCH_STAMP_COUNT];
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void bench_begin(void);
+void bench_report(const char *group, const char *name, uint32_t bytes,
+                  const bench_stats_t *stats);
+void bench_end(void);
+void bench_run(const char *group, const bench_case_t *cases, uint32_t count);
+void bench_stats_init(bench_stats_t *stats);
+void bench_stats_add(bench_stats_t *stats, uint32_t cycles);
+void bench_stamps_clear(void);
+
+void bench_suite_run(CANFD_Type *base, uint32_t chan,
+                     cy_stc_canfd_context_t *context);
+void bench_sw_run(CANFD_Type *base, uint32_t chan,
+                  cy_stc_canfd_context_t *context);
+void bench_hw_run(CANFD_Type *base, uint32_t chan,
+                  cy_stc_canfd_context_t *context);
+void bench_wake_run(CANFD_Type *base, uint32_t chan,
+                    cy_stc_canfd_context_t *context);
+void bench_wake_print(void);
+void bench_fzip_run(void);
+void bench_fzip_print(void);
+void bench_rxdma_run(CANFD_Type *base, uint32_t chan,
+                     cy_stc_canfd_context_t *context);
+void bench_rxdma_print(void);
+void bench_dsp_run(void);
+void bench_dsp_print(void);
+void bench_cancrypt_run(void);
+void bench_cancrypt_print(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* BENCH_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,274 @@
+/******************************************************************************
+* File Name:   bench_cancrypt.c
+*
+* Description: This file contains the benchmark of the sealing and opening of
+*              CAN FD payloads with the software AES and with Cryptolite.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+#include "cancrypt_can.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Frames measured: X(identifier, name, mode, payload bytes, open). The
+ * lengths are the largest payloads that fit a 64-byte frame. */
+#define BENCH_CANCRYPT_CASE_LIST(X)                                            \
+    X(GCM_SEAL_48,  "gcm_seal_48",  CANCRYPT_MODE_GCM, 48U, false)             \
+    X(GCM_OPEN_48,  "gcm_open_48",  CANCRYPT_MODE_GCM, 48U, true)              \
+    X(GCM_SEAL_8,   "gcm_seal_8",   CANCRYPT_MODE_GCM,  8U, false)             \
+    X(GCM_OPEN_8,   "gcm_open_8",   CANCRYPT_MODE_GCM,  8U, true)              \
+    X(CTR_SEAL_56,  "ctr_seal_56",  CANCRYPT_MODE_CTR, 56U, false)             \
+    X(CTR_OPEN_56,  "ctr_open_56",  CANCRYPT_MODE_CTR, 56U, true)
+
+/* AES backends: the bitsliced software AES, and Cryptolite where present */
+#if (CANCRYPT_CAN_HW)
+#define BENCH_CANCRYPT_BACKENDS (2U)
+#else
+#define BENCH_CANCRYPT_BACKENDS (1U)
+#endif /* CANCRYPT_CAN_HW */
+
+#define BENCH_CANCRYPT_ID       (0x001U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+#define BENCH_CANCRYPT_CASE_ENUM(id, name, mode, len, open) BENCH_CANCRYPT_##id,
+typedef enum
+{
+    BENCH_CANCRYPT_CASE_LIST(BENCH_CANCRYPT_CASE_ENUM)
+    BENCH_CANCRYPT_COUNT
+} bench_cancrypt_case_t;
+#undef BENCH_CANCRYPT_CASE_ENUM
+
+typedef struct
+{
+    const char      *name;
+    cancrypt_mode_t  mode;
+    uint8_t          len;
+    bool             open;
+} bench_cancrypt_info_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+#define BENCH_CANCRYPT_CASE_INFO(id, name, mode, len, open)                    \
+    { (name), (mode), (len), (open) },
+static const bench_cancrypt_info_t bench_cancrypt_cases[BENCH_CANCRYPT_COUNT] =
+{
+    BENCH_CANCRYPT_CASE_LIST(BENCH_CANCRYPT_CASE_INFO)
+};
+#undef BENCH_CANCRYPT_CASE_INFO
+
+static const char *const bench_cancrypt_groups[2] =
+{
+    "cancrypt_sw", "cancrypt_hw"
+};
+
+/* FIPS-197 appendix B key */
+static const uint8_t bench_cancrypt_raw_key[CANCRYPT_KEY_LEN] =
+{
+    0x2BU, 0x7EU, 0x15U, 0x16U, 0x28U, 0xAEU, 0xD2U, 0xA6U,
+    0xABU, 0xF7U, 0x15U, 0x88U, 0x09U, 0xCFU, 0x4FU, 0x3CU
+};
+
+static cancrypt_aes_t   bench_cancrypt_aes;
+#if (CANCRYPT_CAN_HW)
+static cy_stc_cryptolite_aes_state_t    bench_cancrypt_hw_state;
+CY_ALIGN(4) static cy_stc_cryptolite_aes_buffers_t bench_cancrypt_hw_buffers;
+#endif /* CANCRYPT_CAN_HW */
+static cancrypt_key_t   bench_cancrypt_keys[BENCH_CANCRYPT_BACKENDS];
+
+/* Payload, and the sealed frame that the open cases start from */
+static uint8_t          bench_cancrypt_plain[CANFD_MAX_DATA_LEN];
+static uint8_t          bench_cancrypt_sealed[CANFD_MAX_DATA_LEN];
+static uint8_t          bench_cancrypt_data[CANFD_MAX_DATA_LEN];
+static uint8_t          bench_cancrypt_sealed_len;
+static uint32_t         bench_cancrypt_counter;
+
+/* Mean cycles per frame of each case, for bench_cancrypt_print() */
+static uint32_t bench_cancrypt_cycles[BENCH_CANCRYPT_BACKENDS]
+                                     [BENCH_CANCRYPT_COUNT];
+
+/*******************************************************************************
+* Function Name: bench_cancrypt_call
+********************************************************************************
+* Summary:
+* Seals the payload, or opens the sealed frame, of one case. Both start by
+* copying their input, as they work in place.
+*
+*******************************************************************************/
+static void bench_cancrypt_call(const cancrypt_key_t *key,
+                                const bench_cancrypt_info_t *info)
+{
+    uint32_t epoch;
+    uint32_t counter;
+
+    if (info->open)
+    {
+        memcpy(bench_cancrypt_data, bench_cancrypt_sealed,
+               bench_cancrypt_sealed_len);
+        bench_sink = (uint32_t)cancrypt_open(key, info->mode,
+                                             BENCH_CANCRYPT_ID,
+                                             bench_cancrypt_data,
+                                             bench_cancrypt_sealed_len,
+                                             &epoch, &counter);
+    }
+    else
+    {
+        memcpy(bench_cancrypt_data, bench_cancrypt_plain, info->len);
+        bench_sink = cancrypt_seal(key, info->mode, BENCH_CANCRYPT_ID, 1U,
+                                   bench_cancrypt_counter++,
+                                   bench_cancrypt_data, info->len);
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_cancrypt_run
+********************************************************************************
+* Summary:
+* Seals and opens the payloads of each case with the software AES and, on
+* devices with Cryptolite, with the accelerator, and reports the cycles per
+* frame. The AES, CTR and GHASH code does not branch on the key or the
+* data, so the minimum and the mean should only differ by cache and bus
+* effects. The microseconds per frame are printed by bench_cancrypt_print().
+*
+*******************************************************************************/
+void bench_cancrypt_run(void)
+{
+    for (uint32_t idx = 0U; idx < CANFD_MAX_DATA_LEN; idx++)
+    {
+        bench_cancrypt_plain[idx] = (uint8_t)((idx * 37U) + 11U);
+    }
+
+    cancrypt_aes_init(&bench_cancrypt_aes, bench_cancrypt_raw_key);
+    cancrypt_key_init(&bench_cancrypt_keys[0], cancrypt_aes_ecb,
+                      &bench_cancrypt_aes);
+#if (CANCRYPT_CAN_HW)
+    (void)Cy_Cryptolite_Aes_Init(CRYPTOLITE, bench_cancrypt_raw_key,
+                                 &bench_cancrypt_hw_state,
+                                 &bench_cancrypt_hw_buffers);
+    cancrypt_key_init(&bench_cancrypt_keys[1], cancrypt_can_hw_ecb,
+                      &bench_cancrypt_hw_state);
+#endif /* CANCRYPT_CAN_HW */
+
+    for (uint32_t backend = 0U; backend < BENCH_CANCRYPT_BACKENDS; backend++)
+    {
+        const cancrypt_key_t *key = &bench_cancrypt_keys[backend];
+
+        for (uint32_t id = 0U; id < (uint32_t)BENCH_CANCRYPT_COUNT; id++)
+        {
+            const bench_cancrypt_info_t *info = &bench_cancrypt_cases[id];
+            bench_stats_t stats;
+
+            memcpy(bench_cancrypt_sealed, bench_cancrypt_plain, info->len);
+            bench_cancrypt_sealed_len = cancrypt_seal(key, info->mode,
+                                                      BENCH_CANCRYPT_ID, 1U,
+                                                      0U,
+                                                      bench_cancrypt_sealed,
+                                                      info->len);
+            bench_stats_init(&stats);
+
+            /* Warm up caches and branch predictors before timing */
+            bench_cancrypt_call(key, info);
+
+            for (uint32_t rep = 0U; rep < BENCH_REPEAT; rep++)
+            {
+                uint32_t primask = __get_PRIMASK();
+                uint32_t start;
+                uint32_t cycles;
+
+                __disable_irq();
+                start = cycle_counter_get();
+                bench_cancrypt_call(key, info);
+                cycles = cycle_counter_get() - start;
+                __set_PRIMASK(primask);
+
+                bench_stats_add(&stats, cycles);
+            }
+
+            bench_report(bench_cancrypt_groups[backend], info->name,
+                         info->len, &stats);
+            bench_cancrypt_cycles[backend][id] =
+                (uint32_t)(stats.sum / stats.count);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_cancrypt_print
+********************************************************************************
+* Summary:
+* Prints the microseconds per frame of each case, which for the open cases
+* is the latency encryption adds to a received frame. Called after the
+* result block.
+*
+*******************************************************************************/
+void bench_cancrypt_print(void)
+{
+    for (uint32_t backend = 0U; backend < BENCH_CANCRYPT_BACKENDS; backend++)
+    {
+        for (uint32_t id = 0U; id < (uint32_t)BENCH_CANCRYPT_COUNT; id++)
+        {
+            /* Hundredths of a microsecond */
+            uint32_t centi = (uint32_t)(((uint64_t)bench_cancrypt_cycles
+                                         [backend][id] * 100000000U) /
+                                        SystemCoreClock);
+
+            if (0U == bench_cancrypt_cycles[backend][id])
+            {
+                continue;
+            }
+            printf("Crypto: %-11s %-12s %lu cycles, %lu.%02lu us/frame\r\n",
+                   bench_cancrypt_groups[backend],
+                   bench_cancrypt_cases[id].name,
+                   (unsigned long)bench_cancrypt_cycles[backend][id],
+                   (unsigned long)(centi / 100U),
+                   (unsigned long)(centi % 100U));
+        }
+    }
+    printf("\r\n");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,233 @@
+/******************************************************************************
+* File Name:   bench_dsp.c
+*
+* Description: Benchmark of the DSP kernels, SIMD against reference, per block
+*              of samples.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "bench.h"
+#include "dsp_can.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Samples per call, the samples of a 64-byte payload */
+#define BENCH_DSP_BLOCK         (DSP_BLOCK_MAX)
+
+/* Kernels measured: X(identifier, name) */
+#define BENCH_DSP_CASE_LIST(X)                                                 \
+    X(FIR_24,       "fir_24")                                                  \
+    X(FIR_24_REF,   "fir_24_ref")                                              \
+    X(DECIM_4,      "fir_24_decim_4")                                          \
+    X(DECIM_4_REF,  "fir_24_decim_4_ref")                                      \
+    X(BIQUAD_2,     "biquad_2")                                                \
+    X(BIQUAD_2_REF, "biquad_2_ref")                                            \
+    X(SCALE,        "scale")                                                   \
+    X(SCALE_REF,    "scale_ref")
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+#define BENCH_DSP_CASE_ENUM(id, name)   BENCH_DSP_##id,
+typedef enum
+{
+    BENCH_DSP_CASE_LIST(BENCH_DSP_CASE_ENUM)
+    BENCH_DSP_COUNT
+} bench_dsp_case_t;
+#undef BENCH_DSP_CASE_ENUM
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+#define BENCH_DSP_CASE_NAME(id, name)   name,
+static const char *const bench_dsp_names[BENCH_DSP_COUNT] =
+{
+    BENCH_DSP_CASE_LIST(BENCH_DSP_CASE_NAME)
+};
+#undef BENCH_DSP_CASE_NAME
+
+/* Filters of the receive chain of dsp_can.c */
+static const int16_t bench_dsp_fir_coeffs[DSP_CAN_FIR_TAPS] =
+    DSP_CAN_FIR_COEFFS;
+static const dsp_biquad_coeffs_t
+    bench_dsp_biquad_coeffs[DSP_CAN_BIQUAD_STAGES] = DSP_CAN_BIQUAD_COEFFS;
+
+static dsp_fir_t    bench_dsp_fir;
+static dsp_biquad_t bench_dsp_biquad;
+static int16_t      bench_dsp_in[BENCH_DSP_BLOCK];
+static int16_t      bench_dsp_out[BENCH_DSP_BLOCK];
+
+/* Mean cycles per call of each case, for bench_dsp_print() */
+static uint32_t     bench_dsp_cycles[BENCH_DSP_COUNT];
+
+/*******************************************************************************
+* Function Name: bench_dsp_call
+********************************************************************************
+* Summary:
+* Runs one case on the input block.
+*
+*******************************************************************************/
+static void bench_dsp_call(bench_dsp_case_t id)
+{
+    switch (id)
+    {
+        case BENCH_DSP_FIR_24:
+        case BENCH_DSP_DECIM_4:
+            bench_sink = dsp_fir_q15(&bench_dsp_fir, bench_dsp_in,
+                                     bench_dsp_out, BENCH_DSP_BLOCK);
+            break;
+        case BENCH_DSP_FIR_24_REF:
+        case BENCH_DSP_DECIM_4_REF:
+            bench_sink = dsp_fir_q15_ref(&bench_dsp_fir, bench_dsp_in,
+                                         bench_dsp_out, BENCH_DSP_BLOCK);
+            break;
+        case BENCH_DSP_BIQUAD_2:
+            dsp_biquad_q15(&bench_dsp_biquad, bench_dsp_in, bench_dsp_out,
+                           BENCH_DSP_BLOCK);
+            break;
+        case BENCH_DSP_BIQUAD_2_REF:
+            dsp_biquad_q15_ref(&bench_dsp_biquad, bench_dsp_in, bench_dsp_out,
+                               BENCH_DSP_BLOCK);
+            break;
+        case BENCH_DSP_SCALE:
+            dsp_scale_q15(bench_dsp_in, bench_dsp_out, BENCH_DSP_BLOCK,
+                          DSP_CAN_GAIN, DSP_CAN_SHIFT, DSP_CAN_OFFSET);
+            break;
+        default:
+            dsp_scale_q15_ref(bench_dsp_in, bench_dsp_out, BENCH_DSP_BLOCK,
+                              DSP_CAN_GAIN, DSP_CAN_SHIFT, DSP_CAN_OFFSET);
+            break;
+    }
+    bench_sink = (uint16_t)bench_dsp_out[0];
+}
+
+/*******************************************************************************
+* Function Name: bench_dsp_run
+********************************************************************************
+* Summary:
+* Runs each kernel of dsp.c, SIMD and reference, on a block of
+* BENCH_DSP_BLOCK samples and reports the cycles per block:
+*  fir_24           24-tap FIR filter, an output per input
+*  fir_24_decim_4   the same filter decimating by 4
+*  biquad_2         cascade of two biquad sections
+*  scale            gain and offset
+* The cycles per sample and samples per second are printed by
+* bench_dsp_print().
+*
+*******************************************************************************/
+void bench_dsp_run(void)
+{
+    uint32_t seed = 1U;
+
+    for (uint32_t idx = 0U; idx < BENCH_DSP_BLOCK; idx++)
+    {
+        seed = (seed * 1664525U) + 1013904223U;
+        bench_dsp_in[idx] = (int16_t)(seed >> 16);
+    }
+    (void)dsp_biquad_init(&bench_dsp_biquad, bench_dsp_biquad_coeffs,
+                          DSP_CAN_BIQUAD_STAGES);
+
+    for (uint32_t id = 0U; id < (uint32_t)BENCH_DSP_COUNT; id++)
+    {
+        bench_stats_t stats;
+
+        (void)dsp_fir_init(&bench_dsp_fir, bench_dsp_fir_coeffs,
+                           DSP_CAN_FIR_TAPS,
+                           ((BENCH_DSP_DECIM_4 == id) ||
+                            (BENCH_DSP_DECIM_4_REF == id)) ?
+                           DSP_CAN_DECIMATION : 1U);
+        bench_stats_init(&stats);
+
+        /* Warm up caches and branch predictors before timing */
+        bench_dsp_call((bench_dsp_case_t)id);
+
+        for (uint32_t rep = 0U; rep < BENCH_REPEAT; rep++)
+        {
+            uint32_t primask = __get_PRIMASK();
+            uint32_t start;
+            uint32_t cycles;
+
+            __disable_irq();
+            start = cycle_counter_get();
+            bench_dsp_call((bench_dsp_case_t)id);
+            cycles = cycle_counter_get() - start;
+            __set_PRIMASK(primask);
+
+            bench_stats_add(&stats, cycles);
+        }
+
+        bench_report("dsp", bench_dsp_names[id],
+                     BENCH_DSP_BLOCK * sizeof(int16_t), &stats);
+        bench_dsp_cycles[id] = (uint32_t)(stats.sum / stats.count);
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_dsp_print
+********************************************************************************
+* Summary:
+* Prints the cycles per input sample of each kernel and the samples per
+* second the CPU runs through it. Called after the result block.
+*
+*******************************************************************************/
+void bench_dsp_print(void)
+{
+    for (uint32_t id = 0U; id < (uint32_t)BENCH_DSP_COUNT; id++)
+    {
+        /* Hundredths of a cycle */
+        uint32_t centi = (bench_dsp_cycles[id] * 100U) / BENCH_DSP_BLOCK;
+
+        if (0U == bench_dsp_cycles[id])
+        {
+            continue;
+        }
+        printf("DSP: %-18s %lu.%02lu cycles/sample, %lu ksamples/s\r\n",
+               bench_dsp_names[id], (unsigned long)(centi / 100U),
+               (unsigned long)(centi % 100U),
+               (unsigned long)(((uint64_t)SystemCoreClock * BENCH_DSP_BLOCK) /
+                               ((uint64_t)bench_dsp_cycles[id] * 1000U)));
+    }
+    printf("\r\n");
+}
+
+/* [] END OF FILE */
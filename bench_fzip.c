@@ -0,0 +1,210 @@
+/******************************************************************************
+* File Name:   bench_fzip.c
+*
+* Description: This file contains the compression benchmark, which replays a
+*              recorded trace through the frame stream compressor.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+#include "canfd_frame.h"
+#include "fzip.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Byte rate of the debug UART: 115200 baud, 10 bits per byte */
+#define BENCH_FZIP_UART_BYTES_PER_S (11520U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* One frame of the replayed trace, generated by scripts/fzip_trace.py */
+typedef struct
+{
+    uint32_t id;
+    uint16_t offset;                        /* In fzip_trace_data */
+    uint16_t ts;                            /* Controller timestamp */
+    uint8_t  len;
+    uint8_t  flags;                         /* CANFD_FRAME_FLAG_xxx */
+} bench_fzip_frame_t;
+
+#include "fzip_trace.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static fzip_encoder_t bench_fzip_encoder;
+
+/* Bytes of the replay in each form, printed after the result block */
+static uint32_t bench_fzip_text_bytes;
+static fzip_stats_t bench_fzip_stats;
+
+/*******************************************************************************
+* Function Name: bench_fzip_write
+********************************************************************************
+* Summary:
+* Output of the encoder during the replay. The blocks are only counted.
+*
+*******************************************************************************/
+static void bench_fzip_write(const uint8_t *data, uint32_t len)
+{
+    bench_sink = data[len - 1U];
+}
+
+/*******************************************************************************
+* Function Name: bench_fzip_frame
+********************************************************************************
+* Summary:
+* Rebuilds a frame of the trace as received.
+*
+*******************************************************************************/
+static void bench_fzip_frame(const bench_fzip_frame_t *entry,
+                             canfd_frame_t *frame)
+{
+    memset(frame, 0, sizeof(*frame));
+    frame->id = entry->id;
+    frame->timestamp = entry->ts;
+    frame->len = entry->len;
+    frame->flags = entry->flags;
+    memcpy(frame->data, &fzip_trace_data[entry->offset], entry->len);
+}
+
+/*******************************************************************************
+* Function Name: bench_fzip_run
+********************************************************************************
+* Summary:
+* Compresses the frames of fzip_trace.h one at a time, in order, and
+* measures:
+*  encode_frame     duration of fzip_encode(), including the block write
+*                   of every frame that closes a block
+*  format_text      duration of canfd_frame_format(), the log text that the
+*                   compressed stream replaces
+* The sizes of the replay as text, raw and compressed are kept for
+* bench_fzip_print().
+*
+*******************************************************************************/
+void bench_fzip_run(void)
+{
+    static char text[CANFD_FRAME_FORMAT_SIZE];
+    uint32_t count = (uint32_t)(sizeof(fzip_trace) / sizeof(fzip_trace[0]));
+    bench_stats_t encode;
+    bench_stats_t format;
+
+    bench_stats_init(&encode);
+    bench_stats_init(&format);
+    bench_fzip_text_bytes = 0U;
+    fzip_init(&bench_fzip_encoder, bench_fzip_write);
+
+    for (uint32_t idx = 0U; idx < count; idx++)
+    {
+        uint32_t primask = __get_PRIMASK();
+        canfd_frame_t frame;
+        uint32_t start;
+        uint32_t encoded;
+        uint32_t formatted;
+        size_t len;
+
+        bench_fzip_frame(&fzip_trace[idx], &frame);
+
+        __disable_irq();
+        start = cycle_counter_get();
+        fzip_encode(&bench_fzip_encoder, &frame);
+        encoded = cycle_counter_get();
+        len = canfd_frame_format(&frame, text, sizeof(text));
+        formatted = cycle_counter_get();
+        __set_PRIMASK(primask);
+
+        bench_stats_add(&encode, encoded - start);
+        bench_stats_add(&format, formatted - encoded);
+        bench_fzip_text_bytes += (uint32_t)len;
+    }
+    fzip_flush(&bench_fzip_encoder);
+    bench_fzip_stats = bench_fzip_encoder.stats;
+
+    bench_report("fzip", "encode_frame",
+                 bench_fzip_stats.raw_bytes / count, &encode);
+    bench_report("fzip", "format_text",
+                 bench_fzip_stats.raw_bytes / count, &format);
+}
+
+/*******************************************************************************
+* Function Name: bench_fzip_print
+********************************************************************************
+* Summary:
+* Prints the sizes of the last replay and the frame rates the debug UART
+* carries in each form. Called after the result block, since these are not
+* cycle measurements.
+*
+*******************************************************************************/
+void bench_fzip_print(void)
+{
+    const fzip_stats_t *stats = &bench_fzip_stats;
+    uint32_t ratio;
+
+    if ((0U == stats->frames) || (0U == stats->wire_bytes))
+    {
+        return;
+    }
+
+    /* Ratios in hundredths */
+    ratio = (stats->raw_bytes * 100U) / stats->wire_bytes;
+    printf("FZIP: %lu frames: text %lu bytes, raw %lu bytes, compressed "
+           "%lu bytes in %lu blocks\r\n", (unsigned long)stats->frames,
+           (unsigned long)bench_fzip_text_bytes,
+           (unsigned long)stats->raw_bytes, (unsigned long)stats->wire_bytes,
+           (unsigned long)stats->blocks);
+    printf("FZIP: ratio %lu.%02lu to raw", (unsigned long)(ratio / 100U),
+           (unsigned long)(ratio % 100U));
+    ratio = (bench_fzip_text_bytes * 100U) / stats->wire_bytes;
+    printf(", %lu.%02lu to text\r\n", (unsigned long)(ratio / 100U),
+           (unsigned long)(ratio % 100U));
+    printf("FZIP: debug UART carries %lu frames/s compressed, %lu frames/s "
+           "as text\r\n\r\n",
+           (unsigned long)(((uint64_t)BENCH_FZIP_UART_BYTES_PER_S *
+                            stats->frames) / stats->wire_bytes),
+           (unsigned long)(((uint64_t)BENCH_FZIP_UART_BYTES_PER_S *
+                            stats->frames) / bench_fzip_text_bytes));
+}
+
+/* [] END OF FILE */
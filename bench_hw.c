@@ -0,0 +1,243 @@
+/******************************************************************************
+* File Name:   bench_hw.c
+*
+* Description: This file contains the on-target benchmark cases which measure
+*              the interrupt, transmit and message RAM paths with the DWT
+*              cycle counter.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "bench.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* TX buffer used for the loopback frames */
+#define BENCH_HW_TX_BUFFER      (0U)
+
+/* Words of one message RAM element: two header words and 8 data bytes */
+#define BENCH_HW_ELEMENT_WORDS  (4U)
+
+/* Give up on a loopback frame after 10 ms */
+#define BENCH_HW_TIMEOUT_CYCLES (SystemCoreClock / 100U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Set by the benchmark RX callback */
+static volatile bool bench_hw_rx_done;
+
+/* Message RAM elements accessed by the read and write cases */
+static volatile uint32_t *bench_hw_rx_element;
+static volatile uint32_t *bench_hw_tx_element;
+
+/*******************************************************************************
+* Function Name: bench_hw_rx_callback
+********************************************************************************
+* Summary:
+* RX callback installed while the loopback samples are taken. It only records
+* its entry time so the application log does not distort the measurement.
+*
+*******************************************************************************/
+static void bench_hw_rx_callback(bool msg_valid, uint8_t msg_buf_fifo_num,
+                                 cy_stc_canfd_rx_buffer_t *canfd_rx_buf)
+{
+    BENCH_STAMP(BENCH_STAMP_RX_CALLBACK);
+    CY_UNUSED_PARAMETER(msg_valid);
+    CY_UNUSED_PARAMETER(msg_buf_fifo_num);
+    CY_UNUSED_PARAMETER(canfd_rx_buf);
+    bench_hw_rx_done = true;
+}
+
+/*******************************************************************************
+* Benchmark operations
+*******************************************************************************/
+static void bench_msgram_read(void *arg)
+{
+    uint32_t acc = 0U;
+
+    CY_UNUSED_PARAMETER(arg);
+    for (uint32_t idx = 0U; idx < BENCH_HW_ELEMENT_WORDS; idx++)
+    {
+        acc ^= bench_hw_rx_element[idx];
+    }
+    bench_sink = acc;
+}
+
+static void bench_msgram_write(void *arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+    for (uint32_t idx = 0U; idx < BENCH_HW_ELEMENT_WORDS; idx++)
+    {
+        bench_hw_tx_element[idx] = idx;
+    }
+}
+
+/*******************************************************************************
+* Benchmark Cases
+*******************************************************************************/
+static const bench_case_t bench_hw_cases[] =
+{
+    { "msgram_read_elem8",  bench_msgram_read,  NULL, 8U },
+    { "msgram_write_elem8", bench_msgram_write, NULL, 8U },
+};
+
+/*******************************************************************************
+* Function Name: bench_hw_loopback
+********************************************************************************
+* Summary:
+* Switches the channel into or out of internal loopback, so that the
+* benchmark frames neither need a second node nor disturb the bus.
+*
+*******************************************************************************/
+static void bench_hw_loopback(CANFD_Type *base, uint32_t chan, bool enable)
+{
+    (void)Cy_CANFD_ConfigChangesEnable(base, chan);
+    Cy_CANFD_TestModeConfig(base, chan, enable ?
+                            CY_CANFD_TEST_MODE_INTERNAL_LOOP_BACK :
+                            CY_CANFD_TEST_MODE_DISABLE);
+    (void)Cy_CANFD_ConfigChangesDisable(base, chan);
+}
+
+/*******************************************************************************
+* Function Name: bench_hw_run
+********************************************************************************
+* Summary:
+* Measures the hardware paths of the application on the board. Each loopback
+* sample sends one frame and takes four intervals:
+*  tx_api              duration of Cy_CANFD_UpdateAndTransmitMsgBuffer()
+*  tx_to_isr_entry     end of the TX call to entry of isr_canfd (includes the
+*                      frame time on the wire)
+*  isr_entry_to_callback  isr_canfd entry to RX callback entry
+*  callback_to_main    RX callback entry to the main loop seeing the frame
+* Message RAM element reads and writes are timed as regular cases. The
+* transmission complete interrupt is masked while the samples are taken:
+* isr_canfd is shared by all interrupts of the channel, and its entry stamp
+* must come from the reception, not from the end of the transmission.
+*
+* Parameters:
+*  base         CAN FD block
+*  chan         CAN FD channel, initialized and with its interrupt enabled
+*  context      Channel context
+*
+*******************************************************************************/
+void bench_hw_run(CANFD_Type *base, uint32_t chan,
+                  cy_stc_canfd_context_t *context)
+{
+    cy_canfd_rx_msg_func_ptr_t app_rx_callback =
+        context->canFDInterruptHandling.canFDRxInterruptFunction;
+    uint32_t app_irq_mask = Cy_CANFD_GetInterruptMask(base, chan);
+    bench_stats_t tx_api;
+    bench_stats_t tx_to_isr;
+    bench_stats_t isr_to_callback;
+    bench_stats_t callback_to_main;
+
+    bench_stats_init(&tx_api);
+    bench_stats_init(&tx_to_isr);
+    bench_stats_init(&isr_to_callback);
+    bench_stats_init(&callback_to_main);
+
+    context->canFDInterruptHandling.canFDRxInterruptFunction =
+        bench_hw_rx_callback;
+    Cy_CANFD_SetInterruptMask(base, chan,
+                              app_irq_mask & ~CY_CANFD_TRANSMISSION_COMPLETE);
+    bench_hw_loopback(base, chan, true);
+
+    for (uint32_t sample = 0U; sample < BENCH_HW_SAMPLES; sample++)
+    {
+        uint32_t start;
+        uint32_t sent;
+        uint32_t seen;
+        cy_en_canfd_status_t status;
+
+        bench_stamps_clear();
+        bench_hw_rx_done = false;
+
+        start = cycle_counter_get();
+        status = Cy_CANFD_UpdateAndTransmitMsgBuffer(base, chan,
+                                                     &CANFD_txBuffer_0,
+                                                     BENCH_HW_TX_BUFFER,
+                                                     context);
+        sent = cycle_counter_get();
+
+        if (CY_CANFD_SUCCESS != status)
+        {
+            continue;
+        }
+
+        while ((!bench_hw_rx_done) &&
+               ((cycle_counter_get() - sent) < BENCH_HW_TIMEOUT_CYCLES))
+        {
+        }
+        seen = cycle_counter_get();
+
+        if (bench_hw_rx_done)
+        {
+            uint32_t isr = bench_stamps[BENCH_STAMP_ISR_ENTRY];
+            uint32_t callback = bench_stamps[BENCH_STAMP_RX_CALLBACK];
+
+            bench_stats_add(&tx_api, sent - start);
+            bench_stats_add(&tx_to_isr, isr - sent);
+            bench_stats_add(&isr_to_callback, callback - isr);
+            bench_stats_add(&callback_to_main, seen - callback);
+        }
+    }
+
+    bench_hw_loopback(base, chan, false);
+    Cy_CANFD_ClearInterrupt(base, chan, CY_CANFD_TRANSMISSION_COMPLETE);
+    Cy_CANFD_SetInterruptMask(base, chan, app_irq_mask);
+    context->canFDInterruptHandling.canFDRxInterruptFunction = app_rx_callback;
+
+    bench_report("hw", "tx_api", 8U, &tx_api);
+    bench_report("hw", "tx_to_isr_entry", 8U, &tx_to_isr);
+    bench_report("hw", "isr_entry_to_callback", 8U, &isr_to_callback);
+    bench_report("hw", "callback_to_main", 8U, &callback_to_main);
+
+    bench_hw_rx_element = (volatile uint32_t *)(uintptr_t)
+        Cy_CANFD_CalcRxFifoAdrs(base, chan, 0U, 0U, context);
+    bench_hw_tx_element = (volatile uint32_t *)(uintptr_t)
+        Cy_CANFD_CalcTxBufAdrs(base, chan, BENCH_HW_TX_BUFFER, context);
+    bench_run("hw", bench_hw_cases,
+              (uint32_t)(sizeof(bench_hw_cases) / sizeof(bench_hw_cases[0])));
+}
+
+/* [] END OF FILE */
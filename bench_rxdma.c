@@ -0,0 +1,410 @@
+/******************************************************************************
+* File Name:   bench_rxdma.c
+*
+* Description: Benchmark of the RX FIFO 0 drain: CPU copy against DMA transfer
+*              into the RAM ring.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "cybsp.h"
+#include "bench.h"
+#include "canfd_frame.h"
+#include "rxdma_can.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* TX buffer used for the loopback frames */
+#define BENCH_RXDMA_TX_BUFFER   (0U)
+
+/* Times RX FIFO 0 is filled and drained on each path */
+#ifndef BENCH_RXDMA_SAMPLES
+#define BENCH_RXDMA_SAMPLES     (8U)
+#endif
+
+/* Give up on a frame or a transfer after 10 ms */
+#define BENCH_RXDMA_TIMEOUT_CYCLES  (SystemCoreClock / 100U)
+
+/* RX FIFO 0 events masked while the FIFO is filled */
+#define BENCH_RXDMA_FIFO_EVENTS (CY_CANFD_RX_FIFO_0_NEW_MESSAGE |              \
+                                 CY_CANFD_RX_FIFO_0_WATERMARK_REACHED |        \
+                                 CY_CANFD_TIMEOUT_OCCURRED)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Mean cycles per frame of each path, printed after the result block */
+typedef struct
+{
+    uint32_t sw;                /* CPU copy */
+    uint32_t dma;               /* CPU part of the DMA path */
+    uint32_t transfer;          /* DMA transfer, CPU free */
+    uint32_t frames;            /* Frames drained per path */
+} bench_rxdma_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static bench_rxdma_result_t bench_rxdma_result;
+
+static cy_stc_canfd_t0_t bench_rxdma_t0;
+static cy_stc_canfd_t1_t bench_rxdma_t1;
+static uint32_t bench_rxdma_data[CANFD_MAX_DATA_LEN / sizeof(uint32_t)];
+static cy_stc_canfd_tx_buffer_t bench_rxdma_tx =
+{
+    .t0_f = &bench_rxdma_t0,
+    .t1_f = &bench_rxdma_t1,
+    .data_area_f = bench_rxdma_data
+};
+
+/* Destination of the PDL copy, as in the channel context */
+static cy_stc_canfd_r0_t bench_rxdma_r0;
+static cy_stc_canfd_r1_t bench_rxdma_r1;
+static uint32_t bench_rxdma_rx_data[CANFD_MAX_DATA_LEN / sizeof(uint32_t)];
+static cy_stc_canfd_rx_buffer_t bench_rxdma_rx =
+{
+    .r0_f = &bench_rxdma_r0,
+    .r1_f = &bench_rxdma_r1,
+    .data_area_f = bench_rxdma_rx_data
+};
+
+/* Frame both paths decode into, and the frames the DMA path received */
+static canfd_frame_t bench_rxdma_frame;
+static volatile uint32_t bench_rxdma_received;
+
+/*******************************************************************************
+* Function Name: bench_rxdma_on_element
+********************************************************************************
+* Summary:
+* Receive function installed on the DMA path while it is measured. Decodes
+* the element as the application does, without publishing it.
+*
+*******************************************************************************/
+static void bench_rxdma_on_element(const rxdma_element_t *element)
+{
+    rxdma_can_frame(&bench_rxdma_frame, element);
+    bench_rxdma_received++;
+}
+
+/*******************************************************************************
+* Function Name: bench_rxdma_loopback
+********************************************************************************
+* Summary:
+* Switches the channel into or out of internal loopback.
+*
+*******************************************************************************/
+static void bench_rxdma_loopback(CANFD_Type *base, uint32_t chan, bool enable)
+{
+    (void)Cy_CANFD_ConfigChangesEnable(base, chan);
+    Cy_CANFD_TestModeConfig(base, chan, enable ?
+                            CY_CANFD_TEST_MODE_INTERNAL_LOOP_BACK :
+                            CY_CANFD_TEST_MODE_DISABLE);
+    (void)Cy_CANFD_ConfigChangesDisable(base, chan);
+}
+
+/*******************************************************************************
+* Function Name: bench_rxdma_fill
+********************************************************************************
+* Summary:
+* Sends 64-byte frames in loopback until RX FIFO 0 is full. The FIFO 0
+* events are masked, so the frames stay in the FIFO.
+*
+* Return:
+*  Fill level reached; the FIFO size unless a frame timed out
+*
+*******************************************************************************/
+static uint32_t bench_rxdma_fill(CANFD_Type *base, uint32_t chan,
+                                 cy_stc_canfd_context_t *context)
+{
+    uint32_t size = _FLD2VAL(CANFD_CH_M_TTCAN_RXF0C_F0S,
+                             CANFD_RXF0C(base, chan));
+    uint32_t fill = 0U;
+    canfd_frame_t frame = { 0 };
+
+    frame.id = 0x7F0U;
+    frame.len = CANFD_MAX_DATA_LEN;
+    frame.flags = CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS;
+
+    while (fill < size)
+    {
+        uint32_t sent;
+
+        frame.data[0] = (uint8_t)fill;
+        canfd_frame_to_tx_buffer(&frame, &bench_rxdma_tx);
+        bench_rxdma_t0.esi = CY_CANFD_ESI_ERROR_ACTIVE;
+        bench_rxdma_t1.efc = false;
+        bench_rxdma_t1.mm = 0U;
+
+        if (CY_CANFD_SUCCESS !=
+            Cy_CANFD_UpdateAndTransmitMsgBuffer(base, chan, &bench_rxdma_tx,
+                                                BENCH_RXDMA_TX_BUFFER,
+                                                context))
+        {
+            break;
+        }
+        sent = cycle_counter_get();
+        while (fill == _FLD2VAL(CANFD_CH_M_TTCAN_RXF0S_F0FL,
+                                CANFD_RXF0S(base, chan)))
+        {
+            if ((cycle_counter_get() - sent) >= BENCH_RXDMA_TIMEOUT_CYCLES)
+            {
+                return fill;
+            }
+        }
+        fill = _FLD2VAL(CANFD_CH_M_TTCAN_RXF0S_F0FL, CANFD_RXF0S(base, chan));
+    }
+
+    return fill;
+}
+
+/*******************************************************************************
+* Function Name: bench_rxdma_drain_sw
+********************************************************************************
+* Summary:
+* Drains RX FIFO 0 the way the PDL handler and canfd_rx_callback do: the
+* CPU copies each element out of the message RAM, decodes it and
+* acknowledges it.
+*
+* Return:
+*  Cycles spent
+*
+*******************************************************************************/
+static uint32_t bench_rxdma_drain_sw(CANFD_Type *base, uint32_t chan,
+                                     cy_stc_canfd_context_t *context,
+                                     uint32_t fill)
+{
+    uint32_t cycles = 0U;
+
+    for (uint32_t idx = 0U; idx < fill; idx++)
+    {
+        uint32_t start = cycle_counter_get();
+        uint32_t get = _FLD2VAL(CANFD_CH_M_TTCAN_RXF0S_F0GI,
+                                CANFD_RXF0S(base, chan));
+
+        (void)Cy_CANFD_ExtractMsgFromRXBuffer(base, chan, true,
+                                              CY_CANFD_RX_FIFO_0,
+                                              &bench_rxdma_rx, context);
+        canfd_frame_from_rx_buffer(&bench_rxdma_frame, &bench_rxdma_rx);
+        CANFD_RXF0A(base, chan) = get;
+        cycles += cycle_counter_get() - start;
+    }
+
+    return cycles;
+}
+
+#if (RXDMA_ENABLE)
+/*******************************************************************************
+* Function Name: bench_rxdma_drain_dma
+********************************************************************************
+* Summary:
+* Drains RX FIFO 0 through the DMA path, with the DataWire interrupt masked
+* so that the completion is polled instead.
+*
+* Parameters:
+*  transfer     Cycles the DMA ran, while the CPU was free
+*
+* Return:
+*  Cycles the CPU spent starting and completing the transfers
+*
+*******************************************************************************/
+static uint32_t bench_rxdma_drain_dma(uint32_t *transfer)
+{
+    uint32_t cycles = 0U;
+    uint32_t start = cycle_counter_get();
+    bool started = rxdma_can_start();
+
+    cycles += cycle_counter_get() - start;
+    *transfer = 0U;
+
+    while (started)
+    {
+        start = cycle_counter_get();
+        while (0U == Cy_DMA_Channel_GetInterruptStatusMasked(
+                         RXDMA_CAN_DW, RXDMA_CAN_DW_CHANNEL))
+        {
+            if ((cycle_counter_get() - start) >= BENCH_RXDMA_TIMEOUT_CYCLES)
+            {
+                return cycles;
+            }
+        }
+        *transfer += cycle_counter_get() - start;
+        Cy_DMA_Channel_ClearInterrupt(RXDMA_CAN_DW, RXDMA_CAN_DW_CHANNEL);
+        NVIC_ClearPendingIRQ(RXDMA_CAN_DW_IRQ);
+
+        start = cycle_counter_get();
+        started = rxdma_can_finish();
+        cycles += cycle_counter_get() - start;
+    }
+
+    return cycles;
+}
+#endif /* RXDMA_ENABLE */
+
+/*******************************************************************************
+* Function Name: bench_rxdma_run
+********************************************************************************
+* Summary:
+* Fills RX FIFO 0 with 64-byte frames in internal loopback and drains it on
+* each receive path, measuring per frame:
+*  sw_frame         CPU copy out of the message RAM, decoding and
+*                   acknowledgement of one element
+*  dma_frame        CPU work of the DMA path: starting the transfer,
+*                   acknowledging the batch and decoding from the ring
+*  dma_transfer     time the DMA takes to move one element
+* The DMA cases need RXDMA_ENABLE. The interrupt entry, paid per frame on
+* the CPU copy and per batch with DMA, is not included.
+*
+* Parameters:
+*  base         CAN FD block
+*  chan         CAN FD channel, initialized and with its interrupt enabled
+*  context      Channel context
+*
+*******************************************************************************/
+void bench_rxdma_run(CANFD_Type *base, uint32_t chan,
+                     cy_stc_canfd_context_t *context)
+{
+    uint32_t mask = Cy_CANFD_GetInterruptMask(base, chan);
+    bench_stats_t sw;
+    bench_stats_t dma;
+    bench_stats_t transfer;
+
+    bench_stats_init(&sw);
+    bench_stats_init(&dma);
+    bench_stats_init(&transfer);
+    bench_rxdma_result = (bench_rxdma_result_t){ 0 };
+
+    Cy_CANFD_SetInterruptMask(base, chan, mask & ~BENCH_RXDMA_FIFO_EVENTS);
+    bench_rxdma_loopback(base, chan, true);
+
+    for (uint32_t sample = 0U; sample < BENCH_RXDMA_SAMPLES; sample++)
+    {
+        uint32_t fill = bench_rxdma_fill(base, chan, context);
+
+        if (0U != fill)
+        {
+            bench_stats_add(&sw, bench_rxdma_drain_sw(base, chan, context,
+                                                      fill) / fill);
+            bench_rxdma_result.frames = fill;
+        }
+    }
+
+#if (RXDMA_ENABLE)
+    if (rxdma_can_active())
+    {
+        rxdma_can_rx_fn_t app_rx_fn =
+            rxdma_can_set_callback(bench_rxdma_on_element);
+
+        NVIC_DisableIRQ(RXDMA_CAN_DW_IRQ);
+        for (uint32_t sample = 0U; sample < BENCH_RXDMA_SAMPLES; sample++)
+        {
+            uint32_t fill = bench_rxdma_fill(base, chan, context);
+            uint32_t cycles;
+            uint32_t moved;
+
+            bench_rxdma_received = 0U;
+            cycles = bench_rxdma_drain_dma(&moved);
+            if ((0U != fill) && (fill == bench_rxdma_received))
+            {
+                bench_stats_add(&dma, cycles / fill);
+                bench_stats_add(&transfer, moved / fill);
+            }
+        }
+        NVIC_EnableIRQ(RXDMA_CAN_DW_IRQ);
+        (void)rxdma_can_set_callback(app_rx_fn);
+    }
+#endif /* RXDMA_ENABLE */
+
+    bench_rxdma_loopback(base, chan, false);
+    Cy_CANFD_SetInterruptMask(base, chan, mask);
+
+    bench_report("rxdma", "sw_frame", CANFD_MAX_DATA_LEN, &sw);
+    if (0U != dma.count)
+    {
+        bench_report("rxdma", "dma_frame", CANFD_MAX_DATA_LEN, &dma);
+        bench_report("rxdma", "dma_transfer", CANFD_MAX_DATA_LEN, &transfer);
+    }
+
+    if (0U != sw.count)
+    {
+        bench_rxdma_result.sw = (uint32_t)(sw.sum / sw.count);
+    }
+    if (0U != dma.count)
+    {
+        bench_rxdma_result.dma = (uint32_t)(dma.sum / dma.count);
+        bench_rxdma_result.transfer =
+            (uint32_t)(transfer.sum / transfer.count);
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_rxdma_print
+********************************************************************************
+* Summary:
+* Prints the frame rate each receive path sustains with the whole CPU, the
+* core clock divided by its cycles per frame. Called after the result
+* block.
+*
+*******************************************************************************/
+void bench_rxdma_print(void)
+{
+    const bench_rxdma_result_t *result = &bench_rxdma_result;
+
+    if (0U == result->sw)
+    {
+        printf("RXDMA: RX FIFO 0 could not be filled\r\n");
+        return;
+    }
+
+    printf("RXDMA: %lu-element FIFO, CPU copy %lu cycles/frame, "
+           "max %lu frames/s\r\n", (unsigned long)result->frames,
+           (unsigned long)result->sw,
+           (unsigned long)(SystemCoreClock / result->sw));
+    if (0U != result->dma)
+    {
+        printf("RXDMA: DMA %lu cycles/frame, max %lu frames/s, "
+               "transfer %lu cycles/frame\r\n", (unsigned long)result->dma,
+               (unsigned long)(SystemCoreClock / result->dma),
+               (unsigned long)result->transfer);
+    }
+}
+
+/* [] END OF FILE */
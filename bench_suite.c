@@ -0,0 +1,347 @@
+/******************************************************************************
+* File Name:   bench_suite.c
+*
+* Description: This file contains the benchmark suite covering the frame
+*              handling hot paths.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "bench.h"
+#include "canfd_frame.h"
+#include "hoptrace.h"
+#include "pubsub.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of filter elements in the worst-case filter lookup */
+#define BENCH_FILTER_COUNT      (32U)
+
+/* ID traced by the latency trace cases; bench_frame_8 has an untraced one */
+#define BENCH_HOPTRACE_ID       (0x124U)
+
+/* TX buffer of the enqueue cases, as used by the application */
+#define BENCH_TX_BUFFER         (0U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Received message as handed to the RX callback */
+typedef struct
+{
+    cy_stc_canfd_r0_t        r0;
+    cy_stc_canfd_r1_t        r1;
+    uint32_t                 data[CANFD_MAX_DATA_LEN / 4U];
+    cy_stc_canfd_rx_buffer_t buf;
+} bench_rx_msg_t;
+
+/* TX buffer as passed to Cy_CANFD_UpdateAndTransmitMsgBuffer() */
+typedef struct
+{
+    cy_stc_canfd_t0_t        t0;
+    cy_stc_canfd_t1_t        t1;
+    uint32_t                 data[CANFD_MAX_DATA_LEN / 4U];
+    cy_stc_canfd_tx_buffer_t buf;
+} bench_tx_msg_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static bench_rx_msg_t     bench_rx_8;
+static bench_rx_msg_t     bench_rx_64;
+static bench_tx_msg_t     bench_tx;
+static canfd_frame_t      bench_frame_8;
+static canfd_frame_t      bench_frame_64;
+static canfd_frame_t      bench_frame_out;
+#if (HOPTRACE_ENABLE)
+static canfd_frame_t      bench_frame_traced;
+#endif /* HOPTRACE_ENABLE */
+static cy_stc_id_filter_t bench_filters[BENCH_FILTER_COUNT];
+static char               bench_text[CANFD_FRAME_FORMAT_SIZE];
+
+/* Channel of the TX enqueue cases */
+static CANFD_Type             *bench_canfd_base;
+static uint32_t                bench_canfd_chan;
+static cy_stc_canfd_context_t *bench_canfd_context;
+
+/*******************************************************************************
+* Function Name: bench_rx_msg_init
+********************************************************************************
+* Summary:
+* Prepares a received message with a given payload length.
+*
+*******************************************************************************/
+static void bench_rx_msg_init(bench_rx_msg_t *msg, uint32_t len)
+{
+    msg->r0.id = 0x123U;
+    msg->r0.rtr = CY_CANFD_RTR_DATA_FRAME;
+    msg->r0.xtd = CY_CANFD_XTD_STANDARD_ID;
+    msg->r1.dlc = canfd_len_to_dlc(len);
+    msg->r1.fdf = (len > CANFD_CLASSIC_MAX_DATA_LEN) ?
+                  CY_CANFD_FDF_CAN_FD_FRAME : CY_CANFD_FDF_STANDARD_FRAME;
+    msg->r1.brs = (len > CANFD_CLASSIC_MAX_DATA_LEN);
+    for (uint32_t idx = 0U; idx < (CANFD_MAX_DATA_LEN / 4U); idx++)
+    {
+        msg->data[idx] = 0x9E3779B9UL * (idx + 1U);
+    }
+    msg->buf.r0_f = &msg->r0;
+    msg->buf.r1_f = &msg->r1;
+    msg->buf.data_area_f = msg->data;
+}
+
+/*******************************************************************************
+* Function Name: bench_fixtures_init
+********************************************************************************
+* Summary:
+* Prepares the data used by all cases.
+*
+*******************************************************************************/
+static void bench_fixtures_init(void)
+{
+    bench_rx_msg_init(&bench_rx_8, 8U);
+    bench_rx_msg_init(&bench_rx_64, CANFD_MAX_DATA_LEN);
+    canfd_frame_from_rx_buffer(&bench_frame_8, &bench_rx_8.buf);
+    canfd_frame_from_rx_buffer(&bench_frame_64, &bench_rx_64.buf);
+
+    bench_tx.buf.t0_f = &bench_tx.t0;
+    bench_tx.buf.t1_f = &bench_tx.t1;
+    bench_tx.buf.data_area_f = bench_tx.data;
+    bench_tx.t0.esi = CY_CANFD_ESI_ERROR_ACTIVE;
+    bench_tx.t1.efc = false;
+    bench_tx.t1.mm = 0U;
+
+    /* Only the last element accepts the test identifier */
+    for (uint32_t idx = 0U; idx < BENCH_FILTER_COUNT; idx++)
+    {
+        bench_filters[idx].sfid1 = 0x400U + idx;
+        bench_filters[idx].sfid2 = 0x7FFU;
+        bench_filters[idx].sfec = CY_CANFD_SFEC_STORE_RX_FIFO_0;
+        bench_filters[idx].sft = CY_CANFD_SFT_CLASSIC_FILTER;
+    }
+    bench_filters[BENCH_FILTER_COUNT - 1U].sfid1 = 0x123U;
+
+#if (HOPTRACE_ENABLE)
+    bench_frame_traced = bench_frame_8;
+    bench_frame_traced.id = BENCH_HOPTRACE_ID;
+    bench_frame_traced.flags |= CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS;
+    hoptrace_enable(BENCH_HOPTRACE_ID, 0x7FFU, true);
+#endif /* HOPTRACE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: bench_rx_ignore
+********************************************************************************
+* Summary:
+* RX callback installed while the TX enqueue cases run, so the frames they
+* send in loopback do not reach the application.
+*
+*******************************************************************************/
+static void bench_rx_ignore(bool msg_valid, uint8_t msg_buf_fifo_num,
+                            cy_stc_canfd_rx_buffer_t *canfd_rx_buf)
+{
+    CY_UNUSED_PARAMETER(msg_valid);
+    CY_UNUSED_PARAMETER(msg_buf_fifo_num);
+    CY_UNUSED_PARAMETER(canfd_rx_buf);
+}
+
+/*******************************************************************************
+* Function Name: bench_loopback
+********************************************************************************
+* Summary:
+* Switches the channel into or out of internal loopback, so that the frames
+* of the TX enqueue cases neither need a second node nor disturb the bus.
+*
+*******************************************************************************/
+static void bench_loopback(bool enable)
+{
+    (void)Cy_CANFD_ConfigChangesEnable(bench_canfd_base, bench_canfd_chan);
+    Cy_CANFD_TestModeConfig(bench_canfd_base, bench_canfd_chan, enable ?
+                            CY_CANFD_TEST_MODE_INTERNAL_LOOP_BACK :
+                            CY_CANFD_TEST_MODE_DISABLE);
+    (void)Cy_CANFD_ConfigChangesDisable(bench_canfd_base, bench_canfd_chan);
+}
+
+/*******************************************************************************
+* Benchmark operations
+*******************************************************************************/
+static void bench_rx_decode(void *arg)
+{
+    canfd_frame_from_rx_buffer(&bench_frame_out,
+                               &((bench_rx_msg_t *)arg)->buf);
+    bench_sink = bench_frame_out.len;
+}
+
+/* The RX callback path: decode into the frame pool and publish, then the
+ * main loop path: match the topics, call the subscribers and release */
+static void bench_rx_dispatch(void *arg)
+{
+    pubsub_handle_t handle;
+    canfd_frame_t *frame = pubsub_alloc(&handle);
+
+    if (NULL != frame)
+    {
+        canfd_frame_from_rx_buffer(frame, &((bench_rx_msg_t *)arg)->buf);
+        pubsub_publish(handle);
+    }
+    bench_sink = pubsub_dispatch();
+}
+
+static void bench_tx_encode(void *arg)
+{
+    canfd_frame_to_tx_buffer((const canfd_frame_t *)arg, &bench_tx.buf);
+    bench_sink = bench_tx.t1.dlc;
+}
+
+/* The send path of the application: encode, then write the element into
+ * the message RAM and request its transmission */
+static void bench_tx_enqueue(void *arg)
+{
+    canfd_frame_to_tx_buffer((const canfd_frame_t *)arg, &bench_tx.buf);
+    bench_sink = (uint32_t)Cy_CANFD_UpdateAndTransmitMsgBuffer(
+        bench_canfd_base, bench_canfd_chan, &bench_tx.buf, BENCH_TX_BUFFER,
+        bench_canfd_context);
+}
+
+static void bench_filter_first(void *arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+    bench_sink = (uint32_t)canfd_sid_filter_find(bench_filters, 1U, 0x400U);
+}
+
+static void bench_filter_last(void *arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+    bench_sink = (uint32_t)canfd_sid_filter_find(bench_filters,
+                                                 BENCH_FILTER_COUNT, 0x123U);
+}
+
+static void bench_crc16(void *arg)
+{
+    const canfd_frame_t *frame = (const canfd_frame_t *)arg;
+    bench_sink = canfd_crc16(CANFD_CRC16_INIT, frame->data, frame->len);
+}
+
+static void bench_format(void *arg)
+{
+    bench_sink = canfd_frame_format((const canfd_frame_t *)arg, bench_text,
+                                    sizeof(bench_text));
+}
+
+#if (HOPTRACE_ENABLE)
+static void bench_hoptrace_check(void *arg)
+{
+    bench_sink = (uint32_t)hoptrace_traced((const canfd_frame_t *)arg);
+}
+
+static void bench_hoptrace_tag(void *arg)
+{
+    bench_frame_out = *(const canfd_frame_t *)arg;
+    hoptrace_on_tx(&bench_frame_out);
+    bench_sink = bench_frame_out.len;
+}
+#endif /* HOPTRACE_ENABLE */
+
+/*******************************************************************************
+* Benchmark Cases
+*******************************************************************************/
+static const bench_case_t bench_cases[] =
+{
+    { "rx_decode_8",      bench_rx_decode,    &bench_rx_8,     8U  },
+    { "rx_decode_64",     bench_rx_decode,    &bench_rx_64,    64U },
+    { "tx_encode_8",      bench_tx_encode,    &bench_frame_8,  8U  },
+    { "tx_encode_64",     bench_tx_encode,    &bench_frame_64, 64U },
+    { "rx_dispatch_8",    bench_rx_dispatch,  &bench_rx_8,     8U  },
+    { "rx_dispatch_64",   bench_rx_dispatch,  &bench_rx_64,    64U },
+    { "tx_enqueue_8",     bench_tx_enqueue,   &bench_frame_8,  8U  },
+    { "tx_enqueue_64",    bench_tx_enqueue,   &bench_frame_64, 64U },
+    { "filter_find_1",    bench_filter_first, NULL,            0U  },
+    { "filter_find_32",   bench_filter_last,  NULL,            0U  },
+    { "crc16_8",          bench_crc16,        &bench_frame_8,  8U  },
+    { "crc16_64",         bench_crc16,        &bench_frame_64, 64U },
+    { "format_8",         bench_format,       &bench_frame_8,  8U  },
+    { "format_64",        bench_format,       &bench_frame_64, 64U },
+#if (HOPTRACE_ENABLE)
+    { "hoptrace_check",   bench_hoptrace_check, &bench_frame_8, 8U },
+    { "hoptrace_tag_8",   bench_hoptrace_tag, &bench_frame_traced, 8U },
+#endif /* HOPTRACE_ENABLE */
+};
+
+/*******************************************************************************
+* Function Name: bench_sw_run
+********************************************************************************
+* Summary:
+* Runs the software hot-path cases: frame decode and encode, the dispatch
+* of a received frame through the publish/subscribe layer, the enqueue of a
+* frame for transmission, filter lookup, CRC and log formatting at classic
+* (8 bytes) and FD (64 bytes) sizes, and with HOPTRACE_ENABLE the latency
+* trace check and tagging. The channel is in internal loopback meanwhile,
+* and the frames the enqueue cases send are not passed to the application.
+*
+* Parameters:
+*  base         CAN FD block
+*  chan         CAN FD channel, initialized
+*  context      Channel context
+*
+*******************************************************************************/
+void bench_sw_run(CANFD_Type *base, uint32_t chan,
+                  cy_stc_canfd_context_t *context)
+{
+    cy_canfd_rx_msg_func_ptr_t app_rx_callback =
+        context->canFDInterruptHandling.canFDRxInterruptFunction;
+
+    bench_canfd_base = base;
+    bench_canfd_chan = chan;
+    bench_canfd_context = context;
+    bench_fixtures_init();
+
+    context->canFDInterruptHandling.canFDRxInterruptFunction =
+        bench_rx_ignore;
+    bench_loopback(true);
+    bench_run("sw", bench_cases,
+              (uint32_t)(sizeof(bench_cases) / sizeof(bench_cases[0])));
+    bench_loopback(false);
+    context->canFDInterruptHandling.canFDRxInterruptFunction = app_rx_callback;
+#if (HOPTRACE_ENABLE)
+    hoptrace_enable(BENCH_HOPTRACE_ID, 0x7FFU, false);
+#endif /* HOPTRACE_ENABLE */
+}
+
+/* [] END OF FILE */
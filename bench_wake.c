@@ -0,0 +1,337 @@
+/******************************************************************************
+* File Name:   bench_wake.c
+*
+* Description: This file contains the selective wake-up benchmark, which
+*              replays a recorded bus trace through the wake-up filters and
+*              counts wake-ups.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "cybsp.h"
+#include "bench.h"
+#include "canfd_frame.h"
+#include "nm.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* TX buffer used for the replayed frames */
+#define BENCH_WAKE_TX_BUFFER    (0U)
+
+/* Give up on a replayed frame 10 ms after the transmit request */
+#define BENCH_WAKE_TIMEOUT_CYCLES   (SystemCoreClock / 100U)
+
+/* After transmission, wait 100 us for the frame to come back through the
+ * filters before counting it as rejected */
+#define BENCH_WAKE_RX_CYCLES    (SystemCoreClock / 10000U)
+
+/* Payload bytes stored per trace frame */
+#define BENCH_WAKE_DATA_MAX     (8U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* One frame of the replayed trace, generated by scripts/wake_trace.py */
+typedef struct
+{
+    uint16_t id;
+    uint8_t  len;                           /* Length on the bus */
+    uint8_t  flags;                         /* CANFD_FRAME_FLAG_xxx */
+    bool     wake;                          /* Expected to wake the node */
+    uint8_t  data[BENCH_WAKE_DATA_MAX];     /* Rest of the payload is 0 */
+} bench_wake_frame_t;
+
+#include "wake_trace.h"
+
+/* Outcome of the replay, printed after the result block */
+typedef struct
+{
+    uint32_t frames;        /* Frames replayed */
+    uint32_t passed;        /* Frames passed by the filters, i.e. CPU wakes */
+    uint32_t woke;          /* Frames that woke the node */
+    uint32_t false_wakes;   /* Woke, but not a wake-up frame of the trace */
+    uint32_t missed;        /* Wake-up frame of the trace that did not wake */
+    uint32_t lost;          /* Transmit failed or timed out */
+} bench_wake_counts_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static bench_wake_counts_t bench_wake_counts;
+
+/* Written by the benchmark RX callback */
+static volatile bool     bench_wake_rx_done;
+static volatile bool     bench_wake_rx_match;
+static volatile uint32_t bench_wake_rx_decided;
+static volatile uint32_t bench_wake_rx_check;
+
+static cy_stc_canfd_t0_t bench_wake_t0;
+static cy_stc_canfd_t1_t bench_wake_t1;
+static uint32_t bench_wake_data[CANFD_MAX_DATA_LEN / sizeof(uint32_t)];
+static cy_stc_canfd_tx_buffer_t bench_wake_tx =
+{
+    .t0_f = &bench_wake_t0,
+    .t1_f = &bench_wake_t1,
+    .data_area_f = bench_wake_data
+};
+
+/*******************************************************************************
+* Function Name: bench_wake_rx_callback
+********************************************************************************
+* Summary:
+* RX callback installed during the replay. Does what nm_on_rx_isr() does
+* during selective bus sleep: decodes the frame and checks its payload, and
+* records when the wake-up decision was taken.
+*
+*******************************************************************************/
+static void bench_wake_rx_callback(bool msg_valid, uint8_t msg_buf_fifo_num,
+                                   cy_stc_canfd_rx_buffer_t *canfd_rx_buf)
+{
+    canfd_frame_t frame;
+    uint32_t start;
+    bool match;
+
+    CY_UNUSED_PARAMETER(msg_buf_fifo_num);
+    if (!msg_valid)
+    {
+        return;
+    }
+
+    canfd_frame_from_rx_buffer(&frame, canfd_rx_buf);
+    start = cycle_counter_get();
+    match = nm_wake_match(&frame);
+    bench_wake_rx_decided = cycle_counter_get();
+
+    bench_wake_rx_check = bench_wake_rx_decided - start;
+    bench_wake_rx_match = match;
+    bench_wake_rx_done = true;
+}
+
+/*******************************************************************************
+* Function Name: bench_wake_channel_init
+********************************************************************************
+* Summary:
+* Re-initializes the channel with a configuration and keeps the given RX
+* callback, optionally in internal loopback.
+*
+*******************************************************************************/
+static void bench_wake_channel_init(CANFD_Type *base, uint32_t chan,
+                                    const cy_stc_canfd_config_t *config,
+                                    cy_stc_canfd_context_t *context,
+                                    cy_canfd_rx_msg_func_ptr_t rx_callback,
+                                    bool loopback)
+{
+    cy_en_canfd_status_t status;
+
+    (void)Cy_CANFD_DeInit(base, chan, context);
+    status = Cy_CANFD_Init(base, chan, config, context);
+    CY_ASSERT(CY_CANFD_SUCCESS == status);
+    CY_UNUSED_PARAMETER(status);
+    context->canFDInterruptHandling.canFDRxInterruptFunction = rx_callback;
+
+    (void)Cy_CANFD_ConfigChangesEnable(base, chan);
+    Cy_CANFD_TestModeConfig(base, chan, loopback ?
+                            CY_CANFD_TEST_MODE_INTERNAL_LOOP_BACK :
+                            CY_CANFD_TEST_MODE_DISABLE);
+    (void)Cy_CANFD_ConfigChangesDisable(base, chan);
+}
+
+/*******************************************************************************
+* Function Name: bench_wake_send
+********************************************************************************
+* Summary:
+* Transmits one trace frame and waits until it went out.
+*
+* Parameters:
+*  sent         Cycle count at the end of the transmit call
+*
+* Return:
+*  true if the frame went out
+*
+*******************************************************************************/
+static bool bench_wake_send(CANFD_Type *base, uint32_t chan,
+                            cy_stc_canfd_context_t *context,
+                            const bench_wake_frame_t *entry, uint32_t *sent)
+{
+    canfd_frame_t frame = { 0 };
+
+    frame.id = entry->id;
+    frame.len = entry->len;
+    frame.flags = entry->flags;
+    for (uint32_t idx = 0U; (idx < entry->len) &&
+         (idx < BENCH_WAKE_DATA_MAX); idx++)
+    {
+        frame.data[idx] = entry->data[idx];
+    }
+
+    canfd_frame_to_tx_buffer(&frame, &bench_wake_tx);
+    bench_wake_t0.esi = CY_CANFD_ESI_ERROR_ACTIVE;
+    bench_wake_t1.efc = false;
+    bench_wake_t1.mm = 0U;
+
+    if (CY_CANFD_SUCCESS !=
+        Cy_CANFD_UpdateAndTransmitMsgBuffer(base, chan, &bench_wake_tx,
+                                            BENCH_WAKE_TX_BUFFER, context))
+    {
+        return false;
+    }
+    *sent = cycle_counter_get();
+
+    /* A frame stuck here is dropped when the channel is re-initialized */
+    while (CY_CANFD_TX_BUFFER_PENDING ==
+           Cy_CANFD_GetTxBufferStatus(base, chan, BENCH_WAKE_TX_BUFFER))
+    {
+        if ((cycle_counter_get() - *sent) >= BENCH_WAKE_TIMEOUT_CYCLES)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: bench_wake_run
+********************************************************************************
+* Summary:
+* Replays the frames of wake_trace.h through the channel in internal
+* loopback, configured as during selective bus sleep, and measures:
+*  tx_to_decision   end of the transmit call to the wake-up decision in the
+*                   RX interrupt, for frames that passed the filters
+*                   (includes the frame time on the wire)
+*  payload_check    duration of nm_wake_match()
+* The counts of filtered, passed, woken, false and missed wake-ups are kept
+* for bench_wake_print().
+*
+* Parameters:
+*  base         CAN FD block
+*  chan         CAN FD channel, initialized and with its interrupt enabled
+*  context      Channel context
+*
+*******************************************************************************/
+void bench_wake_run(CANFD_Type *base, uint32_t chan,
+                    cy_stc_canfd_context_t *context)
+{
+    cy_canfd_rx_msg_func_ptr_t app_rx_callback =
+        context->canFDInterruptHandling.canFDRxInterruptFunction;
+    bench_stats_t latency;
+    bench_stats_t check;
+
+    bench_stats_init(&latency);
+    bench_stats_init(&check);
+    bench_wake_counts = (bench_wake_counts_t){ 0 };
+
+    bench_wake_channel_init(base, chan, nm_wake_config(&CANFD_config),
+                            context, bench_wake_rx_callback, true);
+
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(wake_trace) / sizeof(wake_trace[0])); idx++)
+    {
+        const bench_wake_frame_t *entry = &wake_trace[idx];
+        uint32_t sent;
+        uint32_t done;
+
+        bench_wake_rx_done = false;
+        bench_wake_counts.frames++;
+
+        if (!bench_wake_send(base, chan, context, entry, &sent))
+        {
+            bench_wake_counts.lost++;
+            continue;
+        }
+
+        done = cycle_counter_get();
+        while ((!bench_wake_rx_done) &&
+               ((cycle_counter_get() - done) < BENCH_WAKE_RX_CYCLES))
+        {
+        }
+
+        if (bench_wake_rx_done)
+        {
+            bench_wake_counts.passed++;
+            bench_stats_add(&check, bench_wake_rx_check);
+            if (bench_wake_rx_match)
+            {
+                bench_wake_counts.woke++;
+                bench_stats_add(&latency, bench_wake_rx_decided - sent);
+            }
+        }
+
+        if (bench_wake_rx_done && bench_wake_rx_match && !entry->wake)
+        {
+            bench_wake_counts.false_wakes++;
+        }
+        else if (entry->wake && !(bench_wake_rx_done && bench_wake_rx_match))
+        {
+            bench_wake_counts.missed++;
+        }
+    }
+
+    bench_wake_channel_init(base, chan, &CANFD_config, context,
+                            app_rx_callback, false);
+
+    bench_report("wake", "tx_to_decision", 8U, &latency);
+    bench_report("wake", "payload_check", 8U, &check);
+}
+
+/*******************************************************************************
+* Function Name: bench_wake_print
+********************************************************************************
+* Summary:
+* Prints the wake-up counts of the last replay. Called after the result
+* block, since the counts are not cycle measurements.
+*
+*******************************************************************************/
+void bench_wake_print(void)
+{
+    const bench_wake_counts_t *counts = &bench_wake_counts;
+
+    printf("WAKE: replayed %lu, filtered by the controller %lu, "
+           "CPU wake-ups %lu\r\n", (unsigned long)counts->frames,
+           (unsigned long)(counts->frames - counts->passed - counts->lost),
+           (unsigned long)counts->passed);
+    printf("WAKE: woke %lu, false wake-ups %lu, missed %lu, lost %lu\r\n\r\n",
+           (unsigned long)counts->woke, (unsigned long)counts->false_wakes,
+           (unsigned long)counts->missed, (unsigned long)counts->lost);
+}
+
+/* [] END OF FILE */
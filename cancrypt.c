@@ -0,0 +1,944 @@
+/******************************************************************************
+* File Name:   cancrypt.c
+*
+* Description: This file contains AES-128 in constant time, the GCM and CTR
+*              modes on it, and the sealing of CAN FD payloads with counter-
+*              based nonces.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "cancrypt.h"
+#include "txfmt.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Longest data of one cancrypt_gcm() or cancrypt_ctr() call: a CAN FD
+ * payload */
+#define CANCRYPT_DATA_MAX       (64U)
+#define CANCRYPT_DATA_BLOCKS    (CANCRYPT_DATA_MAX / CANCRYPT_BLOCK_LEN)
+
+/* Masks of ShiftRows: the bytes of rows 1 to 3 in both lanes */
+#define CANCRYPT_ROW_1          (0x22222222UL)
+#define CANCRYPT_ROW_2          (0x44444444UL)
+#define CANCRYPT_ROW_3          (0x88888888UL)
+
+/* GHASH reduction, x^128 + x^7 + x^2 + x + 1 in the bit order of GCM */
+#define CANCRYPT_GHASH_R        (0xE100000000000000ULL)
+
+/*******************************************************************************
+* Function Name: cancrypt_load
+********************************************************************************
+* Summary:
+* Bitslices up to CANCRYPT_AES_LANES blocks: bit i of byte k of block b goes
+* to bit (16 * b) + k of q[i]. The loops only depend on the block count.
+*
+*******************************************************************************/
+static void cancrypt_load(uint32_t *q, const uint8_t *in, uint32_t bytes)
+{
+    memset(q, 0, 8U * sizeof(q[0]));
+    for (uint32_t lane = 0U; lane < bytes; lane++)
+    {
+        uint32_t byte = in[lane];
+
+        for (uint32_t bit = 0U; bit < 8U; bit++)
+        {
+            q[bit] |= ((byte >> bit) & 1U) << lane;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_store
+********************************************************************************
+* Summary:
+* Turns bitsliced blocks back into bytes.
+*
+*******************************************************************************/
+static void cancrypt_store(uint8_t *out, const uint32_t *q, uint32_t bytes)
+{
+    for (uint32_t lane = 0U; lane < bytes; lane++)
+    {
+        uint32_t byte = 0U;
+
+        for (uint32_t bit = 0U; bit < 8U; bit++)
+        {
+            byte |= ((q[bit] >> lane) & 1U) << bit;
+        }
+        out[lane] = (uint8_t)byte;
+    }
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_sbox
+********************************************************************************
+* Summary:
+* Runs the AES S-box on all 32 lanes at once, with the circuit of Boyar and
+* Peralta: logic operations only, so no table is indexed with secret data.
+*
+*******************************************************************************/
+static void cancrypt_sbox(uint32_t *q)
+{
+    uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+    uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+    uint32_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+    uint32_t y20, y21;
+    uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    uint32_t z10, z11, z12, z13, z14, z15, z16, z17;
+    uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    uint32_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    uint32_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    uint32_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    uint32_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    uint32_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    uint32_t t60, t61, t62, t63, t64, t65, t66, t67;
+    uint32_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    /* Top linear transformation */
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    /* Non-linear section */
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    /* Bottom linear transformation */
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_rotr_rows
+********************************************************************************
+* Summary:
+* Rotates the bits of one row right by shift positions within each 16-bit
+* lane.
+*
+*******************************************************************************/
+static uint32_t cancrypt_rotr_rows(uint32_t x, uint32_t row, uint32_t shift)
+{
+    uint32_t lo = (0xFFFFUL >> shift) * 0x00010001UL;
+    uint32_t hi = ((0xFFFFUL << (16U - shift)) & 0xFFFFUL) * 0x00010001UL;
+
+    x &= row;
+    return (((x >> shift) & lo) | ((x << (16U - shift)) & hi)) & row;
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_shift_rows
+********************************************************************************
+* Summary:
+* ShiftRows: byte k = 4 * column + row takes byte k + 4 * row of its row.
+*
+*******************************************************************************/
+static void cancrypt_shift_rows(uint32_t *q)
+{
+    for (uint32_t bit = 0U; bit < 8U; bit++)
+    {
+        uint32_t x = q[bit];
+
+        q[bit] = (x & ~(CANCRYPT_ROW_1 | CANCRYPT_ROW_2 | CANCRYPT_ROW_3)) |
+                 cancrypt_rotr_rows(x, CANCRYPT_ROW_1, 4U) |
+                 cancrypt_rotr_rows(x, CANCRYPT_ROW_2, 8U) |
+                 cancrypt_rotr_rows(x, CANCRYPT_ROW_3, 12U);
+    }
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_rot_column
+********************************************************************************
+* Summary:
+* Moves each byte of a column to the row n above it, so that row r holds
+* the byte of row r + n.
+*
+*******************************************************************************/
+static uint32_t cancrypt_rot_column(uint32_t x, uint32_t n)
+{
+    uint32_t keep = (0xFU >> n) * 0x11111111UL;
+
+    return ((x >> n) & keep) | ((x << (4U - n)) & ~keep);
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_mix_columns
+********************************************************************************
+* Summary:
+* MixColumns, out_r = 2 * (a_r ^ a_r+1) ^ a_r+1 ^ a_r+2 ^ a_r+3, with the
+* multiplication by 2 done across the bit planes.
+*
+*******************************************************************************/
+static void cancrypt_mix_columns(uint32_t *q)
+{
+    uint32_t t[8];
+    uint32_t s[8];
+
+    for (uint32_t bit = 0U; bit < 8U; bit++)
+    {
+        uint32_t r1 = cancrypt_rot_column(q[bit], 1U);
+
+        t[bit] = q[bit] ^ r1;
+        s[bit] = r1 ^ cancrypt_rot_column(q[bit], 2U) ^
+                 cancrypt_rot_column(q[bit], 3U);
+    }
+
+    q[0] = t[7] ^ s[0];
+    q[1] = t[0] ^ t[7] ^ s[1];
+    q[2] = t[1] ^ s[2];
+    q[3] = t[2] ^ t[7] ^ s[3];
+    q[4] = t[3] ^ t[7] ^ s[4];
+    q[5] = t[4] ^ s[5];
+    q[6] = t[5] ^ s[6];
+    q[7] = t[6] ^ s[7];
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_sub_word
+********************************************************************************
+* Summary:
+* Runs the S-box on the bytes of a key schedule word.
+*
+*******************************************************************************/
+static void cancrypt_sub_word(uint8_t *word)
+{
+    uint32_t q[8];
+
+    cancrypt_load(q, word, 4U);
+    cancrypt_sbox(q);
+    cancrypt_store(word, q, 4U);
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_aes_init
+********************************************************************************
+* Summary:
+* Expands an AES-128 key into bitsliced round keys.
+*
+* Parameters:
+*  aes          Round keys
+*  key          CANCRYPT_KEY_LEN bytes
+*
+*******************************************************************************/
+void cancrypt_aes_init(cancrypt_aes_t *aes, const uint8_t *key)
+{
+    uint8_t w[11U * CANCRYPT_BLOCK_LEN];
+    uint8_t rcon = 0x01U;
+
+    memcpy(w, key, CANCRYPT_KEY_LEN);
+    for (uint32_t idx = CANCRYPT_KEY_LEN; idx < sizeof(w); idx += 4U)
+    {
+        uint8_t temp[4];
+
+        memcpy(temp, &w[idx - 4U], sizeof(temp));
+        if (0U == (idx % CANCRYPT_KEY_LEN))
+        {
+            uint8_t first = temp[0];
+
+            temp[0] = temp[1];
+            temp[1] = temp[2];
+            temp[2] = temp[3];
+            temp[3] = first;
+            cancrypt_sub_word(temp);
+            temp[0] ^= rcon;
+            rcon = (uint8_t)((rcon << 1U) ^ ((rcon >> 7U) * 0x1BU));
+        }
+        for (uint32_t byte = 0U; byte < 4U; byte++)
+        {
+            w[idx + byte] = w[idx + byte - CANCRYPT_KEY_LEN] ^ temp[byte];
+        }
+    }
+
+    for (uint32_t round = 0U; round < 11U; round++)
+    {
+        uint32_t q[8];
+
+        cancrypt_load(q, &w[round * CANCRYPT_BLOCK_LEN], CANCRYPT_BLOCK_LEN);
+        for (uint32_t bit = 0U; bit < 8U; bit++)
+        {
+            aes->rk[round][bit] = q[bit] * 0x00010001UL;
+        }
+    }
+    memset(w, 0, sizeof(w));
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_aes_ecb
+********************************************************************************
+* Summary:
+* Encrypts blocks with AES-128, CANCRYPT_AES_LANES at a time. The time does
+* not depend on the key or the data. It matches cancrypt_ecb_fn_t, with
+* the round keys as ctx.
+*
+* Parameters:
+*  ctx          Round keys, cancrypt_aes_t
+*  out          Encrypted blocks; may be in
+*  in           Blocks
+*  blocks       Number of blocks
+*
+*******************************************************************************/
+void cancrypt_aes_ecb(void *ctx, uint8_t *out, const uint8_t *in,
+                      uint32_t blocks)
+{
+    const cancrypt_aes_t *aes = (const cancrypt_aes_t *)ctx;
+
+    while (0U != blocks)
+    {
+        uint32_t lanes = (blocks < CANCRYPT_AES_LANES) ? blocks :
+                         CANCRYPT_AES_LANES;
+        uint32_t bytes = lanes * CANCRYPT_BLOCK_LEN;
+        uint32_t q[8];
+
+        cancrypt_load(q, in, bytes);
+        for (uint32_t round = 0U; round < 10U; round++)
+        {
+            for (uint32_t bit = 0U; bit < 8U; bit++)
+            {
+                q[bit] ^= aes->rk[round][bit];
+            }
+            cancrypt_sbox(q);
+            cancrypt_shift_rows(q);
+            if (round < 9U)
+            {
+                cancrypt_mix_columns(q);
+            }
+        }
+        for (uint32_t bit = 0U; bit < 8U; bit++)
+        {
+            q[bit] ^= aes->rk[10][bit];
+        }
+        cancrypt_store(out, q, bytes);
+
+        in += bytes;
+        out += bytes;
+        blocks -= lanes;
+    }
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_get_u64
+********************************************************************************
+* Summary:
+* Reads a 64-bit value, big endian.
+*
+*******************************************************************************/
+static uint64_t cancrypt_get_u64(const uint8_t *data)
+{
+    uint64_t value = 0U;
+
+    for (uint32_t idx = 0U; idx < 8U; idx++)
+    {
+        value = (value << 8U) | data[idx];
+    }
+    return value;
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_put_u64
+********************************************************************************
+* Summary:
+* Writes a 64-bit value, big endian.
+*
+*******************************************************************************/
+static void cancrypt_put_u64(uint8_t *data, uint64_t value)
+{
+    for (uint32_t idx = 0U; idx < 8U; idx++)
+    {
+        data[7U - idx] = (uint8_t)value;
+        value >>= 8U;
+    }
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_put_u32
+********************************************************************************
+* Summary:
+* Writes a 32-bit value, big endian.
+*
+*******************************************************************************/
+static void cancrypt_put_u32(uint8_t *data, uint32_t value)
+{
+    data[0] = (uint8_t)(value >> 24U);
+    data[1] = (uint8_t)(value >> 16U);
+    data[2] = (uint8_t)(value >> 8U);
+    data[3] = (uint8_t)value;
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_ghash_block
+********************************************************************************
+* Summary:
+* GHASH step, y = (y ^ block) * H, bit by bit with masks instead of branches
+* or tables, so that its time does not depend on H or the data.
+*
+*******************************************************************************/
+static void cancrypt_ghash_block(const cancrypt_key_t *key, uint64_t *y,
+                                 const uint8_t *block)
+{
+    uint64_t x_hi = y[0] ^ cancrypt_get_u64(block);
+    uint64_t x_lo = y[1] ^ cancrypt_get_u64(&block[8]);
+    uint64_t v_hi = key->h[0];
+    uint64_t v_lo = key->h[1];
+    uint64_t z_hi = 0U;
+    uint64_t z_lo = 0U;
+
+    for (uint32_t idx = 0U; idx < 128U; idx++)
+    {
+        uint64_t bit = (idx < 64U) ? (x_hi >> (63U - idx)) :
+                       (x_lo >> (127U - idx));
+        uint64_t mask = (uint64_t)0U - (bit & 1U);
+        uint64_t carry = (uint64_t)0U - (v_lo & 1U);
+
+        z_hi ^= v_hi & mask;
+        z_lo ^= v_lo & mask;
+        v_lo = (v_lo >> 1U) | (v_hi << 63U);
+        v_hi = (v_hi >> 1U) ^ (CANCRYPT_GHASH_R & carry);
+    }
+
+    y[0] = z_hi;
+    y[1] = z_lo;
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_ghash
+********************************************************************************
+* Summary:
+* Adds data to a GHASH, padded with zeros to whole blocks.
+*
+*******************************************************************************/
+static void cancrypt_ghash(const cancrypt_key_t *key, uint64_t *y,
+                           const uint8_t *data, uint32_t len)
+{
+    while (0U != len)
+    {
+        uint8_t block[CANCRYPT_BLOCK_LEN] = { 0U };
+        uint32_t part = (len < CANCRYPT_BLOCK_LEN) ? len : CANCRYPT_BLOCK_LEN;
+
+        memcpy(block, data, part);
+        cancrypt_ghash_block(key, y, block);
+        data += part;
+        len -= part;
+    }
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_key_init
+********************************************************************************
+* Summary:
+* Sets up the key of an ID on a block cipher: software round keys with
+* cancrypt_aes_ecb(), or a hardware context. Derives the GHASH key.
+*
+* Parameters:
+*  key          Key
+*  ecb          Block cipher
+*  ctx          Its key context
+*
+*******************************************************************************/
+void cancrypt_key_init(cancrypt_key_t *key, cancrypt_ecb_fn_t ecb,
+                       void *ctx)
+{
+    uint8_t h[CANCRYPT_BLOCK_LEN] = { 0U };
+
+    key->ecb = ecb;
+    key->ctx = ctx;
+    ecb(ctx, h, h, 1U);
+    key->h[0] = cancrypt_get_u64(h);
+    key->h[1] = cancrypt_get_u64(&h[8]);
+    memset(h, 0, sizeof(h));
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_keystream
+********************************************************************************
+* Summary:
+* Encrypts the counter blocks iv || 1, iv || 2, ... for len bytes of data
+* and the block iv || 1 of the tag, all in one call to the block cipher.
+*
+*******************************************************************************/
+static void cancrypt_keystream(const cancrypt_key_t *key, const uint8_t *iv,
+                               uint8_t *stream, uint32_t len)
+{
+    uint32_t blocks = 1U + ((len + CANCRYPT_BLOCK_LEN - 1U) /
+                            CANCRYPT_BLOCK_LEN);
+
+    for (uint32_t idx = 0U; idx < blocks; idx++)
+    {
+        uint8_t *block = &stream[idx * CANCRYPT_BLOCK_LEN];
+
+        memcpy(block, iv, CANCRYPT_IV_LEN);
+        cancrypt_put_u32(&block[CANCRYPT_IV_LEN], idx + 1U);
+    }
+    key->ecb(key->ctx, stream, stream, blocks);
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_gcm
+********************************************************************************
+* Summary:
+* AES-GCM with a 96-bit IV, on at most CANCRYPT_DATA_MAX bytes, in place.
+*
+* Parameters:
+*  key          Key
+*  encrypt      true to encrypt, false to decrypt
+*  iv           CANCRYPT_IV_LEN bytes
+*  aad          Authenticated data
+*  aad_len      Its length
+*  data         Data, replaced by its encryption or decryption
+*  len          Its length
+*  tag          Set to the CANCRYPT_BLOCK_LEN bytes of the tag
+*
+*******************************************************************************/
+void cancrypt_gcm(const cancrypt_key_t *key, bool encrypt, const uint8_t *iv,
+                  const uint8_t *aad, uint32_t aad_len, uint8_t *data,
+                  uint32_t len, uint8_t *tag)
+{
+    uint8_t stream[(CANCRYPT_DATA_BLOCKS + 1U) * CANCRYPT_BLOCK_LEN];
+    uint8_t lengths[CANCRYPT_BLOCK_LEN];
+    uint64_t y[2] = { 0U, 0U };
+
+    cancrypt_keystream(key, iv, stream, len);
+    cancrypt_ghash(key, y, aad, aad_len);
+    if (!encrypt)
+    {
+        cancrypt_ghash(key, y, data, len);
+    }
+    for (uint32_t idx = 0U; idx < len; idx++)
+    {
+        data[idx] ^= stream[CANCRYPT_BLOCK_LEN + idx];
+    }
+    if (encrypt)
+    {
+        cancrypt_ghash(key, y, data, len);
+    }
+
+    cancrypt_put_u64(lengths, (uint64_t)aad_len * 8U);
+    cancrypt_put_u64(&lengths[8], (uint64_t)len * 8U);
+    cancrypt_ghash_block(key, y, lengths);
+    cancrypt_put_u64(tag, y[0]);
+    cancrypt_put_u64(&tag[8], y[1]);
+    for (uint32_t idx = 0U; idx < CANCRYPT_BLOCK_LEN; idx++)
+    {
+        tag[idx] ^= stream[idx];
+    }
+    memset(stream, 0, sizeof(stream));
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_ctr
+********************************************************************************
+* Summary:
+* AES-CTR on at most CANCRYPT_DATA_MAX bytes, in place, with the counter
+* blocks of GCM so that both modes share one nonce layout.
+*
+*******************************************************************************/
+void cancrypt_ctr(const cancrypt_key_t *key, const uint8_t *iv,
+                  uint8_t *data, uint32_t len)
+{
+    uint8_t stream[(CANCRYPT_DATA_BLOCKS + 1U) * CANCRYPT_BLOCK_LEN];
+
+    cancrypt_keystream(key, iv, stream, len);
+    for (uint32_t idx = 0U; idx < len; idx++)
+    {
+        data[idx] ^= stream[CANCRYPT_BLOCK_LEN + idx];
+    }
+    memset(stream, 0, sizeof(stream));
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_equal
+********************************************************************************
+* Summary:
+* Compares two byte strings in a time that does not depend on where they
+* differ.
+*
+*******************************************************************************/
+bool cancrypt_equal(const uint8_t *a, const uint8_t *b, uint32_t len)
+{
+    uint32_t diff = 0U;
+
+    for (uint32_t idx = 0U; idx < len; idx++)
+    {
+        diff |= (uint32_t)a[idx] ^ b[idx];
+    }
+    return (0U == diff);
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_sealed_len
+********************************************************************************
+* Summary:
+* Returns the payload length of a sealed frame for a payload of len bytes,
+* or 0 if it does not fit a CAN FD frame.
+*
+*******************************************************************************/
+uint8_t cancrypt_sealed_len(cancrypt_mode_t mode, uint8_t len)
+{
+    uint32_t sealed = CANCRYPT_HEADER_LEN + (uint32_t)len +
+                      ((CANCRYPT_MODE_GCM == mode) ? CANCRYPT_TAG_LEN : 0U);
+
+    if (sealed > CANCRYPT_DATA_MAX)
+    {
+        return 0U;
+    }
+    return txfmt_fd_len((uint8_t)sealed);
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_iv
+********************************************************************************
+* Summary:
+* Builds the nonce of a frame.
+*
+*******************************************************************************/
+static void cancrypt_iv(uint8_t *iv, uint32_t id, uint32_t epoch,
+                        uint32_t counter)
+{
+    cancrypt_put_u32(iv, id);
+    cancrypt_put_u32(&iv[4], epoch);
+    cancrypt_put_u32(&iv[8], counter);
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_seal
+********************************************************************************
+* Summary:
+* Encrypts a payload in place into a sealed payload. The CAN ID is part of
+* the nonce and, with GCM, of the authenticated data, so a frame replayed
+* under another ID does not open.
+*
+* Parameters:
+*  key          Key of the ID
+*  mode         CTR or GCM
+*  id           CAN ID, with bit 31 set for a 29-bit ID
+*  epoch        Epoch of the sender
+*  counter      Frame counter of the ID
+*  data         Payload, CANCRYPT_DATA_MAX bytes of room
+*  len          Its length
+*
+* Return:
+*  Length of the sealed payload, 0 if it does not fit
+*
+*******************************************************************************/
+uint8_t cancrypt_seal(const cancrypt_key_t *key, cancrypt_mode_t mode,
+                      uint32_t id, uint32_t epoch, uint32_t counter,
+                      uint8_t *data, uint8_t len)
+{
+    uint8_t sealed = cancrypt_sealed_len(mode, len);
+    uint32_t tag_len = (CANCRYPT_MODE_GCM == mode) ? CANCRYPT_TAG_LEN : 0U;
+    uint32_t text_len;
+    uint8_t iv[CANCRYPT_IV_LEN];
+    uint8_t tag[CANCRYPT_BLOCK_LEN];
+
+    if (0U == sealed)
+    {
+        return 0U;
+    }
+
+    text_len = sealed - CANCRYPT_HEADER_LEN - tag_len;
+    memmove(&data[CANCRYPT_HEADER_LEN], data, len);
+    memset(&data[CANCRYPT_HEADER_LEN + len], 0, text_len - len);
+    data[0] = (uint8_t)epoch;
+    data[1] = (uint8_t)(epoch >> 8U);
+    data[2] = (uint8_t)(epoch >> 16U);
+    data[3] = (uint8_t)(epoch >> 24U);
+    data[4] = (uint8_t)counter;
+    data[5] = (uint8_t)(counter >> 8U);
+    data[6] = (uint8_t)(counter >> 16U);
+    data[7] = (uint8_t)(counter >> 24U);
+
+    cancrypt_iv(iv, id, epoch, counter);
+    if (CANCRYPT_MODE_GCM == mode)
+    {
+        cancrypt_gcm(key, true, iv, iv, 4U, &data[CANCRYPT_HEADER_LEN],
+                     text_len, tag);
+        memcpy(&data[CANCRYPT_HEADER_LEN + text_len], tag, CANCRYPT_TAG_LEN);
+    }
+    else
+    {
+        cancrypt_ctr(key, iv, &data[CANCRYPT_HEADER_LEN], text_len);
+    }
+    return sealed;
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_open
+********************************************************************************
+* Summary:
+* Checks and decrypts a sealed payload in place. The payload moves to the
+* start of data; a payload that fails authentication is cleared.
+*
+* Parameters:
+*  key          Key of the ID
+*  mode         CTR or GCM
+*  id           CAN ID, with bit 31 set for a 29-bit ID
+*  data         Sealed payload
+*  len          Its length
+*  epoch        Set to the epoch of the sender
+*  counter      Set to the frame counter
+*
+* Return:
+*  Length of the payload, padding included; -1 if the payload is too short
+*  or fails authentication
+*
+*******************************************************************************/
+int32_t cancrypt_open(const cancrypt_key_t *key, cancrypt_mode_t mode,
+                      uint32_t id, uint8_t *data, uint8_t len,
+                      uint32_t *epoch, uint32_t *counter)
+{
+    uint32_t tag_len = (CANCRYPT_MODE_GCM == mode) ? CANCRYPT_TAG_LEN : 0U;
+    uint32_t text_len;
+    uint8_t iv[CANCRYPT_IV_LEN];
+    uint8_t tag[CANCRYPT_BLOCK_LEN];
+
+    if ((len > CANCRYPT_DATA_MAX) ||
+        (len < (CANCRYPT_HEADER_LEN + tag_len)))
+    {
+        return -1;
+    }
+
+    text_len = len - CANCRYPT_HEADER_LEN - tag_len;
+    *epoch = (uint32_t)data[0] | ((uint32_t)data[1] << 8U) |
+             ((uint32_t)data[2] << 16U) | ((uint32_t)data[3] << 24U);
+    *counter = (uint32_t)data[4] | ((uint32_t)data[5] << 8U) |
+               ((uint32_t)data[6] << 16U) | ((uint32_t)data[7] << 24U);
+
+    cancrypt_iv(iv, id, *epoch, *counter);
+    if (CANCRYPT_MODE_GCM == mode)
+    {
+        cancrypt_gcm(key, false, iv, iv, 4U, &data[CANCRYPT_HEADER_LEN],
+                     text_len, tag);
+        if (!cancrypt_equal(tag, &data[CANCRYPT_HEADER_LEN + text_len],
+                            CANCRYPT_TAG_LEN))
+        {
+            memset(data, 0, len);
+            return -1;
+        }
+    }
+    else
+    {
+        cancrypt_ctr(key, iv, &data[CANCRYPT_HEADER_LEN], text_len);
+    }
+
+    memmove(data, &data[CANCRYPT_HEADER_LEN], text_len);
+    memset(&data[text_len], 0, len - text_len);
+    return (int32_t)text_len;
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_rx_check
+********************************************************************************
+* Summary:
+* Checks the epoch and counter of an opened frame against the last frame
+* taken from its ID, and takes the frame if it is newer. Epochs count the
+* start-ups of the sender, so a frame of an older epoch is a replay, as is
+* one whose counter is not above the last of the same epoch. The first
+* frame of an ID is taken whatever its epoch. CTR frames are taken unchecked
+* and leave rx as it is: their epoch and counter are not authenticated, and
+* a forged frame with the largest epoch would otherwise block the sender.
+*
+* Parameters:
+*  rx           Last frame taken from the ID
+*  mode         Mode of the ID
+*  epoch        Epoch of the frame
+*  counter      Counter of the frame
+*
+* Return:
+*  CANCRYPT_RX_REPLAY if the frame must be dropped
+*
+*******************************************************************************/
+cancrypt_rx_result_t cancrypt_rx_check(cancrypt_rx_t *rx,
+                                       cancrypt_mode_t mode, uint32_t epoch,
+                                       uint32_t counter)
+{
+    cancrypt_rx_result_t result = CANCRYPT_RX_NEXT;
+
+    if (CANCRYPT_MODE_GCM != mode)
+    {
+        return result;
+    }
+    if (rx->valid)
+    {
+        if ((epoch < rx->epoch) ||
+            ((epoch == rx->epoch) && (counter <= rx->counter)))
+        {
+            return CANCRYPT_RX_REPLAY;
+        }
+        if (epoch != rx->epoch)
+        {
+            result = CANCRYPT_RX_RESTART;
+        }
+    }
+
+    rx->epoch = epoch;
+    rx->counter = counter;
+    rx->valid = true;
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,161 @@
+/******************************************************************************
+* File Name:   cancrypt.h
+*
+* Description: This file contains AES-128 in constant time, the GCM and CTR
+*              modes on it, and the sealing of CAN FD payloads with counter-
+*              based nonces.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef CANCRYPT_H_
+#define CANCRYPT_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* Only the C library, so that host/ can build the check */
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make CANCRYPT_ENABLE=1") to encrypt the
+ * payloads of the IDs of CANCRYPT_CAN_ID_LIST */
+#ifndef CANCRYPT_ENABLE
+#define CANCRYPT_ENABLE         (0)
+#endif
+
+#define CANCRYPT_KEY_LEN        (16U)
+#define CANCRYPT_BLOCK_LEN      (16U)
+#define CANCRYPT_IV_LEN         (12U)
+
+/* Sealed payload, little endian:
+ *   0  epoch       counts the start-ups of the sender (32 bits)
+ *   4  counter     counts up per frame of the ID (32 bits)
+ *   8  ciphertext  the payload, padded with zeros to a CAN FD length
+ *   .. tag         GCM only: the first CANCRYPT_TAG_LEN bytes of the tag
+ * The nonce is the CAN ID, the epoch and the counter, big endian, so it
+ * never repeats for a key as long as a sender never reuses an epoch. With
+ * CTR nothing authenticates the epoch and counter, so a receiver cannot
+ * trust them: CTR IDs have no replay protection. */
+#define CANCRYPT_HEADER_LEN     (8U)
+#define CANCRYPT_TAG_LEN        (8U)
+
+/* Blocks cancrypt_aes_ecb() encrypts per pass of the bitsliced rounds */
+#define CANCRYPT_AES_LANES      (2U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef enum
+{
+    CANCRYPT_MODE_CTR,              /* Confidentiality only, no replay check */
+    CANCRYPT_MODE_GCM               /* Confidentiality and authenticity */
+} cancrypt_mode_t;
+
+/* AES-128 round keys, bitsliced: word i of a round key holds bit i of its
+ * 16 bytes, twice, for the two blocks of a pass */
+typedef struct
+{
+    uint32_t rk[11][8];
+} cancrypt_aes_t;
+
+/* Encrypts blocks with the key of ctx, in ECB mode */
+typedef void (*cancrypt_ecb_fn_t)(void *ctx, uint8_t *out, const uint8_t *in,
+                                  uint32_t blocks);
+
+/* Key of an ID: the block cipher that holds it, and the GHASH key */
+typedef struct
+{
+    cancrypt_ecb_fn_t ecb;
+    void             *ctx;
+    uint64_t          h[2];
+} cancrypt_key_t;
+
+/* Last frame taken from an ID */
+typedef struct
+{
+    uint32_t epoch;
+    uint32_t counter;
+    bool     valid;
+} cancrypt_rx_t;
+
+typedef enum
+{
+    CANCRYPT_RX_NEXT,               /* Later counter of the same epoch */
+    CANCRYPT_RX_RESTART,            /* Newer epoch: the sender restarted */
+    CANCRYPT_RX_REPLAY              /* Older epoch, or counter not above */
+} cancrypt_rx_result_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void cancrypt_aes_init(cancrypt_aes_t *aes, const uint8_t *key);
+void cancrypt_aes_ecb(void *ctx, uint8_t *out, const uint8_t *in,
+                      uint32_t blocks);
+void cancrypt_key_init(cancrypt_key_t *key, cancrypt_ecb_fn_t ecb,
+                       void *ctx);
+void cancrypt_gcm(const cancrypt_key_t *key, bool encrypt, const uint8_t *iv,
+                  const uint8_t *aad, uint32_t aad_len, uint8_t *data,
+                  uint32_t len, uint8_t *tag);
+void cancrypt_ctr(const cancrypt_key_t *key, const uint8_t *iv,
+                  uint8_t *data, uint32_t len);
+bool cancrypt_equal(const uint8_t *a, const uint8_t *b, uint32_t len);
+uint8_t cancrypt_sealed_len(cancrypt_mode_t mode, uint8_t len);
+uint8_t cancrypt_seal(const cancrypt_key_t *key, cancrypt_mode_t mode,
+                      uint32_t id, uint32_t epoch, uint32_t counter,
+                      uint8_t *data, uint8_t len);
+int32_t cancrypt_open(const cancrypt_key_t *key, cancrypt_mode_t mode,
+                      uint32_t id, uint8_t *data, uint8_t len,
+                      uint32_t *epoch, uint32_t *counter);
+cancrypt_rx_result_t cancrypt_rx_check(cancrypt_rx_t *rx,
+                                       cancrypt_mode_t mode, uint32_t epoch,
+                                       uint32_t counter);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CANCRYPT_H_ */
+
+/* [] END OF FILE */
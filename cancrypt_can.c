@@ -0,0 +1,520 @@
+/******************************************************************************
+* File Name:   cancrypt_can.c
+*
+* Description: This file contains the encryption of the payloads of listed
+*              IDs, on Cryptolite or in software, with per-frame cycle counts.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "cancrypt_can.h"
+#include "cycle_counter.h"
+#include "stats.h"
+
+#if (CANCRYPT_ENABLE)
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t         id;
+    cancrypt_mode_t  mode;
+    uint32_t         key;
+} cancrypt_can_entry_t;
+
+/* Per ID: the counter this node sends with, and the last frame received */
+typedef struct
+{
+    uint32_t         tx_counter;
+    cancrypt_rx_t    rx;
+} cancrypt_can_state_t;
+
+typedef struct
+{
+    uint32_t frames;
+    uint64_t cycles;
+    uint32_t cycles_max;
+} cancrypt_can_timing_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+#define CANCRYPT_CAN_ID_ENTRY(name, id, mode, key)  { (id), (mode), (key) },
+static const cancrypt_can_entry_t cancrypt_can_ids[CANCRYPT_CAN_ID_COUNT] =
+{
+    CANCRYPT_CAN_ID_LIST(CANCRYPT_CAN_ID_ENTRY)
+};
+#undef CANCRYPT_CAN_ID_ENTRY
+
+static const uint8_t cancrypt_can_raw_keys[CANCRYPT_CAN_KEY_COUNT]
+                                          [CANCRYPT_KEY_LEN] =
+    CANCRYPT_CAN_KEYS;
+
+#if (CANCRYPT_CAN_HW)
+static cy_stc_cryptolite_aes_state_t
+    cancrypt_can_hw_state[CANCRYPT_CAN_KEY_COUNT];
+CY_ALIGN(4) static cy_stc_cryptolite_aes_buffers_t
+    cancrypt_can_hw_buffers[CANCRYPT_CAN_KEY_COUNT];
+#else
+static cancrypt_aes_t          cancrypt_can_aes[CANCRYPT_CAN_KEY_COUNT];
+#endif /* CANCRYPT_CAN_HW */
+
+#if (CANCRYPT_CAN_EPOCH_FLASH)
+/* Contents of the epoch row to program: the epoch and its complement */
+static uint32_t
+    cancrypt_can_epoch_data[CY_FLASH_SIZEOF_ROW / sizeof(uint32_t)];
+#endif /* CANCRYPT_CAN_EPOCH_FLASH */
+
+static cancrypt_key_t          cancrypt_can_keys[CANCRYPT_CAN_KEY_COUNT];
+static cancrypt_can_state_t    cancrypt_can_states[CANCRYPT_CAN_ID_COUNT];
+static uint32_t                cancrypt_can_epoch;
+static bool                    cancrypt_can_epoch_valid;
+static bool                    cancrypt_can_ready;
+
+/* Statistics */
+static cancrypt_can_timing_t   cancrypt_can_seal_timing;
+static cancrypt_can_timing_t   cancrypt_can_open_timing;
+static uint32_t                cancrypt_can_too_long;
+static uint32_t                cancrypt_can_no_epoch;
+static uint32_t                cancrypt_can_auth_failed;
+static uint32_t                cancrypt_can_replayed;
+static uint32_t                cancrypt_can_restarts;
+
+/*******************************************************************************
+* Function Name: cancrypt_can_next_epoch
+********************************************************************************
+* Summary:
+* Programs the epoch after the last one in flash and takes it, so that no
+* two start-ups, and no two wraps of the counters, send with the same epoch.
+* A random epoch would not do: the receivers only take epochs above the
+* last one. The two rows take turns, and the row with the last epoch is
+* never erased: a reset during programming only loses the new epoch, which
+* was not used yet. A row whose complement does not match holds no epoch,
+* and a part whose rows hold none starts at epoch 1. Without the rows, or
+* when a row cannot be programmed, this node has no epoch and the listed
+* IDs are not sent.
+*
+* Return:
+*  true if the node has a new epoch
+*
+*******************************************************************************/
+static bool cancrypt_can_next_epoch(void)
+{
+    cancrypt_can_epoch_valid = false;
+
+#if (CANCRYPT_CAN_EPOCH_FLASH)
+    uint32_t last = 0U;
+    uint32_t addr = CANCRYPT_CAN_EPOCH_ADDR;
+    const volatile uint32_t *row;
+    uint32_t epoch;
+
+    for (uint32_t idx = 0U; idx < 2U; idx++)
+    {
+        uint32_t row_addr = CANCRYPT_CAN_EPOCH_ADDR +
+                            (idx * CY_FLASH_SIZEOF_ROW);
+
+        row = (const volatile uint32_t *)(uintptr_t)row_addr;
+        if ((row[1] == ~row[0]) && (row[0] > last))
+        {
+            /* Program the other row */
+            last = row[0];
+            addr = CANCRYPT_CAN_EPOCH_ADDR +
+                   ((idx ^ 1U) * CY_FLASH_SIZEOF_ROW);
+        }
+    }
+    if (UINT32_MAX == last)
+    {
+        return false;
+    }
+
+    epoch = last + 1U;
+    memset(cancrypt_can_epoch_data, 0, sizeof(cancrypt_can_epoch_data));
+    cancrypt_can_epoch_data[0] = epoch;
+    cancrypt_can_epoch_data[1] = ~epoch;
+    row = (const volatile uint32_t *)(uintptr_t)addr;
+    if ((CY_FLASH_DRV_SUCCESS !=
+         Cy_Flash_WriteRow(addr, cancrypt_can_epoch_data)) ||
+        (row[0] != epoch) || (row[1] != ~epoch))
+    {
+        return false;
+    }
+
+    cancrypt_can_epoch = epoch;
+    cancrypt_can_epoch_valid = true;
+#endif /* CANCRYPT_CAN_EPOCH_FLASH */
+
+    return cancrypt_can_epoch_valid;
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_can_find
+********************************************************************************
+* Summary:
+* Returns the entry of a frame in CANCRYPT_CAN_ID_LIST, or
+* CANCRYPT_CAN_ID_COUNT.
+*
+*******************************************************************************/
+static uint32_t cancrypt_can_find(const canfd_frame_t *frame)
+{
+    uint32_t idx;
+
+    if (0U != (frame->flags & (CANFD_FRAME_FLAG_XTD | CANFD_FRAME_FLAG_RTR)))
+    {
+        return CANCRYPT_CAN_ID_COUNT;
+    }
+    for (idx = 0U; idx < CANCRYPT_CAN_ID_COUNT; idx++)
+    {
+        if (cancrypt_can_ids[idx].id == frame->id)
+        {
+            break;
+        }
+    }
+    return idx;
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_can_time
+********************************************************************************
+* Summary:
+* Adds the cycles of one frame to a timing.
+*
+*******************************************************************************/
+static void cancrypt_can_time(cancrypt_can_timing_t *timing, uint32_t start)
+{
+    uint32_t cycles = cycle_counter_get() - start;
+
+    timing->frames++;
+    timing->cycles += cycles;
+    timing->cycles_max = (cycles > timing->cycles_max) ? cycles :
+                         timing->cycles_max;
+}
+#endif /* CANCRYPT_ENABLE */
+
+#if (CANCRYPT_CAN_HW)
+/*******************************************************************************
+* Function Name: cancrypt_can_hw_ecb
+********************************************************************************
+* Summary:
+* Encrypts blocks on Cryptolite, one at a time. Matches cancrypt_ecb_fn_t,
+* with the state Cy_Cryptolite_Aes_Init() loaded the key into as ctx.
+*
+*******************************************************************************/
+void cancrypt_can_hw_ecb(void *ctx, uint8_t *out, const uint8_t *in,
+                         uint32_t blocks)
+{
+    for (uint32_t idx = 0U; idx < blocks; idx++)
+    {
+        uint8_t block[CANCRYPT_BLOCK_LEN];
+
+        memcpy(block, &in[idx * CANCRYPT_BLOCK_LEN], sizeof(block));
+        (void)Cy_Cryptolite_Aes_Ecb(CRYPTOLITE, &out[idx * CANCRYPT_BLOCK_LEN],
+                                    block,
+                                    (cy_stc_cryptolite_aes_state_t *)ctx);
+    }
+}
+#endif /* CANCRYPT_CAN_HW */
+
+/*******************************************************************************
+* Function Name: cancrypt_can_init
+********************************************************************************
+* Summary:
+* Loads the keys into Cryptolite, or expands them for the software AES, and
+* takes the epoch of this start-up.
+*
+*******************************************************************************/
+void cancrypt_can_init(void)
+{
+#if (CANCRYPT_ENABLE)
+    for (uint32_t idx = 0U; idx < CANCRYPT_CAN_KEY_COUNT; idx++)
+    {
+#if (CANCRYPT_CAN_HW)
+        (void)Cy_Cryptolite_Aes_Init(CRYPTOLITE, cancrypt_can_raw_keys[idx],
+                                     &cancrypt_can_hw_state[idx],
+                                     &cancrypt_can_hw_buffers[idx]);
+        cancrypt_key_init(&cancrypt_can_keys[idx], cancrypt_can_hw_ecb,
+                          &cancrypt_can_hw_state[idx]);
+#else
+        cancrypt_aes_init(&cancrypt_can_aes[idx], cancrypt_can_raw_keys[idx]);
+        cancrypt_key_init(&cancrypt_can_keys[idx], cancrypt_aes_ecb,
+                          &cancrypt_can_aes[idx]);
+#endif /* CANCRYPT_CAN_HW */
+    }
+    (void)cancrypt_can_next_epoch();
+    cancrypt_can_ready = true;
+#endif /* CANCRYPT_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_can_protected
+********************************************************************************
+* Summary:
+* Tells whether the payload of a frame is encrypted, that is whether the
+* frame must go through cancrypt_can_seal().
+*
+*******************************************************************************/
+bool cancrypt_can_protected(const canfd_frame_t *frame)
+{
+#if (CANCRYPT_ENABLE)
+    return (cancrypt_can_find(frame) < CANCRYPT_CAN_ID_COUNT);
+#else
+    CY_UNUSED_PARAMETER(frame);
+    return false;
+#endif /* CANCRYPT_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_can_seal
+********************************************************************************
+* Summary:
+* Encrypts the payload of a frame of CANCRYPT_CAN_ID_LIST in place, with the
+* next counter of its ID, and sets the CAN FD format if the sealed payload
+* needs it. Other frames are left as they are.
+*
+* Parameters:
+*  frame        Frame to send
+*
+* Return:
+*  false if the payload is too long to be sealed in a CAN FD frame, or if
+*  this node has no epoch; the frame must then not be sent
+*
+*******************************************************************************/
+bool cancrypt_can_seal(canfd_frame_t *frame)
+{
+#if (CANCRYPT_ENABLE)
+    uint32_t entry = cancrypt_can_find(frame);
+    const cancrypt_can_entry_t *info;
+    cancrypt_can_state_t *state;
+    uint32_t start;
+    uint8_t len;
+
+    if (CANCRYPT_CAN_ID_COUNT <= entry)
+    {
+        return true;
+    }
+
+    info = &cancrypt_can_ids[entry];
+    state = &cancrypt_can_states[entry];
+    if (!cancrypt_can_epoch_valid)
+    {
+        cancrypt_can_no_epoch++;
+        STATS_INC(CANCRYPT_UNSENT);
+        return false;
+    }
+    if (0U == cancrypt_sealed_len(info->mode, frame->len))
+    {
+        cancrypt_can_too_long++;
+        return false;
+    }
+
+    /* A counter that wraps would repeat nonces, so start a new epoch */
+    if (UINT32_MAX == state->tx_counter)
+    {
+        if (!cancrypt_can_next_epoch())
+        {
+            cancrypt_can_no_epoch++;
+            STATS_INC(CANCRYPT_UNSENT);
+            return false;
+        }
+        for (uint32_t idx = 0U; idx < CANCRYPT_CAN_ID_COUNT; idx++)
+        {
+            cancrypt_can_states[idx].tx_counter = 0U;
+        }
+    }
+
+    start = cycle_counter_get();
+    len = cancrypt_seal(&cancrypt_can_keys[info->key], info->mode, frame->id,
+                        cancrypt_can_epoch, state->tx_counter, frame->data,
+                        frame->len);
+    cancrypt_can_time(&cancrypt_can_seal_timing, start);
+
+    state->tx_counter++;
+    frame->len = len;
+    if (CANFD_CLASSIC_MAX_DATA_LEN < len)
+    {
+        frame->flags |= CANFD_FRAME_FLAG_FDF;
+    }
+    return true;
+#else
+    CY_UNUSED_PARAMETER(frame);
+    return true;
+#endif /* CANCRYPT_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_can_open
+********************************************************************************
+* Summary:
+* Checks and decrypts the payload of a received frame of
+* CANCRYPT_CAN_ID_LIST in place. Called by the dispatcher in the main loop,
+* not in the RX interrupt, so the interrupt takes no longer with encryption
+* on. A frame of an older epoch, or of an earlier counter of the same epoch,
+* is a replay. A newer epoch is a restart of the sender, only taken from a
+* frame that passed authentication. CTR frames have no replay check, as
+* their epoch and counter are not authenticated. Frames of listed IDs that
+* arrive before cancrypt_can_init() are dropped.
+*
+* Parameters:
+*  frame        Received frame
+*
+* Return:
+*  false if the frame must be dropped
+*
+*******************************************************************************/
+bool cancrypt_can_open(canfd_frame_t *frame)
+{
+#if (CANCRYPT_ENABLE)
+    uint32_t entry = cancrypt_can_find(frame);
+    const cancrypt_can_entry_t *info;
+    cancrypt_can_state_t *state;
+    uint32_t start;
+    uint32_t epoch;
+    uint32_t counter;
+    int32_t len;
+
+    if (CANCRYPT_CAN_ID_COUNT <= entry)
+    {
+        return true;
+    }
+    if (!cancrypt_can_ready)
+    {
+        return false;
+    }
+
+    info = &cancrypt_can_ids[entry];
+    state = &cancrypt_can_states[entry];
+    start = cycle_counter_get();
+    len = cancrypt_open(&cancrypt_can_keys[info->key], info->mode, frame->id,
+                        frame->data, frame->len, &epoch, &counter);
+    cancrypt_can_time(&cancrypt_can_open_timing, start);
+
+    if (len < 0)
+    {
+        cancrypt_can_auth_failed++;
+        STATS_INC(CANCRYPT_BAD_TAG);
+        return false;
+    }
+    switch (cancrypt_rx_check(&state->rx, info->mode, epoch, counter))
+    {
+        case CANCRYPT_RX_REPLAY:
+            cancrypt_can_replayed++;
+            STATS_INC(CANCRYPT_REPLAYS);
+            return false;
+
+        case CANCRYPT_RX_RESTART:
+            cancrypt_can_restarts++;
+            break;
+
+        default:
+            break;
+    }
+
+    frame->len = (uint8_t)len;
+    return true;
+#else
+    CY_UNUSED_PARAMETER(frame);
+    return true;
+#endif /* CANCRYPT_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: cancrypt_can_report
+********************************************************************************
+* Summary:
+* Prints the AES backend, the frames sealed and opened with their average
+* and worst-case cycles, and the frames dropped. The worst case of the open
+* is the latency encryption adds to a received frame, as the AES, CTR and
+* GHASH code does not branch on the key or the data.
+*
+*******************************************************************************/
+void cancrypt_can_report(void)
+{
+#if (CANCRYPT_ENABLE)
+    const cancrypt_can_timing_t *timings[2] =
+    {
+        &cancrypt_can_seal_timing, &cancrypt_can_open_timing
+    };
+    static const char *const names[2] = { "seal", "open" };
+
+    if (!cancrypt_can_ready)
+    {
+        return;
+    }
+
+    if (cancrypt_can_epoch_valid)
+    {
+        printf("Crypto: AES-128 on %s, epoch %lu, ",
+               (CANCRYPT_CAN_HW) ? "Cryptolite" : "software (bitsliced)",
+               (unsigned long)cancrypt_can_epoch);
+    }
+    else
+    {
+        printf("Crypto: AES-128 on %s, no epoch, listed IDs not sent, ",
+               (CANCRYPT_CAN_HW) ? "Cryptolite" : "software (bitsliced)");
+    }
+    printf("%lu without epoch, %lu too long, "
+           "%lu failed authentication, %lu replays, %lu restarts\r\n",
+           (unsigned long)cancrypt_can_no_epoch,
+           (unsigned long)cancrypt_can_too_long,
+           (unsigned long)cancrypt_can_auth_failed,
+           (unsigned long)cancrypt_can_replayed,
+           (unsigned long)cancrypt_can_restarts);
+    for (uint32_t idx = 0U; idx < 2U; idx++)
+    {
+        const cancrypt_can_timing_t *timing = timings[idx];
+        uint32_t max_us_centi = (uint32_t)(((uint64_t)timing->cycles_max *
+                                            100000000U) / SystemCoreClock);
+
+        if (0U == timing->frames)
+        {
+            continue;
+        }
+        printf("  %s %lu frames, %lu cycles avg, %lu max (%lu.%02lu us)\r\n",
+               names[idx], (unsigned long)timing->frames,
+               (unsigned long)(timing->cycles / timing->frames),
+               (unsigned long)timing->cycles_max,
+               (unsigned long)(max_us_centi / 100U),
+               (unsigned long)(max_us_centi % 100U));
+    }
+#endif /* CANCRYPT_ENABLE */
+}
+
+/* [] END OF FILE */
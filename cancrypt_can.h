@@ -0,0 +1,139 @@
+/******************************************************************************
+* File Name:   cancrypt_can.h
+*
+* Description: This file contains the encryption of the payloads of listed
+*              IDs, on Cryptolite or in software, with per-frame cycle counts.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef CANCRYPT_CAN_H_
+#define CANCRYPT_CAN_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "canfd_frame.h"
+#include "cancrypt.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Encrypted IDs: X(identifier, CAN ID, mode, index in CANCRYPT_CAN_KEYS).
+ * Each ID must have a single sender, as the counter of the nonce is kept
+ * per ID by its sender. IDs can share a key, since the ID is part of the
+ * nonce. */
+#define CANCRYPT_CAN_ID_LIST(X)                                                \
+    X(NODE_1,       0x001U, CANCRYPT_MODE_GCM,  0U)                            \
+    X(NODE_2,       0x002U, CANCRYPT_MODE_GCM,  0U)
+
+/* Keys of CANCRYPT_CAN_ID_LIST. These are demo keys that anyone with this
+ * source knows: provision real keys per product, outside the source tree. */
+#ifndef CANCRYPT_CAN_KEYS
+#define CANCRYPT_CAN_KEY_COUNT  (1U)
+#define CANCRYPT_CAN_KEYS                                                      \
+{                                                                              \
+    { 0x2BU, 0x7EU, 0x15U, 0x16U, 0x28U, 0xAEU, 0xD2U, 0xA6U,                  \
+      0xABU, 0xF7U, 0x15U, 0x88U, 0x09U, 0xCFU, 0x4FU, 0x3CU }                 \
+}
+#endif
+
+/* 1 to run AES on the Cryptolite block of the device, 0 for the bitsliced
+ * software AES of cancrypt.c. Either way, the counter mode and GHASH run in
+ * software, as Cryptolite only encrypts single blocks. */
+#ifndef CANCRYPT_CAN_HW
+#if defined(CY_IP_MXCRYPTOLITE)
+#define CANCRYPT_CAN_HW         (1)
+#else
+#define CANCRYPT_CAN_HW         (0)
+#endif
+#endif
+
+/* 1 to keep the epoch, the count of the start-ups of this node, in two
+ * rows of internal flash that take turns, one programmed per start-up. 0
+ * for a node without such rows: it then has no epoch and does not send the
+ * listed IDs, as their nonces could repeat. It still opens them. */
+#ifndef CANCRYPT_CAN_EPOCH_FLASH
+#define CANCRYPT_CAN_EPOCH_FLASH    (1)
+#endif
+
+/* First of the two epoch rows. They are outside the image, at the top of
+ * the code flash, so programming an image or a firmware update leaves them
+ * as they are, and the epoch keeps counting up across images with the same
+ * keys. Only an erase of the whole flash clears them: provision new keys
+ * after one. The flash budgets of scripts/size_budget.json keep the image
+ * far below the rows. */
+#ifndef CANCRYPT_CAN_EPOCH_ADDR
+#define CANCRYPT_CAN_EPOCH_ADDR                                                \
+    (CY_FLASH_BASE + CY_FLASH_SIZE - (2U * CY_FLASH_SIZEOF_ROW))
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+#define CANCRYPT_CAN_ID_ENUM(name, id, mode, key)   CANCRYPT_CAN_ID_##name,
+typedef enum
+{
+    CANCRYPT_CAN_ID_LIST(CANCRYPT_CAN_ID_ENUM)
+    CANCRYPT_CAN_ID_COUNT
+} cancrypt_can_id_t;
+#undef CANCRYPT_CAN_ID_ENUM
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void cancrypt_can_init(void);
+bool cancrypt_can_protected(const canfd_frame_t *frame);
+bool cancrypt_can_seal(canfd_frame_t *frame);
+bool cancrypt_can_open(canfd_frame_t *frame);
+void cancrypt_can_report(void);
+#if (CANCRYPT_CAN_HW)
+void cancrypt_can_hw_ecb(void *ctx, uint8_t *out, const uint8_t *in,
+                         uint32_t blocks);
+#endif /* CANCRYPT_CAN_HW */
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CANCRYPT_CAN_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,486 @@
+/******************************************************************************
+* File Name:   canfd_frame.c
+*
+* Description: This file contains the frame encode and decode, software filter
+*              matching, CRC and log formatting helpers.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "canfd_frame.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Payload length for each data length code */
+static const uint8_t canfd_dlc_len[16] =
+{
+    0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 12U, 16U, 20U, 24U, 32U, 48U, 64U
+};
+
+/* CRC-16/CCITT-FALSE (polynomial 0x1021), one entry per nibble */
+static const uint16_t canfd_crc16_nibble[16] =
+{
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU
+};
+
+/*******************************************************************************
+* Function Name: canfd_dlc_to_len
+********************************************************************************
+* Summary:
+* Converts a data length code to the payload length in bytes.
+*
+* Parameters:
+*  dlc      Data length code (0 to 15)
+*
+* Return:
+*  Payload length in bytes
+*
+*******************************************************************************/
+uint8_t canfd_dlc_to_len(uint32_t dlc)
+{
+    return canfd_dlc_len[dlc & 0x0FU];
+}
+
+/*******************************************************************************
+* Function Name: canfd_frame_dlc_len
+********************************************************************************
+* Summary:
+* Converts the data length code of a received or stored frame to its payload
+* length. A classic frame carries at most 8 bytes: DLC 9 to 15 mean 8 bytes
+* there, and only a CAN FD frame maps them to 12 to 64 bytes.
+*
+* Parameters:
+*  dlc      Data length code (0 to 15)
+*  fdf      true for a CAN FD frame
+*
+* Return:
+*  Payload length in bytes
+*
+*******************************************************************************/
+uint8_t canfd_frame_dlc_len(uint32_t dlc, bool fdf)
+{
+    uint8_t len = canfd_dlc_to_len(dlc);
+
+    if ((!fdf) && (len > CANFD_CLASSIC_MAX_DATA_LEN))
+    {
+        len = CANFD_CLASSIC_MAX_DATA_LEN;
+    }
+
+    return len;
+}
+
+/*******************************************************************************
+* Function Name: canfd_len_to_dlc
+********************************************************************************
+* Summary:
+* Converts a payload length to the smallest data length code that holds it.
+*
+* Parameters:
+*  len      Payload length in bytes (0 to 64)
+*
+* Return:
+*  Data length code
+*
+*******************************************************************************/
+uint32_t canfd_len_to_dlc(uint32_t len)
+{
+    uint32_t dlc = (len <= CANFD_CLASSIC_MAX_DATA_LEN) ? len : 9U;
+
+    while ((dlc < 15U) && (canfd_dlc_len[dlc] < len))
+    {
+        dlc++;
+    }
+
+    return dlc;
+}
+
+/*******************************************************************************
+* Function Name: canfd_frame_from_rx_buffer
+********************************************************************************
+* Summary:
+* Decodes a received message, as passed to the RX callback, into a frame.
+* The frame is marked as received on bus A; the caller changes that for
+* other channels.
+*
+* Parameters:
+*  frame        Destination frame
+*  rx_buf       Received message
+*
+*******************************************************************************/
+void canfd_frame_from_rx_buffer(canfd_frame_t *frame,
+                                const cy_stc_canfd_rx_buffer_t *rx_buf)
+{
+    uint8_t flags = 0U;
+
+    if (CY_CANFD_XTD_EXTENDED_ID == rx_buf->r0_f->xtd)
+    {
+        flags |= CANFD_FRAME_FLAG_XTD;
+    }
+    if (CY_CANFD_RTR_REMOTE_FRAME == rx_buf->r0_f->rtr)
+    {
+        flags |= CANFD_FRAME_FLAG_RTR;
+    }
+    if (CY_CANFD_FDF_CAN_FD_FRAME == rx_buf->r1_f->fdf)
+    {
+        flags |= CANFD_FRAME_FLAG_FDF;
+    }
+    if (rx_buf->r1_f->brs)
+    {
+        flags |= CANFD_FRAME_FLAG_BRS;
+    }
+
+    frame->id = rx_buf->r0_f->id;
+    frame->timestamp = rx_buf->r1_f->rxts;
+    frame->flags = flags;
+    frame->bus = 0U;
+    frame->reserved = 0U;
+    frame->len = canfd_frame_dlc_len(rx_buf->r1_f->dlc,
+                                     (0U != (flags & CANFD_FRAME_FLAG_FDF)));
+
+    memcpy(frame->data, rx_buf->data_area_f, frame->len);
+}
+
+/*******************************************************************************
+* Function Name: canfd_frame_from_tx_buffer
+********************************************************************************
+* Summary:
+* Decodes a TX buffer structure, such as one set up in the design, into a
+* frame, so that it can be sent through the frame path.
+*
+* Parameters:
+*  frame        Destination frame
+*  tx_buf       TX buffer
+*
+*******************************************************************************/
+void canfd_frame_from_tx_buffer(canfd_frame_t *frame,
+                                const cy_stc_canfd_tx_buffer_t *tx_buf)
+{
+    uint8_t flags = 0U;
+
+    if (CY_CANFD_XTD_EXTENDED_ID == tx_buf->t0_f->xtd)
+    {
+        flags |= CANFD_FRAME_FLAG_XTD;
+    }
+    if (CY_CANFD_RTR_REMOTE_FRAME == tx_buf->t0_f->rtr)
+    {
+        flags |= CANFD_FRAME_FLAG_RTR;
+    }
+    if (CY_CANFD_FDF_CAN_FD_FRAME == tx_buf->t1_f->fdf)
+    {
+        flags |= CANFD_FRAME_FLAG_FDF;
+    }
+    if (tx_buf->t1_f->brs)
+    {
+        flags |= CANFD_FRAME_FLAG_BRS;
+    }
+
+    frame->id = tx_buf->t0_f->id;
+    frame->timestamp = 0U;
+    frame->flags = flags;
+    frame->bus = 0U;
+    frame->reserved = 0U;
+    frame->len = canfd_frame_dlc_len(tx_buf->t1_f->dlc,
+                                     (0U != (flags & CANFD_FRAME_FLAG_FDF)));
+
+    memcpy(frame->data, tx_buf->data_area_f, frame->len);
+}
+
+/*******************************************************************************
+* Function Name: canfd_frame_to_tx_buffer
+********************************************************************************
+* Summary:
+* Encodes a frame into a TX buffer structure ready for
+* Cy_CANFD_UpdateAndTransmitMsgBuffer(). Payloads that do not match a data
+* length code exactly are padded with zeros.
+*
+* Parameters:
+*  frame        Frame to send
+*  tx_buf       Destination TX buffer; its data area must hold the frame
+*
+*******************************************************************************/
+void canfd_frame_to_tx_buffer(const canfd_frame_t *frame,
+                              cy_stc_canfd_tx_buffer_t *tx_buf)
+{
+    uint32_t dlc = canfd_len_to_dlc(frame->len);
+    uint32_t padded_len = canfd_dlc_to_len(dlc);
+    uint8_t *data = (uint8_t *)tx_buf->data_area_f;
+
+    tx_buf->t0_f->id = frame->id;
+    tx_buf->t0_f->xtd = (0U != (frame->flags & CANFD_FRAME_FLAG_XTD)) ?
+                        CY_CANFD_XTD_EXTENDED_ID : CY_CANFD_XTD_STANDARD_ID;
+    tx_buf->t0_f->rtr = (0U != (frame->flags & CANFD_FRAME_FLAG_RTR)) ?
+                        CY_CANFD_RTR_REMOTE_FRAME : CY_CANFD_RTR_DATA_FRAME;
+    tx_buf->t1_f->fdf = (0U != (frame->flags & CANFD_FRAME_FLAG_FDF)) ?
+                        CY_CANFD_FDF_CAN_FD_FRAME : CY_CANFD_FDF_STANDARD_FRAME;
+    tx_buf->t1_f->brs = (0U != (frame->flags & CANFD_FRAME_FLAG_BRS));
+    tx_buf->t1_f->dlc = dlc;
+
+    memcpy(data, frame->data, frame->len);
+    if (padded_len > frame->len)
+    {
+        memset(&data[frame->len], 0, padded_len - frame->len);
+    }
+}
+
+/*******************************************************************************
+* Function Name: canfd_frame_get_format
+********************************************************************************
+* Summary:
+* Returns the format the FDF and BRS flags of a frame select.
+*
+*******************************************************************************/
+txfmt_format_t canfd_frame_get_format(const canfd_frame_t *frame)
+{
+    if (0U == (frame->flags & CANFD_FRAME_FLAG_FDF))
+    {
+        return TXFMT_CLASSIC;
+    }
+    return (0U != (frame->flags & CANFD_FRAME_FLAG_BRS)) ? TXFMT_FD_BRS :
+                                                            TXFMT_FD;
+}
+
+/*******************************************************************************
+* Function Name: canfd_frame_set_format
+********************************************************************************
+* Summary:
+* Sets the FDF and BRS flags of a frame for a format.
+*
+*******************************************************************************/
+void canfd_frame_set_format(canfd_frame_t *frame, txfmt_format_t format)
+{
+    frame->flags &= (uint8_t)~(CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS);
+    if (TXFMT_CLASSIC != format)
+    {
+        frame->flags |= CANFD_FRAME_FLAG_FDF;
+    }
+    if (TXFMT_FD_BRS == format)
+    {
+        frame->flags |= CANFD_FRAME_FLAG_BRS;
+    }
+}
+
+/*******************************************************************************
+* Function Name: canfd_sid_filter_match
+********************************************************************************
+* Summary:
+* Software model of one standard ID filter element of the controller.
+*
+* Parameters:
+*  filter       Filter element
+*  id           11-bit identifier
+*
+* Return:
+*  true if the identifier matches the element
+*
+*******************************************************************************/
+bool canfd_sid_filter_match(const cy_stc_id_filter_t *filter, uint32_t id)
+{
+    bool match;
+
+    switch (filter->sft)
+    {
+        case CY_CANFD_SFT_RANGE_SFID1_SFID2:
+            match = (id >= filter->sfid1) && (id <= filter->sfid2);
+            break;
+        case CY_CANFD_SFT_DUAL_ID:
+            match = (id == filter->sfid1) || (id == filter->sfid2);
+            break;
+        case CY_CANFD_SFT_CLASSIC_FILTER:
+            match = ((id ^ filter->sfid1) & filter->sfid2) == 0U;
+            break;
+        default:
+            match = false;
+            break;
+    }
+
+    return match && (CY_CANFD_SFEC_DISABLE != filter->sfec);
+}
+
+/*******************************************************************************
+* Function Name: canfd_sid_filter_find
+********************************************************************************
+* Summary:
+* Returns the first filter element that matches an identifier, scanning in
+* the same order as the controller.
+*
+* Parameters:
+*  filters      Filter list
+*  count        Number of elements in the list
+*  id           11-bit identifier
+*
+* Return:
+*  Index of the matching element, or -1 if none matches
+*
+*******************************************************************************/
+int32_t canfd_sid_filter_find(const cy_stc_id_filter_t *filters,
+                              uint32_t count, uint32_t id)
+{
+    for (uint32_t idx = 0U; idx < count; idx++)
+    {
+        if (canfd_sid_filter_match(&filters[idx], id))
+        {
+            return (int32_t)idx;
+        }
+    }
+
+    return -1;
+}
+
+/*******************************************************************************
+* Function Name: canfd_crc16
+********************************************************************************
+* Summary:
+* Updates a CRC-16/CCITT-FALSE over a block of bytes.
+*
+* Parameters:
+*  crc          Running CRC, CANFD_CRC16_INIT for a new calculation
+*  data         Data bytes
+*  len          Number of bytes
+*
+* Return:
+*  Updated CRC
+*
+*******************************************************************************/
+uint16_t canfd_crc16(uint16_t crc, const uint8_t *data, uint32_t len)
+{
+    for (uint32_t idx = 0U; idx < len; idx++)
+    {
+        crc = (uint16_t)((crc << 4) ^
+              canfd_crc16_nibble[((crc >> 12) ^ (data[idx] >> 4)) & 0x0FU]);
+        crc = (uint16_t)((crc << 4) ^
+              canfd_crc16_nibble[((crc >> 12) ^ data[idx]) & 0x0FU]);
+    }
+
+    return crc;
+}
+
+/*******************************************************************************
+* Function Name: canfd_format_str
+********************************************************************************
+* Summary:
+* Appends a string to a bounded output buffer.
+*
+*******************************************************************************/
+static size_t canfd_format_str(char *buf, size_t pos, size_t size,
+                               const char *str)
+{
+    while (('\0' != *str) && ((pos + 1U) < size))
+    {
+        buf[pos++] = *str++;
+    }
+
+    return pos;
+}
+
+/*******************************************************************************
+* Function Name: canfd_format_uint
+********************************************************************************
+* Summary:
+* Appends an unsigned decimal number to a bounded output buffer.
+*
+*******************************************************************************/
+static size_t canfd_format_uint(char *buf, size_t pos, size_t size,
+                                uint32_t value)
+{
+    char digits[10];
+    uint32_t count = 0U;
+
+    do
+    {
+        digits[count++] = (char)('0' + (value % 10U));
+        value /= 10U;
+    } while (0U != value);
+
+    while ((0U != count) && ((pos + 1U) < size))
+    {
+        buf[pos++] = digits[--count];
+    }
+
+    return pos;
+}
+
+/*******************************************************************************
+* Function Name: canfd_frame_format
+********************************************************************************
+* Summary:
+* Formats a received frame as the log text printed on the debug UART. Uses no
+* variadic calls so it can be benchmarked and bounded on its own.
+*
+* Parameters:
+*  frame        Frame to format
+*  buf          Output buffer, CANFD_FRAME_FORMAT_SIZE bytes are always enough
+*  size         Size of the output buffer
+*
+* Return:
+*  Length of the text, excluding the terminating zero
+*
+*******************************************************************************/
+size_t canfd_frame_format(const canfd_frame_t *frame, char *buf, size_t size)
+{
+    size_t pos = 0U;
+
+    if (0U == size)
+    {
+        return 0U;
+    }
+
+    pos = canfd_format_uint(buf, pos, size, frame->len);
+    pos = canfd_format_str(buf, pos, size,
+                           " bytes received with message identifier ");
+    pos = canfd_format_uint(buf, pos, size, frame->id);
+    pos = canfd_format_str(buf, pos, size, "\r\n\r\nRx Data : ");
+
+    for (uint32_t idx = 0U; idx < frame->len; idx++)
+    {
+        pos = canfd_format_str(buf, pos, size, " ");
+        pos = canfd_format_uint(buf, pos, size, frame->data[idx]);
+        pos = canfd_format_str(buf, pos, size, " ");
+    }
+
+    pos = canfd_format_str(buf, pos, size, "\r\n\r\n");
+    buf[pos] = '\0';
+
+    return pos;
+}
+
+/* [] END OF FILE */
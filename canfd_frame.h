@@ -0,0 +1,123 @@
+/******************************************************************************
+* File Name:   canfd_frame.h
+*
+* Description: This file contains the application frame type and the frame
+*              helpers shared by the receive and transmit paths.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef CANFD_FRAME_H_
+#define CANFD_FRAME_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stddef.h>
+#include "cy_pdl.h"
+#include "txfmt.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Largest CAN FD payload */
+#define CANFD_MAX_DATA_LEN          (64U)
+/* Largest classic CAN payload */
+#define CANFD_CLASSIC_MAX_DATA_LEN  (8U)
+
+/* canfd_frame_t flags */
+#define CANFD_FRAME_FLAG_XTD        (0x01U)     /* 29-bit identifier */
+#define CANFD_FRAME_FLAG_FDF        (0x02U)     /* CAN FD format */
+#define CANFD_FRAME_FLAG_BRS        (0x04U)     /* Bit rate switching */
+#define CANFD_FRAME_FLAG_RTR        (0x08U)     /* Remote frame */
+#define CANFD_FRAME_FLAG_FIXED      (0x10U)     /* Keep FDF and BRS as set */
+#define CANFD_FRAME_FLAG_TRACED     (0x20U)     /* Trace trailer after the
+                                                 * payload, see hoptrace.h */
+
+/* Buffer size that always fits the output of canfd_frame_format() */
+#define CANFD_FRAME_FORMAT_SIZE     (80U + (CANFD_MAX_DATA_LEN * 5U))
+
+/* Initial value of canfd_crc16() (CRC-16/CCITT-FALSE) */
+#define CANFD_CRC16_INIT            (0xFFFFU)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* CAN FD frame in application memory, independent of the message RAM layout */
+typedef struct
+{
+    uint32_t id;                            /* 11 or 29-bit identifier */
+    uint32_t timestamp;                     /* Controller RX timestamp */
+    uint8_t  len;                           /* Payload length in bytes */
+    uint8_t  flags;                         /* CANFD_FRAME_FLAG_xxx */
+    uint8_t  bus;                           /* Receiving channel, 0 = bus A */
+    uint8_t  reserved;                      /* With CANFD_FRAME_FLAG_TRACED,
+                                             * end of the trailer in data */
+    uint8_t  data[CANFD_MAX_DATA_LEN];
+} canfd_frame_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint8_t  canfd_dlc_to_len(uint32_t dlc);
+uint8_t  canfd_frame_dlc_len(uint32_t dlc, bool fdf);
+uint32_t canfd_len_to_dlc(uint32_t len);
+void     canfd_frame_from_rx_buffer(canfd_frame_t *frame,
+                                    const cy_stc_canfd_rx_buffer_t *rx_buf);
+void     canfd_frame_from_tx_buffer(canfd_frame_t *frame,
+                                    const cy_stc_canfd_tx_buffer_t *tx_buf);
+void     canfd_frame_to_tx_buffer(const canfd_frame_t *frame,
+                                  cy_stc_canfd_tx_buffer_t *tx_buf);
+txfmt_format_t canfd_frame_get_format(const canfd_frame_t *frame);
+void     canfd_frame_set_format(canfd_frame_t *frame, txfmt_format_t format);
+bool     canfd_sid_filter_match(const cy_stc_id_filter_t *filter, uint32_t id);
+int32_t  canfd_sid_filter_find(const cy_stc_id_filter_t *filters,
+                               uint32_t count, uint32_t id);
+uint16_t canfd_crc16(uint16_t crc, const uint8_t *data, uint32_t len);
+size_t   canfd_frame_format(const canfd_frame_t *frame, char *buf, size_t size);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CANFD_FRAME_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,311 @@
+/******************************************************************************
+* File Name:   datarate.c
+*
+* Description: This file contains the adaptation of the data phase bit rate to
+*              the data phase error rate, shared by all nodes of the bus.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "datarate.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define DATARATE_LEVEL_ENTRY(name, divider, brs)                               \
+    [DATARATE_LEVEL_##name] = { #name, (divider), (brs) },
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    uint32_t divider;
+    bool brs;
+} datarate_level_info_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const datarate_level_info_t datarate_levels[DATARATE_LEVEL_COUNT] =
+{
+    DATARATE_LEVEL_LIST(DATARATE_LEVEL_ENTRY)
+};
+
+static datarate_level_t datarate_level;
+static uint32_t datarate_level_start_ms;
+
+/* Current window */
+static uint32_t datarate_window_start_ms;
+static uint32_t datarate_window_frames;
+static uint32_t datarate_window_errors;
+
+/* Clean time at the current setting, and whether it is being tried */
+static uint32_t datarate_clean_ms;
+static bool datarate_probing;
+
+static datarate_stats_t datarate_stats;
+
+/*******************************************************************************
+* Function Name: datarate_init
+********************************************************************************
+* Summary:
+* Starts at the fastest setting with empty counters.
+*
+*******************************************************************************/
+void datarate_init(uint32_t now_ms)
+{
+    datarate_level = DATARATE_LEVEL_FULL;
+    datarate_level_start_ms = now_ms;
+    datarate_window_start_ms = now_ms;
+    datarate_window_frames = 0U;
+    datarate_window_errors = 0U;
+    datarate_clean_ms = 0U;
+    datarate_probing = false;
+    memset(&datarate_stats, 0, sizeof(datarate_stats));
+    datarate_stats.hold_ms = DATARATE_HOLD_MS;
+}
+
+/*******************************************************************************
+* Function Name: datarate_count
+********************************************************************************
+* Summary:
+* Adds frames and data phase errors seen at the current setting to the
+* current window.
+*
+*******************************************************************************/
+void datarate_count(uint32_t frames, uint32_t errors)
+{
+    datarate_window_frames += frames;
+    datarate_window_errors += errors;
+}
+
+/*******************************************************************************
+* Function Name: datarate_poll
+********************************************************************************
+* Summary:
+* Closes the window when it is over, or when it has DATARATE_BURST_ERRORS
+* errors, and decides on the setting. It steps
+* down after a window with too many errors, and tries the next faster
+* setting after enough clean time. A try that fails within
+* DATARATE_PROBE_MS doubles the clean time needed for the next one.
+*
+* Parameters:
+*  now_ms       Current time
+*  level        Set to the new setting if there is one
+*
+* Return:
+*  true if all nodes must change to *level
+*
+*******************************************************************************/
+bool datarate_poll(uint32_t now_ms, datarate_level_t *level)
+{
+    uint32_t frames = datarate_window_frames;
+    uint32_t errors = datarate_window_errors;
+    uint64_t total = (uint64_t)frames + errors;
+    uint64_t errors_ppm = (uint64_t)errors * 1000000ULL;
+    datarate_level_t next = datarate_level;
+    bool bad;
+    bool clean;
+
+    if (((uint32_t)(now_ms - datarate_window_start_ms) < DATARATE_WINDOW_MS) &&
+        (errors < DATARATE_BURST_ERRORS))
+    {
+        return false;
+    }
+
+    datarate_window_start_ms = now_ms;
+    datarate_window_frames = 0U;
+    datarate_window_errors = 0U;
+    datarate_stats.windows++;
+    datarate_stats.frames += frames;
+    datarate_stats.errors += errors;
+
+    bad = (errors >= DATARATE_DOWN_ERRORS) &&
+          (errors_ppm > ((uint64_t)DATARATE_DOWN_PPM * total));
+    clean = (total >= DATARATE_MIN_FRAMES) &&
+            (errors_ppm <= ((uint64_t)DATARATE_UP_PPM * total));
+
+    if (bad)
+    {
+        datarate_clean_ms = 0U;
+        if (datarate_probing)
+        {
+            datarate_probing = false;
+            datarate_stats.probes_failed++;
+            datarate_stats.hold_ms *= 2U;
+            if (datarate_stats.hold_ms > DATARATE_HOLD_MAX_MS)
+            {
+                datarate_stats.hold_ms = DATARATE_HOLD_MAX_MS;
+            }
+        }
+        if (((uint32_t)datarate_level + 1U) < (uint32_t)DATARATE_LEVEL_COUNT)
+        {
+            next = (datarate_level_t)((uint32_t)datarate_level + 1U);
+            datarate_stats.steps_down++;
+        }
+    }
+    else if (clean)
+    {
+        datarate_clean_ms += DATARATE_WINDOW_MS;
+        if (datarate_probing)
+        {
+            if (datarate_clean_ms >= DATARATE_PROBE_MS)
+            {
+                datarate_probing = false;
+                datarate_stats.hold_ms = DATARATE_HOLD_MS;
+            }
+        }
+        else if ((DATARATE_LEVEL_FULL != datarate_level) &&
+                 (datarate_clean_ms >= datarate_stats.hold_ms))
+        {
+            next = (datarate_level_t)((uint32_t)datarate_level - 1U);
+            datarate_stats.probes++;
+            datarate_probing = true;
+            datarate_clean_ms = 0U;
+        }
+    }
+    else if (total >= DATARATE_MIN_FRAMES)
+    {
+        /* Errors below the step down but above clean: start over */
+        datarate_clean_ms = 0U;
+    }
+    else
+    {
+        /* Too few frames to tell; the clean time is kept */
+    }
+
+    if (next == datarate_level)
+    {
+        return false;
+    }
+    datarate_set_level(next, now_ms);
+    *level = next;
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: datarate_set_level
+********************************************************************************
+* Summary:
+* Records a change of setting. Nodes that follow the decisions of another
+* one call it when they apply a setting.
+*
+*******************************************************************************/
+void datarate_set_level(datarate_level_t level, uint32_t now_ms)
+{
+    if (level == datarate_level)
+    {
+        return;
+    }
+    datarate_stats.level_ms[datarate_level] += now_ms - datarate_level_start_ms;
+    datarate_level_start_ms = now_ms;
+    datarate_level = level;
+
+    /* Errors of the window belong to the previous setting */
+    datarate_window_start_ms = now_ms;
+    datarate_window_frames = 0U;
+    datarate_window_errors = 0U;
+}
+
+/*******************************************************************************
+* Function Name: datarate_get_level
+********************************************************************************
+* Summary:
+* Returns the current setting.
+*
+*******************************************************************************/
+datarate_level_t datarate_get_level(void)
+{
+    return datarate_level;
+}
+
+/*******************************************************************************
+* Function Name: datarate_divider
+********************************************************************************
+* Summary:
+* Returns the divider of the design data bit rate of a setting.
+*
+*******************************************************************************/
+uint32_t datarate_divider(datarate_level_t level)
+{
+    return datarate_levels[level].divider;
+}
+
+/*******************************************************************************
+* Function Name: datarate_brs
+********************************************************************************
+* Summary:
+* Returns whether a setting sends the data phase at the data bit rate.
+*
+*******************************************************************************/
+bool datarate_brs(datarate_level_t level)
+{
+    return datarate_levels[level].brs;
+}
+
+/*******************************************************************************
+* Function Name: datarate_name
+********************************************************************************
+* Summary:
+* Returns the name of a setting.
+*
+*******************************************************************************/
+const char *datarate_name(datarate_level_t level)
+{
+    return datarate_levels[level].name;
+}
+
+/*******************************************************************************
+* Function Name: datarate_get_stats
+********************************************************************************
+* Summary:
+* Returns the counters, with the time at the current setting up to now.
+*
+*******************************************************************************/
+void datarate_get_stats(datarate_stats_t *stats, uint32_t now_ms)
+{
+    *stats = datarate_stats;
+    stats->level_ms[datarate_level] += now_ms - datarate_level_start_ms;
+}
+
+/* [] END OF FILE */
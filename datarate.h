@@ -0,0 +1,162 @@
+/******************************************************************************
+* File Name:   datarate.h
+*
+* Description: This file contains the adaptation of the data phase bit rate to
+*              the data phase error rate, shared by all nodes of the bus.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef DATARATE_H_
+#define DATARATE_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* Only the C library, so that host/ can build the simulator */
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make DATARATE_ENABLE=1") to lower the data
+ * phase bit rate of all nodes when data phase errors pile up, and to raise
+ * it again when they stop */
+#ifndef DATARATE_ENABLE
+#define DATARATE_ENABLE         (0)
+#endif
+
+/* List of data phase settings, from the fastest: X(identifier, divider of
+ * the design data bit rate, bit rate switching). The last one sends the
+ * data phase at the nominal rate. */
+#define DATARATE_LEVEL_LIST(X)                                                 \
+    X(FULL,         1U, true)                                                  \
+    X(HALF,         2U, true)                                                  \
+    X(NO_BRS,       1U, false)
+
+/* Error rates are taken over windows of this length */
+#ifndef DATARATE_WINDOW_MS
+#define DATARATE_WINDOW_MS      (500U)
+#endif
+
+/* A window with fewer frames than this tells nothing about the bus, unless
+ * it has DATARATE_DOWN_ERRORS errors */
+#define DATARATE_MIN_FRAMES     (20U)
+
+/* Step down after a window with more errors than this per million frames,
+ * and at least DATARATE_DOWN_ERRORS of them. A sender's transmit error
+ * counter gains 8 per error and loses 1 per frame sent, so above one error
+ * in nine frames it drifts toward error passive and bus-off. */
+#ifndef DATARATE_DOWN_PPM
+#define DATARATE_DOWN_PPM       (50000UL)
+#endif
+#define DATARATE_DOWN_ERRORS    (4U)
+
+/* A window closes early once it has this many errors, so that a bad try
+ * of a faster setting ends before the senders reach error passive */
+#define DATARATE_BURST_ERRORS   (16U)
+
+/* A window with at most this many errors per million frames is clean */
+#ifndef DATARATE_UP_PPM
+#define DATARATE_UP_PPM         (20000UL)
+#endif
+
+/* Clean time before the next faster setting is tried. It doubles after
+ * each failed try, up to DATARATE_HOLD_MAX_MS, and is reset when a try
+ * holds for DATARATE_PROBE_MS. */
+#ifndef DATARATE_HOLD_MS
+#define DATARATE_HOLD_MS        (5000U)
+#endif
+#ifndef DATARATE_HOLD_MAX_MS
+#define DATARATE_HOLD_MAX_MS    (80000U)
+#endif
+#define DATARATE_PROBE_MS       (2000U)
+
+/* A change of setting takes effect this long after the command, so that
+ * all nodes switch together; the command is repeated with no delay every
+ * DATARATE_ANNOUNCE_MS for nodes that missed it */
+#define DATARATE_SWITCH_MS      (20U)
+#define DATARATE_ANNOUNCE_MS    (1000U)
+
+#define DATARATE_LEVEL_ENUM(name, divider, brs)     DATARATE_LEVEL_##name,
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef enum
+{
+    DATARATE_LEVEL_LIST(DATARATE_LEVEL_ENUM)
+    DATARATE_LEVEL_COUNT
+} datarate_level_t;
+
+typedef struct
+{
+    uint32_t frames;                /* Frames counted */
+    uint32_t errors;                /* Data phase errors counted */
+    uint32_t windows;
+    uint32_t steps_down;
+    uint32_t probes;                /* Tries of a faster setting */
+    uint32_t probes_failed;
+    uint32_t hold_ms;               /* Current clean time before a try */
+    uint32_t level_ms[DATARATE_LEVEL_COUNT];    /* Time spent per setting */
+} datarate_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void datarate_init(uint32_t now_ms);
+void datarate_count(uint32_t frames, uint32_t errors);
+bool datarate_poll(uint32_t now_ms, datarate_level_t *level);
+void datarate_set_level(datarate_level_t level, uint32_t now_ms);
+datarate_level_t datarate_get_level(void);
+uint32_t datarate_divider(datarate_level_t level);
+bool datarate_brs(datarate_level_t level);
+const char *datarate_name(datarate_level_t level);
+void datarate_get_stats(datarate_stats_t *stats, uint32_t now_ms);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* DATARATE_H_ */
+
+/* [] END OF FILE */
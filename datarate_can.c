@@ -0,0 +1,562 @@
+/******************************************************************************
+* File Name:   datarate_can.c
+*
+* Description: This file contains the coordination of the data phase bit rate
+*              between the nodes and its setting in the CAN FD channel.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "datarate_can.h"
+#include "txfmt.h"
+#include "stats.h"
+
+#if (DATARATE_ENABLE)
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Largest data bit rate prescaler (DBTP.DBRP + 1) */
+#define DATARATE_CAN_PRESCALER_MAX  (32U)
+
+/* Data phase last error codes of PSR.DLEC */
+#define DATARATE_CAN_DLEC_COUNT     (8U)
+#define DATARATE_CAN_DLEC_NONE      (0U)
+#define DATARATE_CAN_DLEC_NO_CHANGE (7U)
+
+_Static_assert((DATARATE_CAN_COMMAND_ID <= DATARATE_CAN_ACK_ID) ||
+               (DATARATE_CAN_COMMAND_ID >
+                (DATARATE_CAN_ACK_ID + DATARATE_CAN_NODE_MAX)),
+               "the command ID must not be an acknowledgment ID");
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static CANFD_Type                  *datarate_can_base;
+static uint32_t                     datarate_can_chan;
+static const cy_stc_canfd_config_t *datarate_can_config;
+static datarate_can_send_fn_t       datarate_can_send;
+static uint8_t                      datarate_can_node;
+static bool                         datarate_can_running;
+
+/* Setting in the controller, and the register values it was written as, to
+ * tell when the channel was re-initialized */
+static datarate_level_t             datarate_can_level;
+static uint32_t                     datarate_can_dbtp;
+static uint32_t                     datarate_can_cccr_brse;
+
+/* Change waiting for its switch time */
+static bool                         datarate_can_pending;
+static datarate_level_t             datarate_can_next;
+static uint32_t                     datarate_can_switch_ms;
+
+/* Master: command sequence number, command not sent yet, next announce.
+ * Other nodes: last command seen, acknowledgment not sent yet. */
+static uint8_t                      datarate_can_seq;
+static bool                         datarate_can_command_due;
+static uint32_t                     datarate_can_announce_ms;
+static bool                         datarate_can_ack_due;
+
+/* Counted in interrupt context, taken by the main loop */
+static volatile uint32_t            datarate_can_frames;
+static volatile uint32_t            datarate_can_errors;
+static uint32_t                     datarate_can_frames_seen;
+static uint32_t                     datarate_can_errors_seen;
+static volatile uint32_t            datarate_can_dlec[DATARATE_CAN_DLEC_COUNT];
+
+/* Master: setting each node acknowledged last */
+static int8_t                       datarate_can_acked[DATARATE_CAN_NODE_MAX];
+
+static uint32_t                     datarate_can_switches;
+static uint32_t                     datarate_can_now_ms;
+
+static const char *const datarate_can_dlec_names[DATARATE_CAN_DLEC_COUNT] =
+{
+    "none", "stuff", "form", "ack", "bit1", "bit0", "crc", "-"
+};
+
+/*******************************************************************************
+* Function Name: datarate_can_apply
+********************************************************************************
+* Summary:
+* Writes a setting into the controller: the design data bit rate prescaler
+* times the divider of the setting, with the time segments of the design,
+* and bit rate switching on or off. The channel leaves the bus for the
+* change and joins again after 11 recessive bits.
+*
+*******************************************************************************/
+static void datarate_can_apply(datarate_level_t level)
+{
+    cy_stc_canfd_bitrate_t data = *datarate_can_config->fastBitrate;
+    txfmt_rates_t rates;
+
+    /* The prescaler fields hold the divider minus one */
+    data.prescaler = (uint16_t)(((data.prescaler + 1U) *
+                                 datarate_divider(level)) - 1U);
+
+    (void)Cy_CANFD_ConfigChangesEnable(datarate_can_base, datarate_can_chan);
+    Cy_CANFD_SetFastBitrate(datarate_can_base, datarate_can_chan, &data);
+    if (datarate_brs(level))
+    {
+        CANFD_CCCR(datarate_can_base, datarate_can_chan) |=
+            CANFD_CH_M_TTCAN_CCCR_BRSE_Msk;
+    }
+    else
+    {
+        CANFD_CCCR(datarate_can_base, datarate_can_chan) &=
+            ~CANFD_CH_M_TTCAN_CCCR_BRSE_Msk;
+    }
+    (void)Cy_CANFD_ConfigChangesDisable(datarate_can_base, datarate_can_chan);
+
+    datarate_can_dbtp = CANFD_DBTP(datarate_can_base, datarate_can_chan);
+    datarate_can_cccr_brse = CANFD_CCCR(datarate_can_base, datarate_can_chan) &
+                             CANFD_CH_M_TTCAN_CCCR_BRSE_Msk;
+    datarate_can_level = level;
+    datarate_can_switches++;
+
+    /* Let the frame format choice see the new data phase */
+    txfmt_get_rates(&rates);
+    rates.data_bps = datarate_brs(level) ?
+                     (TXFMT_DATA_BPS / datarate_divider(level)) :
+                     rates.nominal_bps;
+    txfmt_set_rates(&rates);
+}
+
+/*******************************************************************************
+* Function Name: datarate_can_send_command
+********************************************************************************
+* Summary:
+* Sends the command of the master: the setting, and the time left until
+* the switch. A command without a pending change repeats the current
+* setting for nodes that missed one.
+*
+*******************************************************************************/
+static bool datarate_can_send_command(uint32_t now_ms)
+{
+    canfd_frame_t frame;
+    uint32_t delay_ms = 0U;
+    datarate_level_t level = datarate_can_level;
+
+    if (datarate_can_pending)
+    {
+        level = datarate_can_next;
+        if ((int32_t)(datarate_can_switch_ms - now_ms) > 0)
+        {
+            delay_ms = datarate_can_switch_ms - now_ms;
+        }
+    }
+
+    memset(&frame, 0, sizeof(frame));
+    frame.id = DATARATE_CAN_COMMAND_ID;
+    frame.len = DATARATE_CAN_COMMAND_LEN;
+    frame.flags = CANFD_FRAME_FLAG_FIXED;
+    frame.data[0] = datarate_can_seq;
+    frame.data[1] = (uint8_t)level;
+    frame.data[2] = (uint8_t)delay_ms;
+    frame.data[3] = (uint8_t)(delay_ms >> 8U);
+    return datarate_can_send(&frame);
+}
+
+/*******************************************************************************
+* Function Name: datarate_can_send_ack
+********************************************************************************
+* Summary:
+* Acknowledges the last command of the master with the setting applied.
+*
+*******************************************************************************/
+static bool datarate_can_send_ack(void)
+{
+    canfd_frame_t frame;
+
+    memset(&frame, 0, sizeof(frame));
+    frame.id = DATARATE_CAN_ACK_ID + datarate_can_node;
+    frame.len = DATARATE_CAN_ACK_LEN;
+    frame.flags = CANFD_FRAME_FLAG_FIXED;
+    frame.data[0] = datarate_can_seq;
+    frame.data[1] = (uint8_t)datarate_can_level;
+    return datarate_can_send(&frame);
+}
+#endif /* DATARATE_ENABLE */
+
+/*******************************************************************************
+* Function Name: datarate_can_init
+********************************************************************************
+* Summary:
+* Starts at the design data bit rate, and enables the interrupt of data
+* phase protocol errors. Call it after the channel has been initialized.
+*
+* Parameters:
+*  base         CAN FD block
+*  chan         Channel
+*  config       Channel configuration, the base of the settings
+*  node         Node number; DATARATE_CAN_MASTER_NODE decides
+*  send         Sends a frame through the application TX buffer
+*  now_ms       Current time
+*
+*******************************************************************************/
+void datarate_can_init(CANFD_Type *base, uint32_t chan,
+                       const cy_stc_canfd_config_t *config, uint8_t node,
+                       datarate_can_send_fn_t send, uint32_t now_ms)
+{
+#if (DATARATE_ENABLE)
+    datarate_can_base = base;
+    datarate_can_chan = chan;
+    datarate_can_config = config;
+    datarate_can_node = node;
+    datarate_can_send = send;
+    datarate_can_announce_ms = now_ms;
+    memset(datarate_can_acked, -1, sizeof(datarate_can_acked));
+
+    for (uint32_t level = 0U; level < (uint32_t)DATARATE_LEVEL_COUNT; level++)
+    {
+        if (((config->fastBitrate->prescaler + 1U) *
+             datarate_divider((datarate_level_t)level)) >
+            DATARATE_CAN_PRESCALER_MAX)
+        {
+            printf("Data rate: %s needs a prescaler above %u, adaptation "
+                   "off\r\n", datarate_name((datarate_level_t)level),
+                   (unsigned)DATARATE_CAN_PRESCALER_MAX);
+            return;
+        }
+    }
+
+    datarate_init(now_ms);
+    datarate_can_apply(DATARATE_LEVEL_FULL);
+    datarate_can_switches = 0U;
+
+    Cy_CANFD_SetInterruptMask(base, chan,
+                              Cy_CANFD_GetInterruptMask(base, chan) |
+                              CY_CANFD_PROTOCOL_ERROR_DATA_PHASE);
+    datarate_can_running = true;
+#else
+    CY_UNUSED_PARAMETER(base);
+    CY_UNUSED_PARAMETER(chan);
+    CY_UNUSED_PARAMETER(config);
+    CY_UNUSED_PARAMETER(node);
+    CY_UNUSED_PARAMETER(send);
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* DATARATE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: datarate_can_on_rx
+********************************************************************************
+* Summary:
+* Counts a received frame. Called by the RX interrupt.
+*
+*******************************************************************************/
+void datarate_can_on_rx(void)
+{
+#if (DATARATE_ENABLE)
+    datarate_can_frames++;
+#endif /* DATARATE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: datarate_can_on_tx
+********************************************************************************
+* Summary:
+* Counts a frame handed to the controller. Called by the main loop; the
+* counter is shared with the RX interrupt.
+*
+*******************************************************************************/
+void datarate_can_on_tx(void)
+{
+#if (DATARATE_ENABLE)
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    datarate_can_frames++;
+    __set_PRIMASK(primask);
+#endif /* DATARATE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: datarate_can_on_error
+********************************************************************************
+* Summary:
+* Counts a data phase protocol error, by the error code of the controller.
+* Called by the error callback of the channel.
+*
+* Parameters:
+*  errors       Interrupt status bits of the errors
+*
+*******************************************************************************/
+void datarate_can_on_error(uint32_t errors)
+{
+#if (DATARATE_ENABLE)
+    uint32_t dlec;
+
+    if (0U == (errors & CY_CANFD_PROTOCOL_ERROR_DATA_PHASE))
+    {
+        return;
+    }
+
+    /* Reading PSR resets the code to "no change" */
+    dlec = _FLD2VAL(CANFD_CH_M_TTCAN_PSR_DLEC,
+                    CANFD_PSR(datarate_can_base, datarate_can_chan));
+    datarate_can_dlec[dlec]++;
+    datarate_can_errors++;
+    STATS_INC(DATARATE_ERRORS);
+#else
+    CY_UNUSED_PARAMETER(errors);
+#endif /* DATARATE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: datarate_can_on_frame
+********************************************************************************
+* Summary:
+* Handles the coordination frames: commands on the nodes that follow, and
+* acknowledgments on the master.
+*
+* Parameters:
+*  frame        Received frame
+*  now_ms       Current time
+*
+*******************************************************************************/
+void datarate_can_on_frame(const canfd_frame_t *frame, uint32_t now_ms)
+{
+#if (DATARATE_ENABLE)
+    bool master = (DATARATE_CAN_MASTER_NODE == datarate_can_node);
+
+    if (!datarate_can_running)
+    {
+        return;
+    }
+
+    if ((DATARATE_CAN_COMMAND_ID == frame->id) && (!master) &&
+        (DATARATE_CAN_COMMAND_LEN == frame->len) &&
+        (frame->data[1] < (uint8_t)DATARATE_LEVEL_COUNT))
+    {
+        uint32_t delay_ms = (uint32_t)frame->data[2] |
+                            ((uint32_t)frame->data[3] << 8U);
+        datarate_level_t level = (datarate_level_t)frame->data[1];
+
+        if ((frame->data[0] == datarate_can_seq) &&
+            (level == (datarate_can_pending ? datarate_can_next :
+                                              datarate_can_level)))
+        {
+            return;
+        }
+        datarate_can_seq = frame->data[0];
+        datarate_can_next = level;
+        datarate_can_switch_ms = now_ms + delay_ms;
+        datarate_can_pending = true;
+    }
+    else if (master && (DATARATE_CAN_ACK_LEN == frame->len) &&
+             (frame->id > DATARATE_CAN_ACK_ID) &&
+             (frame->id <= (DATARATE_CAN_ACK_ID + DATARATE_CAN_NODE_MAX)))
+    {
+        datarate_can_acked[frame->id - DATARATE_CAN_ACK_ID - 1U] =
+            (int8_t)frame->data[1];
+
+        /* A node that is not where it should be gets the command again */
+        if ((frame->data[0] != datarate_can_seq) ||
+            (frame->data[1] != (uint8_t)datarate_can_level))
+        {
+            datarate_can_command_due = !datarate_can_pending;
+        }
+    }
+    else
+    {
+        /* Not a coordination frame for this node */
+    }
+#else
+    CY_UNUSED_PARAMETER(frame);
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* DATARATE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: datarate_can_poll
+********************************************************************************
+* Summary:
+* Passes the frames and errors counted since the last call to the
+* controller on the master, applies the change of setting when its time
+* has come, and sends the commands and acknowledgments. Re-applies the
+* setting after the channel was re-initialized, for example by network
+* management. Called by the main loop.
+*
+* Parameters:
+*  now_ms       Current time
+*
+*******************************************************************************/
+void datarate_can_poll(uint32_t now_ms)
+{
+#if (DATARATE_ENABLE)
+    bool master = (DATARATE_CAN_MASTER_NODE == datarate_can_node);
+    uint32_t frames = datarate_can_frames;
+    uint32_t errors = datarate_can_errors;
+    datarate_level_t next;
+
+    if (!datarate_can_running)
+    {
+        return;
+    }
+    datarate_can_now_ms = now_ms;
+
+    if ((CANFD_DBTP(datarate_can_base, datarate_can_chan) !=
+         datarate_can_dbtp) ||
+        ((CANFD_CCCR(datarate_can_base, datarate_can_chan) &
+          CANFD_CH_M_TTCAN_CCCR_BRSE_Msk) != datarate_can_cccr_brse))
+    {
+        datarate_can_apply(datarate_can_level);
+    }
+
+    /* Frames and errors around a change count for neither setting */
+    if (datarate_can_pending)
+    {
+        if ((int32_t)(now_ms - datarate_can_switch_ms) >= 0)
+        {
+            datarate_can_apply(datarate_can_next);
+            STATS_INC(DATARATE_CHANGES);
+            datarate_can_pending = false;
+            datarate_can_ack_due = !master;
+            datarate_set_level(datarate_can_next, now_ms);
+        }
+    }
+    else if (master)
+    {
+        datarate_count(frames - datarate_can_frames_seen,
+                       errors - datarate_can_errors_seen);
+        if (datarate_poll(now_ms, &next))
+        {
+            datarate_can_seq++;
+            datarate_can_next = next;
+            datarate_can_switch_ms = now_ms + DATARATE_SWITCH_MS;
+            datarate_can_pending = true;
+            datarate_can_command_due = true;
+        }
+    }
+    else
+    {
+        /* The master decides */
+    }
+    datarate_can_frames_seen = frames;
+    datarate_can_errors_seen = errors;
+
+    if (master)
+    {
+        if ((!datarate_can_command_due) &&
+            ((uint32_t)(now_ms - datarate_can_announce_ms) >=
+             DATARATE_ANNOUNCE_MS))
+        {
+            datarate_can_command_due = true;
+        }
+        if (datarate_can_command_due && datarate_can_send_command(now_ms))
+        {
+            datarate_can_command_due = false;
+            datarate_can_announce_ms = now_ms;
+        }
+    }
+    else if (datarate_can_ack_due && datarate_can_send_ack())
+    {
+        datarate_can_ack_due = false;
+    }
+    else
+    {
+        /* Nothing to send */
+    }
+#else
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* DATARATE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: datarate_can_report
+********************************************************************************
+* Summary:
+* Prints the setting, the decisions, the time per setting and the data
+* phase errors by type.
+*
+*******************************************************************************/
+void datarate_can_report(void)
+{
+#if (DATARATE_ENABLE)
+    datarate_stats_t stats;
+
+    if (!datarate_can_running)
+    {
+        return;
+    }
+
+    datarate_get_stats(&stats, datarate_can_now_ms);
+    printf("Data rate: %s, %lu switches; %lu frames, %lu data phase errors "
+           "in %lu windows\r\n", datarate_name(datarate_can_level),
+           (unsigned long)datarate_can_switches, (unsigned long)stats.frames,
+           (unsigned long)stats.errors, (unsigned long)stats.windows);
+    printf("  steps down %lu, tries up %lu (%lu failed), next try after "
+           "%lu ms clean\r\n", (unsigned long)stats.steps_down,
+           (unsigned long)stats.probes, (unsigned long)stats.probes_failed,
+           (unsigned long)stats.hold_ms);
+    printf("  time per setting:");
+    for (uint32_t level = 0U; level < (uint32_t)DATARATE_LEVEL_COUNT; level++)
+    {
+        printf(" %s %lu ms", datarate_name((datarate_level_t)level),
+               (unsigned long)stats.level_ms[level]);
+    }
+    printf("\r\n  errors by type:");
+    for (uint32_t dlec = DATARATE_CAN_DLEC_NONE + 1U;
+         dlec < DATARATE_CAN_DLEC_NO_CHANGE; dlec++)
+    {
+        printf(" %s %lu", datarate_can_dlec_names[dlec],
+               (unsigned long)datarate_can_dlec[dlec]);
+    }
+    printf("\r\n");
+
+    if (DATARATE_CAN_MASTER_NODE == datarate_can_node)
+    {
+        for (uint32_t idx = 0U; idx < DATARATE_CAN_NODE_MAX; idx++)
+        {
+            if (datarate_can_acked[idx] >= 0)
+            {
+                printf("  node %lu acknowledged %s\r\n",
+                       (unsigned long)(idx + 1U),
+                       datarate_name((datarate_level_t)
+                                     datarate_can_acked[idx]));
+            }
+        }
+    }
+#endif /* DATARATE_ENABLE */
+}
+
+/* [] END OF FILE */
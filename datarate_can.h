@@ -0,0 +1,104 @@
+/******************************************************************************
+* File Name:   datarate_can.h
+*
+* Description: This file contains the coordination of the data phase bit rate
+*              between the nodes and its setting in the CAN FD channel.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef DATARATE_CAN_H_
+#define DATARATE_CAN_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "canfd_frame.h"
+#include "datarate.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* The node that decides on the setting for all others */
+#ifndef DATARATE_CAN_MASTER_NODE
+#define DATARATE_CAN_MASTER_NODE    (1U)
+#endif
+
+/* Coordination frames, classic so that they get through whatever the data
+ * phase does. Command from the master: sequence number, setting and delay
+ * in ms (16 bits, little endian). Acknowledgment from the other nodes at
+ * DATARATE_CAN_ACK_ID + node number: sequence number and setting. Node
+ * numbers start at 1, so the acknowledgments take the IDs after the
+ * command, which shares the base on purpose. */
+#define DATARATE_CAN_COMMAND_ID     (0x0B0U)
+#define DATARATE_CAN_ACK_ID         (0x0B0U)
+#define DATARATE_CAN_COMMAND_LEN    (4U)
+#define DATARATE_CAN_ACK_LEN        (2U)
+
+/* Nodes whose acknowledgments are kept, from 1 */
+#define DATARATE_CAN_NODE_MAX       (8U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Sends a frame through the application TX buffer */
+typedef bool (*datarate_can_send_fn_t)(const canfd_frame_t *frame);
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void datarate_can_init(CANFD_Type *base, uint32_t chan,
+                       const cy_stc_canfd_config_t *config, uint8_t node,
+                       datarate_can_send_fn_t send, uint32_t now_ms);
+void datarate_can_on_rx(void);
+void datarate_can_on_tx(void);
+void datarate_can_on_error(uint32_t errors);
+void datarate_can_on_frame(const canfd_frame_t *frame, uint32_t now_ms);
+void datarate_can_poll(uint32_t now_ms);
+void datarate_can_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* DATARATE_CAN_H_ */
+
+/* [] END OF FILE */
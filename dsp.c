@@ -0,0 +1,514 @@
+/******************************************************************************
+* File Name:   dsp.c
+*
+* Description: This file contains the streaming FIR, decimation, biquad and
+*              scaling kernels on 16-bit samples, on the dual multiply-
+*              accumulate instructions of the Cortex-M33, with reference
+*              versions.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "dsp.h"
+
+#if (DSP_SIMD)
+#include "cmsis_compiler.h"
+#endif /* DSP_SIMD */
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#if (DSP_SIMD)
+/* Dual 16-bit multiply with 64-bit accumulate, dual multiply with add (and
+ * with the halves of y exchanged), pack of two low halves and dual
+ * saturating add */
+#define DSP_SMLALD(x, y, acc)   ((int64_t)__SMLALD((x), (y), (uint64_t)(acc)))
+#define DSP_SMUAD(x, y)         ((int32_t)__SMUAD((x), (y)))
+#define DSP_SMUADX(x, y)        ((int32_t)__SMUADX((x), (y)))
+#define DSP_PKHBT(lo, hi)       (__PKHBT((uint32_t)(lo), (uint32_t)(hi), 16))
+#define DSP_QADD16(x, y)        (__QADD16((x), (y)))
+#define DSP_SAT16(x)            ((int32_t)__SSAT((x), 16))
+#else
+#define DSP_SMLALD(x, y, acc)   (dsp_smlald((x), (y), (acc)))
+#define DSP_SMUAD(x, y)         (dsp_smuad((x), (y)))
+#define DSP_SMUADX(x, y)        (dsp_smuad((x), ((y) >> 16) | ((y) << 16)))
+#define DSP_PKHBT(lo, hi)       (((uint32_t)(lo) & 0xFFFFU) |                 \
+                                 ((uint32_t)(hi) << 16))
+#define DSP_QADD16(x, y)        (dsp_qadd16((x), (y)))
+#define DSP_SAT16(x)            (dsp_sat16(x))
+#endif /* DSP_SIMD */
+
+/* Low and high signed halves of a pair */
+#define DSP_LO(x)               ((int32_t)(int16_t)(x))
+#define DSP_HI(x)               ((int32_t)(int16_t)((x) >> 16))
+
+/*******************************************************************************
+* Function Name: dsp_sat16
+********************************************************************************
+* Summary:
+* Saturates a value to 16 bits.
+*
+*******************************************************************************/
+static inline int32_t dsp_sat16(int32_t value)
+{
+    return (value > INT16_MAX) ? INT16_MAX :
+           ((value < INT16_MIN) ? INT16_MIN : value);
+}
+
+/*******************************************************************************
+* Function Name: dsp_sat16_64
+********************************************************************************
+* Summary:
+* Saturates a 64-bit accumulator to 16 bits.
+*
+*******************************************************************************/
+static inline int32_t dsp_sat16_64(int64_t value)
+{
+    return (value > INT16_MAX) ? INT16_MAX :
+           ((value < INT16_MIN) ? INT16_MIN : (int32_t)value);
+}
+
+#if !(DSP_SIMD)
+/*******************************************************************************
+* Function Name: dsp_smlald
+********************************************************************************
+* Summary:
+* C version of SMLALD: acc + x.lo * y.lo + x.hi * y.hi.
+*
+*******************************************************************************/
+static inline int64_t dsp_smlald(uint32_t x, uint32_t y, int64_t acc)
+{
+    return acc + ((int64_t)DSP_LO(x) * DSP_LO(y)) +
+           ((int64_t)DSP_HI(x) * DSP_HI(y));
+}
+
+/*******************************************************************************
+* Function Name: dsp_smuad
+********************************************************************************
+* Summary:
+* C version of SMUAD: x.lo * y.lo + x.hi * y.hi.
+*
+*******************************************************************************/
+static inline int32_t dsp_smuad(uint32_t x, uint32_t y)
+{
+    return (DSP_LO(x) * DSP_LO(y)) + (DSP_HI(x) * DSP_HI(y));
+}
+
+/*******************************************************************************
+* Function Name: dsp_qadd16
+********************************************************************************
+* Summary:
+* C version of QADD16: both halves added with saturation.
+*
+*******************************************************************************/
+static inline uint32_t dsp_qadd16(uint32_t x, uint32_t y)
+{
+    return DSP_PKHBT(dsp_sat16(DSP_LO(x) + DSP_LO(y)),
+                     dsp_sat16(DSP_HI(x) + DSP_HI(y)));
+}
+#endif /* !DSP_SIMD */
+
+/*******************************************************************************
+* Function Name: dsp_read_pair
+********************************************************************************
+* Summary:
+* Reads two samples as one word, the first in the low half. The Cortex-M33
+* reads words at any 16-bit alignment in one load.
+*
+*******************************************************************************/
+static inline uint32_t dsp_read_pair(const int16_t *data)
+{
+    uint32_t pair;
+
+    memcpy(&pair, data, sizeof(pair));
+    return pair;
+}
+
+/*******************************************************************************
+* Function Name: dsp_write_pair
+********************************************************************************
+* Summary:
+* Writes two samples from one word, the first from the low half.
+*
+*******************************************************************************/
+static inline void dsp_write_pair(int16_t *data, uint32_t pair)
+{
+    memcpy(data, &pair, sizeof(pair));
+}
+
+/*******************************************************************************
+* Function Name: dsp_fir_init
+********************************************************************************
+* Summary:
+* Sets up a FIR filter and clears its history.
+*
+* Parameters:
+*  fir          Filter
+*  coeffs       Coefficients b[0] to b[taps - 1], Q15
+*  taps         Number of coefficients, at most DSP_FIR_TAPS_MAX
+*  decimation   Inputs per output, 1 for none
+*
+* Return:
+*  false if taps or decimation is out of range
+*
+*******************************************************************************/
+bool dsp_fir_init(dsp_fir_t *fir, const int16_t *coeffs, uint32_t taps,
+                  uint32_t decimation)
+{
+    if ((0U == taps) || (taps > DSP_FIR_TAPS_MAX) || (0U == decimation))
+    {
+        return false;
+    }
+
+    memset(fir, 0, sizeof(*fir));
+    fir->taps = (taps + 1U) & ~1UL;
+    fir->decimation = decimation;
+
+    /* Newest sample last in the history, so b[0] goes last too; the zero
+     * tap of an odd filter comes first */
+    for (uint32_t idx = 0U; idx < taps; idx++)
+    {
+        fir->coeffs[fir->taps - 1U - idx] = coeffs[idx];
+    }
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: dsp_fir_reset
+********************************************************************************
+* Summary:
+* Clears the history of a FIR filter, as after a gap in the samples.
+*
+*******************************************************************************/
+void dsp_fir_reset(dsp_fir_t *fir)
+{
+    memset(fir->state, 0, sizeof(fir->state));
+    fir->phase = 0U;
+}
+
+/*******************************************************************************
+* Function Name: dsp_fir_q15
+********************************************************************************
+* Summary:
+* Filters a block of samples with one dual multiply-accumulate per two
+* taps. The accumulator has 64 bits, so no sum overflows before the final
+* saturation.
+*
+* Parameters:
+*  fir          Filter
+*  in           Input samples
+*  out          Output samples, count / decimation of them, rounded up or
+*               down by the phase; may not be in
+*  count        Number of inputs, at most DSP_BLOCK_MAX
+*
+* Return:
+*  Number of outputs written
+*
+*******************************************************************************/
+uint32_t dsp_fir_q15(dsp_fir_t *fir, const int16_t *in, int16_t *out,
+                     uint32_t count)
+{
+    uint32_t history = fir->taps - 1U;
+    uint32_t written = 0U;
+    uint32_t idx;
+
+    if (count > DSP_BLOCK_MAX)
+    {
+        return 0U;
+    }
+    memcpy(&fir->state[history], in, count * sizeof(int16_t));
+
+    for (idx = fir->phase; idx < count; idx += fir->decimation)
+    {
+        const int16_t *samples = &fir->state[idx];
+        int64_t acc = 0;
+
+        for (uint32_t tap = 0U; tap < fir->taps; tap += 2U)
+        {
+            acc = DSP_SMLALD(dsp_read_pair(&fir->coeffs[tap]),
+                             dsp_read_pair(&samples[tap]), acc);
+        }
+        out[written] = (int16_t)dsp_sat16_64(acc >> 15);
+        written++;
+    }
+    fir->phase = idx - count;
+
+    memmove(fir->state, &fir->state[count], history * sizeof(int16_t));
+    return written;
+}
+
+/*******************************************************************************
+* Function Name: dsp_fir_q15_ref
+********************************************************************************
+* Summary:
+* Filters a block of samples one tap at a time: the reference for
+* dsp_fir_q15(), with the same parameters and results.
+*
+*******************************************************************************/
+uint32_t dsp_fir_q15_ref(dsp_fir_t *fir, const int16_t *in, int16_t *out,
+                         uint32_t count)
+{
+    uint32_t history = fir->taps - 1U;
+    uint32_t written = 0U;
+    uint32_t idx;
+
+    if (count > DSP_BLOCK_MAX)
+    {
+        return 0U;
+    }
+    for (idx = 0U; idx < count; idx++)
+    {
+        fir->state[history + idx] = in[idx];
+    }
+
+    for (idx = fir->phase; idx < count; idx += fir->decimation)
+    {
+        int64_t acc = 0;
+
+        for (uint32_t tap = 0U; tap < fir->taps; tap++)
+        {
+            acc += (int64_t)fir->coeffs[tap] * fir->state[idx + tap];
+        }
+        out[written] = (int16_t)dsp_sat16_64(acc >> 15);
+        written++;
+    }
+    fir->phase = idx - count;
+
+    for (idx = 0U; idx < history; idx++)
+    {
+        fir->state[idx] = fir->state[count + idx];
+    }
+    return written;
+}
+
+/*******************************************************************************
+* Function Name: dsp_biquad_init
+********************************************************************************
+* Summary:
+* Sets up a cascade of biquad sections and clears its history.
+*
+* Parameters:
+*  biquad       Cascade
+*  coeffs       Coefficients of each section, Q14
+*  stages       Number of sections, at most DSP_BIQUAD_STAGES_MAX
+*
+* Return:
+*  false if stages is out of range
+*
+*******************************************************************************/
+bool dsp_biquad_init(dsp_biquad_t *biquad, const dsp_biquad_coeffs_t *coeffs,
+                     uint32_t stages)
+{
+    if ((0U == stages) || (stages > DSP_BIQUAD_STAGES_MAX))
+    {
+        return false;
+    }
+
+    memset(biquad, 0, sizeof(*biquad));
+    biquad->stages = stages;
+    memcpy(biquad->coeffs, coeffs, stages * sizeof(coeffs[0]));
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: dsp_biquad_reset
+********************************************************************************
+* Summary:
+* Clears the history of a cascade, as after a gap in the samples.
+*
+*******************************************************************************/
+void dsp_biquad_reset(dsp_biquad_t *biquad)
+{
+    memset(biquad->state, 0, sizeof(biquad->state));
+}
+
+/*******************************************************************************
+* Function Name: dsp_biquad_q15
+********************************************************************************
+* Summary:
+* Filters a block of samples through the cascade, one section at a time
+* over the block. Per sample, two dual multiply-accumulates take b0 x and
+* b1 x[n-1], then b2 x[n-2] and a1 y[n-1], and one single one a2 y[n-2].
+*
+* Parameters:
+*  biquad       Cascade
+*  in           Input samples
+*  out          Output samples; may be in
+*  count        Number of samples
+*
+*******************************************************************************/
+void dsp_biquad_q15(dsp_biquad_t *biquad, const int16_t *in, int16_t *out,
+                    uint32_t count)
+{
+    const int16_t *src = in;
+
+    for (uint32_t stage = 0U; stage < biquad->stages; stage++)
+    {
+        const dsp_biquad_coeffs_t *coeffs = &biquad->coeffs[stage];
+        int16_t *state = biquad->state[stage];
+        uint32_t b0b1 = DSP_PKHBT(coeffs->b0, coeffs->b1);
+        uint32_t b2a1 = DSP_PKHBT(coeffs->b2, coeffs->a1);
+        int32_t a2 = coeffs->a2;
+        int32_t x1 = state[0];
+        int32_t x2 = state[1];
+        int32_t y1 = state[2];
+        int32_t y2 = state[3];
+
+        for (uint32_t idx = 0U; idx < count; idx++)
+        {
+            int32_t x0 = src[idx];
+            int64_t acc;
+
+            acc = DSP_SMLALD(b0b1, DSP_PKHBT(x0, x1), (int64_t)a2 * y2);
+            acc = DSP_SMLALD(b2a1, DSP_PKHBT(x2, y1), acc);
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = dsp_sat16_64(acc >> DSP_BIQUAD_Q);
+            out[idx] = (int16_t)y1;
+        }
+
+        state[0] = (int16_t)x1;
+        state[1] = (int16_t)x2;
+        state[2] = (int16_t)y1;
+        state[3] = (int16_t)y2;
+        src = out;
+    }
+}
+
+/*******************************************************************************
+* Function Name: dsp_biquad_q15_ref
+********************************************************************************
+* Summary:
+* Filters a block of samples through the cascade one product at a time: the
+* reference for dsp_biquad_q15(), with the same parameters and results.
+*
+*******************************************************************************/
+void dsp_biquad_q15_ref(dsp_biquad_t *biquad, const int16_t *in, int16_t *out,
+                        uint32_t count)
+{
+    const int16_t *src = in;
+
+    for (uint32_t stage = 0U; stage < biquad->stages; stage++)
+    {
+        const dsp_biquad_coeffs_t *coeffs = &biquad->coeffs[stage];
+        int16_t *state = biquad->state[stage];
+
+        for (uint32_t idx = 0U; idx < count; idx++)
+        {
+            int16_t x0 = src[idx];
+            int64_t acc = ((int64_t)coeffs->b0 * x0) +
+                          ((int64_t)coeffs->b1 * state[0]) +
+                          ((int64_t)coeffs->b2 * state[1]) +
+                          ((int64_t)coeffs->a1 * state[2]) +
+                          ((int64_t)coeffs->a2 * state[3]);
+
+            state[1] = state[0];
+            state[0] = x0;
+            state[3] = state[2];
+            state[2] = (int16_t)dsp_sat16_64(acc >> DSP_BIQUAD_Q);
+            out[idx] = state[2];
+        }
+        src = out;
+    }
+}
+
+/*******************************************************************************
+* Function Name: dsp_scale_q15
+********************************************************************************
+* Summary:
+* Scales a block of samples two at a time: each sample times the gain,
+* shifted, saturated, then plus the offset with saturation.
+*
+* Parameters:
+*  in           Input samples
+*  out          Output samples; may be in
+*  count        Number of samples
+*  gain         Gain, Q15
+*  shift        Left shift of the product, 0 to 15, for gains up to 2^shift
+*  offset       Added after the gain
+*
+*******************************************************************************/
+void dsp_scale_q15(const int16_t *in, int16_t *out, uint32_t count,
+                   int16_t gain, uint32_t shift, int16_t offset)
+{
+    uint32_t gain_lo = DSP_PKHBT(gain, 0);
+    uint32_t offsets = DSP_PKHBT(offset, offset);
+    uint32_t right = 15U - shift;
+    uint32_t idx;
+
+    for (idx = 0U; (idx + 1U) < count; idx += 2U)
+    {
+        uint32_t pair = dsp_read_pair(&in[idx]);
+        int32_t lo = DSP_SMUAD(pair, gain_lo) >> right;
+        int32_t hi = DSP_SMUADX(pair, gain_lo) >> right;
+
+        dsp_write_pair(&out[idx], DSP_QADD16(DSP_PKHBT(DSP_SAT16(lo),
+                                                       DSP_SAT16(hi)),
+                                             offsets));
+    }
+    if (idx < count)
+    {
+        dsp_scale_q15_ref(&in[idx], &out[idx], 1U, gain, shift, offset);
+    }
+}
+
+/*******************************************************************************
+* Function Name: dsp_scale_q15_ref
+********************************************************************************
+* Summary:
+* Scales a block of samples one at a time: the reference for
+* dsp_scale_q15(), with the same parameters and results.
+*
+*******************************************************************************/
+void dsp_scale_q15_ref(const int16_t *in, int16_t *out, uint32_t count,
+                       int16_t gain, uint32_t shift, int16_t offset)
+{
+    for (uint32_t idx = 0U; idx < count; idx++)
+    {
+        int32_t value = dsp_sat16(((int32_t)in[idx] * gain) >>
+                                  (15U - shift));
+
+        out[idx] = (int16_t)dsp_sat16(value + offset);
+    }
+}
+
+/* [] END OF FILE */
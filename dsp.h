@@ -0,0 +1,158 @@
+/******************************************************************************
+* File Name:   dsp.h
+*
+* Description: This file contains the streaming FIR, decimation, biquad and
+*              scaling kernels on 16-bit samples, on the dual multiply-
+*              accumulate instructions of the Cortex-M33, with reference
+*              versions.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef DSP_H_
+#define DSP_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* Only the C library, so that host/ can build the simulator */
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make DSP_ENABLE=1") to filter the sample
+ * blocks of DSP_CAN_ID on reception (see dsp_can.h) */
+#ifndef DSP_ENABLE
+#define DSP_ENABLE              (0)
+#endif
+
+/* 1 to build the kernels on the dual 16-bit multiply-accumulate
+ * instructions of the DSP extension, 0 to build them on C versions of these
+ * instructions, as on the host. Either way the results are the same as
+ * those of the _ref kernels, bit for bit. */
+#ifndef DSP_SIMD
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define DSP_SIMD                (1)
+#else
+#define DSP_SIMD                (0)
+#endif
+#endif
+
+/* Most samples per call of a kernel: the 16-bit samples of a 64-byte
+ * payload */
+#define DSP_BLOCK_MAX           (32U)
+
+/* Most FIR taps, and biquad stages per cascade */
+#define DSP_FIR_TAPS_MAX        (32U)
+#define DSP_BIQUAD_STAGES_MAX   (4U)
+
+/* Fraction bits of the biquad coefficients, which may reach 2 */
+#define DSP_BIQUAD_Q            (14U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* FIR filter with decimation, Q15 coefficients and samples. An output is
+ * sum(b[k] * x[n - k]) >> 15, saturated to 16 bits, computed for every
+ * decimation-th input. */
+typedef struct
+{
+    uint32_t taps;              /* Even; an odd filter gets a zero tap */
+    uint32_t decimation;        /* 1 for no decimation */
+    uint32_t phase;             /* Input of the next output in the block */
+    int16_t  coeffs[DSP_FIR_TAPS_MAX];  /* In reverse order, b[taps - 1]
+                                         * first */
+    int16_t  state[(DSP_FIR_TAPS_MAX - 1U) + DSP_BLOCK_MAX];
+} dsp_fir_t;
+
+/* Biquad section, Q14: y = b0 x + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] +
+ * a2 y[n-2]. The feedback coefficients have the sign of this sum, the
+ * opposite of the usual transfer function denominator. */
+typedef struct
+{
+    int16_t b0;
+    int16_t b1;
+    int16_t b2;
+    int16_t a1;
+    int16_t a2;
+} dsp_biquad_coeffs_t;
+
+/* Cascade of biquad sections, direct form I */
+typedef struct
+{
+    uint32_t            stages;
+    dsp_biquad_coeffs_t coeffs[DSP_BIQUAD_STAGES_MAX];
+    int16_t             state[DSP_BIQUAD_STAGES_MAX][4];    /* x1 x2 y1 y2 */
+} dsp_biquad_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+bool     dsp_fir_init(dsp_fir_t *fir, const int16_t *coeffs, uint32_t taps,
+                      uint32_t decimation);
+void     dsp_fir_reset(dsp_fir_t *fir);
+uint32_t dsp_fir_q15(dsp_fir_t *fir, const int16_t *in, int16_t *out,
+                     uint32_t count);
+uint32_t dsp_fir_q15_ref(dsp_fir_t *fir, const int16_t *in, int16_t *out,
+                         uint32_t count);
+
+bool     dsp_biquad_init(dsp_biquad_t *biquad,
+                         const dsp_biquad_coeffs_t *coeffs, uint32_t stages);
+void     dsp_biquad_reset(dsp_biquad_t *biquad);
+void     dsp_biquad_q15(dsp_biquad_t *biquad, const int16_t *in, int16_t *out,
+                        uint32_t count);
+void     dsp_biquad_q15_ref(dsp_biquad_t *biquad, const int16_t *in,
+                            int16_t *out, uint32_t count);
+
+void     dsp_scale_q15(const int16_t *in, int16_t *out, uint32_t count,
+                       int16_t gain, uint32_t shift, int16_t offset);
+void     dsp_scale_q15_ref(const int16_t *in, int16_t *out, uint32_t count,
+                           int16_t gain, uint32_t shift, int16_t offset);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* DSP_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,464 @@
+/******************************************************************************
+* File Name:   dsp_can.c
+*
+* Description: This file contains the filter chain run on received sample
+*              blocks, and the demo signal that one node sends.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "dsp_can.h"
+#include "cycle_counter.h"
+#include "stats.h"
+
+#if (DSP_ENABLE)
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Tones of the demo signal and their amplitudes */
+#define DSP_CAN_TONE_LOW_HZ     (50.0f)
+#define DSP_CAN_TONE_HIGH_HZ    (1500.0f)
+#define DSP_CAN_AMPLITUDE_LOW   (12000.0f)
+#define DSP_CAN_AMPLITUDE_HIGH  (6000.0f)
+#define DSP_CAN_NOISE           (512U)
+
+/* Blocks the source sends at most to catch up; it skips the rest */
+#define DSP_CAN_CATCH_UP        (8U)
+
+#define DSP_CAN_PI              (3.14159265f)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Sine oscillator: a point turned by a fixed angle per sample */
+typedef struct
+{
+    float re;
+    float im;
+    float amplitude;
+    float cos_step;
+    float sin_step;
+} dsp_can_tone_t;
+
+typedef struct
+{
+    uint64_t cycles;
+    uint32_t samples;           /* Input samples */
+} dsp_can_kernel_stats_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const int16_t dsp_can_fir_coeffs[DSP_CAN_FIR_TAPS] =
+    DSP_CAN_FIR_COEFFS;
+static const dsp_biquad_coeffs_t dsp_can_biquad_coeffs[DSP_CAN_BIQUAD_STAGES] =
+    DSP_CAN_BIQUAD_COEFFS;
+
+#define DSP_CAN_KERNEL_NAME(id, name)   name,
+static const char *const dsp_can_kernel_names[DSP_CAN_KERNEL_COUNT] =
+{
+    DSP_CAN_KERNEL_LIST(DSP_CAN_KERNEL_NAME)
+};
+#undef DSP_CAN_KERNEL_NAME
+
+static dsp_can_send_fn_t       dsp_can_send;
+static bool                    dsp_can_source;
+static bool                    dsp_can_running;
+
+/* Source: time of the first sample, samples sent, skipped, next sequence
+ * number */
+static dsp_can_tone_t          dsp_can_tones[2];
+static uint32_t                dsp_can_start_ms;
+static uint64_t                dsp_can_sent;
+static uint32_t                dsp_can_skipped;
+static uint32_t                dsp_can_noise_seed = 1U;
+static uint8_t                 dsp_can_tx_seq;
+
+/* Receiver: filter states, statistics */
+static dsp_fir_t               dsp_can_fir;
+static dsp_biquad_t            dsp_can_biquad;
+static dsp_can_kernel_stats_t  dsp_can_stats[DSP_CAN_KERNEL_COUNT];
+static uint8_t                 dsp_can_rx_seq;
+static uint32_t                dsp_can_blocks;
+static uint32_t                dsp_can_gaps;
+static uint32_t                dsp_can_outputs;
+static int16_t                 dsp_can_out_min;
+static int16_t                 dsp_can_out_max;
+static uint32_t                dsp_can_first_ms;
+static uint32_t                dsp_can_now_ms;
+
+/*******************************************************************************
+* Function Name: dsp_can_tone_init
+********************************************************************************
+* Summary:
+* Starts an oscillator at a frequency and amplitude.
+*
+*******************************************************************************/
+static void dsp_can_tone_init(dsp_can_tone_t *tone, float hz, float amplitude)
+{
+    float step = 2.0f * DSP_CAN_PI * hz / (float)DSP_CAN_SAMPLE_HZ;
+
+    tone->re = amplitude;
+    tone->im = 0.0f;
+    tone->amplitude = amplitude;
+    tone->cos_step = cosf(step);
+    tone->sin_step = sinf(step);
+}
+
+/*******************************************************************************
+* Function Name: dsp_can_tone_next
+********************************************************************************
+* Summary:
+* Returns the next sample of an oscillator.
+*
+*******************************************************************************/
+static float dsp_can_tone_next(dsp_can_tone_t *tone)
+{
+    float re = (tone->re * tone->cos_step) - (tone->im * tone->sin_step);
+
+    tone->im = (tone->re * tone->sin_step) + (tone->im * tone->cos_step);
+    tone->re = re;
+    return tone->im;
+}
+
+/*******************************************************************************
+* Function Name: dsp_can_send_block
+********************************************************************************
+* Summary:
+* Sends the next block of the demo signal. The oscillators only advance
+* once the block is out, so a block the TX buffer cannot take is sent again.
+*
+*******************************************************************************/
+static bool dsp_can_send_block(void)
+{
+    canfd_frame_t frame;
+    dsp_can_tone_t tones[2];
+    uint32_t seed = dsp_can_noise_seed;
+
+    memcpy(tones, dsp_can_tones, sizeof(tones));
+    memset(&frame, 0, sizeof(frame));
+    frame.id = DSP_CAN_ID;
+    frame.len = CANFD_MAX_DATA_LEN;
+    frame.flags = CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS;
+    frame.data[0] = dsp_can_tx_seq;
+
+    for (uint32_t idx = 0U; idx < DSP_CAN_SAMPLES; idx++)
+    {
+        int32_t sample;
+
+        seed = (seed * 1664525U) + 1013904223U;
+        sample = (int32_t)lroundf(dsp_can_tone_next(&tones[0]) +
+                                  dsp_can_tone_next(&tones[1])) +
+                 (int32_t)((seed >> 16) % (2U * DSP_CAN_NOISE)) -
+                 (int32_t)DSP_CAN_NOISE;
+        frame.data[DSP_CAN_HEADER_LEN + (2U * idx)] = (uint8_t)sample;
+        frame.data[DSP_CAN_HEADER_LEN + (2U * idx) + 1U] =
+            (uint8_t)((uint32_t)sample >> 8U);
+    }
+
+    if (!dsp_can_send(&frame))
+    {
+        return false;
+    }
+
+    /* Undo the rounding drift of the amplitudes once per block */
+    for (uint32_t idx = 0U; idx < 2U; idx++)
+    {
+        float gain = tones[idx].amplitude /
+                     sqrtf((tones[idx].re * tones[idx].re) +
+                           (tones[idx].im * tones[idx].im));
+
+        tones[idx].re *= gain;
+        tones[idx].im *= gain;
+    }
+    memcpy(dsp_can_tones, tones, sizeof(tones));
+    dsp_can_noise_seed = seed;
+    dsp_can_tx_seq++;
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: dsp_can_run
+********************************************************************************
+* Summary:
+* Runs one kernel of the chain and adds its cycles to its statistics.
+*
+*******************************************************************************/
+static uint32_t dsp_can_run(dsp_can_kernel_t kernel, int16_t *samples,
+                            uint32_t count)
+{
+    uint32_t start = cycle_counter_get();
+    uint32_t out = count;
+
+    switch (kernel)
+    {
+        case DSP_CAN_KERNEL_FIR:
+            out = dsp_fir_q15(&dsp_can_fir, samples, samples, count);
+            break;
+        case DSP_CAN_KERNEL_BIQUAD:
+            dsp_biquad_q15(&dsp_can_biquad, samples, samples, count);
+            break;
+        default:
+            dsp_scale_q15(samples, samples, count, DSP_CAN_GAIN,
+                          DSP_CAN_SHIFT, DSP_CAN_OFFSET);
+            break;
+    }
+
+    dsp_can_stats[kernel].cycles += cycle_counter_get() - start;
+    dsp_can_stats[kernel].samples += count;
+    return out;
+}
+#endif /* DSP_ENABLE */
+
+/*******************************************************************************
+* Function Name: dsp_can_init
+********************************************************************************
+* Summary:
+* Sets up the receive chain, and on DSP_CAN_SOURCE_NODE the demo signal.
+*
+* Parameters:
+*  node         Node number
+*  send         Sends a frame through the application TX buffer
+*  now_ms       Current time
+*
+*******************************************************************************/
+void dsp_can_init(uint8_t node, dsp_can_send_fn_t send, uint32_t now_ms)
+{
+#if (DSP_ENABLE)
+    (void)dsp_fir_init(&dsp_can_fir, dsp_can_fir_coeffs, DSP_CAN_FIR_TAPS,
+                       DSP_CAN_DECIMATION);
+    (void)dsp_biquad_init(&dsp_can_biquad, dsp_can_biquad_coeffs,
+                          DSP_CAN_BIQUAD_STAGES);
+    dsp_can_out_min = INT16_MAX;
+    dsp_can_out_max = INT16_MIN;
+
+    dsp_can_send = send;
+    dsp_can_source = (DSP_CAN_SOURCE_NODE == node);
+    if (dsp_can_source)
+    {
+        dsp_can_tone_init(&dsp_can_tones[0], DSP_CAN_TONE_LOW_HZ,
+                          DSP_CAN_AMPLITUDE_LOW);
+        dsp_can_tone_init(&dsp_can_tones[1], DSP_CAN_TONE_HIGH_HZ,
+                          DSP_CAN_AMPLITUDE_HIGH);
+        dsp_can_start_ms = now_ms;
+    }
+    dsp_can_running = true;
+#else
+    CY_UNUSED_PARAMETER(node);
+    CY_UNUSED_PARAMETER(send);
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* DSP_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: dsp_can_on_frame
+********************************************************************************
+* Summary:
+* Runs the samples of a block through the FIR filter and decimation, the
+* biquad cascade and the scaling, in place, and timing each kernel. A
+* missed block clears the filter histories.
+*
+* Parameters:
+*  frame        Received frame
+*
+*******************************************************************************/
+void dsp_can_on_frame(const canfd_frame_t *frame)
+{
+#if (DSP_ENABLE)
+    int16_t samples[DSP_BLOCK_MAX];
+    uint32_t count;
+
+    if ((!dsp_can_running) || (DSP_CAN_ID != frame->id) ||
+        (frame->len <= DSP_CAN_HEADER_LEN))
+    {
+        return;
+    }
+
+    if ((0U != dsp_can_blocks) && (frame->data[0] != dsp_can_rx_seq))
+    {
+        dsp_fir_reset(&dsp_can_fir);
+        dsp_biquad_reset(&dsp_can_biquad);
+        dsp_can_gaps++;
+        STATS_INC(DSP_GAPS);
+    }
+    if (0U == dsp_can_blocks)
+    {
+        dsp_can_first_ms = dsp_can_now_ms;
+    }
+    dsp_can_rx_seq = (uint8_t)(frame->data[0] + 1U);
+    dsp_can_blocks++;
+
+    count = (frame->len - DSP_CAN_HEADER_LEN) / 2U;
+    for (uint32_t idx = 0U; idx < count; idx++)
+    {
+        samples[idx] = (int16_t)((uint32_t)frame->data[DSP_CAN_HEADER_LEN +
+                                                       (2U * idx)] |
+                                 ((uint32_t)frame->data[DSP_CAN_HEADER_LEN +
+                                                        (2U * idx) + 1U]
+                                  << 8U));
+    }
+
+    count = dsp_can_run(DSP_CAN_KERNEL_FIR, samples, count);
+    if (0U == count)
+    {
+        return;
+    }
+    (void)dsp_can_run(DSP_CAN_KERNEL_BIQUAD, samples, count);
+    (void)dsp_can_run(DSP_CAN_KERNEL_SCALE, samples, count);
+
+    for (uint32_t idx = 0U; idx < count; idx++)
+    {
+        dsp_can_out_min = (samples[idx] < dsp_can_out_min) ?
+                          samples[idx] : dsp_can_out_min;
+        dsp_can_out_max = (samples[idx] > dsp_can_out_max) ?
+                          samples[idx] : dsp_can_out_max;
+    }
+    dsp_can_outputs += count;
+#else
+    CY_UNUSED_PARAMETER(frame);
+#endif /* DSP_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: dsp_can_poll
+********************************************************************************
+* Summary:
+* On the source, sends the blocks of the demo signal that are due. After a
+* stall it sends at most DSP_CAN_CATCH_UP blocks and skips the rest.
+* Called by the main loop.
+*
+* Parameters:
+*  now_ms       Current time
+*
+*******************************************************************************/
+void dsp_can_poll(uint32_t now_ms)
+{
+#if (DSP_ENABLE)
+    uint64_t due;
+
+    dsp_can_now_ms = now_ms;
+    if ((!dsp_can_running) || (!dsp_can_source))
+    {
+        return;
+    }
+
+    due = ((uint64_t)(uint32_t)(now_ms - dsp_can_start_ms) *
+           DSP_CAN_SAMPLE_HZ) / 1000U;
+    if (due > (dsp_can_sent + ((uint64_t)DSP_CAN_CATCH_UP * DSP_CAN_SAMPLES)))
+    {
+        uint64_t skip = (due - dsp_can_sent) / DSP_CAN_SAMPLES;
+
+        skip -= DSP_CAN_CATCH_UP;
+        dsp_can_sent += skip * DSP_CAN_SAMPLES;
+        dsp_can_skipped += (uint32_t)skip;
+        STATS_ADD(DSP_SKIPPED, (uint32_t)skip);
+    }
+    while (((dsp_can_sent + DSP_CAN_SAMPLES) <= due) && dsp_can_send_block())
+    {
+        dsp_can_sent += DSP_CAN_SAMPLES;
+    }
+#else
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* DSP_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: dsp_can_report
+********************************************************************************
+* Summary:
+* Prints the blocks sent, or the blocks received with the range of the
+* filtered signal, the input rate and, per kernel, the cycles per input
+* sample and the samples per second the CPU could run through it.
+*
+*******************************************************************************/
+void dsp_can_report(void)
+{
+#if (DSP_ENABLE)
+    uint32_t elapsed_ms = dsp_can_now_ms - dsp_can_first_ms;
+    uint32_t rate = 0U;
+
+    if (!dsp_can_running)
+    {
+        return;
+    }
+
+    if (dsp_can_source)
+    {
+        printf("DSP: sent %lu blocks of %u samples at %u Hz, %lu skipped\r\n",
+               (unsigned long)(dsp_can_sent / DSP_CAN_SAMPLES),
+               (unsigned)DSP_CAN_SAMPLES, (unsigned)DSP_CAN_SAMPLE_HZ,
+               (unsigned long)dsp_can_skipped);
+        return;
+    }
+
+    if (0U != elapsed_ms)
+    {
+        rate = (uint32_t)(((uint64_t)dsp_can_stats[DSP_CAN_KERNEL_FIR].samples *
+                           1000U) / elapsed_ms);
+    }
+    printf("DSP: %lu blocks, %lu gaps, %lu samples/s in; %lu outputs from "
+           "%d to %d (%s kernels)\r\n", (unsigned long)dsp_can_blocks,
+           (unsigned long)dsp_can_gaps, (unsigned long)rate,
+           (unsigned long)dsp_can_outputs, (int)dsp_can_out_min,
+           (int)dsp_can_out_max, (DSP_SIMD) ? "SIMD" : "C");
+    for (uint32_t kernel = 0U; kernel < DSP_CAN_KERNEL_COUNT; kernel++)
+    {
+        const dsp_can_kernel_stats_t *stats = &dsp_can_stats[kernel];
+        uint32_t centi;
+
+        if ((0U == stats->samples) || (0U == stats->cycles))
+        {
+            continue;
+        }
+        /* Cycles per sample in hundredths */
+        centi = (uint32_t)((stats->cycles * 100U) / stats->samples);
+        printf("  %-13s %lu.%02lu cycles/sample, %lu ksamples/s\r\n",
+               dsp_can_kernel_names[kernel], (unsigned long)(centi / 100U),
+               (unsigned long)(centi % 100U),
+               (unsigned long)(((uint64_t)SystemCoreClock * stats->samples) /
+                               (stats->cycles * 1000U)));
+    }
+#endif /* DSP_ENABLE */
+}
+
+/* [] END OF FILE */
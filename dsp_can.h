@@ -0,0 +1,132 @@
+/******************************************************************************
+* File Name:   dsp_can.h
+*
+* Description: This file contains the filter chain run on received sample
+*              blocks, and the demo signal that one node sends.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef DSP_CAN_H_
+#define DSP_CAN_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "canfd_frame.h"
+#include "dsp.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Sample block frames: sequence number, a pad byte, then up to
+ * DSP_CAN_SAMPLES 16-bit samples (little endian) */
+#define DSP_CAN_ID              (0x0D0U)
+#define DSP_CAN_HEADER_LEN      (2U)
+#define DSP_CAN_SAMPLES         ((CANFD_MAX_DATA_LEN - DSP_CAN_HEADER_LEN) / 2U)
+
+/* The node that sends the demo signal: a 50 Hz tone with a 1.5 kHz tone and
+ * noise on top, at DSP_CAN_SAMPLE_HZ. The other nodes filter it. */
+#ifndef DSP_CAN_SOURCE_NODE
+#define DSP_CAN_SOURCE_NODE     (1U)
+#endif
+#define DSP_CAN_SAMPLE_HZ       (8000U)
+
+/* Receive chain: 24-tap low-pass FIR at 400 Hz decimating by 4, then a
+ * 4th-order Butterworth low-pass at 100 Hz, then the scaling. The gain is
+ * Q15 with a left shift, 0.75 * 2 = 1.5 here. */
+#define DSP_CAN_DECIMATION      (4U)
+
+/* FIR coefficients for 8 kHz, Hamming window, Q15 */
+#define DSP_CAN_FIR_TAPS        (24U)
+#define DSP_CAN_FIR_COEFFS                                                     \
+{                                                                              \
+    -36, -17, 28, 139, 358, 707, 1185, 1760, 2368, 2930, 3363, 3599,           \
+    3599, 3363, 2930, 2368, 1760, 1185, 707, 358, 139, 28, -17, -36            \
+}
+
+/* Butterworth sections for 2 kHz, Q14 */
+#define DSP_CAN_BIQUAD_STAGES   (2U)
+#define DSP_CAN_BIQUAD_COEFFS                                                  \
+{                                                                              \
+    { 312, 624, 312, 24243, -9107 },                                           \
+    { 359, 717, 359, 27869, -12919 }                                           \
+}
+
+#define DSP_CAN_GAIN            (0x6000)
+#define DSP_CAN_SHIFT           (1U)
+#define DSP_CAN_OFFSET          (0)
+
+/* Kernels of the receive chain: X(identifier, name) */
+#define DSP_CAN_KERNEL_LIST(X)                                                 \
+    X(FIR,          "fir_decimate")                                            \
+    X(BIQUAD,       "biquad")                                                  \
+    X(SCALE,        "scale")
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+#define DSP_CAN_KERNEL_ENUM(id, name)   DSP_CAN_KERNEL_##id,
+typedef enum
+{
+    DSP_CAN_KERNEL_LIST(DSP_CAN_KERNEL_ENUM)
+    DSP_CAN_KERNEL_COUNT
+} dsp_can_kernel_t;
+#undef DSP_CAN_KERNEL_ENUM
+
+/* Sends a frame through the application TX buffer */
+typedef bool (*dsp_can_send_fn_t)(const canfd_frame_t *frame);
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void dsp_can_init(uint8_t node, dsp_can_send_fn_t send, uint32_t now_ms);
+void dsp_can_on_frame(const canfd_frame_t *frame);
+void dsp_can_poll(uint32_t now_ms);
+void dsp_can_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* DSP_CAN_H_ */
+
+/* [] END OF FILE */
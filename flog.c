@@ -0,0 +1,710 @@
+/******************************************************************************
+* File Name:   flog.c
+*
+* Description: This file contains the log-structured frame logger, which
+*              appends received frames to pages of external flash, recycles
+*              the oldest sector and finds records by timestamp.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "flog.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Page header fields */
+#define FLOG_HDR_MAGIC          (0U)
+#define FLOG_HDR_COUNT          (2U)
+#define FLOG_HDR_SEQ            (4U)
+#define FLOG_HDR_TS             (8U)
+#define FLOG_HDR_CRC            (12U)
+
+/* Record header fields */
+#define FLOG_REC_ID             (0U)
+#define FLOG_REC_DT             (4U)
+#define FLOG_REC_FLAGS          (6U)
+#define FLOG_REC_LEN            (7U)
+
+#define FLOG_ERASED_BYTE        (0xFFU)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef enum
+{
+    FLOG_PAGE_VALID,
+    FLOG_PAGE_ERASED,
+    FLOG_PAGE_TORN              /* Neither erased nor valid: power loss
+                                 * during program or erase */
+} flog_page_state_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const flog_flash_t *flog_flash;
+
+/* Write position: the page after the last one written */
+static uint32_t     flog_head_sector;
+static uint32_t     flog_head_page;
+static bool         flog_head_erase;    /* Head sector still to be erased */
+static uint32_t     flog_seq;           /* Sequence number of the next page */
+
+/* Sectors holding the log, from the oldest one to the head */
+static uint32_t     flog_oldest;
+static uint32_t     flog_used;
+
+/* Log time: milliseconds since start-up plus the time of the last record
+ * found by flog_mount() */
+static uint32_t     flog_ts_base;
+static uint32_t     flog_last_ts;
+
+/* Page being filled */
+static uint8_t      flog_page[FLOG_PAGE_SIZE];
+static bool         flog_page_open;
+static uint32_t     flog_page_len;
+static uint32_t     flog_page_count;
+static uint32_t     flog_page_ts;
+static uint32_t     flog_page_opened;   /* now_ms of its first record */
+
+static flog_stats_t flog_stats;
+
+/* CRC-32 (IEEE 802.3), four bits at a time */
+static const uint32_t flog_crc_table[16] =
+{
+    0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU,
+    0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+    0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU,
+    0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU
+};
+
+/*******************************************************************************
+* Function Name: flog_crc32
+********************************************************************************
+* Summary:
+* Continues a CRC-32 over a buffer. Start with 0xFFFFFFFF and invert the
+* result.
+*
+*******************************************************************************/
+static uint32_t flog_crc32(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    for (uint32_t idx = 0U; idx < len; idx++)
+    {
+        crc ^= data[idx];
+        crc = (crc >> 4U) ^ flog_crc_table[crc & 0x0FU];
+        crc = (crc >> 4U) ^ flog_crc_table[crc & 0x0FU];
+    }
+    return crc;
+}
+
+/*******************************************************************************
+* Function Name: flog_page_crc
+********************************************************************************
+* Summary:
+* CRC of a page, over everything but the CRC field.
+*
+*******************************************************************************/
+static uint32_t flog_page_crc(const uint8_t *page)
+{
+    uint32_t crc = flog_crc32(0xFFFFFFFFU, page, FLOG_HDR_CRC);
+
+    crc = flog_crc32(crc, &page[FLOG_HEADER_SIZE],
+                     FLOG_PAGE_SIZE - FLOG_HEADER_SIZE);
+    return ~crc;
+}
+
+/*******************************************************************************
+* Little-endian field access, independent of the host byte order
+*******************************************************************************/
+static void flog_put16(uint8_t *dst, uint32_t value)
+{
+    dst[0] = (uint8_t)value;
+    dst[1] = (uint8_t)(value >> 8U);
+}
+
+static void flog_put32(uint8_t *dst, uint32_t value)
+{
+    flog_put16(dst, value);
+    flog_put16(&dst[2], value >> 16U);
+}
+
+static uint32_t flog_get16(const uint8_t *src)
+{
+    return (uint32_t)src[0] | ((uint32_t)src[1] << 8U);
+}
+
+static uint32_t flog_get32(const uint8_t *src)
+{
+    return flog_get16(src) | (flog_get16(&src[2]) << 16U);
+}
+
+/*******************************************************************************
+* Function Name: flog_page_addr
+********************************************************************************
+* Summary:
+* Flash address of a page.
+*
+*******************************************************************************/
+static uint32_t flog_page_addr(uint32_t sector, uint32_t page)
+{
+    return (sector * FLOG_SECTOR_SIZE) + (page * FLOG_PAGE_SIZE);
+}
+
+/*******************************************************************************
+* Function Name: flog_page_check
+********************************************************************************
+* Summary:
+* Classifies a page read from flash.
+*
+*******************************************************************************/
+static flog_page_state_t flog_page_check(const uint8_t *page)
+{
+    if ((FLOG_PAGE_MAGIC == flog_get16(&page[FLOG_HDR_MAGIC])) &&
+        (flog_get32(&page[FLOG_HDR_CRC]) == flog_page_crc(page)))
+    {
+        return FLOG_PAGE_VALID;
+    }
+
+    for (uint32_t idx = 0U; idx < FLOG_PAGE_SIZE; idx++)
+    {
+        if (FLOG_ERASED_BYTE != page[idx])
+        {
+            return FLOG_PAGE_TORN;
+        }
+    }
+    return FLOG_PAGE_ERASED;
+}
+
+/*******************************************************************************
+* Function Name: flog_page_last_ts
+********************************************************************************
+* Summary:
+* Timestamp of the last record of a valid page.
+*
+*******************************************************************************/
+static uint32_t flog_page_last_ts(const uint8_t *page)
+{
+    uint32_t count = flog_get16(&page[FLOG_HDR_COUNT]);
+    uint32_t offset = FLOG_HEADER_SIZE;
+    uint32_t dt = 0U;
+
+    for (uint32_t idx = 0U; (idx < count) &&
+         ((offset + FLOG_RECORD_HEADER_SIZE) <= FLOG_PAGE_SIZE); idx++)
+    {
+        dt = flog_get16(&page[offset + FLOG_REC_DT]);
+        offset += FLOG_RECORD_HEADER_SIZE + page[offset + FLOG_REC_LEN];
+    }
+    return flog_get32(&page[FLOG_HDR_TS]) + dt;
+}
+
+/*******************************************************************************
+* Function Name: flog_mount
+********************************************************************************
+* Summary:
+* Finds the end of the log after a reset or power loss. The first page of
+* each sector gives the sector's place in the log; the newest sector is
+* then scanned for the first free page. Damaged pages, written while power
+* failed, are skipped and never rewritten before their sector is erased.
+* Reads one page per sector plus the pages of the newest sector.
+*
+* Parameters:
+*  flash        Flash holding the log
+*
+* Return:
+*  false if the flash could not be read
+*
+*******************************************************************************/
+bool flog_mount(const flog_flash_t *flash)
+{
+    bool found = false;
+    uint32_t newest = 0U;
+    uint32_t oldest = 0U;
+
+    flog_flash = NULL;
+    flog_page_open = false;
+    memset(&flog_stats, 0, sizeof(flog_stats));
+
+    for (uint32_t sector = 0U; sector < flash->sectors; sector++)
+    {
+        uint32_t seq;
+
+        if (!flash->read(flog_page_addr(sector, 0U), flog_page,
+                         FLOG_PAGE_SIZE))
+        {
+            return false;
+        }
+
+        switch (flog_page_check(flog_page))
+        {
+            case FLOG_PAGE_VALID:
+                seq = flog_get32(&flog_page[FLOG_HDR_SEQ]);
+                if (!found || ((int32_t)(seq - newest) > 0))
+                {
+                    newest = seq;
+                    flog_head_sector = sector;
+                }
+                if (!found || ((int32_t)(seq - oldest) < 0))
+                {
+                    oldest = seq;
+                    flog_oldest = sector;
+                }
+                found = true;
+                break;
+
+            case FLOG_PAGE_TORN:
+                flog_stats.torn_pages++;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    /* Empty flash: the first page goes to sector 0 */
+    flog_head_sector = found ? flog_head_sector : (flash->sectors - 1U);
+    flog_head_page = FLOG_PAGES_PER_SECTOR;
+    flog_head_erase = false;
+    flog_seq = newest + 1U;
+    flog_ts_base = 0U;
+    flog_oldest = found ? flog_oldest : 0U;
+    flog_used = found ? (((flog_head_sector + flash->sectors - flog_oldest) %
+                          flash->sectors) + 1U) : 0U;
+
+    if (found)
+    {
+        /* Continue after the last page written, valid or not */
+        flog_head_page = 0U;
+        for (uint32_t page = 0U; page < FLOG_PAGES_PER_SECTOR; page++)
+        {
+            flog_page_state_t state;
+
+            if (!flash->read(flog_page_addr(flog_head_sector, page),
+                             flog_page, FLOG_PAGE_SIZE))
+            {
+                return false;
+            }
+
+            state = flog_page_check(flog_page);
+            if (FLOG_PAGE_VALID == state)
+            {
+                flog_seq = flog_get32(&flog_page[FLOG_HDR_SEQ]) + 1U;
+                flog_ts_base = flog_page_last_ts(flog_page) + 1U;
+            }
+            else if ((FLOG_PAGE_TORN == state) && (0U != page))
+            {
+                /* Page 0 was counted by the sector scan */
+                flog_stats.torn_pages++;
+            }
+
+            if (FLOG_PAGE_ERASED != state)
+            {
+                flog_head_page = page + 1U;
+            }
+        }
+    }
+
+    flog_last_ts = flog_ts_base;
+    flog_flash = flash;
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: flog_flush
+********************************************************************************
+* Summary:
+* Writes the page being filled, padded, to the next free page. Moving to a
+* new sector erases it first, dropping the oldest data once the flash is
+* full, so all sectors wear evenly.
+*
+* Return:
+*  false if the page could not be written; its records are lost
+*
+*******************************************************************************/
+bool flog_flush(void)
+{
+    uint32_t sectors;
+    bool ok = true;
+
+    if ((NULL == flog_flash) || !flog_page_open)
+    {
+        return true;
+    }
+    sectors = flog_flash->sectors;
+    flog_page_open = false;
+
+    flog_put16(&flog_page[FLOG_HDR_MAGIC], FLOG_PAGE_MAGIC);
+    flog_put16(&flog_page[FLOG_HDR_COUNT], flog_page_count);
+    flog_put32(&flog_page[FLOG_HDR_SEQ], flog_seq);
+    flog_put32(&flog_page[FLOG_HDR_TS], flog_page_ts);
+    flog_put32(&flog_page[FLOG_HDR_CRC], flog_page_crc(flog_page));
+    flog_seq++;
+
+    if (flog_head_page >= FLOG_PAGES_PER_SECTOR)
+    {
+        flog_head_sector = (flog_head_sector + 1U) % sectors;
+        flog_head_page = 0U;
+        flog_head_erase = true;
+    }
+
+    if (flog_head_erase)
+    {
+        if ((0U != flog_used) && (flog_head_sector == flog_oldest))
+        {
+            flog_oldest = (flog_oldest + 1U) % sectors;
+            flog_used--;
+        }
+
+        flog_stats.erases++;
+        if (!flog_flash->erase(flog_page_addr(flog_head_sector, 0U)))
+        {
+            /* Skip the sector; the next flush tries the one after it */
+            flog_head_page = FLOG_PAGES_PER_SECTOR;
+            flog_stats.dropped += flog_page_count;
+            return false;
+        }
+        flog_head_erase = false;
+    }
+
+    flog_stats.program_bytes += FLOG_PAGE_SIZE;
+    if (!flog_flash->program(flog_page_addr(flog_head_sector, flog_head_page),
+                             flog_page, FLOG_PAGE_SIZE))
+    {
+        flog_stats.dropped += flog_page_count;
+        ok = false;
+    }
+    else if (0U == flog_head_page)
+    {
+        if (0U == flog_used)
+        {
+            flog_oldest = flog_head_sector;
+        }
+        flog_used++;
+    }
+    flog_head_page++;
+
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: flog_append
+********************************************************************************
+* Summary:
+* Adds a frame to the page being filled, writing the page first if the
+* frame does not fit.
+*
+* Parameters:
+*  now_ms       Milliseconds since start-up
+*  id           CAN identifier
+*  flags        CANFD_FRAME_FLAG_xxx
+*  data         Payload
+*  len          Payload length, up to FLOG_DATA_MAX
+*
+* Return:
+*  false if the frame or a page written to make room for it was lost
+*
+*******************************************************************************/
+bool flog_append(uint32_t now_ms, uint32_t id, uint8_t flags,
+                 const uint8_t *data, uint8_t len)
+{
+    uint32_t size = FLOG_RECORD_HEADER_SIZE + len;
+    uint32_t ts = flog_ts_base + now_ms;
+    bool ok = true;
+
+    if ((NULL == flog_flash) || (len > FLOG_DATA_MAX))
+    {
+        flog_stats.dropped++;
+        return false;
+    }
+
+    /* Log time never runs backwards */
+    ts = ((int32_t)(ts - flog_last_ts) < 0) ? flog_last_ts : ts;
+
+    if (flog_page_open && (((flog_page_len + size) > FLOG_PAGE_SIZE) ||
+                           ((ts - flog_page_ts) > FLOG_PAGE_SPAN_MS)))
+    {
+        ok = flog_flush();
+    }
+
+    if (!flog_page_open)
+    {
+        memset(flog_page, FLOG_ERASED_BYTE, sizeof(flog_page));
+        flog_page_open = true;
+        flog_page_len = FLOG_HEADER_SIZE;
+        flog_page_count = 0U;
+        flog_page_ts = ts;
+        flog_page_opened = now_ms;
+    }
+
+    flog_put32(&flog_page[flog_page_len + FLOG_REC_ID], id);
+    flog_put16(&flog_page[flog_page_len + FLOG_REC_DT], ts - flog_page_ts);
+    flog_page[flog_page_len + FLOG_REC_FLAGS] = flags;
+    flog_page[flog_page_len + FLOG_REC_LEN] = len;
+    memcpy(&flog_page[flog_page_len + FLOG_RECORD_HEADER_SIZE], data, len);
+
+    flog_page_len += size;
+    flog_page_count++;
+    flog_last_ts = ts;
+    flog_stats.records++;
+    flog_stats.record_bytes += size;
+
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: flog_poll
+********************************************************************************
+* Summary:
+* Writes a partly filled page once it is FLOG_FLUSH_MS old.
+*
+* Parameters:
+*  now_ms       Milliseconds since start-up
+*
+*******************************************************************************/
+void flog_poll(uint32_t now_ms)
+{
+    if (flog_page_open && ((now_ms - flog_page_opened) >= FLOG_FLUSH_MS))
+    {
+        (void)flog_flush();
+    }
+}
+
+/*******************************************************************************
+* Function Name: flog_header_ts
+********************************************************************************
+* Summary:
+* Reads the timestamp of a page without checking its CRC.
+*
+* Return:
+*  false if the page holds no log data
+*
+*******************************************************************************/
+static bool flog_header_ts(uint32_t sector, uint32_t page, uint32_t *ts)
+{
+    uint8_t header[FLOG_HEADER_SIZE];
+
+    if (!flog_flash->read(flog_page_addr(sector, page), header,
+                          sizeof(header)) ||
+        (FLOG_PAGE_MAGIC != flog_get16(&header[FLOG_HDR_MAGIC])))
+    {
+        return false;
+    }
+    *ts = flog_get32(&header[FLOG_HDR_TS]);
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: flog_seek
+********************************************************************************
+* Summary:
+* Positions a cursor at the first record at or after a time. Pages are in
+* time order, so a binary search over the first page of each sector and
+* one over the pages of that sector find the page, reading only headers.
+* Damaged pages count as earlier than ts. Records not yet written by
+* flog_flush() are not seen.
+*
+* Parameters:
+*  ts           Log time in milliseconds
+*  cursor       Cursor to position
+*
+* Return:
+*  false if no record is at or after ts
+*
+*******************************************************************************/
+bool flog_seek(uint32_t ts, flog_cursor_t *cursor)
+{
+    flog_record_t record;
+    uint32_t sectors;
+    uint32_t sector;
+    uint32_t low = 0U;
+    uint32_t high;
+
+    if ((NULL == flog_flash) || (0U == flog_used))
+    {
+        return false;
+    }
+    sectors = flog_flash->sectors;
+    high = flog_used;
+
+    /* Last sector starting before ts; records at ts may end the sector
+     * before the one starting at ts */
+    while ((high - low) > 1U)
+    {
+        uint32_t mid = low + ((high - low) / 2U);
+        uint32_t mid_ts;
+
+        if (flog_header_ts((flog_oldest + mid) % sectors, 0U, &mid_ts) &&
+            (mid_ts >= ts))
+        {
+            high = mid;
+        }
+        else
+        {
+            low = mid;
+        }
+    }
+
+    memset(cursor, 0, sizeof(*cursor));
+    cursor->sector = low;
+
+    /* Last page of the sector starting before ts, the same way */
+    sector = (flog_oldest + low) % sectors;
+    low = 0U;
+    high = (sector == flog_head_sector) ? flog_head_page :
+           FLOG_PAGES_PER_SECTOR;
+    while ((high - low) > 1U)
+    {
+        uint32_t mid = low + ((high - low) / 2U);
+        uint32_t mid_ts;
+
+        if (flog_header_ts(sector, mid, &mid_ts) && (mid_ts >= ts))
+        {
+            high = mid;
+        }
+        else
+        {
+            low = mid;
+        }
+    }
+    cursor->page = low;
+
+    while (flog_next(cursor, &record))
+    {
+        if (record.ts >= ts)
+        {
+            /* Step back so that flog_next() returns this record */
+            cursor->offset -= FLOG_RECORD_HEADER_SIZE + record.len;
+            cursor->remaining++;
+            return true;
+        }
+    }
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: flog_next
+********************************************************************************
+* Summary:
+* Reads the record at a cursor and advances it, skipping damaged pages. The
+* cursor stays valid until the log wraps around to its sector.
+*
+* Parameters:
+*  cursor       Cursor from flog_seek()
+*  record       Read record
+*
+* Return:
+*  false at the end of the log
+*
+*******************************************************************************/
+bool flog_next(flog_cursor_t *cursor, flog_record_t *record)
+{
+    const uint8_t *rec;
+
+    for (;;)
+    {
+        while (0U == cursor->remaining)
+        {
+            uint32_t sector = (flog_oldest + cursor->sector) %
+                              flog_flash->sectors;
+
+            if ((cursor->sector >= flog_used) ||
+                ((sector == flog_head_sector) &&
+                 (cursor->page >= flog_head_page)))
+            {
+                return false;
+            }
+
+            if (!flog_flash->read(flog_page_addr(sector, cursor->page),
+                                  cursor->buf, FLOG_PAGE_SIZE))
+            {
+                return false;
+            }
+            if (FLOG_PAGE_VALID == flog_page_check(cursor->buf))
+            {
+                cursor->remaining = flog_get16(&cursor->buf[FLOG_HDR_COUNT]);
+                cursor->offset = FLOG_HEADER_SIZE;
+                cursor->ts = flog_get32(&cursor->buf[FLOG_HDR_TS]);
+            }
+
+            cursor->page++;
+            if (cursor->page >= FLOG_PAGES_PER_SECTOR)
+            {
+                cursor->page = 0U;
+                cursor->sector++;
+            }
+        }
+
+        rec = &cursor->buf[cursor->offset];
+        if ((rec[FLOG_REC_LEN] <= FLOG_DATA_MAX) &&
+            ((cursor->offset + FLOG_RECORD_HEADER_SIZE + rec[FLOG_REC_LEN]) <=
+             FLOG_PAGE_SIZE))
+        {
+            break;
+        }
+
+        /* Cannot happen with a valid CRC; stop reading this page */
+        cursor->remaining = 0U;
+    }
+
+    record->id = flog_get32(&rec[FLOG_REC_ID]);
+    record->ts = cursor->ts + flog_get16(&rec[FLOG_REC_DT]);
+    record->flags = rec[FLOG_REC_FLAGS];
+    record->len = rec[FLOG_REC_LEN];
+    memcpy(record->data, &rec[FLOG_RECORD_HEADER_SIZE], record->len);
+
+    cursor->offset += FLOG_RECORD_HEADER_SIZE + record->len;
+    cursor->remaining--;
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: flog_get_stats
+********************************************************************************
+* Summary:
+* Returns the counters since flog_mount().
+*
+*******************************************************************************/
+void flog_get_stats(flog_stats_t *stats)
+{
+    *stats = flog_stats;
+    stats->sectors_used = flog_used;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,164 @@
+/******************************************************************************
+* File Name:   flog.h
+*
+* Description: This file contains the interface of the log-structured frame
+*              logger, which records received frames to external flash.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef FLOG_H_
+#define FLOG_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* Only the C library, so that host/ can build the logger against a file */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make FLOG_ENABLE=1") to record all received
+ * frames to the external SPI flash */
+#ifndef FLOG_ENABLE
+#define FLOG_ENABLE             (0)
+#endif
+
+/* Program unit of the flash. One page is one block of the log. */
+#define FLOG_PAGE_SIZE          (256U)
+
+/* Erase unit of the log: a 64 KiB block. Erasing whole blocks takes much
+ * less time per byte than 4 KiB sectors on SPI NOR flash. */
+#define FLOG_SECTOR_SIZE        (65536U)
+#define FLOG_PAGES_PER_SECTOR   (FLOG_SECTOR_SIZE / FLOG_PAGE_SIZE)
+
+/* Page header: magic, record count, sequence number, timestamp of the first
+ * record, CRC-32 of the rest of the page */
+#define FLOG_PAGE_MAGIC         (0x4C46U)
+#define FLOG_HEADER_SIZE        (16U)
+
+/* Record header: ID, timestamp offset from the page, flags, length */
+#define FLOG_RECORD_HEADER_SIZE (8U)
+#define FLOG_DATA_MAX           (64U)
+
+/* Longest time covered by one page, so that record offsets fit 16 bits */
+#define FLOG_PAGE_SPAN_MS       (0xFFFFU)
+
+/* A partly filled page is written after this time, bounding the frames
+ * lost on power failure */
+#ifndef FLOG_FLUSH_MS
+#define FLOG_FLUSH_MS           (1000U)
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Flash access. Addresses are byte offsets from the start of the log area;
+ * program never crosses a page and erase takes a sector address. Each
+ * function returns false on a device error. */
+typedef struct
+{
+    bool     (*read)(uint32_t addr, void *buf, uint32_t len);
+    bool     (*program)(uint32_t addr, const void *buf, uint32_t len);
+    bool     (*erase)(uint32_t addr);
+    uint32_t sectors;               /* Size of the log area in sectors */
+} flog_flash_t;
+
+/* One logged frame. ts is in milliseconds of log time, which continues
+ * across resets. */
+typedef struct
+{
+    uint32_t ts;
+    uint32_t id;
+    uint8_t  flags;                 /* CANFD_FRAME_FLAG_xxx */
+    uint8_t  len;
+    uint8_t  data[FLOG_DATA_MAX];
+} flog_record_t;
+
+/* Read position. Holds a copy of the current page. */
+typedef struct
+{
+    uint32_t sector;                /* Sectors from the oldest one */
+    uint32_t page;
+    uint32_t offset;                /* Of the next record in the page */
+    uint32_t remaining;             /* Records left in the page */
+    uint32_t ts;                    /* Timestamp of the page */
+    uint8_t  buf[FLOG_PAGE_SIZE];
+} flog_cursor_t;
+
+/* Counters since flog_mount() */
+typedef struct
+{
+    uint32_t records;               /* Records appended */
+    uint32_t dropped;               /* Records lost to flash errors */
+    uint64_t record_bytes;          /* Bytes of the appended records */
+    uint64_t program_bytes;         /* Bytes programmed, headers and padding
+                                     * included */
+    uint32_t erases;
+    uint32_t torn_pages;            /* Found damaged by flog_mount() */
+    uint32_t sectors_used;          /* Sectors holding log data */
+} flog_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+bool flog_mount(const flog_flash_t *flash);
+bool flog_append(uint32_t now_ms, uint32_t id, uint8_t flags,
+                 const uint8_t *data, uint8_t len);
+bool flog_flush(void);
+void flog_poll(uint32_t now_ms);
+bool flog_seek(uint32_t ts, flog_cursor_t *cursor);
+bool flog_next(flog_cursor_t *cursor, flog_record_t *record);
+void flog_get_stats(flog_stats_t *stats);
+
+/* SPI NOR backend in flog_spi.c */
+const flog_flash_t *flog_spi_init(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* FLOG_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,267 @@
+/******************************************************************************
+* File Name:   flog_spi.c
+*
+* Description: This file contains the SPI NOR flash backend of the frame
+*              logger.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "flog.h"
+
+#if (FLOG_ENABLE)
+#if !defined(FLOG_SPI_HW) || !defined(FLOG_CS_PORT)
+#error "FLOG_ENABLE=1 needs an SPI master named FLOG_SPI and a chip select \
+pin named FLOG_CS in the design"
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Log area: 128 blocks of 64 KiB, an 8 MiB device */
+#ifndef FLOG_SPI_SECTORS
+#define FLOG_SPI_SECTORS        (128U)
+#endif
+
+/* Address of the log area on the device */
+#ifndef FLOG_SPI_BASE
+#define FLOG_SPI_BASE           (0U)
+#endif
+
+/* SPI NOR commands with 24-bit addresses */
+#define FLOG_CMD_READ           (0x03U)
+#define FLOG_CMD_PAGE_PROGRAM   (0x02U)
+#define FLOG_CMD_BLOCK_ERASE    (0xD8U)
+#define FLOG_CMD_WRITE_ENABLE   (0x06U)
+#define FLOG_CMD_READ_STATUS    (0x05U)
+#define FLOG_STATUS_BUSY        (0x01U)
+
+/* Longest program or erase, well above the data sheet maximum */
+#define FLOG_BUSY_TIMEOUT_US    (3000000U)
+#define FLOG_BUSY_POLL_US       (10U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static bool flog_spi_read(uint32_t addr, void *buf, uint32_t len);
+static bool flog_spi_program(uint32_t addr, const void *buf, uint32_t len);
+static bool flog_spi_erase(uint32_t addr);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static cy_stc_scb_spi_context_t flog_spi_context;
+
+static const flog_flash_t flog_spi_flash =
+{
+    .read = flog_spi_read,
+    .program = flog_spi_program,
+    .erase = flog_spi_erase,
+    .sectors = FLOG_SPI_SECTORS
+};
+
+/*******************************************************************************
+* Function Name: flog_spi_transfer
+********************************************************************************
+* Summary:
+* Exchanges bytes with the device while it is selected.
+*
+* Parameters:
+*  tx           Bytes to send, or NULL to send 0xFF
+*  rx           Received bytes, or NULL to discard them
+*  len          Number of bytes
+*
+*******************************************************************************/
+static void flog_spi_transfer(const uint8_t *tx, uint8_t *rx, uint32_t len)
+{
+    for (uint32_t idx = 0U; idx < len; idx++)
+    {
+        uint32_t byte;
+
+        (void)Cy_SCB_SPI_Write(FLOG_SPI_HW, (NULL != tx) ? tx[idx] : 0xFFU);
+        while (0U == Cy_SCB_SPI_GetNumInRxFifo(FLOG_SPI_HW))
+        {
+        }
+        byte = Cy_SCB_SPI_Read(FLOG_SPI_HW);
+        if (NULL != rx)
+        {
+            rx[idx] = (uint8_t)byte;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: flog_spi_command
+********************************************************************************
+* Summary:
+* Selects the device and sends a command, with an address unless addr is
+* UINT32_MAX. The device stays selected for the data phase.
+*
+*******************************************************************************/
+static void flog_spi_command(uint8_t cmd, uint32_t addr)
+{
+    uint8_t header[4] = { cmd };
+    uint32_t len = 1U;
+
+    if (UINT32_MAX != addr)
+    {
+        addr += FLOG_SPI_BASE;
+        header[1] = (uint8_t)(addr >> 16U);
+        header[2] = (uint8_t)(addr >> 8U);
+        header[3] = (uint8_t)addr;
+        len = sizeof(header);
+    }
+
+    Cy_GPIO_Write(FLOG_CS_PORT, FLOG_CS_PIN, 0U);
+    flog_spi_transfer(header, NULL, len);
+}
+
+static void flog_spi_deselect(void)
+{
+    Cy_GPIO_Write(FLOG_CS_PORT, FLOG_CS_PIN, 1U);
+}
+
+/*******************************************************************************
+* Function Name: flog_spi_wait
+********************************************************************************
+* Summary:
+* Waits until the previous program or erase has finished. Program and erase
+* return once started, so the main loop keeps running while the device is
+* busy, until the next flash operation.
+*
+* Return:
+*  false on timeout
+*
+*******************************************************************************/
+static bool flog_spi_wait(void)
+{
+    for (uint32_t waited = 0U; waited < FLOG_BUSY_TIMEOUT_US;
+         waited += FLOG_BUSY_POLL_US)
+    {
+        uint8_t status;
+
+        flog_spi_command(FLOG_CMD_READ_STATUS, UINT32_MAX);
+        flog_spi_transfer(NULL, &status, 1U);
+        flog_spi_deselect();
+
+        if (0U == (status & FLOG_STATUS_BUSY))
+        {
+            return true;
+        }
+        Cy_SysLib_DelayUs((uint16_t)FLOG_BUSY_POLL_US);
+    }
+    return false;
+}
+
+/*******************************************************************************
+* Flash operations
+*******************************************************************************/
+static bool flog_spi_read(uint32_t addr, void *buf, uint32_t len)
+{
+    if (!flog_spi_wait())
+    {
+        return false;
+    }
+
+    flog_spi_command(FLOG_CMD_READ, addr);
+    flog_spi_transfer(NULL, (uint8_t *)buf, len);
+    flog_spi_deselect();
+    return true;
+}
+
+static bool flog_spi_program(uint32_t addr, const void *buf, uint32_t len)
+{
+    if (!flog_spi_wait())
+    {
+        return false;
+    }
+
+    flog_spi_command(FLOG_CMD_WRITE_ENABLE, UINT32_MAX);
+    flog_spi_deselect();
+    flog_spi_command(FLOG_CMD_PAGE_PROGRAM, addr);
+    flog_spi_transfer((const uint8_t *)buf, NULL, len);
+    flog_spi_deselect();
+    return true;
+}
+
+static bool flog_spi_erase(uint32_t addr)
+{
+    if (!flog_spi_wait())
+    {
+        return false;
+    }
+
+    flog_spi_command(FLOG_CMD_WRITE_ENABLE, UINT32_MAX);
+    flog_spi_deselect();
+    flog_spi_command(FLOG_CMD_BLOCK_ERASE, addr);
+    flog_spi_deselect();
+    return true;
+}
+#endif /* FLOG_ENABLE */
+
+/*******************************************************************************
+* Function Name: flog_spi_init
+********************************************************************************
+* Summary:
+* Starts the SPI master of the external flash.
+*
+* Return:
+*  Flash operations for flog_mount(), or NULL if the logger is not built in
+*
+*******************************************************************************/
+const flog_flash_t *flog_spi_init(void)
+{
+#if (FLOG_ENABLE)
+    if (CY_SCB_SPI_SUCCESS != Cy_SCB_SPI_Init(FLOG_SPI_HW, &FLOG_SPI_config,
+                                              &flog_spi_context))
+    {
+        return NULL;
+    }
+    Cy_SCB_SPI_Enable(FLOG_SPI_HW);
+    flog_spi_deselect();
+
+    return &flog_spi_flash;
+#else
+    return NULL;
+#endif /* FLOG_ENABLE */
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,446 @@
+/******************************************************************************
+* File Name:   fzip.c
+*
+* Description: This file contains the frame stream compressor. It encodes each
+*              frame against the last frame of its ID: the ID becomes a slot
+*              number, the timestamp a residual to the ID's period, and the
+*              payload its changed bytes.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "fzip.h"
+#include "stats.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Run lengths of a payload token: zero bytes in the high nibble, changed
+ * bytes in the low nibble; 15 means an extension byte follows */
+#define FZIP_RUN_EXTEND         (15U)
+
+/* Key bit of 29-bit IDs */
+#define FZIP_KEY_XTD            (0x80000000UL)
+
+/* Sign bit of a timestamp residual */
+#define FZIP_TS_SIGN            ((FZIP_TS_MASK >> 1U) + 1U)
+
+/*******************************************************************************
+* Function Name: fzip_put_varint
+********************************************************************************
+* Summary:
+* Appends an unsigned number, 7 bits per byte, least significant first.
+*
+* Return:
+*  New length of the output
+*
+*******************************************************************************/
+static uint32_t fzip_put_varint(uint8_t *out, uint32_t pos, uint32_t value)
+{
+    while (value >= 0x80U)
+    {
+        out[pos++] = (uint8_t)(value | 0x80U);
+        value >>= 7U;
+    }
+    out[pos++] = (uint8_t)value;
+
+    return pos;
+}
+
+/*******************************************************************************
+* Function Name: fzip_put_run
+********************************************************************************
+* Summary:
+* Appends the extension byte of a run length that does not fit a nibble.
+*
+*******************************************************************************/
+static uint32_t fzip_put_run(uint8_t *out, uint32_t pos, uint32_t run)
+{
+    if (run >= FZIP_RUN_EXTEND)
+    {
+        out[pos++] = (uint8_t)(run - FZIP_RUN_EXTEND);
+    }
+
+    return pos;
+}
+
+/*******************************************************************************
+* Function Name: fzip_put_data
+********************************************************************************
+* Summary:
+* Encodes a payload as the XOR with the previous payload of the same ID.
+* Each token holds a run of unchanged bytes and a run of changed bytes,
+* followed by the XOR values of the changed bytes. The last token may only
+* skip unchanged bytes, so the tokens always cover the whole payload.
+*
+* Parameters:
+*  out          Output buffer
+*  pos          Length of the output so far
+*  data         New payload
+*  base         Previous payload
+*  len          Payload length
+*
+* Return:
+*  New length of the output
+*
+*******************************************************************************/
+static uint32_t fzip_put_data(uint8_t *out, uint32_t pos, const uint8_t *data,
+                              const uint8_t *base, uint32_t len)
+{
+    uint32_t idx = 0U;
+
+    while (idx < len)
+    {
+        uint32_t zeros = 0U;
+        uint32_t changed = 0U;
+
+        while (((idx + zeros) < len) && (data[idx + zeros] == base[idx + zeros]))
+        {
+            zeros++;
+        }
+        while (((idx + zeros + changed) < len) &&
+               (data[idx + zeros + changed] != base[idx + zeros + changed]))
+        {
+            changed++;
+        }
+
+        out[pos++] = (uint8_t)(((zeros < FZIP_RUN_EXTEND) ? zeros :
+                                FZIP_RUN_EXTEND) << 4U) |
+                     (uint8_t)((changed < FZIP_RUN_EXTEND) ? changed :
+                               FZIP_RUN_EXTEND);
+        pos = fzip_put_run(out, pos, zeros);
+        pos = fzip_put_run(out, pos, changed);
+
+        idx += zeros;
+        for (uint32_t end = idx + changed; idx < end; idx++)
+        {
+            out[pos++] = data[idx] ^ base[idx];
+        }
+    }
+
+    return pos;
+}
+
+/*******************************************************************************
+* Function Name: fzip_find
+********************************************************************************
+* Summary:
+* Returns the slot of an ID, or the least recently used slot if the ID has
+* none.
+*
+*******************************************************************************/
+static uint32_t fzip_find(const fzip_encoder_t *enc, uint32_t key, bool *hit)
+{
+    uint32_t victim = 0U;
+
+    for (uint32_t slot = 0U; slot < FZIP_SLOTS; slot++)
+    {
+        const fzip_slot_t *entry = &enc->slots[slot];
+
+        if (entry->valid && (entry->key == key))
+        {
+            *hit = true;
+            return slot;
+        }
+        if (!entry->valid)
+        {
+            victim = slot;
+            break;
+        }
+        if (entry->used < enc->slots[victim].used)
+        {
+            victim = slot;
+        }
+    }
+
+    *hit = false;
+    return victim;
+}
+
+/*******************************************************************************
+* Function Name: fzip_record
+********************************************************************************
+* Summary:
+* Encodes one frame against the current state without changing it.
+*
+* Parameters:
+*  enc          Encoder
+*  frame        Frame to encode
+*  out          Output, FZIP_RECORD_MAX bytes
+*  slot         Slot the frame is stored in afterwards
+*
+* Return:
+*  Length of the record
+*
+*******************************************************************************/
+static uint32_t fzip_record(const fzip_encoder_t *enc,
+                            const canfd_frame_t *frame, uint8_t *out,
+                            uint32_t *slot)
+{
+    static const uint8_t zeros[CANFD_MAX_DATA_LEN] = { 0U };
+    uint32_t key = frame->id;
+    uint32_t ts = frame->timestamp & FZIP_TS_MASK;
+    uint32_t predicted = enc->last_ts;
+    const uint8_t *base = zeros;
+    const fzip_slot_t *entry;
+    uint32_t residual;
+    uint32_t pos = 1U;
+    bool hit;
+
+    if (0U != (frame->flags & CANFD_FRAME_FLAG_XTD))
+    {
+        key |= FZIP_KEY_XTD;
+    }
+    *slot = fzip_find(enc, key, &hit);
+    entry = &enc->slots[*slot];
+    out[0] = (uint8_t)*slot;
+
+    if (hit)
+    {
+        base = entry->data;
+        predicted = entry->last_ts + entry->period;
+    }
+
+    if ((!hit) || (entry->flags != frame->flags) || (entry->len != frame->len))
+    {
+        out[0] |= FZIP_TAG_HEADER;
+        pos = fzip_put_varint(out, pos, frame->id);
+        out[pos++] = frame->flags;
+        out[pos++] = frame->len;
+    }
+
+    /* Signed difference to the predicted time, zigzag encoded */
+    residual = (ts - predicted) & FZIP_TS_MASK;
+    if (0U != residual)
+    {
+        residual = (0U != (residual & FZIP_TS_SIGN)) ?
+                   (((FZIP_TS_MASK - residual) << 1U) | 1U) : (residual << 1U);
+        out[0] |= FZIP_TAG_TIME;
+        pos = fzip_put_varint(out, pos, residual);
+    }
+
+    if (0 != memcmp(frame->data, base, frame->len))
+    {
+        out[0] |= FZIP_TAG_DATA;
+        pos = fzip_put_data(out, pos, frame->data, base, frame->len);
+    }
+
+    return pos;
+}
+
+/*******************************************************************************
+* Function Name: fzip_update
+********************************************************************************
+* Summary:
+* Stores a frame in its slot after it was encoded.
+*
+*******************************************************************************/
+static void fzip_update(fzip_encoder_t *enc, const canfd_frame_t *frame,
+                        uint32_t slot)
+{
+    fzip_slot_t *entry = &enc->slots[slot];
+    uint32_t key = frame->id;
+    uint32_t ts = frame->timestamp & FZIP_TS_MASK;
+
+    if (0U != (frame->flags & CANFD_FRAME_FLAG_XTD))
+    {
+        key |= FZIP_KEY_XTD;
+    }
+
+    if (entry->valid && (entry->key == key))
+    {
+        entry->period = (ts - entry->last_ts) & FZIP_TS_MASK;
+    }
+    else
+    {
+        memset(entry, 0, sizeof(*entry));
+        entry->valid = true;
+        entry->key = key;
+    }
+
+    entry->last_ts = ts;
+    entry->used = enc->stats.frames;
+    entry->flags = frame->flags;
+    entry->len = frame->len;
+    memcpy(entry->data, frame->data, frame->len);
+    enc->last_ts = ts;
+}
+
+/*******************************************************************************
+* Function Name: fzip_open
+********************************************************************************
+* Summary:
+* Starts a block. Every FZIP_RESET_BLOCKS blocks the state is cleared and
+* the block is marked so that the decoder clears its state too.
+*
+*******************************************************************************/
+static void fzip_open(fzip_encoder_t *enc)
+{
+    uint8_t flags = 0U;
+
+    if (0U == (enc->stats.blocks % FZIP_RESET_BLOCKS))
+    {
+        memset(enc->slots, 0, sizeof(enc->slots));
+        enc->last_ts = 0U;
+        flags = FZIP_BLOCK_FLAG_RESET;
+    }
+
+    enc->block[0] = FZIP_MAGIC;
+    enc->block[1] = enc->seq;
+    enc->block[2] = flags;
+    enc->block_len = FZIP_BLOCK_HEADER_SIZE;
+}
+
+/*******************************************************************************
+* Function Name: fzip_init
+********************************************************************************
+* Summary:
+* Initializes an encoder. The first block resets the decoder.
+*
+* Parameters:
+*  enc          Encoder
+*  write        Output function for encoded blocks
+*
+*******************************************************************************/
+void fzip_init(fzip_encoder_t *enc, fzip_write_fn_t write)
+{
+    memset(enc, 0, sizeof(*enc));
+    enc->write = write;
+}
+
+/*******************************************************************************
+* Function Name: fzip_encode
+********************************************************************************
+* Summary:
+* Adds one frame to the current block, writing the block first if the frame
+* does not fit. A frame that repeats the payload of the last frame with its
+* ID at the same interval takes one byte.
+*
+* Parameters:
+*  enc          Encoder
+*  frame        Frame to add
+*
+*******************************************************************************/
+void fzip_encode(fzip_encoder_t *enc, const canfd_frame_t *frame)
+{
+    uint8_t record[FZIP_RECORD_MAX];
+    uint32_t slot;
+    uint32_t len;
+
+    if (0U == enc->block_len)
+    {
+        fzip_open(enc);
+    }
+
+    len = fzip_record(enc, frame, record, &slot);
+    if ((enc->block_len + len) > (FZIP_BLOCK_SIZE - FZIP_BLOCK_CRC_SIZE))
+    {
+        /* Encode again, the new block may have reset the state */
+        fzip_flush(enc);
+        fzip_open(enc);
+        len = fzip_record(enc, frame, record, &slot);
+    }
+
+    memcpy(&enc->block[enc->block_len], record, len);
+    enc->block_len += len;
+    fzip_update(enc, frame, slot);
+
+    enc->stats.frames++;
+    enc->stats.raw_bytes += 8U + frame->len;
+    STATS_ADD(FZIP_RAW_BYTES, 8U + frame->len);
+}
+
+/*******************************************************************************
+* Function Name: fzip_flush
+********************************************************************************
+* Summary:
+* Writes the current block, if any: a zero byte, the block with its
+* CRC-16 COBS encoded so that it holds no zero byte, and a zero byte. Text
+* printed on the same UART holds no zero bytes, so the decoder can tell the
+* two apart.
+*
+* Parameters:
+*  enc          Encoder
+*
+*******************************************************************************/
+void fzip_flush(fzip_encoder_t *enc)
+{
+    uint8_t wire[FZIP_WIRE_SIZE];
+    uint32_t code = 1U;
+    uint32_t pos = 2U;
+    uint16_t crc;
+
+    if (0U == enc->block_len)
+    {
+        return;
+    }
+
+    crc = canfd_crc16(CANFD_CRC16_INIT, enc->block, enc->block_len);
+    enc->block[enc->block_len++] = (uint8_t)(crc >> 8U);
+    enc->block[enc->block_len++] = (uint8_t)crc;
+
+    /* COBS: each zero is replaced by the distance to the next one */
+    wire[0] = 0U;
+    for (uint32_t idx = 0U; idx < enc->block_len; idx++)
+    {
+        if (0U == enc->block[idx])
+        {
+            wire[code] = (uint8_t)(pos - code);
+            code = pos++;
+        }
+        else
+        {
+            wire[pos++] = enc->block[idx];
+        }
+    }
+    wire[code] = (uint8_t)(pos - code);
+    wire[pos++] = 0U;
+
+    enc->write(wire, pos);
+
+    enc->seq++;
+    enc->block_len = 0U;
+    enc->stats.blocks++;
+    enc->stats.wire_bytes += pos;
+    STATS_ADD(FZIP_WIRE_BYTES, pos);
+}
+
+/* [] END OF FILE */
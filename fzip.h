@@ -0,0 +1,164 @@
+/******************************************************************************
+* File Name:   fzip.h
+*
+* Description: This file contains the interface of the frame stream
+*              compressor, which sends received frames to the debug UART in
+*              compressed blocks.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef FZIP_H_
+#define FZIP_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "canfd_frame.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make FZIP_ENABLE=1") to send the received
+ * frames compressed instead of as log text. Decode the UART capture with
+ * scripts/fzip_decode.py. */
+#ifndef FZIP_ENABLE
+#define FZIP_ENABLE             (0)
+#endif
+
+/* IDs whose last frame is remembered. Each costs 80 bytes of RAM. */
+#ifndef FZIP_SLOTS
+#define FZIP_SLOTS              (32U)
+#endif
+
+#if (FZIP_SLOTS > 32U)
+#error "FZIP_SLOTS must be at most 32"
+#endif
+
+/* Bytes per block on the wire, including the block header and the CRC. At
+ * most 253, so that COBS adds exactly one byte. */
+#ifndef FZIP_BLOCK_SIZE
+#define FZIP_BLOCK_SIZE         (250U)
+#endif
+
+/* Every this many blocks the state is reset, so that a decoder that missed
+ * a block or joined late resynchronizes */
+#ifndef FZIP_RESET_BLOCKS
+#define FZIP_RESET_BLOCKS       (16U)
+#endif
+
+/* Valid bits of canfd_frame_t.timestamp, the controller RX timestamp */
+#ifndef FZIP_TS_MASK
+#define FZIP_TS_MASK            (0xFFFFU)
+#endif
+
+/* Block header: magic, sequence number, flags */
+#define FZIP_MAGIC              (0x5AU)
+#define FZIP_BLOCK_HEADER_SIZE  (3U)
+#define FZIP_BLOCK_CRC_SIZE     (2U)
+#define FZIP_BLOCK_FLAG_RESET   (0x01U)
+
+/* Record tag: slot number and the parts that follow */
+#define FZIP_TAG_SLOT_MASK      (0x1FU)
+#define FZIP_TAG_TIME           (0x20U)     /* Timestamp residual */
+#define FZIP_TAG_DATA           (0x40U)     /* Payload changes */
+#define FZIP_TAG_HEADER         (0x80U)     /* ID, flags and length */
+
+/* Longest record: tag, header, timestamp residual, and payload changes
+ * with their run tokens */
+#define FZIP_RECORD_MAX         (1U + 7U + 3U + 8U + CANFD_MAX_DATA_LEN)
+
+/* A block is written to the UART framed by zero bytes, COBS encoded */
+#define FZIP_WIRE_SIZE          (FZIP_BLOCK_SIZE + 3U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Writes encoded bytes, e.g. to the debug UART */
+typedef void (*fzip_write_fn_t)(const uint8_t *data, uint32_t len);
+
+/* Last frame of one ID, mirrored by the decoder */
+typedef struct
+{
+    uint32_t key;               /* ID, bit 31 set for 29-bit IDs */
+    uint32_t last_ts;
+    uint32_t period;            /* Last interval between two frames */
+    uint32_t used;              /* Frame count at the last use */
+    bool     valid;
+    uint8_t  flags;
+    uint8_t  len;
+    uint8_t  data[CANFD_MAX_DATA_LEN];
+} fzip_slot_t;
+
+typedef struct
+{
+    uint32_t frames;
+    uint32_t raw_bytes;         /* As 8-byte header plus payload */
+    uint32_t wire_bytes;        /* Written, including framing */
+    uint32_t blocks;
+} fzip_stats_t;
+
+/* Encoder state; the memory used is fixed by FZIP_SLOTS */
+typedef struct
+{
+    fzip_slot_t     slots[FZIP_SLOTS];
+    uint32_t        last_ts;    /* Of the previous frame */
+    uint8_t         block[FZIP_BLOCK_SIZE];
+    uint32_t        block_len;  /* 0 while no block is open */
+    uint8_t         seq;
+    fzip_write_fn_t write;
+    fzip_stats_t    stats;
+} fzip_encoder_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void fzip_init(fzip_encoder_t *enc, fzip_write_fn_t write);
+void fzip_encode(fzip_encoder_t *enc, const canfd_frame_t *frame);
+void fzip_flush(fzip_encoder_t *enc);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* FZIP_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,1229 @@
+/******************************************************************************
+* File Name:   fzip_trace.h
+*
+* Description: Frames replayed by the compression benchmark. Generated by
+*              scripts/fzip_trace.py from fzip_sample.log; do not edit.
+*
+*******************************************************************************/
+
+#ifndef FZIP_TRACE_H_
+#define FZIP_TRACE_H_
+
+/* 600 frames: ID, offset in fzip_trace_data, timestamp, length and
+ * CANFD_FRAME_FLAG_xxx */
+static const bench_fzip_frame_t fzip_trace[] =
+{
+    { 0x00000130U,     0U, 0x0000U,  8U, 0x00U },
+    { 0x000000F1U,     8U, 0x03DFU,  8U, 0x00U },
+    { 0x000000C9U,    16U, 0x05BCU,  8U, 0x00U },
+    { 0x00000200U,    24U, 0x0945U, 16U, 0x06U },
+    { 0x18F00400U,    40U, 0x161DU,  8U, 0x01U },
+    { 0x00000504U,    48U, 0x1701U,  8U, 0x00U },
+    { 0x000000F1U,    56U, 0x1780U,  8U, 0x00U },
+    { 0x00000410U,    64U, 0x191FU,  8U, 0x00U },
+    { 0x000000C9U,    72U, 0x194CU,  8U, 0x00U },
+    { 0x000001E5U,    80U, 0x21E1U,  8U, 0x00U },
+    { 0x00000120U,    88U, 0x22E6U,  8U, 0x00U },
+    { 0x00000130U,    96U, 0x2724U,  8U, 0x00U },
+    { 0x000000F1U,   104U, 0x2ADAU,  8U, 0x00U },
+    { 0x000000C9U,   112U, 0x2CD2U,  8U, 0x00U },
+    { 0x00000200U,   120U, 0x3030U, 16U, 0x06U },
+    { 0x18F00400U,   136U, 0x3D32U,  8U, 0x01U },
+    { 0x000000F1U,   144U, 0x3E69U,  8U, 0x00U },
+    { 0x000000C9U,   152U, 0x404DU,  8U, 0x00U },
+    { 0x00000300U,   160U, 0x4889U, 12U, 0x06U },
+    { 0x000001E5U,   172U, 0x48DDU,  8U, 0x00U },
+    { 0x00000120U,   180U, 0x49C5U,  8U, 0x00U },
+    { 0x00000640U,   188U, 0x4C62U, 32U, 0x06U },
+    { 0x00000130U,   220U, 0x4E5BU,  8U, 0x00U },
+    { 0x000000F1U,   228U, 0x5215U,  8U, 0x00U },
+    { 0x000001F5U,   236U, 0x537FU,  8U, 0x00U },
+    { 0x000000C9U,   244U, 0x53C1U,  8U, 0x00U },
+    { 0x00000200U,   252U, 0x572CU, 16U, 0x06U },
+    { 0x00000600U,   268U, 0x5B0BU, 64U, 0x06U },
+    { 0x000002A0U,   332U, 0x61FCU,  8U, 0x00U },
+    { 0x00000500U,   340U, 0x628CU,  8U, 0x00U },
+    { 0x18F00400U,   348U, 0x6437U,  8U, 0x01U },
+    { 0x000000F1U,   356U, 0x6584U,  8U, 0x00U },
+    { 0x000000C9U,   364U, 0x6755U,  8U, 0x00U },
+    { 0x000003E9U,   372U, 0x6C52U,  8U, 0x00U },
+    { 0x000001E5U,   380U, 0x7008U,  8U, 0x00U },
+    { 0x00000120U,   388U, 0x70EEU,  8U, 0x00U },
+    { 0x00000130U,   396U, 0x753FU,  8U, 0x00U },
+    { 0x000000F1U,   404U, 0x78F5U,  8U, 0x00U },
+    { 0x000000C9U,   412U, 0x7AD0U,  8U, 0x00U },
+    { 0x00000200U,   420U, 0x7E47U, 16U, 0x06U },
+    { 0x18F00400U,   436U, 0x8B36U,  8U, 0x01U },
+    { 0x000000F1U,   444U, 0x8CABU,  8U, 0x00U },
+    { 0x000000C9U,   452U, 0x8E5EU,  8U, 0x00U },
+    { 0x000004C1U,   460U, 0x8FC2U,  8U, 0x00U },
+    { 0x000001E5U,   468U, 0x96F8U,  8U, 0x00U },
+    { 0x00000120U,   476U, 0x9810U,  8U, 0x00U },
+    { 0x00000130U,   484U, 0x9C5CU,  8U, 0x00U },
+    { 0x000000F1U,   492U, 0xA040U,  8U, 0x00U },
+    { 0x000003C1U,   500U, 0xA08FU,  8U, 0x00U },
+    { 0x000000C9U,   508U, 0xA1DEU,  8U, 0x00U },
+    { 0x00000200U,   516U, 0xA522U, 16U, 0x06U },
+    { 0x00000300U,   532U, 0xAA26U, 12U, 0x06U },
+    { 0x000007E8U,   544U, 0xB080U,  8U, 0x00U },
+    { 0x000007E8U,   552U, 0xB13FU,  8U, 0x00U },
+    { 0x18F00400U,   560U, 0xB257U,  8U, 0x01U },
+    { 0x000000F1U,   568U, 0xB398U,  8U, 0x00U },
+    { 0x00000506U,   576U, 0xB4F3U,  8U, 0x00U },
+    { 0x000001F5U,   584U, 0xB544U,  8U, 0x00U },
+    { 0x000000C9U,   592U, 0xB572U,  8U, 0x00U },
+    { 0x00000600U,   600U, 0xBCCDU, 64U, 0x06U },
+    { 0x000001E5U,   664U, 0xBDC5U,  8U, 0x00U },
+    { 0x18FEF100U,   672U, 0xBE62U,  8U, 0x01U },
+    { 0x00000120U,   680U, 0xBF23U,  8U, 0x00U },
+    { 0x00000130U,   688U, 0xC378U,  8U, 0x00U },
+    { 0x000000F1U,   696U, 0xC709U,  8U, 0x00U },
+    { 0x000000C9U,   704U, 0xC90DU,  8U, 0x00U },
+    { 0x00000200U,   712U, 0xCC75U, 16U, 0x06U },
+    { 0x18F00400U,   728U, 0xD940U,  8U, 0x01U },
+    { 0x000000F1U,   736U, 0xDAB0U,  8U, 0x00U },
+    { 0x000000C9U,   744U, 0xDC8DU,  8U, 0x00U },
+    { 0x000001E5U,   752U, 0xE526U,  8U, 0x00U },
+    { 0x00000120U,   760U, 0xE617U,  8U, 0x00U },
+    { 0x00000130U,   768U, 0xEA69U,  8U, 0x00U },
+    { 0x000000F1U,   776U, 0xEE38U,  8U, 0x00U },
+    { 0x000000C9U,   784U, 0xF00DU,  8U, 0x00U },
+    { 0x00000200U,   792U, 0xF3A1U, 16U, 0x06U },
+    { 0x18F00400U,   808U, 0x0088U,  8U, 0x01U },
+    { 0x000000F1U,   816U, 0x01BCU,  8U, 0x00U },
+    { 0x000000C9U,   824U, 0x0383U,  8U, 0x00U },
+    { 0x00000300U,   832U, 0x0C01U, 12U, 0x06U },
+    { 0x000001E5U,   844U, 0x0C37U,  8U, 0x00U },
+    { 0x00000120U,   852U, 0x0D52U,  8U, 0x00U },
+    { 0x00000640U,   860U, 0x0FB7U, 32U, 0x06U },
+    { 0x00000130U,   892U, 0x115FU,  8U, 0x00U },
+    { 0x000000F1U,   900U, 0x156FU,  8U, 0x00U },
+    { 0x000001F5U,   908U, 0x16AFU,  8U, 0x00U },
+    { 0x000000C9U,   916U, 0x171CU,  8U, 0x00U },
+    { 0x00000200U,   924U, 0x1AA9U, 16U, 0x06U },
+    { 0x00000600U,   940U, 0x1EA7U, 64U, 0x06U },
+    { 0x000002A0U,  1004U, 0x2539U,  8U, 0x00U },
+    { 0x18F00400U,  1012U, 0x2761U,  8U, 0x01U },
+    { 0x000000F1U,  1020U, 0x28B9U,  8U, 0x00U },
+    { 0x000000C9U,  1028U, 0x2AC1U,  8U, 0x00U },
+    { 0x000003E9U,  1036U, 0x2FA1U,  8U, 0x00U },
+    { 0x000001E5U,  1044U, 0x3333U,  8U, 0x00U },
+    { 0x00000120U,  1052U, 0x340EU,  8U, 0x00U },
+    { 0x00000130U,  1060U, 0x3881U,  8U, 0x00U },
+    { 0x000000F1U,  1068U, 0x3C7BU,  8U, 0x00U },
+    { 0x000000C9U,  1076U, 0x3E46U,  8U, 0x00U },
+    { 0x00000200U,  1084U, 0x4182U, 16U, 0x06U },
+    { 0x18F00400U,  1100U, 0x4E91U,  8U, 0x01U },
+    { 0x000000F1U,  1108U, 0x4FC4U,  8U, 0x00U },
+    { 0x000000C9U,  1116U, 0x51A4U,  8U, 0x00U },
+    { 0x000004C1U,  1124U, 0x5340U,  8U, 0x00U },
+    { 0x000001E5U,  1132U, 0x5A35U,  8U, 0x00U },
+    { 0x00000120U,  1140U, 0x5B49U,  8U, 0x00U },
+    { 0x00000130U,  1148U, 0x5FBAU,  8U, 0x00U },
+    { 0x000000F1U,  1156U, 0x6358U,  8U, 0x00U },
+    { 0x000003C1U,  1164U, 0x63F2U,  8U, 0x00U },
+    { 0x000000C9U,  1172U, 0x6500U,  8U, 0x00U },
+    { 0x00000200U,  1180U, 0x68B8U, 16U, 0x06U },
+    { 0x00000300U,  1196U, 0x6D86U, 12U, 0x06U },
+    { 0x18F00400U,  1208U, 0x75CFU,  8U, 0x01U },
+    { 0x000000F1U,  1216U, 0x7703U,  8U, 0x00U },
+    { 0x000007E8U,  1224U, 0x771FU,  8U, 0x00U },
+    { 0x000001F5U,  1232U, 0x787AU,  8U, 0x00U },
+    { 0x000000C9U,  1240U, 0x78E8U,  8U, 0x00U },
+    { 0x00000600U,  1248U, 0x8036U, 64U, 0x06U },
+    { 0x000001E5U,  1312U, 0x816CU,  8U, 0x00U },
+    { 0x18FEF100U,  1320U, 0x81ACU,  8U, 0x01U },
+    { 0x00000120U,  1328U, 0x827CU,  8U, 0x00U },
+    { 0x00000130U,  1336U, 0x8686U,  8U, 0x00U },
+    { 0x000000F1U,  1344U, 0x8A97U,  8U, 0x00U },
+    { 0x000000C9U,  1352U, 0x8C76U,  8U, 0x00U },
+    { 0x00000200U,  1360U, 0x8FC9U, 16U, 0x06U },
+    { 0x18F00400U,  1376U, 0x9CA4U,  8U, 0x01U },
+    { 0x00000504U,  1384U, 0x9DCAU,  8U, 0x00U },
+    { 0x000000F1U,  1392U, 0x9E19U,  8U, 0x00U },
+    { 0x00000410U,  1400U, 0x9FADU,  8U, 0x00U },
+    { 0x000000C9U,  1408U, 0x9FDDU,  8U, 0x00U },
+    { 0x000001E5U,  1416U, 0xA867U,  8U, 0x00U },
+    { 0x00000120U,  1424U, 0xA9A3U,  8U, 0x00U },
+    { 0x00000130U,  1432U, 0xADB0U,  8U, 0x00U },
+    { 0x000000F1U,  1440U, 0xB194U,  8U, 0x00U },
+    { 0x000000C9U,  1448U, 0xB354U,  8U, 0x00U },
+    { 0x00000200U,  1456U, 0xB6B7U, 16U, 0x06U },
+    { 0x18F00400U,  1472U, 0xC3BBU,  8U, 0x01U },
+    { 0x000000F1U,  1480U, 0xC517U,  8U, 0x00U },
+    { 0x000000C9U,  1488U, 0xC6ECU,  8U, 0x00U },
+    { 0x00000300U,  1496U, 0xCF1DU, 12U, 0x06U },
+    { 0x000001E5U,  1508U, 0xCF8EU,  8U, 0x00U },
+    { 0x00000120U,  1516U, 0xD080U,  8U, 0x00U },
+    { 0x000007E8U,  1524U, 0xD25FU,  8U, 0x00U },
+    { 0x00000640U,  1532U, 0xD308U, 32U, 0x06U },
+    { 0x00000130U,  1564U, 0xD4E7U,  8U, 0x00U },
+    { 0x000000F1U,  1572U, 0xD89FU,  8U, 0x00U },
+    { 0x000001F5U,  1580U, 0xDA33U,  8U, 0x00U },
+    { 0x000000C9U,  1588U, 0xDA76U,  8U, 0x00U },
+    { 0x00000200U,  1596U, 0xDDB6U, 16U, 0x06U },
+    { 0x00000600U,  1612U, 0xE1A9U, 64U, 0x06U },
+    { 0x000002A0U,  1676U, 0xE89DU,  8U, 0x00U },
+    { 0x00000500U,  1684U, 0xE925U,  8U, 0x00U },
+    { 0x18F00400U,  1692U, 0xEAE8U,  8U, 0x01U },
+    { 0x000000F1U,  1700U, 0xEC31U,  8U, 0x00U },
+    { 0x000000C9U,  1708U, 0xEDFDU,  8U, 0x00U },
+    { 0x000003E9U,  1716U, 0xF2FDU,  8U, 0x00U },
+    { 0x000001E5U,  1724U, 0xF67FU,  8U, 0x00U },
+    { 0x00000120U,  1732U, 0xF7A4U,  8U, 0x00U },
+    { 0x000007E8U,  1740U, 0xF7EFU,  8U, 0x00U },
+    { 0x00000130U,  1748U, 0xFBF2U,  8U, 0x00U },
+    { 0x000000F1U,  1756U, 0xFFA7U,  8U, 0x00U },
+    { 0x000000C9U,  1764U, 0x017DU,  8U, 0x00U },
+    { 0x00000200U,  1772U, 0x04EBU, 16U, 0x06U },
+    { 0x18F00400U,  1788U, 0x11DBU,  8U, 0x01U },
+    { 0x000000F1U,  1796U, 0x133AU,  8U, 0x00U },
+    { 0x000000C9U,  1804U, 0x14F0U,  8U, 0x00U },
+    { 0x000004C1U,  1812U, 0x166EU,  8U, 0x00U },
+    { 0x000001E5U,  1820U, 0x1DC4U,  8U, 0x00U },
+    { 0x00000120U,  1828U, 0x1EB9U,  8U, 0x00U },
+    { 0x00000130U,  1836U, 0x22EFU,  8U, 0x00U },
+    { 0x000000F1U,  1844U, 0x26C9U,  8U, 0x00U },
+    { 0x000003C1U,  1852U, 0x274CU,  8U, 0x00U },
+    { 0x000000C9U,  1860U, 0x2867U,  8U, 0x00U },
+    { 0x00000200U,  1868U, 0x2C12U, 16U, 0x06U },
+    { 0x00000300U,  1884U, 0x3127U, 12U, 0x06U },
+    { 0x18F00400U,  1896U, 0x38D6U,  8U, 0x01U },
+    { 0x000000F1U,  1904U, 0x3A44U,  8U, 0x00U },
+    { 0x00000506U,  1912U, 0x3B69U,  8U, 0x00U },
+    { 0x000001F5U,  1920U, 0x3BEAU,  8U, 0x00U },
+    { 0x000000C9U,  1928U, 0x3BFDU,  8U, 0x00U },
+    { 0x00000600U,  1936U, 0x4386U, 64U, 0x06U },
+    { 0x000001E5U,  2000U, 0x44CFU,  8U, 0x00U },
+    { 0x18FEF100U,  2008U, 0x44D1U,  8U, 0x01U },
+    { 0x00000120U,  2016U, 0x45DDU,  8U, 0x00U },
+    { 0x00000130U,  2024U, 0x4A13U,  8U, 0x00U },
+    { 0x000000F1U,  2032U, 0x4DDEU,  8U, 0x00U },
+    { 0x000000C9U,  2040U, 0x4F81U,  8U, 0x00U },
+    { 0x00000200U,  2048U, 0x5309U, 16U, 0x06U },
+    { 0x18F00400U,  2064U, 0x6000U,  8U, 0x01U },
+    { 0x000000F1U,  2072U, 0x6161U,  8U, 0x00U },
+    { 0x000000C9U,  2080U, 0x6335U,  8U, 0x00U },
+    { 0x000001E5U,  2088U, 0x6BC3U,  8U, 0x00U },
+    { 0x00000120U,  2096U, 0x6CFAU,  8U, 0x00U },
+    { 0x00000130U,  2104U, 0x7113U,  8U, 0x00U },
+    { 0x000000F1U,  2112U, 0x750DU,  8U, 0x00U },
+    { 0x000000C9U,  2120U, 0x76AFU,  8U, 0x00U },
+    { 0x00000200U,  2128U, 0x7A2FU, 16U, 0x06U },
+    { 0x18F00400U,  2144U, 0x8719U,  8U, 0x01U },
+    { 0x000000F1U,  2152U, 0x886BU,  8U, 0x00U },
+    { 0x000000C9U,  2160U, 0x8A32U,  8U, 0x00U },
+    { 0x00000300U,  2168U, 0x92A7U, 12U, 0x06U },
+    { 0x000001E5U,  2180U, 0x92CBU,  8U, 0x00U },
+    { 0x00000120U,  2188U, 0x93E2U,  8U, 0x00U },
+    { 0x00000640U,  2196U, 0x967EU, 32U, 0x06U },
+    { 0x00000130U,  2228U, 0x9801U,  8U, 0x00U },
+    { 0x000007E8U,  2236U, 0x9B35U,  8U, 0x00U },
+    { 0x000000F1U,  2244U, 0x9BE1U,  8U, 0x00U },
+    { 0x000001F5U,  2252U, 0x9D72U,  8U, 0x00U },
+    { 0x000000C9U,  2260U, 0x9DC1U,  8U, 0x00U },
+    { 0x00000200U,  2268U, 0xA10AU, 16U, 0x06U },
+    { 0x00000600U,  2284U, 0xA514U, 64U, 0x06U },
+    { 0x000002A0U,  2348U, 0xABE6U,  8U, 0x00U },
+    { 0x18F00400U,  2356U, 0xAE2CU,  8U, 0x01U },
+    { 0x000000F1U,  2364U, 0xAF6AU,  8U, 0x00U },
+    { 0x000000C9U,  2372U, 0xB163U,  8U, 0x00U },
+    { 0x000003E9U,  2380U, 0xB63FU,  8U, 0x00U },
+    { 0x000001E5U,  2388U, 0xB9E2U,  8U, 0x00U },
+    { 0x00000120U,  2396U, 0xBAE0U,  8U, 0x00U },
+    { 0x00000130U,  2404U, 0xBF08U,  8U, 0x00U },
+    { 0x000000F1U,  2412U, 0xC2FBU,  8U, 0x00U },
+    { 0x000000C9U,  2420U, 0xC4B3U,  8U, 0x00U },
+    { 0x00000200U,  2428U, 0xC82BU, 16U, 0x06U },
+    { 0x18F00400U,  2444U, 0xD517U,  8U, 0x01U },
+    { 0x000000F1U,  2452U, 0xD69AU,  8U, 0x00U },
+    { 0x000000C9U,  2460U, 0xD858U,  8U, 0x00U },
+    { 0x000004C1U,  2468U, 0xD9AEU,  8U, 0x00U },
+    { 0x000001E5U,  2476U, 0xE0DEU,  8U, 0x00U },
+    { 0x00000120U,  2484U, 0xE21DU,  8U, 0x00U },
+    { 0x00000130U,  2492U, 0xE62FU,  8U, 0x00U },
+    { 0x000000F1U,  2500U, 0xEA03U,  8U, 0x00U },
+    { 0x000003C1U,  2508U, 0xEA89U,  8U, 0x00U },
+    { 0x000000C9U,  2516U, 0xEBBFU,  8U, 0x00U },
+    { 0x00000200U,  2524U, 0xEF39U, 16U, 0x06U },
+    { 0x00000300U,  2540U, 0xF458U, 12U, 0x06U },
+    { 0x18F00400U,  2552U, 0xFC66U,  8U, 0x01U },
+    { 0x000000F1U,  2560U, 0xFD9DU,  8U, 0x00U },
+    { 0x000001F5U,  2568U, 0xFF29U,  8U, 0x00U },
+    { 0x000000C9U,  2576U, 0xFF50U,  8U, 0x00U },
+    { 0x00000600U,  2584U, 0x06B9U, 64U, 0x06U },
+    { 0x000001E5U,  2648U, 0x081EU,  8U, 0x00U },
+    { 0x18FEF100U,  2656U, 0x0859U,  8U, 0x01U },
+    { 0x00000120U,  2664U, 0x08CFU,  8U, 0x00U },
+    { 0x00000130U,  2672U, 0x0D65U,  8U, 0x00U },
+    { 0x000000F1U,  2680U, 0x1149U,  8U, 0x00U },
+    { 0x000000C9U,  2688U, 0x12D9U,  8U, 0x00U },
+    { 0x00000200U,  2696U, 0x1657U, 16U, 0x06U },
+    { 0x18F00400U,  2712U, 0x2374U,  8U, 0x01U },
+    { 0x00000504U,  2720U, 0x2439U,  8U, 0x00U },
+    { 0x000000F1U,  2728U, 0x2463U,  8U, 0x00U },
+    { 0x000007E8U,  2736U, 0x258AU,  8U, 0x00U },
+    { 0x00000410U,  2744U, 0x2672U,  8U, 0x00U },
+    { 0x000000C9U,  2752U, 0x2699U,  8U, 0x00U },
+    { 0x000001E5U,  2760U, 0x2F07U,  8U, 0x00U },
+    { 0x00000120U,  2768U, 0x3010U,  8U, 0x00U },
+    { 0x00000130U,  2776U, 0x3451U,  8U, 0x00U },
+    { 0x000000F1U,  2784U, 0x380FU,  8U, 0x00U },
+    { 0x000000C9U,  2792U, 0x39F1U,  8U, 0x00U },
+    { 0x00000200U,  2800U, 0x3D73U, 16U, 0x06U },
+    { 0x18F00400U,  2816U, 0x4A5AU,  8U, 0x01U },
+    { 0x000000F1U,  2824U, 0x4BBAU,  8U, 0x00U },
+    { 0x000000C9U,  2832U, 0x4D6DU,  8U, 0x00U },
+    { 0x00000300U,  2840U, 0x55DAU, 12U, 0x06U },
+    { 0x000001E5U,  2852U, 0x561FU,  8U, 0x00U },
+    { 0x00000120U,  2860U, 0x571AU,  8U, 0x00U },
+    { 0x00000640U,  2868U, 0x5989U, 32U, 0x06U },
+    { 0x00000130U,  2900U, 0x5B58U,  8U, 0x00U },
+    { 0x000000F1U,  2908U, 0x5F45U,  8U, 0x00U },
+    { 0x000001F5U,  2916U, 0x60E0U,  8U, 0x00U },
+    { 0x000000C9U,  2924U, 0x60EBU,  8U, 0x00U },
+    { 0x00000200U,  2932U, 0x6483U, 16U, 0x06U },
+    { 0x00000600U,  2948U, 0x68A8U, 64U, 0x06U },
+    { 0x000002A0U,  3012U, 0x6F2EU,  8U, 0x00U },
+    { 0x00000500U,  3020U, 0x6FB1U,  8U, 0x00U },
+    { 0x18F00400U,  3028U, 0x7171U,  8U, 0x01U },
+    { 0x000000F1U,  3036U, 0x72CAU,  8U, 0x00U },
+    { 0x000000C9U,  3044U, 0x7481U,  8U, 0x00U },
+    { 0x000003E9U,  3052U, 0x79D6U,  8U, 0x00U },
+    { 0x000001E5U,  3060U, 0x7D5BU,  8U, 0x00U },
+    { 0x00000120U,  3068U, 0x7E30U,  8U, 0x00U },
+    { 0x00000130U,  3076U, 0x826BU,  8U, 0x00U },
+    { 0x000000F1U,  3084U, 0x8640U,  8U, 0x00U },
+    { 0x000000C9U,  3092U, 0x8833U,  8U, 0x00U },
+    { 0x00000200U,  3100U, 0x8B93U, 16U, 0x06U },
+    { 0x18F00400U,  3116U, 0x986FU,  8U, 0x01U },
+    { 0x000000F1U,  3124U, 0x99E4U,  8U, 0x00U },
+    { 0x000000C9U,  3132U, 0x9B82U,  8U, 0x00U },
+    { 0x000004C1U,  3140U, 0x9D26U,  8U, 0x00U },
+    { 0x000001E5U,  3148U, 0xA43CU,  8U, 0x00U },
+    { 0x00000120U,  3156U, 0xA54AU,  8U, 0x00U },
+    { 0x00000130U,  3164U, 0xA969U,  8U, 0x00U },
+    { 0x000000F1U,  3172U, 0xAD62U,  8U, 0x00U },
+    { 0x000003C1U,  3180U, 0xADFCU,  8U, 0x00U },
+    { 0x000000C9U,  3188U, 0xAF16U,  8U, 0x00U },
+    { 0x00000200U,  3196U, 0xB29BU, 16U, 0x06U },
+    { 0x00000300U,  3212U, 0xB781U, 12U, 0x06U },
+    { 0x18F00400U,  3224U, 0xBFADU,  8U, 0x01U },
+    { 0x000000F1U,  3232U, 0xC0D6U,  8U, 0x00U },
+    { 0x00000506U,  3240U, 0xC219U,  8U, 0x00U },
+    { 0x000001F5U,  3248U, 0xC287U,  8U, 0x00U },
+    { 0x000000C9U,  3256U, 0xC2F3U,  8U, 0x00U },
+    { 0x00000600U,  3264U, 0xCA2BU, 64U, 0x06U },
+    { 0x000001E5U,  3328U, 0xCB5BU,  8U, 0x00U },
+    { 0x18FEF100U,  3336U, 0xCBB8U,  8U, 0x01U },
+    { 0x00000120U,  3344U, 0xCC9FU,  8U, 0x00U },
+    { 0x00000130U,  3352U, 0xD09CU,  8U, 0x00U },
+    { 0x000000F1U,  3360U, 0xD4A8U,  8U, 0x00U },
+    { 0x000000C9U,  3368U, 0xD64AU,  8U, 0x00U },
+    { 0x00000200U,  3376U, 0xD999U, 16U, 0x06U },
+    { 0x18F00400U,  3392U, 0xE689U,  8U, 0x01U },
+    { 0x000000F1U,  3400U, 0xE7FCU,  8U, 0x00U },
+    { 0x000000C9U,  3408U, 0xE9D0U,  8U, 0x00U },
+    { 0x000001E5U,  3416U, 0xF25EU,  8U, 0x00U },
+    { 0x00000120U,  3424U, 0xF373U,  8U, 0x00U },
+    { 0x00000130U,  3432U, 0xF791U,  8U, 0x00U },
+    { 0x000000F1U,  3440U, 0xFB6DU,  8U, 0x00U },
+    { 0x000000C9U,  3448U, 0xFD48U,  8U, 0x00U },
+    { 0x00000200U,  3456U, 0x00C1U, 16U, 0x06U },
+    { 0x18F00400U,  3472U, 0x0DBBU,  8U, 0x01U },
+    { 0x000000F1U,  3480U, 0x0F01U,  8U, 0x00U },
+    { 0x000000C9U,  3488U, 0x10C1U,  8U, 0x00U },
+    { 0x00000300U,  3496U, 0x194AU, 12U, 0x06U },
+    { 0x000001E5U,  3508U, 0x196FU,  8U, 0x00U },
+    { 0x00000120U,  3516U, 0x1A6CU,  8U, 0x00U },
+    { 0x00000640U,  3524U, 0x1CEBU, 32U, 0x06U },
+    { 0x00000130U,  3556U, 0x1EC7U,  8U, 0x00U },
+    { 0x000000F1U,  3564U, 0x2286U,  8U, 0x00U },
+    { 0x000001F5U,  3572U, 0x2435U,  8U, 0x00U },
+    { 0x000000C9U,  3580U, 0x2450U,  8U, 0x00U },
+    { 0x00000200U,  3588U, 0x27D5U, 16U, 0x06U },
+    { 0x00000600U,  3604U, 0x2BD5U, 64U, 0x06U },
+    { 0x000002A0U,  3668U, 0x327AU,  8U, 0x00U },
+    { 0x18F00400U,  3676U, 0x34AEU,  8U, 0x01U },
+    { 0x000000F1U,  3684U, 0x3611U,  8U, 0x00U },
+    { 0x000000C9U,  3692U, 0x37DFU,  8U, 0x00U },
+    { 0x000003E9U,  3700U, 0x3CFBU,  8U, 0x00U },
+    { 0x000001E5U,  3708U, 0x4087U,  8U, 0x00U },
+    { 0x00000120U,  3716U, 0x4175U,  8U, 0x00U },
+    { 0x00000130U,  3724U, 0x4594U,  8U, 0x00U },
+    { 0x000000F1U,  3732U, 0x4957U,  8U, 0x00U },
+    { 0x000000C9U,  3740U, 0x4B51U,  8U, 0x00U },
+    { 0x00000200U,  3748U, 0x4EF7U, 16U, 0x06U },
+    { 0x000007E8U,  3764U, 0x57DCU,  8U, 0x00U },
+    { 0x18F00400U,  3772U, 0x5BB9U,  8U, 0x01U },
+    { 0x000000F1U,  3780U, 0x5D17U,  8U, 0x00U },
+    { 0x000000C9U,  3788U, 0x5EC9U,  8U, 0x00U },
+    { 0x000004C1U,  3796U, 0x6051U,  8U, 0x00U },
+    { 0x000001E5U,  3804U, 0x6793U,  8U, 0x00U },
+    { 0x00000120U,  3812U, 0x68B5U,  8U, 0x00U },
+    { 0x00000130U,  3820U, 0x6CE6U,  8U, 0x00U },
+    { 0x000000F1U,  3828U, 0x70C5U,  8U, 0x00U },
+    { 0x000003C1U,  3836U, 0x7152U,  8U, 0x00U },
+    { 0x000000C9U,  3844U, 0x7249U,  8U, 0x00U },
+    { 0x00000200U,  3852U, 0x75C1U, 16U, 0x06U },
+    { 0x00000300U,  3868U, 0x7AA9U, 12U, 0x06U },
+    { 0x18F00400U,  3880U, 0x82ECU,  8U, 0x01U },
+    { 0x000000F1U,  3888U, 0x8416U,  8U, 0x00U },
+    { 0x000001F5U,  3896U, 0x85D2U,  8U, 0x00U },
+    { 0x000000C9U,  3904U, 0x85E8U,  8U, 0x00U },
+    { 0x00000600U,  3912U, 0x8D7DU, 64U, 0x06U },
+    { 0x000001E5U,  3976U, 0x8E8DU,  8U, 0x00U },
+    { 0x18FEF100U,  3984U, 0x8EE8U,  8U, 0x01U },
+    { 0x00000120U,  3992U, 0x8FA3U,  8U, 0x00U },
+    { 0x00000130U,  4000U, 0x93DFU,  8U, 0x00U },
+    { 0x000000F1U,  4008U, 0x97B9U,  8U, 0x00U },
+    { 0x000000C9U,  4016U, 0x9978U,  8U, 0x00U },
+    { 0x00000200U,  4024U, 0x9CF3U, 16U, 0x06U },
+    { 0x18F00400U,  4040U, 0xAA0CU,  8U, 0x01U },
+    { 0x00000504U,  4048U, 0xAAC2U,  8U, 0x00U },
+    { 0x000000F1U,  4056U, 0xAB5BU,  8U, 0x00U },
+    { 0x00000410U,  4064U, 0xAD0AU,  8U, 0x00U },
+    { 0x000000C9U,  4072U, 0xAD32U,  8U, 0x00U },
+    { 0x000001E5U,  4080U, 0xB5C2U,  8U, 0x00U },
+    { 0x00000120U,  4088U, 0xB6DDU,  8U, 0x00U },
+    { 0x00000130U,  4096U, 0xBACEU,  8U, 0x00U },
+    { 0x000000F1U,  4104U, 0xBEE0U,  8U, 0x00U },
+    { 0x000000C9U,  4112U, 0xC07BU,  8U, 0x00U },
+    { 0x00000200U,  4120U, 0xC3FAU, 16U, 0x06U },
+    { 0x18F00400U,  4136U, 0xD0FAU,  8U, 0x01U },
+    { 0x000000F1U,  4144U, 0xD279U,  8U, 0x00U },
+    { 0x000000C9U,  4152U, 0xD40DU,  8U, 0x00U },
+    { 0x00000300U,  4160U, 0xDC63U, 12U, 0x06U },
+    { 0x000001E5U,  4172U, 0xDCD3U,  8U, 0x00U },
+    { 0x00000120U,  4180U, 0xDDACU,  8U, 0x00U },
+    { 0x00000640U,  4188U, 0xE07FU, 32U, 0x06U },
+    { 0x00000130U,  4220U, 0xE220U,  8U, 0x00U },
+    { 0x000000F1U,  4228U, 0xE5B1U,  8U, 0x00U },
+    { 0x000001F5U,  4236U, 0xE76CU,  8U, 0x00U },
+    { 0x000000C9U,  4244U, 0xE779U,  8U, 0x00U },
+    { 0x00000200U,  4252U, 0xEB1DU, 16U, 0x06U },
+    { 0x00000600U,  4268U, 0xEF06U, 64U, 0x06U },
+    { 0x000002A0U,  4332U, 0xF5C2U,  8U, 0x00U },
+    { 0x00000500U,  4340U, 0xF662U,  8U, 0x00U },
+    { 0x18F00400U,  4348U, 0xF7FAU,  8U, 0x01U },
+    { 0x000000F1U,  4356U, 0xF95BU,  8U, 0x00U },
+    { 0x000000C9U,  4364U, 0xFB3CU,  8U, 0x00U },
+    { 0x000003E9U,  4372U, 0x004AU,  8U, 0x00U },
+    { 0x000001E5U,  4380U, 0x03F7U,  8U, 0x00U },
+    { 0x00000120U,  4388U, 0x04E2U,  8U, 0x00U },
+    { 0x00000130U,  4396U, 0x0918U,  8U, 0x00U },
+    { 0x000000F1U,  4404U, 0x0CE3U,  8U, 0x00U },
+    { 0x000000C9U,  4412U, 0x0ED1U,  8U, 0x00U },
+    { 0x00000200U,  4420U, 0x1241U, 16U, 0x06U },
+    { 0x18F00400U,  4436U, 0x1F2EU,  8U, 0x01U },
+    { 0x000000F1U,  4444U, 0x2083U,  8U, 0x00U },
+    { 0x000000C9U,  4452U, 0x2235U,  8U, 0x00U },
+    { 0x000004C1U,  4460U, 0x238CU,  8U, 0x00U },
+    { 0x000001E5U,  4468U, 0x2AC8U,  8U, 0x00U },
+    { 0x00000120U,  4476U, 0x2BFFU,  8U, 0x00U },
+    { 0x00000130U,  4484U, 0x2FF7U,  8U, 0x00U },
+    { 0x000000F1U,  4492U, 0x3417U,  8U, 0x00U },
+    { 0x000003C1U,  4500U, 0x34ACU,  8U, 0x00U },
+    { 0x000000C9U,  4508U, 0x35C2U,  8U, 0x00U },
+    { 0x00000200U,  4516U, 0x392EU, 16U, 0x06U },
+    { 0x00000300U,  4532U, 0x3E0AU, 12U, 0x06U },
+    { 0x18F00400U,  4544U, 0x4629U,  8U, 0x01U },
+    { 0x000000F1U,  4552U, 0x4740U,  8U, 0x00U },
+    { 0x00000506U,  4560U, 0x48C3U,  8U, 0x00U },
+    { 0x000001F5U,  4568U, 0x4930U,  8U, 0x00U },
+    { 0x000000C9U,  4576U, 0x4947U,  8U, 0x00U },
+    { 0x00000600U,  4584U, 0x50CAU, 64U, 0x06U },
+    { 0x000001E5U,  4648U, 0x51EFU,  8U, 0x00U },
+    { 0x18FEF100U,  4656U, 0x523CU,  8U, 0x01U },
+    { 0x00000120U,  4664U, 0x52F8U,  8U, 0x00U },
+    { 0x00000130U,  4672U, 0x5729U,  8U, 0x00U },
+    { 0x000000F1U,  4680U, 0x5B26U,  8U, 0x00U },
+    { 0x000000C9U,  4688U, 0x5CCCU,  8U, 0x00U },
+    { 0x00000200U,  4696U, 0x604FU, 16U, 0x06U },
+    { 0x18F00400U,  4712U, 0x6D42U,  8U, 0x01U },
+    { 0x000000F1U,  4720U, 0x6E6FU,  8U, 0x00U },
+    { 0x000000C9U,  4728U, 0x703DU,  8U, 0x00U },
+    { 0x000001E5U,  4736U, 0x790EU,  8U, 0x00U },
+    { 0x00000120U,  4744U, 0x7A1FU,  8U, 0x00U },
+    { 0x00000130U,  4752U, 0x7E56U,  8U, 0x00U },
+    { 0x000000F1U,  4760U, 0x822CU,  8U, 0x00U },
+    { 0x000000C9U,  4768U, 0x8415U,  8U, 0x00U },
+    { 0x00000200U,  4776U, 0x874AU, 16U, 0x06U },
+    { 0x18F00400U,  4792U, 0x9470U,  8U, 0x01U },
+    { 0x000000F1U,  4800U, 0x957EU,  8U, 0x00U },
+    { 0x000000C9U,  4808U, 0x976CU,  8U, 0x00U },
+    { 0x00000300U,  4816U, 0x9FD4U, 12U, 0x06U },
+    { 0x000001E5U,  4828U, 0xA02DU,  8U, 0x00U },
+    { 0x00000120U,  4836U, 0xA10DU,  8U, 0x00U },
+    { 0x00000640U,  4844U, 0xA35BU, 32U, 0x06U },
+    { 0x00000130U,  4876U, 0xA553U,  8U, 0x00U },
+    { 0x000000F1U,  4884U, 0xA92FU,  8U, 0x00U },
+    { 0x000001F5U,  4892U, 0xAAC6U,  8U, 0x00U },
+    { 0x000000C9U,  4900U, 0xAAF1U,  8U, 0x00U },
+    { 0x00000200U,  4908U, 0xAE73U, 16U, 0x06U },
+    { 0x00000600U,  4924U, 0xB25CU, 64U, 0x06U },
+    { 0x000007E8U,  4988U, 0xB781U,  8U, 0x00U },
+    { 0x000002A0U,  4996U, 0xB92AU,  8U, 0x00U },
+    { 0x18F00400U,  5004U, 0xBB77U,  8U, 0x01U },
+    { 0x000000F1U,  5012U, 0xBCD1U,  8U, 0x00U },
+    { 0x000000C9U,  5020U, 0xBE97U,  8U, 0x00U },
+    { 0x000003E9U,  5028U, 0xC37DU,  8U, 0x00U },
+    { 0x000001E5U,  5036U, 0xC710U,  8U, 0x00U },
+    { 0x00000120U,  5044U, 0xC824U,  8U, 0x00U },
+    { 0x00000130U,  5052U, 0xCC82U,  8U, 0x00U },
+    { 0x000000F1U,  5060U, 0xD037U,  8U, 0x00U },
+    { 0x000000C9U,  5068U, 0xD204U,  8U, 0x00U },
+    { 0x00000200U,  5076U, 0xD5BDU, 16U, 0x06U },
+    { 0x18F00400U,  5092U, 0xE25DU,  8U, 0x01U },
+    { 0x000000F1U,  5100U, 0xE3C8U,  8U, 0x00U },
+    { 0x000000C9U,  5108U, 0xE58AU,  8U, 0x00U },
+    { 0x000004C1U,  5116U, 0xE6E9U,  8U, 0x00U },
+    { 0x000001E5U,  5124U, 0xEE2DU,  8U, 0x00U },
+    { 0x00000120U,  5132U, 0xEF32U,  8U, 0x00U },
+    { 0x00000130U,  5140U, 0xF391U,  8U, 0x00U },
+    { 0x000000F1U,  5148U, 0xF75FU,  8U, 0x00U },
+    { 0x000003C1U,  5156U, 0xF7FDU,  8U, 0x00U },
+    { 0x000000C9U,  5164U, 0xF908U,  8U, 0x00U },
+    { 0x00000200U,  5172U, 0xFC7CU, 16U, 0x06U },
+    { 0x00000300U,  5188U, 0x016BU, 12U, 0x06U },
+    { 0x18F00400U,  5200U, 0x09B4U,  8U, 0x01U },
+    { 0x000000F1U,  5208U, 0x0AD7U,  8U, 0x00U },
+    { 0x000001F5U,  5216U, 0x0C58U,  8U, 0x00U },
+    { 0x000000C9U,  5224U, 0x0CA3U,  8U, 0x00U },
+    { 0x00000600U,  5232U, 0x13C5U, 64U, 0x06U },
+    { 0x000001E5U,  5296U, 0x1536U,  8U, 0x00U },
+    { 0x18FEF100U,  5304U, 0x159FU,  8U, 0x01U },
+    { 0x00000120U,  5312U, 0x1654U,  8U, 0x00U },
+    { 0x00000130U,  5320U, 0x1A9FU,  8U, 0x00U },
+    { 0x000000F1U,  5328U, 0x1E59U,  8U, 0x00U },
+    { 0x000000C9U,  5336U, 0x202DU,  8U, 0x00U },
+    { 0x00000200U,  5344U, 0x238AU, 16U, 0x06U },
+    { 0x18F00400U,  5360U, 0x308BU,  8U, 0x01U },
+    { 0x00000504U,  5368U, 0x317EU,  8U, 0x00U },
+    { 0x000000F1U,  5376U, 0x320AU,  8U, 0x00U },
+    { 0x00000410U,  5384U, 0x339EU,  8U, 0x00U },
+    { 0x000000C9U,  5392U, 0x33B5U,  8U, 0x00U },
+    { 0x000001E5U,  5400U, 0x3C74U,  8U, 0x00U },
+    { 0x00000120U,  5408U, 0x3D71U,  8U, 0x00U },
+    { 0x00000130U,  5416U, 0x41A6U,  8U, 0x00U },
+    { 0x000000F1U,  5424U, 0x4585U,  8U, 0x00U },
+    { 0x000000C9U,  5432U, 0x4738U,  8U, 0x00U },
+    { 0x00000200U,  5440U, 0x4AA6U, 16U, 0x06U },
+    { 0x18F00400U,  5456U, 0x57AEU,  8U, 0x01U },
+    { 0x000000F1U,  5464U, 0x58ECU,  8U, 0x00U },
+    { 0x000000C9U,  5472U, 0x5AB1U,  8U, 0x00U },
+    { 0x00000300U,  5480U, 0x6301U, 12U, 0x06U },
+    { 0x000001E5U,  5492U, 0x636DU,  8U, 0x00U },
+    { 0x00000120U,  5500U, 0x6461U,  8U, 0x00U },
+    { 0x00000640U,  5508U, 0x66CDU, 32U, 0x06U },
+    { 0x00000130U,  5540U, 0x68D0U,  8U, 0x00U },
+    { 0x000000F1U,  5548U, 0x6CC0U,  8U, 0x00U },
+    { 0x000001F5U,  5556U, 0x6E05U,  8U, 0x00U },
+    { 0x000000C9U,  5564U, 0x6E47U,  8U, 0x00U },
+    { 0x00000200U,  5572U, 0x71D1U, 16U, 0x06U },
+    { 0x00000600U,  5588U, 0x75AEU, 64U, 0x06U },
+    { 0x000002A0U,  5652U, 0x7C4EU,  8U, 0x00U },
+    { 0x00000500U,  5660U, 0x7D04U,  8U, 0x00U },
+    { 0x18F00400U,  5668U, 0x7E9AU,  8U, 0x01U },
+    { 0x000000F1U,  5676U, 0x7FE7U,  8U, 0x00U },
+    { 0x000000C9U,  5684U, 0x81E7U,  8U, 0x00U },
+    { 0x000003E9U,  5692U, 0x86C6U,  8U, 0x00U },
+    { 0x000001E5U,  5700U, 0x8A67U,  8U, 0x00U },
+    { 0x00000120U,  5708U, 0x8B5DU,  8U, 0x00U },
+    { 0x00000130U,  5716U, 0x8FCFU,  8U, 0x00U },
+    { 0x000000F1U,  5724U, 0x93A2U,  8U, 0x00U },
+    { 0x000000C9U,  5732U, 0x955DU,  8U, 0x00U },
+    { 0x00000200U,  5740U, 0x98C8U, 16U, 0x06U },
+    { 0x18F00400U,  5756U, 0xA5B9U,  8U, 0x01U },
+    { 0x000000F1U,  5764U, 0xA70DU,  8U, 0x00U },
+    { 0x000000C9U,  5772U, 0xA8D8U,  8U, 0x00U },
+    { 0x000004C1U,  5780U, 0xAA3BU,  8U, 0x00U },
+    { 0x000001E5U,  5788U, 0xB185U,  8U, 0x00U },
+    { 0x00000120U,  5796U, 0xB296U,  8U, 0x00U },
+    { 0x00000130U,  5804U, 0xB6DAU,  8U, 0x00U },
+    { 0x000000F1U,  5812U, 0xBA9EU,  8U, 0x00U },
+    { 0x000003C1U,  5820U, 0xBB61U,  8U, 0x00U },
+    { 0x000000C9U,  5828U, 0xBC49U,  8U, 0x00U },
+    { 0x00000200U,  5836U, 0xBFDCU, 16U, 0x06U },
+    { 0x000007E8U,  5852U, 0xC43DU,  8U, 0x00U },
+    { 0x00000300U,  5860U, 0xC4C2U, 12U, 0x06U },
+    { 0x18F00400U,  5872U, 0xCC9EU,  8U, 0x01U },
+    { 0x000000F1U,  5880U, 0xCE35U,  8U, 0x00U },
+    { 0x00000506U,  5888U, 0xCF4BU,  8U, 0x00U },
+    { 0x000001F5U,  5896U, 0xCFBDU,  8U, 0x00U },
+    { 0x000000C9U,  5904U, 0xCFF9U,  8U, 0x00U },
+    { 0x00000600U,  5912U, 0xD77EU, 64U, 0x06U },
+    { 0x000001E5U,  5976U, 0xD8B1U,  8U, 0x00U },
+    { 0x18FEF100U,  5984U, 0xD8EEU,  8U, 0x01U },
+    { 0x00000120U,  5992U, 0xD9B3U,  8U, 0x00U },
+    { 0x00000130U,  6000U, 0xDDAAU,  8U, 0x00U },
+    { 0x000000F1U,  6008U, 0xE1B1U,  8U, 0x00U },
+    { 0x000000C9U,  6016U, 0xE399U,  8U, 0x00U },
+    { 0x00000200U,  6024U, 0xE6EDU, 16U, 0x06U },
+    { 0x18F00400U,  6040U, 0xF407U,  8U, 0x01U },
+    { 0x000000F1U,  6048U, 0xF544U,  8U, 0x00U },
+    { 0x000000C9U,  6056U, 0xF6E0U,  8U, 0x00U },
+    { 0x000001E5U,  6064U, 0xFF92U,  8U, 0x00U },
+    { 0x00000120U,  6072U, 0x009EU,  8U, 0x00U },
+    { 0x00000130U,  6080U, 0x0505U,  8U, 0x00U },
+    { 0x000000F1U,  6088U, 0x0895U,  8U, 0x00U },
+    { 0x000000C9U,  6096U, 0x0A94U,  8U, 0x00U },
+    { 0x00000200U,  6104U, 0x0DE7U, 16U, 0x06U },
+    { 0x18F00400U,  6120U, 0x1B0DU,  8U, 0x01U },
+    { 0x000000F1U,  6128U, 0x1C1EU,  8U, 0x00U },
+    { 0x000000C9U,  6136U, 0x1DFFU,  8U, 0x00U },
+    { 0x00000300U,  6144U, 0x2686U, 12U, 0x06U },
+    { 0x000001E5U,  6156U, 0x26B3U,  8U, 0x00U },
+    { 0x00000120U,  6164U, 0x27D7U,  8U, 0x00U },
+    { 0x00000640U,  6172U, 0x2A2EU, 32U, 0x06U },
+    { 0x00000130U,  6204U, 0x2C1FU,  8U, 0x00U },
+    { 0x000000F1U,  6212U, 0x2FDAU,  8U, 0x00U },
+    { 0x000001F5U,  6220U, 0x3162U,  8U, 0x00U },
+    { 0x000000C9U,  6228U, 0x3182U,  8U, 0x00U },
+    { 0x00000200U,  6236U, 0x351FU, 16U, 0x06U },
+    { 0x00000600U,  6252U, 0x38F7U, 64U, 0x06U },
+    { 0x000002A0U,  6316U, 0x3FA9U,  8U, 0x00U },
+    { 0x18F00400U,  6324U, 0x41DCU,  8U, 0x01U },
+    { 0x000000F1U,  6332U, 0x433BU,  8U, 0x00U },
+    { 0x000000C9U,  6340U, 0x452BU,  8U, 0x00U },
+    { 0x000003E9U,  6348U, 0x4A32U,  8U, 0x00U },
+    { 0x000001E5U,  6356U, 0x4DB6U,  8U, 0x00U },
+    { 0x00000120U,  6364U, 0x4EBEU,  8U, 0x00U },
+    { 0x00000130U,  6372U, 0x5307U,  8U, 0x00U },
+    { 0x000000F1U,  6380U, 0x56C2U,  8U, 0x00U },
+    { 0x000000C9U,  6388U, 0x58D5U,  8U, 0x00U },
+    { 0x00000200U,  6396U, 0x5C0CU, 16U, 0x06U },
+    { 0x18F00400U,  6412U, 0x68E5U,  8U, 0x01U },
+    { 0x000000F1U,  6420U, 0x6A3EU,  8U, 0x00U },
+    { 0x000000C9U,  6428U, 0x6C05U,  8U, 0x00U },
+    { 0x000004C1U,  6436U, 0x6DB0U,  8U, 0x00U },
+    { 0x000001E5U,  6444U, 0x74D6U,  8U, 0x00U },
+    { 0x00000120U,  6452U, 0x75C0U,  8U, 0x00U },
+    { 0x00000130U,  6460U, 0x7A13U,  8U, 0x00U },
+    { 0x000000F1U,  6468U, 0x7E0BU,  8U, 0x00U },
+    { 0x000003C1U,  6476U, 0x7EA9U,  8U, 0x00U },
+    { 0x000000C9U,  6484U, 0x7FC0U,  8U, 0x00U },
+    { 0x00000200U,  6492U, 0x832CU, 16U, 0x06U },
+    { 0x00000300U,  6508U, 0x87F0U, 12U, 0x06U },
+    { 0x18F00400U,  6520U, 0x8FF2U,  8U, 0x01U },
+    { 0x000000F1U,  6528U, 0x9186U,  8U, 0x00U },
+    { 0x000001F5U,  6536U, 0x9311U,  8U, 0x00U },
+    { 0x000000C9U,  6544U, 0x934BU,  8U, 0x00U },
+    { 0x00000600U,  6552U, 0x9AC8U, 64U, 0x06U },
+    { 0x000001E5U,  6616U, 0x9BD9U,  8U, 0x00U },
+    { 0x18FEF100U,  6624U, 0x9C28U,  8U, 0x01U },
+    { 0x00000120U,  6632U, 0x9CE7U,  8U, 0x00U },
+};
+
+/* 6640 payload bytes */
+static const uint8_t fzip_trace_data[] =
+{
+    0xD0U, 0x07U, 0xD1U, 0x07U, 0xD1U, 0x07U, 0xD1U, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x01U, 0x5BU, 0x08U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x01U, 0xF9U, 0x01U, 0x01U, 0x06U, 0x09U, 0x0CU, 0x0FU, 0x12U, 0x15U, 0x18U,
+    0x1BU, 0x1EU, 0x21U, 0x24U, 0x27U, 0x2AU, 0x2DU, 0x0AU, 0x07U, 0x3CU, 0x10U,
+    0x00U, 0x00U, 0x01U, 0xFBU, 0x04U, 0x40U, 0x01U, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x58U, 0x10U, 0x21U,
+    0x32U, 0x43U, 0x54U, 0x65U, 0x76U, 0x87U, 0x0DU, 0x07U, 0x3CU, 0x10U, 0x00U,
+    0x00U, 0x02U, 0xC7U, 0x03U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U,
+    0xD0U, 0x07U, 0xD0U, 0x07U, 0xD1U, 0x07U, 0xD0U, 0x07U, 0xD1U, 0x07U, 0xD1U,
+    0x07U, 0xD1U, 0x07U, 0xD1U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x03U, 0x59U, 0x11U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x03U, 0xC2U, 0x02U,
+    0x01U, 0x06U, 0x09U, 0x0CU, 0x0FU, 0x12U, 0x15U, 0x18U, 0x1BU, 0x1EU, 0x21U,
+    0x24U, 0x27U, 0x2AU, 0x2DU, 0x0EU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x02U,
+    0xC6U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x5EU, 0x13U, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x04U, 0xCFU, 0x00U, 0x11U, 0x22U, 0x33U, 0x44U,
+    0x55U, 0x66U, 0x77U, 0x88U, 0x99U, 0xAAU, 0xBBU, 0x07U, 0x80U, 0x02U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x02U, 0xD2U, 0x07U, 0xD2U, 0x07U, 0xD1U, 0x07U, 0xD1U,
+    0x07U, 0x01U, 0x47U, 0x4EU, 0x55U, 0x5CU, 0x63U, 0x6AU, 0x71U, 0x78U, 0x7FU,
+    0x01U, 0x8DU, 0x94U, 0x9BU, 0xA2U, 0xA9U, 0xB0U, 0xB7U, 0xBEU, 0xC5U, 0xCCU,
+    0xD3U, 0xDAU, 0xE1U, 0xE8U, 0xEFU, 0xF6U, 0xFDU, 0x04U, 0x0BU, 0x12U, 0x19U,
+    0xD2U, 0x07U, 0xD2U, 0x07U, 0xD1U, 0x07U, 0xD1U, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x05U, 0x5FU, 0xF5U, 0x06U, 0x17U, 0x28U, 0x39U, 0x4AU,
+    0x5BU, 0x6CU, 0x15U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x05U, 0xC8U, 0x03U,
+    0x01U, 0x06U, 0x09U, 0x0CU, 0x0FU, 0x12U, 0x15U, 0x18U, 0x1BU, 0x1EU, 0x21U,
+    0x24U, 0x27U, 0x2AU, 0x2DU, 0x01U, 0x07U, 0x0EU, 0x15U, 0x1CU, 0x23U, 0x2AU,
+    0x31U, 0x38U, 0x3FU, 0x02U, 0x4DU, 0x54U, 0x5BU, 0x62U, 0x69U, 0x70U, 0x77U,
+    0x7EU, 0x85U, 0x8CU, 0x93U, 0x9AU, 0xA1U, 0xA8U, 0xAFU, 0xB6U, 0xBDU, 0xC4U,
+    0xCBU, 0xD2U, 0xD9U, 0xE0U, 0xE7U, 0xEEU, 0xF5U, 0xFCU, 0x03U, 0x0AU, 0x11U,
+    0x18U, 0x1FU, 0x26U, 0x2DU, 0x34U, 0x3BU, 0x42U, 0x49U, 0x50U, 0x57U, 0x5EU,
+    0x65U, 0x6CU, 0x73U, 0x7AU, 0x81U, 0x88U, 0x8FU, 0x96U, 0x9DU, 0xA4U, 0xABU,
+    0xB2U, 0xB9U, 0xA0U, 0xB1U, 0xC2U, 0xD3U, 0xE4U, 0xF5U, 0x06U, 0x17U, 0x00U,
+    0x40U, 0x01U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x18U, 0x07U, 0x3CU, 0x10U,
+    0x00U, 0x00U, 0x03U, 0xCBU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x06U,
+    0x5CU, 0x19U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x06U, 0xD7U, 0x45U, 0x42U,
+    0x0FU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0BU, 0x80U, 0x02U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x03U, 0xD1U, 0x07U, 0xD1U, 0x07U, 0xD1U, 0x07U, 0xD1U, 0x07U,
+    0xD1U, 0x07U, 0xD2U, 0x07U, 0xD1U, 0x07U, 0xD2U, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x07U, 0x5DU, 0x19U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x07U, 0xD6U, 0x04U, 0x01U, 0x06U, 0x09U, 0x0CU, 0x0FU, 0x12U, 0x15U, 0x18U,
+    0x1BU, 0x1EU, 0x21U, 0x24U, 0x27U, 0x2AU, 0x2DU, 0x19U, 0x07U, 0x3CU, 0x10U,
+    0x00U, 0x00U, 0x04U, 0xD5U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U,
+    0x52U, 0x1BU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x08U, 0xD3U, 0x50U, 0x40U,
+    0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x80U, 0x02U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x04U, 0xD2U, 0x07U, 0xD3U, 0x07U, 0xD3U, 0x07U, 0xD2U, 0x07U,
+    0xD2U, 0x07U, 0xD2U, 0x07U, 0xD3U, 0x07U, 0xD3U, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x09U, 0x53U, 0x50U, 0x40U, 0xFFU, 0xFFU, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x21U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x09U, 0xD8U, 0x05U,
+    0x01U, 0x06U, 0x09U, 0x0CU, 0x0FU, 0x12U, 0x15U, 0x18U, 0x1BU, 0x1EU, 0x21U,
+    0x24U, 0x27U, 0x2AU, 0x2DU, 0x00U, 0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U,
+    0x77U, 0x88U, 0x99U, 0xAAU, 0xBBU, 0x03U, 0x7FU, 0x22U, 0x31U, 0xAAU, 0xAAU,
+    0xAAU, 0xAAU, 0x03U, 0x7FU, 0x22U, 0x31U, 0xAAU, 0xAAU, 0xAAU, 0xAAU, 0x1FU,
+    0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x05U, 0xD2U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x0AU, 0x50U, 0x06U, 0x40U, 0x01U, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xF5U, 0x06U, 0x17U, 0x28U, 0x39U, 0x4AU, 0x5BU, 0x6CU, 0x22U, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x0AU, 0xDAU, 0x02U, 0x07U, 0x0EU, 0x15U, 0x1CU,
+    0x23U, 0x2AU, 0x31U, 0x38U, 0x3FU, 0x04U, 0x4DU, 0x54U, 0x5BU, 0x62U, 0x69U,
+    0x70U, 0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U, 0x9AU, 0xA1U, 0xA8U, 0xAFU, 0xB6U,
+    0xBDU, 0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U, 0xE7U, 0xEEU, 0xF5U, 0xFCU, 0x03U,
+    0x0AU, 0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU, 0x34U, 0x3BU, 0x42U, 0x49U, 0x50U,
+    0x57U, 0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU, 0x81U, 0x88U, 0x8FU, 0x96U, 0x9DU,
+    0xA4U, 0xABU, 0xB2U, 0xB9U, 0x13U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x05U, 0xF0U, 0xFFU, 0x00U, 0x12U, 0x34U, 0xFFU, 0xFFU, 0xFFU, 0xD2U, 0x07U,
+    0xD2U, 0x07U, 0xD3U, 0x07U, 0xD3U, 0x07U, 0xD4U, 0x07U, 0xD3U, 0x07U, 0xD4U,
+    0x07U, 0xD4U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0BU, 0x51U,
+    0x21U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0BU, 0xDAU, 0x06U, 0x01U, 0x06U,
+    0x09U, 0x0CU, 0x0FU, 0x12U, 0x15U, 0x18U, 0x1BU, 0x1EU, 0x21U, 0x24U, 0x27U,
+    0x2AU, 0x2DU, 0x29U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x06U, 0x27U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0x56U, 0x29U, 0x07U, 0x3CU, 0x10U,
+    0x00U, 0x00U, 0x0CU, 0x2DU, 0x17U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x06U, 0xD3U, 0x07U, 0xD4U, 0x07U, 0xD3U, 0x07U, 0xD3U, 0x07U, 0xD3U, 0x07U,
+    0xD4U, 0x07U, 0xD3U, 0x07U, 0xD3U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x0DU, 0x57U, 0x29U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0DU, 0x2CU,
+    0x07U, 0x01U, 0x06U, 0x09U, 0x0CU, 0x0FU, 0x12U, 0x15U, 0x18U, 0x1BU, 0x1EU,
+    0x21U, 0x24U, 0x27U, 0x2AU, 0x2DU, 0x2BU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x07U, 0x20U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x54U, 0x2EU,
+    0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0EU, 0x2AU, 0x00U, 0x11U, 0x22U, 0x33U,
+    0x44U, 0x55U, 0x66U, 0x77U, 0x88U, 0x99U, 0xAAU, 0xBBU, 0x1BU, 0x80U, 0x02U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0xD4U, 0x07U, 0xD5U, 0x07U, 0xD5U, 0x07U,
+    0xD4U, 0x07U, 0x02U, 0x47U, 0x4EU, 0x55U, 0x5CU, 0x63U, 0x6AU, 0x71U, 0x78U,
+    0x7FU, 0x06U, 0x8DU, 0x94U, 0x9BU, 0xA2U, 0xA9U, 0xB0U, 0xB7U, 0xBEU, 0xC5U,
+    0xCCU, 0xD3U, 0xDAU, 0xE1U, 0xE8U, 0xEFU, 0xF6U, 0xFDU, 0x04U, 0x0BU, 0x12U,
+    0x19U, 0xD4U, 0x07U, 0xD5U, 0x07U, 0xD4U, 0x07U, 0xD4U, 0x07U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x55U, 0xF5U, 0x06U, 0x17U, 0x28U, 0x39U,
+    0x4AU, 0x5BU, 0x6CU, 0x2EU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0FU, 0x35U,
+    0x08U, 0x01U, 0x06U, 0x09U, 0x0CU, 0x0FU, 0x12U, 0x15U, 0x18U, 0x1BU, 0x1EU,
+    0x21U, 0x24U, 0x27U, 0x2AU, 0x2DU, 0x03U, 0x07U, 0x0EU, 0x15U, 0x1CU, 0x23U,
+    0x2AU, 0x31U, 0x38U, 0x3FU, 0x07U, 0x4DU, 0x54U, 0x5BU, 0x62U, 0x69U, 0x70U,
+    0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U, 0x9AU, 0xA1U, 0xA8U, 0xAFU, 0xB6U, 0xBDU,
+    0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U, 0xE7U, 0xEEU, 0xF5U, 0xFCU, 0x03U, 0x0AU,
+    0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU, 0x34U, 0x3BU, 0x42U, 0x49U, 0x50U, 0x57U,
+    0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU, 0x81U, 0x88U, 0x8FU, 0x96U, 0x9DU, 0xA4U,
+    0xABU, 0xB2U, 0xB9U, 0xA0U, 0xB1U, 0xC2U, 0xD3U, 0xE4U, 0xF5U, 0x06U, 0x17U,
+    0x30U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x08U, 0x2EU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x5AU, 0x34U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x00U, 0x22U, 0x4FU, 0x42U, 0x0FU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1FU,
+    0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0xD4U, 0x07U, 0xD4U, 0x07U,
+    0xD4U, 0x07U, 0xD5U, 0x07U, 0xD4U, 0x07U, 0xD5U, 0x07U, 0xD4U, 0x07U, 0xD5U,
+    0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x5BU, 0x35U, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x01U, 0x2CU, 0x09U, 0x01U, 0x06U, 0x09U, 0x0CU,
+    0x0FU, 0x12U, 0x15U, 0x18U, 0x1BU, 0x1EU, 0x21U, 0x24U, 0x27U, 0x2AU, 0x2DU,
+    0x36U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x09U, 0x37U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x02U, 0x58U, 0x35U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x02U, 0x2FU, 0x50U, 0x40U, 0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0x22U,
+    0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x09U, 0xD5U, 0x07U, 0xD6U, 0x07U,
+    0xD6U, 0x07U, 0xD5U, 0x07U, 0xD5U, 0x07U, 0xD6U, 0x07U, 0xD6U, 0x07U, 0xD6U,
+    0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x59U, 0x50U, 0x40U,
+    0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0x38U, 0x07U, 0x3CU, 0x10U, 0x00U,
+    0x00U, 0x03U, 0x2BU, 0x0AU, 0x01U, 0x07U, 0x0AU, 0x0DU, 0x10U, 0x13U, 0x16U,
+    0x19U, 0x1CU, 0x1FU, 0x22U, 0x25U, 0x28U, 0x2BU, 0x2EU, 0x00U, 0x11U, 0x22U,
+    0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U, 0x99U, 0xAAU, 0xBBU, 0x3BU, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x0AU, 0x3DU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x04U, 0x5EU, 0x03U, 0x7FU, 0x22U, 0x31U, 0xAAU, 0xAAU, 0xAAU, 0xAAU,
+    0xF5U, 0x06U, 0x17U, 0x28U, 0x39U, 0x4AU, 0x5BU, 0x6CU, 0x3BU, 0x07U, 0x3CU,
+    0x10U, 0x00U, 0x00U, 0x04U, 0x37U, 0x04U, 0x07U, 0x0EU, 0x15U, 0x1CU, 0x23U,
+    0x2AU, 0x31U, 0x38U, 0x3FU, 0x09U, 0x4DU, 0x54U, 0x5BU, 0x62U, 0x69U, 0x70U,
+    0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U, 0x9AU, 0xA1U, 0xA8U, 0xAFU, 0xB6U, 0xBDU,
+    0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U, 0xE7U, 0xEEU, 0xF5U, 0xFCU, 0x03U, 0x0AU,
+    0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU, 0x34U, 0x3BU, 0x42U, 0x49U, 0x50U, 0x57U,
+    0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU, 0x81U, 0x88U, 0x8FU, 0x96U, 0x9DU, 0xA4U,
+    0xABU, 0xB2U, 0xB9U, 0x26U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0AU,
+    0xF0U, 0xFFU, 0x01U, 0x12U, 0x34U, 0xFFU, 0xFFU, 0xFFU, 0xD6U, 0x07U, 0xD5U,
+    0x07U, 0xD6U, 0x07U, 0xD5U, 0x07U, 0xD7U, 0x07U, 0xD6U, 0x07U, 0xD7U, 0x07U,
+    0xD6U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x05U, 0x5FU, 0x43U,
+    0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x05U, 0x3EU, 0x0BU, 0x01U, 0x07U, 0x0AU,
+    0x0DU, 0x10U, 0x13U, 0x16U, 0x19U, 0x1CU, 0x1FU, 0x22U, 0x25U, 0x28U, 0x2BU,
+    0x2EU, 0x42U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0BU, 0x05U, 0x04U, 0x40U,
+    0x01U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x06U, 0x5CU, 0x10U, 0x21U, 0x32U, 0x43U, 0x54U, 0x65U, 0x76U, 0x87U,
+    0x44U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x06U, 0x38U, 0x2AU, 0x80U, 0x02U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x0BU, 0xD7U, 0x07U, 0xD7U, 0x07U, 0xD6U, 0x07U,
+    0xD7U, 0x07U, 0xD7U, 0x07U, 0xD7U, 0x07U, 0xD7U, 0x07U, 0xD6U, 0x07U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x5DU, 0x47U, 0x07U, 0x3CU, 0x10U,
+    0x00U, 0x00U, 0x07U, 0x04U, 0x0CU, 0x01U, 0x07U, 0x0AU, 0x0DU, 0x10U, 0x13U,
+    0x16U, 0x19U, 0x1CU, 0x1FU, 0x22U, 0x25U, 0x28U, 0x2BU, 0x2EU, 0x4AU, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x0CU, 0x0CU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x08U, 0x52U, 0x46U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x08U, 0x04U,
+    0x00U, 0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U, 0x99U, 0xAAU,
+    0xBBU, 0x2DU, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0xD7U, 0x07U,
+    0xD8U, 0x07U, 0xD8U, 0x07U, 0xD8U, 0x07U, 0x03U, 0x7FU, 0x22U, 0x31U, 0xAAU,
+    0xAAU, 0xAAU, 0xAAU, 0x03U, 0x47U, 0x4EU, 0x55U, 0x5CU, 0x63U, 0x6AU, 0x71U,
+    0x78U, 0x7FU, 0x0BU, 0x8DU, 0x94U, 0x9BU, 0xA2U, 0xA9U, 0xB0U, 0xB7U, 0xBEU,
+    0xC5U, 0xCCU, 0xD3U, 0xDAU, 0xE1U, 0xE8U, 0xEFU, 0xF6U, 0xFDU, 0x04U, 0x0BU,
+    0x12U, 0x19U, 0xD8U, 0x07U, 0xD8U, 0x07U, 0xD7U, 0x07U, 0xD8U, 0x07U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x09U, 0x53U, 0xF5U, 0x06U, 0x17U, 0x28U,
+    0x39U, 0x4AU, 0x5BU, 0x6CU, 0x4DU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x09U,
+    0x0CU, 0x0DU, 0x01U, 0x07U, 0x0AU, 0x0DU, 0x10U, 0x13U, 0x16U, 0x19U, 0x1CU,
+    0x1FU, 0x22U, 0x25U, 0x28U, 0x2BU, 0x2EU, 0x05U, 0x07U, 0x0EU, 0x15U, 0x1CU,
+    0x23U, 0x2AU, 0x31U, 0x38U, 0x3FU, 0x0CU, 0x4DU, 0x54U, 0x5BU, 0x62U, 0x69U,
+    0x70U, 0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U, 0x9AU, 0xA1U, 0xA8U, 0xAFU, 0xB6U,
+    0xBDU, 0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U, 0xE7U, 0xEEU, 0xF5U, 0xFCU, 0x03U,
+    0x0AU, 0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU, 0x34U, 0x3BU, 0x42U, 0x49U, 0x50U,
+    0x57U, 0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU, 0x81U, 0x88U, 0x8FU, 0x96U, 0x9DU,
+    0xA4U, 0xABU, 0xB2U, 0xB9U, 0xA0U, 0xB1U, 0xC2U, 0xD3U, 0xE4U, 0xF5U, 0x06U,
+    0x17U, 0x00U, 0x40U, 0x01U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x4FU, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x0DU, 0x0AU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x0AU, 0x50U, 0x51U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0AU, 0x0BU,
+    0x59U, 0x42U, 0x0FU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x31U, 0x80U, 0x02U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x0DU, 0xD7U, 0x07U, 0xD7U, 0x07U, 0xD8U, 0x07U,
+    0xD7U, 0x07U, 0x03U, 0x7FU, 0x22U, 0x31U, 0xAAU, 0xAAU, 0xAAU, 0xAAU, 0xD7U,
+    0x07U, 0xD7U, 0x07U, 0xD8U, 0x07U, 0xD8U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x0BU, 0x51U, 0x4EU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0BU,
+    0x09U, 0x0EU, 0x01U, 0x07U, 0x0AU, 0x0DU, 0x10U, 0x13U, 0x16U, 0x19U, 0x1CU,
+    0x1FU, 0x22U, 0x25U, 0x28U, 0x2BU, 0x2EU, 0x54U, 0x07U, 0x3CU, 0x10U, 0x00U,
+    0x00U, 0x0EU, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0x56U,
+    0x51U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0CU, 0x15U, 0x50U, 0x40U, 0xFFU,
+    0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0x34U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x0EU, 0xD9U, 0x07U, 0xD8U, 0x07U, 0xD8U, 0x07U, 0xD8U, 0x07U, 0xD9U,
+    0x07U, 0xD8U, 0x07U, 0xD8U, 0x07U, 0xD9U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x0DU, 0x57U, 0x50U, 0x40U, 0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x55U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0DU, 0x10U, 0x0FU, 0x01U,
+    0x07U, 0x0AU, 0x0DU, 0x10U, 0x13U, 0x16U, 0x19U, 0x1CU, 0x1FU, 0x22U, 0x25U,
+    0x28U, 0x2BU, 0x2EU, 0x00U, 0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U,
+    0x88U, 0x99U, 0xAAU, 0xBBU, 0x58U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0FU,
+    0x1FU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x54U, 0x06U, 0x40U,
+    0x01U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xF5U, 0x06U, 0x17U, 0x28U, 0x39U,
+    0x4AU, 0x5BU, 0x6CU, 0x57U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0EU, 0x1DU,
+    0x06U, 0x07U, 0x0EU, 0x15U, 0x1CU, 0x23U, 0x2AU, 0x31U, 0x38U, 0x3FU, 0x0EU,
+    0x4DU, 0x54U, 0x5BU, 0x62U, 0x69U, 0x70U, 0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U,
+    0x9AU, 0xA1U, 0xA8U, 0xAFU, 0xB6U, 0xBDU, 0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U,
+    0xE7U, 0xEEU, 0xF5U, 0xFCU, 0x03U, 0x0AU, 0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU,
+    0x34U, 0x3BU, 0x42U, 0x49U, 0x50U, 0x57U, 0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU,
+    0x81U, 0x88U, 0x8FU, 0x96U, 0x9DU, 0xA4U, 0xABU, 0xB2U, 0xB9U, 0x38U, 0x80U,
+    0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0xF0U, 0xFFU, 0x02U, 0x12U, 0x34U,
+    0xFFU, 0xFFU, 0xFFU, 0xD8U, 0x07U, 0xD9U, 0x07U, 0xD8U, 0x07U, 0xD9U, 0x07U,
+    0xD9U, 0x07U, 0xD9U, 0x07U, 0xD9U, 0x07U, 0xDAU, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x0FU, 0x55U, 0x59U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x0FU, 0x1EU, 0x10U, 0x01U, 0x07U, 0x0AU, 0x0DU, 0x10U, 0x13U, 0x16U, 0x19U,
+    0x1CU, 0x1FU, 0x22U, 0x25U, 0x28U, 0x2BU, 0x2EU, 0x61U, 0x07U, 0x3CU, 0x10U,
+    0x00U, 0x00U, 0x00U, 0x11U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x5AU, 0x5FU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x00U, 0x17U, 0x3BU, 0x80U,
+    0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0xD9U, 0x07U, 0xDAU, 0x07U, 0xD9U,
+    0x07U, 0xD9U, 0x07U, 0xD9U, 0x07U, 0xD9U, 0x07U, 0xD9U, 0x07U, 0xDAU, 0x07U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x5BU, 0x5FU, 0x07U, 0x3CU,
+    0x10U, 0x00U, 0x00U, 0x01U, 0x16U, 0x11U, 0x01U, 0x07U, 0x0AU, 0x0DU, 0x10U,
+    0x13U, 0x16U, 0x19U, 0x1CU, 0x1FU, 0x22U, 0x25U, 0x28U, 0x2BU, 0x2EU, 0x63U,
+    0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x01U, 0x12U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x02U, 0x58U, 0x66U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x02U,
+    0x1EU, 0x00U, 0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U, 0x99U,
+    0xAAU, 0xBBU, 0x3EU, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x11U, 0xDBU,
+    0x07U, 0xDAU, 0x07U, 0xDAU, 0x07U, 0xDBU, 0x07U, 0x04U, 0x47U, 0x4EU, 0x55U,
+    0x5CU, 0x63U, 0x6AU, 0x71U, 0x78U, 0x7FU, 0x10U, 0x8DU, 0x94U, 0x9BU, 0xA2U,
+    0xA9U, 0xB0U, 0xB7U, 0xBEU, 0xC5U, 0xCCU, 0xD3U, 0xDAU, 0xE1U, 0xE8U, 0xEFU,
+    0xF6U, 0xFDU, 0x04U, 0x0BU, 0x12U, 0x19U, 0xDAU, 0x07U, 0xDAU, 0x07U, 0xDBU,
+    0x07U, 0xDAU, 0x07U, 0x03U, 0x7FU, 0x22U, 0x31U, 0xAAU, 0xAAU, 0xAAU, 0xAAU,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x59U, 0xF5U, 0x06U, 0x17U,
+    0x28U, 0x39U, 0x4AU, 0x5BU, 0x6CU, 0x65U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x03U, 0x1EU, 0x12U, 0x01U, 0x07U, 0x0AU, 0x0DU, 0x10U, 0x13U, 0x16U, 0x19U,
+    0x1CU, 0x1FU, 0x22U, 0x25U, 0x28U, 0x2BU, 0x2EU, 0x07U, 0x07U, 0x0EU, 0x15U,
+    0x1CU, 0x23U, 0x2AU, 0x31U, 0x38U, 0x3FU, 0x11U, 0x4DU, 0x54U, 0x5BU, 0x62U,
+    0x69U, 0x70U, 0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U, 0x9AU, 0xA1U, 0xA8U, 0xAFU,
+    0xB6U, 0xBDU, 0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U, 0xE7U, 0xEEU, 0xF5U, 0xFCU,
+    0x03U, 0x0AU, 0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU, 0x34U, 0x3BU, 0x42U, 0x49U,
+    0x50U, 0x57U, 0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU, 0x81U, 0x88U, 0x8FU, 0x96U,
+    0x9DU, 0xA4U, 0xABU, 0xB2U, 0xB9U, 0xA0U, 0xB1U, 0xC2U, 0xD3U, 0xE4U, 0xF5U,
+    0x06U, 0x17U, 0x69U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x02U, 0x1BU, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x5EU, 0x67U, 0x07U, 0x3CU, 0x10U,
+    0x00U, 0x00U, 0x04U, 0x1BU, 0x63U, 0x42U, 0x0FU, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x41U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x12U, 0xDAU, 0x07U,
+    0xDAU, 0x07U, 0xDBU, 0x07U, 0xDBU, 0x07U, 0xDBU, 0x07U, 0xDAU, 0x07U, 0xDBU,
+    0x07U, 0xDAU, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x05U, 0x5FU,
+    0x69U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x05U, 0x64U, 0x13U, 0x01U, 0x07U,
+    0x0AU, 0x0DU, 0x10U, 0x13U, 0x16U, 0x19U, 0x1CU, 0x1FU, 0x22U, 0x25U, 0x28U,
+    0x2BU, 0x2EU, 0x6EU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x03U, 0x61U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x06U, 0x5CU, 0x6FU, 0x07U, 0x3CU, 0x10U,
+    0x00U, 0x00U, 0x06U, 0x6DU, 0x50U, 0x40U, 0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x44U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x13U, 0xDCU, 0x07U,
+    0xDBU, 0x07U, 0xDCU, 0x07U, 0xDCU, 0x07U, 0xDCU, 0x07U, 0xDBU, 0x07U, 0xDCU,
+    0x07U, 0xDBU, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x5DU,
+    0x50U, 0x40U, 0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0x70U, 0x07U, 0x3CU,
+    0x10U, 0x00U, 0x00U, 0x07U, 0x6FU, 0x14U, 0x01U, 0x08U, 0x0BU, 0x0EU, 0x11U,
+    0x14U, 0x17U, 0x1AU, 0x1DU, 0x20U, 0x23U, 0x26U, 0x29U, 0x2CU, 0x2FU, 0x00U,
+    0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U, 0x99U, 0xAAU, 0xBBU,
+    0x72U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x04U, 0x6CU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x08U, 0x52U, 0xF5U, 0x06U, 0x17U, 0x28U, 0x39U, 0x4AU,
+    0x5BU, 0x6CU, 0x71U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x08U, 0x69U, 0x08U,
+    0x07U, 0x0EU, 0x15U, 0x1CU, 0x23U, 0x2AU, 0x31U, 0x38U, 0x3FU, 0x13U, 0x4DU,
+    0x54U, 0x5BU, 0x62U, 0x69U, 0x70U, 0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U, 0x9AU,
+    0xA1U, 0xA8U, 0xAFU, 0xB6U, 0xBDU, 0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U, 0xE7U,
+    0xEEU, 0xF5U, 0xFCU, 0x03U, 0x0AU, 0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU, 0x34U,
+    0x3BU, 0x42U, 0x49U, 0x50U, 0x57U, 0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU, 0x81U,
+    0x88U, 0x8FU, 0x96U, 0x9DU, 0xA4U, 0xABU, 0xB2U, 0xB9U, 0x47U, 0x80U, 0x02U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x14U, 0xF0U, 0xFFU, 0x03U, 0x12U, 0x34U, 0xFFU,
+    0xFFU, 0xFFU, 0xDCU, 0x07U, 0xDBU, 0x07U, 0xDBU, 0x07U, 0xDBU, 0x07U, 0xDCU,
+    0x07U, 0xDDU, 0x07U, 0xDCU, 0x07U, 0xDDU, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x09U, 0x53U, 0x75U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x09U,
+    0x74U, 0x15U, 0x01U, 0x08U, 0x0BU, 0x0EU, 0x11U, 0x14U, 0x17U, 0x1AU, 0x1DU,
+    0x20U, 0x23U, 0x26U, 0x29U, 0x2CU, 0x2FU, 0x78U, 0x07U, 0x3CU, 0x10U, 0x00U,
+    0x00U, 0x05U, 0x75U, 0x04U, 0x40U, 0x01U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0AU, 0x50U, 0x03U, 0x7FU, 0x22U,
+    0x31U, 0xAAU, 0xAAU, 0xAAU, 0xAAU, 0x10U, 0x21U, 0x32U, 0x43U, 0x54U, 0x65U,
+    0x76U, 0x87U, 0x77U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0AU, 0x71U, 0x4AU,
+    0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x15U, 0xDCU, 0x07U, 0xDDU, 0x07U,
+    0xDCU, 0x07U, 0xDCU, 0x07U, 0xDDU, 0x07U, 0xDDU, 0x07U, 0xDCU, 0x07U, 0xDDU,
+    0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0BU, 0x51U, 0x7EU, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x0BU, 0x79U, 0x16U, 0x01U, 0x08U, 0x0BU, 0x0EU,
+    0x11U, 0x14U, 0x17U, 0x1AU, 0x1DU, 0x20U, 0x23U, 0x26U, 0x29U, 0x2CU, 0x2FU,
+    0x82U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x06U, 0x7EU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x0CU, 0x56U, 0x81U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x0CU, 0x45U, 0x00U, 0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U,
+    0x99U, 0xAAU, 0xBBU, 0x4CU, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x16U,
+    0xDEU, 0x07U, 0xDDU, 0x07U, 0xDEU, 0x07U, 0xDDU, 0x07U, 0x05U, 0x47U, 0x4EU,
+    0x55U, 0x5CU, 0x63U, 0x6AU, 0x71U, 0x78U, 0x7FU, 0x15U, 0x8DU, 0x94U, 0x9BU,
+    0xA2U, 0xA9U, 0xB0U, 0xB7U, 0xBEU, 0xC5U, 0xCCU, 0xD3U, 0xDAU, 0xE1U, 0xE8U,
+    0xEFU, 0xF6U, 0xFDU, 0x04U, 0x0BU, 0x12U, 0x19U, 0xDDU, 0x07U, 0xDEU, 0x07U,
+    0xDDU, 0x07U, 0xDEU, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0DU,
+    0x57U, 0xF5U, 0x06U, 0x17U, 0x28U, 0x39U, 0x4AU, 0x5BU, 0x6CU, 0x80U, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x0DU, 0x45U, 0x17U, 0x01U, 0x08U, 0x0BU, 0x0EU,
+    0x11U, 0x14U, 0x17U, 0x1AU, 0x1DU, 0x20U, 0x23U, 0x26U, 0x29U, 0x2CU, 0x2FU,
+    0x09U, 0x07U, 0x0EU, 0x15U, 0x1CU, 0x23U, 0x2AU, 0x31U, 0x38U, 0x3FU, 0x16U,
+    0x4DU, 0x54U, 0x5BU, 0x62U, 0x69U, 0x70U, 0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U,
+    0x9AU, 0xA1U, 0xA8U, 0xAFU, 0xB6U, 0xBDU, 0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U,
+    0xE7U, 0xEEU, 0xF5U, 0xFCU, 0x03U, 0x0AU, 0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU,
+    0x34U, 0x3BU, 0x42U, 0x49U, 0x50U, 0x57U, 0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU,
+    0x81U, 0x88U, 0x8FU, 0x96U, 0x9DU, 0xA4U, 0xABU, 0xB2U, 0xB9U, 0xA0U, 0xB1U,
+    0xC2U, 0xD3U, 0xE4U, 0xF5U, 0x06U, 0x17U, 0x00U, 0x40U, 0x01U, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0x81U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x07U, 0x7EU,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x54U, 0x87U, 0x07U, 0x3CU,
+    0x10U, 0x00U, 0x00U, 0x0EU, 0x4DU, 0x6DU, 0x42U, 0x0FU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x4FU, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x17U, 0xDEU,
+    0x07U, 0xDDU, 0x07U, 0xDEU, 0x07U, 0xDEU, 0x07U, 0xDEU, 0x07U, 0xDEU, 0x07U,
+    0xDEU, 0x07U, 0xDDU, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU,
+    0x55U, 0x89U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0FU, 0x4EU, 0x18U, 0x01U,
+    0x08U, 0x0BU, 0x0EU, 0x11U, 0x14U, 0x17U, 0x1AU, 0x1DU, 0x20U, 0x23U, 0x26U,
+    0x29U, 0x2CU, 0x2FU, 0x8AU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x08U, 0x40U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x5AU, 0x87U, 0x07U, 0x3CU,
+    0x10U, 0x00U, 0x00U, 0x00U, 0x7FU, 0x50U, 0x40U, 0xFFU, 0xFFU, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x51U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x18U, 0xDFU,
+    0x07U, 0xDEU, 0x07U, 0xDFU, 0x07U, 0xDFU, 0x07U, 0xDEU, 0x07U, 0xDFU, 0x07U,
+    0xDFU, 0x07U, 0xDEU, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U,
+    0x5BU, 0x50U, 0x40U, 0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0x8CU, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x01U, 0x45U, 0x19U, 0x01U, 0x08U, 0x0BU, 0x0EU,
+    0x11U, 0x14U, 0x17U, 0x1AU, 0x1DU, 0x20U, 0x23U, 0x26U, 0x29U, 0x2CU, 0x2FU,
+    0x00U, 0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U, 0x99U, 0xAAU,
+    0xBBU, 0x8EU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x09U, 0x4FU, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x58U, 0x06U, 0x40U, 0x01U, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xF5U, 0x06U, 0x17U, 0x28U, 0x39U, 0x4AU, 0x5BU, 0x6CU,
+    0x8CU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x02U, 0x44U, 0x0AU, 0x07U, 0x0EU,
+    0x15U, 0x1CU, 0x23U, 0x2AU, 0x31U, 0x38U, 0x3FU, 0x18U, 0x4DU, 0x54U, 0x5BU,
+    0x62U, 0x69U, 0x70U, 0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U, 0x9AU, 0xA1U, 0xA8U,
+    0xAFU, 0xB6U, 0xBDU, 0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U, 0xE7U, 0xEEU, 0xF5U,
+    0xFCU, 0x03U, 0x0AU, 0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU, 0x34U, 0x3BU, 0x42U,
+    0x49U, 0x50U, 0x57U, 0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU, 0x81U, 0x88U, 0x8FU,
+    0x96U, 0x9DU, 0xA4U, 0xABU, 0xB2U, 0xB9U, 0x53U, 0x80U, 0x02U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x19U, 0xF0U, 0xFFU, 0x04U, 0x12U, 0x34U, 0xFFU, 0xFFU, 0xFFU,
+    0xDFU, 0x07U, 0xDEU, 0x07U, 0xDEU, 0x07U, 0xDFU, 0x07U, 0xDFU, 0x07U, 0xDFU,
+    0x07U, 0xDFU, 0x07U, 0xDFU, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x03U, 0x59U, 0x92U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x03U, 0x4DU, 0x1AU,
+    0x01U, 0x08U, 0x0BU, 0x0EU, 0x11U, 0x14U, 0x17U, 0x1AU, 0x1DU, 0x20U, 0x23U,
+    0x26U, 0x29U, 0x2CU, 0x2FU, 0x97U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0AU,
+    0x51U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x5EU, 0x92U, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x04U, 0x4CU, 0x56U, 0x80U, 0x02U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x1AU, 0xDFU, 0x07U, 0xDFU, 0x07U, 0xE0U, 0x07U, 0xE0U, 0x07U,
+    0xE0U, 0x07U, 0xE0U, 0x07U, 0xE0U, 0x07U, 0xDFU, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x05U, 0x5FU, 0x97U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x05U, 0x4AU, 0x1BU, 0x01U, 0x08U, 0x0BU, 0x0EU, 0x11U, 0x14U, 0x17U, 0x1AU,
+    0x1DU, 0x20U, 0x23U, 0x26U, 0x29U, 0x2CU, 0x2FU, 0x98U, 0x07U, 0x3CU, 0x10U,
+    0x00U, 0x00U, 0x0BU, 0x53U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x06U,
+    0x5CU, 0x97U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x06U, 0x55U, 0x00U, 0x11U,
+    0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U, 0x99U, 0xAAU, 0xBBU, 0x57U,
+    0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1BU, 0xE0U, 0x07U, 0xE0U, 0x07U,
+    0xE1U, 0x07U, 0xE0U, 0x07U, 0x06U, 0x47U, 0x4EU, 0x55U, 0x5CU, 0x63U, 0x6AU,
+    0x71U, 0x78U, 0x7FU, 0x1AU, 0x8DU, 0x94U, 0x9BU, 0xA2U, 0xA9U, 0xB0U, 0xB7U,
+    0xBEU, 0xC5U, 0xCCU, 0xD3U, 0xDAU, 0xE1U, 0xE8U, 0xEFU, 0xF6U, 0xFDU, 0x04U,
+    0x0BU, 0x12U, 0x19U, 0xE1U, 0x07U, 0xE1U, 0x07U, 0xE1U, 0x07U, 0xE0U, 0x07U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U, 0x5DU, 0xF5U, 0x06U, 0x17U,
+    0x28U, 0x39U, 0x4AU, 0x5BU, 0x6CU, 0x99U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x07U, 0x56U, 0x1CU, 0x01U, 0x08U, 0x0BU, 0x0EU, 0x11U, 0x14U, 0x17U, 0x1AU,
+    0x1DU, 0x20U, 0x23U, 0x26U, 0x29U, 0x2CU, 0x2FU, 0x0BU, 0x07U, 0x0EU, 0x15U,
+    0x1CU, 0x23U, 0x2AU, 0x31U, 0x38U, 0x3FU, 0x1BU, 0x4DU, 0x54U, 0x5BU, 0x62U,
+    0x69U, 0x70U, 0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U, 0x9AU, 0xA1U, 0xA8U, 0xAFU,
+    0xB6U, 0xBDU, 0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U, 0xE7U, 0xEEU, 0xF5U, 0xFCU,
+    0x03U, 0x0AU, 0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU, 0x34U, 0x3BU, 0x42U, 0x49U,
+    0x50U, 0x57U, 0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU, 0x81U, 0x88U, 0x8FU, 0x96U,
+    0x9DU, 0xA4U, 0xABU, 0xB2U, 0xB9U, 0xA0U, 0xB1U, 0xC2U, 0xD3U, 0xE4U, 0xF5U,
+    0x06U, 0x17U, 0xA1U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0CU, 0xA5U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x52U, 0xA2U, 0x07U, 0x3CU, 0x10U,
+    0x00U, 0x00U, 0x08U, 0x58U, 0x77U, 0x42U, 0x0FU, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x59U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1CU, 0xE0U, 0x07U,
+    0xE1U, 0x07U, 0xE1U, 0x07U, 0xE1U, 0x07U, 0xE1U, 0x07U, 0xE1U, 0x07U, 0xE0U,
+    0x07U, 0xE1U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x09U, 0x53U,
+    0x9EU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x09U, 0x5FU, 0x1DU, 0x01U, 0x08U,
+    0x0BU, 0x0EU, 0x11U, 0x14U, 0x17U, 0x1AU, 0x1DU, 0x20U, 0x23U, 0x26U, 0x29U,
+    0x2CU, 0x2FU, 0x03U, 0x7FU, 0x22U, 0x31U, 0xAAU, 0xAAU, 0xAAU, 0xAAU, 0xA4U,
+    0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0DU, 0xA1U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x0AU, 0x50U, 0xA1U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0AU,
+    0x5BU, 0x50U, 0x40U, 0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0x5BU, 0x80U,
+    0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1DU, 0xE2U, 0x07U, 0xE2U, 0x07U, 0xE2U,
+    0x07U, 0xE1U, 0x07U, 0xE1U, 0x07U, 0xE1U, 0x07U, 0xE1U, 0x07U, 0xE2U, 0x07U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0BU, 0x51U, 0x50U, 0x40U, 0xFFU,
+    0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0xA6U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x0BU, 0xA1U, 0x1EU, 0x01U, 0x09U, 0x0CU, 0x0FU, 0x12U, 0x15U, 0x18U, 0x1BU,
+    0x1EU, 0x21U, 0x24U, 0x27U, 0x2AU, 0x2DU, 0x30U, 0x00U, 0x11U, 0x22U, 0x33U,
+    0x44U, 0x55U, 0x66U, 0x77U, 0x88U, 0x99U, 0xAAU, 0xBBU, 0xA5U, 0x07U, 0x3CU,
+    0x10U, 0x00U, 0x00U, 0x0EU, 0xA3U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x0CU, 0x56U, 0xF5U, 0x06U, 0x17U, 0x28U, 0x39U, 0x4AU, 0x5BU, 0x6CU, 0xAAU,
+    0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0CU, 0xACU, 0x0CU, 0x07U, 0x0EU, 0x15U,
+    0x1CU, 0x23U, 0x2AU, 0x31U, 0x38U, 0x3FU, 0x1DU, 0x4DU, 0x54U, 0x5BU, 0x62U,
+    0x69U, 0x70U, 0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U, 0x9AU, 0xA1U, 0xA8U, 0xAFU,
+    0xB6U, 0xBDU, 0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U, 0xE7U, 0xEEU, 0xF5U, 0xFCU,
+    0x03U, 0x0AU, 0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU, 0x34U, 0x3BU, 0x42U, 0x49U,
+    0x50U, 0x57U, 0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU, 0x81U, 0x88U, 0x8FU, 0x96U,
+    0x9DU, 0xA4U, 0xABU, 0xB2U, 0xB9U, 0x5DU, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x1EU, 0xF0U, 0xFFU, 0x05U, 0x12U, 0x34U, 0xFFU, 0xFFU, 0xFFU, 0xE1U,
+    0x07U, 0xE2U, 0x07U, 0xE2U, 0x07U, 0xE1U, 0x07U, 0xE3U, 0x07U, 0xE2U, 0x07U,
+    0xE3U, 0x07U, 0xE3U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0DU,
+    0x57U, 0xA9U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0DU, 0xACU, 0x1FU, 0x01U,
+    0x09U, 0x0CU, 0x0FU, 0x12U, 0x15U, 0x18U, 0x1BU, 0x1EU, 0x21U, 0x24U, 0x27U,
+    0x2AU, 0x2DU, 0x30U, 0xB1U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0FU, 0xB6U,
+    0x04U, 0x40U, 0x01U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x0EU, 0x54U, 0x10U, 0x21U, 0x32U, 0x43U, 0x54U, 0x65U,
+    0x76U, 0x87U, 0xB1U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0EU, 0xB7U, 0x5EU,
+    0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x1FU, 0xE2U, 0x07U, 0xE3U, 0x07U,
+    0xE2U, 0x07U, 0xE2U, 0x07U, 0xE2U, 0x07U, 0xE3U, 0x07U, 0xE3U, 0x07U, 0xE3U,
+    0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x55U, 0xAEU, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x0FU, 0xB5U, 0x20U, 0x01U, 0x09U, 0x0CU, 0x0FU,
+    0x12U, 0x15U, 0x18U, 0x1BU, 0x1EU, 0x21U, 0x24U, 0x27U, 0x2AU, 0x2DU, 0x30U,
+    0xB4U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x00U, 0xA2U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x5AU, 0xB4U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x00U, 0xA2U, 0x00U, 0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U,
+    0x99U, 0xAAU, 0xBBU, 0x5FU, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x20U,
+    0xE4U, 0x07U, 0xE3U, 0x07U, 0xE3U, 0x07U, 0xE3U, 0x07U, 0x07U, 0x47U, 0x4EU,
+    0x55U, 0x5CU, 0x63U, 0x6AU, 0x71U, 0x78U, 0x7FU, 0x1FU, 0x8DU, 0x94U, 0x9BU,
+    0xA2U, 0xA9U, 0xB0U, 0xB7U, 0xBEU, 0xC5U, 0xCCU, 0xD3U, 0xDAU, 0xE1U, 0xE8U,
+    0xEFU, 0xF6U, 0xFDU, 0x04U, 0x0BU, 0x12U, 0x19U, 0xE3U, 0x07U, 0xE4U, 0x07U,
+    0xE3U, 0x07U, 0xE3U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U,
+    0x5BU, 0xF5U, 0x06U, 0x17U, 0x28U, 0x39U, 0x4AU, 0x5BU, 0x6CU, 0xB9U, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x01U, 0xA8U, 0x21U, 0x01U, 0x09U, 0x0CU, 0x0FU,
+    0x12U, 0x15U, 0x18U, 0x1BU, 0x1EU, 0x21U, 0x24U, 0x27U, 0x2AU, 0x2DU, 0x30U,
+    0x0DU, 0x07U, 0x0EU, 0x15U, 0x1CU, 0x23U, 0x2AU, 0x31U, 0x38U, 0x3FU, 0x20U,
+    0x4DU, 0x54U, 0x5BU, 0x62U, 0x69U, 0x70U, 0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U,
+    0x9AU, 0xA1U, 0xA8U, 0xAFU, 0xB6U, 0xBDU, 0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U,
+    0xE7U, 0xEEU, 0xF5U, 0xFCU, 0x03U, 0x0AU, 0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU,
+    0x34U, 0x3BU, 0x42U, 0x49U, 0x50U, 0x57U, 0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU,
+    0x81U, 0x88U, 0x8FU, 0x96U, 0x9DU, 0xA4U, 0xABU, 0xB2U, 0xB9U, 0xA0U, 0xB1U,
+    0xC2U, 0xD3U, 0xE4U, 0xF5U, 0x06U, 0x17U, 0x00U, 0x40U, 0x01U, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xB6U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x01U, 0xAFU,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U, 0x58U, 0xB6U, 0x07U, 0x3CU,
+    0x10U, 0x00U, 0x00U, 0x02U, 0xAEU, 0x81U, 0x42U, 0x0FU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x60U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x21U, 0xE4U,
+    0x07U, 0xE3U, 0x07U, 0xE4U, 0x07U, 0xE3U, 0x07U, 0xE3U, 0x07U, 0xE4U, 0x07U,
+    0xE3U, 0x07U, 0xE4U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U,
+    0x59U, 0xBDU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x03U, 0xB6U, 0x22U, 0x01U,
+    0x09U, 0x0CU, 0x0FU, 0x12U, 0x15U, 0x18U, 0x1BU, 0x1EU, 0x21U, 0x24U, 0x27U,
+    0x2AU, 0x2DU, 0x30U, 0xBAU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x02U, 0xAAU,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x04U, 0x5EU, 0xBDU, 0x07U, 0x3CU,
+    0x10U, 0x00U, 0x00U, 0x04U, 0xB1U, 0x50U, 0x40U, 0xFFU, 0xFFU, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x61U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x22U, 0xE5U,
+    0x07U, 0xE4U, 0x07U, 0xE4U, 0x07U, 0xE4U, 0x07U, 0xE5U, 0x07U, 0xE4U, 0x07U,
+    0xE5U, 0x07U, 0xE5U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x05U,
+    0x5FU, 0x50U, 0x40U, 0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0xC1U, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x05U, 0xBCU, 0x23U, 0x01U, 0x09U, 0x0CU, 0x0FU,
+    0x12U, 0x15U, 0x18U, 0x1BU, 0x1EU, 0x21U, 0x24U, 0x27U, 0x2AU, 0x2DU, 0x30U,
+    0x00U, 0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U, 0x99U, 0xAAU,
+    0xBBU, 0xC4U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x03U, 0xBFU, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x06U, 0x5CU, 0x06U, 0x40U, 0x01U, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xF5U, 0x06U, 0x17U, 0x28U, 0x39U, 0x4AU, 0x5BU, 0x6CU,
+    0xBFU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x06U, 0xBDU, 0x0EU, 0x07U, 0x0EU,
+    0x15U, 0x1CU, 0x23U, 0x2AU, 0x31U, 0x38U, 0x3FU, 0x22U, 0x4DU, 0x54U, 0x5BU,
+    0x62U, 0x69U, 0x70U, 0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U, 0x9AU, 0xA1U, 0xA8U,
+    0xAFU, 0xB6U, 0xBDU, 0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U, 0xE7U, 0xEEU, 0xF5U,
+    0xFCU, 0x03U, 0x0AU, 0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU, 0x34U, 0x3BU, 0x42U,
+    0x49U, 0x50U, 0x57U, 0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU, 0x81U, 0x88U, 0x8FU,
+    0x96U, 0x9DU, 0xA4U, 0xABU, 0xB2U, 0xB9U, 0x62U, 0x80U, 0x02U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x23U, 0xF0U, 0xFFU, 0x06U, 0x12U, 0x34U, 0xFFU, 0xFFU, 0xFFU,
+    0xE5U, 0x07U, 0xE4U, 0x07U, 0xE4U, 0x07U, 0xE4U, 0x07U, 0xE6U, 0x07U, 0xE5U,
+    0x07U, 0xE6U, 0x07U, 0xE6U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x07U, 0x5DU, 0xC5U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x07U, 0xBAU, 0x24U,
+    0x01U, 0x09U, 0x0CU, 0x0FU, 0x12U, 0x15U, 0x18U, 0x1BU, 0x1EU, 0x21U, 0x24U,
+    0x27U, 0x2AU, 0x2DU, 0x30U, 0xC9U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x04U,
+    0x85U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x52U, 0xC9U, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x08U, 0x81U, 0x63U, 0x80U, 0x02U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x24U, 0xE6U, 0x07U, 0xE6U, 0x07U, 0xE5U, 0x07U, 0xE5U, 0x07U,
+    0xE5U, 0x07U, 0xE6U, 0x07U, 0xE5U, 0x07U, 0xE6U, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x09U, 0x53U, 0xC6U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x09U, 0x87U, 0x25U, 0x01U, 0x09U, 0x0CU, 0x0FU, 0x12U, 0x15U, 0x18U, 0x1BU,
+    0x1EU, 0x21U, 0x24U, 0x27U, 0x2AU, 0x2DU, 0x30U, 0xCAU, 0x07U, 0x3CU, 0x10U,
+    0x00U, 0x00U, 0x05U, 0x87U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0AU,
+    0x50U, 0xC9U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0AU, 0x83U, 0x00U, 0x11U,
+    0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U, 0x99U, 0xAAU, 0xBBU, 0x63U,
+    0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x25U, 0xE6U, 0x07U, 0xE7U, 0x07U,
+    0xE6U, 0x07U, 0xE6U, 0x07U, 0x08U, 0x47U, 0x4EU, 0x55U, 0x5CU, 0x63U, 0x6AU,
+    0x71U, 0x78U, 0x7FU, 0x24U, 0x8DU, 0x94U, 0x9BU, 0xA2U, 0xA9U, 0xB0U, 0xB7U,
+    0xBEU, 0xC5U, 0xCCU, 0xD3U, 0xDAU, 0xE1U, 0xE8U, 0xEFU, 0xF6U, 0xFDU, 0x04U,
+    0x0BU, 0x12U, 0x19U, 0xE6U, 0x07U, 0xE6U, 0x07U, 0xE6U, 0x07U, 0xE6U, 0x07U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0BU, 0x51U, 0xF5U, 0x06U, 0x17U,
+    0x28U, 0x39U, 0x4AU, 0x5BU, 0x6CU, 0xD1U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x0BU, 0x8AU, 0x26U, 0x01U, 0x09U, 0x0CU, 0x0FU, 0x12U, 0x15U, 0x18U, 0x1BU,
+    0x1EU, 0x21U, 0x24U, 0x27U, 0x2AU, 0x2DU, 0x30U, 0x0FU, 0x07U, 0x0EU, 0x15U,
+    0x1CU, 0x23U, 0x2AU, 0x31U, 0x38U, 0x3FU, 0x25U, 0x4DU, 0x54U, 0x5BU, 0x62U,
+    0x69U, 0x70U, 0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U, 0x9AU, 0xA1U, 0xA8U, 0xAFU,
+    0xB6U, 0xBDU, 0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U, 0xE7U, 0xEEU, 0xF5U, 0xFCU,
+    0x03U, 0x0AU, 0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU, 0x34U, 0x3BU, 0x42U, 0x49U,
+    0x50U, 0x57U, 0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU, 0x81U, 0x88U, 0x8FU, 0x96U,
+    0x9DU, 0xA4U, 0xABU, 0xB2U, 0xB9U, 0x03U, 0x7FU, 0x22U, 0x31U, 0xAAU, 0xAAU,
+    0xAAU, 0xAAU, 0xA0U, 0xB1U, 0xC2U, 0xD3U, 0xE4U, 0xF5U, 0x06U, 0x17U, 0xD1U,
+    0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x06U, 0x8FU, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x0CU, 0x56U, 0xCEU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0CU,
+    0x88U, 0x8BU, 0x42U, 0x0FU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x63U, 0x80U,
+    0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x26U, 0xE7U, 0x07U, 0xE6U, 0x07U, 0xE6U,
+    0x07U, 0xE6U, 0x07U, 0xE6U, 0x07U, 0xE6U, 0x07U, 0xE6U, 0x07U, 0xE6U, 0x07U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0DU, 0x57U, 0xD5U, 0x07U, 0x3CU,
+    0x10U, 0x00U, 0x00U, 0x0DU, 0x90U, 0x27U, 0x01U, 0x09U, 0x0CU, 0x0FU, 0x12U,
+    0x15U, 0x18U, 0x1BU, 0x1EU, 0x21U, 0x24U, 0x27U, 0x2AU, 0x2DU, 0x30U, 0xD5U,
+    0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x07U, 0x8AU, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x0EU, 0x54U, 0xD3U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0EU,
+    0x91U, 0x50U, 0x40U, 0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0x63U, 0x80U,
+    0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x27U, 0xE7U, 0x07U, 0xE8U, 0x07U, 0xE8U,
+    0x07U, 0xE8U, 0x07U, 0xE8U, 0x07U, 0xE7U, 0x07U, 0xE8U, 0x07U, 0xE8U, 0x07U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0FU, 0x55U, 0x50U, 0x40U, 0xFFU,
+    0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0xDAU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x0FU, 0x99U, 0x28U, 0x01U, 0x0AU, 0x0DU, 0x10U, 0x13U, 0x16U, 0x19U, 0x1CU,
+    0x1FU, 0x22U, 0x25U, 0x28U, 0x2BU, 0x2EU, 0x31U, 0x00U, 0x11U, 0x22U, 0x33U,
+    0x44U, 0x55U, 0x66U, 0x77U, 0x88U, 0x99U, 0xAAU, 0xBBU, 0xD9U, 0x07U, 0x3CU,
+    0x10U, 0x00U, 0x00U, 0x08U, 0x91U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x5AU, 0xF5U, 0x06U, 0x17U, 0x28U, 0x39U, 0x4AU, 0x5BU, 0x6CU, 0xDBU,
+    0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x00U, 0x8BU, 0x10U, 0x07U, 0x0EU, 0x15U,
+    0x1CU, 0x23U, 0x2AU, 0x31U, 0x38U, 0x3FU, 0x27U, 0x4DU, 0x54U, 0x5BU, 0x62U,
+    0x69U, 0x70U, 0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U, 0x9AU, 0xA1U, 0xA8U, 0xAFU,
+    0xB6U, 0xBDU, 0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U, 0xE7U, 0xEEU, 0xF5U, 0xFCU,
+    0x03U, 0x0AU, 0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU, 0x34U, 0x3BU, 0x42U, 0x49U,
+    0x50U, 0x57U, 0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU, 0x81U, 0x88U, 0x8FU, 0x96U,
+    0x9DU, 0xA4U, 0xABU, 0xB2U, 0xB9U, 0x63U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x28U, 0xF0U, 0xFFU, 0x07U, 0x12U, 0x34U, 0xFFU, 0xFFU, 0xFFU, 0xE7U,
+    0x07U, 0xE8U, 0x07U, 0xE7U, 0x07U, 0xE8U, 0x07U, 0xE8U, 0x07U, 0xE9U, 0x07U,
+    0xE9U, 0x07U, 0xE8U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U,
+    0x5BU, 0xDBU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x01U, 0x8AU, 0x29U, 0x01U,
+    0x0AU, 0x0DU, 0x10U, 0x13U, 0x16U, 0x19U, 0x1CU, 0x1FU, 0x22U, 0x25U, 0x28U,
+    0x2BU, 0x2EU, 0x31U, 0xE2U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x09U, 0x9BU,
+    0x04U, 0x40U, 0x01U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x02U, 0x58U, 0x10U, 0x21U, 0x32U, 0x43U, 0x54U, 0x65U,
+    0x76U, 0x87U, 0xDDU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x02U, 0x97U, 0x63U,
+    0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x29U, 0xE8U, 0x07U, 0xE9U, 0x07U,
+    0xE8U, 0x07U, 0xE8U, 0x07U, 0xE9U, 0x07U, 0xE8U, 0x07U, 0xE9U, 0x07U, 0xE8U,
+    0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x59U, 0xE2U, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x03U, 0x9DU, 0x2AU, 0x01U, 0x0AU, 0x0DU, 0x10U,
+    0x13U, 0x16U, 0x19U, 0x1CU, 0x1FU, 0x22U, 0x25U, 0x28U, 0x2BU, 0x2EU, 0x31U,
+    0xE6U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0AU, 0xE6U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x04U, 0x5EU, 0xE5U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x04U, 0x99U, 0x00U, 0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U,
+    0x99U, 0xAAU, 0xBBU, 0x63U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x2AU,
+    0xE9U, 0x07U, 0xE9U, 0x07U, 0xEAU, 0x07U, 0xE9U, 0x07U, 0x09U, 0x47U, 0x4EU,
+    0x55U, 0x5CU, 0x63U, 0x6AU, 0x71U, 0x78U, 0x7FU, 0x29U, 0x8DU, 0x94U, 0x9BU,
+    0xA2U, 0xA9U, 0xB0U, 0xB7U, 0xBEU, 0xC5U, 0xCCU, 0xD3U, 0xDAU, 0xE1U, 0xE8U,
+    0xEFU, 0xF6U, 0xFDU, 0x04U, 0x0BU, 0x12U, 0x19U, 0xE9U, 0x07U, 0xEAU, 0x07U,
+    0xE9U, 0x07U, 0xEAU, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x05U,
+    0x5FU, 0xF5U, 0x06U, 0x17U, 0x28U, 0x39U, 0x4AU, 0x5BU, 0x6CU, 0xE6U, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x05U, 0x9BU, 0x2BU, 0x01U, 0x0AU, 0x0DU, 0x10U,
+    0x13U, 0x16U, 0x19U, 0x1CU, 0x1FU, 0x22U, 0x25U, 0x28U, 0x2BU, 0x2EU, 0x31U,
+    0x11U, 0x07U, 0x0EU, 0x15U, 0x1CU, 0x23U, 0x2AU, 0x31U, 0x38U, 0x3FU, 0x2AU,
+    0x4DU, 0x54U, 0x5BU, 0x62U, 0x69U, 0x70U, 0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U,
+    0x9AU, 0xA1U, 0xA8U, 0xAFU, 0xB6U, 0xBDU, 0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U,
+    0xE7U, 0xEEU, 0xF5U, 0xFCU, 0x03U, 0x0AU, 0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU,
+    0x34U, 0x3BU, 0x42U, 0x49U, 0x50U, 0x57U, 0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU,
+    0x81U, 0x88U, 0x8FU, 0x96U, 0x9DU, 0xA4U, 0xABU, 0xB2U, 0xB9U, 0xA0U, 0xB1U,
+    0xC2U, 0xD3U, 0xE4U, 0xF5U, 0x06U, 0x17U, 0x00U, 0x40U, 0x01U, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xEAU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0BU, 0xEDU,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x06U, 0x5CU, 0xE6U, 0x07U, 0x3CU,
+    0x10U, 0x00U, 0x00U, 0x06U, 0x9AU, 0x95U, 0x42U, 0x0FU, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x62U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x2BU, 0xE9U,
+    0x07U, 0xEAU, 0x07U, 0xE9U, 0x07U, 0xEAU, 0x07U, 0xE9U, 0x07U, 0xEAU, 0x07U,
+    0xEAU, 0x07U, 0xE9U, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x07U,
+    0x5DU, 0xEBU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x07U, 0xE0U, 0x2CU, 0x01U,
+    0x0AU, 0x0DU, 0x10U, 0x13U, 0x16U, 0x19U, 0x1CU, 0x1FU, 0x22U, 0x25U, 0x28U,
+    0x2BU, 0x2EU, 0x31U, 0xEFU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0CU, 0xEBU,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x52U, 0xEDU, 0x07U, 0x3CU,
+    0x10U, 0x00U, 0x00U, 0x08U, 0xEDU, 0x50U, 0x40U, 0xFFU, 0xFFU, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x62U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x2CU, 0xEBU,
+    0x07U, 0xEAU, 0x07U, 0xEAU, 0x07U, 0xEBU, 0x07U, 0xEAU, 0x07U, 0xEAU, 0x07U,
+    0xEBU, 0x07U, 0xEBU, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x09U,
+    0x53U, 0x50U, 0x40U, 0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0xF2U, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x09U, 0xEBU, 0x2DU, 0x01U, 0x0AU, 0x0DU, 0x10U,
+    0x13U, 0x16U, 0x19U, 0x1CU, 0x1FU, 0x22U, 0x25U, 0x28U, 0x2BU, 0x2EU, 0x31U,
+    0x03U, 0x7FU, 0x22U, 0x31U, 0xAAU, 0xAAU, 0xAAU, 0xAAU, 0x00U, 0x11U, 0x22U,
+    0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U, 0x99U, 0xAAU, 0xBBU, 0xEFU, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x0DU, 0xEAU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x0AU, 0x50U, 0x06U, 0x40U, 0x01U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xF5U, 0x06U, 0x17U, 0x28U, 0x39U, 0x4AU, 0x5BU, 0x6CU, 0xF1U, 0x07U, 0x3CU,
+    0x10U, 0x00U, 0x00U, 0x0AU, 0xEBU, 0x12U, 0x07U, 0x0EU, 0x15U, 0x1CU, 0x23U,
+    0x2AU, 0x31U, 0x38U, 0x3FU, 0x2CU, 0x4DU, 0x54U, 0x5BU, 0x62U, 0x69U, 0x70U,
+    0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U, 0x9AU, 0xA1U, 0xA8U, 0xAFU, 0xB6U, 0xBDU,
+    0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U, 0xE7U, 0xEEU, 0xF5U, 0xFCU, 0x03U, 0x0AU,
+    0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU, 0x34U, 0x3BU, 0x42U, 0x49U, 0x50U, 0x57U,
+    0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU, 0x81U, 0x88U, 0x8FU, 0x96U, 0x9DU, 0xA4U,
+    0xABU, 0xB2U, 0xB9U, 0x61U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x2DU,
+    0xF0U, 0xFFU, 0x08U, 0x12U, 0x34U, 0xFFU, 0xFFU, 0xFFU, 0xEAU, 0x07U, 0xEBU,
+    0x07U, 0xEAU, 0x07U, 0xEAU, 0x07U, 0xEBU, 0x07U, 0xEBU, 0x07U, 0xECU, 0x07U,
+    0xEBU, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0BU, 0x51U, 0xF3U,
+    0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0BU, 0xF4U, 0x2EU, 0x01U, 0x0AU, 0x0DU,
+    0x10U, 0x13U, 0x16U, 0x19U, 0x1CU, 0x1FU, 0x22U, 0x25U, 0x28U, 0x2BU, 0x2EU,
+    0x31U, 0xF6U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0EU, 0xF2U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x0CU, 0x56U, 0xF3U, 0x07U, 0x3CU, 0x10U, 0x00U,
+    0x00U, 0x0CU, 0xF7U, 0x60U, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x2EU,
+    0xEBU, 0x07U, 0xECU, 0x07U, 0xEBU, 0x07U, 0xECU, 0x07U, 0xEBU, 0x07U, 0xEBU,
+    0x07U, 0xECU, 0x07U, 0xECU, 0x07U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x0DU, 0x57U, 0xF9U, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0DU, 0xFCU, 0x2FU,
+    0x01U, 0x0AU, 0x0DU, 0x10U, 0x13U, 0x16U, 0x19U, 0x1CU, 0x1FU, 0x22U, 0x25U,
+    0x28U, 0x2BU, 0x2EU, 0x31U, 0xFAU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0FU,
+    0xF9U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x54U, 0xFAU, 0x07U,
+    0x3CU, 0x10U, 0x00U, 0x00U, 0x0EU, 0xFEU, 0x00U, 0x11U, 0x22U, 0x33U, 0x44U,
+    0x55U, 0x66U, 0x77U, 0x88U, 0x99U, 0xAAU, 0xBBU, 0x5FU, 0x80U, 0x02U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x2FU, 0xECU, 0x07U, 0xECU, 0x07U, 0xEDU, 0x07U, 0xEDU,
+    0x07U, 0x0AU, 0x47U, 0x4EU, 0x55U, 0x5CU, 0x63U, 0x6AU, 0x71U, 0x78U, 0x7FU,
+    0x2EU, 0x8DU, 0x94U, 0x9BU, 0xA2U, 0xA9U, 0xB0U, 0xB7U, 0xBEU, 0xC5U, 0xCCU,
+    0xD3U, 0xDAU, 0xE1U, 0xE8U, 0xEFU, 0xF6U, 0xFDU, 0x04U, 0x0BU, 0x12U, 0x19U,
+    0xECU, 0x07U, 0xECU, 0x07U, 0xECU, 0x07U, 0xEDU, 0x07U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x0FU, 0x55U, 0xF5U, 0x06U, 0x17U, 0x28U, 0x39U, 0x4AU,
+    0x5BU, 0x6CU, 0xFFU, 0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x0FU, 0xC4U, 0x30U,
+    0x01U, 0x0AU, 0x0DU, 0x10U, 0x13U, 0x16U, 0x19U, 0x1CU, 0x1FU, 0x22U, 0x25U,
+    0x28U, 0x2BU, 0x2EU, 0x31U, 0x13U, 0x07U, 0x0EU, 0x15U, 0x1CU, 0x23U, 0x2AU,
+    0x31U, 0x38U, 0x3FU, 0x2FU, 0x4DU, 0x54U, 0x5BU, 0x62U, 0x69U, 0x70U, 0x77U,
+    0x7EU, 0x85U, 0x8CU, 0x93U, 0x9AU, 0xA1U, 0xA8U, 0xAFU, 0xB6U, 0xBDU, 0xC4U,
+    0xCBU, 0xD2U, 0xD9U, 0xE0U, 0xE7U, 0xEEU, 0xF5U, 0xFCU, 0x03U, 0x0AU, 0x11U,
+    0x18U, 0x1FU, 0x26U, 0x2DU, 0x34U, 0x3BU, 0x42U, 0x49U, 0x50U, 0x57U, 0x5EU,
+    0x65U, 0x6CU, 0x73U, 0x7AU, 0x81U, 0x88U, 0x8FU, 0x96U, 0x9DU, 0xA4U, 0xABU,
+    0xB2U, 0xB9U, 0xA0U, 0xB1U, 0xC2U, 0xD3U, 0xE4U, 0xF5U, 0x06U, 0x17U, 0xFDU,
+    0x07U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x00U, 0xF5U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x5AU, 0x01U, 0x08U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x00U,
+    0xF0U, 0x9FU, 0x42U, 0x0FU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x5EU, 0x80U,
+    0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x30U, 0xEDU, 0x07U, 0xEDU, 0x07U, 0xEDU,
+    0x07U, 0xEDU, 0x07U, 0xEDU, 0x07U, 0xECU, 0x07U, 0xEDU, 0x07U, 0xECU, 0x07U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x5BU, 0x01U, 0x08U, 0x3CU,
+    0x10U, 0x00U, 0x00U, 0x01U, 0xF3U, 0x31U, 0x01U, 0x0AU, 0x0DU, 0x10U, 0x13U,
+    0x16U, 0x19U, 0x1CU, 0x1FU, 0x22U, 0x25U, 0x28U, 0x2BU, 0x2EU, 0x31U, 0x00U,
+    0x08U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x01U, 0xF0U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x02U, 0x58U, 0x04U, 0x08U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x02U,
+    0xFFU, 0x50U, 0x40U, 0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0x5CU, 0x80U,
+    0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x31U, 0xEDU, 0x07U, 0xEEU, 0x07U, 0xEDU,
+    0x07U, 0xEEU, 0x07U, 0xEDU, 0x07U, 0xEEU, 0x07U, 0xEDU, 0x07U, 0xEEU, 0x07U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x03U, 0x59U, 0x50U, 0x40U, 0xFFU,
+    0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0x08U, 0x08U, 0x3CU, 0x10U, 0x00U, 0x00U,
+    0x03U, 0xFAU, 0x32U, 0x01U, 0x0BU, 0x0EU, 0x11U, 0x14U, 0x17U, 0x1AU, 0x1DU,
+    0x20U, 0x23U, 0x26U, 0x29U, 0x2CU, 0x2FU, 0x32U, 0x00U, 0x11U, 0x22U, 0x33U,
+    0x44U, 0x55U, 0x66U, 0x77U, 0x88U, 0x99U, 0xAAU, 0xBBU, 0x09U, 0x08U, 0x3CU,
+    0x10U, 0x00U, 0x00U, 0x02U, 0xFAU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x04U, 0x5EU, 0xF5U, 0x06U, 0x17U, 0x28U, 0x39U, 0x4AU, 0x5BU, 0x6CU, 0x0BU,
+    0x08U, 0x3CU, 0x10U, 0x00U, 0x00U, 0x04U, 0xC6U, 0x14U, 0x07U, 0x0EU, 0x15U,
+    0x1CU, 0x23U, 0x2AU, 0x31U, 0x38U, 0x3FU, 0x31U, 0x4DU, 0x54U, 0x5BU, 0x62U,
+    0x69U, 0x70U, 0x77U, 0x7EU, 0x85U, 0x8CU, 0x93U, 0x9AU, 0xA1U, 0xA8U, 0xAFU,
+    0xB6U, 0xBDU, 0xC4U, 0xCBU, 0xD2U, 0xD9U, 0xE0U, 0xE7U, 0xEEU, 0xF5U, 0xFCU,
+    0x03U, 0x0AU, 0x11U, 0x18U, 0x1FU, 0x26U, 0x2DU, 0x34U, 0x3BU, 0x42U, 0x49U,
+    0x50U, 0x57U, 0x5EU, 0x65U, 0x6CU, 0x73U, 0x7AU, 0x81U, 0x88U, 0x8FU, 0x96U,
+    0x9DU, 0xA4U, 0xABU, 0xB2U, 0xB9U, 0x5BU, 0x80U, 0x02U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x32U, 0xF0U, 0xFFU, 0x09U, 0x12U, 0x34U, 0xFFU, 0xFFU, 0xFFU, 0xEEU,
+    0x07U, 0xEDU, 0x07U, 0xEEU, 0x07U, 0xEEU, 0x07U,
+};
+
+#endif /* FZIP_TRACE_H_ */
+
+/* [] END OF FILE */
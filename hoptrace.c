@@ -0,0 +1,595 @@
+/******************************************************************************
+* File Name:   hoptrace.c
+*
+* Description: This file contains the cross-node latency tracing: the trace
+*              trailer written at the TX point and read at the RX point, and
+*              the RX and TX events printed for the host collector.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "hoptrace.h"
+#include "cycle_counter.h"
+#include "stats.h"
+
+#if (HOPTRACE_ENABLE)
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define HOPTRACE_EVENT_RX       ((uint8_t)'R')
+#define HOPTRACE_EVENT_TX       ((uint8_t)'T')
+
+/* Events printed per call of hoptrace_poll(), to bound the time it blocks
+ * on the debug UART */
+#define HOPTRACE_PRINT_MAX      (4U)
+
+/* Largest time held a hop records, in us */
+#define HOPTRACE_HELD_MAX       (0xFFFFU)
+
+#define HOPTRACE_ID_ENTRY(name, id, mask)   { (id), (mask) },
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Trailer found at the end of a payload */
+typedef struct
+{
+    uint8_t  start;             /* Index of the first hop */
+    uint8_t  hops;
+    uint8_t  len;               /* Payload length */
+    uint8_t  origin;            /* Node of the first hop */
+    uint16_t corr_id;
+} hoptrace_trailer_t;
+
+/* RX or TX of a traced frame, 12 bytes */
+typedef struct
+{
+    uint32_t cycles;            /* DWT cycle count */
+    uint16_t corr_id;
+    uint16_t id;
+    uint8_t  origin;
+    uint8_t  hops;              /* Hops in the trailer */
+    uint8_t  type;              /* HOPTRACE_EVENT_xxx */
+    uint8_t  reserved;
+} hoptrace_event_t;
+
+/* RX time of a received frame, for the time held on this node */
+typedef struct
+{
+    bool     valid;
+    uint8_t  origin;
+    uint16_t corr_id;
+    uint32_t cycles;
+} hoptrace_context_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+uint32_t hoptrace_ids[HOPTRACE_ID_WORDS];
+
+static const uint32_t hoptrace_id_list[][2] =
+{
+    HOPTRACE_ID_LIST(HOPTRACE_ID_ENTRY)
+};
+
+static uint8_t hoptrace_node;
+static uint16_t hoptrace_corr_id;
+
+/* Written at the RX point in interrupt context and at the TX point in the
+ * main loop, read by the main loop */
+static hoptrace_event_t hoptrace_events[HOPTRACE_EVENTS];
+static volatile uint32_t hoptrace_head;
+static volatile uint32_t hoptrace_tail;
+
+static hoptrace_context_t hoptrace_contexts[HOPTRACE_CONTEXTS];
+
+/* Hops of the last trailer received, for the report */
+static uint8_t hoptrace_last[HOPTRACE_TRAILER_SIZE(HOPTRACE_HOPS_MAX)];
+static hoptrace_trailer_t hoptrace_last_trailer;
+
+static hoptrace_stats_t hoptrace_stats;
+
+/*******************************************************************************
+* Function Name: hoptrace_parse
+********************************************************************************
+* Summary:
+* Finds the trailer that ends at a given length of a payload.
+*
+* Parameters:
+*  data         Payload
+*  end          Length of the payload with the trailer
+*  trailer      Set to the fields of the trailer
+*
+* Return:
+*  true if the payload ends with a trailer
+*
+*******************************************************************************/
+static bool hoptrace_parse(const uint8_t *data, uint32_t end,
+                           hoptrace_trailer_t *trailer)
+{
+    uint32_t hops;
+    uint32_t start;
+
+    if (end < HOPTRACE_TRAILER_SIZE(1U))
+    {
+        return false;
+    }
+    hops = data[end - 1U] & ~HOPTRACE_TAG_MASK;
+    if (((data[end - 1U] & HOPTRACE_TAG_MASK) != HOPTRACE_TAG) ||
+        (0U == hops) || (hops > HOPTRACE_HOPS_MAX) ||
+        (end < HOPTRACE_TRAILER_SIZE(hops)))
+    {
+        return false;
+    }
+    start = end - HOPTRACE_TRAILER_SIZE(hops);
+    if (data[end - 2U] > start)
+    {
+        return false;
+    }
+
+    trailer->start = (uint8_t)start;
+    trailer->hops = (uint8_t)hops;
+    trailer->len = data[end - 2U];
+    trailer->origin = data[start];
+    trailer->corr_id = (uint16_t)(data[end - 4U] |
+                                  ((uint32_t)data[end - 3U] << 8U));
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: hoptrace_record
+********************************************************************************
+* Summary:
+* Appends an event for the main loop to print. The slot is reserved with
+* interrupts masked, as the RX interrupt and the main loop both record.
+*
+*******************************************************************************/
+static void hoptrace_record(uint8_t type, uint32_t id,
+                            const hoptrace_trailer_t *trailer, uint32_t cycles)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t head;
+
+    __disable_irq();
+    head = hoptrace_head;
+    if ((head - hoptrace_tail) >= HOPTRACE_EVENTS)
+    {
+        hoptrace_stats.dropped++;
+        STATS_INC(HOPTRACE_DROPPED);
+    }
+    else
+    {
+        hoptrace_event_t *event = &hoptrace_events[head % HOPTRACE_EVENTS];
+
+        event->cycles = cycles;
+        event->corr_id = trailer->corr_id;
+        event->id = (uint16_t)id;
+        event->origin = trailer->origin;
+        event->hops = trailer->hops;
+        event->type = type;
+        hoptrace_head = head + 1U;
+    }
+    __set_PRIMASK(primask);
+}
+
+/*******************************************************************************
+* Function Name: hoptrace_held_us
+********************************************************************************
+* Summary:
+* Returns the time since a frame of the same trace was received, or 0 if
+* its RX time is no longer kept.
+*
+*******************************************************************************/
+static uint32_t hoptrace_held_us(const hoptrace_trailer_t *trailer,
+                                 uint32_t now)
+{
+    uint32_t primask = __get_PRIMASK();
+    hoptrace_context_t context;
+    uint32_t held;
+
+    __disable_irq();
+    context = hoptrace_contexts[trailer->corr_id % HOPTRACE_CONTEXTS];
+    __set_PRIMASK(primask);
+
+    if (!context.valid || (context.origin != trailer->origin) ||
+        (context.corr_id != trailer->corr_id))
+    {
+        return 0U;
+    }
+    held = (now - context.cycles) / (SystemCoreClock / 1000000U);
+    return (held > HOPTRACE_HELD_MAX) ? HOPTRACE_HELD_MAX : held;
+}
+#endif /* HOPTRACE_ENABLE */
+
+/*******************************************************************************
+* Function Name: hoptrace_init
+********************************************************************************
+* Summary:
+* Traces the IDs of HOPTRACE_ID_LIST and prints the clock of this node for
+* the collector.
+*
+* Parameters:
+*  node         Node number written into the hops of this node
+*
+*******************************************************************************/
+void hoptrace_init(uint8_t node)
+{
+#if (HOPTRACE_ENABLE)
+    cycle_counter_init();
+    hoptrace_node = node;
+    memset(hoptrace_ids, 0, sizeof(hoptrace_ids));
+    for (uint32_t idx = 0U;
+         idx < (sizeof(hoptrace_id_list) / sizeof(hoptrace_id_list[0]));
+         idx++)
+    {
+        hoptrace_enable(hoptrace_id_list[idx][0], hoptrace_id_list[idx][1],
+                        true);
+    }
+    printf("HOP CLOCK %u %lu\r\n", node, (unsigned long)SystemCoreClock);
+#else
+    CY_UNUSED_PARAMETER(node);
+#endif /* HOPTRACE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: hoptrace_enable
+********************************************************************************
+* Summary:
+* Starts or stops tracing the standard IDs that match an ID and mask.
+*
+* Parameters:
+*  id           Standard ID
+*  mask         Bits of the ID that must match; 0x7FF for a single ID
+*  on           true to trace the IDs
+*
+*******************************************************************************/
+void hoptrace_enable(uint32_t id, uint32_t mask, bool on)
+{
+#if (HOPTRACE_ENABLE)
+    for (uint32_t std_id = 0U; std_id < (HOPTRACE_ID_WORDS * 32U); std_id++)
+    {
+        if (0U == ((std_id ^ id) & mask))
+        {
+            if (on)
+            {
+                hoptrace_ids[std_id >> 5U] |= 1UL << (std_id & 31U);
+            }
+            else
+            {
+                hoptrace_ids[std_id >> 5U] &= ~(1UL << (std_id & 31U));
+            }
+        }
+    }
+#else
+    CY_UNUSED_PARAMETER(id);
+    CY_UNUSED_PARAMETER(mask);
+    CY_UNUSED_PARAMETER(on);
+#endif /* HOPTRACE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: hoptrace_on_rx
+********************************************************************************
+* Summary:
+* RX point, called by the RX callback for every received frame. For a traced
+* ID, records the RX time, keeps it for the frame that continues the trace,
+* and takes the trailer off the payload. The trailer stays in the data after
+* the payload, marked by CANFD_FRAME_FLAG_TRACED, for hoptrace_forward().
+*
+* Parameters:
+*  frame        Received frame
+*
+*******************************************************************************/
+void hoptrace_on_rx(canfd_frame_t *frame)
+{
+#if (HOPTRACE_ENABLE)
+    hoptrace_trailer_t trailer;
+    hoptrace_context_t *context;
+    uint32_t now;
+
+    if (!hoptrace_traced(frame))
+    {
+        return;
+    }
+    if (!hoptrace_parse(frame->data, frame->len, &trailer))
+    {
+        hoptrace_stats.malformed++;
+        STATS_INC(HOPTRACE_BAD);
+        return;
+    }
+    now = cycle_counter_get();
+    hoptrace_record(HOPTRACE_EVENT_RX, frame->id, &trailer, now);
+
+    context = &hoptrace_contexts[trailer.corr_id % HOPTRACE_CONTEXTS];
+    context->valid = true;
+    context->origin = trailer.origin;
+    context->corr_id = trailer.corr_id;
+    context->cycles = now;
+
+    memcpy(hoptrace_last, &frame->data[trailer.start],
+           HOPTRACE_TRAILER_SIZE(trailer.hops));
+    hoptrace_last_trailer = trailer;
+    hoptrace_stats.received++;
+
+    frame->reserved = frame->len;
+    frame->len = trailer.len;
+    frame->flags |= CANFD_FRAME_FLAG_TRACED;
+#else
+    CY_UNUSED_PARAMETER(frame);
+#endif /* HOPTRACE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: hoptrace_on_tx
+********************************************************************************
+* Summary:
+* TX point, called by the send function for every frame before it is handed
+* to the controller. For a traced ID, writes the trailer after the payload
+* and records the TX time. A frame with CANFD_FRAME_FLAG_TRACED continues
+* a trace: its trailer gets a hop of this node with the time since the frame
+* it continues was received. Any other frame starts a trace with a new
+* correlation ID. The payload is padded so the trailer ends the frame at a
+* length a DLC can encode.
+*
+* Parameters:
+*  frame        Frame about to be sent, changed in place
+*
+*******************************************************************************/
+void hoptrace_on_tx(canfd_frame_t *frame)
+{
+#if (HOPTRACE_ENABLE)
+    uint8_t hops[HOPTRACE_HOP_SIZE * HOPTRACE_HOPS_MAX];
+    hoptrace_trailer_t trailer;
+    uint32_t now;
+    uint32_t end;
+    uint32_t held;
+    uint8_t *out;
+    bool forward;
+
+    if (!hoptrace_traced(frame))
+    {
+        return;
+    }
+    now = cycle_counter_get();
+
+    forward = (0U != (frame->flags & CANFD_FRAME_FLAG_TRACED)) &&
+              hoptrace_parse(frame->data, frame->reserved, &trailer);
+    frame->flags &= (uint8_t)~CANFD_FRAME_FLAG_TRACED;
+    if (forward)
+    {
+        memcpy(hops, &frame->data[trailer.start],
+               HOPTRACE_HOP_SIZE * (uint32_t)trailer.hops);
+    }
+    else
+    {
+        trailer.hops = 0U;
+        trailer.origin = hoptrace_node;
+        trailer.corr_id = hoptrace_corr_id;
+    }
+    if (trailer.hops < HOPTRACE_HOPS_MAX)
+    {
+        held = forward ? hoptrace_held_us(&trailer, now) : 0U;
+        out = &hops[HOPTRACE_HOP_SIZE * (uint32_t)trailer.hops];
+        out[0] = hoptrace_node;
+        out[1] = (uint8_t)held;
+        out[2] = (uint8_t)(held >> 8U);
+        trailer.hops++;
+    }
+
+    /* Classic frames keep their format, so only a short payload has room */
+    end = (uint32_t)frame->len + HOPTRACE_TRAILER_SIZE(trailer.hops);
+    if (0U != (frame->flags & CANFD_FRAME_FLAG_FDF))
+    {
+        end = (end <= CANFD_MAX_DATA_LEN) ? txfmt_fd_len((uint8_t)end) :
+                                            (CANFD_MAX_DATA_LEN + 1U);
+    }
+    if (end > ((0U != (frame->flags & CANFD_FRAME_FLAG_FDF)) ?
+               CANFD_MAX_DATA_LEN : CANFD_CLASSIC_MAX_DATA_LEN))
+    {
+        hoptrace_stats.no_room++;
+        STATS_INC(HOPTRACE_NO_ROOM);
+        return;
+    }
+
+    if (forward)
+    {
+        hoptrace_stats.forwarded++;
+    }
+    else
+    {
+        hoptrace_corr_id++;
+        hoptrace_stats.tagged++;
+    }
+    trailer.len = frame->len;
+    trailer.start = (uint8_t)(end - HOPTRACE_TRAILER_SIZE(trailer.hops));
+
+    out = &frame->data[frame->len];
+    memset(out, 0, (uint32_t)trailer.start - frame->len);
+    out = &frame->data[trailer.start];
+    memcpy(out, hops, HOPTRACE_HOP_SIZE * (uint32_t)trailer.hops);
+    out += HOPTRACE_HOP_SIZE * (uint32_t)trailer.hops;
+    out[0] = (uint8_t)trailer.corr_id;
+    out[1] = (uint8_t)(trailer.corr_id >> 8U);
+    out[2] = trailer.len;
+    out[3] = (uint8_t)(HOPTRACE_TAG | trailer.hops);
+    frame->len = (uint8_t)end;
+
+    hoptrace_record(HOPTRACE_EVENT_TX, frame->id, &trailer, now);
+#else
+    CY_UNUSED_PARAMETER(frame);
+#endif /* HOPTRACE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: hoptrace_forward
+********************************************************************************
+* Summary:
+* Continues the trace of a received frame with a frame that answers or
+* forwards it, for example in a gateway. Copies the trailer after the
+* payload of the new frame, so that hoptrace_on_tx() adds a hop to it.
+* Call it after the payload of the new frame is complete.
+*
+* Parameters:
+*  out          Frame that continues the trace
+*  in           Received frame, after hoptrace_on_rx()
+*
+*******************************************************************************/
+void hoptrace_forward(canfd_frame_t *out, const canfd_frame_t *in)
+{
+#if (HOPTRACE_ENABLE)
+    hoptrace_trailer_t trailer;
+    uint32_t size;
+
+    out->flags &= (uint8_t)~CANFD_FRAME_FLAG_TRACED;
+    if ((0U == (in->flags & CANFD_FRAME_FLAG_TRACED)) ||
+        !hoptrace_parse(in->data, in->reserved, &trailer))
+    {
+        return;
+    }
+    size = HOPTRACE_TRAILER_SIZE(trailer.hops);
+    if (((uint32_t)out->len + size) > CANFD_MAX_DATA_LEN)
+    {
+        return;
+    }
+    memcpy(&out->data[out->len], &in->data[trailer.start], size);
+    out->reserved = (uint8_t)(out->len + size);
+    out->data[out->reserved - 2U] = out->len;
+    out->flags |= CANFD_FRAME_FLAG_TRACED;
+#else
+    CY_UNUSED_PARAMETER(out);
+    CY_UNUSED_PARAMETER(in);
+#endif /* HOPTRACE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: hoptrace_poll
+********************************************************************************
+* Summary:
+* Called from the main loop. Prints the recorded events on the debug UART,
+* one line each, for scripts/hoptrace_collect.py:
+*   HOP <node> <R|T> <cycles> <origin> <corr_id> <hops> <CAN ID>
+*
+*******************************************************************************/
+void hoptrace_poll(void)
+{
+#if (HOPTRACE_ENABLE)
+    for (uint32_t count = 0U;
+         (count < HOPTRACE_PRINT_MAX) && (hoptrace_tail != hoptrace_head);
+         count++)
+    {
+        const hoptrace_event_t *event =
+            &hoptrace_events[hoptrace_tail % HOPTRACE_EVENTS];
+
+        printf("HOP %u %c %08lx %u %04x %u %03x\r\n", hoptrace_node,
+               (char)event->type, (unsigned long)event->cycles,
+               event->origin, event->corr_id, event->hops, event->id);
+        hoptrace_tail = hoptrace_tail + 1U;
+    }
+#endif /* HOPTRACE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: hoptrace_get_stats
+********************************************************************************
+* Summary:
+* Returns the frame counters.
+*
+*******************************************************************************/
+void hoptrace_get_stats(hoptrace_stats_t *stats)
+{
+#if (HOPTRACE_ENABLE)
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    *stats = hoptrace_stats;
+    __set_PRIMASK(primask);
+#else
+    memset(stats, 0, sizeof(*stats));
+#endif /* HOPTRACE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: hoptrace_report
+********************************************************************************
+* Summary:
+* Prints the frame counters, the clock line for the collector, and the hops
+* of the last trailer received with the time each node held the frame.
+*
+*******************************************************************************/
+void hoptrace_report(void)
+{
+#if (HOPTRACE_ENABLE)
+    uint8_t last[sizeof(hoptrace_last)];
+    hoptrace_trailer_t trailer;
+    hoptrace_stats_t stats;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    memcpy(last, hoptrace_last, sizeof(last));
+    trailer = hoptrace_last_trailer;
+    __set_PRIMASK(primask);
+
+    hoptrace_get_stats(&stats);
+    printf("HOP CLOCK %u %lu\r\n", hoptrace_node,
+           (unsigned long)SystemCoreClock);
+    printf("HOPTRACE: tagged %lu, forwarded %lu, received %lu, "
+           "no room %lu, malformed %lu, dropped %lu\r\n",
+           (unsigned long)stats.tagged, (unsigned long)stats.forwarded,
+           (unsigned long)stats.received, (unsigned long)stats.no_room,
+           (unsigned long)stats.malformed, (unsigned long)stats.dropped);
+    if (0U != stats.received)
+    {
+        printf("HOPTRACE: last %u.%u:", trailer.origin, trailer.corr_id);
+        for (uint32_t hop = 0U; hop < trailer.hops; hop++)
+        {
+            const uint8_t *entry = &last[HOPTRACE_HOP_SIZE * hop];
+
+            printf(" node %u %u us%s", entry[0],
+                   (unsigned int)(entry[1] | ((uint32_t)entry[2] << 8U)),
+                   ((hop + 1U) < trailer.hops) ? "," : "");
+        }
+        printf("\r\n");
+    }
+#endif /* HOPTRACE_ENABLE */
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,165 @@
+/******************************************************************************
+* File Name:   hoptrace.h
+*
+* Description: This file contains the interface of the cross-node latency
+*              tracing, which tags the frames of the traced IDs with a
+*              correlation ID and the time each node held them.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef HOPTRACE_H_
+#define HOPTRACE_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "canfd_frame.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make HOPTRACE_ENABLE=1") to tag the frames of
+ * the traced IDs with a correlation ID and the time each node held them, and
+ * to print their RX and TX times on the debug UART */
+#ifndef HOPTRACE_ENABLE
+#define HOPTRACE_ENABLE         (0)
+#endif
+
+/* Standard IDs traced from start-up: X(identifier, CAN ID, ID mask). The
+ * shell command "hoptrace" switches single IDs at run time. A traced ID must
+ * be traced on every node that sends or receives it, because the trailer
+ * lengthens the payload on the bus. */
+#define HOPTRACE_ID_LIST(X)                                                    \
+    X(RPC,          0x300U, 0x780U)
+
+/* Nodes a trailer records; a frame that has been through more is sent on
+ * without another hop, and its RX and TX times are still printed */
+#define HOPTRACE_HOPS_MAX       (4U)
+
+/* Trailer at the end of the payload on the bus, from the first byte:
+ *   per hop     node, time held in us (16 bits, little endian), the first
+ *               hop being the node that sent the frame first
+ *   corr_id     correlation ID (16 bits, little endian), counted by the
+ *               first node
+ *   len         payload length without the trailer and its padding
+ *   tag         HOPTRACE_TAG | number of hops */
+#define HOPTRACE_TAG            (0xA0U)
+#define HOPTRACE_TAG_MASK       (0xF0U)
+#define HOPTRACE_HOP_SIZE       (3U)
+#define HOPTRACE_TRAILER_SIZE(hops) (4U + (HOPTRACE_HOP_SIZE * (hops)))
+
+/* RX and TX events held until the main loop prints them */
+#ifndef HOPTRACE_EVENTS
+#define HOPTRACE_EVENTS         (64U)
+#endif
+
+/* Received frames whose RX time is kept for the time held to the TX of
+ * the frame that continues them */
+#define HOPTRACE_CONTEXTS       (8U)
+
+/* Words of the bit map of traced standard IDs */
+#define HOPTRACE_ID_WORDS       (0x800U / 32U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t tagged;            /* Frames sent with a new trailer */
+    uint32_t forwarded;         /* Frames sent with a hop added */
+    uint32_t received;          /* Frames received with a trailer */
+    uint32_t no_room;           /* Frames sent without a trailer or hop */
+    uint32_t malformed;         /* Traced frames received without one */
+    uint32_t dropped;           /* Events lost to a full buffer */
+} hoptrace_stats_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* One bit per standard ID, set while the ID is traced */
+extern uint32_t hoptrace_ids[HOPTRACE_ID_WORDS];
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void hoptrace_init(uint8_t node);
+void hoptrace_enable(uint32_t id, uint32_t mask, bool on);
+void hoptrace_on_rx(canfd_frame_t *frame);
+void hoptrace_on_tx(canfd_frame_t *frame);
+void hoptrace_forward(canfd_frame_t *out, const canfd_frame_t *in);
+void hoptrace_poll(void);
+void hoptrace_get_stats(hoptrace_stats_t *stats);
+void hoptrace_report(void);
+
+/*******************************************************************************
+* Function Name: hoptrace_traced
+********************************************************************************
+* Summary:
+* Tells whether frames with an ID are traced: one load and a bit test, the
+* cost every frame pays at the RX and TX points.
+*
+* Parameters:
+*  frame        Frame to check
+*
+* Return:
+*  true if the standard ID of the frame is traced
+*
+*******************************************************************************/
+__STATIC_FORCEINLINE bool hoptrace_traced(const canfd_frame_t *frame)
+{
+#if (HOPTRACE_ENABLE)
+    return (0U == (frame->flags & CANFD_FRAME_FLAG_XTD)) &&
+           (0U != (hoptrace_ids[(frame->id >> 5U) & (HOPTRACE_ID_WORDS - 1U)] &
+                   (1UL << (frame->id & 31U))));
+#else
+    CY_UNUSED_PARAMETER(frame);
+    return false;
+#endif /* HOPTRACE_ENABLE */
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* HOPTRACE_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,323 @@
+/******************************************************************************
+* File Name:   adcstream_sim.c
+*
+* Description: This file contains the host model of the ADC sample stream: the
+*              DMA double buffer, the pacing to the bus load cap and the
+*              packing of the samples.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "adcstream.h"
+#include "txfmt.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Simulated time per scenario */
+#define SIM_DURATION_MS         (5000U)
+
+/* Time between two passes of the main loop */
+#define SIM_LOOP_US             (20U)
+
+/* Bus time that can be saved up, as ADCSTREAM_CAN_BURST_US */
+#define SIM_BURST_US            (2000U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    uint32_t    rate_hz;        /* Sample clock */
+    uint32_t    load_pct;       /* Bus load cap */
+    uint32_t    stall_ms;       /* The main loop stops this long... */
+    uint32_t    stall_every_ms; /* ...this often, 0 = never */
+} sim_scenario_t;
+
+typedef struct
+{
+    uint64_t generated;         /* Samples of the completed blocks */
+    uint64_t received;
+    uint64_t missing;           /* Sample numbers skipped at the receiver */
+    uint64_t wrong;             /* Received samples off their source */
+    uint64_t bus_ns;
+    uint32_t frames;
+    uint32_t dropped;
+    uint32_t pending;           /* Samples taken but not yet sent */
+} sim_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const sim_scenario_t sim_scenarios[] =
+{
+    { "20 kHz, cap 50%",            20000U,  50U,  0U,    0U },
+    { "40 kHz, cap 50%",            40000U,  50U,  0U,    0U },
+    { "80 kHz, cap 50%",            80000U,  50U,  0U,    0U },
+    { "20 kHz, cap 10%",            20000U,  10U,  0U,    0U },
+    { "100 kHz, cap 100%",         100000U, 100U,  0U,    0U },
+    { "20 kHz, 20 ms stalls",       20000U,  50U, 20U,  500U },
+    { "40 kHz, 5 ms stalls",        40000U,  50U,  5U,  100U },
+};
+
+static adcstream_dbuf_t sim_dbuf;
+
+/*******************************************************************************
+* Function Name: sim_sample
+********************************************************************************
+* Summary:
+* Returns the 12-bit ADC result of a sample number, so that the receiver
+* can check every sample it unpacks.
+*
+*******************************************************************************/
+static uint16_t sim_sample(uint32_t number)
+{
+    return (uint16_t)(((number * 2654435761UL) >> 13) & ADCSTREAM_SAMPLE_MASK);
+}
+
+/*******************************************************************************
+* Function Name: sim_receive
+********************************************************************************
+* Summary:
+* Unpacks a frame at the receiver and checks its samples.
+*
+*******************************************************************************/
+static void sim_receive(const uint8_t *data, uint32_t *next,
+                        sim_result_t *result)
+{
+    uint16_t samples[ADCSTREAM_FRAME_SAMPLES];
+    uint32_t first;
+    uint8_t seq;
+
+    adcstream_unpack(data, &seq, &first, samples);
+    result->missing += first - *next;
+    *next = first + ADCSTREAM_FRAME_SAMPLES;
+    for (uint32_t idx = 0U; idx < ADCSTREAM_FRAME_SAMPLES; idx++)
+    {
+        if (samples[idx] != sim_sample(first + idx))
+        {
+            result->wrong++;
+        }
+    }
+    result->received += ADCSTREAM_FRAME_SAMPLES;
+}
+
+/*******************************************************************************
+* Function Name: sim_run
+********************************************************************************
+* Summary:
+* Runs a scenario: the DMA writes the samples into the double buffer at the
+* sample clock, and the main loop sends the frames as adcstream_can_poll()
+* does, with a millisecond clock and one TX buffer that is free once its
+* frame is off the bus.
+*
+*******************************************************************************/
+static void sim_run(const sim_scenario_t *scenario, uint32_t frame_ns,
+                    sim_result_t *result)
+{
+    adcstream_pacer_t pacer;
+    uint16_t block[ADCSTREAM_BLOCK_SAMPLES];
+    uint8_t data[ADCSTREAM_FRAME_LEN];
+    uint64_t end_ns = (uint64_t)SIM_DURATION_MS * 1000000U;
+    uint64_t next_loop_ns = 0U;
+    uint64_t tx_free_ns = 0U;
+    uint32_t block_num = 0U;
+    uint32_t frame_idx = ADCSTREAM_BLOCK_FRAMES;
+    uint32_t sample = 0U;
+    uint32_t last_ms = 0U;
+    uint32_t next = 0U;
+    uint8_t seq = 0U;
+
+    memset(result, 0, sizeof(*result));
+    adcstream_dbuf_init(&sim_dbuf);
+    adcstream_pacer_init(&pacer, scenario->load_pct,
+                         SIM_BURST_US * 10U * scenario->load_pct);
+
+    while (true)
+    {
+        uint64_t sample_ns = ((uint64_t)sample * 1000000000U) /
+                             scenario->rate_hz;
+        uint64_t now_ns = (sample_ns < next_loop_ns) ? sample_ns :
+                          next_loop_ns;
+        uint32_t now_ms = (uint32_t)(now_ns / 1000000U);
+
+        if (now_ns >= end_ns)
+        {
+            break;
+        }
+
+        if (sample_ns <= next_loop_ns)
+        {
+            /* DMA element transfer, then the interrupt at the end of a
+             * half */
+            sim_dbuf.half[(sample / ADCSTREAM_BLOCK_SAMPLES) & 1U]
+                         [sample % ADCSTREAM_BLOCK_SAMPLES] =
+                sim_sample(sample);
+            sample++;
+            if (0U == (sample % ADCSTREAM_BLOCK_SAMPLES))
+            {
+                adcstream_dbuf_complete(&sim_dbuf);
+            }
+            continue;
+        }
+
+        /* Main loop pass */
+        adcstream_pacer_advance(&pacer, (now_ms - last_ms) * 1000U);
+        last_ms = now_ms;
+        while (adcstream_pacer_ready(&pacer))
+        {
+            uint32_t offset;
+
+            if (ADCSTREAM_BLOCK_FRAMES <= frame_idx)
+            {
+                if (!adcstream_dbuf_take(&sim_dbuf, block, &block_num))
+                {
+                    break;
+                }
+                frame_idx = 0U;
+            }
+            if (tx_free_ns > now_ns)
+            {
+                break;
+            }
+
+            offset = frame_idx * ADCSTREAM_FRAME_SAMPLES;
+            adcstream_pack(data, seq, (block_num * ADCSTREAM_BLOCK_SAMPLES) +
+                           offset, &block[offset]);
+            tx_free_ns = now_ns + frame_ns;
+            sim_receive(data, &next, result);
+            adcstream_pacer_spend(&pacer, frame_ns);
+            result->frames++;
+            result->bus_ns += frame_ns;
+            seq++;
+            frame_idx++;
+        }
+
+        next_loop_ns += (uint64_t)SIM_LOOP_US * 1000U;
+        if ((0U != scenario->stall_every_ms) &&
+            ((next_loop_ns / 1000000U) % scenario->stall_every_ms == 0U) &&
+            ((next_loop_ns % 1000000U) < ((uint64_t)SIM_LOOP_US * 1000U)))
+        {
+            next_loop_ns += (uint64_t)scenario->stall_ms * 1000000U;
+        }
+    }
+
+    result->generated = (uint64_t)sim_dbuf.done * ADCSTREAM_BLOCK_SAMPLES;
+    result->dropped = sim_dbuf.dropped;
+    result->pending = ((ADCSTREAM_BLOCK_FRAMES - frame_idx) *
+                       ADCSTREAM_FRAME_SAMPLES) +
+                      ((sim_dbuf.done - sim_dbuf.taken) *
+                       ADCSTREAM_BLOCK_SAMPLES);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs each scenario and prints the samples per second sent, the dropped
+* blocks and the bus load. Fails if a sample arrives changed, if a sample
+* is neither received, dropped with its block nor still waiting, if a block
+* is dropped while the stream fits under its cap, or if the stream goes
+* over its cap.
+*
+*******************************************************************************/
+int main(void)
+{
+    const txfmt_rates_t rates = { TXFMT_NOMINAL_BPS, TXFMT_DATA_BPS };
+    uint32_t frame_ns = txfmt_frame_ns(&rates, TXFMT_FD_BRS,
+                                       ADCSTREAM_FRAME_LEN, false);
+    double duration_s = (double)SIM_DURATION_MS / 1000.0;
+    int result = 0;
+
+    printf("Nominal %lu kbit/s, data %lu kbit/s, %u samples of 12 bits per "
+           "%u-byte frame (%lu us), %u frames per block, %u s per scenario\n",
+           (unsigned long)(TXFMT_NOMINAL_BPS / 1000UL),
+           (unsigned long)(TXFMT_DATA_BPS / 1000UL),
+           (unsigned)ADCSTREAM_FRAME_SAMPLES, (unsigned)ADCSTREAM_FRAME_LEN,
+           (unsigned long)(frame_ns / 1000U), (unsigned)ADCSTREAM_BLOCK_FRAMES,
+           (unsigned)(SIM_DURATION_MS / 1000U));
+    printf("  %-22s %9s %9s %8s %8s %8s\n", "scenario", "needs", "sent/s",
+           "blocks", "dropped", "load");
+
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(sim_scenarios) / sizeof(sim_scenarios[0]));
+         idx++)
+    {
+        const sim_scenario_t *scenario = &sim_scenarios[idx];
+        double need = 100.0 * (double)scenario->rate_hz * (double)frame_ns /
+                      ((double)ADCSTREAM_FRAME_SAMPLES * 1.0e9);
+        double load;
+        bool ok;
+        sim_result_t run;
+
+        sim_run(scenario, frame_ns, &run);
+        load = 100.0 * (double)run.bus_ns / (duration_s * 1.0e9);
+
+        /* Over the cap by at most the saved-up burst and one frame */
+        ok = (0U == run.wrong) &&
+             (run.generated == (run.received + run.pending +
+                                ((uint64_t)run.dropped *
+                                 ADCSTREAM_BLOCK_SAMPLES))) &&
+             (run.missing == ((uint64_t)run.dropped *
+                              ADCSTREAM_BLOCK_SAMPLES)) &&
+             ((need >= (double)scenario->load_pct) ||
+              (0U != scenario->stall_every_ms) || (0U == run.dropped)) &&
+             ((run.bus_ns) <=
+              (((uint64_t)SIM_DURATION_MS * 10000U * scenario->load_pct) +
+               ((uint64_t)SIM_BURST_US * 10U * scenario->load_pct) +
+               frame_ns));
+
+        printf("  %-22s %8.1f%% %9.0f %8lu %8lu %7.1f%%  %s\n",
+               scenario->name, need, (double)run.received / duration_s,
+               (unsigned long)(run.generated / ADCSTREAM_BLOCK_SAMPLES),
+               (unsigned long)run.dropped, load, ok ? "ok" : "FAIL");
+        if (!ok)
+        {
+            result = 1;
+        }
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,140 @@
+/******************************************************************************
+* File Name:   bench_host.c
+*
+* Description: This file contains the host build of the software benchmark
+*              cases, which prints the same result block as the board.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "bench.h"
+#include "pubsub.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* The cycle counter of the PDL stub counts nanoseconds */
+uint32_t SystemCoreClock = 1000000000UL;
+
+/* Channel of the TX enqueue cases; the PDL stub sends nothing */
+static CANFD_Type             sim_canfd;
+static cy_stc_canfd_context_t sim_canfd_context;
+
+/*******************************************************************************
+* Function Name: app_control_on_frame, app_stream_on_frame, ...
+********************************************************************************
+* Summary:
+* The subscribers of PUBSUB_SUBSCRIBER_LIST are the application's. These
+* empty versions let pubsub.c link, so that the dispatch cases measure the
+* publish/subscribe layer itself.
+*
+*******************************************************************************/
+#define SIM_HANDLER(name, prio, fn, topics)                                    \
+    void fn(pubsub_handle_t handle, const canfd_frame_t *frame)                \
+    {                                                                          \
+        CY_UNUSED_PARAMETER(handle);                                           \
+        CY_UNUSED_PARAMETER(frame);                                            \
+    }
+PUBSUB_SUBSCRIBER_LIST(SIM_HANDLER)
+#undef SIM_HANDLER
+
+/*******************************************************************************
+* Function Name: bench_hw_run, bench_wake_run, bench_rxdma_run, ...
+********************************************************************************
+* Summary:
+* The groups that need the CAN FD channel, the DataWire or Cryptolite, or the
+* SIMD instructions of the device only run on the board. These empty
+* versions let bench.c link; main() does not call them.
+*
+*******************************************************************************/
+void bench_hw_run(CANFD_Type *base, uint32_t chan,
+                  cy_stc_canfd_context_t *context)
+{
+    CY_UNUSED_PARAMETER(base);
+    CY_UNUSED_PARAMETER(chan);
+    CY_UNUSED_PARAMETER(context);
+}
+
+void bench_wake_run(CANFD_Type *base, uint32_t chan,
+                    cy_stc_canfd_context_t *context)
+{
+    CY_UNUSED_PARAMETER(base);
+    CY_UNUSED_PARAMETER(chan);
+    CY_UNUSED_PARAMETER(context);
+}
+
+void bench_rxdma_run(CANFD_Type *base, uint32_t chan,
+                     cy_stc_canfd_context_t *context)
+{
+    CY_UNUSED_PARAMETER(base);
+    CY_UNUSED_PARAMETER(chan);
+    CY_UNUSED_PARAMETER(context);
+}
+
+void bench_wake_print(void) {}
+void bench_fzip_run(void) {}
+void bench_fzip_print(void) {}
+void bench_rxdma_print(void) {}
+void bench_dsp_run(void) {}
+void bench_dsp_print(void) {}
+void bench_cancrypt_run(void) {}
+void bench_cancrypt_print(void) {}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs the software hot-path cases of bench_suite.c and prints them as the
+* same JSON block as the board, between "BENCH BEGIN" and "BENCH END", so
+* scripts/bench_compare.py reads it as it is. The cycles are nanoseconds of
+* the host, and cpu_hz is 1 GHz.
+*
+*******************************************************************************/
+int main(void)
+{
+    pubsub_init();
+    bench_begin();
+    bench_sw_run(&sim_canfd, 0U, &sim_canfd_context);
+    bench_end();
+
+    return 0;
+}
+
+/* [] END OF FILE */
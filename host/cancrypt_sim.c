@@ -0,0 +1,488 @@
+/******************************************************************************
+* File Name:   cancrypt_sim.c
+*
+* Description: This file contains the host check of the bitsliced AES-128 and
+*              of GCM against published test vectors, of sealed frames, and
+*              of the replay check.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "cancrypt.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Random payloads of the round trip check */
+#define SIM_FRAMES              (20000U)
+
+/* Frames of the timing run */
+#define SIM_TIMED_FRAMES        (100000U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    const char *key;
+    const char *plain;
+    const char *cipher;
+} sim_aes_case_t;
+
+/* Frame of the replay check: sealed with the epoch and counter, then
+ * received, and the result the receiver must give */
+typedef struct
+{
+    const char          *name;
+    cancrypt_mode_t      mode;
+    uint32_t             epoch;
+    uint32_t             counter;
+    cancrypt_rx_result_t result;
+} sim_rx_case_t;
+
+typedef struct
+{
+    const char *name;
+    const char *key;
+    const char *iv;
+    const char *aad;
+    const char *plain;
+    const char *cipher;
+    const char *tag;
+} sim_gcm_case_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* FIPS-197, appendices B and C.1 */
+static const sim_aes_case_t sim_aes_cases[] =
+{
+    { "aes-128 fips-197 b", "2b7e151628aed2a6abf7158809cf4f3c",
+      "3243f6a8885a308d313198a2e0370734",
+      "3925841d02dc09fbdc118597196a0b32" },
+    { "aes-128 fips-197 c.1", "000102030405060708090a0b0c0d0e0f",
+      "00112233445566778899aabbccddeeff",
+      "69c4e0d86a7b0430d8cdb78070b4c55a" },
+};
+
+/* Test cases 1 to 4 of the GCM specification */
+static const sim_gcm_case_t sim_gcm_cases[] =
+{
+    { "gcm test case 1", "00000000000000000000000000000000",
+      "000000000000000000000000", "", "", "",
+      "58e2fccefa7e3061367f1d57a4e7455a" },
+    { "gcm test case 2", "00000000000000000000000000000000",
+      "000000000000000000000000", "",
+      "00000000000000000000000000000000",
+      "0388dace60b6a392f328c2b971b2fe78",
+      "ab6e47d42cec13bdf53a67b21257bddf" },
+    { "gcm test case 3", "feffe9928665731c6d6a8f9467308308",
+      "cafebabefacedbaddecaf888", "",
+      "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+      "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b391aafd255",
+      "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+      "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091473f5985",
+      "4d5c2af327cd64a62cf35abd2ba6fab4" },
+    { "gcm test case 4", "feffe9928665731c6d6a8f9467308308",
+      "cafebabefacedbaddecaf888",
+      "feedfacedeadbeeffeedfacedeadbeefabaddad2",
+      "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+      "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39",
+      "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+      "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091",
+      "5bc94fbc3221a5db94fae95ae7121a47" },
+};
+
+static uint64_t sim_rng = 0x9E3779B97F4A7C15ULL;
+
+/*******************************************************************************
+* Function Name: sim_random
+********************************************************************************
+* Summary:
+* Returns a random 32-bit number (xorshift64*).
+*
+*******************************************************************************/
+static uint32_t sim_random(void)
+{
+    sim_rng ^= sim_rng >> 12;
+    sim_rng ^= sim_rng << 25;
+    sim_rng ^= sim_rng >> 27;
+    return (uint32_t)((sim_rng * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+/*******************************************************************************
+* Function Name: sim_hex
+********************************************************************************
+* Summary:
+* Converts a hex string into bytes and returns their number.
+*
+*******************************************************************************/
+static uint32_t sim_hex(uint8_t *out, const char *hex)
+{
+    uint32_t len = 0U;
+
+    while (('\0' != hex[0]) && ('\0' != hex[1]))
+    {
+        unsigned value;
+
+        (void)sscanf(hex, "%2x", &value);
+        out[len++] = (uint8_t)value;
+        hex += 2;
+    }
+    return len;
+}
+
+/*******************************************************************************
+* Function Name: sim_report
+********************************************************************************
+* Summary:
+* Prints the result of one check.
+*
+*******************************************************************************/
+static bool sim_report(const char *name, bool ok)
+{
+    printf("  %-28s %s\n", name, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: sim_check_aes
+********************************************************************************
+* Summary:
+* Encrypts a known-answer block, alone and as the second block of a pass,
+* so that both lanes of the bitsliced rounds are checked.
+*
+*******************************************************************************/
+static bool sim_check_aes(const sim_aes_case_t *test)
+{
+    static cancrypt_aes_t aes;
+    uint8_t key[CANCRYPT_KEY_LEN];
+    uint8_t blocks[3U * CANCRYPT_BLOCK_LEN];
+    uint8_t expect[CANCRYPT_BLOCK_LEN];
+    bool ok;
+
+    (void)sim_hex(key, test->key);
+    (void)sim_hex(expect, test->cipher);
+    cancrypt_aes_init(&aes, key);
+
+    (void)sim_hex(blocks, test->plain);
+    memcpy(&blocks[CANCRYPT_BLOCK_LEN], blocks, CANCRYPT_BLOCK_LEN);
+    memcpy(&blocks[2U * CANCRYPT_BLOCK_LEN], blocks, CANCRYPT_BLOCK_LEN);
+    cancrypt_aes_ecb(&aes, blocks, blocks, 3U);
+
+    ok = (0 == memcmp(blocks, expect, CANCRYPT_BLOCK_LEN)) &&
+         (0 == memcmp(&blocks[CANCRYPT_BLOCK_LEN], expect,
+                      CANCRYPT_BLOCK_LEN)) &&
+         (0 == memcmp(&blocks[2U * CANCRYPT_BLOCK_LEN], expect,
+                      CANCRYPT_BLOCK_LEN));
+    return sim_report(test->name, ok);
+}
+
+/*******************************************************************************
+* Function Name: sim_check_gcm
+********************************************************************************
+* Summary:
+* Encrypts and decrypts a known-answer case and checks the ciphertext, the
+* full tag and the plaintext.
+*
+*******************************************************************************/
+static bool sim_check_gcm(const sim_gcm_case_t *test)
+{
+    static cancrypt_aes_t aes;
+    static cancrypt_key_t key;
+    uint8_t raw_key[CANCRYPT_KEY_LEN];
+    uint8_t iv[CANCRYPT_IV_LEN];
+    uint8_t aad[32];
+    uint8_t plain[64];
+    uint8_t data[64];
+    uint8_t cipher[64];
+    uint8_t expect_tag[CANCRYPT_BLOCK_LEN];
+    uint8_t tag[CANCRYPT_BLOCK_LEN];
+    uint32_t aad_len;
+    uint32_t len;
+    bool ok;
+
+    (void)sim_hex(raw_key, test->key);
+    (void)sim_hex(iv, test->iv);
+    aad_len = sim_hex(aad, test->aad);
+    len = sim_hex(plain, test->plain);
+    (void)sim_hex(cipher, test->cipher);
+    (void)sim_hex(expect_tag, test->tag);
+    cancrypt_aes_init(&aes, raw_key);
+    cancrypt_key_init(&key, cancrypt_aes_ecb, &aes);
+
+    memcpy(data, plain, len);
+    cancrypt_gcm(&key, true, iv, aad, aad_len, data, len, tag);
+    ok = (0 == memcmp(data, cipher, len)) &&
+         (0 == memcmp(tag, expect_tag, sizeof(tag)));
+
+    cancrypt_gcm(&key, false, iv, aad, aad_len, data, len, tag);
+    ok = ok && (0 == memcmp(data, plain, len)) &&
+         (0 == memcmp(tag, expect_tag, sizeof(tag)));
+    return sim_report(test->name, ok);
+}
+
+/*******************************************************************************
+* Function Name: sim_check_frames
+********************************************************************************
+* Summary:
+* Seals random payloads of every length that fits, opens them, and flips one
+* random bit of each sealed payload or changes its ID: with GCM every
+* changed frame must fail to open, with CTR it opens to a changed payload,
+* padding included.
+*
+*******************************************************************************/
+static bool sim_check_frames(const cancrypt_key_t *key, cancrypt_mode_t mode)
+{
+    uint32_t max_len = 64U - CANCRYPT_HEADER_LEN -
+                       ((CANCRYPT_MODE_GCM == mode) ? CANCRYPT_TAG_LEN : 0U);
+    uint32_t bad = 0U;
+    char name[40];
+
+    for (uint32_t frame = 0U; frame < SIM_FRAMES; frame++)
+    {
+        uint8_t plain[64] = { 0U };
+        uint8_t data[64];
+        uint8_t copy[64];
+        uint32_t len = sim_random() % (max_len + 1U);
+        uint32_t id = sim_random() & 0x7FFU;
+        uint32_t epoch = sim_random();
+        uint32_t counter;
+        uint8_t sealed;
+        int32_t opened;
+
+        for (uint32_t idx = 0U; idx < len; idx++)
+        {
+            plain[idx] = (uint8_t)sim_random();
+        }
+        memcpy(data, plain, len);
+        sealed = cancrypt_seal(key, mode, id, epoch, frame, data,
+                               (uint8_t)len);
+        memcpy(copy, data, sealed);
+
+        opened = cancrypt_open(key, mode, id, data, sealed, &epoch, &counter);
+        if ((0 == sealed) || (opened < (int32_t)len) ||
+            (counter != frame) || (0 != memcmp(data, plain, len)))
+        {
+            bad++;
+            continue;
+        }
+
+        /* One flipped bit, or the frame received under another ID */
+        if (0U != (sim_random() & 1U))
+        {
+            uint32_t bit = sim_random() % (sealed * 8U);
+
+            copy[bit / 8U] ^= (uint8_t)(1U << (bit % 8U));
+        }
+        else
+        {
+            id ^= 1U + (sim_random() & 0x3FFU);
+        }
+        opened = cancrypt_open(key, mode, id, copy, sealed, &epoch, &counter);
+        if ((CANCRYPT_MODE_GCM == mode) ? (opened >= 0) :
+            ((opened > 0) && (counter == frame) &&
+             (0 == memcmp(copy, plain, (uint32_t)opened))))
+        {
+            bad++;
+        }
+    }
+
+    (void)snprintf(name, sizeof(name), "%s frames, 0 to %lu bytes",
+                   (CANCRYPT_MODE_GCM == mode) ? "gcm" : "ctr",
+                   (unsigned long)max_len);
+    return sim_report(name, 0U == bad);
+}
+
+/*******************************************************************************
+* Function Name: sim_check_replay
+********************************************************************************
+* Summary:
+* Receives frames of one ID in the order of sim_rx_cases, as a sender that
+* restarts, and an attacker that resends frames it recorded or forges CTR
+* frames, would put them on the bus. A GCM frame of an older epoch must be
+* dropped even though it opens, and a dropped frame, or any CTR frame, must
+* leave the receiver as it was.
+*
+*******************************************************************************/
+static bool sim_check_replay(const cancrypt_key_t *key)
+{
+    static const sim_rx_case_t sim_rx_cases[] =
+    {
+        { "first frame",       CANCRYPT_MODE_GCM, 5U, 7U, CANCRYPT_RX_NEXT },
+        { "next counter",      CANCRYPT_MODE_GCM, 5U, 8U, CANCRYPT_RX_NEXT },
+        { "same counter",      CANCRYPT_MODE_GCM, 5U, 8U, CANCRYPT_RX_REPLAY },
+        { "sender restarts",   CANCRYPT_MODE_GCM, 6U, 0U,
+          CANCRYPT_RX_RESTART },
+        { "older epoch",       CANCRYPT_MODE_GCM, 5U, 9U, CANCRYPT_RX_REPLAY },
+        { "older epoch, 0",    CANCRYPT_MODE_GCM, 4U, 0U, CANCRYPT_RX_REPLAY },
+        { "after the replays", CANCRYPT_MODE_GCM, 6U, 1U, CANCRYPT_RX_NEXT },
+        { "ctr, last epoch",   CANCRYPT_MODE_CTR, UINT32_MAX, UINT32_MAX,
+          CANCRYPT_RX_NEXT },
+        { "counter skipped",   CANCRYPT_MODE_GCM, 6U, 9U, CANCRYPT_RX_NEXT },
+        { "older counter",     CANCRYPT_MODE_GCM, 6U, 5U, CANCRYPT_RX_REPLAY },
+        { "ctr, older epoch",  CANCRYPT_MODE_CTR, 4U, 0U, CANCRYPT_RX_NEXT },
+        { "sender restarts again", CANCRYPT_MODE_GCM, 7U, 0U,
+          CANCRYPT_RX_RESTART },
+    };
+    cancrypt_rx_t rx = { 0U };
+    bool ok = true;
+
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(sim_rx_cases) / sizeof(sim_rx_cases[0]));
+         idx++)
+    {
+        const sim_rx_case_t *test = &sim_rx_cases[idx];
+        cancrypt_rx_t before = rx;
+        uint8_t data[64] = { 0x5AU, (uint8_t)idx };
+        uint32_t epoch;
+        uint32_t counter;
+        uint8_t sealed;
+        bool case_ok;
+
+        sealed = cancrypt_seal(key, test->mode, 0x001U, test->epoch,
+                               test->counter, data, 2U);
+        case_ok = (cancrypt_open(key, test->mode, 0x001U, data, sealed,
+                                 &epoch, &counter) >= 2) &&
+                  (test->result ==
+                   cancrypt_rx_check(&rx, test->mode, epoch, counter));
+        if ((CANCRYPT_RX_REPLAY == test->result) ||
+            (CANCRYPT_MODE_CTR == test->mode))
+        {
+            case_ok = case_ok && (rx.epoch == before.epoch) &&
+                      (rx.counter == before.counter);
+        }
+        if (!case_ok)
+        {
+            printf("    %s: epoch %lu counter %lu\n", test->name,
+                   (unsigned long)test->epoch, (unsigned long)test->counter);
+        }
+        ok = ok && case_ok;
+    }
+
+    return sim_report("replay, gcm and ctr", ok);
+}
+
+/*******************************************************************************
+* Function Name: sim_time
+********************************************************************************
+* Summary:
+* Prints the host time to seal and open a full payload, for comparison with
+* the cycles that "make BENCHMARK_ENABLE=1" measures on the target.
+*
+*******************************************************************************/
+static void sim_time(const cancrypt_key_t *key, cancrypt_mode_t mode)
+{
+    uint8_t len = (CANCRYPT_MODE_GCM == mode) ? 48U : 56U;
+    uint8_t data[64] = { 0U };
+    uint32_t epoch;
+    uint32_t counter;
+    clock_t start = clock();
+    double ns;
+
+    for (uint32_t frame = 0U; frame < SIM_TIMED_FRAMES; frame++)
+    {
+        uint8_t sealed = cancrypt_seal(key, mode, 0x001U, 1U, frame, data, len);
+
+        (void)cancrypt_open(key, mode, 0x001U, data, sealed, &epoch,
+                            &counter);
+    }
+    ns = 1.0e9 * (double)(clock() - start) /
+         ((double)CLOCKS_PER_SEC * SIM_TIMED_FRAMES);
+    printf("  %s seal + open, %u bytes: %.0f ns per frame on this host\n",
+           (CANCRYPT_MODE_GCM == mode) ? "gcm" : "ctr", (unsigned)len, ns);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Checks the bitsliced AES-128 against FIPS-197 and GCM against the test
+* cases of its specification, then seals and opens random frames, and
+* replays frames of older epochs. Fails on any wrong result, if a changed
+* GCM frame opens, or if a replayed frame is taken.
+*
+*******************************************************************************/
+int main(void)
+{
+    static cancrypt_aes_t aes;
+    static cancrypt_key_t key;
+    uint8_t raw_key[CANCRYPT_KEY_LEN];
+    int result = 0;
+
+    printf("Known-answer checks\n");
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(sim_aes_cases) / sizeof(sim_aes_cases[0]));
+         idx++)
+    {
+        result |= sim_check_aes(&sim_aes_cases[idx]) ? 0 : 1;
+    }
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(sim_gcm_cases) / sizeof(sim_gcm_cases[0]));
+         idx++)
+    {
+        result |= sim_check_gcm(&sim_gcm_cases[idx]) ? 0 : 1;
+    }
+
+    printf("Sealed frames, %u random payloads per mode, one bit or the ID "
+           "changed\n", (unsigned)SIM_FRAMES);
+    for (uint32_t idx = 0U; idx < CANCRYPT_KEY_LEN; idx++)
+    {
+        raw_key[idx] = (uint8_t)sim_random();
+    }
+    cancrypt_aes_init(&aes, raw_key);
+    cancrypt_key_init(&key, cancrypt_aes_ecb, &aes);
+    result |= sim_check_frames(&key, CANCRYPT_MODE_GCM) ? 0 : 1;
+    result |= sim_check_frames(&key, CANCRYPT_MODE_CTR) ? 0 : 1;
+
+    printf("Replayed frames, epochs counting the start-ups of the sender\n");
+    result |= sim_check_replay(&key) ? 0 : 1;
+
+    sim_time(&key, CANCRYPT_MODE_GCM);
+    sim_time(&key, CANCRYPT_MODE_CTR);
+
+    return result;
+}
+
+/* [] END OF FILE */
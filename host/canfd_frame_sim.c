@@ -0,0 +1,215 @@
+/******************************************************************************
+* File Name:   canfd_frame_sim.c
+*
+* Description: This file contains the check of the decoding of received
+*              messages and TX buffers into frames, run on a host.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "canfd_frame.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Byte the destination frame is filled with before a decode, to see which
+ * bytes the decode wrote */
+#define SIM_FILL                (0xA5U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Received message as handed to the RX callback */
+typedef struct
+{
+    cy_stc_canfd_r0_t        r0;
+    cy_stc_canfd_r1_t        r1;
+    uint32_t                 data[CANFD_MAX_DATA_LEN / 4U];
+    cy_stc_canfd_rx_buffer_t buf;
+} sim_rx_msg_t;
+
+/* TX buffer as set up in the design */
+typedef struct
+{
+    cy_stc_canfd_t0_t        t0;
+    cy_stc_canfd_t1_t        t1;
+    uint32_t                 data[CANFD_MAX_DATA_LEN / 4U];
+    cy_stc_canfd_tx_buffer_t buf;
+} sim_tx_msg_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Cycle counter rate of the PDL stub, unused by these checks */
+uint32_t SystemCoreClock = 1000000000UL;
+
+/*******************************************************************************
+* Function Name: sim_report
+********************************************************************************
+* Summary:
+* Prints the result of one check.
+*
+*******************************************************************************/
+static bool sim_report(const char *name, bool ok)
+{
+    printf("  %-28s %s\n", name, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: sim_decoded
+********************************************************************************
+* Summary:
+* Checks a decoded frame: its length, its payload against the message, that
+* no byte after the payload was written and that reserved was cleared.
+*
+*******************************************************************************/
+static bool sim_decoded(const canfd_frame_t *frame, const uint32_t *data,
+                        uint8_t len)
+{
+    bool ok = (len == frame->len) && (0U == frame->reserved) &&
+              (0 == memcmp(frame->data, data, len));
+
+    for (uint32_t idx = len; idx < CANFD_MAX_DATA_LEN; idx++)
+    {
+        ok = ok && (SIM_FILL == frame->data[idx]);
+    }
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: sim_check_rx
+********************************************************************************
+* Summary:
+* Decodes a received message of every DLC, as a classic and as a CAN FD
+* frame. A classic frame with DLC 9 to 15 must give 8 bytes.
+*
+*******************************************************************************/
+static bool sim_check_rx(bool fdf)
+{
+    static sim_rx_msg_t msg;
+    canfd_frame_t frame;
+    bool ok = true;
+
+    for (uint32_t idx = 0U; idx < (CANFD_MAX_DATA_LEN / 4U); idx++)
+    {
+        msg.data[idx] = 0x9E3779B9UL * (idx + 1U);
+    }
+    msg.r0.id = 0x123U;
+    msg.r0.rtr = CY_CANFD_RTR_DATA_FRAME;
+    msg.r0.xtd = CY_CANFD_XTD_STANDARD_ID;
+    msg.r1.fdf = fdf ? CY_CANFD_FDF_CAN_FD_FRAME : CY_CANFD_FDF_STANDARD_FRAME;
+    msg.r1.brs = fdf;
+    msg.buf.r0_f = &msg.r0;
+    msg.buf.r1_f = &msg.r1;
+    msg.buf.data_area_f = msg.data;
+
+    for (uint32_t dlc = 0U; dlc < 16U; dlc++)
+    {
+        uint8_t len = canfd_dlc_to_len(dlc);
+
+        if ((!fdf) && (len > CANFD_CLASSIC_MAX_DATA_LEN))
+        {
+            len = CANFD_CLASSIC_MAX_DATA_LEN;
+        }
+        msg.r1.dlc = dlc;
+        memset(&frame, SIM_FILL, sizeof(frame));
+        canfd_frame_from_rx_buffer(&frame, &msg.buf);
+        ok = ok && sim_decoded(&frame, msg.data, len) &&
+             ((0U != (frame.flags & CANFD_FRAME_FLAG_FDF)) == fdf);
+    }
+    return sim_report(fdf ? "rx, CAN FD, DLC 0 to 15" :
+                            "rx, classic, DLC 0 to 15", ok);
+}
+
+/*******************************************************************************
+* Function Name: sim_check_tx
+********************************************************************************
+* Summary:
+* Decodes a classic TX buffer with DLC 15, which must give 8 bytes.
+*
+*******************************************************************************/
+static bool sim_check_tx(void)
+{
+    static sim_tx_msg_t msg;
+    canfd_frame_t frame;
+
+    for (uint32_t idx = 0U; idx < (CANFD_MAX_DATA_LEN / 4U); idx++)
+    {
+        msg.data[idx] = 0x7F4A7C15UL * (idx + 1U);
+    }
+    msg.t0.id = 0x001U;
+    msg.t1.dlc = 15U;
+    msg.t1.fdf = CY_CANFD_FDF_STANDARD_FRAME;
+    msg.buf.t0_f = &msg.t0;
+    msg.buf.t1_f = &msg.t1;
+    msg.buf.data_area_f = msg.data;
+
+    memset(&frame, SIM_FILL, sizeof(frame));
+    canfd_frame_from_tx_buffer(&frame, &msg.buf);
+    return sim_report("tx buffer, classic, DLC 15",
+                      sim_decoded(&frame, msg.data,
+                                  CANFD_CLASSIC_MAX_DATA_LEN));
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Checks the decoding of received messages and TX buffers into frames. Fails
+* if a length is wrong, a byte past the payload is written, or reserved is
+* not cleared.
+*
+*******************************************************************************/
+int main(void)
+{
+    int result = 0;
+
+    printf("Frame decode checks\n");
+    result |= sim_check_rx(false) ? 0 : 1;
+    result |= sim_check_rx(true) ? 0 : 1;
+    result |= sim_check_tx() ? 0 : 1;
+
+    return result;
+}
+
+/* [] END OF FILE */
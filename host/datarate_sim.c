@@ -0,0 +1,382 @@
+/******************************************************************************
+* File Name:   datarate_sim.c
+*
+* Description: This file contains the simulation of the goodput of a bus with
+*              a degrading harness, at fixed data phase bit rates and with the
+*              adaptation.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "datarate.h"
+#include "txfmt.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Simulated time per scenario */
+#define SIM_DURATION_MS         (120000U)
+
+/* Two senders that always have a frame ready, with these payloads */
+#define SIM_SENDERS             (2U)
+#define SIM_LEN_A               (64U)
+#define SIM_LEN_B               (16U)
+
+/* Error frame after an error in the data phase: error flag, echoed flags,
+ * delimiter and intermission, in nominal bits */
+#define SIM_ERROR_FRAME_BITS    (6U + 6U + 8U + 3U)
+
+/* Transmit error counter limit, and the recovery of a sender in bus-off:
+ * 128 sequences of 11 recessive bits */
+#define SIM_BUS_OFF_TEC         (256U)
+#define SIM_BUS_OFF_BITS        (128U * 11U)
+
+/* Command frame of the coordination protocol: 4-byte classic frame */
+#define SIM_COMMAND_LEN         (4U)
+
+/* Strategies: one fixed setting each, then the adaptive one */
+#define SIM_ADAPTIVE            ((uint32_t)DATARATE_LEVEL_COUNT)
+#define SIM_STRATEGIES          (SIM_ADAPTIVE + 1U)
+
+/* Scenario with a harness that degrades for part of the time: bit error
+ * probabilities in the data phase per setting, clean and degraded. The
+ * harness is degraded from degrade_ms on for degrade_len_ms of every
+ * period_ms. */
+#define SIM_CLEAN_BER           { 1.0e-9, 1.0e-9, 1.0e-9 }
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    double ber_degraded[DATARATE_LEVEL_COUNT];
+    uint32_t period_ms;
+    uint32_t degrade_ms;
+    uint32_t degrade_len_ms;
+} sim_scenario_t;
+
+typedef struct
+{
+    double goodput;                 /* Payload bytes delivered per second */
+    uint32_t failed;                /* Frames destroyed by an error */
+    uint32_t bus_off;
+    datarate_stats_t stats;
+} sim_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const sim_scenario_t sim_scenarios[] =
+{
+    { "clean harness",      SIM_CLEAN_BER,              1U, 0U, 0U },
+    { "marginal harness",   { 3.0e-5, 1.0e-6, 1.0e-8 }, 1U, 0U, 1U },
+    { "degraded harness",   { 1.0e-3, 2.0e-5, 1.0e-7 }, 1U, 0U, 1U },
+    { "severe harness",     { 1.0e-2, 1.0e-3, 1.0e-6 }, 1U, 0U, 1U },
+    { "intermittent 10/30 s", { 1.0e-3, 2.0e-5, 1.0e-7 }, 30000U, 10000U,
+                              10000U },
+};
+
+static const double sim_clean_ber[DATARATE_LEVEL_COUNT] = SIM_CLEAN_BER;
+
+static uint64_t sim_rng = 0x9E3779B97F4A7C15ULL;
+
+/*******************************************************************************
+* Function Name: sim_random
+********************************************************************************
+* Summary:
+* Returns a uniform random number in [0, 1) (xorshift64*).
+*
+*******************************************************************************/
+static double sim_random(void)
+{
+    sim_rng ^= sim_rng >> 12;
+    sim_rng ^= sim_rng << 25;
+    sim_rng ^= sim_rng >> 27;
+    return (double)((sim_rng * 0x2545F4914F6CDD1DULL) >> 11) /
+           9007199254740992.0;
+}
+
+/*******************************************************************************
+* Function Name: sim_rates
+********************************************************************************
+* Summary:
+* Returns the bit rates and the format of a setting.
+*
+*******************************************************************************/
+static txfmt_format_t sim_rates(datarate_level_t level, txfmt_rates_t *rates)
+{
+    rates->nominal_bps = TXFMT_NOMINAL_BPS;
+    rates->data_bps = TXFMT_DATA_BPS / datarate_divider(level);
+    return datarate_brs(level) ? TXFMT_FD_BRS : TXFMT_FD;
+}
+
+/*******************************************************************************
+* Function Name: sim_data_bits
+********************************************************************************
+* Summary:
+* Returns the bits of the data phase of a CAN FD frame, from ESI to the CRC,
+* with the most stuff bits.
+*
+*******************************************************************************/
+static uint32_t sim_data_bits(uint8_t len)
+{
+    uint32_t bits = 5U + (8U * len);
+    uint32_t crc = (len > 16U) ? 21U : 17U;
+
+    return bits + (bits / 4U) + 4U + crc + ((4U + crc + 3U) / 4U);
+}
+
+/*******************************************************************************
+* Function Name: sim_degraded
+********************************************************************************
+* Summary:
+* Returns whether the harness of a scenario is degraded at a time.
+*
+*******************************************************************************/
+static bool sim_degraded(const sim_scenario_t *scenario, uint32_t now_ms)
+{
+    uint32_t phase = now_ms % scenario->period_ms;
+
+    return (phase >= scenario->degrade_ms) &&
+           (phase < (scenario->degrade_ms + scenario->degrade_len_ms));
+}
+
+/*******************************************************************************
+* Function Name: sim_run
+********************************************************************************
+* Summary:
+* Runs a scenario with a fixed setting, or with the adaptive controller
+* if strategy is SIM_ADAPTIVE. The senders take turns; each error destroys
+* the frame, which its sender repeats.
+*
+*******************************************************************************/
+static void sim_run(const sim_scenario_t *scenario, uint32_t strategy,
+                    sim_result_t *result)
+{
+    static const uint8_t lens[SIM_SENDERS] = { SIM_LEN_A, SIM_LEN_B };
+    const txfmt_rates_t classic_rates = { TXFMT_NOMINAL_BPS,
+                                          TXFMT_NOMINAL_BPS };
+    const double nominal_ns = 1.0e9 / TXFMT_NOMINAL_BPS;
+    datarate_level_t level = (SIM_ADAPTIVE == strategy) ?
+                             DATARATE_LEVEL_FULL : (datarate_level_t)strategy;
+    datarate_level_t pending = level;
+    double switch_ns = -1.0;
+    double now_ns = 0.0;
+    double bytes = 0.0;
+    uint32_t tec[SIM_SENDERS] = { 0U };
+    double off_until_ns[SIM_SENDERS] = { 0.0 };
+    uint32_t sender = 0U;
+
+    memset(result, 0, sizeof(*result));
+    datarate_init(0U);
+
+    while (now_ns < ((double)SIM_DURATION_MS * 1.0e6))
+    {
+        uint32_t now_ms = (uint32_t)(now_ns / 1.0e6);
+        const double *ber = sim_degraded(scenario, now_ms) ?
+                            scenario->ber_degraded : sim_clean_ber;
+        txfmt_rates_t rates;
+        txfmt_format_t format = sim_rates(level, &rates);
+        uint8_t len;
+        double frame_ns;
+        double data_ns;
+        double fail;
+
+        /* The switch commanded earlier takes effect */
+        if ((switch_ns >= 0.0) && (now_ns >= switch_ns))
+        {
+            level = pending;
+            switch_ns = -1.0;
+            continue;
+        }
+
+        /* Next sender that is not in bus-off; an idle bit if none is */
+        if (now_ns < off_until_ns[sender])
+        {
+            sender = (sender + 1U) % SIM_SENDERS;
+            if (now_ns < off_until_ns[sender])
+            {
+                now_ns += nominal_ns;
+                continue;
+            }
+        }
+        len = lens[sender];
+
+        frame_ns = (double)txfmt_frame_ns(&rates, format, len, false);
+        data_ns = (double)sim_data_bits(len) * 1.0e9 /
+                  (double)(datarate_brs(level) ? rates.data_bps :
+                                                 rates.nominal_bps);
+        fail = 1.0 - exp((double)sim_data_bits(len) * log1p(-ber[level]));
+
+        if (sim_random() < fail)
+        {
+            /* The error hits somewhere in the data phase */
+            now_ns += (frame_ns - data_ns) + (sim_random() * data_ns) +
+                      ((double)SIM_ERROR_FRAME_BITS * nominal_ns);
+            result->failed++;
+            tec[sender] += 8U;
+            if (tec[sender] >= SIM_BUS_OFF_TEC)
+            {
+                tec[sender] = 0U;
+                off_until_ns[sender] = now_ns +
+                                       ((double)SIM_BUS_OFF_BITS * nominal_ns);
+                result->bus_off++;
+            }
+            if (switch_ns < 0.0)
+            {
+                datarate_count(0U, 1U);
+            }
+        }
+        else
+        {
+            now_ns += frame_ns;
+            bytes += (double)len;
+            if (tec[sender] > 0U)
+            {
+                tec[sender]--;
+            }
+            if (switch_ns < 0.0)
+            {
+                datarate_count(1U, 0U);
+            }
+            sender = (sender + 1U) % SIM_SENDERS;
+        }
+
+        /* The master decides, and commands the change in a classic frame */
+        if ((SIM_ADAPTIVE == strategy) && (switch_ns < 0.0) &&
+            datarate_poll((uint32_t)(now_ns / 1.0e6), &pending))
+        {
+            now_ns += (double)txfmt_frame_ns(&classic_rates, TXFMT_CLASSIC,
+                                             SIM_COMMAND_LEN, false);
+            switch_ns = now_ns + ((double)DATARATE_SWITCH_MS * 1.0e6);
+        }
+    }
+
+    result->goodput = bytes * 1.0e9 / now_ns;
+    datarate_get_stats(&result->stats, (uint32_t)(now_ns / 1.0e6));
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs each scenario with each fixed setting and with the adaptive one, and
+* prints the payload delivered per second. The adaptive setting must reach
+* 90% of the best fixed one that sends no sender into bus-off.
+*
+*******************************************************************************/
+int main(void)
+{
+    int result = 0;
+
+    printf("Data phase %lu kbit/s, nominal %lu kbit/s, %u s per scenario, "
+           "frames of %u and %u bytes\n",
+           (unsigned long)(TXFMT_DATA_BPS / 1000UL),
+           (unsigned long)(TXFMT_NOMINAL_BPS / 1000UL),
+           (unsigned)(SIM_DURATION_MS / 1000U), (unsigned)SIM_LEN_A,
+           (unsigned)SIM_LEN_B);
+    printf("  %-21s", "goodput (kB/s)");
+    for (uint32_t level = 0U; level < (uint32_t)DATARATE_LEVEL_COUNT; level++)
+    {
+        printf(" %8s", datarate_name((datarate_level_t)level));
+    }
+    printf(" %8s %7s %6s %6s  %-14s  %-19s %s\n", "adaptive", "of best",
+           "down", "probes", "time per level", "bus-off per column", "");
+
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(sim_scenarios) / sizeof(sim_scenarios[0]));
+         idx++)
+    {
+        const sim_scenario_t *scenario = &sim_scenarios[idx];
+        sim_result_t results[SIM_STRATEGIES];
+        const sim_result_t *adaptive = &results[SIM_ADAPTIVE];
+        double best = 0.0;
+        double share[DATARATE_LEVEL_COUNT];
+        double total_ms = 0.0;
+        bool ok;
+
+        printf("  %-21s", scenario->name);
+        for (uint32_t strategy = 0U; strategy < SIM_STRATEGIES; strategy++)
+        {
+            sim_run(scenario, strategy, &results[strategy]);
+            printf(" %8.1f", results[strategy].goodput / 1000.0);
+            if ((strategy < SIM_ADAPTIVE) && (0U == results[strategy].bus_off) &&
+                (results[strategy].goodput > best))
+            {
+                best = results[strategy].goodput;
+            }
+        }
+
+        for (uint32_t level = 0U; level < (uint32_t)DATARATE_LEVEL_COUNT;
+             level++)
+        {
+            total_ms += (double)adaptive->stats.level_ms[level];
+        }
+        for (uint32_t level = 0U; level < (uint32_t)DATARATE_LEVEL_COUNT;
+             level++)
+        {
+            share[level] = 100.0 * (double)adaptive->stats.level_ms[level] /
+                           total_ms;
+        }
+
+        ok = (adaptive->goodput >= (0.9 * best));
+        printf(" %6.1f%% %6lu %3lu/%-2lu  %3.0f%% %3.0f%% %3.0f%%  %4lu %4lu %4lu"
+               " %4lu  %s\n", 100.0 * adaptive->goodput / best,
+               (unsigned long)adaptive->stats.steps_down,
+               (unsigned long)adaptive->stats.probes,
+               (unsigned long)adaptive->stats.probes_failed, share[0],
+               share[1], share[2], (unsigned long)results[0].bus_off,
+               (unsigned long)results[1].bus_off,
+               (unsigned long)results[2].bus_off,
+               (unsigned long)adaptive->bus_off, ok ? "ok" : "FAIL");
+        if (!ok)
+        {
+            result = 1;
+        }
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
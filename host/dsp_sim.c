@@ -0,0 +1,452 @@
+/******************************************************************************
+* File Name:   dsp_sim.c
+*
+* Description: This file contains the host check of the SIMD kernels against
+*              their references, bit for bit, and the frequency response of
+*              the demo filter chain.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "dsp.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Random blocks per configuration of the bit-exact check */
+#define SIM_BLOCKS              (20000U)
+
+/* Demo chain of dsp_can.h, which needs the PDL */
+#define SIM_SAMPLE_HZ           (8000.0)
+#define SIM_DECIMATION          (4U)
+#define SIM_GAIN                (0x6000)
+#define SIM_SHIFT               (1U)
+
+/* Tone amplitude, and samples before the output amplitude is measured */
+#define SIM_AMPLITUDE           (8000.0)
+#define SIM_SETTLE              (16000U)
+#define SIM_MEASURE             (16000U)
+
+#define SIM_PI                  (3.14159265358979323846)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    const int16_t *coeffs;
+    uint32_t taps;
+    uint32_t decimation;
+} sim_fir_case_t;
+
+typedef struct
+{
+    const char *name;
+    const dsp_biquad_coeffs_t *coeffs;
+    uint32_t stages;
+} sim_biquad_case_t;
+
+typedef struct
+{
+    int16_t gain;
+    uint32_t shift;
+    int16_t offset;
+} sim_scale_case_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* DSP_CAN_FIR_COEFFS and DSP_CAN_BIQUAD_COEFFS of dsp_can.h */
+static const int16_t sim_fir_demo[24] =
+{
+    -36, -17, 28, 139, 358, 707, 1185, 1760, 2368, 2930, 3363, 3599,
+    3599, 3363, 2930, 2368, 1760, 1185, 707, 358, 139, 28, -17, -36
+};
+
+/* Saturates on most inputs */
+static const int16_t sim_fir_loud[7] =
+{
+    32767, -32768, 32767, 32767, -32768, 32767, 32767
+};
+
+static const int16_t sim_fir_long[32] =
+{
+    100, -200, 300, -400, 500, -600, 700, -800, 900, -1000, 1100, -1200,
+    1300, -1400, 1500, -1600, 1600, -1500, 1400, -1300, 1200, -1100, 1000,
+    -900, 800, -700, 600, -500, 400, -300, 200, -100
+};
+
+static const dsp_biquad_coeffs_t sim_biquad_demo[2] =
+{
+    { 312, 624, 312, 24243, -9107 },
+    { 359, 717, 359, 27869, -12919 }
+};
+
+/* Resonant, with full-scale coefficients, to reach saturation */
+static const dsp_biquad_coeffs_t sim_biquad_loud[4] =
+{
+    { 32767, -32768, 32767, 32000, -16000 },
+    { 16384, 0, -16384, 30000, -15800 },
+    { -32768, 32767, -32768, -32768, 32767 },
+    { 1, 2, 1, 0, 0 }
+};
+
+static const sim_fir_case_t sim_fir_cases[] =
+{
+    { "fir 24 taps",            sim_fir_demo, 24U, 1U },
+    { "fir 24 taps, decim 4",   sim_fir_demo, 24U, 4U },
+    { "fir 7 taps, decim 3",    sim_fir_loud, 7U,  3U },
+    { "fir 32 taps, decim 5",   sim_fir_long, 32U, 5U },
+    { "fir 1 tap",              sim_fir_loud, 1U,  1U },
+};
+
+static const sim_biquad_case_t sim_biquad_cases[] =
+{
+    { "biquad 2 stages",        sim_biquad_demo, 2U },
+    { "biquad 4 stages, loud",  sim_biquad_loud, 4U },
+};
+
+static const sim_scale_case_t sim_scale_cases[] =
+{
+    { 0x6000, 1U, 0 },
+    { 0x7FFF, 0U, 0 },
+    { -32768, 0U, -100 },
+    { -32768, 15U, 12345 },
+    { 0x4000, 4U, -32768 },
+};
+
+static uint64_t sim_rng = 0x9E3779B97F4A7C15ULL;
+
+/*******************************************************************************
+* Function Name: sim_random
+********************************************************************************
+* Summary:
+* Returns a random 32-bit number (xorshift64*).
+*
+*******************************************************************************/
+static uint32_t sim_random(void)
+{
+    sim_rng ^= sim_rng >> 12;
+    sim_rng ^= sim_rng << 25;
+    sim_rng ^= sim_rng >> 27;
+    return (uint32_t)((sim_rng * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+/*******************************************************************************
+* Function Name: sim_block
+********************************************************************************
+* Summary:
+* Fills a block of random length with random samples, a quarter of them at
+* full scale.
+*
+*******************************************************************************/
+static uint32_t sim_block(int16_t *samples)
+{
+    uint32_t count = 1U + (sim_random() % DSP_BLOCK_MAX);
+
+    for (uint32_t idx = 0U; idx < count; idx++)
+    {
+        uint32_t value = sim_random();
+
+        switch (value & 7U)
+        {
+            case 0U:
+                samples[idx] = INT16_MAX;
+                break;
+            case 1U:
+                samples[idx] = INT16_MIN;
+                break;
+            default:
+                samples[idx] = (int16_t)(value >> 16);
+                break;
+        }
+    }
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: sim_report
+********************************************************************************
+* Summary:
+* Prints the result of one bit-exact check.
+*
+*******************************************************************************/
+static bool sim_report(const char *name, uint32_t samples, uint32_t diffs)
+{
+    printf("  %-26s %9lu %9lu  %s\n", name, (unsigned long)samples,
+           (unsigned long)diffs, (0U == diffs) ? "ok" : "FAIL");
+    return (0U == diffs);
+}
+
+/*******************************************************************************
+* Function Name: sim_check_fir
+********************************************************************************
+* Summary:
+* Runs random blocks through dsp_fir_q15() and dsp_fir_q15_ref() with their
+* own histories and counts the outputs that differ.
+*
+*******************************************************************************/
+static bool sim_check_fir(const sim_fir_case_t *test)
+{
+    static dsp_fir_t fast;
+    static dsp_fir_t ref;
+    uint32_t outputs = 0U;
+    uint32_t diffs = 0U;
+
+    (void)dsp_fir_init(&fast, test->coeffs, test->taps, test->decimation);
+    (void)dsp_fir_init(&ref, test->coeffs, test->taps, test->decimation);
+
+    for (uint32_t block = 0U; block < SIM_BLOCKS; block++)
+    {
+        int16_t in[DSP_BLOCK_MAX];
+        int16_t out_fast[DSP_BLOCK_MAX];
+        int16_t out_ref[DSP_BLOCK_MAX];
+        uint32_t count = sim_block(in);
+        uint32_t written = dsp_fir_q15(&fast, in, out_fast, count);
+
+        if (written != dsp_fir_q15_ref(&ref, in, out_ref, count))
+        {
+            diffs++;
+            continue;
+        }
+        for (uint32_t idx = 0U; idx < written; idx++)
+        {
+            diffs += (out_fast[idx] != out_ref[idx]) ? 1U : 0U;
+        }
+        outputs += written;
+    }
+    return sim_report(test->name, outputs, diffs);
+}
+
+/*******************************************************************************
+* Function Name: sim_check_biquad
+********************************************************************************
+* Summary:
+* Runs random blocks through dsp_biquad_q15(), in place, and
+* dsp_biquad_q15_ref() and counts the outputs that differ.
+*
+*******************************************************************************/
+static bool sim_check_biquad(const sim_biquad_case_t *test)
+{
+    static dsp_biquad_t fast;
+    static dsp_biquad_t ref;
+    uint32_t outputs = 0U;
+    uint32_t diffs = 0U;
+
+    (void)dsp_biquad_init(&fast, test->coeffs, test->stages);
+    (void)dsp_biquad_init(&ref, test->coeffs, test->stages);
+
+    for (uint32_t block = 0U; block < SIM_BLOCKS; block++)
+    {
+        int16_t in[DSP_BLOCK_MAX];
+        int16_t out_ref[DSP_BLOCK_MAX];
+        uint32_t count = sim_block(in);
+
+        dsp_biquad_q15_ref(&ref, in, out_ref, count);
+        dsp_biquad_q15(&fast, in, in, count);
+        for (uint32_t idx = 0U; idx < count; idx++)
+        {
+            diffs += (in[idx] != out_ref[idx]) ? 1U : 0U;
+        }
+        outputs += count;
+    }
+    return sim_report(test->name, outputs, diffs);
+}
+
+/*******************************************************************************
+* Function Name: sim_check_scale
+********************************************************************************
+* Summary:
+* Runs random blocks, of odd and even lengths, through dsp_scale_q15() and
+* dsp_scale_q15_ref() and counts the outputs that differ.
+*
+*******************************************************************************/
+static bool sim_check_scale(const sim_scale_case_t *test)
+{
+    char name[40];
+    uint32_t outputs = 0U;
+    uint32_t diffs = 0U;
+
+    for (uint32_t block = 0U; block < SIM_BLOCKS; block++)
+    {
+        int16_t in[DSP_BLOCK_MAX];
+        int16_t out_fast[DSP_BLOCK_MAX];
+        int16_t out_ref[DSP_BLOCK_MAX];
+        uint32_t count = sim_block(in);
+
+        dsp_scale_q15(in, out_fast, count, test->gain, test->shift,
+                      test->offset);
+        dsp_scale_q15_ref(in, out_ref, count, test->gain, test->shift,
+                          test->offset);
+        for (uint32_t idx = 0U; idx < count; idx++)
+        {
+            diffs += (out_fast[idx] != out_ref[idx]) ? 1U : 0U;
+        }
+        outputs += count;
+    }
+    (void)snprintf(name, sizeof(name), "scale %d << %u, %+d",
+                   (int)test->gain, (unsigned)test->shift, (int)test->offset);
+    return sim_report(name, outputs, diffs);
+}
+
+/*******************************************************************************
+* Function Name: sim_response
+********************************************************************************
+* Summary:
+* Runs a tone through the demo chain of dsp_can.c in frames of 31 samples
+* and returns the gain in dB of the settled output.
+*
+*******************************************************************************/
+static double sim_response(double hz)
+{
+    static dsp_fir_t fir;
+    static dsp_biquad_t biquad;
+    double peak = 0.0;
+    uint32_t n = 0U;
+    uint32_t outputs = 0U;
+
+    (void)dsp_fir_init(&fir, sim_fir_demo, 24U, SIM_DECIMATION);
+    (void)dsp_biquad_init(&biquad, sim_biquad_demo, 2U);
+
+    while (n < (SIM_SETTLE + SIM_MEASURE))
+    {
+        int16_t samples[DSP_BLOCK_MAX];
+        uint32_t count;
+
+        for (uint32_t idx = 0U; idx < 31U; idx++)
+        {
+            samples[idx] = (int16_t)lround(SIM_AMPLITUDE *
+                                           sin(2.0 * SIM_PI * hz * (double)n /
+                                               SIM_SAMPLE_HZ));
+            n++;
+        }
+        count = dsp_fir_q15(&fir, samples, samples, 31U);
+        dsp_biquad_q15(&biquad, samples, samples, count);
+        dsp_scale_q15(samples, samples, count, SIM_GAIN, SIM_SHIFT, 0);
+        for (uint32_t idx = 0U; idx < count; idx++)
+        {
+            outputs++;
+            if ((outputs * SIM_DECIMATION) > SIM_SETTLE)
+            {
+                peak = fmax(peak, fabs((double)samples[idx]));
+            }
+        }
+    }
+
+    /* Quantization leaves about one LSB where the tone is gone */
+    return 20.0 * log10(fmax(peak, 0.5) / SIM_AMPLITUDE);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Checks that each SIMD kernel, built here on C versions of the DSP
+* instructions, gives the results of its reference bit for bit, then prints
+* the frequency response of the demo chain. Fails on any difference, or if
+* the chain does not pass 50 Hz at its gain of 1.5 (3.5 dB) within 0.5 dB
+* or does not remove 1.5 kHz by 40 dB.
+*
+*******************************************************************************/
+int main(void)
+{
+    static const double freqs[] =
+    {
+        10.0, 50.0, 100.0, 200.0, 400.0, 800.0, 1500.0, 3000.0
+    };
+    int result = 0;
+
+    printf("Bit-exact check, %u random blocks of 1 to %u samples per case "
+           "(%s kernels)\n", (unsigned)SIM_BLOCKS, (unsigned)DSP_BLOCK_MAX,
+           (DSP_SIMD) ? "SIMD" : "C emulation of SIMD");
+    printf("  %-26s %9s %9s\n", "case", "outputs", "differ");
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(sim_fir_cases) / sizeof(sim_fir_cases[0]));
+         idx++)
+    {
+        result |= sim_check_fir(&sim_fir_cases[idx]) ? 0 : 1;
+    }
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(sim_biquad_cases) /
+                          sizeof(sim_biquad_cases[0]));
+         idx++)
+    {
+        result |= sim_check_biquad(&sim_biquad_cases[idx]) ? 0 : 1;
+    }
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(sim_scale_cases) / sizeof(sim_scale_cases[0]));
+         idx++)
+    {
+        result |= sim_check_scale(&sim_scale_cases[idx]) ? 0 : 1;
+    }
+
+    printf("Demo chain at %.0f Hz: FIR 24 taps, decimation %u, biquad 2 "
+           "stages, gain 1.5\n", SIM_SAMPLE_HZ, (unsigned)SIM_DECIMATION);
+    printf("  %8s %8s\n", "Hz", "dB");
+    for (uint32_t idx = 0U; idx < (uint32_t)(sizeof(freqs) / sizeof(freqs[0]));
+         idx++)
+    {
+        double gain = sim_response(freqs[idx]);
+        bool ok = true;
+
+        if (50.0 == freqs[idx])
+        {
+            ok = (fabs(gain - 3.52) <= 0.5);
+        }
+        else if (1500.0 == freqs[idx])
+        {
+            ok = (gain <= -40.0);
+        }
+        else
+        {
+            /* Not checked */
+        }
+        printf("  %8.0f %8.1f%s\n", freqs[idx], gain, ok ? "" : "  FAIL");
+        result |= ok ? 0 : 1;
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,373 @@
+/******************************************************************************
+* File Name:   flog_bench.c
+*
+* Description: This file contains the host benchmark of the frame logger,
+*              which measures write amplification, wear levelling and seek
+*              cost and checks recovery after power cuts.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "flog.h"
+#include "flog_file.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define BENCH_IMAGE             "flog_bench.img"
+
+/* 2 MiB flash for throughput and seek, filled about four times over */
+#define BENCH_SECTORS           (32U)
+#define BENCH_FRAMES            (200000U)
+#define BENCH_SEEKS             (1000U)
+
+/* Power loss trials on a 256 KiB flash, cut after up to three rounds */
+#define BENCH_CUT_SECTORS       (4U)
+#define BENCH_CUT_TRIALS        (200U)
+#define BENCH_CUT_OPS_MAX       (3U * BENCH_CUT_SECTORS * FLOG_PAGES_PER_SECTOR)
+
+/* Typical SPI NOR timings (256 byte page, 64 KiB block), for the device
+ * estimate */
+#define BENCH_T_PROGRAM_US      (700.0)
+#define BENCH_T_ERASE_US        (150000.0)
+#define BENCH_SPI_HZ            (25e6)
+
+/* Same flags as canfd_frame.h */
+#define BENCH_FLAG_FDF          (0x02U)
+#define BENCH_FLAG_BRS          (0x04U)
+
+/*******************************************************************************
+* Function Name: bench_frame
+********************************************************************************
+* Summary:
+* Builds frame number index of the synthetic traffic: classic and FD frames
+* at about 3000 frames per second, a saturated 500 kbit/s / 2 Mbit/s bus.
+* The payload starts with the frame number so that reads can be verified.
+*
+*******************************************************************************/
+static void bench_frame(uint32_t index, flog_record_t *frame)
+{
+    static const uint8_t lengths[] = { 8U, 64U, 8U, 16U, 64U };
+
+    frame->ts = (index / 3U);
+    frame->id = 0x100U + ((index % 7U) * 0x10U);
+    frame->len = lengths[index % (sizeof(lengths) / sizeof(lengths[0]))];
+    frame->flags = (frame->len > 8U) ? (BENCH_FLAG_FDF | BENCH_FLAG_BRS) : 0U;
+    memcpy(frame->data, &index, sizeof(index));
+    for (uint32_t idx = sizeof(index); idx < frame->len; idx++)
+    {
+        frame->data[idx] = (uint8_t)((index * 31U) + idx);
+    }
+}
+
+/*******************************************************************************
+* Function Name: bench_check
+********************************************************************************
+* Summary:
+* Checks a record read back against the frame it claims to be.
+*
+*******************************************************************************/
+static bool bench_check(const flog_record_t *record, uint32_t *index)
+{
+    flog_record_t frame;
+
+    memcpy(index, record->data, sizeof(*index));
+    bench_frame(*index, &frame);
+    return (record->id == frame.id) && (record->len == frame.len) &&
+           (record->flags == frame.flags) &&
+           (0 == memcmp(record->data, frame.data, frame.len));
+}
+
+/*******************************************************************************
+* Function Name: bench_append
+*******************************************************************************/
+static bool bench_append(uint32_t index, uint32_t time_offset)
+{
+    flog_record_t frame;
+
+    bench_frame(index, &frame);
+    return flog_append(frame.ts - time_offset, frame.id, frame.flags,
+                       frame.data, frame.len);
+}
+
+/*******************************************************************************
+* Function Name: bench_throughput
+********************************************************************************
+* Summary:
+* Records BENCH_FRAMES frames and reports host throughput, write
+* amplification, wear levelling and the time the flash would be busy on
+* the device.
+*
+*******************************************************************************/
+static int bench_throughput(const char *path)
+{
+    flog_flash_t flash;
+    flog_stats_t stats;
+    flog_file_stats_t ops;
+    clock_t start;
+    double host_s;
+    double device_s;
+    double bus_s = (double)(BENCH_FRAMES / 3U) / 1000.0;
+
+    if (!flog_file_open(path, BENCH_SECTORS, true, &flash) ||
+        !flog_mount(&flash))
+    {
+        return 1;
+    }
+
+    start = clock();
+    for (uint32_t index = 0U; index < BENCH_FRAMES; index++)
+    {
+        (void)bench_append(index, 0U);
+        flog_poll(index / 3U);
+    }
+    (void)flog_flush();
+    host_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    flog_get_stats(&stats);
+    flog_file_get_stats(&ops);
+
+    /* Program and erase times plus the SPI transfer of each page */
+    device_s = ((ops.programs * BENCH_T_PROGRAM_US) +
+                (ops.erases * BENCH_T_ERASE_US)) / 1e6 +
+               ((double)stats.program_bytes * 8.0 / BENCH_SPI_HZ);
+
+    printf("throughput: %u frames, %.1f s of bus traffic\n",
+           (unsigned)BENCH_FRAMES, bus_s);
+    printf("  host            %.0f frames/s, %.1f MB/s of records\n",
+           BENCH_FRAMES / host_s, (double)stats.record_bytes / host_s / 1e6);
+    printf("  write amp.      %.3f (%llu bytes programmed for %llu bytes of "
+           "records)\n", (double)stats.program_bytes / stats.record_bytes,
+           (unsigned long long)stats.program_bytes,
+           (unsigned long long)stats.record_bytes);
+    printf("  erases          %u, per sector %u to %u\n",
+           (unsigned)ops.erases, (unsigned)ops.erase_min,
+           (unsigned)ops.erase_max);
+    printf("  device estimate flash busy %.1f%% of the time (%.0f frames/s "
+           "sustainable)\n", 100.0 * device_s / bus_s,
+           BENCH_FRAMES / device_s);
+    printf("  dropped         %u\n", (unsigned)stats.dropped);
+    return (0U == stats.dropped) ? 0 : 1;
+}
+
+/*******************************************************************************
+* Function Name: bench_seek
+********************************************************************************
+* Summary:
+* Seeks to random times of the log written by bench_throughput() and checks
+* that each seek lands on the first record at or after the time.
+*
+*******************************************************************************/
+static int bench_seek(const char *path)
+{
+    flog_flash_t flash;
+    flog_file_stats_t before;
+    flog_file_stats_t after;
+    flog_cursor_t cursor;
+    flog_record_t record;
+    uint32_t first_ts;
+    uint32_t last_ts = (BENCH_FRAMES - 1U) / 3U;
+    uint32_t failures = 0U;
+
+    if (!flog_file_open(path, BENCH_SECTORS, false, &flash) ||
+        !flog_mount(&flash) || !flog_seek(0U, &cursor) ||
+        !flog_next(&cursor, &record))
+    {
+        return 1;
+    }
+    first_ts = record.ts;
+
+    flog_file_get_stats(&before);
+    for (uint32_t trial = 0U; trial < BENCH_SEEKS; trial++)
+    {
+        uint32_t ts = first_ts + (uint32_t)rand() % (last_ts - first_ts);
+        uint32_t index;
+
+        if (!flog_seek(ts, &cursor) || !flog_next(&cursor, &record) ||
+            !bench_check(&record, &index) || (record.ts < ts) ||
+            ((index > 0U) && ((index - 1U) / 3U >= ts) &&
+             (record.ts != first_ts)))
+        {
+            failures++;
+        }
+    }
+    flog_file_get_stats(&after);
+
+    printf("seek: %u seeks over %u s, %u failed, %.1f reads and %.0f bytes "
+           "per seek\n", (unsigned)BENCH_SEEKS,
+           (unsigned)((last_ts - first_ts) / 1000U), (unsigned)failures,
+           (double)(after.reads - before.reads) / BENCH_SEEKS,
+           (double)(after.read_bytes - before.read_bytes) / BENCH_SEEKS);
+    return (0U == failures) ? 0 : 1;
+}
+
+/*******************************************************************************
+* Function Name: bench_read_all
+********************************************************************************
+* Summary:
+* Reads the whole log and checks that it holds intact frames in order.
+*
+* Return:
+*  Number of records, or -1 if the log is damaged
+*
+*******************************************************************************/
+static long bench_read_all(uint32_t *last_index)
+{
+    flog_cursor_t cursor;
+    flog_record_t record;
+    long count = 0;
+    uint32_t last_ts = 0U;
+
+    if (!flog_seek(0U, &cursor))
+    {
+        return 0;
+    }
+    while (flog_next(&cursor, &record))
+    {
+        uint32_t index;
+
+        if (!bench_check(&record, &index) ||
+            ((count > 0) && (index <= *last_index)) || (record.ts < last_ts))
+        {
+            return -1;
+        }
+        *last_index = index;
+        last_ts = record.ts;
+        count++;
+    }
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: bench_power_loss
+********************************************************************************
+* Summary:
+* Cuts power at random program or erase operations while recording, then
+* mounts the log again and checks that it is intact, how many of the last
+* frames were lost, and that recording continues after the last frame kept.
+*
+*******************************************************************************/
+static int bench_power_loss(const char *path)
+{
+    uint32_t failures = 0U;
+    uint32_t lost_max = 0U;
+    uint64_t lost_sum = 0U;
+    uint32_t torn = 0U;
+
+    for (uint32_t trial = 0U; trial < BENCH_CUT_TRIALS; trial++)
+    {
+        flog_flash_t flash;
+        flog_stats_t stats;
+        uint32_t index = 0U;
+        uint32_t last_index = 0U;
+
+        if (!flog_file_open(path, BENCH_CUT_SECTORS, true, &flash) ||
+            !flog_mount(&flash))
+        {
+            return 1;
+        }
+
+        /* Record until power fails */
+        flog_file_cut_after(1U + ((uint32_t)rand() % BENCH_CUT_OPS_MAX));
+        while (bench_append(index, 0U))
+        {
+            flog_poll(index / 3U);
+            index++;
+        }
+
+        flog_file_power_on();
+        if (!flog_mount(&flash) || (bench_read_all(&last_index) <= 0))
+        {
+            failures++;
+            continue;
+        }
+        flog_get_stats(&stats);
+        torn += stats.torn_pages;
+        lost_sum += index - last_index;
+        lost_max = ((index - last_index) > lost_max) ?
+                   (index - last_index) : lost_max;
+
+        /* Recording continues, in time order, after the restart */
+        for (index = last_index + 1U; index < (last_index + 1000U); index++)
+        {
+            (void)bench_append(index, (last_index + 1U) / 3U);
+        }
+        (void)flog_flush();
+        if (!flog_mount(&flash) || (bench_read_all(&last_index) <= 0) ||
+            (last_index != (index - 1U)))
+        {
+            failures++;
+        }
+    }
+
+    printf("power loss: %u trials, %u failed, %u torn pages found, last "
+           "frames lost per cut %.1f average, %u max\n",
+           (unsigned)BENCH_CUT_TRIALS, (unsigned)failures, (unsigned)torn,
+           (double)lost_sum / BENCH_CUT_TRIALS, (unsigned)lost_max);
+    return (0U == failures) ? 0 : 1;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs the logger benchmarks against a file. Exits with status 1 if a
+* check failed.
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    const char *path = (argc > 1) ? argv[1] : BENCH_IMAGE;
+    int result = 0;
+
+    srand(1U);
+    result |= bench_throughput(path);
+    result |= bench_seek(path);
+    result |= bench_power_loss(path);
+    flog_file_close();
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,257 @@
+/******************************************************************************
+* File Name:   flog_file.c
+*
+* Description: This file contains a file-backed NOR flash emulation with
+*              power-cut injection, used to run the frame logger on a host.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "flog_file.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static FILE     *flog_file;
+static uint32_t  flog_file_sectors;
+static uint32_t *flog_file_erase_count;
+static flog_file_stats_t flog_file_stats;
+
+/* Power failure injection: operations left before the cut, 0 = none */
+static uint32_t  flog_file_ops_left;
+static bool      flog_file_off;
+
+/*******************************************************************************
+* Function Name: flog_file_power_cut
+********************************************************************************
+* Summary:
+* Counts a program or erase operation. Returns true if power fails during
+* this one; the operation is then done halfway and all later ones fail.
+*
+*******************************************************************************/
+static bool flog_file_power_cut(void)
+{
+    if (0U == flog_file_ops_left)
+    {
+        return false;
+    }
+    flog_file_ops_left--;
+    if (0U == flog_file_ops_left)
+    {
+        flog_file_off = true;
+        return true;
+    }
+    return false;
+}
+
+/*******************************************************************************
+* Flash operations
+*******************************************************************************/
+static bool flog_file_read(uint32_t addr, void *buf, uint32_t len)
+{
+    if (flog_file_off || (0 != fseek(flog_file, (long)addr, SEEK_SET)) ||
+        (len != fread(buf, 1U, len, flog_file)))
+    {
+        return false;
+    }
+    flog_file_stats.reads++;
+    flog_file_stats.read_bytes += len;
+    return true;
+}
+
+static bool flog_file_program(uint32_t addr, const void *buf, uint32_t len)
+{
+    uint8_t cells[FLOG_PAGE_SIZE];
+    const uint8_t *src = (const uint8_t *)buf;
+    bool cut;
+
+    if (flog_file_off || (len > FLOG_PAGE_SIZE) ||
+        (((addr % FLOG_PAGE_SIZE) + len) > FLOG_PAGE_SIZE) ||
+        !flog_file_read(addr, cells, len))
+    {
+        return false;
+    }
+
+    /* NOR flash: programming only clears bits. A cut programs half. */
+    cut = flog_file_power_cut();
+    for (uint32_t idx = 0U; idx < (cut ? (len / 2U) : len); idx++)
+    {
+        cells[idx] &= src[idx];
+    }
+
+    if ((0 != fseek(flog_file, (long)addr, SEEK_SET)) ||
+        (len != fwrite(cells, 1U, len, flog_file)))
+    {
+        return false;
+    }
+    flog_file_stats.programs++;
+    return !cut;
+}
+
+static bool flog_file_erase(uint32_t addr)
+{
+    static uint8_t cells[FLOG_SECTOR_SIZE];
+    uint32_t sector = addr / FLOG_SECTOR_SIZE;
+    bool cut;
+
+    if (flog_file_off || (sector >= flog_file_sectors))
+    {
+        return false;
+    }
+
+    /* A cut leaves the second half of the sector unerased */
+    cut = flog_file_power_cut();
+    memset(cells, 0xFF, sizeof(cells));
+    if ((0 != fseek(flog_file, (long)(sector * FLOG_SECTOR_SIZE), SEEK_SET)) ||
+        (fwrite(cells, 1U, cut ? (FLOG_SECTOR_SIZE / 2U) : FLOG_SECTOR_SIZE,
+                flog_file) == 0U))
+    {
+        return false;
+    }
+    flog_file_stats.erases++;
+    flog_file_erase_count[sector]++;
+    return !cut;
+}
+
+/*******************************************************************************
+* Function Name: flog_file_open
+********************************************************************************
+* Summary:
+* Opens a file as the flash of the logger.
+*
+* Parameters:
+*  path         Image file
+*  sectors      Size of the flash in sectors
+*  blank        true to start with an erased flash, false to keep the image
+*  flash        Filled with the flash operations
+*
+*******************************************************************************/
+bool flog_file_open(const char *path, uint32_t sectors, bool blank,
+                    flog_flash_t *flash)
+{
+    static uint8_t erased[FLOG_SECTOR_SIZE];
+
+    flog_file_close();
+    flog_file = fopen(path, blank ? "w+b" : "r+b");
+    flog_file_erase_count = calloc(sectors, sizeof(uint32_t));
+    if ((NULL == flog_file) || (NULL == flog_file_erase_count))
+    {
+        flog_file_close();
+        return false;
+    }
+
+    memset(erased, 0xFF, sizeof(erased));
+    for (uint32_t sector = 0U; blank && (sector < sectors); sector++)
+    {
+        (void)fwrite(erased, 1U, sizeof(erased), flog_file);
+    }
+
+    flog_file_sectors = sectors;
+    memset(&flog_file_stats, 0, sizeof(flog_file_stats));
+    flog_file_power_on();
+
+    flash->read = flog_file_read;
+    flash->program = flog_file_program;
+    flash->erase = flog_file_erase;
+    flash->sectors = sectors;
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: flog_file_close
+*******************************************************************************/
+void flog_file_close(void)
+{
+    if (NULL != flog_file)
+    {
+        (void)fclose(flog_file);
+        flog_file = NULL;
+    }
+    free(flog_file_erase_count);
+    flog_file_erase_count = NULL;
+}
+
+/*******************************************************************************
+* Function Name: flog_file_cut_after
+********************************************************************************
+* Summary:
+* Makes power fail during the given program or erase operation from now.
+*
+*******************************************************************************/
+void flog_file_cut_after(uint32_t ops)
+{
+    flog_file_ops_left = ops;
+}
+
+/*******************************************************************************
+* Function Name: flog_file_power_on
+********************************************************************************
+* Summary:
+* Restores power after a cut.
+*
+*******************************************************************************/
+void flog_file_power_on(void)
+{
+    flog_file_off = false;
+    flog_file_ops_left = 0U;
+}
+
+/*******************************************************************************
+* Function Name: flog_file_get_stats
+*******************************************************************************/
+void flog_file_get_stats(flog_file_stats_t *stats)
+{
+    *stats = flog_file_stats;
+    stats->erase_min = UINT32_MAX;
+    stats->erase_max = 0U;
+    for (uint32_t sector = 0U; sector < flog_file_sectors; sector++)
+    {
+        uint32_t count = flog_file_erase_count[sector];
+        stats->erase_min = (count < stats->erase_min) ? count :
+                           stats->erase_min;
+        stats->erase_max = (count > stats->erase_max) ? count :
+                           stats->erase_max;
+    }
+}
+
+/* [] END OF FILE */
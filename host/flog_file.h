@@ -0,0 +1,86 @@
+/******************************************************************************
+* File Name:   flog_file.h
+*
+* Description: This file contains the interface of the file-backed flash used
+*              to run the frame logger on a host.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef FLOG_FILE_H_
+#define FLOG_FILE_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "flog.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Flash operations since flog_file_open() */
+typedef struct
+{
+    uint64_t read_bytes;
+    uint32_t reads;
+    uint32_t programs;
+    uint32_t erases;
+    uint32_t erase_min;             /* Fewest erases of any sector */
+    uint32_t erase_max;             /* Most erases of any sector */
+} flog_file_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+bool flog_file_open(const char *path, uint32_t sectors, bool blank,
+                    flog_flash_t *flash);
+void flog_file_close(void);
+void flog_file_cut_after(uint32_t ops);
+void flog_file_power_on(void);
+void flog_file_get_stats(flog_file_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* FLOG_FILE_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,387 @@
+/******************************************************************************
+* File Name:   fzip_sim.c
+*
+* Description: This file contains the host round trip of the frame compressor:
+*              the capture it writes is decoded by scripts/fzip_decode.py.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "fzip.h"
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* One frame of the recorded trace, as in bench_fzip.c */
+typedef struct
+{
+    uint32_t id;
+    uint16_t offset;                        /* In fzip_trace_data */
+    uint16_t ts;                            /* Controller timestamp */
+    uint8_t  len;
+    uint8_t  flags;                         /* CANFD_FRAME_FLAG_xxx */
+} bench_fzip_frame_t;
+
+#include "fzip_trace.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Replays of the recorded trace, each followed by the synthetic frames */
+#define SIM_PASSES              (3U)
+#define SIM_TRACE_FRAMES        (sizeof(fzip_trace) / sizeof(fzip_trace[0]))
+#define SIM_EXTRA_FRAMES        (64U)
+#define SIM_FRAMES_MAX                                                         \
+    (SIM_PASSES * (SIM_TRACE_FRAMES + SIM_EXTRA_FRAMES))
+
+/* Block left out of the capture, as if lost on the UART. The decoder must
+ * skip the frames up to the next reset block and then decode again. */
+#define SIM_LOST_BLOCK          (FZIP_RESET_BLOCKS + 3U)
+#define SIM_RESYNC_BLOCK                                                       \
+    (((SIM_LOST_BLOCK / FZIP_RESET_BLOCKS) + 1U) * FZIP_RESET_BLOCKS)
+
+/* Controller timestamp ticks between the synthetic frames, and the default
+ * --tick-us of fzip_decode.py */
+#define SIM_EXTRA_TICKS         (50U)
+#define SIM_TICK_US             (2.0)
+
+/* Synthetic IDs: a 29-bit ID whose format changes, and classic IDs, one
+ * per frame, that take more slots than there are */
+#define SIM_XTD_ID              (0x1ABCDE00UL)
+#define SIM_RTR_ID              (0x123U)
+#define SIM_CLASSIC_ID          (0x700U)
+
+/* Raw UART capture and the candump -L lines its decode must match */
+#define SIM_CAPTURE             "fzip_sim.bin"
+#define SIM_EXPECTED            "fzip_sim.log"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static fzip_encoder_t sim_enc;
+static FILE *sim_capture;
+
+/* Frames in encoding order, and the block each went out in */
+static canfd_frame_t sim_frames[SIM_FRAMES_MAX];
+static uint32_t sim_block_of[SIM_FRAMES_MAX];
+static uint32_t sim_count;
+static uint32_t sim_block_first;
+
+/* Paths of the encoder that came up */
+static uint32_t sim_resets;
+static uint32_t sim_zeros;
+
+/*******************************************************************************
+* Function Name: sim_report
+********************************************************************************
+* Summary:
+* Prints the result of one check.
+*
+*******************************************************************************/
+static bool sim_report(const char *name, bool ok)
+{
+    printf("  %-28s %s\n", name, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: sim_write
+********************************************************************************
+* Summary:
+* Output of the encoder: notes the block of the frames it holds, and writes
+* it to the capture followed by a line of text, as the firmware prints
+* between blocks. The block of SIM_LOST_BLOCK is left out.
+*
+*******************************************************************************/
+static void sim_write(const uint8_t *data, uint32_t len)
+{
+    uint32_t block = sim_enc.stats.blocks;
+
+    for (uint32_t idx = sim_block_first; idx < sim_enc.stats.frames; idx++)
+    {
+        sim_block_of[idx] = block;
+    }
+    sim_block_first = sim_enc.stats.frames;
+
+    if (FZIP_BLOCK_FLAG_RESET == sim_enc.block[2])
+    {
+        sim_resets++;
+    }
+    /* Zero bytes of the block and its CRC, which COBS escapes */
+    for (uint32_t idx = 0U; idx < sim_enc.block_len; idx++)
+    {
+        sim_zeros += (0U == sim_enc.block[idx]) ? 1U : 0U;
+    }
+
+    if (SIM_LOST_BLOCK != block)
+    {
+        (void)fwrite(data, 1U, len, sim_capture);
+    }
+    fprintf(sim_capture, "fzip_sim: block %lu\r\n", (unsigned long)block);
+}
+
+/*******************************************************************************
+* Function Name: sim_encode
+********************************************************************************
+* Summary:
+* Keeps a frame and compresses it.
+*
+*******************************************************************************/
+static void sim_encode(const canfd_frame_t *frame)
+{
+    sim_frames[sim_count++] = *frame;
+    fzip_encode(&sim_enc, frame);
+}
+
+/*******************************************************************************
+* Function Name: sim_replay
+********************************************************************************
+* Summary:
+* Compresses the recorded trace, with its timestamps shifted by start.
+*
+* Return:
+*  Timestamp of the last frame
+*
+*******************************************************************************/
+static uint32_t sim_replay(uint32_t start)
+{
+    canfd_frame_t frame;
+
+    for (uint32_t idx = 0U; idx < SIM_TRACE_FRAMES; idx++)
+    {
+        const bench_fzip_frame_t *entry = &fzip_trace[idx];
+
+        memset(&frame, 0, sizeof(frame));
+        frame.id = entry->id;
+        frame.timestamp = (start + entry->ts) & FZIP_TS_MASK;
+        frame.len = entry->len;
+        frame.flags = entry->flags;
+        memcpy(frame.data, &fzip_trace_data[entry->offset], entry->len);
+        sim_encode(&frame);
+    }
+
+    return frame.timestamp;
+}
+
+/*******************************************************************************
+* Function Name: sim_extra
+********************************************************************************
+* Summary:
+* Compresses frames that the trace lacks: 64-byte payloads with runs of
+* unchanged and changed bytes longer than a nibble, a 29-bit ID whose
+* length changes, remote frames, frames earlier than predicted, and more
+* IDs than there are slots.
+*
+* Return:
+*  Timestamp of the last frame
+*
+*******************************************************************************/
+static uint32_t sim_extra(uint32_t ts)
+{
+    canfd_frame_t frame;
+
+    for (uint32_t idx = 0U; idx < SIM_EXTRA_FRAMES; idx++)
+    {
+        uint32_t skip = (idx * 5U) % 48U;
+
+        ts += SIM_EXTRA_TICKS;
+        memset(&frame, 0, sizeof(frame));
+        frame.timestamp = ts & FZIP_TS_MASK;
+        if (2U == (idx % 3U))
+        {
+            frame.timestamp = (ts - (SIM_EXTRA_TICKS / 2U)) & FZIP_TS_MASK;
+        }
+
+        switch (idx % 4U)
+        {
+            case 0U:
+                frame.id = SIM_XTD_ID;
+                frame.flags = CANFD_FRAME_FLAG_XTD | CANFD_FRAME_FLAG_FDF |
+                              CANFD_FRAME_FLAG_BRS;
+                frame.len = CANFD_MAX_DATA_LEN;
+                for (uint32_t pos = skip; pos < frame.len; pos++)
+                {
+                    frame.data[pos] = (uint8_t)((pos * idx) + 1U);
+                }
+                break;
+
+            case 1U:
+                frame.id = SIM_CLASSIC_ID + idx;
+                frame.len = CANFD_CLASSIC_MAX_DATA_LEN;
+                memset(frame.data, (int)idx, frame.len);
+                break;
+
+            case 2U:
+                frame.id = SIM_RTR_ID;
+                frame.flags = CANFD_FRAME_FLAG_RTR;
+                break;
+
+            default:
+                frame.id = SIM_XTD_ID;
+                frame.flags = CANFD_FRAME_FLAG_XTD | CANFD_FRAME_FLAG_FDF;
+                frame.len = 12U;
+                frame.data[idx % frame.len] = (uint8_t)idx;
+                break;
+        }
+        sim_encode(&frame);
+    }
+
+    return ts;
+}
+
+/*******************************************************************************
+* Function Name: sim_write_expected
+********************************************************************************
+* Summary:
+* Writes the frames the decoder must recover, in the candump -L format of
+* fzip_decode.py: all but those from the lost block up to the next reset
+* block, timed by the ticks between the decoded frames.
+*
+* Return:
+*  Number of frames written
+*
+*******************************************************************************/
+static uint32_t sim_write_expected(FILE *out)
+{
+    uint32_t written = 0U;
+    uint32_t elapsed = 0U;
+    uint32_t prev_ts = 0U;
+
+    for (uint32_t idx = 0U; idx < sim_count; idx++)
+    {
+        const canfd_frame_t *frame = &sim_frames[idx];
+        uint32_t ts = frame->timestamp & FZIP_TS_MASK;
+
+        if ((sim_block_of[idx] >= SIM_LOST_BLOCK) &&
+            (sim_block_of[idx] < SIM_RESYNC_BLOCK))
+        {
+            continue;
+        }
+        if (0U != written)
+        {
+            elapsed += (ts - prev_ts) & FZIP_TS_MASK;
+        }
+        prev_ts = ts;
+        written++;
+
+        fprintf(out, "(%.6f) can0 ", (double)elapsed * SIM_TICK_US / 1e6);
+        fprintf(out, (0U != (frame->flags & CANFD_FRAME_FLAG_XTD)) ?
+                     "%08lX" : "%03lX", (unsigned long)frame->id);
+        if (0U != (frame->flags & CANFD_FRAME_FLAG_RTR))
+        {
+            fprintf(out, "#R\n");
+            continue;
+        }
+        if (0U != (frame->flags & CANFD_FRAME_FLAG_FDF))
+        {
+            fprintf(out, "##%u", (0U != (frame->flags & CANFD_FRAME_FLAG_BRS)) ?
+                                 1U : 0U);
+        }
+        else
+        {
+            fprintf(out, "#");
+        }
+        for (uint32_t pos = 0U; pos < frame->len; pos++)
+        {
+            fprintf(out, "%02X", frame->data[pos]);
+        }
+        fprintf(out, "\n");
+    }
+
+    return written;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Compresses the recorded trace and the synthetic frames into SIM_CAPTURE,
+* and writes the frames its decode must give to SIM_EXPECTED. "make run"
+* then decodes the capture with scripts/fzip_decode.py and compares.
+*
+*******************************************************************************/
+int main(void)
+{
+    FILE *expected;
+    uint32_t ts = 0U;
+    uint32_t decoded;
+    int result = 0;
+
+    sim_capture = fopen(SIM_CAPTURE, "wb");
+    expected = fopen(SIM_EXPECTED, "w");
+    if ((NULL == sim_capture) || (NULL == expected))
+    {
+        printf("cannot create %s and %s\n", SIM_CAPTURE, SIM_EXPECTED);
+        return 1;
+    }
+
+    fzip_init(&sim_enc, sim_write);
+    for (uint32_t pass = 0U; pass < SIM_PASSES; pass++)
+    {
+        ts = sim_replay(ts + SIM_EXTRA_TICKS);
+        ts = sim_extra(ts);
+    }
+    fzip_flush(&sim_enc);
+    fclose(sim_capture);
+
+    decoded = sim_write_expected(expected);
+    fclose(expected);
+
+    printf("Compression round trip, %lu frames in %lu blocks, %lu bytes "
+           "raw, %lu on the wire\n", (unsigned long)sim_count,
+           (unsigned long)sim_enc.stats.blocks,
+           (unsigned long)sim_enc.stats.raw_bytes,
+           (unsigned long)sim_enc.stats.wire_bytes);
+    result |= sim_report("all frames encoded",
+                         sim_enc.stats.frames == sim_count) ? 0 : 1;
+    result |= sim_report("reset blocks", sim_resets >= 3U) ? 0 : 1;
+    result |= sim_report("zero bytes escaped", 0U != sim_zeros) ? 0 : 1;
+    result |= sim_report("lost block, then resync",
+                         (sim_enc.stats.blocks > SIM_RESYNC_BLOCK) &&
+                         (decoded < sim_count)) ? 0 : 1;
+    printf("  %lu frames expected in %s\n", (unsigned long)decoded,
+           SIM_EXPECTED);
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,330 @@
+/******************************************************************************
+* File Name:   mstream_sim.c
+*
+* Description: This file contains the bus simulator of the multicast stream,
+*              which measures the goodput of one sender to 1 to 8 receivers
+*              with frames lost on the way.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "mstream.h"
+#include "txfmt.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Simulated time per run */
+#define SIM_DURATION_MS         (10000U)
+
+/* The sender and up to eight receivers; node 0 is the sender */
+#define SIM_RECEIVERS_MAX       (8U)
+#define SIM_NODES               (SIM_RECEIVERS_MAX + 1U)
+
+/* Message of the stream, as the sensor snapshot. The sender starts the next
+ * one as soon as the previous one is out, so the bus is the limit. */
+#define SIM_MESSAGE_SIZE        (512U)
+
+/* IDs of the stream, as in sensor_stream.h */
+#define SIM_DATA_ID             (0x200U)
+#define SIM_NACK_ID             (0x1F0U)
+
+/* Time a main loop pass takes when no frame is on the bus */
+#define SIM_IDLE_US             (50U)
+
+/* Messages a receiver must get complete, in 1/1000, for the run to pass */
+#define SIM_COMPLETE_PERMILLE   (990U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t goodput_min;           /* Lowest goodput of a receiver, bytes/s */
+    uint32_t complete;              /* Lowest share of complete messages of a
+                                     * receiver, in 1/1000 */
+    uint32_t retransmits;
+    uint32_t nacks;                 /* NACKs the sender received */
+} sim_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Frames lost on the way to each receiving node, in 1/1000 */
+static const uint32_t sim_loss_permille[] = { 0U, 10U, 50U };
+
+static const txfmt_rates_t sim_rates = { TXFMT_NOMINAL_BPS, TXFMT_DATA_BPS };
+
+static mstream_tx_t sim_tx;
+static mstream_rx_t sim_rx[SIM_RECEIVERS_MAX];
+static uint8_t sim_buf[SIM_RECEIVERS_MAX][SIM_MESSAGE_SIZE];
+static uint8_t sim_message[SIM_MESSAGE_SIZE];
+
+/* TX buffer of each node, and the node whose callback runs */
+static canfd_frame_t sim_pending[SIM_NODES];
+static bool sim_pending_full[SIM_NODES];
+static uint32_t sim_node;
+
+static uint64_t sim_rng = 0x9E3779B97F4A7C15ULL;
+
+/*******************************************************************************
+* Function Name: sim_random
+********************************************************************************
+* Summary:
+* Returns a uniform random number below 1000 (xorshift64*).
+*
+*******************************************************************************/
+static uint32_t sim_random(void)
+{
+    sim_rng ^= sim_rng >> 12;
+    sim_rng ^= sim_rng << 25;
+    sim_rng ^= sim_rng >> 27;
+    return (uint32_t)(((sim_rng * 0x2545F4914F6CDD1DULL) >> 32) % 1000U);
+}
+
+/*******************************************************************************
+* Function Name: sim_send
+********************************************************************************
+* Summary:
+* Frame transmit function of every node: puts the frame in the single TX
+* buffer of the node whose poll runs, if it is free.
+*
+*******************************************************************************/
+static bool sim_send(const canfd_frame_t *frame)
+{
+    if (sim_pending_full[sim_node])
+    {
+        return false;
+    }
+    sim_pending[sim_node] = *frame;
+    sim_pending_full[sim_node] = true;
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_on_message
+********************************************************************************
+* Summary:
+* Receives the reassembled messages; the receivers count them themselves.
+*
+*******************************************************************************/
+static void sim_on_message(const uint8_t *data, uint32_t len, bool ok)
+{
+    CY_UNUSED_PARAMETER(data);
+    CY_UNUSED_PARAMETER(len);
+    CY_UNUSED_PARAMETER(ok);
+}
+
+/*******************************************************************************
+* Function Name: sim_arbitrate
+********************************************************************************
+* Summary:
+* Returns the node whose pending frame wins the arbitration, the one with
+* the lowest ID, or SIM_NODES if no node has a frame.
+*
+*******************************************************************************/
+static uint32_t sim_arbitrate(uint32_t nodes)
+{
+    uint32_t winner = SIM_NODES;
+
+    for (uint32_t node = 0U; node < nodes; node++)
+    {
+        if (sim_pending_full[node] &&
+            ((SIM_NODES == winner) ||
+             (sim_pending[node].id < sim_pending[winner].id)))
+        {
+            winner = node;
+        }
+    }
+    return winner;
+}
+
+/*******************************************************************************
+* Function Name: sim_run
+********************************************************************************
+* Summary:
+* Streams messages from one sender to the receivers for SIM_DURATION_MS.
+* Each node runs its poll functions once per main loop pass and has one TX
+* buffer. Each frame on the bus is lost for each other node on its own with
+* the given probability, data frames and NACKs alike.
+*
+*******************************************************************************/
+static void sim_run(uint32_t receivers, uint32_t loss, sim_result_t *result)
+{
+    uint32_t nodes = receivers + 1U;
+    uint64_t now_us = 0U;
+
+    memset(sim_pending_full, 0, sizeof(sim_pending_full));
+    mstream_tx_init(&sim_tx, SIM_DATA_ID, sim_send, 0U);
+    for (uint32_t idx = 0U; idx < receivers; idx++)
+    {
+        mstream_rx_init(&sim_rx[idx], SIM_DATA_ID, (uint8_t)(idx + 1U),
+                        SIM_NACK_ID + idx + 1U, sim_send, sim_buf[idx],
+                        SIM_MESSAGE_SIZE, sim_on_message);
+    }
+
+    while (now_us < ((uint64_t)SIM_DURATION_MS * 1000U))
+    {
+        uint32_t now_ms = (uint32_t)(now_us / 1000U);
+        uint32_t winner;
+
+        sim_node = 0U;
+        if (!mstream_tx_busy(&sim_tx))
+        {
+            (void)mstream_tx_write(&sim_tx, sim_message, SIM_MESSAGE_SIZE);
+        }
+        mstream_tx_poll(&sim_tx, now_ms);
+        for (uint32_t idx = 0U; idx < receivers; idx++)
+        {
+            sim_node = idx + 1U;
+            mstream_rx_poll(&sim_rx[idx], now_ms);
+        }
+
+        winner = sim_arbitrate(nodes);
+        if (SIM_NODES == winner)
+        {
+            now_us += SIM_IDLE_US;
+            continue;
+        }
+
+        now_us += txfmt_frame_ns(&sim_rates, TXFMT_FD_BRS,
+                                 sim_pending[winner].len, false) / 1000U;
+        now_ms = (uint32_t)(now_us / 1000U);
+        sim_pending_full[winner] = false;
+
+        for (uint32_t node = 0U; node < nodes; node++)
+        {
+            if ((node == winner) || (sim_random() < loss))
+            {
+                continue;
+            }
+            sim_node = node;
+            if (0U == node)
+            {
+                mstream_tx_on_frame(&sim_tx, &sim_pending[winner]);
+            }
+            else
+            {
+                mstream_rx_on_frame(&sim_rx[node - 1U], &sim_pending[winner],
+                                    now_ms);
+            }
+        }
+    }
+
+    result->goodput_min = UINT32_MAX;
+    result->complete = 1000U;
+    result->retransmits = sim_tx.stats.retransmits;
+    result->nacks = sim_tx.stats.nacks;
+    for (uint32_t idx = 0U; idx < receivers; idx++)
+    {
+        const mstream_rx_stats_t *stats = &sim_rx[idx].stats;
+        uint32_t messages = stats->messages_ok + stats->messages_bad;
+        uint32_t goodput = 0U;
+        uint32_t complete = 0U;
+
+        if (0U != stats->ms)
+        {
+            goodput = (uint32_t)(((uint64_t)stats->bytes * 1000U) /
+                                 stats->ms);
+        }
+        if (0U != messages)
+        {
+            complete = (stats->messages_ok * 1000U) / messages;
+        }
+        result->goodput_min = (goodput < result->goodput_min) ?
+                              goodput : result->goodput_min;
+        result->complete = (complete < result->complete) ?
+                           complete : result->complete;
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Prints the goodput of the slowest receiver for 1 to 8 receivers at each
+* loss rate, with the retransmissions the sender made. Fails if a receiver
+* gets less than SIM_COMPLETE_PERMILLE of the messages complete, or if a
+* lossless run needs a retransmission.
+*
+*******************************************************************************/
+int main(void)
+{
+    int result = 0;
+
+    printf("Multicast stream, %u-byte messages back to back, data phase "
+           "%lu kbit/s, %u s per run\n", (unsigned)SIM_MESSAGE_SIZE,
+           (unsigned long)(TXFMT_DATA_BPS / 1000UL),
+           (unsigned)(SIM_DURATION_MS / 1000U));
+    printf("  %-10s %-9s %12s %9s %11s %7s\n", "loss", "receivers",
+           "goodput kB/s", "complete", "retransmits", "NACKs");
+
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(sim_loss_permille) /
+                          sizeof(sim_loss_permille[0]));
+         idx++)
+    {
+        uint32_t loss = sim_loss_permille[idx];
+
+        for (uint32_t receivers = 1U; receivers <= SIM_RECEIVERS_MAX;
+             receivers++)
+        {
+            sim_result_t run;
+            bool ok;
+
+            sim_run(receivers, loss, &run);
+            ok = (run.complete >= SIM_COMPLETE_PERMILLE) &&
+                 ((0U != loss) || (0U == run.retransmits));
+            printf("  %3u.%u%%     %-9u %12.1f %8.1f%% %11lu %7lu  %s\n",
+                   (unsigned)(loss / 10U), (unsigned)(loss % 10U),
+                   (unsigned)receivers, (double)run.goodput_min / 1000.0,
+                   (double)run.complete / 10.0,
+                   (unsigned long)run.retransmits, (unsigned long)run.nacks,
+                   ok ? "ok" : "FAIL");
+            result |= ok ? 0 : 1;
+        }
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,396 @@
+/******************************************************************************
+* File Name:   cy_pdl.h
+*
+* Description: This file contains the part of the peripheral driver library
+*              that the host builds of the frame code and the benchmark cases
+*              use.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef CY_PDL_H
+#define CY_PDL_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define CY_UNUSED_PARAMETER(x)  ((void)(x))
+#define CY_ASSERT(x)            assert(x)
+#define __STATIC_INLINE         static inline
+#define __STATIC_FORCEINLINE    static inline
+
+/* DWT and CoreDebug registers used by cycle_counter.h */
+#define DWT                     (cy_host_dwt())
+#define CoreDebug               (cy_host_core_debug())
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t CTRL;
+    uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    uint32_t DEMCR;
+} CoreDebug_Type;
+
+/* CAN FD driver types, with the fields the application uses */
+typedef struct
+{
+    uint32_t unused;
+} CANFD_Type;
+
+typedef enum
+{
+    CY_CANFD_SUCCESS                    = 0,
+    CY_CANFD_BAD_PARAM                  = 1
+} cy_en_canfd_status_t;
+
+typedef enum
+{
+    CY_CANFD_TEST_MODE_DISABLE          = 0,
+    CY_CANFD_TEST_MODE_BUS_MONITORING   = 1,
+    CY_CANFD_TEST_MODE_EXTERNAL_LOOP_BACK = 2,
+    CY_CANFD_TEST_MODE_INTERNAL_LOOP_BACK = 3
+} cy_en_canfd_test_mode_t;
+
+typedef enum
+{
+    CY_CANFD_RTR_DATA_FRAME             = 0,
+    CY_CANFD_RTR_REMOTE_FRAME           = 1
+} cy_en_canfd_rtr_t;
+
+typedef enum
+{
+    CY_CANFD_XTD_STANDARD_ID            = 0,
+    CY_CANFD_XTD_EXTENDED_ID            = 1
+} cy_en_canfd_xtd_t;
+
+typedef enum
+{
+    CY_CANFD_ESI_ERROR_ACTIVE           = 0,
+    CY_CANFD_ESI_ERROR_PASSIVE          = 1
+} cy_en_canfd_esi_t;
+
+typedef enum
+{
+    CY_CANFD_FDF_STANDARD_FRAME         = 0,
+    CY_CANFD_FDF_CAN_FD_FRAME           = 1
+} cy_en_canfd_fdf_t;
+
+typedef enum
+{
+    CY_CANFD_SFT_RANGE_SFID1_SFID2      = 0,
+    CY_CANFD_SFT_DUAL_ID                = 1,
+    CY_CANFD_SFT_CLASSIC_FILTER         = 2,
+    CY_CANFD_SFT_DISABLED               = 3
+} cy_en_canfd_sft_t;
+
+typedef enum
+{
+    CY_CANFD_SFEC_DISABLE               = 0,
+    CY_CANFD_SFEC_STORE_RX_FIFO_0       = 1,
+    CY_CANFD_SFEC_STORE_RX_FIFO_1       = 2,
+    CY_CANFD_SFEC_REJECT_ID             = 3
+} cy_en_canfd_sfec_t;
+
+typedef struct
+{
+    uint32_t            id;
+    cy_en_canfd_rtr_t   rtr;
+    cy_en_canfd_xtd_t   xtd;
+    cy_en_canfd_esi_t   esi;
+} cy_stc_canfd_r0_t;
+
+typedef struct
+{
+    uint32_t            rxts;
+    uint32_t            dlc;
+    bool                brs;
+    cy_en_canfd_fdf_t   fdf;
+    uint32_t            fidx;
+    bool                anmf;
+} cy_stc_canfd_r1_t;
+
+typedef struct
+{
+    cy_stc_canfd_r0_t  *r0_f;
+    cy_stc_canfd_r1_t  *r1_f;
+    uint32_t           *data_area_f;
+} cy_stc_canfd_rx_buffer_t;
+
+typedef struct
+{
+    uint32_t            id;
+    cy_en_canfd_rtr_t   rtr;
+    cy_en_canfd_xtd_t   xtd;
+    cy_en_canfd_esi_t   esi;
+} cy_stc_canfd_t0_t;
+
+typedef struct
+{
+    uint32_t            dlc;
+    bool                brs;
+    cy_en_canfd_fdf_t   fdf;
+    bool                efc;
+    uint32_t            mm;
+} cy_stc_canfd_t1_t;
+
+typedef struct
+{
+    cy_stc_canfd_t0_t  *t0_f;
+    cy_stc_canfd_t1_t  *t1_f;
+    uint32_t           *data_area_f;
+} cy_stc_canfd_tx_buffer_t;
+
+typedef void (*cy_canfd_rx_msg_func_ptr_t)(bool msg_valid,
+                                           uint8_t msg_buf_fifo_num,
+                                           cy_stc_canfd_rx_buffer_t *rx_buf);
+
+typedef struct
+{
+    cy_canfd_rx_msg_func_ptr_t canFDRxInterruptFunction;
+} cy_stc_canfd_interrupt_handling_t;
+
+typedef struct
+{
+    cy_stc_canfd_interrupt_handling_t canFDInterruptHandling;
+} cy_stc_canfd_context_t;
+
+typedef struct
+{
+    uint32_t            sfid2;
+    uint32_t            sfid1;
+    cy_en_canfd_sfec_t  sfec;
+    cy_en_canfd_sft_t   sft;
+} cy_stc_id_filter_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Rate of the cycle counter, defined by the host program */
+extern uint32_t SystemCoreClock;
+
+/*******************************************************************************
+* Function Name: cy_host_dwt
+********************************************************************************
+* Summary:
+* Returns the DWT registers with CYCCNT loaded from the host clock. The
+* counter counts nanoseconds, so the host program sets SystemCoreClock to
+* 1 GHz.
+*
+*******************************************************************************/
+static inline DWT_Type *cy_host_dwt(void)
+{
+    static DWT_Type dwt;
+    struct timespec now;
+
+    (void)timespec_get(&now, TIME_UTC);
+    dwt.CYCCNT = (uint32_t)(((uint64_t)now.tv_sec * 1000000000ULL) +
+                            (uint64_t)now.tv_nsec);
+    return &dwt;
+}
+
+/*******************************************************************************
+* Function Name: cy_host_core_debug
+********************************************************************************
+* Summary:
+* Returns the CoreDebug registers, which have no effect on the host.
+*
+*******************************************************************************/
+static inline CoreDebug_Type *cy_host_core_debug(void)
+{
+    static CoreDebug_Type core_debug;
+
+    return &core_debug;
+}
+
+/* A host program has no interrupts to mask */
+static inline uint32_t __get_PRIMASK(void)
+{
+    return 0U;
+}
+
+static inline void __set_PRIMASK(uint32_t primask)
+{
+    (void)primask;
+}
+
+static inline void __disable_irq(void)
+{
+}
+
+/* Barriers have nothing to order on the host */
+static inline void __DMB(void)
+{
+}
+
+static inline uint32_t __CLZ(uint32_t value)
+{
+    return (0U == value) ? 32U : (uint32_t)__builtin_clz(value);
+}
+
+static inline uint32_t __RBIT(uint32_t value)
+{
+    uint32_t result = 0U;
+
+    for (uint32_t bit = 0U; bit < 32U; bit++)
+    {
+        result = (result << 1U) | ((value >> bit) & 1U);
+    }
+    return result;
+}
+
+/* Nor anything to interrupt an exclusive access: the store always succeeds */
+static inline uint32_t __LDREXW(volatile uint32_t *addr)
+{
+    return *addr;
+}
+
+static inline uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+    *addr = value;
+    return 0U;
+}
+
+static inline void __CLREX(void)
+{
+}
+
+/*******************************************************************************
+* Function Name: cy_host_msgram
+********************************************************************************
+* Summary:
+* Returns the RAM copy of the one TX buffer element of the message RAM.
+*
+*******************************************************************************/
+static inline volatile uint32_t *cy_host_msgram(void)
+{
+    static volatile uint32_t element[2U + (64U / 4U)];
+
+    return element;
+}
+
+/*******************************************************************************
+* Function Name: Cy_CANFD_UpdateAndTransmitMsgBuffer
+********************************************************************************
+* Summary:
+* Writes the T0 and T1 words and the payload of a TX buffer element into a
+* RAM copy of the message RAM, as the driver does, and sends nothing.
+*
+*******************************************************************************/
+static inline cy_en_canfd_status_t Cy_CANFD_UpdateAndTransmitMsgBuffer(
+    CANFD_Type *base, uint32_t chan, const cy_stc_canfd_tx_buffer_t *txBuffer,
+    uint8_t index, const cy_stc_canfd_context_t *context)
+{
+    static const uint8_t dlc_len[16] =
+    {
+        0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 12U, 16U, 20U, 24U, 32U, 48U, 64U
+    };
+    volatile uint32_t *element = cy_host_msgram();
+    const cy_stc_canfd_t0_t *t0 = txBuffer->t0_f;
+    const cy_stc_canfd_t1_t *t1 = txBuffer->t1_f;
+    uint32_t words = (dlc_len[t1->dlc & 0xFU] + 3U) / 4U;
+
+    (void)base;
+    (void)chan;
+    (void)index;
+    (void)context;
+    element[0] = ((uint32_t)t0->esi << 31U) | ((uint32_t)t0->xtd << 30U) |
+                 ((uint32_t)t0->rtr << 29U) |
+                 ((CY_CANFD_XTD_STANDARD_ID == t0->xtd) ?
+                  (t0->id << 18U) : t0->id);
+    element[1] = (t1->mm << 24U) | ((uint32_t)t1->efc << 23U) |
+                 ((uint32_t)t1->fdf << 21U) | ((uint32_t)t1->brs << 20U) |
+                 (t1->dlc << 16U);
+    for (uint32_t idx = 0U; idx < words; idx++)
+    {
+        element[2U + idx] = txBuffer->data_area_f[idx];
+    }
+    return CY_CANFD_SUCCESS;
+}
+
+/* Configuration changes and test modes have no effect on the host */
+static inline cy_en_canfd_status_t Cy_CANFD_ConfigChangesEnable(
+    CANFD_Type *base, uint32_t chan)
+{
+    (void)base;
+    (void)chan;
+    return CY_CANFD_SUCCESS;
+}
+
+static inline cy_en_canfd_status_t Cy_CANFD_ConfigChangesDisable(
+    CANFD_Type *base, uint32_t chan)
+{
+    (void)base;
+    (void)chan;
+    return CY_CANFD_SUCCESS;
+}
+
+static inline void Cy_CANFD_TestModeConfig(CANFD_Type *base, uint32_t chan,
+                                           cy_en_canfd_test_mode_t testMode)
+{
+    (void)base;
+    (void)chan;
+    (void)testMode;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CY_PDL_H */
+
+/* [] END OF FILE */
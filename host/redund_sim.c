@@ -0,0 +1,526 @@
+/******************************************************************************
+* File Name:   redund_sim.c
+*
+* Description: This file contains the two-bus simulator of the redundancy
+*              layer, which measures failover times under bus faults and the
+*              cost of duplicate suppression.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "redund.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Heartbeat period, as REDUND_CAN_PERIOD_MS */
+#define SIM_PERIOD_MS           (10U)
+
+/* Time from the loss of acknowledgements to error passive: 16 attempts of
+ * a 12-byte frame at 500 kbit/s / 2 Mbit/s, rounded up */
+#define SIM_PASSIVE_MS          (3U)
+
+/* Bus-off recovery: 128 sequences of 11 recessive bits at 500 kbit/s */
+#define SIM_RECOVERY_MS         (3U)
+
+/* Highest stream counter tracked for lost frames */
+#define SIM_FRAMES_MAX          (4096U)
+
+/* Frames replayed through redund_receive() for the overhead measurement */
+#define SIM_OVERHEAD_FRAMES     (65536U)
+#define SIM_OVERHEAD_ROUNDS     (32U)
+
+#define SIM_NEVER               (0xFFFFFFFFUL)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Fault on one bus between two times */
+typedef struct
+{
+    uint32_t bus;
+    uint32_t from_ms;
+    uint32_t to_ms;
+} sim_fault_t;
+
+typedef struct
+{
+    const char *name;
+    uint32_t    duration_ms;
+    uint32_t    loss_pct[REDUND_BUS_COUNT];     /* Copies dropped at random */
+    sim_fault_t cut;                            /* Wire cut: no ACK */
+    sim_fault_t bus_off;                        /* Controller in bus-off */
+    uint32_t    stale_every;                    /* Replay an old frame */
+} sim_scenario_t;
+
+/* Simulated bus with one TX buffer, as on the target */
+typedef struct
+{
+    bool     pending;
+    uint32_t due_ms;
+    uint32_t id;
+    uint8_t  len;
+    uint8_t  data[64];
+    bool     passive;
+    bool     off;
+    uint32_t restart_ms;
+} sim_bus_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const sim_scenario_t *sim_scenario;
+static sim_bus_t sim_bus[REDUND_BUS_COUNT];
+static uint32_t  sim_now_ms;
+
+/* Receiver view of the heartbeat */
+static uint8_t   sim_dropped[SIM_FRAMES_MAX];   /* Bit per bus */
+static bool      sim_rx_started;
+static uint32_t  sim_rx_counter;
+static uint32_t  sim_rx_ms;
+static uint32_t  sim_lost;
+static uint32_t  sim_max_gap_ms;
+
+/* Capture of the sent frames for the overhead measurement */
+static uint8_t  (*sim_capture)[16];
+static uint32_t   sim_capture_count;
+
+static const sim_scenario_t sim_scenarios[] =
+{
+    { "clean",       10000U, { 0U, 0U }, { 0U, SIM_NEVER, 0U },
+      { 0U, SIM_NEVER, 0U }, 0U },
+    { "noise 5%",    20000U, { 5U, 5U }, { 0U, SIM_NEVER, 0U },
+      { 0U, SIM_NEVER, 0U }, 0U },
+    { "cut A",        6000U, { 0U, 0U }, { 0U, 2000U, 4000U },
+      { 0U, SIM_NEVER, 0U }, 0U },
+    { "bus-off B",    6000U, { 0U, 0U }, { 0U, SIM_NEVER, 0U },
+      { 1U, 2000U, 2500U }, 0U },
+    { "replay",      10000U, { 0U, 0U }, { 0U, SIM_NEVER, 0U },
+      { 0U, SIM_NEVER, 0U }, 97U },
+};
+
+/*******************************************************************************
+* Function Name: sim_active
+********************************************************************************
+* Summary:
+* Tells whether a fault of the scenario is active on a bus.
+*
+*******************************************************************************/
+static bool sim_active(const sim_fault_t *fault, uint32_t bus)
+{
+    return (fault->bus == bus) && (sim_now_ms >= fault->from_ms) &&
+           (sim_now_ms < fault->to_ms);
+}
+
+/*******************************************************************************
+* Function Name: sim_send
+********************************************************************************
+* Summary:
+* Send function of the redundancy layer. Takes the frame into the TX buffer
+* of the bus unless it is still pending or the controller is in bus-off.
+*
+*******************************************************************************/
+static bool sim_send(uint32_t bus, uint32_t id, const uint8_t *data,
+                     uint8_t len)
+{
+    sim_bus_t *sb = &sim_bus[bus];
+
+    if (sb->pending || sb->off)
+    {
+        return false;
+    }
+
+    sb->pending = true;
+    sb->due_ms = sim_now_ms + ((bus == 0U) ? (uint32_t)(rand() % 2) :
+                               (uint32_t)(rand() % 3));
+    sb->id = id;
+    sb->len = len;
+    memcpy(sb->data, data, len);
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_capture_send
+********************************************************************************
+* Summary:
+* Send function that records the frames of bus A.
+*
+*******************************************************************************/
+static bool sim_capture_send(uint32_t bus, uint32_t id, const uint8_t *data,
+                             uint8_t len)
+{
+    (void)id;
+
+    if ((bus == 0U) && (sim_capture_count < SIM_OVERHEAD_FRAMES))
+    {
+        memcpy(sim_capture[sim_capture_count++], data, len);
+    }
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_deliver
+********************************************************************************
+* Summary:
+* Passes a copy to the redundancy layer and, for the first copy, tracks the
+* heartbeat counter like redund_can_on_frame().
+*
+*******************************************************************************/
+static void sim_deliver(uint32_t bus, uint32_t id, const uint8_t *data,
+                        uint8_t len)
+{
+    uint32_t counter;
+
+    if (redund_receive(bus, id, data, len, sim_now_ms) < 0)
+    {
+        return;
+    }
+
+    memcpy(&counter, data, sizeof(counter));
+    if (sim_rx_started)
+    {
+        if ((uint32_t)(counter - sim_rx_counter) > 1U)
+        {
+            sim_lost += counter - sim_rx_counter - 1U;
+        }
+        if ((sim_now_ms - sim_rx_ms) > sim_max_gap_ms)
+        {
+            sim_max_gap_ms = sim_now_ms - sim_rx_ms;
+        }
+    }
+    sim_rx_started = true;
+    sim_rx_counter = counter;
+    sim_rx_ms = sim_now_ms;
+}
+
+/*******************************************************************************
+* Function Name: sim_bus_tick
+********************************************************************************
+* Summary:
+* Advances one bus by a millisecond: applies the faults of the scenario,
+* reports the controller state and delivers the pending frame when due.
+*
+*******************************************************************************/
+static void sim_bus_tick(uint32_t bus)
+{
+    sim_bus_t *sb = &sim_bus[bus];
+    bool cut = sim_active(&sim_scenario->cut, bus);
+    uint32_t counter;
+
+    if (sim_active(&sim_scenario->bus_off, bus))
+    {
+        sb->off = true;
+        sb->pending = false;
+        sb->restart_ms = sim_scenario->bus_off.to_ms + SIM_RECOVERY_MS;
+    }
+    else if (sb->off && (sim_now_ms >= sb->restart_ms))
+    {
+        sb->off = false;
+    }
+
+    /* Without acknowledgements the frame is repeated until the error
+     * counter reaches error passive; it is still repeated after that */
+    sb->passive = sb->pending && cut &&
+                  ((sim_now_ms - sim_scenario->cut.from_ms) >= SIM_PASSIVE_MS);
+    redund_bus_fault(bus, sb->passive || sb->off, sim_now_ms);
+
+    if (sb->pending && !cut && (sim_now_ms >= sb->due_ms))
+    {
+        sb->pending = false;
+        memcpy(&counter, sb->data, sizeof(counter));
+        if ((uint32_t)(rand() % 100) < sim_scenario->loss_pct[bus])
+        {
+            sim_dropped[counter % SIM_FRAMES_MAX] |= (uint8_t)(1U << bus);
+            return;
+        }
+        sim_deliver(bus, sb->id, sb->data, sb->len);
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_run
+********************************************************************************
+* Summary:
+* Runs one scenario with a heartbeat every SIM_PERIOD_MS and prints the
+* results. Returns 1 if a check failed.
+*
+*******************************************************************************/
+static int sim_run(const sim_scenario_t *scenario)
+{
+    redund_stats_t stats;
+    uint8_t payload[8];
+    uint8_t old[16] = { 0U };
+    uint8_t old_len = 0U;
+    uint32_t sent = 0U;
+    uint32_t expected = 0U;
+    uint32_t tx_down_ms = SIM_NEVER;
+    uint32_t rx_down_ms = SIM_NEVER;
+    uint32_t up_ms = SIM_NEVER;
+    uint32_t fault_from = SIM_NEVER;
+    uint32_t fault_to = SIM_NEVER;
+    uint32_t fault_bus = 0U;
+    bool ok;
+
+    sim_scenario = scenario;
+    memset(sim_bus, 0, sizeof(sim_bus));
+    memset(sim_dropped, 0, sizeof(sim_dropped));
+    sim_rx_started = false;
+    sim_lost = 0U;
+    sim_max_gap_ms = 0U;
+    redund_init(sim_send);
+
+    if (SIM_NEVER != scenario->cut.from_ms)
+    {
+        fault_bus = scenario->cut.bus;
+        fault_from = scenario->cut.from_ms;
+        fault_to = scenario->cut.to_ms;
+    }
+    else if (SIM_NEVER != scenario->bus_off.from_ms)
+    {
+        fault_bus = scenario->bus_off.bus;
+        fault_from = scenario->bus_off.from_ms;
+        fault_to = scenario->bus_off.to_ms;
+    }
+
+    for (sim_now_ms = 0U; sim_now_ms < scenario->duration_ms; sim_now_ms++)
+    {
+        /* The two buses are served in random order, so copies overtake
+         * each other */
+        uint32_t first = (uint32_t)(rand() % 2);
+
+        sim_bus_tick(first);
+        sim_bus_tick(first ^ 1U);
+
+        if (0U == (sim_now_ms % SIM_PERIOD_MS))
+        {
+            memcpy(payload, &sent, sizeof(sent));
+            memcpy(&payload[4], &sim_now_ms, sizeof(sim_now_ms));
+            (void)redund_send(REDUND_STREAM_NODE_1, payload, sim_now_ms);
+            sent++;
+            if (1U == sent)
+            {
+                old_len = sim_bus[0].len;
+                memcpy(old, sim_bus[0].data, old_len);
+            }
+        }
+
+        /* A babbling node repeating the first frame */
+        if ((0U != scenario->stale_every) && (sent > REDUND_WINDOW) &&
+            (0U == (sim_now_ms % scenario->stale_every)))
+        {
+            sim_deliver(sim_now_ms & 1U, redund_stream_id(REDUND_STREAM_NODE_1),
+                        old, old_len);
+        }
+
+        redund_poll(sim_now_ms);
+
+        redund_get_stats(&stats);
+        if (sim_now_ms >= fault_from)
+        {
+            if ((SIM_NEVER == tx_down_ms) && !stats.bus[fault_bus].tx_ok)
+            {
+                tx_down_ms = sim_now_ms - fault_from;
+            }
+            if ((SIM_NEVER == rx_down_ms) && !stats.bus[fault_bus].rx_ok)
+            {
+                rx_down_ms = sim_now_ms - fault_from;
+            }
+        }
+        if ((sim_now_ms >= fault_to) && (SIM_NEVER == up_ms) &&
+            stats.bus[fault_bus].tx_ok && stats.bus[fault_bus].rx_ok)
+        {
+            up_ms = sim_now_ms - fault_to;
+        }
+    }
+
+    /* Frames still in flight at the end are not counted */
+    for (uint32_t bus = 0U; bus < REDUND_BUS_COUNT; bus++)
+    {
+        sim_bus[bus].pending = false;
+    }
+    for (uint32_t idx = 0U; (idx < sent) && (idx < SIM_FRAMES_MAX); idx++)
+    {
+        expected += (3U == sim_dropped[idx]) ? 1U : 0U;
+    }
+
+    redund_get_stats(&stats);
+    printf("%s: %u frames sent, %u delivered, %u lost (%u on both buses), "
+           "%u duplicates, %u stale, max gap %u ms\n", scenario->name,
+           (unsigned)sent, (unsigned)stats.delivered, (unsigned)sim_lost,
+           (unsigned)expected, (unsigned)stats.duplicates,
+           (unsigned)stats.stale, (unsigned)sim_max_gap_ms);
+    for (uint32_t bus = 0U; bus < REDUND_BUS_COUNT; bus++)
+    {
+        const redund_bus_stats_t *bs = &stats.bus[bus];
+
+        printf("  bus %c           tx %u failed %u skipped %u, rx %u first %u "
+               "missed %u, failovers %u\n", (int)('A' + bus),
+               (unsigned)bs->tx_sent, (unsigned)bs->tx_failed,
+               (unsigned)bs->tx_skipped, (unsigned)bs->rx_valid,
+               (unsigned)bs->rx_first, (unsigned)bs->rx_missed,
+               (unsigned)bs->failovers);
+    }
+
+    /* Every frame that made it on a bus is delivered exactly once */
+    ok = (sim_lost == expected) &&
+         (stats.delivered + sim_lost + 1U >= sent) &&
+         (stats.delivered <= sent);
+
+    if (SIM_NEVER != fault_from)
+    {
+        printf("  failover        tx after %u ms, rx after %u ms, back %u ms "
+               "after the fault ended\n", (unsigned)tx_down_ms,
+               (unsigned)rx_down_ms, (unsigned)up_ms);
+        ok = ok && (tx_down_ms <= (SIM_PASSIVE_MS + 1U)) &&
+             (rx_down_ms <= (REDUND_SILENT_MS + SIM_PERIOD_MS)) &&
+             (up_ms <= (REDUND_PROBE_MS + SIM_RECOVERY_MS + SIM_PERIOD_MS)) &&
+             (sim_max_gap_ms <= (SIM_PERIOD_MS + 2U));
+    }
+    else if (0U == scenario->loss_pct[0])
+    {
+        ok = ok && (0U == stats.bus[0].failovers) &&
+             (0U == stats.bus[1].failovers);
+    }
+    if (0U != scenario->stale_every)
+    {
+        ok = ok && (0U != stats.stale) && (0U == stats.resyncs);
+    }
+
+    if (!ok)
+    {
+        printf("  FAILED\n");
+    }
+    return ok ? 0 : 1;
+}
+
+/*******************************************************************************
+* Function Name: sim_overhead
+********************************************************************************
+* Summary:
+* Measures the host time of redund_receive() for first copies and for
+* suppressed duplicates.
+*
+*******************************************************************************/
+static int sim_overhead(void)
+{
+    uint8_t payload[8] = { 0U };
+    uint8_t len = redund_frame_len(REDUND_STREAM_NODE_1);
+    uint32_t id = redund_stream_id(REDUND_STREAM_NODE_1);
+    redund_stats_t stats;
+    double first_ns;
+    double both_ns;
+    clock_t start;
+    uint32_t count = SIM_OVERHEAD_FRAMES * SIM_OVERHEAD_ROUNDS;
+
+    sim_capture = malloc(SIM_OVERHEAD_FRAMES * sizeof(*sim_capture));
+    if (NULL == sim_capture)
+    {
+        return 1;
+    }
+    sim_capture_count = 0U;
+    redund_init(sim_capture_send);
+    for (uint32_t idx = 0U; idx < SIM_OVERHEAD_FRAMES; idx++)
+    {
+        (void)redund_send(REDUND_STREAM_NODE_1, payload, 0U);
+    }
+
+    /* Sequence numbers wrap after SIM_OVERHEAD_FRAMES, so the rounds
+     * continue the stream */
+    redund_init(sim_capture_send);
+    start = clock();
+    for (uint32_t idx = 0U; idx < count; idx++)
+    {
+        (void)redund_receive(0U, id, sim_capture[idx % SIM_OVERHEAD_FRAMES],
+                             len, 0U);
+    }
+    first_ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / count;
+
+    redund_init(sim_capture_send);
+    start = clock();
+    for (uint32_t idx = 0U; idx < count; idx++)
+    {
+        const uint8_t *frame = sim_capture[idx % SIM_OVERHEAD_FRAMES];
+
+        (void)redund_receive(0U, id, frame, len, 0U);
+        (void)redund_receive(1U, id, frame, len, 0U);
+    }
+    both_ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / count;
+    redund_get_stats(&stats);
+    free(sim_capture);
+
+    printf("overhead: %u-byte payload sent as %u-byte frame\n",
+           (unsigned)sizeof(payload), (unsigned)len);
+    printf("  first copy      %.1f ns\n", first_ns);
+    printf("  duplicate       %.1f ns\n", both_ns - first_ns);
+    printf("  delivered       %u of %u, %u duplicates suppressed\n",
+           (unsigned)stats.delivered, (unsigned)count,
+           (unsigned)stats.duplicates);
+
+    return ((stats.delivered == count) && (stats.duplicates == count)) ? 0 : 1;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs the fault scenarios and the overhead measurement. Exits with status 1
+* if a check failed.
+*
+*******************************************************************************/
+int main(void)
+{
+    int result = 0;
+
+    srand(1U);
+    for (uint32_t idx = 0U;
+         idx < (sizeof(sim_scenarios) / sizeof(sim_scenarios[0])); idx++)
+    {
+        result |= sim_run(&sim_scenarios[idx]);
+    }
+    result |= sim_overhead();
+
+    return result;
+}
+
+/* [] END OF FILE */
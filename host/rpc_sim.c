@@ -0,0 +1,261 @@
+/******************************************************************************
+* File Name:   rpc_sim.c
+*
+* Description: This file contains the loopback simulator of the RPC layer,
+*              which measures the calls per second and the latency of
+*              pipelined calls and their recovery from lost frames.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "rpc.h"
+#include "cycle_counter.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* The node calls itself: its requests and responses come back to it */
+#define SIM_NODE                (1U)
+
+/* Calls per scenario */
+#define SIM_CALLS               (200000U)
+#define SIM_LOSSY_CALLS         (1000U)
+
+/* In the lossy scenario, every SIM_LOSS_EVERY-th frame on the bus is lost */
+#define SIM_LOSS_EVERY          (50U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    uint32_t calls;
+    uint32_t loss_every;            /* 0 for no loss */
+} sim_scenario_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* The cycle counter of the PDL stub counts nanoseconds */
+uint32_t SystemCoreClock = 1000000000UL;
+
+static const sim_scenario_t sim_scenarios[] =
+{
+    { "loopback",                   SIM_CALLS,          0U },
+    { "loopback, 1 in 50 lost",     SIM_LOSSY_CALLS,    SIM_LOSS_EVERY },
+};
+
+/* Single TX buffer of the node; its frame is on the bus on the next pass */
+static canfd_frame_t sim_bus;
+static bool sim_bus_full;
+
+/* Issue time of each call in flight, by the echoed value */
+static uint32_t sim_issued[RPC_MAX_PENDING];
+
+static uint32_t sim_requests;
+static uint32_t sim_ok;
+static uint32_t sim_bad;
+static uint32_t sim_latency_min;
+static uint64_t sim_latency_total;
+
+/*******************************************************************************
+* Function Name: sim_send
+********************************************************************************
+* Summary:
+* Frame transmit function: puts the frame in the TX buffer if it is free.
+*
+*******************************************************************************/
+static bool sim_send(const canfd_frame_t *frame)
+{
+    if (sim_bus_full)
+    {
+        return false;
+    }
+    if (RPC_REQUEST_ID == (frame->id & ~RPC_NODE_MAX))
+    {
+        sim_requests++;
+    }
+    sim_bus = *frame;
+    sim_bus_full = true;
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_on_echo
+********************************************************************************
+* Summary:
+* Completion of an echo call: checks the value and adds the time from the
+* call to its completion to the latencies.
+*
+*******************************************************************************/
+static void sim_on_echo(rpc_status_t status, const rpc_echo_resp_t *resp,
+                        void *ctx)
+{
+    uint32_t value = (uint32_t)(uintptr_t)ctx;
+    uint32_t latency = cycle_counter_get() -
+                       sim_issued[value % RPC_MAX_PENDING];
+
+    if ((RPC_STATUS_OK != status) || (resp->value != value))
+    {
+        sim_bad++;
+        return;
+    }
+
+    sim_ok++;
+    sim_latency_total += latency;
+    sim_latency_min = (latency < sim_latency_min) ? latency : sim_latency_min;
+}
+
+/*******************************************************************************
+* Function Name: sim_run
+********************************************************************************
+* Summary:
+* Keeps RPC_MAX_OUTSTANDING echo calls in flight until the calls of the
+* scenario are done, as the load test of node_services.c does. Each main
+* loop pass runs rpc_poll() and hands the frame it sent back to
+* rpc_on_frame(), unless the scenario loses it.
+*
+* Return:
+*  Elapsed time in nanoseconds
+*
+*******************************************************************************/
+static uint64_t sim_run(const sim_scenario_t *scenario)
+{
+    uint32_t issued = 0U;
+    uint32_t frames = 0U;
+    uint64_t elapsed = 0U;
+    uint32_t last;
+
+    rpc_init(SIM_NODE, sim_send);
+    sim_bus_full = false;
+    sim_requests = 0U;
+    sim_ok = 0U;
+    sim_bad = 0U;
+    sim_latency_min = UINT32_MAX;
+    sim_latency_total = 0U;
+    last = cycle_counter_get();
+
+    while ((sim_ok + sim_bad) < scenario->calls)
+    {
+        uint32_t now;
+
+        while ((issued < scenario->calls) &&
+               (rpc_pending(SIM_NODE) < RPC_MAX_OUTSTANDING))
+        {
+            rpc_echo_req_t req = { .value = issued };
+
+            sim_issued[issued % RPC_MAX_PENDING] = cycle_counter_get();
+            if (RPC_STATUS_OK != rpc_call_echo(SIM_NODE, &req, sim_on_echo,
+                                               (void *)(uintptr_t)issued))
+            {
+                break;
+            }
+            issued++;
+        }
+
+        rpc_poll();
+
+        if (sim_bus_full)
+        {
+            sim_bus_full = false;
+            frames++;
+            if ((0U == scenario->loss_every) ||
+                (0U != (frames % scenario->loss_every)))
+            {
+                rpc_on_frame(&sim_bus);
+            }
+        }
+
+        now = cycle_counter_get();
+        elapsed += now - last;
+        last = now;
+    }
+
+    return elapsed;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs rpc.c against itself over a lossless and a lossy loopback and prints
+* the calls per second, the retries and the latency from the call to its
+* completion, in host nanoseconds. Fails if a call does not complete with
+* its own value, or if the lossy run recovers without retries.
+*
+*******************************************************************************/
+int main(void)
+{
+    int result = 0;
+
+    printf("RPC loopback, %u echo calls in flight, host time\n",
+           (unsigned)RPC_MAX_OUTSTANDING);
+    printf("  %-24s %8s %8s %10s %8s %8s\n", "", "calls", "retries",
+           "calls/s", "min_ns", "mean_ns");
+
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(sim_scenarios) / sizeof(sim_scenarios[0]));
+         idx++)
+    {
+        const sim_scenario_t *scenario = &sim_scenarios[idx];
+        uint64_t elapsed = sim_run(scenario);
+        uint32_t retries = sim_requests - scenario->calls;
+        bool ok = (0U == sim_bad) && (scenario->calls == sim_ok) &&
+                  ((0U == scenario->loss_every) || (0U != retries));
+        uint64_t rate = (0U != elapsed) ?
+                        (((uint64_t)sim_ok * 1000000000ULL) / elapsed) : 0U;
+
+        printf("  %-24s %8lu %8lu %10llu %8lu %8llu  %s\n", scenario->name,
+               (unsigned long)sim_ok, (unsigned long)retries,
+               (unsigned long long)rate,
+               (unsigned long)((0U != sim_ok) ? sim_latency_min : 0U),
+               (unsigned long long)((0U != sim_ok) ?
+                                    (sim_latency_total / sim_ok) : 0U),
+               ok ? "ok" : "FAIL");
+        result |= ok ? 0 : 1;
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,531 @@
+/******************************************************************************
+* File Name:   rxdma_sim.c
+*
+* Description: Host model of the DMA transfer of RX FIFO 0: runs the ring
+*              against a model of the FIFO, its watermark and timeout, and a
+*              DataWire channel, and checks that every frame arrives once, in
+*              order and unchanged.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rxdma.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* RX FIFO 0 of the design */
+#define SIM_FIFO_SIZE           (8U)
+
+/* Core clock cycles per nominal bit time: 180 MHz at 500 kbit/s. The
+ * simulation advances one bit time per step. */
+#define SIM_BIT_CYCLES          (360U)
+
+/* Longest run of a scenario, in bit times */
+#define SIM_STEPS_MAX           (20000000UL)
+
+/* Frames a scenario sends at most */
+#define SIM_FRAMES_MAX          (20000U)
+
+/* Payload lengths of the data length codes */
+#define SIM_DLC_LEN             { 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 12U,    \
+                                  16U, 20U, 24U, 32U, 48U, 64U }
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Traffic of a scenario */
+typedef enum
+{
+    SIM_TRAFFIC_MIXED,          /* Classic, FD, extended and remote frames */
+    SIM_TRAFFIC_FD64            /* 64-byte FD frames with bit rate switch */
+} sim_traffic_t;
+
+typedef struct
+{
+    const char   *name;
+    sim_traffic_t traffic;
+    uint32_t      frames;
+    uint32_t      gap_min;      /* Bit times from one frame to the next */
+    uint32_t      gap_max;
+    uint32_t      burst;        /* Frames sent back to back, 1 to burst */
+    uint32_t      dma_word_cycles;  /* DMA cycles per word moved */
+    bool          loss_expected;
+} sim_scenario_t;
+
+/* A frame stored in RX FIFO 0, in the order of storing */
+typedef struct
+{
+    uint32_t id;
+    uint32_t seq;
+    uint32_t stored;            /* Bit time it was stored */
+    uint8_t  dlc;
+    bool     xtd;
+    bool     rtr;
+    bool     fdf;
+    bool     brs;
+} sim_frame_t;
+
+typedef struct
+{
+    uint32_t sent;
+    uint32_t lost;              /* FIFO full, blocking mode */
+    uint32_t delivered;
+    uint32_t mismatched;
+    uint32_t interrupts;        /* CAN FD and DMA interrupts taken */
+    uint32_t latency_max;       /* Bit times, storing to processing */
+} sim_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const sim_scenario_t sim_scenarios[] =
+{
+    { "sparse mixed frames",     SIM_TRAFFIC_MIXED, 500U,  2000U, 4000U,  1U,
+      4U, false },
+    { "back-to-back FD 64",      SIM_TRAFFIC_FD64, 20000U,  180U,  180U,  1U,
+      4U, false },
+    { "mixed bursts",            SIM_TRAFFIC_MIXED, 20000U, 110U, 3000U, 20U,
+      4U, false },
+    { "stalled DMA, FD 64",      SIM_TRAFFIC_FD64,  2000U,  180U,  180U,  1U,
+      6000U, true },
+};
+
+static const uint8_t sim_dlc_len[16] = SIM_DLC_LEN;
+
+/* Controller: RX FIFO 0 in the message RAM and its status */
+static uint32_t     sim_mram[SIM_FIFO_SIZE][RXDMA_ELEMENT_WORDS];
+static uint32_t     sim_put;
+static uint32_t     sim_get;
+static uint32_t     sim_fill;
+static bool         sim_ir_watermark;
+static bool         sim_ir_timeout;
+static uint32_t     sim_timeout;
+static bool         sim_timeout_running;
+
+/* DataWire channel */
+static bool             sim_dma_busy;
+static uint32_t         sim_dma_src;
+static uint32_t         sim_dma_count;
+static rxdma_element_t *sim_dma_dst;
+static uint32_t         sim_dma_done;
+
+static rxdma_ring_t sim_ring;
+
+/* Frames in the order they were stored, checked against the delivered
+ * ones */
+static sim_frame_t  sim_stored[SIM_FRAMES_MAX];
+static uint32_t     sim_stored_count;
+
+static uint32_t     sim_now;
+static uint32_t     sim_dma_word_cycles;
+static sim_result_t sim_result;
+
+/*******************************************************************************
+* Function Name: sim_random
+********************************************************************************
+* Summary:
+* Returns a random number from lo to hi inclusive.
+*
+*******************************************************************************/
+static uint32_t sim_random(uint32_t lo, uint32_t hi)
+{
+    return lo + (uint32_t)(rand() % (int)(hi - lo + 1U));
+}
+
+/*******************************************************************************
+* Function Name: sim_payload
+********************************************************************************
+* Summary:
+* Returns byte idx of the payload of frame seq.
+*
+*******************************************************************************/
+static uint8_t sim_payload(uint32_t seq, uint32_t idx)
+{
+    return (uint8_t)((seq * 7U) + (idx * 13U));
+}
+
+/*******************************************************************************
+* Function Name: sim_frame_new
+********************************************************************************
+* Summary:
+* Makes up the next frame of the traffic.
+*
+*******************************************************************************/
+static void sim_frame_new(sim_traffic_t traffic, uint32_t seq,
+                          sim_frame_t *frame)
+{
+    memset(frame, 0, sizeof(*frame));
+    frame->seq = seq;
+
+    if (SIM_TRAFFIC_FD64 == traffic)
+    {
+        frame->id = sim_random(0U, 0x7FFU);
+        frame->fdf = true;
+        frame->brs = true;
+        frame->dlc = 15U;
+        return;
+    }
+
+    frame->xtd = (0U == sim_random(0U, 3U));
+    frame->id = frame->xtd ? sim_random(0U, RXDMA_R0_ID_MASK) :
+                sim_random(0U, RXDMA_R0_STD_ID_MASK);
+    frame->fdf = (0U == sim_random(0U, 1U));
+    if (frame->fdf)
+    {
+        frame->brs = (0U == sim_random(0U, 1U));
+        frame->dlc = (uint8_t)sim_random(0U, 15U);
+    }
+    else
+    {
+        frame->rtr = (0U == sim_random(0U, 9U));
+        frame->dlc = (uint8_t)sim_random(0U, 8U);
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_receive
+********************************************************************************
+* Summary:
+* Controller side of a frame received from the bus: stores it in RX FIFO 0
+* as a message RAM element, or drops it if the FIFO is full. Sets the
+* watermark flag and starts the timeout counter.
+*
+*******************************************************************************/
+static void sim_receive(const sim_frame_t *frame)
+{
+    uint32_t *element = sim_mram[sim_put];
+    uint8_t data[64] = { 0U };
+
+    sim_result.sent++;
+    if (SIM_FIFO_SIZE == sim_fill)
+    {
+        sim_result.lost++;
+        return;
+    }
+
+    element[0] = (frame->xtd ? (frame->id | RXDMA_R0_XTD) :
+                  (frame->id << RXDMA_R0_STD_ID_POS)) |
+                 (frame->rtr ? RXDMA_R0_RTR : 0U);
+    element[1] = (sim_now & RXDMA_R1_RXTS_MASK) |
+                 ((uint32_t)frame->dlc << RXDMA_R1_DLC_POS) |
+                 ((frame->seq & RXDMA_R1_FIDX_MASK) << RXDMA_R1_FIDX_POS) |
+                 (frame->fdf ? RXDMA_R1_FDF : 0U) |
+                 (frame->brs ? RXDMA_R1_BRS : 0U);
+    if (!frame->rtr)
+    {
+        for (uint32_t idx = 0U; idx < sim_dlc_len[frame->dlc]; idx++)
+        {
+            data[idx] = sim_payload(frame->seq, idx);
+        }
+    }
+    memcpy(&element[2], data, sizeof(data));
+
+    sim_stored[sim_stored_count] = *frame;
+    sim_stored[sim_stored_count].stored = sim_now;
+    sim_stored_count++;
+
+    sim_put = (sim_put + 1U) % SIM_FIFO_SIZE;
+    if (0U == sim_fill)
+    {
+        sim_timeout = RXDMA_FLUSH_BITS;
+        sim_timeout_running = true;
+    }
+    sim_fill++;
+    if (RXDMA_WATERMARK == sim_fill)
+    {
+        sim_ir_watermark = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_start
+********************************************************************************
+* Summary:
+* rxdma_can_start() against the model: sizes the transfer from the FIFO
+* status and starts the DMA.
+*
+*******************************************************************************/
+static bool sim_start(void)
+{
+    uint32_t count = rxdma_plan(&sim_ring, sim_get, sim_fill, SIM_FIFO_SIZE);
+    uint32_t cycles;
+
+    if (0U == count)
+    {
+        return false;
+    }
+
+    cycles = count * RXDMA_ELEMENT_WORDS * sim_dma_word_cycles;
+    sim_dma_busy = true;
+    sim_dma_src = sim_get;
+    sim_dma_count = count;
+    sim_dma_dst = rxdma_dest(&sim_ring);
+    sim_dma_done = sim_now + 1U + (cycles / SIM_BIT_CYCLES);
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_check
+********************************************************************************
+* Summary:
+* Receive function: compares an element from the ring with the next frame
+* stored in the FIFO.
+*
+*******************************************************************************/
+static void sim_check(const rxdma_element_t *element)
+{
+    const sim_frame_t *expected = &sim_stored[sim_result.delivered];
+    const uint8_t *data = (const uint8_t *)&element->words[2];
+    rxdma_header_t header;
+    bool match;
+
+    rxdma_header_decode(element, &header);
+    match = (sim_result.delivered < sim_stored_count) &&
+            (header.id == expected->id) && (header.xtd == expected->xtd) &&
+            (header.rtr == expected->rtr) && (header.fdf == expected->fdf) &&
+            (header.brs == expected->brs) && (header.dlc == expected->dlc) &&
+            (header.timestamp == (expected->stored & RXDMA_R1_RXTS_MASK)) &&
+            (header.filter == (expected->seq & RXDMA_R1_FIDX_MASK));
+    for (uint32_t idx = 0U; match && !expected->rtr &&
+         (idx < sim_dlc_len[header.dlc]); idx++)
+    {
+        match = (data[idx] == sim_payload(expected->seq, idx));
+    }
+
+    if (!match)
+    {
+        sim_result.mismatched++;
+    }
+    if ((sim_now - expected->stored) > sim_result.latency_max)
+    {
+        sim_result.latency_max = sim_now - expected->stored;
+    }
+    sim_result.delivered++;
+}
+
+/*******************************************************************************
+* Function Name: sim_finish
+********************************************************************************
+* Summary:
+* DMA interrupt against the model, as rxdma_can_finish(): acknowledges the
+* batch, starts the next one and processes the ring.
+*
+*******************************************************************************/
+static void sim_finish(void)
+{
+    uint32_t last = rxdma_complete(&sim_ring);
+    const rxdma_element_t *element;
+
+    /* Writing the acknowledge index frees all elements up to it. A
+     * transfer never wraps in the FIFO. */
+    sim_fill -= (last + 1U) - sim_get;
+    sim_get = (last + 1U) % SIM_FIFO_SIZE;
+    if (0U == sim_fill)
+    {
+        sim_timeout_running = false;
+    }
+
+    (void)sim_start();
+
+    while (NULL != (element = rxdma_peek(&sim_ring)))
+    {
+        sim_check(element);
+        rxdma_release(&sim_ring);
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_step
+********************************************************************************
+* Summary:
+* Advances the controller, the DMA and the interrupts by one bit time.
+*
+*******************************************************************************/
+static void sim_step(void)
+{
+    if (sim_timeout_running && (0U != sim_timeout))
+    {
+        sim_timeout--;
+        if (0U == sim_timeout)
+        {
+            sim_ir_timeout = true;
+        }
+    }
+
+    if (sim_dma_busy && ((int32_t)(sim_now - sim_dma_done) >= 0))
+    {
+        for (uint32_t idx = 0U; idx < sim_dma_count; idx++)
+        {
+            memcpy(sim_dma_dst[idx].words, sim_mram[sim_dma_src + idx],
+                   sizeof(sim_dma_dst[idx].words));
+        }
+        sim_dma_busy = false;
+        sim_result.interrupts++;
+        sim_finish();
+    }
+
+    if (sim_ir_watermark || sim_ir_timeout)
+    {
+        sim_ir_watermark = false;
+        sim_ir_timeout = false;
+        sim_result.interrupts++;
+        (void)sim_start();
+    }
+
+    sim_now++;
+}
+
+/*******************************************************************************
+* Function Name: sim_run
+********************************************************************************
+* Summary:
+* Runs one scenario until all frames are sent and the FIFO and the ring are
+* empty.
+*
+*******************************************************************************/
+static void sim_run(const sim_scenario_t *scenario)
+{
+    uint32_t seq = 0U;
+    uint32_t next = 0U;
+    uint32_t burst = 0U;
+
+    memset(sim_mram, 0, sizeof(sim_mram));
+    sim_put = 0U;
+    sim_get = 0U;
+    sim_fill = 0U;
+    sim_ir_watermark = false;
+    sim_ir_timeout = false;
+    sim_timeout_running = false;
+    sim_dma_busy = false;
+    sim_stored_count = 0U;
+    sim_now = 0U;
+    sim_dma_word_cycles = scenario->dma_word_cycles;
+    sim_result = (sim_result_t){ 0 };
+    rxdma_init(&sim_ring);
+
+    while (((seq < scenario->frames) || (0U != sim_fill) || sim_dma_busy) &&
+           (sim_now < SIM_STEPS_MAX))
+    {
+        if ((seq < scenario->frames) && (sim_now == next))
+        {
+            sim_frame_t frame;
+
+            sim_frame_new(scenario->traffic, seq, &frame);
+            sim_receive(&frame);
+            seq++;
+
+            /* Frames of a burst follow at the shortest gap */
+            if (0U == burst)
+            {
+                burst = sim_random(1U, scenario->burst);
+            }
+            burst--;
+            next = sim_now + ((0U != burst) ? scenario->gap_min :
+                              sim_random(scenario->gap_min,
+                                         scenario->gap_max));
+        }
+        sim_step();
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs the scenarios. Every frame stored in the FIFO must reach the ring
+* once, in order and unchanged, and every frame sent must be either
+* delivered or counted as lost. Frames are only lost when the DMA stalls.
+*
+*******************************************************************************/
+int main(void)
+{
+    int result = 0;
+
+    srand(1U);
+    printf("RX FIFO 0 of %u elements, watermark %u, flush after %u bit "
+           "times, ring of %u\n", (unsigned)SIM_FIFO_SIZE,
+           (unsigned)RXDMA_WATERMARK, (unsigned)RXDMA_FLUSH_BITS,
+           (unsigned)RXDMA_RING_SLOTS);
+    printf("  %-22s %6s %6s %6s %6s %9s %9s %8s  %s\n", "scenario", "sent",
+           "lost", "moved", "wrong", "transfers", "IRQ/frame", "latency",
+           "");
+
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(sim_scenarios) / sizeof(sim_scenarios[0]));
+         idx++)
+    {
+        const sim_scenario_t *scenario = &sim_scenarios[idx];
+        const sim_result_t *r = &sim_result;
+        bool ok;
+
+        sim_run(scenario);
+        ok = (0U == r->mismatched) && (r->sent == scenario->frames) &&
+             ((r->delivered + r->lost) == r->sent) &&
+             (r->delivered == sim_stored_count) &&
+             ((0U != r->lost) == scenario->loss_expected);
+
+        /* Without a stall, no frame waits much longer than the flush
+         * timeout */
+        if (!scenario->loss_expected)
+        {
+            ok = ok && (r->latency_max <= (RXDMA_FLUSH_BITS + 4U));
+        }
+
+        printf("  %-22s %6lu %6lu %6lu %6lu %9lu %9.2f %8lu  %s\n",
+               scenario->name, (unsigned long)r->sent,
+               (unsigned long)r->lost, (unsigned long)r->delivered,
+               (unsigned long)r->mismatched,
+               (unsigned long)sim_ring.stats.transfers,
+               (double)r->interrupts / (double)r->delivered,
+               (unsigned long)r->latency_max, ok ? "ok" : "FAIL");
+        if (!ok)
+        {
+            result = 1;
+        }
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
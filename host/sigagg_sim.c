@@ -0,0 +1,333 @@
+/******************************************************************************
+* File Name:   sigagg_sim.c
+*
+* Description: This file contains the host check of the window summaries
+*              against a double precision reference, and their bus load
+*              against raw samples.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "sigagg.h"
+#include "txfmt.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Simulated time per signal */
+#define SIM_DURATION_MS         (10000U)
+
+/* Largest relative error of the mean and the variance against a double
+ * precision two-pass reference */
+#define SIM_TOLERANCE           (1.0e-6)
+
+/* A raw sample goes on the bus as a classic frame of this many bytes */
+#define SIM_RAW_LEN             (2U)
+
+#define SIM_PI                  (3.14159265358979323846)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef enum
+{
+    SIM_DRIFT,                      /* Large offset, slow drift, small noise */
+    SIM_SINE,                       /* Near full scale */
+    SIM_STEPS,                      /* Jumps between two levels */
+    SIM_CONSTANT
+} sim_shape_t;
+
+typedef struct
+{
+    const char *name;
+    sim_shape_t shape;
+    uint32_t rate_hz;
+    uint32_t window_ms;
+} sim_signal_t;
+
+typedef struct
+{
+    uint32_t windows;
+    uint32_t failed;                /* Windows off the reference */
+    double mean_err;                /* Largest relative errors */
+    double var_err;
+    double float_var_err;           /* Same, with single precision sums */
+} sim_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const sim_signal_t sim_signals[] =
+{
+    { "drift 1 kHz",        SIM_DRIFT,      1000U,   100U },
+    { "drift 10 kHz",       SIM_DRIFT,      10000U,  100U },
+    { "sine 10 kHz",        SIM_SINE,       10000U,  100U },
+    { "steps 1 kHz",        SIM_STEPS,      1000U,   100U },
+    { "constant 1 kHz",     SIM_CONSTANT,   1000U,   100U },
+    { "sine 100 kHz, 1 s",  SIM_SINE,       100000U, 1000U },
+};
+
+static uint64_t sim_rng = 0x9E3779B97F4A7C15ULL;
+
+/*******************************************************************************
+* Function Name: sim_random
+********************************************************************************
+* Summary:
+* Returns a uniform random number in [0, 1) (xorshift64*).
+*
+*******************************************************************************/
+static double sim_random(void)
+{
+    sim_rng ^= sim_rng >> 12;
+    sim_rng ^= sim_rng << 25;
+    sim_rng ^= sim_rng >> 27;
+    return (double)((sim_rng * 0x2545F4914F6CDD1DULL) >> 11) /
+           9007199254740992.0;
+}
+
+/*******************************************************************************
+* Function Name: sim_sample
+********************************************************************************
+* Summary:
+* Returns sample n of a signal.
+*
+*******************************************************************************/
+static int32_t sim_sample(const sim_signal_t *signal, uint32_t n)
+{
+    double t = (double)n / (double)signal->rate_hz;
+    double noise = (sim_random() - 0.5) * 8.0;
+
+    switch (signal->shape)
+    {
+        case SIM_DRIFT:
+            return (int32_t)lround(20000.0 + (500.0 * sin(t * 0.3)) + noise);
+        case SIM_SINE:
+            return (int32_t)lround(32000.0 * sin(2.0 * SIM_PI * 50.0 * t) +
+                                   noise);
+        case SIM_STEPS:
+            return ((n / 37U) & 1U) ? 1200 : -800;
+        default:
+            return 1234;
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_rel_err
+********************************************************************************
+* Summary:
+* Returns the error of a value relative to the reference, or the absolute
+* error for a reference of 0.
+*
+*******************************************************************************/
+static double sim_rel_err(double value, double ref)
+{
+    return (0.0 == ref) ? fabs(value) : fabs(value - ref) / fabs(ref);
+}
+
+/*******************************************************************************
+* Function Name: sim_check
+********************************************************************************
+* Summary:
+* Compares the summary of a window with the double precision two-pass
+* mean and sample variance of its samples, and with a single precision
+* sum of squares as the summary would have without exact sums.
+*
+*******************************************************************************/
+static void sim_check(const int32_t *samples, uint32_t count,
+                      const sigagg_summary_t *summary, sim_result_t *result)
+{
+    double mean = 0.0;
+    double var = 0.0;
+    float float_sum = 0.0f;
+    float float_sum_sq = 0.0f;
+    float float_var;
+    int32_t min = samples[0];
+    int32_t max = samples[0];
+    double mean_err;
+    double var_err;
+
+    for (uint32_t idx = 0U; idx < count; idx++)
+    {
+        mean += (double)samples[idx];
+        min = (samples[idx] < min) ? samples[idx] : min;
+        max = (samples[idx] > max) ? samples[idx] : max;
+        float_sum += (float)samples[idx];
+        float_sum_sq += (float)samples[idx] * (float)samples[idx];
+    }
+    mean /= (double)count;
+    for (uint32_t idx = 0U; idx < count; idx++)
+    {
+        var += ((double)samples[idx] - mean) * ((double)samples[idx] - mean);
+    }
+    var /= (double)(count - 1U);
+    float_var = (float_sum_sq - (float_sum * float_sum / (float)count)) /
+                (float)(count - 1U);
+
+    mean_err = sim_rel_err(summary->mean, mean);
+    var_err = sim_rel_err(summary->variance, var);
+    result->windows++;
+    result->mean_err = fmax(result->mean_err, mean_err);
+    result->var_err = fmax(result->var_err, var_err);
+    result->float_var_err = fmax(result->float_var_err,
+                                 sim_rel_err(float_var, var));
+    if ((summary->count != count) || (summary->min != min) ||
+        (summary->max != max) || (mean_err > SIM_TOLERANCE) ||
+        (var_err > SIM_TOLERANCE))
+    {
+        result->failed++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_run
+********************************************************************************
+* Summary:
+* Runs a signal through sigagg.c window by window, the way sigagg_can.c
+* does, and checks every summary. A window with more than
+* SIGAGG_COUNT_MAX samples closes early. The summaries go through
+* sigagg_pack() and sigagg_unpack() as on the bus.
+*
+*******************************************************************************/
+static void sim_run(const sim_signal_t *signal, sim_result_t *result)
+{
+    static int32_t samples[SIGAGG_COUNT_MAX];
+    uint32_t total = (uint32_t)(((uint64_t)signal->rate_hz * SIM_DURATION_MS) /
+                                1000U);
+    uint32_t per_window = (uint32_t)(((uint64_t)signal->rate_hz *
+                                      signal->window_ms) / 1000U);
+    sigagg_acc_t acc;
+    uint32_t count = 0U;
+    uint8_t seq = 0U;
+
+    memset(result, 0, sizeof(*result));
+    sigagg_reset(&acc);
+
+    for (uint32_t n = 0U; n < total; n++)
+    {
+        int32_t sample = sim_sample(signal, n);
+        bool full = sigagg_add(&acc, sample);
+
+        samples[count] = sample;
+        count++;
+        if (full || (count == per_window) || (n == (total - 1U)))
+        {
+            sigagg_summary_t summary;
+            uint8_t data[SIGAGG_SUMMARY_LEN];
+
+            if (sigagg_summarize(&acc, seq, &summary))
+            {
+                sigagg_pack(&summary, data);
+                sigagg_unpack(data, &summary);
+                sim_check(samples, count, &summary, result);
+                if (summary.seq != seq)
+                {
+                    result->failed++;
+                }
+            }
+            seq++;
+            count = 0U;
+            per_window = (uint32_t)(((uint64_t)signal->rate_hz *
+                                     signal->window_ms) / 1000U);
+            sigagg_reset(&acc);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs each signal, prints the largest errors of the summaries and the bus
+* load of the summaries against one classic frame per sample. Fails if a
+* summary is off its reference.
+*
+*******************************************************************************/
+int main(void)
+{
+    const txfmt_rates_t rates = { TXFMT_NOMINAL_BPS, TXFMT_DATA_BPS };
+    double raw_ns = (double)txfmt_frame_ns(&rates, TXFMT_CLASSIC, SIM_RAW_LEN,
+                                           false);
+    double summary_ns = (double)txfmt_frame_ns(&rates, TXFMT_FD_BRS,
+                                               SIGAGG_SUMMARY_LEN, false);
+    int result = 0;
+
+    printf("Nominal %lu kbit/s, data %lu kbit/s, %u s per signal; raw: "
+           "%u-byte classic frame per sample, summary: %u-byte FD frame\n",
+           (unsigned long)(TXFMT_NOMINAL_BPS / 1000UL),
+           (unsigned long)(TXFMT_DATA_BPS / 1000UL),
+           (unsigned)(SIM_DURATION_MS / 1000U), (unsigned)SIM_RAW_LEN,
+           (unsigned)SIGAGG_SUMMARY_LEN);
+    printf("  %-18s %7s %9s %9s %9s %9s %9s %8s\n", "signal", "windows",
+           "mean err", "var err", "float var", "raw load", "sum load",
+           "saved");
+
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(sim_signals) / sizeof(sim_signals[0]));
+         idx++)
+    {
+        const sim_signal_t *signal = &sim_signals[idx];
+        double duration_ns = (double)SIM_DURATION_MS * 1.0e6;
+        double raw_load;
+        double summary_load;
+        sim_result_t run;
+
+        sim_run(signal, &run);
+        raw_load = 100.0 * raw_ns * (double)signal->rate_hz *
+                   ((double)SIM_DURATION_MS / 1000.0) / duration_ns;
+        summary_load = 100.0 * summary_ns * (double)run.windows / duration_ns;
+
+        /* A raw load above 100% does not fit on the bus at all */
+        printf("  %-18s %7lu %9.1e %9.1e %9.1e %8.1f%% %8.3f%% %7.1fx  %s\n",
+               signal->name, (unsigned long)run.windows, run.mean_err,
+               run.var_err, run.float_var_err, raw_load, summary_load,
+               raw_load / summary_load, (0U == run.failed) ? "ok" : "FAIL");
+        if (0U != run.failed)
+        {
+            result = 1;
+        }
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
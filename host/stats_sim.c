@@ -0,0 +1,289 @@
+/******************************************************************************
+* File Name:   stats_sim.c
+*
+* Description: This file contains the host check of the frames the statistics
+*              registry is sent in.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "stats.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Node of the registry check; its snapshots go on STATS_CAN_BASE_ID + node */
+#define SIM_NODE                (3U)
+
+/* Values of the encoder check: more than fit in one frame, so that every
+ * count of values in a frame, and with it every padding, comes up */
+#define SIM_VALUES              (40U)
+
+/* Byte the frames are filled with before an encode, to see which bytes the
+ * encode cleared */
+#define SIM_FILL                (0xA5U)
+
+/* Frames of one snapshot of the registry */
+#define SIM_FRAMES                                                             \
+    ((STATS_COUNT + STATS_CAN_VALUES - 1U) / STATS_CAN_VALUES)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Cycle counter rate of the PDL stub, which stats.c times snapshots with */
+uint32_t SystemCoreClock = 1000000000UL;
+
+/* Frames taken by the TX buffer, and whether it refuses the next ones */
+static canfd_frame_t sim_frames[SIM_FRAMES];
+static uint32_t sim_sent;
+static bool sim_busy;
+
+/*******************************************************************************
+* Function Name: sim_report
+********************************************************************************
+* Summary:
+* Prints the result of one check.
+*
+*******************************************************************************/
+static bool sim_report(const char *name, bool ok)
+{
+    printf("  %-28s %s\n", name, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: sim_send
+********************************************************************************
+* Summary:
+* Frame transmit function: keeps the frame, unless the TX buffer is busy or
+* more frames come than a snapshot has.
+*
+*******************************************************************************/
+static bool sim_send(const canfd_frame_t *frame)
+{
+    if (sim_busy || (sim_sent >= SIM_FRAMES))
+    {
+        return false;
+    }
+    sim_frames[sim_sent++] = *frame;
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_value
+********************************************************************************
+* Summary:
+* Returns the test value of an index, with four different bytes so that a
+* wrong byte order shows.
+*
+*******************************************************************************/
+static uint32_t sim_value(uint32_t idx)
+{
+    return (0x01010101UL * (idx + 1U)) + 0x00102030UL;
+}
+
+/*******************************************************************************
+* Function Name: sim_check_frame
+********************************************************************************
+* Summary:
+* Checks one snapshot frame: the header, the values as little-endian words,
+* a length that is the smallest the DLC codes for them, and zeros after the
+* values.
+*
+*******************************************************************************/
+static bool sim_check_frame(const canfd_frame_t *frame, uint8_t seq,
+                            const uint32_t *values, uint32_t first,
+                            uint32_t total)
+{
+    uint32_t count = total - first;
+    uint32_t used;
+    bool ok;
+
+    count = (count > STATS_CAN_VALUES) ? STATS_CAN_VALUES : count;
+    used = STATS_CAN_HEADER_LEN + (count * 4U);
+
+    ok = (canfd_dlc_to_len(canfd_len_to_dlc(used)) == frame->len) &&
+         ((CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS) == frame->flags) &&
+         (seq == frame->data[0]) && (first == frame->data[1]) &&
+         (count == frame->data[2]) && (total == frame->data[3]);
+
+    for (uint32_t idx = 0U; idx < count; idx++)
+    {
+        const uint8_t *in = &frame->data[STATS_CAN_HEADER_LEN + (idx * 4U)];
+        uint32_t value = (uint32_t)in[0] | ((uint32_t)in[1] << 8U) |
+                         ((uint32_t)in[2] << 16U) | ((uint32_t)in[3] << 24U);
+
+        ok = ok && (values[first + idx] == value);
+    }
+    for (uint32_t idx = used; idx < CANFD_MAX_DATA_LEN; idx++)
+    {
+        ok = ok && (0U == frame->data[idx]);
+    }
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: sim_check_encode
+********************************************************************************
+* Summary:
+* Encodes a snapshot of SIM_VALUES values from every index on, so each count
+* of values in a frame, from a full frame to a single value, is checked.
+* Fails unless some of the lengths needed padding.
+*
+*******************************************************************************/
+static bool sim_check_encode(void)
+{
+    uint32_t values[SIM_VALUES];
+    uint32_t padded = 0U;
+    bool ok = true;
+
+    for (uint32_t idx = 0U; idx < SIM_VALUES; idx++)
+    {
+        values[idx] = sim_value(idx);
+    }
+
+    for (uint32_t first = 0U; first < SIM_VALUES; first++)
+    {
+        canfd_frame_t frame;
+        uint32_t count;
+
+        memset(&frame, SIM_FILL, sizeof(frame));
+        count = stats_encode(&frame, 0x5AU, values, first, SIM_VALUES);
+        ok = ok && (count == frame.data[2]) &&
+             sim_check_frame(&frame, 0x5AU, values, first, SIM_VALUES);
+        if (frame.len > (STATS_CAN_HEADER_LEN + (count * 4U)))
+        {
+            padded++;
+        }
+    }
+
+    return sim_report("encoder, 1 to 15 values", ok && (0U != padded));
+}
+
+/*******************************************************************************
+* Function Name: sim_check_registry
+********************************************************************************
+* Summary:
+* Fills the registry with test values and runs stats_poll() as the main loop
+* does: a snapshot is due every STATS_CAN_PERIOD_MS and goes out one frame
+* per pass. The TX buffer refuses the first frame, which must be sent again.
+* A snapshot due while the previous one is still going out must be skipped
+* and counted.
+*
+*******************************************************************************/
+static bool sim_check_registry(void)
+{
+    uint32_t expected[STATS_COUNT];
+    uint32_t now = 0U;
+    bool sent_ok;
+    bool skip_ok;
+
+    stats_init(SIM_NODE, sim_send, now);
+    for (uint32_t idx = 0U; idx < (uint32_t)STATS_COUNT; idx++)
+    {
+        stats_values[idx] = sim_value(idx);
+        expected[idx] = sim_value(idx);
+    }
+
+    /* Snapshot 1: the first frame is refused, then one frame per pass, and
+     * nothing once the snapshot is out */
+    now += STATS_CAN_PERIOD_MS;
+    expected[STATS_UPTIME_MS] = now;
+    sim_sent = 0U;
+    sim_busy = true;
+    stats_poll(now);
+    sent_ok = (0U == sim_sent);
+    sim_busy = false;
+    for (uint32_t pass = 0U; pass <= SIM_FRAMES; pass++)
+    {
+        stats_poll(now);
+        sent_ok = sent_ok && (sim_sent == ((pass < SIM_FRAMES) ?
+                                           (pass + 1U) : SIM_FRAMES));
+    }
+    for (uint32_t frame = 0U; frame < SIM_FRAMES; frame++)
+    {
+        sent_ok = sent_ok &&
+                  ((STATS_CAN_BASE_ID + SIM_NODE) == sim_frames[frame].id) &&
+                  sim_check_frame(&sim_frames[frame], 1U, expected,
+                                  frame * STATS_CAN_VALUES, STATS_COUNT);
+    }
+
+    /* Snapshot 2 stays in the TX buffer past the time of snapshot 3 */
+    sim_sent = 0U;
+    sim_busy = true;
+    stats_poll(now + STATS_CAN_PERIOD_MS);
+    stats_poll(now + (2U * STATS_CAN_PERIOD_MS));
+    sim_busy = false;
+    stats_poll(now + (2U * STATS_CAN_PERIOD_MS));
+    skip_ok = ((sim_value(STATS_EXPORT_SKIPPED) + 1U) ==
+               stats_values[STATS_EXPORT_SKIPPED]) &&
+              (1U == sim_sent) && (2U == sim_frames[0].data[0]) &&
+              (0U == sim_frames[0].data[1]);
+
+    sent_ok = sim_report("registry snapshot", sent_ok);
+    skip_ok = sim_report("snapshot due while sending", skip_ok);
+    return sent_ok && skip_ok;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Checks the snapshot frames of the statistics registry: the encoder for
+* every count of values in a frame, then the registry sent by stats_poll().
+* Fails on a wrong header, value, byte order, length or padding byte, or if
+* a refused frame or a skipped snapshot is lost.
+*
+*******************************************************************************/
+int main(void)
+{
+    int result = 0;
+
+    printf("Statistics frame checks, %u registry entries\n",
+           (unsigned)STATS_COUNT);
+    result |= sim_check_encode() ? 0 : 1;
+    result |= sim_check_registry() ? 0 : 1;
+
+    return result;
+}
+
+/* [] END OF FILE */
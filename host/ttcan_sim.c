@@ -0,0 +1,684 @@
+/******************************************************************************
+* File Name:   ttcan_sim.c
+*
+* Description: Bus simulator of the time-triggered schedule: validates the
+*              system matrix, runs the compiled trigger lists of both nodes
+*              and compares their jitter with event-triggered sending.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ttcan.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SIM_NODES               (2U)
+
+/* Basic cycles simulated per scenario */
+#define SIM_CYCLES              (4000U)
+
+/* Rate error of the node 2 oscillator against the time master, in ppm.
+ * Level 1 does not correct it; the reference message only restarts the
+ * cycle time. */
+#define SIM_DRIFT_PPM           (150.0)
+
+/* Delay from the time an event-triggered frame is due to the time the main
+ * loop hands it to the controller: up to one pass of the loop */
+#define SIM_LOOP_NS             (300000.0)
+
+/* Background frames: a node keeps one pending, the next one is due an
+ * exponential time after it was sent */
+#define SIM_BACKGROUND_SOURCES  (3U)
+#define SIM_BACKGROUND_GAP_NS   (1500000.0)
+
+/* Periodic frames of the jitter comparison */
+#define SIM_PERIOD_NS           ((double)TTCAN_CYCLE_NTU * TTCAN_NTU_NS)
+#define SIM_PROBE_ID            (0x09EU)
+#define SIM_PROBE_LEN           (8U)
+
+#define SIM_NOMINAL_NS          (1.0e9 / TTCAN_NOMINAL_BPS)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* A frame waiting for the bus */
+typedef struct
+{
+    bool     pending;
+    double   due_ns;
+    uint32_t id;
+    uint8_t  len;
+} sim_frame_t;
+
+/* Start times of a periodic stream and their deviation from the period */
+typedef struct
+{
+    const char    *name;
+    bool           started;
+    double         last_ns;
+    ttcan_jitter_t jitter;
+} sim_stream_t;
+
+/* System matrix expected to fail validation */
+typedef struct
+{
+    const char    *name;
+    ttcan_window_t windows[2];
+    uint8_t        count;
+    uint8_t        cycles;
+    ttcan_error_t  expected;
+} sim_bad_matrix_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const sim_bad_matrix_t sim_bad_matrices[] =
+{
+    { "three cycles",
+      { { "A", 400U, 300U, 0x090U, TTCAN_WINDOW_EXCLUSIVE, 1U, 0U, 1U, 8U } },
+      1U, 3U, TTCAN_ERROR_CYCLES },
+    { "offset past repeat",
+      { { "A", 400U, 300U, 0x090U, TTCAN_WINDOW_EXCLUSIVE, 2U, 2U, 1U, 8U } },
+      1U, 4U, TTCAN_ERROR_REPEAT },
+    { "over the reference",
+      { { "A", 50U, 300U, 0x090U, TTCAN_WINDOW_EXCLUSIVE, 1U, 0U, 1U, 8U } },
+      1U, 4U, TTCAN_ERROR_BOUNDS },
+    { "past the cycle end",
+      { { "A", 4800U, 300U, 0x090U, TTCAN_WINDOW_EXCLUSIVE, 1U, 0U, 1U, 8U } },
+      1U, 4U, TTCAN_ERROR_BOUNDS },
+    { "64 bytes in 200 NTU",
+      { { "A", 400U, 200U, 0x090U, TTCAN_WINDOW_EXCLUSIVE, 1U, 0U, 1U, 64U } },
+      1U, 4U, TTCAN_ERROR_LENGTH },
+    { "overlap in cycle 2",
+      { { "A", 400U, 300U, 0x090U, TTCAN_WINDOW_EXCLUSIVE, 2U, 0U, 1U, 8U },
+        { "B", 600U, 300U, 0x091U, TTCAN_WINDOW_EXCLUSIVE, 4U, 2U, 2U, 8U } },
+      2U, 4U, TTCAN_ERROR_OVERLAP },
+    { "no sender",
+      { { "A", 400U, 300U, 0x090U, TTCAN_WINDOW_EXCLUSIVE, 1U, 0U, 0U, 8U } },
+      1U, 4U, TTCAN_ERROR_NODE },
+};
+
+static ttcan_schedule_t sim_schedule[SIM_NODES];
+
+/* Bus state */
+static double       sim_bus_free_ns;
+static double       sim_busy_ns;
+static sim_frame_t  sim_background[SIM_BACKGROUND_SOURCES];
+
+/* Schedule checks */
+static uint32_t     sim_late;           /* Started after the TX enable window */
+static uint32_t     sim_overrun;        /* Ran past the end of the window */
+static uint32_t     sim_tt_frames;
+
+/*******************************************************************************
+* Function Name: sim_uniform
+********************************************************************************
+* Summary:
+* Returns a random number from 0 up to but not including 1.
+*
+*******************************************************************************/
+static double sim_uniform(void)
+{
+    return (double)rand() / ((double)RAND_MAX + 1.0);
+}
+
+/*******************************************************************************
+* Function Name: sim_frame_time
+********************************************************************************
+* Summary:
+* Returns the time of a CAN FD frame on the bus: the worst case of the
+* schedule compiler less a random part of the stuff bits it allows for.
+*
+*******************************************************************************/
+static double sim_frame_time(uint8_t len, bool fd)
+{
+    double worst = (double)ttcan_frame_ns(len, fd);
+
+    return worst * (0.88 + (0.12 * sim_uniform()));
+}
+
+/*******************************************************************************
+* Function Name: sim_stream_add
+********************************************************************************
+* Summary:
+* Records the start time of a frame of a periodic stream.
+*
+*******************************************************************************/
+static void sim_stream_add(sim_stream_t *stream, double start_ns,
+                           double period_ns)
+{
+    if (stream->started)
+    {
+        ttcan_jitter_add(&stream->jitter,
+                         (int32_t)(start_ns - stream->last_ns - period_ns));
+    }
+    stream->started = true;
+    stream->last_ns = start_ns;
+}
+
+/*******************************************************************************
+* Function Name: sim_background_next
+********************************************************************************
+* Summary:
+* Makes the next background frame of a source due some time after now.
+*
+*******************************************************************************/
+static void sim_background_next(sim_frame_t *frame, double now_ns)
+{
+    static const uint8_t lengths[] = { 8U, 16U, 32U, 64U };
+
+    frame->pending = true;
+    frame->due_ns = now_ns - (SIM_BACKGROUND_GAP_NS *
+                              log(1.0 - sim_uniform()));
+    frame->id = 0x010U + (uint32_t)(rand() % 0x7F0);
+    frame->len = lengths[rand() % 4];
+}
+
+/*******************************************************************************
+* Function Name: sim_send_event
+********************************************************************************
+* Summary:
+* Sends all frames due before an end time on an event-triggered bus: when
+* the bus goes idle, the lowest ID of the frames due wins arbitration.
+* Returns the start time of the probe frame, or a negative time if it was
+* not sent.
+*
+*******************************************************************************/
+static double sim_send_event(sim_frame_t *probe, double end_ns)
+{
+    double probe_start = -1.0;
+
+    for (;;)
+    {
+        sim_frame_t *winner = NULL;
+        double first = end_ns;
+        double duration;
+
+        /* The bus is idle until the first frame is due */
+        if (probe->pending && (probe->due_ns < first))
+        {
+            first = probe->due_ns;
+        }
+        for (uint32_t src = 0U; src < SIM_BACKGROUND_SOURCES; src++)
+        {
+            if (sim_background[src].due_ns < first)
+            {
+                first = sim_background[src].due_ns;
+            }
+        }
+        if (first >= end_ns)
+        {
+            break;
+        }
+        if (first > sim_bus_free_ns)
+        {
+            sim_bus_free_ns = first;
+        }
+
+        if (probe->pending && (probe->due_ns <= sim_bus_free_ns))
+        {
+            winner = probe;
+        }
+        for (uint32_t src = 0U; src < SIM_BACKGROUND_SOURCES; src++)
+        {
+            sim_frame_t *frame = &sim_background[src];
+
+            if ((frame->due_ns <= sim_bus_free_ns) &&
+                ((NULL == winner) || (frame->id < winner->id)))
+            {
+                winner = frame;
+            }
+        }
+
+        if (winner == probe)
+        {
+            probe_start = sim_bus_free_ns;
+            probe->pending = false;
+        }
+        duration = sim_frame_time(winner->len, true);
+        sim_bus_free_ns += duration;
+        sim_busy_ns += duration;
+        if (winner != probe)
+        {
+            sim_background_next(winner, sim_bus_free_ns);
+        }
+    }
+
+    return probe_start;
+}
+
+/*******************************************************************************
+* Function Name: sim_event_triggered
+********************************************************************************
+* Summary:
+* Sends the control frame of node 1 from the main loop once per period on
+* an event-triggered bus with background traffic.
+*
+*******************************************************************************/
+static void sim_event_triggered(sim_stream_t *stream)
+{
+    sim_frame_t probe = { false, 0.0, 0x090U, 8U };
+
+    sim_bus_free_ns = 0.0;
+    for (uint32_t src = 0U; src < SIM_BACKGROUND_SOURCES; src++)
+    {
+        sim_background_next(&sim_background[src], 0.0);
+    }
+
+    for (uint32_t cycle = 0U; cycle < SIM_CYCLES; cycle++)
+    {
+        double start;
+
+        probe.pending = true;
+        probe.due_ns = (cycle * SIM_PERIOD_NS) + (SIM_LOOP_NS * sim_uniform());
+        start = sim_send_event(&probe, (cycle + 1U) * SIM_PERIOD_NS);
+        if (start >= 0.0)
+        {
+            sim_stream_add(stream, start, SIM_PERIOD_NS);
+        }
+        else
+        {
+            /* Sent in the next period: the interval is not a period */
+            stream->started = false;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_time_triggered
+********************************************************************************
+* Summary:
+* Runs the compiled trigger lists of both nodes. Node 1 is the time master
+* and runs on the reference clock; the cycle time of node 2 runs fast by
+* SIM_DRIFT_PPM. A frame starts at the first bit time after its time mark
+* once the bus is idle; starting after the TX enable window or running past
+* the end of the window is counted against the schedule. The arbitrating
+* windows carry the probe frame of node 2 and the background frames of
+* node 1, which arrive as on the event-triggered bus.
+*
+*******************************************************************************/
+static void sim_time_triggered(sim_stream_t *tt_master, sim_stream_t *tt_slave,
+                               sim_stream_t *et_window)
+{
+    const double ntu[SIM_NODES] =
+    {
+        TTCAN_NTU_NS, TTCAN_NTU_NS / (1.0 + (SIM_DRIFT_PPM * 1e-6))
+    };
+    sim_frame_t probe = { false, 0.0, SIM_PROBE_ID, SIM_PROBE_LEN };
+    sim_frame_t *background = &sim_background[0];
+    double ref_ns = 0.0;
+    double next_probe_ns = 0.0;
+
+    sim_bus_free_ns = 0.0;
+    sim_background_next(background, 0.0);
+
+    for (uint32_t cycle = 0U; cycle < SIM_CYCLES; cycle++)
+    {
+        uint32_t count = cycle % TTCAN_MATRIX_CYCLES;
+        uint32_t next[SIM_NODES] = { 0U, 0U };
+
+        /* Reference message of the time master; the cycle starts with it */
+        sim_bus_free_ns = ref_ns + sim_frame_time(TTCAN_REF_LEN, false);
+
+        /* Walk the two trigger lists in time order */
+        for (;;)
+        {
+            const ttcan_trigger_t *trigger = NULL;
+            uint32_t node = 0U;
+            double due = 0.0;
+
+            for (uint32_t idx = 0U; idx < SIM_NODES; idx++)
+            {
+                const ttcan_schedule_t *schedule = &sim_schedule[idx];
+
+                while (next[idx] < schedule->count)
+                {
+                    const ttcan_trigger_t *t =
+                        &schedule->triggers[next[idx]];
+                    uint32_t repeat = 1U;
+
+                    while ((repeat * 2U) <= t->cycle_code)
+                    {
+                        repeat *= 2U;
+                    }
+                    if ((t->time_mark < TTCAN_CYCLE_NTU) &&
+                        ((count % repeat) == (t->cycle_code - repeat)))
+                    {
+                        break;
+                    }
+                    next[idx]++;
+                }
+                if (next[idx] < schedule->count)
+                {
+                    double t_ns = ref_ns + (ntu[idx] *
+                        schedule->triggers[next[idx]].time_mark);
+
+                    if ((NULL == trigger) || (t_ns < due))
+                    {
+                        trigger = &schedule->triggers[next[idx]];
+                        node = idx;
+                        due = t_ns;
+                    }
+                }
+            }
+            if (NULL == trigger)
+            {
+                break;
+            }
+            next[node]++;
+
+            /* Main loop: the probe and the background frames become
+             * pending in buffer 0 as they fall due */
+            while (next_probe_ns <= due)
+            {
+                probe.pending = true;
+                probe.due_ns = next_probe_ns + (SIM_LOOP_NS * sim_uniform());
+                next_probe_ns += SIM_PERIOD_NS;
+            }
+
+            if (TTCAN_TRIGGER_TX_ARBITRATION == trigger->type)
+            {
+                /* Both nodes fire the same window; let node 1's trigger run
+                 * the arbitration of both */
+                sim_frame_t *winner = NULL;
+                double start;
+
+                if (0U != node)
+                {
+                    continue;
+                }
+                if (probe.pending && (probe.due_ns <= due))
+                {
+                    winner = &probe;
+                }
+                if (background->due_ns <= due)
+                {
+                    if ((NULL == winner) || (background->id < winner->id))
+                    {
+                        winner = background;
+                    }
+                }
+                if (NULL == winner)
+                {
+                    continue;
+                }
+
+                start = (sim_bus_free_ns > due) ? sim_bus_free_ns : due;
+                start += SIM_NOMINAL_NS * sim_uniform();
+                sim_bus_free_ns = start + sim_frame_time(winner->len, true);
+                if (winner == &probe)
+                {
+                    probe.pending = false;
+                    sim_stream_add(et_window, start, SIM_PERIOD_NS);
+                }
+                else
+                {
+                    sim_background_next(background, sim_bus_free_ns);
+                }
+            }
+            else if (TTCAN_TRIGGER_TX_SINGLE == trigger->type)
+            {
+                const ttcan_window_t *w = NULL;
+                double start;
+
+                for (uint32_t idx = 0U; idx < ttcan_matrix.count; idx++)
+                {
+                    if (sim_schedule[node].window_buffer[idx] ==
+                        (int8_t)trigger->buffer)
+                    {
+                        w = &ttcan_matrix.windows[idx];
+                    }
+                }
+
+                start = (sim_bus_free_ns > due) ? sim_bus_free_ns : due;
+                start += SIM_NOMINAL_NS * sim_uniform();
+                if (start > (due + (ntu[node] * TTCAN_TX_ENABLE_NTU)))
+                {
+                    sim_late++;
+                }
+                sim_bus_free_ns = start + sim_frame_time(w->len, true);
+                if (sim_bus_free_ns >
+                    (ref_ns + (ntu[node] * ((double)w->start + w->length))))
+                {
+                    sim_overrun++;
+                }
+                sim_tt_frames++;
+
+                if ((0U == node) && (w == &ttcan_matrix.windows[
+                                         TTCAN_WINDOW_CTRL_1]))
+                {
+                    sim_stream_add(tt_master, start, SIM_PERIOD_NS);
+                }
+                else if (w == &ttcan_matrix.windows[TTCAN_WINDOW_CTRL_2])
+                {
+                    sim_stream_add(tt_slave, start, SIM_PERIOD_NS);
+                }
+            }
+        }
+
+        /* Reference trigger of the master at the end of the cycle; the
+         * frame starts at the next bit time */
+        ref_ns += (TTCAN_CYCLE_NTU * ntu[0]) + (SIM_NOMINAL_NS * sim_uniform());
+        if (sim_bus_free_ns > ref_ns)
+        {
+            sim_overrun++;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_print_schedule
+********************************************************************************
+* Summary:
+* Prints the trigger list of a node with the trigger memory words.
+*
+*******************************************************************************/
+static void sim_print_schedule(uint32_t node, const ttcan_schedule_t *schedule)
+{
+    static const char *const types[] =
+    {
+        [TTCAN_TRIGGER_TX_REF] = "Tx_Ref_Trigger",
+        [TTCAN_TRIGGER_TX_SINGLE] = "Tx_Trigger_Single",
+        [TTCAN_TRIGGER_TX_ARBITRATION] = "Tx_Trigger_Arbitration",
+        [TTCAN_TRIGGER_WATCH] = "Watch_Trigger",
+    };
+
+    printf("Node %u: %u triggers, %u Tx triggers per matrix cycle, "
+           "%u TX buffers\n", (unsigned)node, (unsigned)schedule->count,
+           (unsigned)schedule->tx_triggers, (unsigned)schedule->buffers);
+    for (uint32_t idx = 0U; idx < schedule->count; idx++)
+    {
+        const ttcan_trigger_t *t = &schedule->triggers[idx];
+        uint32_t words[2];
+
+        ttcan_trigger_encode(t, words);
+        printf("  %5u NTU  cycle code %2u  %-22s buffer %u  %08lx %08lx\n",
+               (unsigned)t->time_mark, (unsigned)t->cycle_code, types[t->type],
+               (unsigned)t->buffer, (unsigned long)words[0],
+               (unsigned long)words[1]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: sim_validate
+********************************************************************************
+* Summary:
+* Compiles the system matrix for both nodes and checks that each broken
+* matrix fails with the expected error. Returns 1 if a check failed.
+*
+*******************************************************************************/
+static int sim_validate(void)
+{
+    int result = 0;
+
+    printf("System matrix: %u windows, %u basic cycles of %u NTU\n",
+           (unsigned)ttcan_matrix.count, (unsigned)ttcan_matrix.cycles,
+           (unsigned)ttcan_matrix.cycle_ntu);
+    for (uint32_t idx = 0U; idx < ttcan_matrix.count; idx++)
+    {
+        const ttcan_window_t *w = &ttcan_matrix.windows[idx];
+
+        printf("  %-9s %-11s %5u-%5u NTU  every %u from %u  frame %u ns\n",
+               w->name, (TTCAN_WINDOW_EXCLUSIVE == w->kind) ? "exclusive" :
+               "arbitrating", (unsigned)w->start,
+               (unsigned)(w->start + w->length), (unsigned)w->repeat,
+               (unsigned)w->offset, (unsigned)ttcan_frame_ns(w->len, true));
+    }
+
+    for (uint32_t node = 0U; node < SIM_NODES; node++)
+    {
+        ttcan_error_t error = ttcan_compile(&ttcan_matrix, (uint8_t)(node + 1U),
+                                            &sim_schedule[node]);
+
+        if (TTCAN_OK != error)
+        {
+            printf("Node %u: %s  FAIL\n", (unsigned)(node + 1U),
+                   ttcan_error_name(error));
+            return 1;
+        }
+        sim_print_schedule(node + 1U, &sim_schedule[node]);
+    }
+
+    printf("Broken matrices:\n");
+    for (uint32_t idx = 0U;
+         idx < (sizeof(sim_bad_matrices) / sizeof(sim_bad_matrices[0]));
+         idx++)
+    {
+        const sim_bad_matrix_t *bad = &sim_bad_matrices[idx];
+        ttcan_matrix_t matrix =
+        {
+            .windows = bad->windows,
+            .count = bad->count,
+            .cycles = bad->cycles,
+            .cycle_ntu = (uint16_t)TTCAN_CYCLE_NTU
+        };
+        uint32_t window;
+        ttcan_error_t error = ttcan_validate(&matrix, &window);
+
+        printf("  %-20s %-28s %s\n", bad->name, ttcan_error_name(error),
+               (error == bad->expected) ? "ok" : "FAIL");
+        if (error != bad->expected)
+        {
+            result = 1;
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: sim_print_stream
+********************************************************************************
+* Summary:
+* Prints the jitter of a periodic stream in microseconds.
+*
+*******************************************************************************/
+static void sim_print_stream(const sim_stream_t *stream)
+{
+    printf("  %-28s %5lu  %8.1f %8.1f %8.1f\n", stream->name,
+           (unsigned long)stream->jitter.count, stream->jitter.min / 1000.0,
+           stream->jitter.max / 1000.0,
+           (stream->jitter.max - stream->jitter.min) / 1000.0);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Validates the system matrix, runs it on the simulated bus and compares the
+* jitter of the time-triggered frames with the event-triggered path. Exits
+* with status 1 if a check failed.
+*
+*******************************************************************************/
+int main(void)
+{
+    sim_stream_t tt_master = { .name = "CTRL_1 exclusive (master)" };
+    sim_stream_t tt_slave = { .name = "CTRL_2 exclusive (slave)" };
+    sim_stream_t et_window = { .name = "event, arbitrating window" };
+    sim_stream_t et_bus = { .name = "event, event-triggered bus" };
+    double tt_pp;
+    double et_pp;
+    int result;
+
+    srand(1U);
+    result = sim_validate();
+    if (0 != result)
+    {
+        return result;
+    }
+
+    sim_time_triggered(&tt_master, &tt_slave, &et_window);
+    sim_event_triggered(&et_bus);
+
+    printf("Time-triggered run: %lu frames, %lu late, %lu overran their "
+           "window  %s\n", (unsigned long)sim_tt_frames,
+           (unsigned long)sim_late, (unsigned long)sim_overrun,
+           ((0U == sim_late) && (0U == sim_overrun)) ? "ok" : "FAIL");
+    printf("Event-triggered bus load %.0f%%\n",
+           (100.0 * sim_busy_ns) / (SIM_CYCLES * SIM_PERIOD_NS));
+    printf("Jitter over %u periods of %.0f us, us:\n", (unsigned)SIM_CYCLES,
+           SIM_PERIOD_NS / 1000.0);
+    printf("  %-28s %5s  %8s %8s %8s\n", "stream", "count", "min", "max",
+           "p-p");
+    sim_print_stream(&tt_master);
+    sim_print_stream(&tt_slave);
+    sim_print_stream(&et_window);
+    sim_print_stream(&et_bus);
+
+    /* The time-triggered frames must stay within a few bit times, far
+     * below the event-triggered path */
+    tt_pp = (double)tt_slave.jitter.max - tt_slave.jitter.min;
+    et_pp = (double)et_bus.jitter.max - et_bus.jitter.min;
+    if ((0U != sim_late) || (0U != sim_overrun) ||
+        (tt_pp > (4.0 * SIM_NOMINAL_NS)) || (tt_pp * 10.0 > et_pp))
+    {
+        printf("FAIL\n");
+        result = 1;
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,251 @@
+/******************************************************************************
+* File Name:   txfmt_sim.c
+*
+* Description: This file contains the host report of the bus time the per-
+*              message frame format choice saves for a message set.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "txfmt.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Message set of a node: X(identifier, ID, payload length, period in ms,
+ * format the producer sets). The producers of this example set CAN FD with
+ * bit rate switching, as TX buffer 0 does in the design, except for a
+ * classic synchronization message. */
+#define SIM_MESSAGE_LIST(X)                                                    \
+    X(NODE,         0x001U, 64U,    100U, TXFMT_FD_BRS)                        \
+    X(SYNC,         0x080U,  1U,     10U, TXFMT_CLASSIC)                       \
+    X(SENSOR,       0x200U, 64U,     10U, TXFMT_FD_BRS)                        \
+    X(SENSOR_NACK,  0x1F0U,  4U,    100U, TXFMT_FD_BRS)                        \
+    X(RPC_REQUEST,  0x300U, 12U,     20U, TXFMT_FD_BRS)                        \
+    X(RPC_RESPONSE, 0x340U,  6U,     20U, TXFMT_FD_BRS)                        \
+    X(NM,           0x501U,  8U,    200U, TXFMT_FD_BRS)                        \
+    X(STATUS,       0x110U,  2U,      5U, TXFMT_FD_BRS)                        \
+    X(DIAG,         0x7E8U,  8U,     50U, TXFMT_FD_BRS)
+
+#define SIM_MESSAGE_ENTRY(name, id, len, period, format)                       \
+    { #name, (id), (len), (period), (format) },
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    uint32_t id;
+    uint8_t len;
+    uint32_t period_ms;
+    txfmt_format_t produced;
+} sim_message_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const sim_message_t sim_messages[] =
+{
+    SIM_MESSAGE_LIST(SIM_MESSAGE_ENTRY)
+};
+
+#define SIM_MESSAGE_COUNT   (sizeof(sim_messages) / sizeof(sim_messages[0]))
+
+/* Data phase rates, with the nominal rate of the design */
+static const uint32_t sim_data_bps[] = { 500000UL, 1000000UL, 2000000UL,
+                                         5000000UL };
+
+static const char *const sim_names[TXFMT_COUNT] =
+{
+    "classic", "FD", "FD+BRS"
+};
+
+/*******************************************************************************
+* Function Name: sim_check
+********************************************************************************
+* Summary:
+* Checks a choice against all formats: it must be accepted by the listeners,
+* able to carry the payload, and no longer than any other such format.
+*
+*******************************************************************************/
+static bool sim_check(const txfmt_rates_t *rates, const sim_message_t *msg,
+                      txfmt_format_t chosen)
+{
+    uint32_t allowed = txfmt_allowed(msg->id);
+    uint32_t chosen_ns;
+
+    if ((TXFMT_COUNT == chosen) || (0U == (allowed & TXFMT_SET(chosen))))
+    {
+        return false;
+    }
+    if ((TXFMT_CLASSIC == chosen) && (msg->len > 8U))
+    {
+        return false;
+    }
+
+    chosen_ns = txfmt_frame_ns(rates, chosen, msg->len, false);
+    for (uint32_t format = 0U; format < (uint32_t)TXFMT_COUNT; format++)
+    {
+        if ((0U == (allowed & TXFMT_SET(format))) ||
+            ((TXFMT_CLASSIC == format) && (msg->len > 8U)))
+        {
+            continue;
+        }
+        if (txfmt_frame_ns(rates, (txfmt_format_t)format, msg->len, false) <
+            chosen_ns)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sim_crossover
+********************************************************************************
+* Summary:
+* Returns the largest payload a classic frame is chosen for when all formats
+* are accepted, or -1 if CAN FD is always shorter.
+*
+*******************************************************************************/
+static int sim_crossover(const txfmt_rates_t *rates)
+{
+    int largest = -1;
+
+    for (uint8_t len = 0U; len <= 8U; len++)
+    {
+        if (TXFMT_CLASSIC ==
+            txfmt_select(rates, TXFMT_SET_ALL, len, false, false))
+        {
+            largest = (int)len;
+        }
+    }
+    return largest;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Computes the bus time of the message set per second, in the formats the
+* producers set and in the chosen ones, for several data phase rates, and
+* checks every choice.
+*
+*******************************************************************************/
+int main(void)
+{
+    int result = 0;
+
+    printf("Message set of %u messages, nominal rate %lu kbit/s, worst-case "
+           "stuffing\n", (unsigned)SIM_MESSAGE_COUNT,
+           (unsigned long)(TXFMT_NOMINAL_BPS / 1000UL));
+    printf("  %-9s %12s %12s %8s %8s  %-28s %s\n", "data rate", "produced",
+           "chosen", "saved", "classic", "chosen formats", "");
+
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(sim_data_bps) / sizeof(sim_data_bps[0]));
+         idx++)
+    {
+        txfmt_rates_t rates = { TXFMT_NOMINAL_BPS, sim_data_bps[idx] };
+        uint32_t count[TXFMT_COUNT] = { 0U };
+        double produced_us = 0.0;
+        double chosen_us = 0.0;
+        char formats[64];
+        char classic[16];
+        bool ok = true;
+        int crossover = sim_crossover(&rates);
+
+        for (uint32_t msg_idx = 0U; msg_idx < SIM_MESSAGE_COUNT; msg_idx++)
+        {
+            const sim_message_t *msg = &sim_messages[msg_idx];
+            double per_s = 1000.0 / (double)msg->period_ms;
+            txfmt_format_t chosen = txfmt_select(&rates,
+                                                 txfmt_allowed(msg->id),
+                                                 msg->len, false, false);
+
+            ok = ok && sim_check(&rates, msg, chosen);
+            if (TXFMT_COUNT == chosen)
+            {
+                continue;
+            }
+            count[chosen]++;
+            produced_us += per_s * (double)txfmt_frame_ns(&rates,
+                                                          msg->produced,
+                                                          msg->len, false) /
+                           1000.0;
+            chosen_us += per_s * (double)txfmt_frame_ns(&rates, chosen,
+                                                        msg->len, false) /
+                         1000.0;
+        }
+
+        (void)snprintf(formats, sizeof(formats), "%lu %s, %lu %s, %lu %s",
+                       (unsigned long)count[TXFMT_CLASSIC],
+                       sim_names[TXFMT_CLASSIC],
+                       (unsigned long)count[TXFMT_FD], sim_names[TXFMT_FD],
+                       (unsigned long)count[TXFMT_FD_BRS],
+                       sim_names[TXFMT_FD_BRS]);
+
+        if (crossover < 0)
+        {
+            (void)snprintf(classic, sizeof(classic), "never");
+        }
+        else
+        {
+            (void)snprintf(classic, sizeof(classic), "<= %d B", crossover);
+        }
+
+        /* Bus time per second is bus load in ppm; print it in percent */
+        printf("  %5lu k   %10.2f %% %10.2f %% %7.1f%% %8s  %-28s %s\n",
+               (unsigned long)(sim_data_bps[idx] / 1000UL),
+               produced_us / 1.0e4, chosen_us / 1.0e4,
+               100.0 * (produced_us - chosen_us) / produced_us, classic,
+               formats, ok ? "ok" : "FAIL");
+        if (!ok)
+        {
+            result = 1;
+        }
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
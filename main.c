@@ -48,6 +48,29 @@
 #include "cy_pdl.h"
 #include "cybsp.h"
 #include "cy_retarget_io.h"
+#include "trace.h"
+#include "canfd_frame.h"
+#include "pubsub.h"
+#include "sensor_stream.h"
+#include "node_services.h"
+#include "nm.h"
+#include "shell.h"
+#include "flog.h"
+#include "fzip.h"
+#include "redund_can.h"
+#include "seqmon.h"
+#include "ttcan_hw.h"
+#include "rxdma_can.h"
+#include "txfmt.h"
+#include "datarate_can.h"
+#include "hoptrace.h"
+#include "sigagg_can.h"
+#include "dsp_can.h"
+#include "adcstream_can.h"
+#include "cancrypt_can.h"
+#include "stats.h"
+#include "stack_monitor.h"
+#include "bench.h"
 
 /*******************************************************************************
 * Macros
@@ -67,8 +90,15 @@
 #endif
 /* CAN-FD data buffer index to send data from */
 #define CANFD_BUFFER_INDEX      0
-/* Maximum incoming data length supported */
-#define CANFD_DLC               8
+
+/* Controller events that explain lost frames, passed to the error
+ * callback once enabled */
+#define CANFD_LOSS_EVENTS       (CY_CANFD_RX_FIFO_0_MSG_LOST |                \
+                                 CY_CANFD_RX_FIFO_1_MSG_LOST)
+#define CANFD_ERROR_EVENTS      (CY_CANFD_PROTOCOL_ERROR_ARB_PHASE |          \
+                                 CY_CANFD_PROTOCOL_ERROR_DATA_PHASE |         \
+                                 CY_CANFD_ERROR_PASSIVE |                     \
+                                 CY_CANFD_BUS_OFF_STATUS)
 
 #if defined (CY_DEVICE_PSC3)
 #define CANFD_INTERRUPT         canfd_0_interrupts0_1_IRQn
@@ -78,12 +108,60 @@
 
 #define GPIO_INTERRUPT_PRIORITY (7u)
 
+/* The snapshot stream and the RPC load test keep the network awake */
+#define APP_NETWORK_ALWAYS      ((MSTREAM_ENABLE) || (RPC_LOAD_ENABLE))
+
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
 /* This is a shared context structure, unique for each can-fd channel */
 static cy_stc_canfd_context_t canfd_context;
 
+#if !(FZIP_ENABLE)
+/* Log text of the received CAN-FD frame being printed */
+static char canfd_log_text[CANFD_FRAME_FORMAT_SIZE];
+#endif /* !FZIP_ENABLE */
+
+/* Frames received per node, counted by the diagnostics subscriber */
+static uint32_t canfd_rx_node_count[CANFD_NODE_2 + 1];
+
+#if (SEQMON_ENABLE)
+/* Sequence number of the next node frame */
+static uint8_t canfd_tx_seq;
+#endif /* SEQMON_ENABLE */
+
+#if (CANCRYPT_ENABLE)
+/* Node frame of the design, sent through canfd_send_frame() to be sealed */
+static canfd_frame_t canfd_button_frame;
+#endif /* CANCRYPT_ENABLE */
+
+/* TX buffer of frames built at run time, e.g. by the snapshot stream */
+static cy_stc_canfd_t0_t canfd_tx_t0;
+static cy_stc_canfd_t1_t canfd_tx_t1;
+static uint32_t canfd_tx_data[CANFD_MAX_DATA_LEN / sizeof(uint32_t)];
+static cy_stc_canfd_tx_buffer_t canfd_tx_buffer =
+{
+    .t0_f = &canfd_tx_t0,
+    .t1_f = &canfd_tx_t1,
+    .data_area_f = canfd_tx_data
+};
+
+#if (FZIP_ENABLE)
+/* Compressor of the frames sent to the debug UART */
+static fzip_encoder_t app_fzip;
+#endif /* FZIP_ENABLE */
+
+#if (FLOG_ENABLE) || (REDUND_ENABLE) || (TTCAN_ENABLE) || \
+    (DATARATE_ENABLE) || (SIGAGG_ENABLE) || (DSP_ENABLE) || \
+    (ADCSTREAM_ENABLE) || (STATS_ENABLE) || (MSTREAM_ENABLE)
+/* Milliseconds since start-up, extended from the cycle counter */
+static uint32_t app_clock_cycles;
+static uint32_t app_clock_rem;
+static uint32_t app_clock_count;
+#endif /* FLOG_ENABLE || REDUND_ENABLE || TTCAN_ENABLE ||
+        * DATARATE_ENABLE || SIGAGG_ENABLE || DSP_ENABLE ||
+        * ADCSTREAM_ENABLE || STATS_ENABLE || MSTREAM_ENABLE */
+
 /* Variable which holds the button pressed status */
 volatile bool gpio_intr_flag = false;
 
@@ -104,6 +182,28 @@ void gpio_interrupt_handler(void);
 
 void canfd_rx_callback (bool  msg_valid, uint8_t msg_buf_fifo_num,
                         cy_stc_canfd_rx_buffer_t* canfd_rx_buf);
+
+/* receives the RX FIFO 0 elements moved by DMA */
+void canfd_rx_dma_callback(const rxdma_element_t *element);
+
+void canfd_error_callback(uint32_t errors);
+
+/* sends a frame built at run time */
+static bool canfd_send_frame(const canfd_frame_t *frame);
+
+/* time base of the frame logger, the redundancy layer and the TTCAN probe */
+static uint32_t app_clock_ms(void);
+
+#if (FZIP_ENABLE)
+/* output of the frame stream compressor */
+static void app_fzip_write(const uint8_t *data, uint32_t len);
+#endif /* FZIP_ENABLE */
+
+#if (FLOG_ENABLE)
+/* page writer of the frame logger */
+static void app_flog_poll(uint32_t now_ms);
+#endif /* FLOG_ENABLE */
+
 /* handler for general errors */
 void handle_error(uint32_t status);
 
@@ -145,7 +245,15 @@ int main(void)
 {
     cy_rslt_t result;
 
+    /* Paint the stack before anything else runs on it */
+    stack_monitor_init();
+
     cy_en_canfd_status_t status;
+    uint32_t dispatched;
+#if (SIGAGG_ENABLE)
+    uint32_t loop_cycles;
+    uint32_t loop_now;
+#endif /* SIGAGG_ENABLE */
     /* Initialize the device and board peripherals */
     result = cybsp_init();
     /* Board init failed. Stop program execution */
@@ -177,6 +285,28 @@ int main(void)
           CY_ASSERT(0);
      }
 
+     /* Start the cycle counter and arm the event tracer */
+     trace_init();
+
+     /* Tag the frames of the traced IDs for the latency collector */
+     hoptrace_init(USE_CANFD_NODE);
+
+     /* Set up the frame pool and compile the subscription table */
+     pubsub_init();
+
+#if (FZIP_ENABLE)
+     /* Log the received frames compressed instead of as text */
+     fzip_init(&app_fzip, app_fzip_write);
+#endif /* FZIP_ENABLE */
+
+     /* Join the sensor snapshot stream as sender or receiver */
+     sensor_stream_init(canfd_send_frame, app_clock_ms());
+
+     /* Serve remote procedures and call them on the other node */
+     node_services_init(USE_CANFD_NODE,
+                        (CANFD_NODE_1 + CANFD_NODE_2) - USE_CANFD_NODE,
+                        canfd_send_frame);
+
      /* Configure GPIO interrupt */
      Cy_GPIO_SetInterruptEdge(CYBSP_USER_BTN1_PORT, CYBSP_USER_BTN1_PIN, CY_GPIO_INTR_FALLING);
      Cy_GPIO_SetInterruptMask(CYBSP_USER_BTN1_PORT, CYBSP_USER_BTN1_PIN, CY_GPIO_INTR_EN_MASK);
@@ -187,6 +317,66 @@ int main(void)
 
     handle_error(status);
 
+#if (SEQMON_ENABLE)
+    /* Pass lost messages and bus errors to the loss statistics */
+    Cy_CANFD_SetInterruptMask(CANFD_HW, CANFD_HW_CHANNEL,
+                              Cy_CANFD_GetInterruptMask(CANFD_HW,
+                                                        CANFD_HW_CHANNEL) |
+                              CANFD_LOSS_EVENTS | CANFD_ERROR_EVENTS);
+#endif /* SEQMON_ENABLE */
+
+     /* Move the RX FIFO 0 elements into a RAM ring by DMA */
+     rxdma_can_init(CANFD_HW, CANFD_HW_CHANNEL, &canfd_context,
+                    canfd_rx_dma_callback);
+
+     /* Lower the data bit rate of all nodes while data phase errors pile
+      * up */
+     datarate_can_init(CANFD_HW, CANFD_HW_CHANNEL, &CANFD_config,
+                       USE_CANFD_NODE, canfd_send_frame, app_clock_ms());
+
+     /* Send the aggregated signals as one summary per window */
+     sigagg_can_init(USE_CANFD_NODE, canfd_send_frame, app_clock_ms());
+
+     /* Filter the received sample blocks, or send the demo signal */
+     dsp_can_init(USE_CANFD_NODE, canfd_send_frame, app_clock_ms());
+
+     /* Start sampling on the source node of the ADC stream */
+     adcstream_can_init(USE_CANFD_NODE, canfd_send_frame, app_clock_ms());
+
+     /* Load the keys of the encrypted IDs */
+     cancrypt_can_init();
+
+     /* Clear the counters and start the snapshots on the diagnostic ID */
+     stats_init(USE_CANFD_NODE, canfd_send_frame, app_clock_ms());
+
+     /* Start network management; the channel is stopped during bus sleep */
+     nm_init(CANFD_HW, CANFD_HW_CHANNEL, &CANFD_config, &canfd_context,
+             USE_CANFD_NODE, canfd_send_frame);
+#if (APP_NETWORK_ALWAYS)
+     nm_network_request();
+#endif /* APP_NETWORK_ALWAYS */
+
+     /* Accept commands on the debug UART */
+     shell_init(CANFD_HW, CANFD_HW_CHANNEL, &CANFD_config, &canfd_context,
+                canfd_send_frame);
+
+#if (FLOG_ENABLE)
+     /* Continue the frame log on the external flash */
+     if (!flog_mount(flog_spi_init()))
+     {
+          printf("Frame logger: no flash found\r\n");
+     }
+#endif /* FLOG_ENABLE */
+
+     /* Start bus B and send the heartbeat of this node on both buses */
+     redund_can_init(CANFD_HW, CANFD_HW_CHANNEL, USE_CANFD_NODE,
+                     canfd_send_frame);
+
+     /* Load the trigger list of this node and run the channel
+      * time-triggered */
+     ttcan_hw_init(CANFD_HW, CANFD_HW_CHANNEL, &CANFD_config, &canfd_context,
+                   USE_CANFD_NODE, canfd_send_frame);
+
      /* Configure CM4+ CPU GPIO interrupt vector for Port 0 */
      Cy_SysInt_Init(&intrCfg, gpio_interrupt_handler);
      NVIC_ClearPendingIRQ(intrCfg.intrSrc);
@@ -198,6 +388,11 @@ int main(void)
     /* Enable global interrupts */
     __enable_irq();
 
+#if (BENCHMARK_ENABLE)
+    /* Run the benchmark suite and print the results as one block */
+    bench_suite_run(CANFD_HW, CANFD_HW_CHANNEL, &canfd_context);
+#endif /* BENCHMARK_ENABLE */
+
     printf("===========================================================\r\n");
     printf("Welcome to CAN-FD example\r\n");
     printf("===========================================================\r\n\n");
@@ -209,20 +404,76 @@ int main(void)
     /* Setting Node(message) Identifier to global setting of "USE_CANFD_NODE" */
     CANFD_T0RegisterBuffer_0.id = USE_CANFD_NODE;
 
+#if (SIGAGG_ENABLE)
+    loop_cycles = cycle_counter_get();
+#endif /* SIGAGG_ENABLE */
+
     for(;;)
     {
+        /* A button press wakes the network if it is asleep */
         if (true == gpio_intr_flag)
         {
+            nm_network_request();
+        }
+
+        /* Wait for the network, and for the TX buffer if a stream frame is
+         * still being sent */
+        if ((true == gpio_intr_flag) && nm_tx_allowed() &&
+            (CY_CANFD_TX_BUFFER_PENDING !=
+             Cy_CANFD_GetTxBufferStatus(CANFD_HW, CANFD_HW_CHANNEL,
+                                        CANFD_BUFFER_INDEX)))
+        {
+            TRACE_BEGIN(MAIN_TX);
+#if (SEQMON_ENABLE)
+            /* Number the frame in its first byte for the receiver */
+            CANFD_txBuffer_0.data_area_f[0] =
+                (CANFD_txBuffer_0.data_area_f[0] & ~0xFFUL) | canfd_tx_seq;
+#endif /* SEQMON_ENABLE */
+#if (CANCRYPT_ENABLE)
+            /* Go through the frame path, which seals the payload if the ID
+             * is listed in cancrypt_can.h */
+            canfd_frame_from_tx_buffer(&canfd_button_frame, &CANFD_txBuffer_0);
+            status = canfd_send_frame(&canfd_button_frame) ?
+                     CY_CANFD_SUCCESS : CY_CANFD_BAD_PARAM;
+#else
             /* Sending CAN-FD frame to other node */
             status = Cy_CANFD_UpdateAndTransmitMsgBuffer(CANFD_HW,
                                                     CANFD_HW_CHANNEL,
                                                     &CANFD_txBuffer_0,
                                                     CANFD_BUFFER_INDEX,
                                                     &canfd_context);
+#endif /* CANCRYPT_ENABLE */
             if(CY_CANFD_SUCCESS == status)
             {
+                TRACE_INSTANT(FRAME_TX, USE_CANFD_NODE);
+                STATS_INC(BUTTON_FRAMES);
+#if (SEQMON_ENABLE)
+                canfd_tx_seq++;
+#endif /* SEQMON_ENABLE */
                 printf("CAN-FD Frame sent with message ID-%d\r\n\r\n",
                         USE_CANFD_NODE);
+                printf("Frames received from node 1: %lu, node 2: %lu\r\n",
+                       (unsigned long)canfd_rx_node_count[CANFD_NODE_1],
+                       (unsigned long)canfd_rx_node_count[CANFD_NODE_2]);
+                pubsub_report();
+                sensor_stream_report();
+                node_services_report();
+                nm_report();
+                redund_can_report();
+                seqmon_report();
+                ttcan_hw_report();
+                rxdma_can_report();
+                txfmt_report();
+                datarate_can_report();
+                hoptrace_report();
+                sigagg_can_report();
+                dsp_can_report();
+                adcstream_can_report();
+                cancrypt_can_report();
+                stats_report();
+
+                /* Issue the next batch of pipelined calls */
+                node_services_demo();
             }
             else
             {
@@ -231,7 +482,85 @@ int main(void)
             }
 
             gpio_intr_flag = false;
+#if !(APP_NETWORK_ALWAYS)
+            /* The network sleeps again once no node needs it */
+            nm_network_release();
+#endif /* !APP_NETWORK_ALWAYS */
+            TRACE_END(MAIN_TX);
+        }
+
+        /* Deliver the received frames to their subscribers. The compressed
+         * log is sent once no more frames are waiting. */
+        dispatched = pubsub_dispatch();
+        STATS_ADD(DISPATCHED, dispatched);
+#if (FZIP_ENABLE)
+        if (0U == dispatched)
+        {
+            fzip_flush(&app_fzip);
         }
+#endif /* FZIP_ENABLE */
+
+        /* Send or receive sensor snapshots */
+        sensor_stream_poll(app_clock_ms());
+
+        /* Send RPC requests and responses, retry overdue calls */
+        node_services_poll();
+
+        /* Run network management: NM messages, bus sleep and wake-up */
+        nm_poll();
+
+        /* Run typed commands and the traffic generator */
+        shell_poll();
+
+#if (FLOG_ENABLE)
+        /* Write the page of recorded frames once it is old enough */
+        app_flog_poll(app_clock_ms());
+#endif /* FLOG_ENABLE */
+
+        /* Send the heartbeat and watch both buses */
+        redund_can_poll(app_clock_ms());
+
+        /* Request the scheduled frames again and send the probe frame */
+        ttcan_hw_poll(app_clock_ms());
+
+        /* Report any new stack high-water mark */
+        stack_monitor_poll();
+
+        /* Dump the trace buffer once a capture is complete */
+        trace_poll();
+
+        /* Print the RX and TX times of the traced frames */
+        hoptrace_poll();
+
+        /* Restore the RX FIFO 0 watermark after a channel restart */
+        rxdma_can_poll();
+
+        /* Decide on and switch the data bit rate */
+        datarate_can_poll(app_clock_ms());
+
+        /* Summarize the time of a loop pass and the frames it dispatched,
+         * and send the summaries of the windows that closed */
+        sigagg_can_add(SIGAGG_CAN_SIGNAL_DISPATCH, (int32_t)dispatched);
+#if (SIGAGG_ENABLE)
+        loop_now = cycle_counter_get();
+        sigagg_can_add(SIGAGG_CAN_SIGNAL_LOOP_US,
+                       (int32_t)((loop_now - loop_cycles) /
+                                 (SystemCoreClock / 1000000U)));
+        loop_cycles = loop_now;
+#endif /* SIGAGG_ENABLE */
+        sigagg_can_poll(app_clock_ms());
+
+        /* Send the blocks of the demo signal that are due */
+        dsp_can_poll(app_clock_ms());
+
+        /* Send the ADC samples the bus load cap leaves room for */
+        adcstream_can_poll(app_clock_ms());
+
+        /* Send the next frame of the statistics snapshot */
+        stats_poll(app_clock_ms());
+
+        /* Sleep until the next interrupt while the network is asleep */
+        nm_idle(gpio_intr_flag);
     }
 }
 
@@ -248,8 +577,22 @@ int main(void)
 *******************************************************************************/
 void gpio_interrupt_handler(void)
 {
-    Cy_GPIO_ClearInterrupt(CYBSP_USER_BTN1_PORT, CYBSP_USER_BTN1_PIN);
-    gpio_intr_flag = true;
+    TRACE_BEGIN(ISR_GPIO);
+    /* The CAN RX pin shares the port; its interrupt is only enabled during
+     * bus sleep */
+    if (0U != Cy_GPIO_GetInterruptStatusMasked(CYBSP_CAN_RX_PORT,
+                                               CYBSP_CAN_RX_PIN))
+    {
+        Cy_GPIO_ClearInterrupt(CYBSP_CAN_RX_PORT, CYBSP_CAN_RX_PIN);
+        nm_wake_isr();
+    }
+    if (0U != Cy_GPIO_GetInterruptStatusMasked(CYBSP_USER_BTN1_PORT,
+                                               CYBSP_USER_BTN1_PIN))
+    {
+        Cy_GPIO_ClearInterrupt(CYBSP_USER_BTN1_PORT, CYBSP_USER_BTN1_PIN);
+        gpio_intr_flag = true;
+    }
+    TRACE_END(ISR_GPIO);
 }
 
 /*******************************************************************************
@@ -264,8 +607,18 @@ void gpio_interrupt_handler(void)
 *******************************************************************************/
 static void isr_canfd(void)
 {
+#if (STATS_ENABLE)
+    uint32_t start = cycle_counter_get();
+#endif /* STATS_ENABLE */
+
+    BENCH_STAMP(BENCH_STAMP_ISR_ENTRY);
+    TRACE_BEGIN(ISR_CANFD);
+    /* Start the DMA transfer of RX FIFO 0 at the watermark */
+    rxdma_can_isr();
     /* Just call the IRQ handler with the current channel number and context */
     Cy_CANFD_IrqHandler(CANFD_HW, CANFD_HW_CHANNEL, &canfd_context);
+    TRACE_END(ISR_CANFD);
+    STATS_PEAK(ISR_CYCLES_MAX, cycle_counter_get() - start);
 }
 
 /*******************************************************************************
@@ -283,41 +636,600 @@ static void isr_canfd(void)
 void canfd_rx_callback (bool  msg_valid, uint8_t msg_buf_fifo_num,
                         cy_stc_canfd_rx_buffer_t* canfd_rx_buf)
 {
-    /* Array to hold the data bytes of the CAN-FD frame */
-    uint8_t canfd_data_buffer[CANFD_DLC];
-    /* Variable to hold the data length code of the CAN-FD frame */
-    uint32_t canfd_dlc;
-    /* Variable to hold the Identifier of the CAN-FD frame */
-    uint32_t canfd_id;
+    /* Pool frame the received CAN-FD frame is decoded into */
+    canfd_frame_t *canfd_frame;
+    pubsub_handle_t handle;
+
+    TRACE_BEGIN(RX_CALLBACK);
 
     if (true == msg_valid)
     {
         /* Checking whether the frame received is a data frame */
         if(CY_CANFD_RTR_DATA_FRAME == canfd_rx_buf->r0_f->rtr)
         {
+            /* Error rate of the data phase */
+            datarate_can_on_rx();
 
-            //cyhal_gpio_toggle(CYBSP_USER_LED);
-             Cy_GPIO_Inv(CYBSP_USER_LED1_PORT, CYBSP_USER_LED1_PIN);
+            /* Decode straight into the frame pool and publish it; the
+             * subscribers run from the main loop to keep this path short and
+             * its stack bounded */
+            canfd_frame = pubsub_alloc(&handle);
+            if (NULL != canfd_frame)
+            {
+                canfd_frame_from_rx_buffer(canfd_frame, canfd_rx_buf);
+                TRACE_INSTANT(FRAME_RX, canfd_frame->id);
 
-            canfd_dlc = canfd_rx_buf->r1_f->dlc;
-            canfd_id  = canfd_rx_buf->r0_f->id;
+                /* RX point of the latency trace */
+                hoptrace_on_rx(canfd_frame);
 
-            printf("%d bytes received with message identifier %d\r\n\r\n",
-                                                        (int)canfd_dlc,
-                                                        (int)canfd_id);
+                /* Selective wake-up check during bus sleep */
+                nm_on_rx_isr(canfd_frame);
+                pubsub_publish(handle);
+                STATS_INC(RX_FRAMES);
+            }
+            else
+            {
+                seqmon_on_event(SEQMON_EVENT_POOL_FULL);
+            }
+        }
+    }
 
-            memcpy(canfd_data_buffer,canfd_rx_buf->data_area_f,canfd_dlc);
+    TRACE_END(RX_CALLBACK);
+}
 
-            printf("Rx Data : ");
+/*******************************************************************************
+* Function Name: canfd_rx_dma_callback
+********************************************************************************
+* Summary:
+* Receives the RX FIFO 0 elements that the DMA moved into the RAM ring, in
+* the DMA interrupt, as canfd_rx_callback does for the CPU copy. Used when
+* RXDMA_ENABLE is set.
+*
+* Parameters:
+*    element                       Element in the ring
+*
+*******************************************************************************/
+void canfd_rx_dma_callback(const rxdma_element_t *element)
+{
+    canfd_frame_t *canfd_frame;
+    pubsub_handle_t handle;
 
-            for (uint8_t msg_idx = 0U; msg_idx < canfd_dlc ; msg_idx++)
-            {
-                printf(" %d ", canfd_data_buffer[msg_idx]);
-            }
+    TRACE_BEGIN(RX_CALLBACK);
+
+    /* Checking whether the frame received is a data frame */
+    if (0U == (element->words[0] & RXDMA_R0_RTR))
+    {
+        /* Error rate of the data phase */
+        datarate_can_on_rx();
+
+        canfd_frame = pubsub_alloc(&handle);
+        if (NULL != canfd_frame)
+        {
+            rxdma_can_frame(canfd_frame, element);
+            TRACE_INSTANT(FRAME_RX, canfd_frame->id);
+
+            /* RX point of the latency trace */
+            hoptrace_on_rx(canfd_frame);
+
+            /* Selective wake-up check during bus sleep */
+            nm_on_rx_isr(canfd_frame);
+            pubsub_publish(handle);
+            STATS_INC(RX_FRAMES);
+        }
+        else
+        {
+            seqmon_on_event(SEQMON_EVENT_POOL_FULL);
+        }
+    }
+
+    TRACE_END(RX_CALLBACK);
+}
+
+/*******************************************************************************
+* Function Name: canfd_error_callback
+********************************************************************************
+* Summary:
+* Error callback of the CAN FD channel. Counts the events that explain lost
+* frames for the sequence monitor; the events are only enabled when
+* SEQMON_ENABLE is set. Data phase errors also drive the data bit rate
+* adaptation, which enables them with DATARATE_ENABLE.
+*
+* Parameters:
+*    errors                        Interrupt status bits of the errors
+*
+*******************************************************************************/
+void canfd_error_callback(uint32_t errors)
+{
+    if (0U != (errors & CANFD_LOSS_EVENTS))
+    {
+        seqmon_on_event(SEQMON_EVENT_FIFO_LOST);
+        STATS_INC(RX_FIFO_LOST);
+    }
+    if (0U != (errors & CANFD_ERROR_EVENTS))
+    {
+        seqmon_on_event(SEQMON_EVENT_BUS_ERROR);
+        STATS_INC(BUS_ERRORS);
+    }
+    datarate_can_on_error(errors);
+}
+
+/*******************************************************************************
+* Function Name: app_control_on_frame
+********************************************************************************
+* Summary:
+* Control subscriber. Toggles the user LED for every received frame.
+*
+* Parameters:
+*  handle       Handle of the received frame (unused)
+*  frame        Received frame (unused)
+*
+*******************************************************************************/
+void app_control_on_frame(pubsub_handle_t handle, const canfd_frame_t *frame)
+{
+    CY_UNUSED_PARAMETER(handle);
+    CY_UNUSED_PARAMETER(frame);
+
+    //cyhal_gpio_toggle(CYBSP_USER_LED);
+    Cy_GPIO_Inv(CYBSP_USER_LED1_PORT, CYBSP_USER_LED1_PIN);
+}
+
+/*******************************************************************************
+* Function Name: app_stream_on_frame
+********************************************************************************
+* Summary:
+* Stream subscriber. Passes sensor snapshot stream frames to the protocol.
+*
+* Parameters:
+*  handle       Handle of the received frame (unused)
+*  frame        Received frame
+*
+*******************************************************************************/
+void app_stream_on_frame(pubsub_handle_t handle, const canfd_frame_t *frame)
+{
+    CY_UNUSED_PARAMETER(handle);
+
+    sensor_stream_on_frame(frame, app_clock_ms());
+}
+
+/*******************************************************************************
+* Function Name: app_rpc_on_frame
+********************************************************************************
+* Summary:
+* RPC subscriber. Passes requests and responses to the RPC layer.
+*
+* Parameters:
+*  handle       Handle of the received frame (unused)
+*  frame        Received frame
+*
+*******************************************************************************/
+void app_rpc_on_frame(pubsub_handle_t handle, const canfd_frame_t *frame)
+{
+    CY_UNUSED_PARAMETER(handle);
+
+    node_services_on_frame(frame);
+}
+
+/*******************************************************************************
+* Function Name: app_nm_on_frame
+********************************************************************************
+* Summary:
+* Network management subscriber. Passes NM messages to network management.
+*
+* Parameters:
+*  handle       Handle of the received frame (unused)
+*  frame        Received frame
+*
+*******************************************************************************/
+void app_nm_on_frame(pubsub_handle_t handle, const canfd_frame_t *frame)
+{
+    CY_UNUSED_PARAMETER(handle);
+
+    nm_on_frame(frame);
+}
+
+/*******************************************************************************
+* Function Name: app_diag_on_frame
+********************************************************************************
+* Summary:
+* Diagnostics subscriber. Counts the frames received from each node.
+*
+* Parameters:
+*  handle       Handle of the received frame (unused)
+*  frame        Received frame
+*
+*******************************************************************************/
+void app_diag_on_frame(pubsub_handle_t handle, const canfd_frame_t *frame)
+{
+    CY_UNUSED_PARAMETER(handle);
+
+    if (frame->id <= CANFD_NODE_2)
+    {
+        canfd_rx_node_count[frame->id]++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_log_on_frame
+********************************************************************************
+* Summary:
+* Logging subscriber. Prints the received frame on the debug UART, or with
+* FZIP_ENABLE adds it to the compressed stream.
+*
+* Parameters:
+*  handle       Handle of the received frame (unused)
+*  frame        Received frame
+*
+*******************************************************************************/
+void app_log_on_frame(pubsub_handle_t handle, const canfd_frame_t *frame)
+{
+    CY_UNUSED_PARAMETER(handle);
+
+#if (FZIP_ENABLE)
+    fzip_encode(&app_fzip, frame);
+#else
+    (void)canfd_frame_format(frame, canfd_log_text, sizeof(canfd_log_text));
+    printf("%s", canfd_log_text);
+#endif /* FZIP_ENABLE */
+}
+
+#if (FZIP_ENABLE)
+/*******************************************************************************
+* Function Name: app_fzip_write
+********************************************************************************
+* Summary:
+* Sends a block of compressed frames on the debug UART, between the text
+* printed by the application.
+*
+* Parameters:
+*  data         Encoded block
+*  len          Length in bytes
+*
+*******************************************************************************/
+static void app_fzip_write(const uint8_t *data, uint32_t len)
+{
+    Cy_SCB_UART_PutArrayBlocking(DEBUG_UART_HW, (void *)data, len);
+}
+#endif /* FZIP_ENABLE */
+
+#if (FLOG_ENABLE)
+/*******************************************************************************
+* Function Name: app_flog_poll
+********************************************************************************
+* Summary:
+* Writes the page of recorded frames once it is old enough, and adds the
+* records of the frame log to the statistics registry. flog.c only uses the
+* C library, for the host benchmark, so its counters are followed here.
+*
+* Parameters:
+*  now_ms       Current time
+*
+*******************************************************************************/
+static void app_flog_poll(uint32_t now_ms)
+{
+#if (STATS_ENABLE)
+    static uint32_t records;
+    static uint32_t dropped;
+    flog_stats_t stats;
+#endif /* STATS_ENABLE */
+
+    flog_poll(now_ms);
+#if (STATS_ENABLE)
+    flog_get_stats(&stats);
+    STATS_FOLLOW(FLOG_RECORDS, stats.records, &records);
+    STATS_FOLLOW(FLOG_DROPPED, stats.dropped, &dropped);
+#endif /* STATS_ENABLE */
+}
+#endif /* FLOG_ENABLE */
+
+/*******************************************************************************
+* Function Name: app_recorder_on_frame
+********************************************************************************
+* Summary:
+* Recorder subscriber. Appends every received frame to the frame log on the
+* external flash. Subscribed to no topic unless FLOG_ENABLE is set.
+*
+* Parameters:
+*  handle       Handle of the received frame (unused)
+*  frame        Received frame
+*
+*******************************************************************************/
+void app_recorder_on_frame(pubsub_handle_t handle, const canfd_frame_t *frame)
+{
+    CY_UNUSED_PARAMETER(handle);
+
+    (void)flog_append(app_clock_ms(), frame->id, frame->flags, frame->data,
+                      frame->len);
+}
+
+/*******************************************************************************
+* Function Name: app_seqmon_on_frame
+********************************************************************************
+* Summary:
+* Sequence monitor subscriber. Checks the sequence numbers of the monitored
+* streams. Subscribed to no topic unless SEQMON_ENABLE is set.
+*
+* Parameters:
+*  handle       Handle of the received frame (unused)
+*  frame        Received frame
+*
+*******************************************************************************/
+void app_seqmon_on_frame(pubsub_handle_t handle, const canfd_frame_t *frame)
+{
+    CY_UNUSED_PARAMETER(handle);
+
+    seqmon_on_frame(frame->id, frame->data, frame->len);
+}
+
+/*******************************************************************************
+* Function Name: app_redund_on_frame
+********************************************************************************
+* Summary:
+* Redundancy subscriber. Passes the redundant streams from both buses to the
+* redundancy layer, which drops the second copies. Subscribed to no topic
+* unless REDUND_ENABLE is set.
+*
+* Parameters:
+*  handle       Handle of the received frame (unused)
+*  frame        Received frame
+*
+*******************************************************************************/
+void app_redund_on_frame(pubsub_handle_t handle, const canfd_frame_t *frame)
+{
+    CY_UNUSED_PARAMETER(handle);
+
+    redund_can_on_frame(frame, app_clock_ms());
+}
+
+/*******************************************************************************
+* Function Name: app_ttcan_on_frame
+********************************************************************************
+* Summary:
+* TTCAN subscriber. Measures the jitter of the time-triggered and the
+* event-triggered frames of the other node. Subscribed to no topic unless
+* TTCAN_ENABLE is set.
+*
+* Parameters:
+*  handle       Handle of the received frame (unused)
+*  frame        Received frame
+*
+*******************************************************************************/
+void app_ttcan_on_frame(pubsub_handle_t handle, const canfd_frame_t *frame)
+{
+    CY_UNUSED_PARAMETER(handle);
+
+    ttcan_hw_on_frame(frame);
+}
+
+/*******************************************************************************
+* Function Name: app_datarate_on_frame
+********************************************************************************
+* Summary:
+* Data rate subscriber. Passes the commands of the master and the
+* acknowledgments of the other nodes to the data bit rate adaptation.
+* Subscribed to no topic unless DATARATE_ENABLE is set.
+*
+* Parameters:
+*  handle       Handle of the received frame (unused)
+*  frame        Received frame
+*
+*******************************************************************************/
+void app_datarate_on_frame(pubsub_handle_t handle, const canfd_frame_t *frame)
+{
+    CY_UNUSED_PARAMETER(handle);
 
-            printf("\r\n\r\n");
+    datarate_can_on_frame(frame, app_clock_ms());
+}
+
+/*******************************************************************************
+* Function Name: app_sigagg_on_frame
+********************************************************************************
+* Summary:
+* Aggregation subscriber. Keeps the window summaries of the other nodes.
+* Subscribed to no topic unless SIGAGG_ENABLE is set.
+*
+* Parameters:
+*  handle       Handle of the received frame (unused)
+*  frame        Received frame
+*
+*******************************************************************************/
+void app_sigagg_on_frame(pubsub_handle_t handle, const canfd_frame_t *frame)
+{
+    CY_UNUSED_PARAMETER(handle);
+
+    sigagg_can_on_frame(frame);
+}
+
+/*******************************************************************************
+* Function Name: app_dsp_on_frame
+********************************************************************************
+* Summary:
+* DSP subscriber. Runs the samples of a block through the filter chain.
+* Subscribed to no topic unless DSP_ENABLE is set.
+*
+* Parameters:
+*  handle       Handle of the received frame (unused)
+*  frame        Received frame
+*
+*******************************************************************************/
+void app_dsp_on_frame(pubsub_handle_t handle, const canfd_frame_t *frame)
+{
+    CY_UNUSED_PARAMETER(handle);
+
+    dsp_can_on_frame(frame);
+}
+
+/*******************************************************************************
+* Function Name: app_adcstream_on_frame
+********************************************************************************
+* Summary:
+* ADC stream subscriber. Counts the received samples and the missing ones.
+* Subscribed to no topic unless ADCSTREAM_ENABLE is set.
+*
+* Parameters:
+*  handle       Handle of the received frame (unused)
+*  frame        Received frame
+*
+*******************************************************************************/
+void app_adcstream_on_frame(pubsub_handle_t handle, const canfd_frame_t *frame)
+{
+    CY_UNUSED_PARAMETER(handle);
+
+    adcstream_can_on_frame(frame);
+}
+
+/*******************************************************************************
+* Function Name: app_clock_ms
+********************************************************************************
+* Summary:
+* Returns the milliseconds since start-up, extended from the cycle counter.
+* It must be called at least once per cycle counter wrap, which the main loop
+* does. The cycle counter stops while the CPU sleeps, so the time counts
+* only the time awake.
+*
+* Return:
+*  Milliseconds since start-up
+*
+*******************************************************************************/
+static uint32_t app_clock_ms(void)
+{
+#if (FLOG_ENABLE) || (REDUND_ENABLE) || (TTCAN_ENABLE) || \
+    (DATARATE_ENABLE) || (SIGAGG_ENABLE) || (DSP_ENABLE) || \
+    (ADCSTREAM_ENABLE) || (STATS_ENABLE) || (MSTREAM_ENABLE)
+    uint32_t now = cycle_counter_get();
+    uint32_t cycles_per_ms = SystemCoreClock / 1000U;
+
+    app_clock_rem += now - app_clock_cycles;
+    app_clock_cycles = now;
+    app_clock_count += app_clock_rem / cycles_per_ms;
+    app_clock_rem %= cycles_per_ms;
+
+    return app_clock_count;
+#else
+    return 0U;
+#endif /* FLOG_ENABLE || REDUND_ENABLE || TTCAN_ENABLE ||
+        * DATARATE_ENABLE || SIGAGG_ENABLE || DSP_ENABLE ||
+        * ADCSTREAM_ENABLE || STATS_ENABLE || MSTREAM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: canfd_send_frame
+********************************************************************************
+* Summary:
+* Sends a frame through the TX buffer if the controller is not still sending
+* the previous one. The main loop is the only caller, so the buffer is not
+* shared with an interrupt. With TXFMT_ENABLE, the frame goes out in the
+* format that takes the least bus time among those its listeners accept,
+* whatever FDF and BRS its producer set, unless CANFD_FRAME_FLAG_FIXED is
+* set. With HOPTRACE_ENABLE, frames of the traced IDs get the trace trailer
+* before the format is chosen for their length. With CANCRYPT_ENABLE, the
+* payloads of the IDs of cancrypt_can.h are sealed first; the counter of
+* the ID is only used once the TX buffer is known to be free.
+*
+* Parameters:
+*  frame        Frame to send
+*
+* Return:
+*  true if the frame was handed to the controller
+*
+*******************************************************************************/
+static bool canfd_send_frame(const canfd_frame_t *frame)
+{
+    cy_en_canfd_status_t status;
+#if (TXFMT_ENABLE) || (HOPTRACE_ENABLE) || (CANCRYPT_ENABLE)
+    static canfd_frame_t canfd_tx_frame;
+#endif /* TXFMT_ENABLE || HOPTRACE_ENABLE || CANCRYPT_ENABLE */
+#if (TXFMT_ENABLE)
+    txfmt_format_t format;
+#endif /* TXFMT_ENABLE */
+
+    if ((!nm_tx_allowed()) ||
+        (CY_CANFD_TX_BUFFER_PENDING ==
+        Cy_CANFD_GetTxBufferStatus(CANFD_HW, CANFD_HW_CHANNEL,
+                                   CANFD_BUFFER_INDEX)))
+    {
+        STATS_INC(TX_BUSY);
+        return false;
+    }
+
+#if (CANCRYPT_ENABLE)
+    /* Seal the payloads of the listed IDs, on a copy, before the trace
+     * trailer goes on in clear and the format is chosen for the sealed
+     * length */
+    if (cancrypt_can_protected(frame))
+    {
+        canfd_tx_frame = *frame;
+        if (!cancrypt_can_seal(&canfd_tx_frame))
+        {
+            STATS_INC(TX_FAILED);
+            return false;
         }
+        frame = &canfd_tx_frame;
+    }
+#endif /* CANCRYPT_ENABLE */
+
+#if (HOPTRACE_ENABLE)
+    /* TX point of the latency trace, on a copy as the trailer lengthens the
+     * payload */
+    if (hoptrace_traced(frame))
+    {
+        if (frame != &canfd_tx_frame)
+        {
+            canfd_tx_frame = *frame;
+        }
+        hoptrace_on_tx(&canfd_tx_frame);
+        frame = &canfd_tx_frame;
+    }
+#endif /* HOPTRACE_ENABLE */
+
+#if (TXFMT_ENABLE)
+    /* Frames that must keep their format go out as they are */
+    if (0U != (frame->flags & CANFD_FRAME_FLAG_FIXED))
+    {
+        format = canfd_frame_get_format(frame);
+    }
+    else
+    {
+        format = txfmt_choose(frame->id, frame->len,
+                              (0U != (frame->flags & CANFD_FRAME_FLAG_XTD)),
+                              (0U != (frame->flags & CANFD_FRAME_FLAG_RTR)),
+                              canfd_frame_get_format(frame));
+    }
+    if (TXFMT_COUNT == format)
+    {
+        STATS_INC(TXFMT_REFUSED);
+        STATS_INC(TX_FAILED);
+        return false;
+    }
+    if (format != canfd_frame_get_format(frame))
+    {
+        STATS_INC(TXFMT_CHANGED);
+    }
+    if (frame != &canfd_tx_frame)
+    {
+        canfd_tx_frame = *frame;
+    }
+    canfd_frame_set_format(&canfd_tx_frame, format);
+    frame = &canfd_tx_frame;
+#endif /* TXFMT_ENABLE */
+
+    canfd_frame_to_tx_buffer(frame, &canfd_tx_buffer);
+    canfd_tx_t0.esi = CY_CANFD_ESI_ERROR_ACTIVE;
+    canfd_tx_t1.efc = false;
+    canfd_tx_t1.mm = 0U;
+
+    status = Cy_CANFD_UpdateAndTransmitMsgBuffer(CANFD_HW, CANFD_HW_CHANNEL,
+                                                 &canfd_tx_buffer,
+                                                 CANFD_BUFFER_INDEX,
+                                                 &canfd_context);
+
+    if (CY_CANFD_SUCCESS != status)
+    {
+        STATS_INC(TX_FAILED);
+        return false;
     }
+    datarate_can_on_tx();
+    STATS_INC(TX_FRAMES);
+    return true;
 }
 
 /*******************************************************************************
@@ -0,0 +1,732 @@
+/******************************************************************************
+* File Name:   mstream.c
+*
+* Description: This file contains the sender and receiver of the multicast
+*              stream protocol.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "mstream.h"
+#include "stats.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define MSTREAM_SLOT(seq)       ((uint32_t)(seq) & (MSTREAM_WINDOW - 1U))
+
+/* Sequence numbers are 16-bit and compared modulo 2^16 */
+#define MSTREAM_SEQ_DIFF(a, b)  ((uint16_t)((uint16_t)(a) - (uint16_t)(b)))
+#define MSTREAM_SEQ_OLD         (0x8000U)
+
+#define MSTREAM_NACK_SIZE       (8U)
+#define MSTREAM_SYNC_SIZE       (4U)
+
+/*******************************************************************************
+* Function Name: mstream_put16
+********************************************************************************
+* Summary:
+* Stores a 16-bit little-endian field of a frame payload.
+*
+*******************************************************************************/
+static void mstream_put16(uint8_t *dst, uint32_t value)
+{
+    dst[0] = (uint8_t)value;
+    dst[1] = (uint8_t)(value >> 8);
+}
+
+/*******************************************************************************
+* Function Name: mstream_get16
+********************************************************************************
+* Summary:
+* Loads a 16-bit little-endian field of a frame payload.
+*
+*******************************************************************************/
+static uint16_t mstream_get16(const uint8_t *src)
+{
+    return (uint16_t)((uint32_t)src[0] | ((uint32_t)src[1] << 8));
+}
+
+/*******************************************************************************
+* Function Name: mstream_get32
+********************************************************************************
+* Summary:
+* Loads a 32-bit little-endian field of a frame payload.
+*
+*******************************************************************************/
+static uint32_t mstream_get32(const uint8_t *src)
+{
+    return (uint32_t)src[0] | ((uint32_t)src[1] << 8) |
+           ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+/*******************************************************************************
+* Function Name: mstream_frame_init
+********************************************************************************
+* Summary:
+* Prepares an outgoing stream frame: CAN FD with bit rate switching.
+*
+*******************************************************************************/
+static void mstream_frame_init(canfd_frame_t *frame, uint32_t id, uint8_t len)
+{
+    frame->id = id;
+    frame->timestamp = 0U;
+    frame->len = len;
+    frame->flags = CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS;
+}
+
+/*******************************************************************************
+* Function Name: mstream_tx_init
+********************************************************************************
+* Summary:
+* Initializes the sender of a stream.
+*
+* Parameters:
+*  tx           Sender
+*  can_id       CAN ID of the data and sync frames
+*  send         Frame transmit function
+*  now_ms       Current time
+*
+*******************************************************************************/
+void mstream_tx_init(mstream_tx_t *tx, uint32_t can_id,
+                     mstream_send_fn_t send, uint32_t now_ms)
+{
+    memset(tx, 0, sizeof(*tx));
+    tx->can_id = can_id;
+    tx->send = send;
+    tx->last_tx = now_ms;
+}
+
+/*******************************************************************************
+* Function Name: mstream_tx_write
+********************************************************************************
+* Summary:
+* Starts sending a message to all receivers of the stream. The data is split
+* into frames by mstream_tx_poll() and must stay valid until
+* mstream_tx_busy() returns false. The sender never waits for receivers:
+* frames are kept in the retransmission window only as long as it takes to
+* send MSTREAM_WINDOW newer frames.
+*
+* Parameters:
+*  tx           Sender
+*  data         Message
+*  len          Message length in bytes
+*
+* Return:
+*  false if a message is still being sent
+*
+*******************************************************************************/
+bool mstream_tx_write(mstream_tx_t *tx, const uint8_t *data, uint32_t len)
+{
+    if (NULL != tx->msg)
+    {
+        return false;
+    }
+
+    tx->msg_len = len;
+    tx->msg_pos = 0U;
+    tx->msg = data;
+    tx->stats.messages++;
+    tx->stats.bytes += len;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: mstream_tx_busy
+********************************************************************************
+* Summary:
+* Returns true while a message is being split into frames.
+*
+*******************************************************************************/
+bool mstream_tx_busy(const mstream_tx_t *tx)
+{
+    return (NULL != tx->msg);
+}
+
+/*******************************************************************************
+* Function Name: mstream_tx_on_frame
+********************************************************************************
+* Summary:
+* Handles a NACK from any receiver. Every listed frame still in the window is
+* marked for retransmission; NACKs from several receivers simply add up.
+*
+* Parameters:
+*  tx           Sender
+*  frame        Received NACK frame
+*
+*******************************************************************************/
+void mstream_tx_on_frame(mstream_tx_t *tx, const canfd_frame_t *frame)
+{
+    uint16_t base;
+    uint32_t missing;
+
+    if ((frame->len < MSTREAM_NACK_SIZE) ||
+        (MSTREAM_TYPE_NACK != frame->data[0]))
+    {
+        return;
+    }
+
+    tx->stats.nacks++;
+    base = mstream_get16(&frame->data[2]);
+    missing = mstream_get32(&frame->data[4]);
+
+    for (uint32_t bit = 0U; 0U != missing; bit++, missing >>= 1)
+    {
+        uint16_t seq = (uint16_t)(base + bit);
+        uint16_t age = MSTREAM_SEQ_DIFF(tx->next_seq, seq);
+
+        if (0U == (missing & 1U))
+        {
+            continue;
+        }
+
+        if ((0U != age) && (age <= MSTREAM_WINDOW))
+        {
+            tx->resend |= (1UL << MSTREAM_SLOT(seq));
+        }
+        else if ((age > MSTREAM_WINDOW) && (age < MSTREAM_SEQ_OLD))
+        {
+            tx->stats.unrecoverable++;
+            STATS_INC(MSTREAM_GIVEN_UP);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: mstream_tx_poll
+********************************************************************************
+* Summary:
+* Called from the main loop. Sends at most one frame: the oldest NACKed
+* frame, else the next frame of the current message, else a sync frame after
+* MSTREAM_SYNC_MS of idle time.
+*
+* Parameters:
+*  tx           Sender
+*  now_ms       Current time
+*
+*******************************************************************************/
+void mstream_tx_poll(mstream_tx_t *tx, uint32_t now_ms)
+{
+    if (0U != tx->resend)
+    {
+        for (uint32_t age = MSTREAM_WINDOW; age > 0U; age--)
+        {
+            uint32_t slot = MSTREAM_SLOT(tx->next_seq - age);
+
+            if (0U != (tx->resend & (1UL << slot)))
+            {
+                if (tx->send(&tx->window[slot]))
+                {
+                    tx->resend &= ~(1UL << slot);
+                    tx->stats.retransmits++;
+                    STATS_INC(MSTREAM_RESENT);
+                    tx->last_tx = now_ms;
+                }
+                return;
+            }
+        }
+    }
+
+    if (NULL != tx->msg)
+    {
+        canfd_frame_t *frame = &tx->window[MSTREAM_SLOT(tx->next_seq)];
+        uint32_t chunk = tx->msg_len - tx->msg_pos;
+        uint8_t flags = 0U;
+
+        if (chunk > MSTREAM_PAYLOAD_MAX)
+        {
+            chunk = MSTREAM_PAYLOAD_MAX;
+        }
+        if (0U == tx->msg_pos)
+        {
+            flags |= MSTREAM_FLAG_FIRST;
+        }
+        if ((tx->msg_pos + chunk) == tx->msg_len)
+        {
+            flags |= MSTREAM_FLAG_LAST;
+        }
+
+        mstream_frame_init(frame, tx->can_id,
+                           (uint8_t)(MSTREAM_HEADER_SIZE + chunk));
+        frame->data[0] = MSTREAM_TYPE_DATA;
+        frame->data[1] = flags;
+        mstream_put16(&frame->data[2], tx->next_seq);
+        frame->data[4] = (uint8_t)chunk;
+        memcpy(&frame->data[MSTREAM_HEADER_SIZE], &tx->msg[tx->msg_pos],
+               chunk);
+
+        if (tx->send(frame))
+        {
+            tx->next_seq++;
+            tx->msg_pos += chunk;
+            tx->stats.frames++;
+            tx->syncs = MSTREAM_NACK_RETRIES;
+            tx->last_tx = now_ms;
+            if (tx->msg_pos == tx->msg_len)
+            {
+                tx->msg = NULL;
+            }
+        }
+        return;
+    }
+
+    if ((0U != tx->syncs) &&
+        ((now_ms - tx->last_tx) >= MSTREAM_SYNC_MS))
+    {
+        canfd_frame_t frame;
+
+        mstream_frame_init(&frame, tx->can_id, MSTREAM_SYNC_SIZE);
+        frame.data[0] = MSTREAM_TYPE_SYNC;
+        frame.data[1] = 0U;
+        mstream_put16(&frame.data[2], tx->next_seq);
+
+        if (tx->send(&frame))
+        {
+            tx->syncs--;
+            tx->last_tx = now_ms;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: mstream_tx_report
+********************************************************************************
+* Summary:
+* Prints the sender counters on the debug UART.
+*
+*******************************************************************************/
+void mstream_tx_report(const mstream_tx_t *tx)
+{
+    printf("Stream tx: %lu messages, %lu bytes, %lu frames, %lu retransmits, "
+           "%lu NACKs, %lu unrecoverable\r\n\r\n",
+           (unsigned long)tx->stats.messages, (unsigned long)tx->stats.bytes,
+           (unsigned long)tx->stats.frames,
+           (unsigned long)tx->stats.retransmits,
+           (unsigned long)tx->stats.nacks,
+           (unsigned long)tx->stats.unrecoverable);
+}
+
+/*******************************************************************************
+* Function Name: mstream_rx_init
+********************************************************************************
+* Summary:
+* Initializes a receiver of a stream.
+*
+* Parameters:
+*  rx           Receiver
+*  can_id       CAN ID of the data and sync frames of the stream
+*  node         Receiver number, 1 to 8
+*  nack_id      CAN ID of the NACKs of this receiver; must be unique on the
+*               bus, as several receivers can NACK at the same time
+*  send         Frame transmit function
+*  buf          Reassembly buffer, holds the largest message
+*  size         Size of the reassembly buffer
+*  on_message   Called with every reassembled message
+*
+*******************************************************************************/
+void mstream_rx_init(mstream_rx_t *rx, uint32_t can_id, uint8_t node,
+                     uint32_t nack_id, mstream_send_fn_t send,
+                     uint8_t *buf, uint32_t size,
+                     mstream_message_fn_t on_message)
+{
+    memset(rx, 0, sizeof(*rx));
+    rx->can_id = can_id;
+    rx->node = node;
+    rx->nack_id = nack_id;
+    rx->send = send;
+    rx->msg = buf;
+    rx->msg_size = size;
+    rx->on_message = on_message;
+    rx->rand = 0x9E3779B9UL ^ node;
+}
+
+/*******************************************************************************
+* Function Name: mstream_rx_message_end
+********************************************************************************
+* Summary:
+* Passes the message being reassembled to the application.
+*
+*******************************************************************************/
+static void mstream_rx_message_end(mstream_rx_t *rx, bool ok)
+{
+    if (ok)
+    {
+        rx->stats.messages_ok++;
+        rx->stats.bytes += rx->msg_len;
+    }
+    else
+    {
+        rx->stats.messages_bad++;
+        STATS_INC(MSTREAM_MSG_BAD);
+    }
+
+    rx->msg_valid = false;
+    rx->on_message(rx->msg, rx->msg_len, ok);
+}
+
+/*******************************************************************************
+* Function Name: mstream_rx_deliver
+********************************************************************************
+* Summary:
+* Appends the payload of the next in-order data frame to the message being
+* reassembled. Frames before the first frame of a message are skipped.
+*
+*******************************************************************************/
+static void mstream_rx_deliver(mstream_rx_t *rx, const canfd_frame_t *frame)
+{
+    uint8_t flags = frame->data[1];
+    uint32_t len = frame->data[4];
+
+    if (len > (uint32_t)(frame->len - MSTREAM_HEADER_SIZE))
+    {
+        len = (uint32_t)(frame->len - MSTREAM_HEADER_SIZE);
+    }
+
+    if (0U != (flags & MSTREAM_FLAG_FIRST))
+    {
+        if (rx->msg_valid)
+        {
+            /* The last frame of the previous message was lost */
+            mstream_rx_message_end(rx, false);
+        }
+        rx->msg_len = 0U;
+        rx->msg_valid = true;
+    }
+
+    if (!rx->msg_valid)
+    {
+        return;
+    }
+
+    if ((rx->msg_len + len) > rx->msg_size)
+    {
+        mstream_rx_message_end(rx, false);
+        return;
+    }
+
+    memcpy(&rx->msg[rx->msg_len], &frame->data[MSTREAM_HEADER_SIZE], len);
+    rx->msg_len += len;
+
+    if (0U != (flags & MSTREAM_FLAG_LAST))
+    {
+        mstream_rx_message_end(rx, true);
+    }
+}
+
+/*******************************************************************************
+* Function Name: mstream_rx_advance
+********************************************************************************
+* Summary:
+* Moves the window forward by count frames. Held frames are delivered in
+* order; frames not held are given up as lost, which also ends the message
+* being reassembled as incomplete.
+*
+*******************************************************************************/
+static void mstream_rx_advance(mstream_rx_t *rx, uint32_t count)
+{
+    uint32_t skipped = 0U;
+
+    if (count > MSTREAM_WINDOW)
+    {
+        skipped = count - MSTREAM_WINDOW;
+        count = MSTREAM_WINDOW;
+    }
+
+    for (uint32_t idx = 0U; idx < count; idx++)
+    {
+        if (0U != (rx->received & 1U))
+        {
+            mstream_rx_deliver(rx, &rx->window[MSTREAM_SLOT(rx->expected)]);
+        }
+        else
+        {
+            rx->stats.lost++;
+            STATS_INC(MSTREAM_RX_LOST);
+            if (rx->msg_valid)
+            {
+                mstream_rx_message_end(rx, false);
+            }
+        }
+        rx->received >>= 1;
+        rx->expected++;
+        rx->retries = 0U;
+    }
+
+    if (0U != skipped)
+    {
+        rx->stats.lost += skipped;
+        STATS_ADD(MSTREAM_RX_LOST, skipped);
+        rx->expected = (uint16_t)(rx->expected + skipped);
+        if (rx->msg_valid)
+        {
+            mstream_rx_message_end(rx, false);
+        }
+    }
+
+    if (MSTREAM_SEQ_DIFF(rx->highest, rx->expected) >= MSTREAM_SEQ_OLD)
+    {
+        rx->highest = rx->expected;
+    }
+}
+
+/*******************************************************************************
+* Function Name: mstream_rx_loss
+********************************************************************************
+* Summary:
+* Loss injection: returns true for about MSTREAM_LOSS_PERMILLE of 1000 calls.
+*
+*******************************************************************************/
+static bool mstream_rx_loss(mstream_rx_t *rx)
+{
+#if (MSTREAM_LOSS_PERMILLE > 0U)
+    /* xorshift32 */
+    rx->rand ^= rx->rand << 13;
+    rx->rand ^= rx->rand >> 17;
+    rx->rand ^= rx->rand << 5;
+
+    return ((rx->rand % 1000U) < MSTREAM_LOSS_PERMILLE);
+#else
+    CY_UNUSED_PARAMETER(rx);
+    return false;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: mstream_rx_on_frame
+********************************************************************************
+* Summary:
+* Handles a data or sync frame of the stream. Frames can arrive out of order
+* after retransmissions; they are held in the window and delivered in
+* sequence order.
+*
+* Parameters:
+*  rx           Receiver
+*  frame        Received frame
+*  now_ms       Current time
+*
+*******************************************************************************/
+void mstream_rx_on_frame(mstream_rx_t *rx, const canfd_frame_t *frame,
+                         uint32_t now_ms)
+{
+    uint16_t seq;
+    uint16_t dist;
+
+    if ((frame->id != rx->can_id) || (frame->len < MSTREAM_SYNC_SIZE))
+    {
+        return;
+    }
+
+    seq = mstream_get16(&frame->data[2]);
+
+    if (MSTREAM_TYPE_SYNC == frame->data[0])
+    {
+        /* seq is the next frame the sender will send */
+        if (!rx->started)
+        {
+            rx->started = true;
+            rx->expected = seq;
+            rx->highest = seq;
+            rx->stats.last = now_ms;
+        }
+        else if (MSTREAM_SEQ_DIFF(seq, rx->expected) <= MSTREAM_SEQ_OLD)
+        {
+            if (MSTREAM_SEQ_DIFF(seq, rx->expected) >
+                MSTREAM_SEQ_DIFF(rx->highest, rx->expected))
+            {
+                rx->highest = seq;
+            }
+        }
+        return;
+    }
+
+    if ((MSTREAM_TYPE_DATA != frame->data[0]) ||
+        (frame->len < MSTREAM_HEADER_SIZE))
+    {
+        return;
+    }
+
+    if (mstream_rx_loss(rx))
+    {
+        rx->stats.injected++;
+        return;
+    }
+
+    if (!rx->started)
+    {
+        rx->started = true;
+        rx->expected = seq;
+        rx->highest = seq;
+        rx->stats.last = now_ms;
+    }
+
+    dist = MSTREAM_SEQ_DIFF(seq, rx->expected);
+    if (dist >= MSTREAM_SEQ_OLD)
+    {
+        rx->stats.duplicates++;
+        return;
+    }
+
+    if (dist >= MSTREAM_WINDOW)
+    {
+        /* Too far ahead: give up the oldest frames to make room */
+        mstream_rx_advance(rx, (uint32_t)dist - MSTREAM_WINDOW + 1U);
+        dist = MSTREAM_WINDOW - 1U;
+    }
+
+    if (0U != (rx->received & (1UL << dist)))
+    {
+        rx->stats.duplicates++;
+        return;
+    }
+
+    rx->window[MSTREAM_SLOT(seq)] = *frame;
+    rx->received |= (1UL << dist);
+    rx->stats.frames++;
+
+    if ((uint32_t)dist >= MSTREAM_SEQ_DIFF(rx->highest, rx->expected))
+    {
+        rx->highest = (uint16_t)(seq + 1U);
+    }
+
+    /* Deliver the frames that are now in order */
+    while (0U != (rx->received & 1U))
+    {
+        mstream_rx_advance(rx, 1U);
+    }
+}
+
+/*******************************************************************************
+* Function Name: mstream_rx_poll
+********************************************************************************
+* Summary:
+* Called from the main loop. If frames are missing, sends a NACK listing all
+* of them, at most once per MSTREAM_NACK_HOLDOFF_MS. The oldest missing frame
+* is given up after MSTREAM_NACK_RETRIES NACKs.
+*
+* Parameters:
+*  rx           Receiver
+*  now_ms       Current time
+*
+*******************************************************************************/
+void mstream_rx_poll(mstream_rx_t *rx, uint32_t now_ms)
+{
+    uint32_t span;
+    uint32_t missing;
+    canfd_frame_t frame;
+
+    if (!rx->started)
+    {
+        return;
+    }
+
+    /* Time base of the goodput */
+    rx->stats.ms += (now_ms - rx->stats.last);
+    rx->stats.last = now_ms;
+
+    span = MSTREAM_SEQ_DIFF(rx->highest, rx->expected);
+    if ((0U == span) ||
+        ((now_ms - rx->last_nack) < MSTREAM_NACK_HOLDOFF_MS))
+    {
+        return;
+    }
+
+    if (rx->retries >= MSTREAM_NACK_RETRIES)
+    {
+        mstream_rx_advance(rx, 1U);
+        while (0U != (rx->received & 1U))
+        {
+            mstream_rx_advance(rx, 1U);
+        }
+        return;
+    }
+
+    missing = ~rx->received;
+    if (span < 32U)
+    {
+        missing &= (1UL << span) - 1U;
+    }
+
+    mstream_frame_init(&frame, rx->nack_id, MSTREAM_NACK_SIZE);
+    frame.data[0] = MSTREAM_TYPE_NACK;
+    frame.data[1] = rx->node;
+    mstream_put16(&frame.data[2], rx->expected);
+    mstream_put16(&frame.data[4], missing);
+    mstream_put16(&frame.data[6], missing >> 16);
+
+    if (rx->send(&frame))
+    {
+        rx->retries++;
+        rx->last_nack = now_ms;
+        rx->stats.nacks++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: mstream_rx_report
+********************************************************************************
+* Summary:
+* Prints the receiver counters and the goodput, the bytes of complete
+* messages per second since the first frame, on the debug UART.
+*
+*******************************************************************************/
+void mstream_rx_report(const mstream_rx_t *rx)
+{
+    uint32_t ms = rx->stats.ms;
+    uint32_t goodput = 0U;
+
+    if (0U != ms)
+    {
+        goodput = (uint32_t)(((uint64_t)rx->stats.bytes * 1000U) / ms);
+    }
+
+    printf("Stream rx node %u: %lu messages ok, %lu bad, %lu frames, "
+           "%lu lost, %lu duplicates, %lu NACKs, %lu injected, "
+           "goodput %lu bytes/s\r\n\r\n", rx->node,
+           (unsigned long)rx->stats.messages_ok,
+           (unsigned long)rx->stats.messages_bad,
+           (unsigned long)rx->stats.frames, (unsigned long)rx->stats.lost,
+           (unsigned long)rx->stats.duplicates, (unsigned long)rx->stats.nacks,
+           (unsigned long)rx->stats.injected, (unsigned long)goodput);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,210 @@
+/******************************************************************************
+* File Name:   mstream.h
+*
+* Description: This file contains the interface of the multicast stream
+*              protocol: sequence-numbered frames, NACKs from receivers and a
+*              retransmission window at the sender.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef MSTREAM_H_
+#define MSTREAM_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "canfd_frame.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Frames kept by the sender for retransmission, and frames a receiver can
+ * hold out of order. Must be a power of two, at most 32. */
+#ifndef MSTREAM_WINDOW
+#define MSTREAM_WINDOW          (32U)
+#endif
+
+#if ((MSTREAM_WINDOW & (MSTREAM_WINDOW - 1U)) != 0U) || (MSTREAM_WINDOW > 32U)
+#error "MSTREAM_WINDOW must be a power of two, at most 32"
+#endif
+
+/* Minimum time between two NACKs of one receiver */
+#ifndef MSTREAM_NACK_HOLDOFF_MS
+#define MSTREAM_NACK_HOLDOFF_MS (2U)
+#endif
+
+/* NACKs sent for the oldest missing frame before it is given up as lost */
+#ifndef MSTREAM_NACK_RETRIES
+#define MSTREAM_NACK_RETRIES    (4U)
+#endif
+
+/* Idle time after which the sender announces its next sequence number, so
+ * that receivers detect the loss of the last frames of a burst */
+#ifndef MSTREAM_SYNC_MS
+#define MSTREAM_SYNC_MS         (10U)
+#endif
+
+/* Received data frames a receiver discards on purpose, in 1/1000, to test
+ * recovery. 0 disables the loss injection. */
+#ifndef MSTREAM_LOSS_PERMILLE
+#define MSTREAM_LOSS_PERMILLE   (0U)
+#endif
+
+/* Frame types, first payload byte */
+#define MSTREAM_TYPE_DATA       (0x01U)
+#define MSTREAM_TYPE_SYNC       (0x02U)
+#define MSTREAM_TYPE_NACK       (0x03U)
+
+/* Data frame flags */
+#define MSTREAM_FLAG_FIRST      (0x01U)     /* First frame of a message */
+#define MSTREAM_FLAG_LAST       (0x02U)     /* Last frame of a message */
+
+/* Data frame layout: type, flags, sequence (16-bit LE), payload length */
+#define MSTREAM_HEADER_SIZE     (5U)
+#define MSTREAM_PAYLOAD_MAX     (CANFD_MAX_DATA_LEN - MSTREAM_HEADER_SIZE)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Sends one frame. Returns false if the controller cannot take it now; the
+ * stream then retries on the next poll. */
+typedef bool (*mstream_send_fn_t)(const canfd_frame_t *frame);
+
+/* Receives the reassembled messages of a stream. ok is false if frames of the
+ * message were lost; data then holds only the part received before the loss. */
+typedef void (*mstream_message_fn_t)(const uint8_t *data, uint32_t len,
+                                     bool ok);
+
+/* Sender counters */
+typedef struct
+{
+    uint32_t frames;                /* Data frames sent, first time */
+    uint32_t retransmits;           /* Data frames sent again on NACK */
+    uint32_t nacks;                 /* NACKs received */
+    uint32_t unrecoverable;         /* NACKed frames no longer in the window */
+    uint32_t messages;              /* Messages sent */
+    uint32_t bytes;                 /* Message bytes sent */
+} mstream_tx_stats_t;
+
+/* Sender of one stream */
+typedef struct
+{
+    uint32_t            can_id;     /* ID of the data and sync frames */
+    mstream_send_fn_t   send;
+    uint16_t            next_seq;   /* Sequence number of the next new frame */
+    uint32_t            resend;     /* Window slots NACKed, bit per slot */
+    uint32_t            last_tx;    /* Time of the last frame sent, ms */
+    uint8_t             syncs;      /* Sync frames left to send when idle */
+    const uint8_t      *msg;        /* Message being sent, NULL when idle */
+    uint32_t            msg_len;
+    uint32_t            msg_pos;
+    canfd_frame_t       window[MSTREAM_WINDOW];
+    mstream_tx_stats_t  stats;
+} mstream_tx_t;
+
+/* Receiver counters */
+typedef struct
+{
+    uint32_t frames;                /* Data frames accepted */
+    uint32_t duplicates;            /* Data frames received more than once */
+    uint32_t injected;              /* Data frames dropped by loss injection */
+    uint32_t nacks;                 /* NACKs sent */
+    uint32_t lost;                  /* Frames given up as lost */
+    uint32_t messages_ok;           /* Messages delivered complete */
+    uint32_t messages_bad;          /* Messages delivered with a loss */
+    uint32_t bytes;                 /* Bytes of complete messages */
+    uint32_t ms;                    /* Time since the first frame */
+    uint32_t last;                  /* Time when ms was updated */
+} mstream_rx_stats_t;
+
+/* Receiver of one stream */
+typedef struct
+{
+    uint32_t             can_id;    /* ID of the data and sync frames */
+    uint32_t             nack_id;   /* ID of the NACKs of this receiver */
+    uint8_t              node;      /* Receiver number, sent with NACKs */
+    mstream_send_fn_t    send;
+    mstream_message_fn_t on_message;
+    bool                 started;   /* First frame seen */
+    uint16_t             expected;  /* Next sequence number to deliver */
+    uint16_t             highest;   /* Next sequence number after the newest
+                                     * frame known to exist */
+    uint32_t             received;  /* Frames held, bit n = expected + n */
+    uint32_t             last_nack; /* Time of the last NACK, ms */
+    uint32_t             retries;   /* NACKs sent for expected */
+    uint32_t             rand;      /* Loss injection state */
+    uint8_t             *msg;       /* Reassembly buffer */
+    uint32_t             msg_size;
+    uint32_t             msg_len;
+    bool                 msg_valid; /* No loss since the first frame */
+    canfd_frame_t        window[MSTREAM_WINDOW];
+    mstream_rx_stats_t   stats;
+} mstream_rx_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void mstream_tx_init(mstream_tx_t *tx, uint32_t can_id,
+                     mstream_send_fn_t send, uint32_t now_ms);
+bool mstream_tx_write(mstream_tx_t *tx, const uint8_t *data, uint32_t len);
+bool mstream_tx_busy(const mstream_tx_t *tx);
+void mstream_tx_on_frame(mstream_tx_t *tx, const canfd_frame_t *frame);
+void mstream_tx_poll(mstream_tx_t *tx, uint32_t now_ms);
+void mstream_tx_report(const mstream_tx_t *tx);
+
+void mstream_rx_init(mstream_rx_t *rx, uint32_t can_id, uint8_t node,
+                     uint32_t nack_id, mstream_send_fn_t send,
+                     uint8_t *buf, uint32_t size,
+                     mstream_message_fn_t on_message);
+void mstream_rx_on_frame(mstream_rx_t *rx, const canfd_frame_t *frame,
+                         uint32_t now_ms);
+void mstream_rx_poll(mstream_rx_t *rx, uint32_t now_ms);
+void mstream_rx_report(const mstream_rx_t *rx);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* MSTREAM_H_ */
+
+/* [] END OF FILE */
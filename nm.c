@@ -0,0 +1,859 @@
+/******************************************************************************
+* File Name:   nm.c
+*
+* Description: This file contains network management: the CanNm-like state
+*              machine, bus sleep with wake-up on CAN activity, and state
+*              residency and wake-up latency statistics.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "cybsp.h"
+#include "nm.h"
+#include "stats.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define NM_STATE_NAME(name, text)   [NM_STATE_##name] = text,
+
+#define NM_WAKE_PATTERN(name, id, id_mask, value, mask)                        \
+    [NM_WAKE_##name] = { (id), (id_mask), (value), (mask) },
+
+/* Classic filter element: passes IDs with (ID ^ sfid1) & sfid2 == 0 */
+#define NM_WAKE_FILTER(name, id, id_mask, value, mask)                         \
+    [NM_WAKE_##name] = { .sfid2 = (id_mask), .sfid1 = (id),                    \
+                         .sfec = CY_CANFD_SFEC_STORE_RX_FIFO_0,                \
+                         .sft = CY_CANFD_SFT_CLASSIC_FILTER },
+
+/* Index into nm_latency */
+#define NM_WAKE_BUS             (0U)
+#define NM_WAKE_LOCAL           (1U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Payload part of a wake-up frame */
+typedef struct
+{
+    uint32_t id;
+    uint32_t id_mask;
+    uint64_t value;
+    uint64_t mask;
+} nm_wake_pattern_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const nm_wake_pattern_t nm_wake_patterns[NM_WAKE_COUNT] =
+{
+    NM_WAKE_LIST(NM_WAKE_PATTERN)
+};
+
+/* Channel configuration during selective bus sleep: only the wake-up IDs
+ * pass, all other frames are rejected without interrupting the CPU */
+static const cy_stc_id_filter_t nm_wake_filters[NM_WAKE_COUNT] =
+{
+    NM_WAKE_LIST(NM_WAKE_FILTER)
+};
+
+static const cy_stc_canfd_sid_filter_config_t nm_wake_sid_config =
+{
+    .numberOfSIDFilters = (uint32_t)NM_WAKE_COUNT,
+    .sidFilter = nm_wake_filters
+};
+
+static const cy_stc_canfd_global_filter_config_t nm_wake_global_config =
+{
+    .nonMatchingFramesStandard = CY_CANFD_REJECT_NON_MATCHING,
+    .nonMatchingFramesExtended = CY_CANFD_REJECT_NON_MATCHING,
+    .rejectRemoteFramesStandard = true,
+    .rejectRemoteFramesExtended = true
+};
+
+static cy_stc_canfd_config_t nm_wake_channel_config;
+
+#if (NM_ENABLE)
+static CANFD_Type                   *nm_base;
+static uint32_t                      nm_chan;
+static const cy_stc_canfd_config_t  *nm_config;
+static cy_stc_canfd_context_t       *nm_context;
+static uint32_t                      nm_irq_mask;   /* Set by the application */
+static uint8_t                       nm_node;
+static nm_send_fn_t                  nm_send;
+
+static nm_state_t   nm_state;
+static bool         nm_requested;
+static bool         nm_active_wakeup;   /* This node woke the network */
+static bool         nm_pdu_received;    /* Since the last nm_poll() */
+static bool         nm_repeat_received;
+
+/* Timers, in nm_tick_ms */
+static uint32_t     nm_timeout_start;
+static uint32_t     nm_repeat_start;
+static uint32_t     nm_wait_start;
+static uint32_t     nm_next_tx;
+
+/* 1 ms time base, kept by SysTick. It also runs while the CPU sleeps, unlike
+ * the cycle counter. */
+static volatile uint32_t nm_tick_ms;
+
+/* Wake-up from the CAN RX pin */
+static volatile bool     nm_wake_pending;
+static uint64_t          nm_wake_time;
+
+/* Wake-up to first frame measurement, in microseconds */
+static volatile bool     nm_latency_armed;
+static volatile bool     nm_latency_done;
+static uint32_t          nm_latency_source;
+static uint64_t          nm_latency_start;
+static uint64_t          nm_latency_end;
+static nm_latency_t      nm_latency[2];
+
+/* Time spent in each state and with the CPU asleep, in microseconds */
+static uint64_t          nm_start_time;
+static uint64_t          nm_state_since;
+static uint64_t          nm_state_time[NM_STATE_COUNT];
+static uint64_t          nm_cpu_sleep_time;
+
+/* The NM messages sent and received, the frames that passed the wake-up
+ * filters during bus sleep, and those among them that did not match a
+ * payload pattern, are counted in the statistics registry of stats.h */
+static uint32_t          nm_wakeups[2];
+
+static const char * const nm_state_names[NM_STATE_COUNT] =
+{
+    NM_STATE_LIST(NM_STATE_NAME)
+};
+
+/*******************************************************************************
+* Function Name: nm_systick_isr
+********************************************************************************
+* Summary:
+* SysTick callback, advances the millisecond time base.
+*
+*******************************************************************************/
+static void nm_systick_isr(void)
+{
+    nm_tick_ms++;
+}
+
+/*******************************************************************************
+* Function Name: nm_clock_us
+********************************************************************************
+* Summary:
+* Returns the time since start-up in microseconds, from the millisecond count
+* and the SysTick counter. Also correct in an interrupt handler that blocks
+* the SysTick callback.
+*
+*******************************************************************************/
+static uint64_t nm_clock_us(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t ms;
+    uint32_t val;
+    uint32_t load;
+
+    __disable_irq();
+    ms = nm_tick_ms;
+    val = SysTick->VAL;
+    load = SysTick->LOAD;
+    if ((0U != (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)) && (val > (load / 2U)))
+    {
+        /* Counter wrapped but the callback has not run yet */
+        ms++;
+    }
+    __set_PRIMASK(primask);
+
+    return ((uint64_t)ms * 1000U) +
+           ((load - val) / (SystemCoreClock / 1000000U));
+}
+
+/*******************************************************************************
+* Function Name: nm_latency_stop
+********************************************************************************
+* Summary:
+* Ends a running wake-up latency measurement. Called from the RX interrupt
+* and from the main loop.
+*
+*******************************************************************************/
+static void nm_latency_stop(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (nm_latency_armed)
+    {
+        nm_latency_end = nm_clock_us();
+        nm_latency_armed = false;
+        nm_latency_done = true;
+    }
+    __set_PRIMASK(primask);
+}
+
+/*******************************************************************************
+* Function Name: nm_bus_start
+********************************************************************************
+* Summary:
+* Restarts the CAN FD channel with the application configuration, and
+* disarms the wake-up pin.
+*
+*******************************************************************************/
+static void nm_bus_start(void)
+{
+    cy_en_canfd_status_t status;
+
+#if (NM_WAKE_SELECTIVE)
+    (void)Cy_CANFD_DeInit(nm_base, nm_chan, nm_context);
+#else
+    Cy_GPIO_SetInterruptMask(CYBSP_CAN_RX_PORT, CYBSP_CAN_RX_PIN,
+                             CY_GPIO_INTR_DIS_MASK);
+    (void)Cy_CANFD_Enable(nm_base, 1UL << nm_chan);
+#endif /* NM_WAKE_SELECTIVE */
+    status = Cy_CANFD_Init(nm_base, nm_chan, nm_config, nm_context);
+    CY_ASSERT(CY_CANFD_SUCCESS == status);
+    CY_UNUSED_PARAMETER(status);
+    Cy_CANFD_SetInterruptMask(nm_base, nm_chan, nm_irq_mask);
+}
+
+/*******************************************************************************
+* Function Name: nm_bus_stop
+********************************************************************************
+* Summary:
+* With selective wake-up, restarts the channel with the wake-up filters.
+* Otherwise stops the clock of the channel and arms the wake-up pin. The
+* controller cannot receive while stopped, so the first falling edge on the
+* RX pin, the start of frame of any frame on the bus, wakes the node.
+*
+*******************************************************************************/
+static void nm_bus_stop(void)
+{
+#if (NM_WAKE_SELECTIVE)
+    cy_en_canfd_status_t status;
+
+    (void)Cy_CANFD_DeInit(nm_base, nm_chan, nm_context);
+    nm_wake_pending = false;
+    status = Cy_CANFD_Init(nm_base, nm_chan, nm_wake_config(nm_config),
+                           nm_context);
+    CY_ASSERT(CY_CANFD_SUCCESS == status);
+    CY_UNUSED_PARAMETER(status);
+    Cy_CANFD_SetInterruptMask(nm_base, nm_chan, nm_irq_mask);
+#else
+    (void)Cy_CANFD_DeInit(nm_base, nm_chan, nm_context);
+    (void)Cy_CANFD_Disable(nm_base, 1UL << nm_chan);
+
+    nm_wake_pending = false;
+    Cy_GPIO_ClearInterrupt(CYBSP_CAN_RX_PORT, CYBSP_CAN_RX_PIN);
+    Cy_GPIO_SetInterruptEdge(CYBSP_CAN_RX_PORT, CYBSP_CAN_RX_PIN,
+                             CY_GPIO_INTR_FALLING);
+    Cy_GPIO_SetInterruptMask(CYBSP_CAN_RX_PORT, CYBSP_CAN_RX_PIN,
+                             CY_GPIO_INTR_EN_MASK);
+#endif /* NM_WAKE_SELECTIVE */
+}
+
+/*******************************************************************************
+* Function Name: nm_enter
+********************************************************************************
+* Summary:
+* Changes state, accounting the time spent in the previous one.
+*
+*******************************************************************************/
+static void nm_enter(nm_state_t state)
+{
+    uint64_t now = nm_clock_us();
+    uint32_t tick = nm_tick_ms;
+
+    nm_state_time[nm_state] += now - nm_state_since;
+    nm_state_since = now;
+
+    switch (state)
+    {
+        case NM_STATE_BUS_SLEEP:
+            nm_active_wakeup = false;
+            nm_bus_stop();
+            break;
+
+        case NM_STATE_PREPARE_BUS_SLEEP:
+            nm_wait_start = tick;
+            break;
+
+        case NM_STATE_REPEAT_MESSAGE:
+            if (NM_STATE_BUS_SLEEP == nm_state)
+            {
+                nm_bus_start();
+            }
+            nm_repeat_start = tick;
+            nm_timeout_start = tick;
+            nm_next_tx = tick;
+            break;
+
+        case NM_STATE_NORMAL_OPERATION:
+            if (NM_STATE_READY_SLEEP == nm_state)
+            {
+                nm_next_tx = tick;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    nm_state = state;
+}
+
+/*******************************************************************************
+* Function Name: nm_transmit
+********************************************************************************
+* Summary:
+* Sends the NM message of this node once per NM_MSG_CYCLE_MS.
+*
+*******************************************************************************/
+static void nm_transmit(uint32_t tick)
+{
+    canfd_frame_t frame;
+
+    if ((int32_t)(tick - nm_next_tx) < 0)
+    {
+        return;
+    }
+
+    frame.id = NM_BASE_ID + nm_node;
+    frame.timestamp = 0U;
+    frame.flags = 0U;
+    frame.len = NM_PDU_SIZE;
+    frame.data[0] = nm_node;
+    frame.data[1] = NM_CBV_PNI |
+                    (nm_active_wakeup ? NM_CBV_ACTIVE_WAKEUP : 0U);
+    frame.data[NM_PN_INFO_BYTE] = NM_PN_CLUSTER;
+    for (uint32_t idx = NM_PN_INFO_BYTE + 1U; idx < NM_PDU_SIZE; idx++)
+    {
+        frame.data[idx] = 0xFFU;
+    }
+
+    if (nm_send(&frame))
+    {
+        STATS_INC(NM_PDU_TX);
+        nm_next_tx = tick + NM_MSG_CYCLE_MS;
+        nm_timeout_start = tick;
+        nm_latency_stop();
+    }
+}
+#endif /* NM_ENABLE */
+
+/*******************************************************************************
+* Function Name: nm_init
+********************************************************************************
+* Summary:
+* Starts the time base and joins the network in the repeat message state.
+*
+* Parameters:
+*  base         CAN FD block
+*  chan         CAN FD channel, initialized, with its interrupts enabled;
+*               they are enabled again after each restart
+*  config       Channel configuration, used to restart it after bus sleep
+*  context      Channel context
+*  node         Node number of this board, 0 to NM_NODE_MAX
+*  send         Frame transmit function
+*
+*******************************************************************************/
+void nm_init(CANFD_Type *base, uint32_t chan,
+             const cy_stc_canfd_config_t *config,
+             cy_stc_canfd_context_t *context, uint8_t node, nm_send_fn_t send)
+{
+#if (NM_ENABLE)
+    CY_ASSERT(node <= NM_NODE_MAX);
+
+    nm_base = base;
+    nm_chan = chan;
+    nm_config = config;
+    nm_context = context;
+    nm_irq_mask = Cy_CANFD_GetInterruptMask(base, chan);
+    nm_node = node;
+    nm_send = send;
+
+    Cy_SysTick_Init(CY_SYSTICK_CLOCK_SOURCE_CLK_CPU,
+                    (SystemCoreClock / 1000U) - 1U);
+    (void)Cy_SysTick_SetCallback(0U, nm_systick_isr);
+
+    nm_start_time = nm_clock_us();
+    nm_state_since = nm_start_time;
+    nm_state = NM_STATE_REPEAT_MESSAGE;
+    nm_enter(NM_STATE_REPEAT_MESSAGE);
+#else
+    CY_UNUSED_PARAMETER(base);
+    CY_UNUSED_PARAMETER(chan);
+    CY_UNUSED_PARAMETER(config);
+    CY_UNUSED_PARAMETER(context);
+    CY_UNUSED_PARAMETER(node);
+    CY_UNUSED_PARAMETER(send);
+#endif /* NM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: nm_network_request
+********************************************************************************
+* Summary:
+* Keeps the network awake, waking it up if it is asleep. Can be called
+* repeatedly.
+*
+*******************************************************************************/
+void nm_network_request(void)
+{
+#if (NM_ENABLE)
+    if (!nm_requested && (NM_STATE_BUS_SLEEP == nm_state))
+    {
+        nm_latency_start = nm_clock_us();
+    }
+    nm_requested = true;
+#endif /* NM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: nm_network_release
+********************************************************************************
+* Summary:
+* Lets the network go to sleep once no other node needs it.
+*
+*******************************************************************************/
+void nm_network_release(void)
+{
+#if (NM_ENABLE)
+    nm_requested = false;
+#endif /* NM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: nm_tx_allowed
+********************************************************************************
+* Summary:
+* Returns true if application frames may be sent. Sending stops once the
+* node prepares for bus sleep.
+*
+*******************************************************************************/
+bool nm_tx_allowed(void)
+{
+#if (NM_ENABLE)
+    return (NM_STATE_REPEAT_MESSAGE == nm_state) ||
+           (NM_STATE_NORMAL_OPERATION == nm_state) ||
+           (NM_STATE_READY_SLEEP == nm_state);
+#else
+    return true;
+#endif /* NM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: nm_on_frame
+********************************************************************************
+* Summary:
+* Handles an NM message of another node.
+*
+* Parameters:
+*  frame        Received frame with an ID in the NM range
+*
+*******************************************************************************/
+void nm_on_frame(const canfd_frame_t *frame)
+{
+#if (NM_ENABLE)
+    if (((frame->id & ~NM_NODE_MAX) != NM_BASE_ID) || (frame->len < 2U) ||
+        (frame->data[0] == nm_node))
+    {
+        return;
+    }
+
+    STATS_INC(NM_PDU_RX);
+    nm_pdu_received = true;
+    if (0U != (frame->data[1] & NM_CBV_REPEAT_MESSAGE))
+    {
+        nm_repeat_received = true;
+    }
+#else
+    CY_UNUSED_PARAMETER(frame);
+#endif /* NM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: nm_on_rx_isr
+********************************************************************************
+* Summary:
+* Called from the RX callback for every received frame. During selective
+* bus sleep, only frames that passed the wake-up filters get here; they wake
+* the node if their payload matches. Otherwise ends the wake-up latency
+* measurement at the first frame after a wake-up.
+*
+* Parameters:
+*  frame        Received frame
+*
+*******************************************************************************/
+void nm_on_rx_isr(const canfd_frame_t *frame)
+{
+#if (NM_ENABLE)
+#if (NM_WAKE_SELECTIVE)
+    if ((NM_STATE_BUS_SLEEP == nm_state) && !nm_wake_pending)
+    {
+        STATS_INC(NM_WAKE_FRAMES);
+        if (nm_wake_match(frame))
+        {
+            nm_wake_time = nm_clock_us();
+            nm_wake_pending = true;
+        }
+        else
+        {
+            STATS_INC(NM_FALSE_WAKES);
+        }
+        return;
+    }
+#else
+    CY_UNUSED_PARAMETER(frame);
+#endif /* NM_WAKE_SELECTIVE */
+
+    if (nm_latency_armed)
+    {
+        nm_latency_stop();
+    }
+#else
+    CY_UNUSED_PARAMETER(frame);
+#endif /* NM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: nm_wake_isr
+********************************************************************************
+* Summary:
+* Called from the GPIO interrupt on the first edge on the CAN RX pin during
+* bus sleep.
+*
+*******************************************************************************/
+void nm_wake_isr(void)
+{
+#if (NM_ENABLE)
+    Cy_GPIO_SetInterruptMask(CYBSP_CAN_RX_PORT, CYBSP_CAN_RX_PIN,
+                             CY_GPIO_INTR_DIS_MASK);
+    nm_wake_time = nm_clock_us();
+    nm_wake_pending = true;
+#endif /* NM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: nm_poll
+********************************************************************************
+* Summary:
+* Called from the main loop. Runs the state machine:
+*
+*  bus-sleep -> repeat-message        on a local request or bus activity
+*  repeat-message -> normal/ready     after NM_REPEAT_MESSAGE_MS
+*  normal-operation -> ready-sleep    when the local request is released
+*  ready-sleep -> normal-operation    on a local request
+*  ready-sleep -> repeat-message      on a repeat message request
+*  ready-sleep -> prepare-bus-sleep   NM_TIMEOUT_MS after the last NM message
+*  prepare-bus-sleep -> repeat-message on a local request or NM message
+*  prepare-bus-sleep -> bus-sleep     after NM_WAIT_BUS_SLEEP_MS
+*
+* NM messages are sent in repeat-message and normal-operation only, so the
+* network sleeps once no node needs it any more.
+*
+*******************************************************************************/
+void nm_poll(void)
+{
+#if (NM_ENABLE)
+    uint32_t tick = nm_tick_ms;
+    bool pdu_received = nm_pdu_received;
+    bool repeat_received = nm_repeat_received;
+
+    nm_pdu_received = false;
+    nm_repeat_received = false;
+
+    if (nm_latency_done)
+    {
+        nm_latency_t *stats = &nm_latency[nm_latency_source];
+        uint32_t latency = (uint32_t)(nm_latency_end - nm_latency_start);
+
+        nm_latency_done = false;
+        stats->min = ((0U == stats->count) || (latency < stats->min)) ?
+                     latency : stats->min;
+        stats->max = (latency > stats->max) ? latency : stats->max;
+        stats->total += latency;
+        stats->count++;
+    }
+
+    if (pdu_received && (NM_STATE_BUS_SLEEP != nm_state))
+    {
+        nm_timeout_start = tick;
+    }
+
+    switch (nm_state)
+    {
+        case NM_STATE_BUS_SLEEP:
+            if (nm_requested || nm_wake_pending)
+            {
+                nm_latency_source = nm_requested ? NM_WAKE_LOCAL : NM_WAKE_BUS;
+                if (!nm_requested)
+                {
+                    nm_latency_start = nm_wake_time;
+                }
+                nm_wakeups[nm_latency_source]++;
+                nm_active_wakeup = nm_requested;
+                nm_wake_pending = false;
+                nm_latency_armed = true;
+                nm_enter(NM_STATE_REPEAT_MESSAGE);
+            }
+            break;
+
+        case NM_STATE_PREPARE_BUS_SLEEP:
+            if (nm_requested || pdu_received)
+            {
+                nm_enter(NM_STATE_REPEAT_MESSAGE);
+            }
+            else if ((tick - nm_wait_start) >= NM_WAIT_BUS_SLEEP_MS)
+            {
+                nm_enter(NM_STATE_BUS_SLEEP);
+            }
+            else
+            {
+                /* Waiting for the other nodes */
+            }
+            break;
+
+        case NM_STATE_REPEAT_MESSAGE:
+            nm_transmit(tick);
+            if ((tick - nm_repeat_start) >= NM_REPEAT_MESSAGE_MS)
+            {
+                nm_enter(nm_requested ? NM_STATE_NORMAL_OPERATION :
+                                        NM_STATE_READY_SLEEP);
+            }
+            break;
+
+        case NM_STATE_NORMAL_OPERATION:
+            nm_transmit(tick);
+            if (!nm_requested)
+            {
+                nm_enter(NM_STATE_READY_SLEEP);
+            }
+            else if (repeat_received)
+            {
+                nm_enter(NM_STATE_REPEAT_MESSAGE);
+            }
+            else
+            {
+                /* Keeps the network awake */
+            }
+            break;
+
+        case NM_STATE_READY_SLEEP:
+            if (nm_requested)
+            {
+                nm_enter(NM_STATE_NORMAL_OPERATION);
+            }
+            else if (repeat_received)
+            {
+                nm_enter(NM_STATE_REPEAT_MESSAGE);
+            }
+            else if ((tick - nm_timeout_start) >= NM_TIMEOUT_MS)
+            {
+                nm_enter(NM_STATE_PREPARE_BUS_SLEEP);
+            }
+            else
+            {
+                /* Another node still needs the network */
+            }
+            break;
+
+        default:
+            break;
+    }
+#endif /* NM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: nm_idle
+********************************************************************************
+* Summary:
+* Called at the end of the main loop. In bus sleep, puts the CPU to Sleep
+* until the next interrupt: the SysTick, the user button, or the wake-up
+* edge on the CAN RX pin. The other states keep the CPU running, as the
+* protocols time their retries with the cycle counter, which stops in Sleep.
+*
+* Parameters:
+*  work_pending Set if the application has work that must not wait
+*
+*******************************************************************************/
+void nm_idle(bool work_pending)
+{
+#if (NM_ENABLE)
+    uint32_t primask;
+
+    if ((NM_STATE_BUS_SLEEP != nm_state) || work_pending)
+    {
+        return;
+    }
+
+    /* With interrupts masked, a wake-up between the check and the sleep
+     * still ends the sleep, and the wake-up time is taken before any
+     * handler runs */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (!nm_wake_pending)
+    {
+        uint64_t start = nm_clock_us();
+
+        (void)Cy_SysPm_CpuEnterSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+        nm_cpu_sleep_time += nm_clock_us() - start;
+    }
+    __set_PRIMASK(primask);
+#else
+    CY_UNUSED_PARAMETER(work_pending);
+#endif /* NM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: nm_report
+********************************************************************************
+* Summary:
+* Prints the state residency, the estimated average current and the
+* wake-up latencies on the debug UART.
+*
+*******************************************************************************/
+void nm_report(void)
+{
+#if (NM_ENABLE)
+    static const char * const sources[2] = { "bus", "local" };
+    uint64_t now = nm_clock_us();
+    uint64_t total = now - nm_start_time;
+    uint64_t can_on;
+    uint64_t charge;
+
+    nm_state_time[nm_state] += now - nm_state_since;
+    nm_state_since = now;
+
+    printf("NM: node %u in %s\r\n", (unsigned int)nm_node,
+           nm_state_names[nm_state]);
+
+    for (uint32_t state = 0U; state < (uint32_t)NM_STATE_COUNT; state++)
+    {
+        printf("NM: %-18s %10lu ms\r\n", nm_state_names[state],
+               (unsigned long)(nm_state_time[state] / 1000U));
+    }
+
+    /* Charge in microampere-microseconds over the time since start-up */
+    can_on = total - nm_state_time[NM_STATE_BUS_SLEEP];
+    charge = ((total - nm_cpu_sleep_time) * NM_CURRENT_CPU_RUN_UA) +
+             (nm_cpu_sleep_time * NM_CURRENT_CPU_SLEEP_UA) +
+             (can_on * NM_CURRENT_CAN_UA);
+    printf("NM: CPU asleep %lu of %lu ms, estimated average current %lu uA\r\n",
+           (unsigned long)(nm_cpu_sleep_time / 1000U),
+           (unsigned long)(total / 1000U),
+           (unsigned long)((0U != total) ? (charge / total) : 0U));
+
+    for (uint32_t source = 0U; source < 2U; source++)
+    {
+        const nm_latency_t *stats = &nm_latency[source];
+
+        printf("NM: %-5s wake-ups %lu, to first frame min %lu us, "
+               "mean %lu us, max %lu us\r\n", sources[source],
+               (unsigned long)nm_wakeups[source], (unsigned long)stats->min,
+               (unsigned long)((0U != stats->count) ?
+                               (stats->total / stats->count) : 0U),
+               (unsigned long)stats->max);
+    }
+    printf("\r\n");
+#endif /* NM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: nm_wake_match
+********************************************************************************
+* Summary:
+* Checks a frame against the wake-up patterns of NM_WAKE_LIST. Short enough
+* to run in the RX interrupt.
+*
+* Parameters:
+*  frame        Received frame
+*
+* Return:
+*  true if the frame is a wake-up frame
+*
+*******************************************************************************/
+bool nm_wake_match(const canfd_frame_t *frame)
+{
+    uint64_t payload = 0U;
+    uint32_t len = (frame->len < sizeof(payload)) ? frame->len :
+                   sizeof(payload);
+
+    /* Little-endian core: byte 0 becomes the least significant byte */
+    memcpy(&payload, frame->data, len);
+
+    for (uint32_t idx = 0U; idx < (uint32_t)NM_WAKE_COUNT; idx++)
+    {
+        const nm_wake_pattern_t *pattern = &nm_wake_patterns[idx];
+
+        if ((0U == ((frame->id ^ pattern->id) & pattern->id_mask)) &&
+            ((payload & pattern->mask) == pattern->value))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: nm_wake_config
+********************************************************************************
+* Summary:
+* Returns the channel configuration for selective bus sleep: the application
+* configuration with the filters replaced by the wake-up filters, and all
+* other frames rejected.
+*
+* Parameters:
+*  config       Application channel configuration
+*
+*******************************************************************************/
+const cy_stc_canfd_config_t *nm_wake_config(
+    const cy_stc_canfd_config_t *config)
+{
+    nm_wake_channel_config = *config;
+    nm_wake_channel_config.sidFilterConfig = &nm_wake_sid_config;
+    nm_wake_channel_config.globalFilterConfig = &nm_wake_global_config;
+
+    return &nm_wake_channel_config;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,219 @@
+/******************************************************************************
+* File Name:   nm.h
+*
+* Description: This file contains the interface of network management, which
+*              coordinates bus sleep and wake-up with the other nodes.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef NM_H_
+#define NM_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "canfd_frame.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make NM_ENABLE=1") to coordinate bus sleep with
+ * the other nodes and stop the CAN FD channel while the network is idle */
+#ifndef NM_ENABLE
+#define NM_ENABLE               (0)
+#endif
+
+/* NM messages use NM_BASE_ID + node number, below the priority of all
+ * application frames. Nodes are numbered 0 to NM_NODE_MAX. */
+#define NM_BASE_ID              (0x500U)
+#define NM_NODE_MAX             (0x3FU)
+
+/* NM message: source node, control bit vector, then user data */
+#define NM_PDU_SIZE             (8U)
+#define NM_CBV_REPEAT_MESSAGE   (0x01U)     /* Ask all nodes to announce */
+#define NM_CBV_ACTIVE_WAKEUP    (0x10U)     /* Sender woke the network */
+#define NM_CBV_PNI              (0x40U)     /* Partial network info present */
+
+/* Byte of the NM message holding the partial network clusters the sender
+ * needs, one bit per cluster */
+#define NM_PN_INFO_BYTE         (2U)
+
+/* Partial network clusters this node belongs to. Its NM messages request
+ * them, and with selective wake-up only NM messages requesting one of them
+ * wake the node. */
+#ifndef NM_PN_CLUSTER
+#define NM_PN_CLUSTER           (0x01U)
+#endif
+
+/* Set to 1 to wake up only on the frames of NM_WAKE_LIST instead of any bus
+ * activity. The channel then keeps running during bus sleep, with its
+ * filters set to pass only the wake-up IDs. */
+#ifndef NM_WAKE_SELECTIVE
+#define NM_WAKE_SELECTIVE       (0)
+#endif
+
+/* Period of the NM messages while this node needs the network */
+#ifndef NM_MSG_CYCLE_MS
+#define NM_MSG_CYCLE_MS         (100U)
+#endif
+
+/* Time without NM messages from any node after which the network is
+ * released */
+#ifndef NM_TIMEOUT_MS
+#define NM_TIMEOUT_MS           (1000U)
+#endif
+
+/* Time a node announces itself after it joins the network */
+#ifndef NM_REPEAT_MESSAGE_MS
+#define NM_REPEAT_MESSAGE_MS    (1500U)
+#endif
+
+/* Time from the end of network activity to stopping the channel, for the
+ * other nodes to reach the same point */
+#ifndef NM_WAIT_BUS_SLEEP_MS
+#define NM_WAIT_BUS_SLEEP_MS    (1000U)
+#endif
+
+#if (NM_TIMEOUT_MS <= NM_MSG_CYCLE_MS)
+#error "NM_TIMEOUT_MS must be longer than NM_MSG_CYCLE_MS"
+#endif
+
+/* Supply current of the board in each power mode, in microamperes, used to
+ * estimate the average current from the time spent in each mode. Replace
+ * these with values measured on the board. */
+#ifndef NM_CURRENT_CPU_RUN_UA
+#define NM_CURRENT_CPU_RUN_UA   (20000U)    /* CPU running */
+#endif
+#ifndef NM_CURRENT_CPU_SLEEP_UA
+#define NM_CURRENT_CPU_SLEEP_UA (6000U)     /* CPU in Sleep, clocks running */
+#endif
+#ifndef NM_CURRENT_CAN_UA
+#define NM_CURRENT_CAN_UA       (4000U)     /* Channel and transceiver active */
+#endif
+
+/* Payload pattern helper: byte idx of the first 8 payload bytes */
+#define NM_WAKE_BYTE(idx, value)    ((uint64_t)(value) << (8U * (idx)))
+
+/* Wake-up frames for selective wake-up: X(identifier, CAN ID, ID mask,
+ * value, mask). The controller's filters pass a frame when
+ * (frame ID ^ CAN ID) & ID mask is 0, and only these frames interrupt the
+ * CPU. The RX interrupt then checks the first 8 payload bytes, read as a
+ * little-endian 64-bit word: the frame wakes the node when
+ * (payload & mask) == value. Payloads shorter than 8 bytes read as zero
+ * past their end. Other frames that pass the filters are false wake-ups. */
+#define NM_WAKE_LIST(X)                                                        \
+    X(PN_REQUEST,   NM_BASE_ID, 0x7C0U,                                        \
+      NM_WAKE_BYTE(1U, NM_CBV_PNI) |                                           \
+      NM_WAKE_BYTE(NM_PN_INFO_BYTE, NM_PN_CLUSTER),                            \
+      NM_WAKE_BYTE(1U, NM_CBV_PNI) |                                           \
+      NM_WAKE_BYTE(NM_PN_INFO_BYTE, NM_PN_CLUSTER))                            \
+    X(DIAG_REQUEST, 0x7DFU,     0x7FFU, 0U, 0U)
+
+#define NM_WAKE_ENUM(name, id, id_mask, value, mask)    NM_WAKE_##name,
+
+/* List of states: X(identifier, name) */
+#define NM_STATE_LIST(X)                                                       \
+    X(BUS_SLEEP,            "bus-sleep")                                       \
+    X(PREPARE_BUS_SLEEP,    "prepare-bus-sleep")                               \
+    X(REPEAT_MESSAGE,       "repeat-message")                                  \
+    X(NORMAL_OPERATION,     "normal-operation")                                \
+    X(READY_SLEEP,          "ready-sleep")
+
+#define NM_STATE_ENUM(name, text)   NM_STATE_##name,
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Network management states, as in AUTOSAR CanNm */
+typedef enum
+{
+    NM_STATE_LIST(NM_STATE_ENUM)
+    NM_STATE_COUNT
+} nm_state_t;
+
+/* Wake-up frames */
+typedef enum
+{
+    NM_WAKE_LIST(NM_WAKE_ENUM)
+    NM_WAKE_COUNT
+} nm_wake_t;
+
+/* Sends one frame; returns false if the controller cannot take it now */
+typedef bool (*nm_send_fn_t)(const canfd_frame_t *frame);
+
+/* Wake-up to first frame latency, in microseconds */
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+} nm_latency_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void nm_init(CANFD_Type *base, uint32_t chan,
+             const cy_stc_canfd_config_t *config,
+             cy_stc_canfd_context_t *context, uint8_t node, nm_send_fn_t send);
+void nm_network_request(void);
+void nm_network_release(void);
+bool nm_tx_allowed(void);
+void nm_on_frame(const canfd_frame_t *frame);
+void nm_on_rx_isr(const canfd_frame_t *frame);
+void nm_wake_isr(void);
+void nm_poll(void);
+void nm_idle(bool work_pending);
+void nm_report(void);
+
+bool nm_wake_match(const canfd_frame_t *frame);
+const cy_stc_canfd_config_t *nm_wake_config(
+    const cy_stc_canfd_config_t *config);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* NM_H_ */
+
+/* [] END OF FILE */
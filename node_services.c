@@ -0,0 +1,391 @@
+/******************************************************************************
+* File Name:   node_services.c
+*
+* Description: This file contains the remote procedures served by this node,
+*              the pipelined demo calls and the RPC load test.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "node_services.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* State behind the served procedures */
+static uint8_t  node_mode;
+static int32_t  node_calibration[8];
+static uint8_t  node_params[NODE_SERVICES_PARAM_SIZE];
+
+#if (RPC_ENABLE)
+/* Node the demo and load calls go to */
+static uint8_t  node_peer;
+
+/* Results of the demo calls, printed by node_services_report() */
+static uint32_t node_demo_ok;
+static uint32_t node_demo_failed;
+
+#if (RPC_LOAD_ENABLE)
+static uint32_t node_echo_value;
+static uint32_t node_echo_mismatch;
+#endif /* RPC_LOAD_ENABLE */
+#endif /* RPC_ENABLE */
+
+/*******************************************************************************
+* Function Name: rpc_serve_echo
+********************************************************************************
+* Summary:
+* Server side of echo: returns the value unchanged.
+*
+*******************************************************************************/
+rpc_status_t rpc_serve_echo(uint8_t caller, const rpc_echo_req_t *req,
+                            rpc_echo_resp_t *resp)
+{
+    CY_UNUSED_PARAMETER(caller);
+
+    resp->value = req->value;
+
+    return RPC_STATUS_OK;
+}
+
+/*******************************************************************************
+* Function Name: rpc_serve_set_mode
+********************************************************************************
+* Summary:
+* Server side of set_mode: switches the operating mode and returns the
+* previous one.
+*
+*******************************************************************************/
+rpc_status_t rpc_serve_set_mode(uint8_t caller, const rpc_set_mode_req_t *req,
+                                rpc_set_mode_resp_t *resp)
+{
+    CY_UNUSED_PARAMETER(caller);
+
+    resp->previous = node_mode;
+    node_mode = req->mode;
+
+    return RPC_STATUS_OK;
+}
+
+/*******************************************************************************
+* Function Name: rpc_serve_read_block
+********************************************************************************
+* Summary:
+* Server side of read_block: returns up to 48 bytes of the parameter table.
+*
+*******************************************************************************/
+rpc_status_t rpc_serve_read_block(uint8_t caller,
+                                  const rpc_read_block_req_t *req,
+                                  rpc_read_block_resp_t *resp)
+{
+    uint32_t len = req->length;
+
+    CY_UNUSED_PARAMETER(caller);
+
+    if ((len > sizeof(resp->data)) ||
+        (((uint32_t)req->address + len) > NODE_SERVICES_PARAM_SIZE))
+    {
+        return RPC_STATUS_FAILED;
+    }
+
+    resp->address = req->address;
+    resp->data_len = (uint8_t)len;
+    memcpy(resp->data, &node_params[req->address], len);
+
+    return RPC_STATUS_OK;
+}
+
+/*******************************************************************************
+* Function Name: rpc_serve_calibrate_step
+********************************************************************************
+* Summary:
+* Server side of calibrate_step: accumulates the offset of one step and
+* returns the running value.
+*
+*******************************************************************************/
+rpc_status_t rpc_serve_calibrate_step(uint8_t caller,
+                                      const rpc_calibrate_step_req_t *req,
+                                      rpc_calibrate_step_resp_t *resp)
+{
+    uint32_t step = req->step;
+
+    CY_UNUSED_PARAMETER(caller);
+
+    if (step >= (sizeof(node_calibration) / sizeof(node_calibration[0])))
+    {
+        return RPC_STATUS_FAILED;
+    }
+
+    node_calibration[step] += req->offset;
+    resp->step = req->step;
+    resp->result = node_calibration[step];
+
+    return RPC_STATUS_OK;
+}
+
+#if (RPC_ENABLE)
+#if !(RPC_LOAD_ENABLE)
+/*******************************************************************************
+* Function Name: node_services_count
+********************************************************************************
+* Summary:
+* Counts the result of a demo call.
+*
+*******************************************************************************/
+static void node_services_count(rpc_status_t status)
+{
+    if (RPC_STATUS_OK == status)
+    {
+        node_demo_ok++;
+    }
+    else
+    {
+        node_demo_failed++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: node_services_on_set_mode
+********************************************************************************
+* Summary:
+* Completion of the demo set_mode call.
+*
+*******************************************************************************/
+static void node_services_on_set_mode(rpc_status_t status,
+                                      const rpc_set_mode_resp_t *resp,
+                                      void *ctx)
+{
+    CY_UNUSED_PARAMETER(resp);
+    CY_UNUSED_PARAMETER(ctx);
+
+    node_services_count(status);
+}
+
+/*******************************************************************************
+* Function Name: node_services_on_read_block
+********************************************************************************
+* Summary:
+* Completion of the demo read_block calls.
+*
+*******************************************************************************/
+static void node_services_on_read_block(rpc_status_t status,
+                                        const rpc_read_block_resp_t *resp,
+                                        void *ctx)
+{
+    CY_UNUSED_PARAMETER(resp);
+    CY_UNUSED_PARAMETER(ctx);
+
+    node_services_count(status);
+}
+
+/*******************************************************************************
+* Function Name: node_services_on_calibrate_step
+********************************************************************************
+* Summary:
+* Completion of the demo calibrate_step call.
+*
+*******************************************************************************/
+static void node_services_on_calibrate_step(
+    rpc_status_t status, const rpc_calibrate_step_resp_t *resp, void *ctx)
+{
+    CY_UNUSED_PARAMETER(resp);
+    CY_UNUSED_PARAMETER(ctx);
+
+    node_services_count(status);
+}
+#else
+/*******************************************************************************
+* Function Name: node_services_on_echo
+********************************************************************************
+* Summary:
+* Completion of a load echo call; checks the returned value.
+*
+*******************************************************************************/
+static void node_services_on_echo(rpc_status_t status,
+                                  const rpc_echo_resp_t *resp, void *ctx)
+{
+    if ((RPC_STATUS_OK == status) &&
+        (resp->value != (uint32_t)(uintptr_t)ctx))
+    {
+        node_echo_mismatch++;
+    }
+}
+#endif /* RPC_LOAD_ENABLE */
+#endif /* RPC_ENABLE */
+
+/*******************************************************************************
+* Function Name: node_services_init
+********************************************************************************
+* Summary:
+* Initializes the served state and the RPC layer.
+*
+* Parameters:
+*  node         Node number of this board
+*  peer         Node number the demo and load calls go to
+*  send         Frame transmit function
+*
+*******************************************************************************/
+void node_services_init(uint8_t node, uint8_t peer, rpc_send_fn_t send)
+{
+#if (RPC_ENABLE)
+    for (uint32_t idx = 0U; idx < NODE_SERVICES_PARAM_SIZE; idx++)
+    {
+        node_params[idx] = (uint8_t)(idx ^ node);
+    }
+
+    node_peer = peer;
+    rpc_init(node, send);
+#else
+    CY_UNUSED_PARAMETER(node);
+    CY_UNUSED_PARAMETER(peer);
+    CY_UNUSED_PARAMETER(send);
+#endif /* RPC_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: node_services_on_frame
+********************************************************************************
+* Summary:
+* Passes a received RPC frame to the RPC layer.
+*
+*******************************************************************************/
+void node_services_on_frame(const canfd_frame_t *frame)
+{
+#if (RPC_ENABLE)
+    rpc_on_frame(frame);
+#else
+    CY_UNUSED_PARAMETER(frame);
+#endif /* RPC_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: node_services_poll
+********************************************************************************
+* Summary:
+* Called from the main loop. Runs the RPC layer and, in the load test, tops
+* up the echo calls in flight.
+*
+*******************************************************************************/
+void node_services_poll(void)
+{
+#if (RPC_ENABLE)
+#if (RPC_LOAD_ENABLE)
+    while (rpc_pending(node_peer) < RPC_MAX_OUTSTANDING)
+    {
+        rpc_echo_req_t req = { .value = node_echo_value };
+
+        if (RPC_STATUS_OK != rpc_call_echo(node_peer, &req,
+                                           node_services_on_echo,
+                                           (void *)(uintptr_t)node_echo_value))
+        {
+            break;
+        }
+        node_echo_value++;
+    }
+#endif /* RPC_LOAD_ENABLE */
+    rpc_poll();
+#endif /* RPC_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: node_services_demo
+********************************************************************************
+* Summary:
+* Issues a batch of calls to the other node. They are pipelined: all
+* requests go out back to back and the responses are matched by call ID as
+* they arrive.
+*
+*******************************************************************************/
+void node_services_demo(void)
+{
+#if (RPC_ENABLE) && !(RPC_LOAD_ENABLE)
+    rpc_set_mode_req_t mode = { .mode = (uint8_t)(node_mode + 1U) };
+    rpc_read_block_req_t block = { .address = 0U, .length = 48U };
+    rpc_calibrate_step_req_t step = { .step = 0U, .offset = 1 };
+
+    if (RPC_STATUS_OK != rpc_call_set_mode(node_peer, &mode,
+                                           node_services_on_set_mode, NULL))
+    {
+        node_demo_failed++;
+    }
+    if (RPC_STATUS_OK != rpc_call_read_block(node_peer, &block,
+                                             node_services_on_read_block,
+                                             NULL))
+    {
+        node_demo_failed++;
+    }
+    block.address = 48U;
+    if (RPC_STATUS_OK != rpc_call_read_block(node_peer, &block,
+                                             node_services_on_read_block,
+                                             NULL))
+    {
+        node_demo_failed++;
+    }
+    if (RPC_STATUS_OK != rpc_call_calibrate_step(node_peer, &step,
+                                                 node_services_on_calibrate_step,
+                                                 NULL))
+    {
+        node_demo_failed++;
+    }
+#endif /* RPC_ENABLE && !RPC_LOAD_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: node_services_report
+********************************************************************************
+* Summary:
+* Prints the RPC counters on the debug UART.
+*
+*******************************************************************************/
+void node_services_report(void)
+{
+#if (RPC_ENABLE)
+    printf("RPC demo calls ok: %lu, failed: %lu\r\n",
+           (unsigned long)node_demo_ok, (unsigned long)node_demo_failed);
+#if (RPC_LOAD_ENABLE)
+    printf("RPC echo mismatches: %lu\r\n", (unsigned long)node_echo_mismatch);
+#endif /* RPC_LOAD_ENABLE */
+    rpc_report();
+#endif /* RPC_ENABLE */
+}
+
+/* [] END OF FILE */
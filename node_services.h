@@ -0,0 +1,91 @@
+/******************************************************************************
+* File Name:   node_services.h
+*
+* Description: This file contains the interface of the remote procedures
+*              served by this node and of the RPC demo.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef NODE_SERVICES_H_
+#define NODE_SERVICES_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "rpc.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make RPC_ENABLE=1") to serve the remote
+ * procedures of rpc_idl.h and to call them on the other node on each button
+ * press */
+#ifndef RPC_ENABLE
+#define RPC_ENABLE              (0)
+#endif
+
+/* Set to 1 to keep RPC_MAX_OUTSTANDING echo calls in flight to the other
+ * node at all times, for measuring calls per second and latency */
+#ifndef RPC_LOAD_ENABLE
+#define RPC_LOAD_ENABLE         (0)
+#endif
+
+/* Size of the parameter table read with read_block */
+#define NODE_SERVICES_PARAM_SIZE    (256U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void node_services_init(uint8_t node, uint8_t peer, rpc_send_fn_t send);
+void node_services_on_frame(const canfd_frame_t *frame);
+void node_services_poll(void);
+void node_services_demo(void);
+void node_services_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* NODE_SERVICES_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,386 @@
+/******************************************************************************
+* File Name:   pubsub.c
+*
+* Description: This file contains the publish/subscribe layer: a reference-
+*              counted frame pool, the subscription table and the dispatcher.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "pubsub.h"
+#include "cancrypt_can.h"
+#include "cycle_counter.h"
+#include "stats.h"
+#include "trace.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define PUBSUB_TOPIC_ENTRY(name, id, mask)      { (id), (mask) },
+
+#define PUBSUB_SUBSCRIBER_ENTRY(name, prio, fn, topics)                        \
+    { #name, (fn), (topics), (prio) },
+
+/* Topic and subscriber sets are 32-bit masks */
+_Static_assert(PUBSUB_TOPIC_COUNT <= 32, "At most 32 topics are supported");
+_Static_assert(PUBSUB_SUB_COUNT <= 32, "At most 32 subscribers are supported");
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t id;
+    uint32_t mask;
+} pubsub_topic_info_t;
+
+typedef struct
+{
+    const char      *name;
+    pubsub_handler_t handler;
+    uint32_t         topics;            /* PUBSUB_TOPIC_BIT() set */
+    uint8_t          priority;
+} pubsub_subscriber_info_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+pubsub_stats_t pubsub_stats;
+
+static const pubsub_topic_info_t pubsub_topics[PUBSUB_TOPIC_COUNT] =
+{
+    PUBSUB_TOPIC_LIST(PUBSUB_TOPIC_ENTRY)
+};
+
+static const pubsub_subscriber_info_t pubsub_subscribers[PUBSUB_SUB_COUNT] =
+{
+    PUBSUB_SUBSCRIBER_LIST(PUBSUB_SUBSCRIBER_ENTRY)
+};
+
+/* Subscription table compiled by pubsub_init(). Bit n of the mask of a topic
+ * is set if the subscriber at rank n of pubsub_order listens to the topic,
+ * so the set bits of a mask are the subscribers in delivery order. */
+static uint32_t pubsub_topic_ranks[PUBSUB_TOPIC_COUNT];
+static uint8_t  pubsub_order[PUBSUB_SUB_COUNT];
+
+/* Frame pool. A slot is free while its reference count is zero. */
+static canfd_frame_t    pubsub_frames[PUBSUB_POOL_SIZE];
+static volatile uint8_t pubsub_refs[PUBSUB_POOL_SIZE];
+
+/* Handles published by the RX callback and not yet dispatched. It can never
+ * overflow because it has room for every slot of the pool. */
+static volatile uint32_t pubsub_pending_head;
+static volatile uint32_t pubsub_pending_tail;
+static pubsub_handle_t   pubsub_pending[PUBSUB_POOL_SIZE];
+
+/*******************************************************************************
+* Function Name: pubsub_init
+********************************************************************************
+* Summary:
+* Empties the frame pool and compiles the subscription table: the subscribers
+* are ranked by priority (stable for equal priorities) and each topic gets the
+* mask of subscriber ranks that listen to it. Delivery then needs no search.
+*
+*******************************************************************************/
+void pubsub_init(void)
+{
+    uint32_t rank = 0U;
+
+    for (uint32_t prio = 0U; prio <= UINT8_MAX; prio++)
+    {
+        for (uint32_t sub = 0U; sub < (uint32_t)PUBSUB_SUB_COUNT; sub++)
+        {
+            if (pubsub_subscribers[sub].priority == prio)
+            {
+                pubsub_order[rank++] = (uint8_t)sub;
+            }
+        }
+    }
+
+    for (uint32_t topic = 0U; topic < (uint32_t)PUBSUB_TOPIC_COUNT; topic++)
+    {
+        pubsub_topic_ranks[topic] = 0U;
+        for (rank = 0U; rank < (uint32_t)PUBSUB_SUB_COUNT; rank++)
+        {
+            if (0U != (pubsub_subscribers[pubsub_order[rank]].topics &
+                       (1UL << topic)))
+            {
+                pubsub_topic_ranks[topic] |= (1UL << rank);
+            }
+        }
+    }
+
+    for (uint32_t slot = 0U; slot < PUBSUB_POOL_SIZE; slot++)
+    {
+        pubsub_refs[slot] = 0U;
+    }
+    pubsub_pending_head = 0U;
+    pubsub_pending_tail = 0U;
+
+    cycle_counter_init();
+}
+
+/*******************************************************************************
+* Function Name: pubsub_alloc
+********************************************************************************
+* Summary:
+* Takes a free frame from the pool. Called by the RX callback, which decodes
+* the received message into it and then calls pubsub_publish(). If the pool is
+* empty, the frame is counted as dropped.
+*
+* Parameters:
+*  handle       Receives the handle of the frame
+*
+* Return:
+*  Frame to fill in, or NULL if the pool is empty
+*
+*******************************************************************************/
+canfd_frame_t *pubsub_alloc(pubsub_handle_t *handle)
+{
+    for (uint32_t slot = 0U; slot < PUBSUB_POOL_SIZE; slot++)
+    {
+        if (0U == pubsub_refs[slot])
+        {
+            pubsub_refs[slot] = 1U;
+            *handle = (pubsub_handle_t)slot;
+            return &pubsub_frames[slot];
+        }
+    }
+
+    STATS_INC(RX_POOL_FULL);
+    *handle = PUBSUB_HANDLE_INVALID;
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: pubsub_publish
+********************************************************************************
+* Summary:
+* Queues a frame taken with pubsub_alloc() for delivery by pubsub_dispatch().
+* The reference taken by pubsub_alloc() passes to the dispatcher.
+*
+*******************************************************************************/
+void pubsub_publish(pubsub_handle_t handle)
+{
+    uint32_t head = pubsub_pending_head;
+
+    pubsub_pending[head & (PUBSUB_POOL_SIZE - 1U)] = handle;
+    STATS_INC(PUBSUB_PUBLISHED);
+
+    /* The frame and the handle must be in memory before the main loop sees
+     * the new head */
+    __DMB();
+    pubsub_pending_head = head + 1U;
+}
+
+/*******************************************************************************
+* Function Name: pubsub_dispatch
+********************************************************************************
+* Summary:
+* Called from the main loop. Delivers every published frame to the
+* subscribers of all topics it belongs to, in priority order, by handle and
+* without copying. The processing time of each subscriber call is measured
+* with the cycle counter. With CANCRYPT_ENABLE, the payloads of the
+* encrypted IDs are checked and decrypted in place first.
+*
+* Return:
+*  Number of frames delivered
+*
+*******************************************************************************/
+uint32_t pubsub_dispatch(void)
+{
+    uint32_t count = 0U;
+
+    while (pubsub_pending_tail != pubsub_pending_head)
+    {
+        uint32_t tail = pubsub_pending_tail;
+        pubsub_handle_t handle;
+        canfd_frame_t *frame;
+        uint32_t id;
+        uint32_t ranks = 0U;
+
+        __DMB();
+        handle = pubsub_pending[tail & (PUBSUB_POOL_SIZE - 1U)];
+        pubsub_pending_tail = tail + 1U;
+        frame = &pubsub_frames[handle];
+
+        TRACE_BEGIN(DISPATCH);
+
+#if (CANCRYPT_ENABLE)
+        /* Decrypt here rather than in the RX interrupt; frames that fail
+         * authentication or replay an earlier counter go to no subscriber */
+        if (!cancrypt_can_open(frame))
+        {
+            TRACE_END(DISPATCH);
+            pubsub_release(handle);
+            continue;
+        }
+#endif /* CANCRYPT_ENABLE */
+
+        id = frame->id;
+        if (0U != (frame->flags & CANFD_FRAME_FLAG_XTD))
+        {
+            id |= PUBSUB_ID_XTD;
+        }
+
+        for (uint32_t topic = 0U; topic < (uint32_t)PUBSUB_TOPIC_COUNT; topic++)
+        {
+            if (0U == ((id ^ pubsub_topics[topic].id) &
+                       pubsub_topics[topic].mask))
+            {
+                ranks |= pubsub_topic_ranks[topic];
+            }
+        }
+
+        if (0U == ranks)
+        {
+            STATS_INC(PUBSUB_UNMATCHED);
+        }
+
+        while (0U != ranks)
+        {
+            uint32_t rank = __CLZ(__RBIT(ranks));
+            uint32_t sub = pubsub_order[rank];
+            pubsub_sub_stats_t *stats = &pubsub_stats.subs[sub];
+            uint32_t start = cycle_counter_get();
+            uint32_t cycles;
+
+            pubsub_subscribers[sub].handler(handle, frame);
+
+            cycles = cycle_counter_get() - start;
+            stats->calls++;
+            stats->cycles_total += cycles;
+            stats->cycles_max = (cycles > stats->cycles_max) ?
+                                cycles : stats->cycles_max;
+            ranks &= ranks - 1U;
+        }
+
+        TRACE_END(DISPATCH);
+
+        pubsub_release(handle);
+        count++;
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: pubsub_retain
+********************************************************************************
+* Summary:
+* Takes one more reference to a frame, so that a subscriber can keep it after
+* its handler returns. Call from the main loop only.
+*
+*******************************************************************************/
+void pubsub_retain(pubsub_handle_t handle)
+{
+    CY_ASSERT(handle < PUBSUB_POOL_SIZE);
+    CY_ASSERT(0U != pubsub_refs[handle]);
+
+    pubsub_refs[handle] = pubsub_refs[handle] + 1U;
+}
+
+/*******************************************************************************
+* Function Name: pubsub_release
+********************************************************************************
+* Summary:
+* Drops one reference to a frame. The frame returns to the pool with the last
+* reference. Call from the main loop only; the RX callback only ever takes
+* slots whose count is zero, so no locking is needed.
+*
+*******************************************************************************/
+void pubsub_release(pubsub_handle_t handle)
+{
+    CY_ASSERT(handle < PUBSUB_POOL_SIZE);
+    CY_ASSERT(0U != pubsub_refs[handle]);
+
+    /* Finish all reads of the frame before the slot can be reused */
+    __DMB();
+    pubsub_refs[handle] = pubsub_refs[handle] - 1U;
+}
+
+/*******************************************************************************
+* Function Name: pubsub_frame
+********************************************************************************
+* Summary:
+* Returns the frame a handle refers to. Valid while a reference is held.
+*
+*******************************************************************************/
+const canfd_frame_t *pubsub_frame(pubsub_handle_t handle)
+{
+    CY_ASSERT(handle < PUBSUB_POOL_SIZE);
+
+    return &pubsub_frames[handle];
+}
+
+/*******************************************************************************
+* Function Name: pubsub_report
+********************************************************************************
+* Summary:
+* Prints the processing time of each subscriber on the debug UART. The
+* delivery counters are in the statistics registry.
+*
+*******************************************************************************/
+void pubsub_report(void)
+{
+    printf("Pub/sub: subscribers\r\n");
+
+    for (uint32_t rank = 0U; rank < (uint32_t)PUBSUB_SUB_COUNT; rank++)
+    {
+        uint32_t sub = pubsub_order[rank];
+        const pubsub_sub_stats_t *stats = &pubsub_stats.subs[sub];
+        uint32_t mean = 0U;
+
+        if (0U != stats->calls)
+        {
+            mean = (uint32_t)(stats->cycles_total / stats->calls);
+        }
+
+        printf("  %-12s prio %u: %lu calls, %lu cycles mean, %lu max\r\n",
+               pubsub_subscribers[sub].name,
+               pubsub_subscribers[sub].priority,
+               (unsigned long)stats->calls, (unsigned long)mean,
+               (unsigned long)stats->cycles_max);
+    }
+    printf("\r\n");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,153 @@
+/******************************************************************************
+* File Name:   pubsub.h
+*
+* Description: This file contains the interface of the publish/subscribe
+*              layer that delivers received frames to local consumers. The
+*              topics and subscribers are listed in pubsub_config.h.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef PUBSUB_H_
+#define PUBSUB_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "canfd_frame.h"
+#include "pubsub_config.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Received frames that can be in flight at the same time, between the RX
+ * callback and the last subscriber releasing them. Must be a power of two. */
+#ifndef PUBSUB_POOL_SIZE
+#define PUBSUB_POOL_SIZE        (8U)
+#endif
+
+#if ((PUBSUB_POOL_SIZE & (PUBSUB_POOL_SIZE - 1U)) != 0U) || \
+    (PUBSUB_POOL_SIZE > 255U)
+#error "PUBSUB_POOL_SIZE must be a power of two below 256"
+#endif
+
+/* Set in the CAN ID of a topic for a 29-bit ID, and in its mask to tell
+ * 11-bit and 29-bit IDs apart. A mask without it takes both. */
+#define PUBSUB_ID_XTD           (0x80000000UL)
+
+#define PUBSUB_TOPIC_BIT(topic)         (1UL << (uint32_t)PUBSUB_TOPIC_##topic)
+
+#define PUBSUB_TOPIC_ENUM(name, id, mask)               PUBSUB_TOPIC_##name,
+#define PUBSUB_SUBSCRIBER_ENUM(name, prio, fn, topics)  PUBSUB_SUB_##name,
+
+/* Handle value that refers to no frame */
+#define PUBSUB_HANDLE_INVALID   ((pubsub_handle_t)0xFFU)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Topic identifiers */
+typedef enum
+{
+    PUBSUB_TOPIC_LIST(PUBSUB_TOPIC_ENUM)
+    PUBSUB_TOPIC_COUNT
+} pubsub_topic_t;
+
+/* Subscriber identifiers */
+typedef enum
+{
+    PUBSUB_SUBSCRIBER_LIST(PUBSUB_SUBSCRIBER_ENUM)
+    PUBSUB_SUB_COUNT
+} pubsub_subscriber_t;
+
+/* Reference to a frame in the pool */
+typedef uint8_t pubsub_handle_t;
+
+/* Subscriber callback. The frame stays valid until the handler returns; call
+ * pubsub_retain() to keep it longer and pubsub_release() when done. */
+typedef void (*pubsub_handler_t)(pubsub_handle_t handle,
+                                 const canfd_frame_t *frame);
+
+/* Processing time of one subscriber */
+typedef struct
+{
+    uint32_t calls;
+    uint32_t cycles_max;
+    uint64_t cycles_total;
+} pubsub_sub_stats_t;
+
+/* Processing time of the subscribers. The frames published, dropped
+ * because the pool was empty, and unmatched are counted in the statistics
+ * registry of stats.h. */
+typedef struct
+{
+    pubsub_sub_stats_t subs[PUBSUB_SUB_COUNT];
+} pubsub_stats_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern pubsub_stats_t pubsub_stats;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+#define PUBSUB_HANDLER_PROTOTYPE(name, prio, fn, topics)                       \
+    void fn(pubsub_handle_t handle, const canfd_frame_t *frame);
+PUBSUB_SUBSCRIBER_LIST(PUBSUB_HANDLER_PROTOTYPE)
+
+void                 pubsub_init(void);
+canfd_frame_t       *pubsub_alloc(pubsub_handle_t *handle);
+void                 pubsub_publish(pubsub_handle_t handle);
+uint32_t             pubsub_dispatch(void);
+void                 pubsub_retain(pubsub_handle_t handle);
+void                 pubsub_release(pubsub_handle_t handle);
+const canfd_frame_t *pubsub_frame(pubsub_handle_t handle);
+void                 pubsub_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* PUBSUB_H_ */
+
+/* [] END OF FILE */
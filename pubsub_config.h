@@ -0,0 +1,125 @@
+/******************************************************************************
+* File Name:   pubsub_config.h
+*
+* Description: This file contains the topics and subscribers of the
+*              publish/subscribe layer in this application.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/* Included by pubsub.h, which defines PUBSUB_ID_XTD and PUBSUB_TOPIC_BIT()
+ * for the lists below */
+#ifndef PUBSUB_CONFIG_H_
+#define PUBSUB_CONFIG_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* For the *_ENABLE flags of the subscribers that can be compiled out */
+#include "flog.h"
+#include "fzip.h"
+#include "redund.h"
+#include "seqmon.h"
+#include "ttcan.h"
+#include "datarate.h"
+#include "sigagg.h"
+#include "dsp.h"
+#include "adcstream.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* List of topics: X(identifier, CAN ID, ID mask).
+ * A frame belongs to every topic for which (frame ID ^ CAN ID) & mask is 0,
+ * with PUBSUB_ID_XTD set in the frame ID of a 29-bit frame, so a mask of 0
+ * makes a topic that receives all frames. */
+#define PUBSUB_TOPIC_LIST(X)                                                   \
+    X(ANY,          0x000U, 0x000U)                                            \
+    X(NODE_1,       0x001U, PUBSUB_ID_XTD | 0x7FFU)                            \
+    X(NODE_2,       0x002U, PUBSUB_ID_XTD | 0x7FFU)                            \
+    X(STREAM_DATA,  0x200U, PUBSUB_ID_XTD | 0x7FFU)                            \
+    X(STREAM_NACK,  0x1F0U, PUBSUB_ID_XTD | 0x7F0U)                            \
+    X(RPC,          0x300U, PUBSUB_ID_XTD | 0x780U)                            \
+    X(NM,           0x500U, PUBSUB_ID_XTD | 0x7C0U)                            \
+    X(REDUND,       0x0A0U, PUBSUB_ID_XTD | 0x7F0U)                            \
+    X(TTCAN,        0x090U, PUBSUB_ID_XTD | 0x7F0U)                            \
+    X(DATARATE,     0x0B0U, PUBSUB_ID_XTD | 0x7F0U)                            \
+    X(SIGAGG,       0x0C0U, PUBSUB_ID_XTD | 0x7F0U)                            \
+    X(DSP,          0x0D0U, PUBSUB_ID_XTD | 0x7FFU)                            \
+    X(ADCSTREAM,    0x0E0U, PUBSUB_ID_XTD | 0x7FFU)
+
+/* List of local subscribers: X(identifier, priority, handler, topics).
+ * Lower priority values are called first. topics is an OR of
+ * PUBSUB_TOPIC_BIT() values. The compressed log takes all frames, and the
+ * recorder, the redundancy layer, the sequence monitor, the TTCAN jitter
+ * statistics, the data bit rate adaptation, the signal aggregation and the
+ * DSP chain subscribe to no topic unless they are built in. The handlers
+ * are defined by the application. */
+#define PUBSUB_SUBSCRIBER_LIST(X)                                              \
+    X(CONTROL,      0U, app_control_on_frame,                                  \
+      PUBSUB_TOPIC_BIT(NODE_1) | PUBSUB_TOPIC_BIT(NODE_2))                     \
+    X(STREAM,       1U, app_stream_on_frame,                                   \
+      PUBSUB_TOPIC_BIT(STREAM_DATA) | PUBSUB_TOPIC_BIT(STREAM_NACK))           \
+    X(DIAGNOSTICS,  2U, app_diag_on_frame,                                     \
+      PUBSUB_TOPIC_BIT(NODE_1) | PUBSUB_TOPIC_BIT(NODE_2))                     \
+    X(LOGGING,      3U, app_log_on_frame,                                      \
+      (FZIP_ENABLE) ? PUBSUB_TOPIC_BIT(ANY) :                                  \
+      (PUBSUB_TOPIC_BIT(NODE_1) | PUBSUB_TOPIC_BIT(NODE_2)))                   \
+    X(RPC,          1U, app_rpc_on_frame,                                      \
+      PUBSUB_TOPIC_BIT(RPC))                                                   \
+    X(NM,           0U, app_nm_on_frame,                                       \
+      PUBSUB_TOPIC_BIT(NM))                                                    \
+    X(RECORDER,     4U, app_recorder_on_frame,                                 \
+      (FLOG_ENABLE) ? PUBSUB_TOPIC_BIT(ANY) : 0U)                              \
+    X(REDUND,       0U, app_redund_on_frame,                                   \
+      (REDUND_ENABLE) ? PUBSUB_TOPIC_BIT(REDUND) : 0U)                         \
+    X(SEQMON,       0U, app_seqmon_on_frame,                                   \
+      (SEQMON_ENABLE) ? PUBSUB_TOPIC_BIT(ANY) : 0U)                            \
+    X(TTCAN,        0U, app_ttcan_on_frame,                                    \
+      (TTCAN_ENABLE) ? PUBSUB_TOPIC_BIT(TTCAN) : 0U)                           \
+    X(DATARATE,     0U, app_datarate_on_frame,                                 \
+      (DATARATE_ENABLE) ? PUBSUB_TOPIC_BIT(DATARATE) : 0U)                     \
+    X(SIGAGG,       0U, app_sigagg_on_frame,                                   \
+      (SIGAGG_ENABLE) ? PUBSUB_TOPIC_BIT(SIGAGG) : 0U)                         \
+    X(DSP,          1U, app_dsp_on_frame,                                      \
+      (DSP_ENABLE) ? PUBSUB_TOPIC_BIT(DSP) : 0U)                               \
+    X(ADCSTREAM,    1U, app_adcstream_on_frame,                                \
+      (ADCSTREAM_ENABLE) ? PUBSUB_TOPIC_BIT(ADCSTREAM) : 0U)
+
+#endif /* PUBSUB_CONFIG_H_ */
+
+/* [] END OF FILE */
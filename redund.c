@@ -0,0 +1,579 @@
+/******************************************************************************
+* File Name:   redund.c
+*
+* Description: Dual-bus redundancy layer. Adds a sequence number and a CRC to
+*              each frame of a redundant stream, sends it on both buses and
+*              delivers the first valid copy. Free of PDL calls so that host/
+*              can build it.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "redund.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define REDUND_STREAM_ENTRY(name, id, len)                                     \
+    [REDUND_STREAM_##name] = { (id), (len) },
+
+/* Initial value and final XOR of CRC-8/SAE-J1850 */
+#define REDUND_CRC8_INIT        (0xFFU)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t id;
+    uint8_t  len;
+} redund_stream_cfg_t;
+
+/* Receive window of one stream. Bit n of seen[] stands for sequence number
+ * top - n; a copy is a duplicate if either bus already has its bit. */
+typedef struct
+{
+    uint64_t seen[REDUND_BUS_COUNT];
+    uint16_t top;
+    uint8_t  stale_run;
+    bool     synced;
+} redund_window_t;
+
+/* Health tracking of one bus */
+typedef struct
+{
+    uint32_t tx_fail_run;           /* Consecutive failed sends */
+    uint32_t probe_ms;              /* Last send while out of transmission */
+    uint32_t last_rx_ms;            /* Last valid copy */
+    bool     rx_seen;               /* A valid copy since start-up */
+} redund_bus_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const redund_stream_cfg_t redund_streams[REDUND_STREAM_COUNT] =
+{
+    REDUND_STREAM_LIST(REDUND_STREAM_ENTRY)
+};
+
+/* CRC-8 with polynomial 0x1D, one entry per nibble */
+static const uint8_t redund_crc8_nibble[16] =
+{
+    0x00U, 0x1DU, 0x3AU, 0x27U, 0x74U, 0x69U, 0x4EU, 0x53U,
+    0xE8U, 0xF5U, 0xD2U, 0xCFU, 0x9CU, 0x81U, 0xA6U, 0xBBU
+};
+
+static redund_send_fn_t redund_send_fn;
+static uint16_t         redund_tx_seq[REDUND_STREAM_COUNT];
+static redund_window_t  redund_window[REDUND_STREAM_COUNT];
+static redund_bus_t     redund_bus[REDUND_BUS_COUNT];
+static redund_stats_t   redund_stats;
+
+/*******************************************************************************
+* Function Name: redund_crc8
+********************************************************************************
+* Summary:
+* Updates a CRC-8/SAE-J1850 over a block of bytes, without the final XOR.
+*
+* Parameters:
+*  crc          Running CRC, REDUND_CRC8_INIT for a new calculation
+*  data         Data bytes
+*  len          Number of bytes
+*
+* Return:
+*  Updated CRC
+*
+*******************************************************************************/
+static uint8_t redund_crc8(uint8_t crc, const uint8_t *data, uint32_t len)
+{
+    for (uint32_t idx = 0U; idx < len; idx++)
+    {
+        crc ^= data[idx];
+        crc = (uint8_t)((crc << 4) ^ redund_crc8_nibble[crc >> 4]);
+        crc = (uint8_t)((crc << 4) ^ redund_crc8_nibble[crc >> 4]);
+    }
+
+    return crc;
+}
+
+/*******************************************************************************
+* Function Name: redund_frame_crc
+********************************************************************************
+* Summary:
+* Calculates the trailer CRC of a frame: the ID, then the payload and the
+* sequence number.
+*
+* Parameters:
+*  id           CAN ID
+*  data         Frame data up to the CRC byte
+*  len          Number of bytes before the CRC byte
+*
+* Return:
+*  CRC byte
+*
+*******************************************************************************/
+static uint8_t redund_frame_crc(uint32_t id, const uint8_t *data, uint32_t len)
+{
+    uint8_t id_bytes[4] =
+    {
+        (uint8_t)id, (uint8_t)(id >> 8), (uint8_t)(id >> 16),
+        (uint8_t)(id >> 24)
+    };
+    uint8_t crc = redund_crc8(REDUND_CRC8_INIT, id_bytes, sizeof(id_bytes));
+
+    return (uint8_t)(redund_crc8(crc, data, len) ^ REDUND_CRC8_INIT);
+}
+
+/*******************************************************************************
+* Function Name: redund_popcount
+********************************************************************************
+* Summary:
+* Counts the bits set in a 64-bit word.
+*
+*******************************************************************************/
+static uint32_t redund_popcount(uint64_t bits)
+{
+    uint32_t count = 0U;
+
+    for (uint32_t half = 0U; half < 2U; half++)
+    {
+        uint32_t word = (uint32_t)(bits >> (half * 32U));
+
+        word = word - ((word >> 1) & 0x55555555UL);
+        word = (word & 0x33333333UL) + ((word >> 2) & 0x33333333UL);
+        word = (word + (word >> 4)) & 0x0F0F0F0FUL;
+        count += (uint32_t)(word * 0x01010101UL) >> 24;
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: redund_find_stream
+********************************************************************************
+* Summary:
+* Looks up the stream sent with a CAN ID.
+*
+* Return:
+*  Stream index, or REDUND_STREAM_COUNT if the ID is not redundant
+*
+*******************************************************************************/
+static uint32_t redund_find_stream(uint32_t id)
+{
+    uint32_t stream;
+
+    for (stream = 0U; stream < REDUND_STREAM_COUNT; stream++)
+    {
+        if (redund_streams[stream].id == id)
+        {
+            break;
+        }
+    }
+
+    return stream;
+}
+
+/*******************************************************************************
+* Function Name: redund_window_restart
+********************************************************************************
+* Summary:
+* Restarts a receive window at a sequence number.
+*
+*******************************************************************************/
+static void redund_window_restart(redund_window_t *window, uint32_t bus,
+                                  uint16_t seq)
+{
+    memset(window->seen, 0, sizeof(window->seen));
+    window->seen[bus] = 1U;
+    window->top = seq;
+    window->stale_run = 0U;
+    window->synced = true;
+}
+
+/*******************************************************************************
+* Function Name: redund_window_accept
+********************************************************************************
+* Summary:
+* Checks a copy against the receive window of its stream and records it. The
+* work does not depend on the window size: newer sequence numbers shift the
+* bitmaps, older ones test one bit. Copies that leave the window seen on one
+* bus only are counted as missed on the other.
+*
+* Parameters:
+*  window       Window of the stream
+*  bus          Bus the copy came from
+*  seq          Sequence number of the copy
+*
+* Return:
+*  true if this is the first copy of the sequence number
+*
+*******************************************************************************/
+static bool redund_window_accept(redund_window_t *window, uint32_t bus,
+                                 uint16_t seq)
+{
+    int32_t delta = (int16_t)(uint16_t)(seq - window->top);
+    uint64_t bit;
+
+    if (!window->synced)
+    {
+        redund_window_restart(window, bus, seq);
+        return true;
+    }
+
+    if (delta > 0)
+    {
+        uint64_t any = window->seen[0] | window->seen[1];
+        uint64_t gone = ((uint32_t)delta >= REDUND_WINDOW) ? ~0ULL :
+                        (~0ULL << (REDUND_WINDOW - (uint32_t)delta));
+
+        for (uint32_t idx = 0U; idx < REDUND_BUS_COUNT; idx++)
+        {
+            redund_stats.bus[idx].rx_missed +=
+                redund_popcount(any & gone & ~window->seen[idx]);
+            window->seen[idx] = ((uint32_t)delta >= REDUND_WINDOW) ? 0U :
+                                (window->seen[idx] << (uint32_t)delta);
+        }
+        window->seen[bus] |= 1U;
+        window->top = seq;
+        window->stale_run = 0U;
+        return true;
+    }
+
+    if ((uint32_t)(-delta) < REDUND_WINDOW)
+    {
+        bit = 1ULL << (uint32_t)(-delta);
+        window->stale_run = 0U;
+        if (0U != ((window->seen[0] | window->seen[1]) & bit))
+        {
+            window->seen[bus] |= bit;
+            redund_stats.duplicates++;
+            return false;
+        }
+        window->seen[bus] |= bit;
+        return true;
+    }
+
+    /* Older than the window: either a very late copy or a sender that
+     * started again from zero */
+    redund_stats.stale++;
+    if (++window->stale_run < REDUND_RESYNC_COUNT)
+    {
+        return false;
+    }
+    redund_stats.resyncs++;
+    redund_window_restart(window, bus, seq);
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: redund_set_tx
+********************************************************************************
+* Summary:
+* Takes a bus into or out of transmission, counting the failovers.
+*
+*******************************************************************************/
+static void redund_set_tx(uint32_t bus, bool ok, uint32_t now_ms)
+{
+    redund_bus_stats_t *stats = &redund_stats.bus[bus];
+
+    if (stats->tx_ok != ok)
+    {
+        stats->tx_ok = ok;
+        if (!ok)
+        {
+            stats->failovers++;
+            redund_bus[bus].probe_ms = now_ms;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: redund_init
+********************************************************************************
+* Summary:
+* Resets the sequence numbers, windows and counters and puts both buses in
+* service.
+*
+* Parameters:
+*  send         Sends a frame on one bus
+*
+*******************************************************************************/
+void redund_init(redund_send_fn_t send)
+{
+    redund_send_fn = send;
+    memset(redund_tx_seq, 0, sizeof(redund_tx_seq));
+    memset(redund_window, 0, sizeof(redund_window));
+    memset(redund_bus, 0, sizeof(redund_bus));
+    memset(&redund_stats, 0, sizeof(redund_stats));
+
+    for (uint32_t bus = 0U; bus < REDUND_BUS_COUNT; bus++)
+    {
+        redund_stats.bus[bus].tx_ok = true;
+        redund_stats.bus[bus].rx_ok = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: redund_frame_len
+********************************************************************************
+* Summary:
+* Returns the length of the frames of a stream: the payload and the trailer,
+* rounded up to a CAN FD length.
+*
+* Parameters:
+*  stream       Stream index
+*
+* Return:
+*  Frame length in bytes
+*
+*******************************************************************************/
+uint8_t redund_frame_len(uint32_t stream)
+{
+    uint32_t len = (uint32_t)redund_streams[stream].len + REDUND_TRAILER_SIZE;
+
+    if (len > 8U)
+    {
+        len = (len <= 24U) ? ((len + 3U) & ~3U) :
+              (len <= 32U) ? 32U : (len <= 48U) ? 48U : 64U;
+    }
+
+    return (uint8_t)len;
+}
+
+/*******************************************************************************
+* Function Name: redund_stream_id
+********************************************************************************
+* Summary:
+* Returns the CAN ID of a stream.
+*
+*******************************************************************************/
+uint32_t redund_stream_id(uint32_t stream)
+{
+    return redund_streams[stream].id;
+}
+
+/*******************************************************************************
+* Function Name: redund_send
+********************************************************************************
+* Summary:
+* Sends the next frame of a stream on every bus in transmission. A bus out of
+* transmission gets a copy every REDUND_PROBE_MS and comes back once the
+* controller takes one while not in error.
+*
+* Parameters:
+*  stream       Stream index
+*  data         Payload, as long as configured for the stream
+*  now_ms       Current time
+*
+* Return:
+*  true if at least one bus took the frame
+*
+*******************************************************************************/
+bool redund_send(uint32_t stream, const uint8_t *data, uint32_t now_ms)
+{
+    uint8_t frame[64];
+    uint8_t len = redund_frame_len(stream);
+    uint32_t id = redund_streams[stream].id;
+    uint16_t seq = redund_tx_seq[stream]++;
+    bool sent = false;
+
+    memset(frame, 0, len);
+    memcpy(frame, data, redund_streams[stream].len);
+    frame[len - 3U] = (uint8_t)seq;
+    frame[len - 2U] = (uint8_t)(seq >> 8);
+    frame[len - 1U] = redund_frame_crc(id, frame, len - 1U);
+
+    for (uint32_t bus = 0U; bus < REDUND_BUS_COUNT; bus++)
+    {
+        redund_bus_stats_t *stats = &redund_stats.bus[bus];
+        redund_bus_t *state = &redund_bus[bus];
+
+        if ((!stats->tx_ok) &&
+            ((uint32_t)(now_ms - state->probe_ms) < REDUND_PROBE_MS))
+        {
+            stats->tx_skipped++;
+            continue;
+        }
+
+        if (redund_send_fn(bus, id, frame, len))
+        {
+            stats->tx_sent++;
+            state->tx_fail_run = 0U;
+            sent = true;
+            if (!stats->fault)
+            {
+                redund_set_tx(bus, true, now_ms);
+            }
+        }
+        else
+        {
+            stats->tx_failed++;
+            state->probe_ms = now_ms;
+            if (++state->tx_fail_run >= REDUND_TX_FAIL_MAX)
+            {
+                redund_set_tx(bus, false, now_ms);
+            }
+        }
+    }
+
+    return sent;
+}
+
+/*******************************************************************************
+* Function Name: redund_receive
+********************************************************************************
+* Summary:
+* Checks a received frame. Frames of other IDs, copies with a bad length or
+* CRC, and second copies of a sequence number are dropped.
+*
+* Parameters:
+*  bus          Bus the frame came from
+*  id           CAN ID
+*  data         Frame data
+*  len          Frame length
+*  now_ms       Current time
+*
+* Return:
+*  Stream index if this is the first valid copy, -1 otherwise. The payload
+*  is at the start of data.
+*
+*******************************************************************************/
+int32_t redund_receive(uint32_t bus, uint32_t id, const uint8_t *data,
+                       uint8_t len, uint32_t now_ms)
+{
+    uint32_t stream = redund_find_stream(id);
+    redund_bus_stats_t *stats = &redund_stats.bus[bus];
+    uint16_t seq;
+
+    if (REDUND_STREAM_COUNT == stream)
+    {
+        return -1;
+    }
+
+    if ((len != redund_frame_len(stream)) ||
+        (data[len - 1U] != redund_frame_crc(id, data, len - 1U)))
+    {
+        stats->rx_invalid++;
+        return -1;
+    }
+
+    stats->rx_valid++;
+    stats->rx_ok = true;
+    redund_bus[bus].last_rx_ms = now_ms;
+    redund_bus[bus].rx_seen = true;
+
+    seq = (uint16_t)(data[len - 3U] | ((uint16_t)data[len - 2U] << 8));
+    if (!redund_window_accept(&redund_window[stream], bus, seq))
+    {
+        return -1;
+    }
+
+    stats->rx_first++;
+    redund_stats.delivered++;
+
+    return (int32_t)stream;
+}
+
+/*******************************************************************************
+* Function Name: redund_bus_fault
+********************************************************************************
+* Summary:
+* Reports the error state of a controller. A bus in error passive or bus-off
+* is taken out of transmission at once instead of after REDUND_TX_FAIL_MAX
+* failed sends.
+*
+* Parameters:
+*  bus          Bus index
+*  fault        true while error passive or bus-off
+*  now_ms       Current time
+*
+*******************************************************************************/
+void redund_bus_fault(uint32_t bus, bool fault, uint32_t now_ms)
+{
+    redund_stats.bus[bus].fault = fault;
+    if (fault)
+    {
+        redund_set_tx(bus, false, now_ms);
+    }
+}
+
+/*******************************************************************************
+* Function Name: redund_poll
+********************************************************************************
+* Summary:
+* Marks a bus silent if it delivered nothing for REDUND_SILENT_MS while the
+* other bus did. The next valid copy brings it back.
+*
+* Parameters:
+*  now_ms       Current time
+*
+*******************************************************************************/
+void redund_poll(uint32_t now_ms)
+{
+    for (uint32_t bus = 0U; bus < REDUND_BUS_COUNT; bus++)
+    {
+        const redund_bus_t *other = &redund_bus[bus ^ 1U];
+        redund_bus_stats_t *stats = &redund_stats.bus[bus];
+
+        if (stats->rx_ok && other->rx_seen &&
+            ((uint32_t)(now_ms - other->last_rx_ms) < REDUND_SILENT_MS) &&
+            ((uint32_t)(now_ms - redund_bus[bus].last_rx_ms) >=
+             REDUND_SILENT_MS))
+        {
+            stats->rx_ok = false;
+            stats->failovers++;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: redund_get_stats
+********************************************************************************
+* Summary:
+* Copies the counters and the state of both buses.
+*
+*******************************************************************************/
+void redund_get_stats(redund_stats_t *stats)
+{
+    *stats = redund_stats;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,164 @@
+/******************************************************************************
+* File Name:   redund.h
+*
+* Description: Interface of the dual-bus redundancy layer: sequence-numbered
+*              streams sent on two CAN buses, duplicate suppression on receive
+*              and bus failover.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef REDUND_H_
+#define REDUND_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* Only the C library, so that host/ can build the simulator */
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make REDUND_ENABLE=1") to send the redundant
+ * streams on both CAN channels. Needs the second channel in the design. */
+#ifndef REDUND_ENABLE
+#define REDUND_ENABLE           (0)
+#endif
+
+#define REDUND_BUS_COUNT        (2U)
+
+/* Trailer after the payload: 16-bit sequence number (little endian) and
+ * CRC-8/SAE-J1850 over the ID, the payload and the sequence number */
+#define REDUND_TRAILER_SIZE     (3U)
+#define REDUND_DATA_MAX         (64U - REDUND_TRAILER_SIZE)
+
+/* Sequence numbers remembered per stream, one bit each */
+#define REDUND_WINDOW           (64U)
+
+/* Consecutive frames older than the window that restart the stream, as
+ * after a reset of the sender */
+#define REDUND_RESYNC_COUNT     (3U)
+
+/* Consecutive failed sends that take a bus out of transmission */
+#ifndef REDUND_TX_FAIL_MAX
+#define REDUND_TX_FAIL_MAX      (3U)
+#endif
+
+/* Period of the test sends on a bus out of transmission */
+#ifndef REDUND_PROBE_MS
+#define REDUND_PROBE_MS         (100U)
+#endif
+
+/* A bus that delivers nothing for this long while the other one does is
+ * marked silent */
+#ifndef REDUND_SILENT_MS
+#define REDUND_SILENT_MS        (50U)
+#endif
+
+/* List of redundant streams: X(identifier, CAN ID, payload length).
+ * Each node sends one; the payload is followed by the trailer. */
+#define REDUND_STREAM_LIST(X)                                                  \
+    X(NODE_1,       0x0A1U, 8U)                                                \
+    X(NODE_2,       0x0A2U, 8U)
+
+#define REDUND_STREAM_ENUM(name, id, len)       REDUND_STREAM_##name,
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef enum
+{
+    REDUND_STREAM_LIST(REDUND_STREAM_ENUM)
+    REDUND_STREAM_COUNT
+} redund_stream_t;
+
+/* Sends one frame on one bus. Returns false if the controller did not take
+ * it. */
+typedef bool (*redund_send_fn_t)(uint32_t bus, uint32_t id,
+                                 const uint8_t *data, uint8_t len);
+
+/* Counters and state of one bus */
+typedef struct
+{
+    uint32_t rx_valid;              /* Copies received with a good trailer */
+    uint32_t rx_first;              /* Copies delivered to the application */
+    uint32_t rx_invalid;            /* Copies with a bad length or CRC */
+    uint32_t rx_missed;             /* Copies seen only on the other bus */
+    uint32_t tx_sent;
+    uint32_t tx_failed;
+    uint32_t tx_skipped;            /* Not sent while out of transmission */
+    uint32_t failovers;             /* Times taken out of service */
+    bool     tx_ok;                 /* In transmission */
+    bool     rx_ok;                 /* Not silent */
+    bool     fault;                 /* Controller error passive or bus-off */
+} redund_bus_stats_t;
+
+typedef struct
+{
+    uint32_t delivered;             /* Frames delivered, one per sequence */
+    uint32_t duplicates;            /* Second copies suppressed */
+    uint32_t stale;                 /* Frames older than the window */
+    uint32_t resyncs;               /* Streams restarted by the sender */
+    redund_bus_stats_t bus[REDUND_BUS_COUNT];
+} redund_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void    redund_init(redund_send_fn_t send);
+uint8_t redund_frame_len(uint32_t stream);
+uint32_t redund_stream_id(uint32_t stream);
+bool    redund_send(uint32_t stream, const uint8_t *data, uint32_t now_ms);
+int32_t redund_receive(uint32_t bus, uint32_t id, const uint8_t *data,
+                       uint8_t len, uint32_t now_ms);
+void    redund_bus_fault(uint32_t bus, bool fault, uint32_t now_ms);
+void    redund_poll(uint32_t now_ms);
+void    redund_get_stats(redund_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* REDUND_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,470 @@
+/******************************************************************************
+* File Name:   redund_can.c
+*
+* Description: CAN FD channel glue of the redundancy layer: runs the second
+*              channel as bus B, sends the heartbeat stream of this node on
+*              both buses and passes controller errors to the redundancy
+*              layer.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "cybsp.h"
+#include "nm.h"
+#include "pubsub.h"
+#include "redund_can.h"
+#include "stats.h"
+
+#if (REDUND_ENABLE)
+#if !defined(CANFD_B_HW)
+#error "REDUND_ENABLE=1 needs the second CAN FD channel enabled in the design \
+with the name CANFD_B"
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* The channel of bus B is the one the application channel does not use */
+#ifndef REDUND_CAN_B_CHANNEL
+#if defined (CY_DEVICE_PSC3)
+#define REDUND_CAN_B_CHANNEL    (0U)
+#define REDUND_CAN_B_INTERRUPT  canfd_0_interrupts0_0_IRQn
+#else
+#define REDUND_CAN_B_CHANNEL    (1U)
+#define REDUND_CAN_B_INTERRUPT  canfd_0_interrupts0_1_IRQn
+#endif
+#endif
+
+/* Bus B has its own TX buffer */
+#define REDUND_CAN_B_TX_BUFFER  (0U)
+
+#define REDUND_CAN_BUS_A        (0U)
+#define REDUND_CAN_BUS_B        (1U)
+
+/* Heartbeat payload: counter and sender time, little endian */
+#define REDUND_CAN_PAYLOAD_SIZE (8U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void redund_can_isr(void);
+static void redund_can_rx_callback(bool msg_valid, uint8_t msg_buf_fifo_num,
+                                   cy_stc_canfd_rx_buffer_t *rx_buf);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static CANFD_Type              *redund_can_a_base;
+static uint32_t                 redund_can_a_chan;
+static redund_can_send_fn_t     redund_can_send_a;
+static uint8_t                  redund_can_node;
+
+/* Bus B channel. Its RX callback is set here, so the design does not need
+ * one. */
+static cy_stc_canfd_context_t   redund_can_b_context;
+static cy_stc_canfd_config_t    redund_can_b_config;
+
+static cy_stc_canfd_t0_t        redund_can_b_t0;
+static cy_stc_canfd_t1_t        redund_can_b_t1;
+static uint32_t                 redund_can_b_data[CANFD_MAX_DATA_LEN /
+                                                  sizeof(uint32_t)];
+static cy_stc_canfd_tx_buffer_t redund_can_b_tx =
+{
+    .t0_f = &redund_can_b_t0,
+    .t1_f = &redund_can_b_t1,
+    .data_area_f = redund_can_b_data
+};
+
+/* Same priority as the bus A interrupt, so the two RX callbacks never
+ * preempt each other and stay a single producer of the frame pool */
+static const cy_stc_sysint_t redund_can_b_irq_cfg =
+{
+    .intrSrc = REDUND_CAN_B_INTERRUPT,
+    .intrPriority = 1U,
+};
+
+/* Heartbeat sender */
+static uint32_t redund_can_next_ms;
+static uint32_t redund_can_counter;
+
+/* Delivered heartbeats per stream */
+static bool     redund_can_rx_started[REDUND_STREAM_COUNT];
+static uint32_t redund_can_rx_counter[REDUND_STREAM_COUNT];
+static uint32_t redund_can_rx_ms[REDUND_STREAM_COUNT];
+static uint32_t redund_can_lost;            /* Lost on both buses */
+static uint32_t redund_can_max_gap_ms;      /* Longest time between two */
+
+#if (STATS_ENABLE)
+/* Failovers of both buses already added to the statistics registry */
+static uint32_t redund_can_failovers;
+#endif /* STATS_ENABLE */
+
+/*******************************************************************************
+* Function Name: redund_can_isr
+********************************************************************************
+* Summary:
+* Interrupt handler of the bus B channel.
+*
+*******************************************************************************/
+static void redund_can_isr(void)
+{
+    Cy_CANFD_IrqHandler(CANFD_B_HW, REDUND_CAN_B_CHANNEL,
+                        &redund_can_b_context);
+}
+
+/*******************************************************************************
+* Function Name: redund_can_rx_callback
+********************************************************************************
+* Summary:
+* RX callback of the bus B channel. Publishes the frame like the bus A
+* callback does, marked as received on bus B. The ID filter of the channel
+* in the design decides which frames get here.
+*
+* Parameters:
+*  msg_valid            Message received properly or not
+*  msg_buf_fifo_num     RX FIFO number of the message (unused)
+*  rx_buf               Message buffer
+*
+*******************************************************************************/
+static void redund_can_rx_callback(bool msg_valid, uint8_t msg_buf_fifo_num,
+                                   cy_stc_canfd_rx_buffer_t *rx_buf)
+{
+    canfd_frame_t *frame;
+    pubsub_handle_t handle;
+
+    CY_UNUSED_PARAMETER(msg_buf_fifo_num);
+
+    if ((true == msg_valid) &&
+        (CY_CANFD_RTR_DATA_FRAME == rx_buf->r0_f->rtr))
+    {
+        frame = pubsub_alloc(&handle);
+        if (NULL != frame)
+        {
+            canfd_frame_from_rx_buffer(frame, rx_buf);
+            frame->bus = (uint8_t)REDUND_CAN_BUS_B;
+            pubsub_publish(handle);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: redund_can_send
+********************************************************************************
+* Summary:
+* Sends a redundant frame on one bus: through the application sender on bus
+* A, and through the bus B channel if its TX buffer is free.
+*
+*******************************************************************************/
+static bool redund_can_send(uint32_t bus, uint32_t id, const uint8_t *data,
+                            uint8_t len)
+{
+    canfd_frame_t frame;
+
+    frame.id = id;
+    frame.timestamp = 0U;
+    frame.len = len;
+    frame.flags = CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS;
+    frame.bus = (uint8_t)bus;
+    frame.reserved = 0U;
+    memcpy(frame.data, data, len);
+
+    if (REDUND_CAN_BUS_A == bus)
+    {
+        return redund_can_send_a(&frame);
+    }
+
+    if (CY_CANFD_TX_BUFFER_PENDING ==
+        Cy_CANFD_GetTxBufferStatus(CANFD_B_HW, REDUND_CAN_B_CHANNEL,
+                                   REDUND_CAN_B_TX_BUFFER))
+    {
+        return false;
+    }
+
+    canfd_frame_to_tx_buffer(&frame, &redund_can_b_tx);
+    redund_can_b_t0.esi = CY_CANFD_ESI_ERROR_ACTIVE;
+    redund_can_b_t1.efc = false;
+    redund_can_b_t1.mm = 0U;
+
+    return (CY_CANFD_SUCCESS ==
+            Cy_CANFD_UpdateAndTransmitMsgBuffer(CANFD_B_HW,
+                                                REDUND_CAN_B_CHANNEL,
+                                                &redund_can_b_tx,
+                                                REDUND_CAN_B_TX_BUFFER,
+                                                &redund_can_b_context));
+}
+
+/*******************************************************************************
+* Function Name: redund_can_check
+********************************************************************************
+* Summary:
+* Passes the error state of a channel to the redundancy layer. A channel in
+* bus-off is restarted; the controller then waits for 128 idle sequences
+* on the bus before it takes part again.
+*
+* Parameters:
+*  bus          Bus index
+*  base         CAN FD block
+*  chan         Channel of the bus
+*  now_ms       Current time
+*
+*******************************************************************************/
+static void redund_can_check(uint32_t bus, CANFD_Type *base, uint32_t chan,
+                             uint32_t now_ms)
+{
+    uint32_t psr = CANFD_PSR(base, chan);
+
+    redund_bus_fault(bus, 0U != (psr & (CANFD_CH_M_TTCAN_PSR_BO_Msk |
+                                        CANFD_CH_M_TTCAN_PSR_EP_Msk)),
+                     now_ms);
+
+    if (0U != (psr & CANFD_CH_M_TTCAN_PSR_BO_Msk))
+    {
+        (void)Cy_CANFD_ConfigChangesDisable(base, chan);
+    }
+}
+
+#if (STATS_ENABLE)
+/*******************************************************************************
+* Function Name: redund_can_count_failovers
+********************************************************************************
+* Summary:
+* Adds the failovers of both buses since the last call to the statistics
+* registry. redund.c only uses the C library, for the host simulator, so
+* its counters are followed here.
+*
+*******************************************************************************/
+static void redund_can_count_failovers(void)
+{
+    redund_stats_t stats;
+    uint32_t failovers = 0U;
+
+    redund_get_stats(&stats);
+    for (uint32_t bus = 0U; bus < REDUND_BUS_COUNT; bus++)
+    {
+        failovers += stats.bus[bus].failovers;
+    }
+    STATS_FOLLOW(REDUND_FAILOVERS, failovers, &redund_can_failovers);
+}
+#endif /* STATS_ENABLE */
+#endif /* REDUND_ENABLE */
+
+/*******************************************************************************
+* Function Name: redund_can_init
+********************************************************************************
+* Summary:
+* Starts the bus B channel and the redundancy layer. Call it after the bus A
+* channel has been initialized and before interrupts are enabled.
+*
+* Parameters:
+*  base         CAN FD block of bus A
+*  chan         Channel of bus A
+*  node         Node number; selects the stream this node sends
+*  send         Sends a frame on bus A
+*
+*******************************************************************************/
+void redund_can_init(CANFD_Type *base, uint32_t chan, uint8_t node,
+                     redund_can_send_fn_t send)
+{
+#if (REDUND_ENABLE)
+    redund_can_a_base = base;
+    redund_can_a_chan = chan;
+    redund_can_send_a = send;
+    redund_can_node = node;
+
+    redund_can_b_config = CANFD_B_config;
+    redund_can_b_config.rxCallback = redund_can_rx_callback;
+    if (CY_CANFD_SUCCESS != Cy_CANFD_Init(CANFD_B_HW, REDUND_CAN_B_CHANNEL,
+                                          &redund_can_b_config,
+                                          &redund_can_b_context))
+    {
+        printf("Redundancy: bus B channel failed to start\r\n");
+    }
+
+    (void)Cy_SysInt_Init(&redund_can_b_irq_cfg, &redund_can_isr);
+    NVIC_EnableIRQ(REDUND_CAN_B_INTERRUPT);
+
+    redund_init(redund_can_send);
+#else
+    CY_UNUSED_PARAMETER(base);
+    CY_UNUSED_PARAMETER(chan);
+    CY_UNUSED_PARAMETER(node);
+    CY_UNUSED_PARAMETER(send);
+#endif /* REDUND_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: redund_can_poll
+********************************************************************************
+* Summary:
+* Checks both controllers, sends the heartbeat of this node when it is due
+* and runs the silent bus check. Nothing is sent while the network sleeps.
+*
+* Parameters:
+*  now_ms       Current time
+*
+*******************************************************************************/
+void redund_can_poll(uint32_t now_ms)
+{
+#if (REDUND_ENABLE)
+    uint8_t payload[REDUND_CAN_PAYLOAD_SIZE];
+
+    if (nm_tx_allowed())
+    {
+        redund_can_check(REDUND_CAN_BUS_A, redund_can_a_base,
+                         redund_can_a_chan, now_ms);
+        redund_can_check(REDUND_CAN_BUS_B, CANFD_B_HW, REDUND_CAN_B_CHANNEL,
+                         now_ms);
+
+        if ((int32_t)(now_ms - redund_can_next_ms) >= 0)
+        {
+            redund_can_next_ms = now_ms + REDUND_CAN_PERIOD_MS;
+            for (uint32_t idx = 0U; idx < 4U; idx++)
+            {
+                payload[idx] = (uint8_t)(redund_can_counter >> (idx * 8U));
+                payload[idx + 4U] = (uint8_t)(now_ms >> (idx * 8U));
+            }
+            redund_can_counter++;
+            (void)redund_send((1U == redund_can_node) ?
+                              REDUND_STREAM_NODE_1 : REDUND_STREAM_NODE_2,
+                              payload, now_ms);
+        }
+    }
+
+    redund_poll(now_ms);
+#if (STATS_ENABLE)
+    redund_can_count_failovers();
+#endif /* STATS_ENABLE */
+#else
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* REDUND_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: redund_can_on_frame
+********************************************************************************
+* Summary:
+* Passes a received frame to the redundancy layer. For the first copy of
+* each heartbeat, counts the heartbeats lost on both buses and the longest
+* time between two delivered ones.
+*
+* Parameters:
+*  frame        Received frame, from either bus
+*  now_ms       Current time
+*
+*******************************************************************************/
+void redund_can_on_frame(const canfd_frame_t *frame, uint32_t now_ms)
+{
+#if (REDUND_ENABLE)
+    int32_t stream = redund_receive(frame->bus, frame->id, frame->data,
+                                    frame->len, now_ms);
+    uint32_t counter = 0U;
+
+    if (stream < 0)
+    {
+        return;
+    }
+
+    for (uint32_t idx = 0U; idx < 4U; idx++)
+    {
+        counter |= (uint32_t)frame->data[idx] << (idx * 8U);
+    }
+
+    if (redund_can_rx_started[stream])
+    {
+        if ((uint32_t)(counter - redund_can_rx_counter[stream]) > 1U)
+        {
+            redund_can_lost += counter - redund_can_rx_counter[stream] - 1U;
+        }
+        if ((uint32_t)(now_ms - redund_can_rx_ms[stream]) >
+            redund_can_max_gap_ms)
+        {
+            redund_can_max_gap_ms = now_ms - redund_can_rx_ms[stream];
+        }
+    }
+    redund_can_rx_started[stream] = true;
+    redund_can_rx_counter[stream] = counter;
+    redund_can_rx_ms[stream] = now_ms;
+#else
+    CY_UNUSED_PARAMETER(frame);
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* REDUND_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: redund_can_report
+********************************************************************************
+* Summary:
+* Prints the counters and the state of both buses.
+*
+*******************************************************************************/
+void redund_can_report(void)
+{
+#if (REDUND_ENABLE)
+    redund_stats_t stats;
+
+    redund_get_stats(&stats);
+    printf("Redundancy: delivered %lu, duplicates %lu, stale %lu, "
+           "resyncs %lu, lost %lu, max gap %lu ms\r\n",
+           (unsigned long)stats.delivered, (unsigned long)stats.duplicates,
+           (unsigned long)stats.stale, (unsigned long)stats.resyncs,
+           (unsigned long)redund_can_lost,
+           (unsigned long)redund_can_max_gap_ms);
+
+    for (uint32_t bus = 0U; bus < REDUND_BUS_COUNT; bus++)
+    {
+        const redund_bus_stats_t *bs = &stats.bus[bus];
+
+        printf("  Bus %c: tx %lu/%lu failed %lu, rx %lu first %lu "
+               "missed %lu bad %lu, failovers %lu, %s%s%s\r\n",
+               (int)('A' + bus), (unsigned long)bs->tx_sent,
+               (unsigned long)(bs->tx_sent + bs->tx_failed + bs->tx_skipped),
+               (unsigned long)bs->tx_failed, (unsigned long)bs->rx_valid,
+               (unsigned long)bs->rx_first, (unsigned long)bs->rx_missed,
+               (unsigned long)bs->rx_invalid, (unsigned long)bs->failovers,
+               bs->tx_ok ? "tx up" : "tx down",
+               bs->rx_ok ? ", rx up" : ", rx silent",
+               bs->fault ? ", controller error" : "");
+    }
+#endif /* REDUND_ENABLE */
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,85 @@
+/******************************************************************************
+* File Name:   redund_can.h
+*
+* Description: Interface of the CAN FD channel glue of the redundancy layer.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef REDUND_CAN_H_
+#define REDUND_CAN_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "canfd_frame.h"
+#include "redund.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Period of the heartbeat stream of this node */
+#ifndef REDUND_CAN_PERIOD_MS
+#define REDUND_CAN_PERIOD_MS    (10U)
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Sends a frame on the application channel (bus A) */
+typedef bool (*redund_can_send_fn_t)(const canfd_frame_t *frame);
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void redund_can_init(CANFD_Type *base, uint32_t chan, uint8_t node,
+                     redund_can_send_fn_t send);
+void redund_can_poll(uint32_t now_ms);
+void redund_can_on_frame(const canfd_frame_t *frame, uint32_t now_ms);
+void redund_can_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* REDUND_CAN_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,798 @@
+/******************************************************************************
+* File Name:   rpc.c
+*
+* Description: This file contains the RPC layer: generated message codecs and
+*              client stubs, pipelined calls with timeouts and retries, and
+*              the server with its response cache.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "rpc.h"
+#include "cycle_counter.h"
+#include "hoptrace.h"
+#include "stats.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Serialized size of the fields, for the compile-time size check */
+#define RPC_FIELD_SIZE_U8(n)            (1U)
+#define RPC_FIELD_SIZE_U16(n)           (2U)
+#define RPC_FIELD_SIZE_U32(n)           (4U)
+#define RPC_FIELD_SIZE_I32(n)           (4U)
+#define RPC_FIELD_SIZE_BLOCK(n)         (1U + (n))
+#define RPC_FIELD_SIZE(kind, name, n)   + RPC_FIELD_SIZE_##kind(n)
+
+/* Field encoders: append msg->name to buf at pos */
+#define RPC_ENC_U8(name, n)                                                    \
+    buf[pos++] = msg->name;
+#define RPC_ENC_U16(name, n)                                                   \
+    pos = rpc_put(buf, pos, msg->name, 2U);
+#define RPC_ENC_U32(name, n)                                                   \
+    pos = rpc_put(buf, pos, msg->name, 4U);
+#define RPC_ENC_I32(name, n)                                                   \
+    pos = rpc_put(buf, pos, (uint32_t)msg->name, 4U);
+#define RPC_ENC_BLOCK(name, n)                                                 \
+    {                                                                          \
+        uint32_t used = (msg->name##_len < (n)) ? msg->name##_len : (n);       \
+        buf[pos++] = (uint8_t)used;                                            \
+        memcpy(&buf[pos], msg->name, used);                                    \
+        pos += used;                                                           \
+    }
+#define RPC_ENC(kind, name, n)          RPC_ENC_##kind(name, n)
+
+/* Field decoders: read msg->name from buf at pos, fail on short input */
+#define RPC_DEC_U8(name, n)                                                    \
+    if ((pos + 1U) > len) { return false; }                                    \
+    msg->name = buf[pos++];
+#define RPC_DEC_U16(name, n)                                                   \
+    if ((pos + 2U) > len) { return false; }                                    \
+    msg->name = (uint16_t)rpc_get(buf, pos, 2U);                               \
+    pos += 2U;
+#define RPC_DEC_U32(name, n)                                                   \
+    if ((pos + 4U) > len) { return false; }                                    \
+    msg->name = rpc_get(buf, pos, 4U);                                         \
+    pos += 4U;
+#define RPC_DEC_I32(name, n)                                                   \
+    if ((pos + 4U) > len) { return false; }                                    \
+    msg->name = (int32_t)rpc_get(buf, pos, 4U);                                \
+    pos += 4U;
+#define RPC_DEC_BLOCK(name, n)                                                 \
+    if ((pos + 1U) > len) { return false; }                                    \
+    msg->name##_len = buf[pos++];                                              \
+    if ((msg->name##_len > (n)) || ((pos + msg->name##_len) > len))            \
+    {                                                                          \
+        return false;                                                          \
+    }                                                                          \
+    memcpy(msg->name, &buf[pos], msg->name##_len);                             \
+    pos += msg->name##_len;
+#define RPC_DEC(kind, name, n)          RPC_DEC_##kind(name, n)
+
+/* Generated per procedure: size checks, encoders and decoders of both
+ * messages, the completion trampoline of the client, and the server entry.
+ * Decoders accept trailing bytes, as the receiver sees the payload padded to
+ * the next CAN FD length. */
+#define RPC_METHOD_CODEC(ID, name, num)                                        \
+    _Static_assert((0U RPC_##ID##_REQ(RPC_FIELD_SIZE)) <= RPC_PAYLOAD_MAX,     \
+                   "rpc_" #name "_req_t does not fit into one frame");         \
+    _Static_assert((0U RPC_##ID##_RESP(RPC_FIELD_SIZE)) <= RPC_PAYLOAD_MAX,    \
+                   "rpc_" #name "_resp_t does not fit into one frame");        \
+    _Static_assert((num) == (uint32_t)RPC_METHOD_INDEX_##ID,                   \
+                   "RPC method numbers must run from 0 without gaps");         \
+    static uint32_t rpc_encode_##name##_req(const rpc_##name##_req_t *msg,     \
+                                            uint8_t *buf)                      \
+    {                                                                          \
+        uint32_t pos = 0U;                                                     \
+        RPC_##ID##_REQ(RPC_ENC)                                                \
+        return pos;                                                            \
+    }                                                                          \
+    static bool rpc_decode_##name##_req(rpc_##name##_req_t *msg,               \
+                                        const uint8_t *buf, uint32_t len)      \
+    {                                                                          \
+        uint32_t pos = 0U;                                                     \
+        RPC_##ID##_REQ(RPC_DEC)                                                \
+        return true;                                                           \
+    }                                                                          \
+    static uint32_t rpc_encode_##name##_resp(const rpc_##name##_resp_t *msg,   \
+                                             uint8_t *buf)                     \
+    {                                                                          \
+        uint32_t pos = 0U;                                                     \
+        RPC_##ID##_RESP(RPC_ENC)                                               \
+        return pos;                                                            \
+    }                                                                          \
+    static bool rpc_decode_##name##_resp(rpc_##name##_resp_t *msg,             \
+                                         const uint8_t *buf, uint32_t len)     \
+    {                                                                          \
+        uint32_t pos = 0U;                                                     \
+        RPC_##ID##_RESP(RPC_DEC)                                               \
+        return true;                                                           \
+    }                                                                          \
+    static void rpc_complete_##name(const rpc_call_t *call,                    \
+                                    rpc_status_t status,                       \
+                                    const uint8_t *buf, uint32_t len)          \
+    {                                                                          \
+        rpc_##name##_resp_t resp;                                              \
+        rpc_##name##_done_t done = (rpc_##name##_done_t)call->done;            \
+        if ((RPC_STATUS_OK == status) &&                                       \
+            !rpc_decode_##name##_resp(&resp, buf, len))                        \
+        {                                                                      \
+            status = RPC_STATUS_BAD_MESSAGE;                                   \
+        }                                                                      \
+        if (NULL != done)                                                      \
+        {                                                                      \
+            done(status, (RPC_STATUS_OK == status) ? &resp : NULL, call->ctx); \
+        }                                                                      \
+    }                                                                          \
+    static rpc_status_t rpc_dispatch_##name(uint8_t caller,                    \
+                                            const uint8_t *in, uint32_t len,   \
+                                            uint8_t *out, uint32_t *out_len)   \
+    {                                                                          \
+        rpc_##name##_req_t req;                                                \
+        rpc_##name##_resp_t resp;                                              \
+        rpc_status_t status;                                                   \
+        if (!rpc_decode_##name##_req(&req, in, len))                           \
+        {                                                                      \
+            return RPC_STATUS_BAD_MESSAGE;                                     \
+        }                                                                      \
+        memset(&resp, 0, sizeof(resp));                                        \
+        status = rpc_serve_##name(caller, &req, &resp);                        \
+        if (RPC_STATUS_OK == status)                                           \
+        {                                                                      \
+            *out_len = rpc_encode_##name##_resp(&resp, out);                   \
+        }                                                                      \
+        return status;                                                         \
+    }
+
+/* Generated client stub */
+#define RPC_METHOD_STUB(ID, name, num)                                         \
+    rpc_status_t rpc_call_##name(uint8_t peer, const rpc_##name##_req_t *req, \
+                                 rpc_##name##_done_t done, void *ctx)          \
+    {                                                                          \
+        rpc_call_t *call = rpc_call_start(peer, RPC_METHOD_##ID,               \
+                                          (rpc_done_fn_t)done, ctx);           \
+        if (NULL == call)                                                      \
+        {                                                                      \
+            return RPC_STATUS_BUSY;                                            \
+        }                                                                      \
+        call->frame.len = (uint8_t)(RPC_HEADER_SIZE +                          \
+            rpc_encode_##name##_req(req, &call->frame.data[RPC_HEADER_SIZE])); \
+        return RPC_STATUS_OK;                                                  \
+    }
+
+#define RPC_METHOD_COMPLETE_CASE(ID, name, num)                                \
+    case RPC_METHOD_##ID:                                                      \
+        rpc_complete_##name(call, status, buf, len);                           \
+        break;
+
+#define RPC_METHOD_DISPATCH_CASE(ID, name, num)                                \
+    case RPC_METHOD_##ID:                                                      \
+        status = rpc_dispatch_##name(caller, in, len, out, &out_len);          \
+        break;
+
+#define RPC_METHOD_NAME(ID, name, num)  [RPC_METHOD_##ID] = #name,
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Completion callback of any procedure; cast back to the generated type
+ * before it is called */
+typedef void (*rpc_done_fn_t)(void);
+
+/* Call in flight */
+typedef struct
+{
+    bool            used;
+    bool            unsent;         /* Request waiting for the TX buffer */
+    uint8_t         peer;
+    uint8_t         method;
+    uint8_t         call_id;
+    uint8_t         retries;
+    uint32_t        start;          /* Cycle count of the first send */
+    uint32_t        sent;           /* Cycle count of the latest send */
+    rpc_done_fn_t   done;
+    void           *ctx;
+    canfd_frame_t   frame;          /* Request, kept for retries */
+} rpc_call_t;
+
+/* Response kept by the server */
+typedef struct
+{
+    bool            valid;
+    uint8_t         caller;
+    uint8_t         method;
+    uint8_t         call_id;
+    canfd_frame_t   frame;
+} rpc_cache_entry_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint32_t rpc_put(uint8_t *buf, uint32_t pos, uint32_t value,
+                        uint32_t size);
+static uint32_t rpc_get(const uint8_t *buf, uint32_t pos, uint32_t size);
+static rpc_call_t *rpc_call_start(uint8_t peer, rpc_method_t method,
+                                  rpc_done_fn_t done, void *ctx);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint8_t            rpc_node;
+static rpc_send_fn_t      rpc_send;
+static uint8_t            rpc_next_call_id;
+static rpc_call_t         rpc_calls[RPC_MAX_PENDING];
+
+static rpc_cache_entry_t  rpc_cache[RPC_SERVER_CACHE_SIZE];
+static uint32_t           rpc_cache_next;
+
+/* Responses waiting for the TX buffer, as indexes into rpc_cache */
+static uint8_t            rpc_tx_queue[RPC_TX_QUEUE_SIZE];
+static uint32_t           rpc_tx_head;
+static uint32_t           rpc_tx_tail;
+
+static rpc_method_stats_t rpc_stats[RPC_METHOD_COUNT];
+
+/* Time since the first call, for the call rate */
+static uint64_t           rpc_cycles;
+static uint32_t           rpc_last_poll;
+static bool               rpc_active;
+
+static const char * const rpc_method_names[RPC_METHOD_COUNT] =
+{
+    RPC_METHOD_LIST(RPC_METHOD_NAME)
+};
+
+/*******************************************************************************
+* Generated Functions
+*******************************************************************************/
+RPC_METHOD_LIST(RPC_METHOD_CODEC)
+RPC_METHOD_LIST(RPC_METHOD_STUB)
+
+/*******************************************************************************
+* Function Name: rpc_put
+********************************************************************************
+* Summary:
+* Stores a little-endian value of size bytes at buf[pos].
+*
+* Return:
+*  Position after the value
+*
+*******************************************************************************/
+static uint32_t rpc_put(uint8_t *buf, uint32_t pos, uint32_t value,
+                        uint32_t size)
+{
+    for (uint32_t idx = 0U; idx < size; idx++)
+    {
+        buf[pos++] = (uint8_t)(value >> (8U * idx));
+    }
+
+    return pos;
+}
+
+/*******************************************************************************
+* Function Name: rpc_get
+********************************************************************************
+* Summary:
+* Loads a little-endian value of size bytes from buf[pos].
+*
+*******************************************************************************/
+static uint32_t rpc_get(const uint8_t *buf, uint32_t pos, uint32_t size)
+{
+    uint32_t value = 0U;
+
+    for (uint32_t idx = 0U; idx < size; idx++)
+    {
+        value |= (uint32_t)buf[pos + idx] << (8U * idx);
+    }
+
+    return value;
+}
+
+/*******************************************************************************
+* Function Name: rpc_frame_header
+********************************************************************************
+* Summary:
+* Fills in the CAN ID and the header of an RPC frame.
+*
+*******************************************************************************/
+static void rpc_frame_header(canfd_frame_t *frame, uint32_t id, uint8_t method,
+                             uint8_t call_id, uint8_t status)
+{
+    frame->id = id;
+    frame->timestamp = 0U;
+    frame->flags = CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS;
+    frame->len = RPC_HEADER_SIZE;
+    frame->data[0] = method;
+    frame->data[1] = call_id;
+    frame->data[2] = status;
+    frame->data[3] = rpc_node;
+}
+
+/*******************************************************************************
+* Function Name: rpc_init
+********************************************************************************
+* Summary:
+* Initializes the RPC layer.
+*
+* Parameters:
+*  node         Node number of this board, 0 to RPC_NODE_MAX
+*  send         Frame transmit function
+*
+*******************************************************************************/
+void rpc_init(uint8_t node, rpc_send_fn_t send)
+{
+    CY_ASSERT(node <= RPC_NODE_MAX);
+
+    memset(rpc_calls, 0, sizeof(rpc_calls));
+    memset(rpc_cache, 0, sizeof(rpc_cache));
+    memset(rpc_stats, 0, sizeof(rpc_stats));
+    rpc_node = node;
+    rpc_send = send;
+    rpc_tx_head = 0U;
+    rpc_tx_tail = 0U;
+    rpc_cycles = 0U;
+    rpc_active = false;
+
+    for (uint32_t method = 0U; method < RPC_METHOD_COUNT; method++)
+    {
+        rpc_stats[method].latency_min = UINT32_MAX;
+    }
+
+    cycle_counter_init();
+}
+
+/*******************************************************************************
+* Function Name: rpc_call_id_next
+********************************************************************************
+* Summary:
+* Returns the next call ID that is not in use by another call to the same
+* peer. Call IDs wrap quickly under load, and a call waiting for a retry must
+* not take the response of a newer call.
+*
+*******************************************************************************/
+static uint8_t rpc_call_id_next(uint8_t peer)
+{
+    bool in_use;
+    uint8_t call_id;
+
+    do
+    {
+        call_id = rpc_next_call_id++;
+        in_use = false;
+        for (uint32_t idx = 0U; idx < RPC_MAX_PENDING; idx++)
+        {
+            if (rpc_calls[idx].used && (rpc_calls[idx].peer == peer) &&
+                (rpc_calls[idx].call_id == call_id))
+            {
+                in_use = true;
+            }
+        }
+    } while (in_use);
+
+    return call_id;
+}
+
+/*******************************************************************************
+* Function Name: rpc_call_start
+********************************************************************************
+* Summary:
+* Reserves a call slot and fills in the request header. The request is sent
+* by rpc_poll(), so several calls issued in a row go out back to back without
+* waiting for each other's responses.
+*
+* Return:
+*  Call slot, or NULL if the peer or the whole layer has too many calls in
+*  flight
+*
+*******************************************************************************/
+static rpc_call_t *rpc_call_start(uint8_t peer, rpc_method_t method,
+                                  rpc_done_fn_t done, void *ctx)
+{
+    rpc_call_t *call = NULL;
+
+    if ((peer > RPC_NODE_MAX) || (rpc_pending(peer) >= RPC_MAX_OUTSTANDING))
+    {
+        return NULL;
+    }
+
+    for (uint32_t idx = 0U; idx < RPC_MAX_PENDING; idx++)
+    {
+        if (!rpc_calls[idx].used)
+        {
+            call = &rpc_calls[idx];
+            break;
+        }
+    }
+
+    if (NULL == call)
+    {
+        return NULL;
+    }
+
+    call->used = true;
+    call->unsent = true;
+    call->peer = peer;
+    call->method = (uint8_t)method;
+    call->call_id = rpc_call_id_next(peer);
+    call->retries = 0U;
+    call->done = done;
+    call->ctx = ctx;
+    rpc_frame_header(&call->frame, RPC_REQUEST_ID + peer, (uint8_t)method,
+                     call->call_id, (uint8_t)RPC_STATUS_OK);
+
+    rpc_stats[method].calls++;
+    STATS_INC(RPC_CALLS);
+    if (!rpc_active)
+    {
+        rpc_active = true;
+        rpc_last_poll = cycle_counter_get();
+    }
+
+    return call;
+}
+
+/*******************************************************************************
+* Function Name: rpc_call_finish
+********************************************************************************
+* Summary:
+* Frees a call slot and reports the result to the caller.
+*
+*******************************************************************************/
+static void rpc_call_finish(rpc_call_t *slot, rpc_status_t status,
+                            const uint8_t *buf, uint32_t len)
+{
+    rpc_method_stats_t *stats = &rpc_stats[slot->method];
+    rpc_call_t done = *slot;
+    const rpc_call_t *call = &done;
+
+    /* Free the slot first so that the callback can issue the next call */
+    slot->used = false;
+
+    if (RPC_STATUS_OK == status)
+    {
+        uint32_t latency = cycle_counter_get() - call->start;
+
+        stats->ok++;
+        stats->latency_total += latency;
+        stats->latency_min = (latency < stats->latency_min) ?
+                             latency : stats->latency_min;
+        stats->latency_max = (latency > stats->latency_max) ?
+                             latency : stats->latency_max;
+    }
+    else
+    {
+        stats->failed++;
+        if (RPC_STATUS_TIMEOUT == status)
+        {
+            stats->timeouts++;
+            STATS_INC(RPC_TIMEOUTS);
+        }
+    }
+
+    switch (call->method)
+    {
+        RPC_METHOD_LIST(RPC_METHOD_COMPLETE_CASE)
+        default:
+            break;
+    }
+}
+
+/*******************************************************************************
+* Function Name: rpc_serve
+********************************************************************************
+* Summary:
+* Runs a received request and queues the response. A repeated request, sent
+* again by the caller because the response was lost, is answered from the
+* cache instead of running the procedure a second time. The response carries
+* the trace trailer of the request it answers, see hoptrace.h.
+*
+*******************************************************************************/
+static void rpc_serve(const canfd_frame_t *frame)
+{
+    uint8_t method = frame->data[0];
+    uint8_t call_id = frame->data[1];
+    uint8_t caller = frame->data[3];
+    const uint8_t *in = &frame->data[RPC_HEADER_SIZE];
+    uint32_t len = (uint32_t)frame->len - RPC_HEADER_SIZE;
+    rpc_cache_entry_t *entry;
+    rpc_status_t status = RPC_STATUS_UNKNOWN_METHOD;
+    uint8_t *out;
+    uint32_t out_len = 0U;
+
+    if ((caller > RPC_NODE_MAX) ||
+        ((rpc_tx_head - rpc_tx_tail) >= RPC_TX_QUEUE_SIZE))
+    {
+        /* No room for the response; the caller will retry */
+        return;
+    }
+
+    for (uint32_t idx = 0U; idx < RPC_SERVER_CACHE_SIZE; idx++)
+    {
+        entry = &rpc_cache[idx];
+        if (entry->valid && (entry->caller == caller) &&
+            (entry->method == method) && (entry->call_id == call_id))
+        {
+            if (method < RPC_METHOD_COUNT)
+            {
+                rpc_stats[method].replayed++;
+            }
+            hoptrace_forward(&entry->frame, frame);
+            rpc_tx_queue[rpc_tx_head++ % RPC_TX_QUEUE_SIZE] = (uint8_t)idx;
+            return;
+        }
+    }
+
+    entry = &rpc_cache[rpc_cache_next];
+    out = &entry->frame.data[RPC_HEADER_SIZE];
+
+    switch (method)
+    {
+        RPC_METHOD_LIST(RPC_METHOD_DISPATCH_CASE)
+        default:
+            break;
+    }
+
+    if (method < RPC_METHOD_COUNT)
+    {
+        rpc_stats[method].served++;
+        STATS_INC(RPC_SERVED);
+    }
+
+    entry->valid = true;
+    entry->caller = caller;
+    entry->method = method;
+    entry->call_id = call_id;
+    rpc_frame_header(&entry->frame, RPC_RESPONSE_ID + caller, method, call_id,
+                     (uint8_t)status);
+    entry->frame.len = (uint8_t)(RPC_HEADER_SIZE + out_len);
+
+    /* The response continues the latency trace of the request */
+    hoptrace_forward(&entry->frame, frame);
+
+    rpc_tx_queue[rpc_tx_head++ % RPC_TX_QUEUE_SIZE] = (uint8_t)rpc_cache_next;
+    rpc_cache_next = (rpc_cache_next + 1U) % RPC_SERVER_CACHE_SIZE;
+}
+
+/*******************************************************************************
+* Function Name: rpc_on_frame
+********************************************************************************
+* Summary:
+* Handles a received request or response addressed to this node.
+*
+* Parameters:
+*  frame        Received frame with an ID in the RPC range
+*
+*******************************************************************************/
+void rpc_on_frame(const canfd_frame_t *frame)
+{
+    uint32_t base = frame->id & ~RPC_NODE_MAX;
+
+    if (((frame->id & RPC_NODE_MAX) != rpc_node) ||
+        (frame->len < RPC_HEADER_SIZE) || (NULL == rpc_send))
+    {
+        return;
+    }
+
+    if (RPC_REQUEST_ID == base)
+    {
+        rpc_serve(frame);
+    }
+    else if (RPC_RESPONSE_ID == base)
+    {
+        for (uint32_t idx = 0U; idx < RPC_MAX_PENDING; idx++)
+        {
+            rpc_call_t *call = &rpc_calls[idx];
+
+            if (call->used && !call->unsent &&
+                (call->peer == frame->data[3]) &&
+                (call->method == frame->data[0]) &&
+                (call->call_id == frame->data[1]))
+            {
+                rpc_call_finish(call, (rpc_status_t)frame->data[2],
+                                &frame->data[RPC_HEADER_SIZE],
+                                (uint32_t)frame->len - RPC_HEADER_SIZE);
+                break;
+            }
+        }
+    }
+    else
+    {
+        /* Not an RPC frame */
+    }
+}
+
+/*******************************************************************************
+* Function Name: rpc_poll
+********************************************************************************
+* Summary:
+* Called from the main loop. Sends queued responses first, then requests of
+* new calls, and sends a request again or fails the call when its response
+* is overdue. Sends at most one frame per call.
+*
+*******************************************************************************/
+void rpc_poll(void)
+{
+    uint32_t now = cycle_counter_get();
+    uint32_t timeout = (SystemCoreClock / 1000U) * RPC_TIMEOUT_MS;
+    rpc_call_t *oldest = NULL;
+
+    if (NULL == rpc_send)
+    {
+        return;
+    }
+
+    if (rpc_active)
+    {
+        rpc_cycles += (now - rpc_last_poll);
+        rpc_last_poll = now;
+    }
+
+    if (rpc_tx_head != rpc_tx_tail)
+    {
+        uint8_t idx = rpc_tx_queue[rpc_tx_tail % RPC_TX_QUEUE_SIZE];
+
+        if (rpc_send(&rpc_cache[idx].frame))
+        {
+            rpc_tx_tail++;
+        }
+        return;
+    }
+
+    for (uint32_t idx = 0U; idx < RPC_MAX_PENDING; idx++)
+    {
+        rpc_call_t *call = &rpc_calls[idx];
+
+        if (!call->used)
+        {
+            continue;
+        }
+
+        if (call->unsent)
+        {
+            /* Send new requests in the order they were issued */
+            if ((NULL == oldest) ||
+                ((uint8_t)(call->call_id - oldest->call_id) >= 0x80U))
+            {
+                oldest = call;
+            }
+        }
+        else if ((now - call->sent) >= timeout)
+        {
+            if (call->retries >= RPC_RETRIES)
+            {
+                rpc_call_finish(call, RPC_STATUS_TIMEOUT, NULL, 0U);
+            }
+            else if (rpc_send(&call->frame))
+            {
+                call->retries++;
+                call->sent = now;
+                rpc_stats[call->method].retries++;
+                STATS_INC(RPC_RETRIES);
+                return;
+            }
+            else
+            {
+                return;
+            }
+        }
+        else
+        {
+            /* Waiting for the response */
+        }
+    }
+
+    if ((NULL != oldest) && rpc_send(&oldest->frame))
+    {
+        oldest->unsent = false;
+        oldest->start = now;
+        oldest->sent = now;
+    }
+}
+
+/*******************************************************************************
+* Function Name: rpc_pending
+********************************************************************************
+* Summary:
+* Returns the number of calls in flight to a peer.
+*
+*******************************************************************************/
+uint32_t rpc_pending(uint8_t peer)
+{
+    uint32_t count = 0U;
+
+    for (uint32_t idx = 0U; idx < RPC_MAX_PENDING; idx++)
+    {
+        if (rpc_calls[idx].used && (rpc_calls[idx].peer == peer))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: rpc_report
+********************************************************************************
+* Summary:
+* Prints the counters, latencies and call rate of each procedure on the
+* debug UART.
+*
+*******************************************************************************/
+void rpc_report(void)
+{
+    uint32_t cycles_per_us = SystemCoreClock / 1000000U;
+    uint64_t ms = rpc_cycles / (SystemCoreClock / 1000U);
+
+    printf("RPC: %-14s %8s %8s %8s %8s %8s %8s %8s %8s\r\n", "method",
+           "calls", "ok", "timeouts", "retries", "served", "min_us",
+           "mean_us", "calls/s");
+
+    for (uint32_t method = 0U; method < RPC_METHOD_COUNT; method++)
+    {
+        const rpc_method_stats_t *stats = &rpc_stats[method];
+        uint32_t mean = 0U;
+        uint32_t min = 0U;
+        uint32_t rate = 0U;
+
+        if (0U != stats->ok)
+        {
+            mean = (uint32_t)(stats->latency_total / stats->ok);
+            min = stats->latency_min;
+        }
+        if (0U != ms)
+        {
+            rate = (uint32_t)(((uint64_t)stats->ok * 1000U) / ms);
+        }
+
+        printf("RPC: %-14s %8lu %8lu %8lu %8lu %8lu %8lu %8lu %8lu\r\n",
+               rpc_method_names[method], (unsigned long)stats->calls,
+               (unsigned long)stats->ok, (unsigned long)stats->timeouts,
+               (unsigned long)stats->retries,
+               (unsigned long)(stats->served + stats->replayed),
+               (unsigned long)(min / cycles_per_us),
+               (unsigned long)(mean / cycles_per_us), (unsigned long)rate);
+    }
+    printf("\r\n");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,199 @@
+/******************************************************************************
+* File Name:   rpc.h
+*
+* Description: This file contains the interface of the RPC layer and the
+*              message types, stubs and server prototypes generated from
+*              rpc_idl.h.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef RPC_H_
+#define RPC_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "canfd_frame.h"
+#include "rpc_idl.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Requests use RPC_REQUEST_ID + callee node, responses RPC_RESPONSE_ID +
+ * caller node. Nodes are numbered 0 to RPC_NODE_MAX. */
+#define RPC_REQUEST_ID          (0x300U)
+#define RPC_RESPONSE_ID         (0x340U)
+#define RPC_NODE_MAX            (0x3FU)
+
+/* Frame layout: method, call ID, status, source node, then the message */
+#define RPC_HEADER_SIZE         (4U)
+#define RPC_PAYLOAD_MAX         (CANFD_MAX_DATA_LEN - RPC_HEADER_SIZE)
+
+/* Calls in flight at the same time, over all peers */
+#ifndef RPC_MAX_PENDING
+#define RPC_MAX_PENDING         (8U)
+#endif
+
+/* Calls in flight at the same time to one peer */
+#ifndef RPC_MAX_OUTSTANDING
+#define RPC_MAX_OUTSTANDING     (4U)
+#endif
+
+/* Time to wait for a response before the request is sent again */
+#ifndef RPC_TIMEOUT_MS
+#define RPC_TIMEOUT_MS          (20U)
+#endif
+
+/* Times a request is sent again before the call fails with a timeout */
+#ifndef RPC_RETRIES
+#define RPC_RETRIES             (2U)
+#endif
+
+/* Responses waiting for the TX buffer */
+#ifndef RPC_TX_QUEUE_SIZE
+#define RPC_TX_QUEUE_SIZE       (4U)
+#endif
+
+/* Responses kept by the server, so that a repeated request is answered
+ * again without running the procedure twice */
+#ifndef RPC_SERVER_CACHE_SIZE
+#define RPC_SERVER_CACHE_SIZE   (4U)
+#endif
+
+/* Message field declarations, see rpc_idl.h */
+#define RPC_FIELD_DECL_U8(name, n)      uint8_t  name;
+#define RPC_FIELD_DECL_U16(name, n)     uint16_t name;
+#define RPC_FIELD_DECL_U32(name, n)     uint32_t name;
+#define RPC_FIELD_DECL_I32(name, n)     int32_t  name;
+#define RPC_FIELD_DECL_BLOCK(name, n)   uint8_t  name##_len; uint8_t name[n];
+#define RPC_FIELD_DECL(kind, name, n)   RPC_FIELD_DECL_##kind(name, n)
+
+#define RPC_METHOD_ENUM(ID, name, num)  RPC_METHOD_##ID = (num),
+#define RPC_METHOD_INDEX(ID, name, num) RPC_METHOD_INDEX_##ID,
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Result of a call */
+typedef enum
+{
+    RPC_STATUS_OK,
+    RPC_STATUS_BUSY,                /* Too many calls in flight */
+    RPC_STATUS_TIMEOUT,             /* No response after all retries */
+    RPC_STATUS_BAD_MESSAGE,         /* Message could not be decoded */
+    RPC_STATUS_UNKNOWN_METHOD,      /* Callee does not implement it */
+    RPC_STATUS_FAILED               /* Procedure reported an error */
+} rpc_status_t;
+
+/* Procedure numbers */
+typedef enum
+{
+    RPC_METHOD_LIST(RPC_METHOD_ENUM)
+} rpc_method_t;
+
+/* Position of each procedure in the list, to check the numbering */
+typedef enum
+{
+    RPC_METHOD_LIST(RPC_METHOD_INDEX)
+    RPC_METHOD_COUNT
+} rpc_method_index_t;
+
+/* Generated message types and completion callback types */
+#define RPC_METHOD_TYPES(ID, name, num)                                        \
+    typedef struct                                                             \
+    {                                                                          \
+        RPC_##ID##_REQ(RPC_FIELD_DECL)                                         \
+    } rpc_##name##_req_t;                                                      \
+    typedef struct                                                             \
+    {                                                                          \
+        RPC_##ID##_RESP(RPC_FIELD_DECL)                                        \
+    } rpc_##name##_resp_t;                                                     \
+    typedef void (*rpc_##name##_done_t)(rpc_status_t status,                   \
+                                        const rpc_##name##_resp_t *resp,       \
+                                        void *ctx);
+RPC_METHOD_LIST(RPC_METHOD_TYPES)
+
+/* Sends one frame; returns false if the controller cannot take it now */
+typedef bool (*rpc_send_fn_t)(const canfd_frame_t *frame);
+
+/* Counters of one procedure. Latencies run from the first send of the
+ * request to the response, in CPU cycles. */
+typedef struct
+{
+    uint32_t calls;                 /* Calls started */
+    uint32_t ok;                    /* Calls completed successfully */
+    uint32_t failed;                /* Calls completed with an error */
+    uint32_t timeouts;              /* Calls failed with RPC_STATUS_TIMEOUT */
+    uint32_t retries;               /* Requests sent again */
+    uint32_t served;                /* Requests run by the local server */
+    uint32_t replayed;              /* Repeated requests answered from cache */
+    uint32_t latency_min;
+    uint32_t latency_max;
+    uint64_t latency_total;
+} rpc_method_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/* Generated client stubs, and server functions provided by the application */
+#define RPC_METHOD_PROTOTYPES(ID, name, num)                                   \
+    rpc_status_t rpc_call_##name(uint8_t peer, const rpc_##name##_req_t *req, \
+                                 rpc_##name##_done_t done, void *ctx);         \
+    rpc_status_t rpc_serve_##name(uint8_t caller,                              \
+                                  const rpc_##name##_req_t *req,               \
+                                  rpc_##name##_resp_t *resp);
+RPC_METHOD_LIST(RPC_METHOD_PROTOTYPES)
+
+void     rpc_init(uint8_t node, rpc_send_fn_t send);
+void     rpc_on_frame(const canfd_frame_t *frame);
+void     rpc_poll(void);
+uint32_t rpc_pending(uint8_t peer);
+void     rpc_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* RPC_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,99 @@
+/******************************************************************************
+* File Name:   rpc_idl.h
+*
+* Description: This file contains the interface description of the remote
+*              procedures: the procedure list and the fields of each request
+*              and response message.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef RPC_IDL_H_
+#define RPC_IDL_H_
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Remote procedures: X(IDENTIFIER, name, method number).
+ * Each procedure has a request and a response message described by
+ * RPC_<IDENTIFIER>_REQ(F) and RPC_<IDENTIFIER>_RESP(F) below. rpc.h generates
+ * from these the message types rpc_<name>_req_t and rpc_<name>_resp_t, the
+ * client stub rpc_call_<name>() and the prototype of the server function
+ * rpc_serve_<name>() that the application provides. Method numbers are part
+ * of the wire format; they run from 0 without gaps. */
+#define RPC_METHOD_LIST(X)                                                     \
+    X(ECHO,             echo,               0U)                                \
+    X(SET_MODE,         set_mode,           1U)                                \
+    X(READ_BLOCK,       read_block,         2U)                                \
+    X(CALIBRATE_STEP,   calibrate_step,     3U)
+
+/* Message fields: F(kind, name, count). kind is U8, U16, U32 or I32 with
+ * count 1, or BLOCK for a byte array of up to count bytes. Fields are
+ * serialized in order, little-endian, with no padding; a BLOCK takes one
+ * length byte plus its used length. */
+
+/* Returns the value, used to measure round trips */
+#define RPC_ECHO_REQ(F)                                                        \
+    F(U32,   value,     1)
+#define RPC_ECHO_RESP(F)                                                       \
+    F(U32,   value,     1)
+
+/* Switches the operating mode, returns the previous one */
+#define RPC_SET_MODE_REQ(F)                                                    \
+    F(U8,    mode,      1)
+#define RPC_SET_MODE_RESP(F)                                                   \
+    F(U8,    previous,  1)
+
+/* Reads a block of device memory */
+#define RPC_READ_BLOCK_REQ(F)                                                  \
+    F(U16,   address,   1)                                                     \
+    F(U8,    length,    1)
+#define RPC_READ_BLOCK_RESP(F)                                                 \
+    F(U16,   address,   1)                                                     \
+    F(BLOCK, data,      48)
+
+/* Runs one calibration step with the given offset */
+#define RPC_CALIBRATE_STEP_REQ(F)                                              \
+    F(U8,    step,      1)                                                     \
+    F(I32,   offset,    1)
+#define RPC_CALIBRATE_STEP_RESP(F)                                             \
+    F(U8,    step,      1)                                                     \
+    F(I32,   result,    1)
+
+#endif /* RPC_IDL_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,223 @@
+/******************************************************************************
+* File Name:   rxdma.c
+*
+* Description: RX FIFO element ring filled by DMA: transfer sizing, ring
+*              indices and element header decoding.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "rxdma.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define RXDMA_SLOT(index)       ((index) & (RXDMA_RING_SLOTS - 1U))
+
+_Static_assert((RXDMA_RING_SLOTS & (RXDMA_RING_SLOTS - 1U)) == 0U,
+               "RXDMA_RING_SLOTS must be a power of two");
+
+/*******************************************************************************
+* Function Name: rxdma_init
+********************************************************************************
+* Summary:
+* Empties the ring and clears its statistics.
+*
+*******************************************************************************/
+void rxdma_init(rxdma_ring_t *ring)
+{
+    memset(ring, 0, sizeof(*ring));
+}
+
+/*******************************************************************************
+* Function Name: rxdma_plan
+********************************************************************************
+* Summary:
+* Sizes the next transfer out of the RX FIFO. A transfer moves elements that
+* are contiguous both in the FIFO, which wraps at fifo_size, and in the
+* ring, so that one descriptor with fixed strides covers it. Elements past
+* either wrap are left for the next transfer.
+*
+* Parameters:
+*  ring         Ring
+*  get          FIFO get index
+*  fill         FIFO fill level
+*  fifo_size    Elements in the FIFO
+*
+* Return:
+*  Elements to move to rxdma_dest(); 0 if a transfer is still in flight or
+*  there is nothing to move
+*
+*******************************************************************************/
+uint32_t rxdma_plan(rxdma_ring_t *ring, uint32_t get, uint32_t fill,
+                    uint32_t fifo_size)
+{
+    uint32_t count = fill;
+    uint32_t free_slots = RXDMA_RING_SLOTS - (ring->head - ring->tail);
+    uint32_t to_wrap = RXDMA_RING_SLOTS - RXDMA_SLOT(ring->head);
+
+    if ((0U != ring->busy) || (0U == fill))
+    {
+        return 0U;
+    }
+    if (0U == free_slots)
+    {
+        ring->stats.ring_full++;
+        return 0U;
+    }
+
+    if (count > (fifo_size - get))
+    {
+        count = fifo_size - get;
+    }
+    if (count > free_slots)
+    {
+        count = free_slots;
+    }
+    if (count > to_wrap)
+    {
+        count = to_wrap;
+    }
+
+    ring->busy = count;
+    ring->fifo_get = get;
+    ring->stats.transfers++;
+    if (count > ring->stats.batch_max)
+    {
+        ring->stats.batch_max = count;
+    }
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: rxdma_dest
+********************************************************************************
+* Summary:
+* Returns the slot the next transfer writes to.
+*
+*******************************************************************************/
+rxdma_element_t *rxdma_dest(rxdma_ring_t *ring)
+{
+    return &ring->slots[RXDMA_SLOT(ring->head)];
+}
+
+/*******************************************************************************
+* Function Name: rxdma_complete
+********************************************************************************
+* Summary:
+* Hands the elements of the finished transfer to the CPU.
+*
+* Parameters:
+*  ring         Ring with a transfer in flight
+*
+* Return:
+*  FIFO index of the last element moved, to be acknowledged
+*
+*******************************************************************************/
+uint32_t rxdma_complete(rxdma_ring_t *ring)
+{
+    uint32_t last = ring->fifo_get + ring->busy - 1U;
+
+    ring->head += ring->busy;
+    ring->stats.elements += ring->busy;
+    ring->busy = 0U;
+    return last;
+}
+
+/*******************************************************************************
+* Function Name: rxdma_peek
+********************************************************************************
+* Summary:
+* Returns the oldest unprocessed element, or NULL if there is none.
+*
+*******************************************************************************/
+const rxdma_element_t *rxdma_peek(const rxdma_ring_t *ring)
+{
+    if (ring->head == ring->tail)
+    {
+        return NULL;
+    }
+    return &ring->slots[RXDMA_SLOT(ring->tail)];
+}
+
+/*******************************************************************************
+* Function Name: rxdma_release
+********************************************************************************
+* Summary:
+* Frees the element returned by rxdma_peek() for the next transfers.
+*
+*******************************************************************************/
+void rxdma_release(rxdma_ring_t *ring)
+{
+    ring->tail++;
+}
+
+/*******************************************************************************
+* Function Name: rxdma_header_decode
+********************************************************************************
+* Summary:
+* Decodes the two header words of an element. The payload follows as bytes
+* from words[2] on.
+*
+* Parameters:
+*  element      Element copied from the message RAM
+*  header       Decoded header
+*
+*******************************************************************************/
+void rxdma_header_decode(const rxdma_element_t *element,
+                         rxdma_header_t *header)
+{
+    uint32_t r0 = element->words[0];
+    uint32_t r1 = element->words[1];
+
+    header->xtd = (0U != (r0 & RXDMA_R0_XTD));
+    header->rtr = (0U != (r0 & RXDMA_R0_RTR));
+    header->id = header->xtd ? (r0 & RXDMA_R0_ID_MASK) :
+                 ((r0 >> RXDMA_R0_STD_ID_POS) & RXDMA_R0_STD_ID_MASK);
+    header->fdf = (0U != (r1 & RXDMA_R1_FDF));
+    header->brs = (0U != (r1 & RXDMA_R1_BRS));
+    header->dlc = (uint8_t)((r1 >> RXDMA_R1_DLC_POS) & RXDMA_R1_DLC_MASK);
+    header->filter = (uint8_t)((r1 >> RXDMA_R1_FIDX_POS) & RXDMA_R1_FIDX_MASK);
+    header->timestamp = (uint16_t)(r1 & RXDMA_R1_RXTS_MASK);
+}
+
+/* [] END OF FILE */
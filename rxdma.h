@@ -0,0 +1,165 @@
+/******************************************************************************
+* File Name:   rxdma.h
+*
+* Description: RX FIFO element ring filled by DMA: transfer sizing, ring
+*              indices and element header decoding interface.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef RXDMA_H_
+#define RXDMA_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make RXDMA_ENABLE=1") to move the elements of
+ * RX FIFO 0 into a RAM ring by DMA instead of copying them in the RX
+ * interrupt */
+#ifndef RXDMA_ENABLE
+#define RXDMA_ENABLE            (0)
+#endif
+
+/* Words of one RX FIFO element: two header words and a 64-byte data field,
+ * as set for RX FIFO 0 in the design */
+#define RXDMA_ELEMENT_WORDS     (18U)
+
+/* Elements in the RAM ring: a power of two, at least twice the RX FIFO 0
+ * size so that one batch can be moved while the previous one is processed */
+#ifndef RXDMA_RING_SLOTS
+#define RXDMA_RING_SLOTS        (16U)
+#endif
+
+/* RX FIFO 0 fill level that starts a transfer */
+#ifndef RXDMA_WATERMARK
+#define RXDMA_WATERMARK         (4U)
+#endif
+
+/* Elements below the watermark are moved once the oldest has waited this
+ * many nominal bit times */
+#ifndef RXDMA_FLUSH_BITS
+#define RXDMA_FLUSH_BITS        (1000U)
+#endif
+
+/* Header word fields of an RX FIFO element */
+#define RXDMA_R0_ESI            (0x80000000UL)
+#define RXDMA_R0_XTD            (0x40000000UL)
+#define RXDMA_R0_RTR            (0x20000000UL)
+#define RXDMA_R0_ID_MASK        (0x1FFFFFFFUL)
+#define RXDMA_R0_STD_ID_POS     (18U)
+#define RXDMA_R0_STD_ID_MASK    (0x7FFUL)
+#define RXDMA_R1_ANMF           (0x80000000UL)
+#define RXDMA_R1_FIDX_POS       (24U)
+#define RXDMA_R1_FIDX_MASK      (0x7FUL)
+#define RXDMA_R1_FDF            (0x00200000UL)
+#define RXDMA_R1_BRS            (0x00100000UL)
+#define RXDMA_R1_DLC_POS        (16U)
+#define RXDMA_R1_DLC_MASK       (0x0FUL)
+#define RXDMA_R1_RXTS_MASK      (0xFFFFUL)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* RX FIFO element as laid out in the message RAM */
+typedef struct
+{
+    uint32_t words[RXDMA_ELEMENT_WORDS];
+} rxdma_element_t;
+
+/* Header of an element, decoded */
+typedef struct
+{
+    uint32_t id;                /* 11 or 29-bit identifier */
+    uint16_t timestamp;         /* RX timestamp */
+    uint8_t  dlc;
+    uint8_t  filter;            /* Index of the matching filter */
+    bool     xtd;
+    bool     rtr;
+    bool     fdf;
+    bool     brs;
+} rxdma_header_t;
+
+typedef struct
+{
+    uint32_t transfers;         /* Transfers started */
+    uint32_t elements;          /* Elements moved */
+    uint32_t batch_max;         /* Largest transfer, in elements */
+    uint32_t ring_full;         /* Transfers held back by a full ring */
+} rxdma_stats_t;
+
+/* Ring of elements written by DMA and processed by the CPU. head counts
+ * the elements of completed transfers, tail the processed ones. */
+typedef struct
+{
+    rxdma_element_t slots[RXDMA_RING_SLOTS];
+    uint32_t        head;
+    uint32_t        tail;
+    uint32_t        busy;       /* Elements of the transfer in flight */
+    uint32_t        fifo_get;   /* FIFO index of its first element */
+    rxdma_stats_t   stats;
+} rxdma_ring_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void rxdma_init(rxdma_ring_t *ring);
+uint32_t rxdma_plan(rxdma_ring_t *ring, uint32_t get, uint32_t fill,
+                    uint32_t fifo_size);
+rxdma_element_t *rxdma_dest(rxdma_ring_t *ring);
+uint32_t rxdma_complete(rxdma_ring_t *ring);
+const rxdma_element_t *rxdma_peek(const rxdma_ring_t *ring);
+void rxdma_release(rxdma_ring_t *ring);
+void rxdma_header_decode(const rxdma_element_t *element,
+                         rxdma_header_t *header);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* RXDMA_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,501 @@
+/******************************************************************************
+* File Name:   rxdma_can.c
+*
+* Description: DMA transfer of the CAN FD RX FIFO 0 elements into a RAM ring,
+*              started at the FIFO watermark.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "rxdma_can.h"
+#include "stats.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#if (RXDMA_ENABLE)
+#define RXDMA_CAN_FIFO          (0U)
+
+/* RXESC.F0DS code of a 64-byte data field */
+#define RXDMA_CAN_F0DS_64       (7U)
+
+/* TOCC.TOS: the timeout counter runs while RX FIFO 0 holds elements */
+#define RXDMA_CAN_TOS_FIFO_0    (2U)
+
+/* RX FIFO 0 events taken from the PDL interrupt handler. A new message no
+ * longer interrupts; the watermark and the timeout start a transfer. */
+#define RXDMA_CAN_FIFO_EVENTS   (CY_CANFD_RX_FIFO_0_NEW_MESSAGE |              \
+                                 CY_CANFD_RX_FIFO_0_WATERMARK_REACHED |        \
+                                 CY_CANFD_TIMEOUT_OCCURRED)
+#define RXDMA_CAN_START_EVENTS  (CY_CANFD_RX_FIFO_0_WATERMARK_REACHED |        \
+                                 CY_CANFD_TIMEOUT_OCCURRED)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static CANFD_Type             *rxdma_can_base;
+static uint32_t                rxdma_can_chan;
+static cy_stc_canfd_context_t *rxdma_can_context;
+static rxdma_can_rx_fn_t       rxdma_can_rx;
+static uint32_t                rxdma_can_fifo_size;
+static bool                    rxdma_can_running;
+
+static rxdma_ring_t            rxdma_can_ring;
+#if (STATS_ENABLE)
+/* Counts of the ring, as last added to the registry */
+static uint32_t                rxdma_can_transfers;
+static uint32_t                rxdma_can_ring_full;
+#endif /* STATS_ENABLE */
+
+/* One 2D descriptor: X moves the words of an element, Y the elements of a
+ * batch. Source, destination and batch size are set for each transfer. */
+static cy_stc_dma_descriptor_t rxdma_can_descriptor;
+
+static const cy_stc_dma_descriptor_config_t rxdma_can_descriptor_config =
+{
+    .retrigger       = CY_DMA_RETRIG_IM,
+    .interruptType   = CY_DMA_DESCR,
+    .triggerOutType  = CY_DMA_DESCR,
+    .channelState    = CY_DMA_CHANNEL_DISABLED,
+    .triggerInType   = CY_DMA_DESCR,
+    .dataPrefetch    = false,
+    .dataSize        = CY_DMA_WORD,
+    .srcTransferSize = CY_DMA_TRANSFER_SIZE_WORD,
+    .dstTransferSize = CY_DMA_TRANSFER_SIZE_WORD,
+    .descriptorType  = CY_DMA_2D_TRANSFER,
+    .srcAddress      = NULL,
+    .dstAddress      = NULL,
+    .xCount          = RXDMA_ELEMENT_WORDS,
+    .srcXincrement   = 1,
+    .dstXincrement   = 1,
+    .yCount          = 1U,
+    .srcYincrement   = (int32_t)RXDMA_ELEMENT_WORDS,
+    .dstYincrement   = (int32_t)RXDMA_ELEMENT_WORDS,
+    .nextDescriptor  = NULL
+};
+
+static const cy_stc_dma_channel_config_t rxdma_can_channel_config =
+{
+    .descriptor  = &rxdma_can_descriptor,
+    .preemptable = false,
+    .priority    = 0U,
+    .enable      = false,
+    .bufferable  = false
+};
+
+/* Same priority as the CAN FD interrupt, so that the two never preempt
+ * each other on the ring */
+static const cy_stc_sysint_t rxdma_can_irq_cfg =
+{
+    .intrSrc = RXDMA_CAN_DW_IRQ,
+    .intrPriority = 1U,
+};
+
+/*******************************************************************************
+* Function Name: rxdma_can_configure
+********************************************************************************
+* Summary:
+* Sets the RX FIFO 0 watermark and the flush timeout, and moves the FIFO 0
+* interrupt from new messages to the watermark and the timeout.
+*
+*******************************************************************************/
+static void rxdma_can_configure(void)
+{
+    uint32_t rxf0c;
+
+    (void)Cy_CANFD_ConfigChangesEnable(rxdma_can_base, rxdma_can_chan);
+
+    rxf0c = CANFD_RXF0C(rxdma_can_base, rxdma_can_chan) &
+            ~CANFD_CH_M_TTCAN_RXF0C_F0WM_Msk;
+    CANFD_RXF0C(rxdma_can_base, rxdma_can_chan) =
+        rxf0c | _VAL2FLD(CANFD_CH_M_TTCAN_RXF0C_F0WM, RXDMA_WATERMARK);
+    CANFD_TOCC(rxdma_can_base, rxdma_can_chan) =
+        CANFD_CH_M_TTCAN_TOCC_ETOC_Msk |
+        _VAL2FLD(CANFD_CH_M_TTCAN_TOCC_TOS, RXDMA_CAN_TOS_FIFO_0) |
+        _VAL2FLD(CANFD_CH_M_TTCAN_TOCC_TOP, RXDMA_FLUSH_BITS);
+
+    (void)Cy_CANFD_ConfigChangesDisable(rxdma_can_base, rxdma_can_chan);
+
+    Cy_CANFD_SetInterruptMask(rxdma_can_base, rxdma_can_chan,
+                              (Cy_CANFD_GetInterruptMask(rxdma_can_base,
+                                                         rxdma_can_chan) &
+                               ~CY_CANFD_RX_FIFO_0_NEW_MESSAGE) |
+                              RXDMA_CAN_START_EVENTS);
+}
+
+/*******************************************************************************
+* Function Name: rxdma_can_dma_isr
+********************************************************************************
+* Summary:
+* Interrupt of the DataWire channel at the end of each transfer.
+*
+*******************************************************************************/
+static void rxdma_can_dma_isr(void)
+{
+    Cy_DMA_Channel_ClearInterrupt(RXDMA_CAN_DW, RXDMA_CAN_DW_CHANNEL);
+    (void)rxdma_can_finish();
+}
+#endif /* RXDMA_ENABLE */
+
+/*******************************************************************************
+* Function Name: rxdma_can_init
+********************************************************************************
+* Summary:
+* Sets up the DataWire channel and switches RX FIFO 0 to DMA transfers. The
+* channel keeps the CPU copy of the PDL handler if RX FIFO 0 does not have
+* 64-byte elements or is smaller than the watermark. Call it after the
+* channel has been initialized, before network management captures its
+* interrupt mask.
+*
+* Parameters:
+*  base         CAN FD block
+*  chan         CAN FD channel
+*  context      Channel context
+*  rx_fn        Called for each element moved
+*
+*******************************************************************************/
+void rxdma_can_init(CANFD_Type *base, uint32_t chan,
+                    cy_stc_canfd_context_t *context, rxdma_can_rx_fn_t rx_fn)
+{
+#if (RXDMA_ENABLE)
+    uint32_t f0ds = _FLD2VAL(CANFD_CH_M_TTCAN_RXESC_F0DS,
+                             CANFD_RXESC(base, chan));
+
+    rxdma_can_base = base;
+    rxdma_can_chan = chan;
+    rxdma_can_context = context;
+    rxdma_can_rx = rx_fn;
+    rxdma_can_fifo_size = _FLD2VAL(CANFD_CH_M_TTCAN_RXF0C_F0S,
+                                   CANFD_RXF0C(base, chan));
+
+    if (RXDMA_CAN_F0DS_64 != f0ds)
+    {
+        printf("RXDMA: RX FIFO 0 elements must have 64 data bytes\r\n");
+        return;
+    }
+    if ((0U == RXDMA_WATERMARK) || (rxdma_can_fifo_size < RXDMA_WATERMARK))
+    {
+        printf("RXDMA: watermark %u does not fit RX FIFO 0 of %lu "
+               "elements\r\n", (unsigned)RXDMA_WATERMARK,
+               (unsigned long)rxdma_can_fifo_size);
+        return;
+    }
+
+    rxdma_init(&rxdma_can_ring);
+    (void)Cy_DMA_Descriptor_Init(&rxdma_can_descriptor,
+                                 &rxdma_can_descriptor_config);
+    (void)Cy_DMA_Channel_Init(RXDMA_CAN_DW, RXDMA_CAN_DW_CHANNEL,
+                              &rxdma_can_channel_config);
+    Cy_DMA_Channel_SetInterruptMask(RXDMA_CAN_DW, RXDMA_CAN_DW_CHANNEL,
+                                    CY_DMA_INTR_MASK);
+    Cy_DMA_Enable(RXDMA_CAN_DW);
+
+    (void)Cy_SysInt_Init(&rxdma_can_irq_cfg, &rxdma_can_dma_isr);
+    NVIC_EnableIRQ(RXDMA_CAN_DW_IRQ);
+
+    rxdma_can_configure();
+    rxdma_can_running = true;
+#else
+    CY_UNUSED_PARAMETER(base);
+    CY_UNUSED_PARAMETER(chan);
+    CY_UNUSED_PARAMETER(context);
+    CY_UNUSED_PARAMETER(rx_fn);
+#endif /* RXDMA_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: rxdma_can_active
+********************************************************************************
+* Summary:
+* Returns true if RX FIFO 0 is moved by DMA.
+*
+*******************************************************************************/
+bool rxdma_can_active(void)
+{
+#if (RXDMA_ENABLE)
+    return rxdma_can_running;
+#else
+    return false;
+#endif /* RXDMA_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: rxdma_can_isr
+********************************************************************************
+* Summary:
+* Called from the CAN FD interrupt before the PDL handler. Takes the RX FIFO
+* 0 events, so that the PDL handler does not copy the elements itself, and
+* starts a transfer at the watermark or at the flush timeout.
+*
+*******************************************************************************/
+void rxdma_can_isr(void)
+{
+#if (RXDMA_ENABLE)
+    uint32_t status;
+
+    if (!rxdma_can_running)
+    {
+        return;
+    }
+
+    status = Cy_CANFD_GetInterruptStatus(rxdma_can_base, rxdma_can_chan) &
+             RXDMA_CAN_FIFO_EVENTS;
+    if (0U != status)
+    {
+        Cy_CANFD_ClearInterrupt(rxdma_can_base, rxdma_can_chan, status);
+        if (0U != (status & RXDMA_CAN_START_EVENTS &
+                   Cy_CANFD_GetInterruptMask(rxdma_can_base,
+                                             rxdma_can_chan)))
+        {
+            (void)rxdma_can_start();
+        }
+    }
+#endif /* RXDMA_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: rxdma_can_start
+********************************************************************************
+* Summary:
+* Starts a transfer of the elements in RX FIFO 0, from the get index up to
+* the FIFO or ring wrap, unless one is in flight.
+*
+* Return:
+*  true if a transfer was started
+*
+*******************************************************************************/
+bool rxdma_can_start(void)
+{
+#if (RXDMA_ENABLE)
+    uint32_t status = CANFD_RXF0S(rxdma_can_base, rxdma_can_chan);
+    uint32_t get = _FLD2VAL(CANFD_CH_M_TTCAN_RXF0S_F0GI, status);
+    uint32_t count;
+
+    count = rxdma_plan(&rxdma_can_ring, get,
+                       _FLD2VAL(CANFD_CH_M_TTCAN_RXF0S_F0FL, status),
+                       rxdma_can_fifo_size);
+    if (0U == count)
+    {
+        return false;
+    }
+
+    Cy_DMA_Descriptor_SetSrcAddress(&rxdma_can_descriptor,
+                                    (const void *)(uintptr_t)
+                                    Cy_CANFD_CalcRxFifoAdrs(rxdma_can_base,
+                                                            rxdma_can_chan,
+                                                            RXDMA_CAN_FIFO,
+                                                            get,
+                                                            rxdma_can_context));
+    Cy_DMA_Descriptor_SetDstAddress(&rxdma_can_descriptor,
+                                    rxdma_dest(&rxdma_can_ring));
+    Cy_DMA_Descriptor_SetYloopDataCount(&rxdma_can_descriptor, count);
+    Cy_DMA_Channel_SetDescriptor(RXDMA_CAN_DW, RXDMA_CAN_DW_CHANNEL,
+                                 &rxdma_can_descriptor);
+    Cy_DMA_Channel_Enable(RXDMA_CAN_DW, RXDMA_CAN_DW_CHANNEL);
+    (void)Cy_TrigMux_SwTrigger(RXDMA_CAN_TRIGGER, CY_TRIGGER_TWO_CYCLES);
+    return true;
+#else
+    return false;
+#endif /* RXDMA_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: rxdma_can_finish
+********************************************************************************
+* Summary:
+* Completes a transfer: acknowledges its elements up to the last one, which
+* frees them in the FIFO, starts the next transfer if the FIFO has more, and
+* passes the moved elements to the receive function while it runs.
+*
+* Return:
+*  true if another transfer was started
+*
+*******************************************************************************/
+bool rxdma_can_finish(void)
+{
+#if (RXDMA_ENABLE)
+    const rxdma_element_t *element;
+    bool started;
+
+    if (0U == rxdma_can_ring.busy)
+    {
+        return false;
+    }
+
+    CANFD_RXF0A(rxdma_can_base, rxdma_can_chan) =
+        rxdma_complete(&rxdma_can_ring);
+    started = rxdma_can_start();
+
+    while (NULL != (element = rxdma_peek(&rxdma_can_ring)))
+    {
+        rxdma_can_rx(element);
+        rxdma_release(&rxdma_can_ring);
+    }
+    return started;
+#else
+    return false;
+#endif /* RXDMA_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: rxdma_can_poll
+********************************************************************************
+* Summary:
+* Sets up RX FIFO 0 again once the channel was re-initialized, by network
+* management or the benchmarks, which resets its watermark, and adds the
+* counts of the ring to the statistics registry: rxdma.c only uses the C
+* library, for the host simulator. Call it last before the main loop
+* sleeps.
+*
+*******************************************************************************/
+void rxdma_can_poll(void)
+{
+#if (RXDMA_ENABLE)
+    if (rxdma_can_running &&
+        (RXDMA_WATERMARK !=
+         _FLD2VAL(CANFD_CH_M_TTCAN_RXF0C_F0WM,
+                  CANFD_RXF0C(rxdma_can_base, rxdma_can_chan))))
+    {
+        rxdma_can_configure();
+    }
+    STATS_FOLLOW(RXDMA_TRANSFERS, rxdma_can_ring.stats.transfers,
+                 &rxdma_can_transfers);
+    STATS_FOLLOW(RXDMA_RING_FULL, rxdma_can_ring.stats.ring_full,
+                 &rxdma_can_ring_full);
+    STATS_PEAK(RXDMA_BATCH_MAX, rxdma_can_ring.stats.batch_max);
+#endif /* RXDMA_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: rxdma_can_set_callback
+********************************************************************************
+* Summary:
+* Replaces the receive function, for the benchmarks.
+*
+* Return:
+*  Previous receive function
+*
+*******************************************************************************/
+rxdma_can_rx_fn_t rxdma_can_set_callback(rxdma_can_rx_fn_t rx_fn)
+{
+#if (RXDMA_ENABLE)
+    rxdma_can_rx_fn_t previous = rxdma_can_rx;
+
+    rxdma_can_rx = rx_fn;
+    return previous;
+#else
+    CY_UNUSED_PARAMETER(rx_fn);
+    return NULL;
+#endif /* RXDMA_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: rxdma_can_frame
+********************************************************************************
+* Summary:
+* Decodes an element moved by DMA into a frame, as
+* canfd_frame_from_rx_buffer() does for the PDL copy.
+*
+* Parameters:
+*  frame        Destination frame
+*  element      Element in the ring
+*
+*******************************************************************************/
+void rxdma_can_frame(canfd_frame_t *frame, const rxdma_element_t *element)
+{
+    rxdma_header_t header;
+    uint8_t flags = 0U;
+
+    rxdma_header_decode(element, &header);
+    if (header.xtd)
+    {
+        flags |= CANFD_FRAME_FLAG_XTD;
+    }
+    if (header.rtr)
+    {
+        flags |= CANFD_FRAME_FLAG_RTR;
+    }
+    if (header.fdf)
+    {
+        flags |= CANFD_FRAME_FLAG_FDF;
+    }
+    if (header.brs)
+    {
+        flags |= CANFD_FRAME_FLAG_BRS;
+    }
+
+    frame->id = header.id;
+    frame->timestamp = header.timestamp;
+    frame->flags = flags;
+    frame->bus = 0U;
+    frame->reserved = 0U;
+    frame->len = canfd_frame_dlc_len(header.dlc, header.fdf);
+
+    memcpy(frame->data, &element->words[2], frame->len);
+}
+
+/*******************************************************************************
+* Function Name: rxdma_can_report
+********************************************************************************
+* Summary:
+* Prints the transfer counts.
+*
+*******************************************************************************/
+void rxdma_can_report(void)
+{
+#if (RXDMA_ENABLE)
+    const rxdma_stats_t *stats = &rxdma_can_ring.stats;
+
+    if (!rxdma_can_running)
+    {
+        printf("RXDMA: not running, RX FIFO 0 is copied by the CPU\r\n");
+        return;
+    }
+
+    printf("RXDMA: %lu transfers, %lu elements, largest %lu, "
+           "held by a full ring %lu\r\n",
+           (unsigned long)stats->transfers, (unsigned long)stats->elements,
+           (unsigned long)stats->batch_max, (unsigned long)stats->ring_full);
+#endif /* RXDMA_ENABLE */
+}
+
+/* [] END OF FILE */
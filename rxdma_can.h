@@ -0,0 +1,95 @@
+/******************************************************************************
+* File Name:   rxdma_can.h
+*
+* Description: DMA transfer of the CAN FD RX FIFO 0 elements into a RAM ring
+*              interface.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef RXDMA_CAN_H_
+#define RXDMA_CAN_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "canfd_frame.h"
+#include "rxdma.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* DataWire channel that moves the RX FIFO 0 elements, its interrupt and the
+ * trigger multiplexer output that drives its trigger input */
+#ifndef RXDMA_CAN_DW
+#define RXDMA_CAN_DW            DW0
+#define RXDMA_CAN_DW_CHANNEL    (0U)
+#define RXDMA_CAN_DW_IRQ        cpuss_interrupts_dw0_0_IRQn
+#define RXDMA_CAN_TRIGGER       TRIG_OUT_MUX_0_PDMA0_TR_IN0
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Called in interrupt context for each element the DMA moved, in order */
+typedef void (*rxdma_can_rx_fn_t)(const rxdma_element_t *element);
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void rxdma_can_init(CANFD_Type *base, uint32_t chan,
+                    cy_stc_canfd_context_t *context, rxdma_can_rx_fn_t rx_fn);
+bool rxdma_can_active(void);
+void rxdma_can_isr(void);
+bool rxdma_can_start(void);
+bool rxdma_can_finish(void);
+void rxdma_can_poll(void);
+rxdma_can_rx_fn_t rxdma_can_set_callback(rxdma_can_rx_fn_t rx_fn);
+void rxdma_can_frame(canfd_frame_t *frame, const rxdma_element_t *element);
+void rxdma_can_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* RXDMA_CAN_H_ */
+
+/* [] END OF FILE */
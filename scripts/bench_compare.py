@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+################################################################################
+# \file bench_compare.py
+# \version 1.0
+#
+# \brief
+# Extracts and compares benchmark results printed by the firmware.
+#
+# \copyright
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+"""Extract and compare benchmark results printed by the firmware.
+
+A build with BENCHMARK_ENABLE=1 prints a JSON document between "BENCH BEGIN"
+and "BENCH END" on the debug UART. Inputs may be raw UART logs or JSON files
+saved earlier.
+
+    # Save the results of one run
+    python scripts/bench_compare.py uart.log --save baseline.json
+
+    # Compare two runs; exits with status 1 if a case got slower than the
+    # threshold (default 5 percent) and than its noise
+    python scripts/bench_compare.py baseline.json uart.log --threshold 5
+
+A log may hold several runs of a suite, for example the output of several
+resets or host runs. They are combined: each case keeps its lowest cycles,
+and its noise is the spread of its minimum between the runs, in percent.
+With a single run, the noise is the spread between the mean and the minimum
+of its repetitions. A case only regresses when it got slower by more than
+the threshold, by more than the noise of either side, and by more than one
+cycle, the resolution of the counts.
+"""
+
+import argparse
+import json
+import sys
+
+
+def noise(result):
+    """Returns the noise of a result in percent."""
+    if "noise" in result:
+        return result["noise"]
+    low = result["cycles_min"]
+    return ((result["cycles_mean"] - low) * 100.0 / low) if low else 0.0
+
+
+def merge_runs(docs):
+    """Combines runs of one suite into one document."""
+    if len(docs) == 1:
+        return docs[0]
+    runs = {}
+    for doc in docs:
+        for result in doc["results"]:
+            runs.setdefault(result["name"], []).append(result)
+    results = []
+    for name in sorted(runs):
+        low = min(r["cycles_min"] for r in runs[name])
+        high = max(r["cycles_min"] for r in runs[name])
+        results.append({
+            "name": name,
+            "bytes": runs[name][0]["bytes"],
+            "cycles_min": low,
+            "cycles_mean": min(r["cycles_mean"] for r in runs[name]),
+            "cycles_max": max(r["cycles_max"] for r in runs[name]),
+            "samples": sum(r["samples"] for r in runs[name]),
+            "runs": len(runs[name]),
+            "noise": ((high - low) * 100.0 / low) if low else 0.0,
+        })
+    merged = dict(docs[-1])
+    merged["results"] = results
+    return merged
+
+
+def load_results(path):
+    """Returns {suite: document} for every benchmark suite in a file."""
+    with open(path, "r", errors="replace") as src:
+        text = src.read()
+    if text.lstrip().startswith("{"):
+        doc = json.loads(text)
+        return doc if "suite" not in doc else {doc["suite"]: doc}
+
+    suites = {}
+    block = None
+    for line in text.splitlines():
+        line = line.strip()
+        if line == "BENCH BEGIN":
+            block = []
+        elif line == "BENCH END" and block is not None:
+            doc = json.loads("".join(block))
+            suites.setdefault(doc["suite"], []).append(doc)
+            block = None
+        elif block is not None:
+            block.append(line)
+    if not suites:
+        sys.exit("no benchmark results found in %s" % path)
+    return {suite: merge_runs(docs) for suite, docs in suites.items()}
+
+
+def compare(base, new, threshold, metric):
+    """Prints a comparison table and returns the number of regressions."""
+    regressions = 0
+    for suite in sorted(set(base) & set(new)):
+        print("%s: commit %s -> %s" % (suite, base[suite].get("commit", "?"),
+                                       new[suite].get("commit", "?")))
+    print("%-12s %-32s %10s %10s %8s %7s" % ("suite", "case", "base", "new",
+                                              "change", "noise"))
+    for suite in sorted(set(base) | set(new)):
+        base_cases = {r["name"]: r for r in base.get(suite, {}).get("results", [])}
+        new_cases = {r["name"]: r for r in new.get(suite, {}).get("results", [])}
+        for name in sorted(set(base_cases) | set(new_cases)):
+            if name not in base_cases or name not in new_cases:
+                where = "new" if name in new_cases else "base"
+                print("%-12s %-32s %31s" % (suite, name, "only in " + where))
+                continue
+            old = base_cases[name][metric]
+            cur = new_cases[name][metric]
+            change = ((cur - old) * 100.0 / old) if old else 0.0
+            spread = max(noise(base_cases[name]), noise(new_cases[name]))
+            flag = ""
+            if change > max(threshold, spread) and cur - old > 1:
+                flag = "  REGRESSION"
+                regressions += 1
+            print("%-12s %-32s %10d %10d %+7.1f%% %6.1f%%%s" %
+                  (suite, name, old, cur, change, spread, flag))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("base", help="UART log or JSON results")
+    parser.add_argument("new", nargs="?", help="UART log or JSON results to "
+                        "compare against base")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="allowed slowdown in percent (default 5)")
+    parser.add_argument("--metric", default="cycles_min",
+                        choices=("cycles_min", "cycles_mean"),
+                        help="value compared between runs")
+    parser.add_argument("--save", help="write the results of the last input "
+                        "as JSON")
+    args = parser.parse_args()
+
+    base = load_results(args.base)
+    latest = base
+    if args.new:
+        latest = load_results(args.new)
+    if args.save:
+        with open(args.save, "w") as out:
+            json.dump(latest, out, indent=1)
+    if not args.new:
+        json.dump(base, sys.stdout, indent=1)
+        print()
+        return
+
+    regressions = compare(base, latest, args.threshold, args.metric)
+    if regressions:
+        print("%d case(s) regressed by more than %.1f%% and their noise" %
+              (regressions, args.threshold))
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,291 @@
+#!/usr/bin/env python3
+################################################################################
+# \file fzip_decode.py
+# \version 1.0
+#
+# \brief
+# Decodes the compressed frame stream captured from the debug UART.
+#
+# \copyright
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+"""Decode the compressed frame stream of a FZIP_ENABLE=1 build.
+
+With FZIP_ENABLE=1 the firmware sends received frames as compressed blocks
+on the debug UART, between the text it prints. Capture the raw UART output
+to a file, for example with
+
+    python -m serial.tools.miniterm --raw COM5 115200 > uart.bin
+
+or any terminal that logs binary data, then decode it:
+
+    # Frames in candump -L format; the text of the log goes to stderr
+    python scripts/fzip_decode.py uart.bin > frames.log
+
+    # Compression statistics only
+    python scripts/fzip_decode.py uart.bin --stats
+
+Timestamps are those of the CAN FD controller, unwrapped from 16 bits and
+converted with --tick-us. A block lost on the UART makes the decoder skip
+frames until the next reset block, which the firmware sends every
+FZIP_RESET_BLOCKS blocks.
+"""
+
+import argparse
+import sys
+
+# Must match fzip.h
+MAGIC = 0x5A
+FLAG_RESET = 0x01
+TAG_SLOT_MASK = 0x1F
+TAG_TIME = 0x20
+TAG_DATA = 0x40
+TAG_HEADER = 0x80
+RUN_EXTEND = 15
+SLOTS = 32
+TS_MASK = 0xFFFF
+
+# canfd_frame.h flags
+FLAG_XTD = 0x01
+FLAG_FDF = 0x02
+FLAG_BRS = 0x04
+FLAG_RTR = 0x08
+
+# Size of a frame as 8-byte header plus payload, the baseline of the ratio
+RAW_HEADER = 8
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE, as canfd_crc16()."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_decode(data):
+    """Returns the decoded bytes, or None if data is not valid COBS."""
+    out = bytearray()
+    idx = 0
+    while idx < len(data):
+        code = data[idx]
+        if code == 0 or idx + code > len(data):
+            return None
+        out += data[idx + 1:idx + code]
+        idx += code
+        if idx < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def split_stream(raw):
+    """Yields ("text", bytes) and ("block", bytes) parts of a UART capture."""
+    for part in raw.split(b"\0"):
+        if not part:
+            continue
+        block = cobs_decode(part)
+        if (block is not None and len(block) >= 5 and block[0] == MAGIC and
+                crc16(block[:-2]) == int.from_bytes(block[-2:], "big")):
+            yield "block", block[:-2]
+        else:
+            yield "text", part
+
+
+class Slot:
+    """Last frame of one ID, as fzip_slot_t."""
+
+    def __init__(self, key):
+        self.key = key
+        self.last_ts = 0
+        self.period = 0
+        self.flags = 0
+        self.len = 0
+        self.data = bytearray(64)
+
+
+class Decoder:
+    """Mirror of the encoder state in fzip.c."""
+
+    def __init__(self):
+        self.slots = [None] * SLOTS
+        self.last_ts = 0
+        self.synced = False
+        self.seq = None
+        self.frames = 0
+        self.raw_bytes = 0
+        self.skipped_blocks = 0
+
+    def block(self, block):
+        """Decodes one block; returns a list of (ts, id, flags, data)."""
+        seq, flags = block[1], block[2]
+        if self.seq is not None and seq != (self.seq + 1) & 0xFF:
+            self.synced = False
+        self.seq = seq
+        if flags & FLAG_RESET:
+            self.slots = [None] * SLOTS
+            self.last_ts = 0
+            self.synced = True
+        if not self.synced:
+            self.skipped_blocks += 1
+            return []
+
+        frames = []
+        pos = 3
+        body = block
+        while pos < len(body):
+            frame, pos = self.record(body, pos)
+            frames.append(frame)
+        return frames
+
+    def record(self, buf, pos):
+        """Decodes the record at pos; returns (frame, next position)."""
+        tag = buf[pos]
+        pos += 1
+        index = tag & TAG_SLOT_MASK
+        slot = self.slots[index]
+        hit = slot is not None
+
+        if tag & TAG_HEADER:
+            ident, pos = read_varint(buf, pos)
+            flags, length = buf[pos], buf[pos + 1]
+            pos += 2
+            key = ident | (0x80000000 if flags & FLAG_XTD else 0)
+            if slot is None or slot.key != key:
+                # A new ID in the slot; otherwise only the format changed
+                hit = False
+                slot = Slot(key)
+                self.slots[index] = slot
+            slot.flags, slot.len = flags, length
+
+        predicted = ((slot.last_ts + slot.period) if hit else self.last_ts)
+        residual = 0
+        if tag & TAG_TIME:
+            value, pos = read_varint(buf, pos)
+            residual = -((value + 1) >> 1) if value & 1 else value >> 1
+        ts = (predicted + residual) & TS_MASK
+
+        if tag & TAG_DATA:
+            pos = read_data(buf, pos, slot.data, slot.len)
+
+        if hit:
+            slot.period = (ts - slot.last_ts) & TS_MASK
+        slot.last_ts = ts
+        self.last_ts = ts
+        self.frames += 1
+        self.raw_bytes += RAW_HEADER + slot.len
+        return (ts, slot.key & 0x1FFFFFFF, slot.flags,
+                bytes(slot.data[:slot.len])), pos
+
+
+def read_varint(buf, pos):
+    """Reads an unsigned LEB128 number."""
+    value = 0
+    shift = 0
+    while True:
+        byte = buf[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def read_run(buf, pos, run):
+    """Adds the extension byte of a run length of 15."""
+    if run == RUN_EXTEND:
+        run += buf[pos]
+        pos += 1
+    return run, pos
+
+
+def read_data(buf, pos, data, length):
+    """Applies the payload tokens of a record to data."""
+    idx = 0
+    while idx < length:
+        token = buf[pos]
+        pos += 1
+        zeros, pos = read_run(buf, pos, token >> 4)
+        changed, pos = read_run(buf, pos, token & 0x0F)
+        idx += zeros
+        for _ in range(changed):
+            data[idx] ^= buf[pos]
+            idx += 1
+            pos += 1
+    return pos
+
+
+def candump_line(time_s, ident, flags, data):
+    """Formats a frame as a candump -L line."""
+    text = ("%08X" if flags & FLAG_XTD else "%03X") % ident
+    if flags & FLAG_RTR:
+        return "(%.6f) can0 %s#R" % (time_s, text)
+    if flags & FLAG_FDF:
+        return "(%.6f) can0 %s##%X%s" % (time_s, text,
+                                         1 if flags & FLAG_BRS else 0,
+                                         data.hex().upper())
+    return "(%.6f) can0 %s#%s" % (time_s, text, data.hex().upper())
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument("capture", help="raw UART capture")
+    parser.add_argument("--tick-us", type=float, default=2.0,
+                        help="microseconds per controller timestamp tick "
+                        "(default 2, one bit time at 500 kbit/s)")
+    parser.add_argument("--stats", action="store_true",
+                        help="print compression statistics only")
+    args = parser.parse_args()
+
+    with open(args.capture, "rb") as src:
+        raw = src.read()
+
+    decoder = Decoder()
+    wire_bytes = 0
+    blocks = 0
+    elapsed = 0
+    prev_ts = None
+    for kind, part in split_stream(raw):
+        if kind == "text":
+            if not args.stats:
+                sys.stderr.write(part.decode("ascii", "replace"))
+            continue
+        blocks += 1
+        # Block, CRC, COBS code and the two zero bytes around it
+        wire_bytes += len(part) + 5
+        for ts, ident, flags, data in decoder.block(part):
+            if prev_ts is not None:
+                elapsed += (ts - prev_ts) & TS_MASK
+            prev_ts = ts
+            if not args.stats:
+                print(candump_line(elapsed * args.tick_us / 1e6, ident,
+                                   flags, data))
+
+    if args.stats or not blocks:
+        ratio = (decoder.raw_bytes / float(wire_bytes)) if wire_bytes else 0
+        sys.stderr.write("%d blocks (%d skipped), %d frames: %d bytes raw, "
+                         "%d bytes compressed, ratio %.2f, %.2f bytes per "
+                         "frame\n" % (blocks, decoder.skipped_blocks,
+                                      decoder.frames, decoder.raw_bytes,
+                                      wire_bytes, ratio,
+                                      wire_bytes / float(decoder.frames or 1)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+################################################################################
+# \file fzip_trace.py
+# \version 1.0
+#
+# \brief
+# Converts a candump log to the replay table of the compression benchmark.
+#
+# \copyright
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+"""Convert a candump log to the replay table of the compression benchmark.
+
+The benchmark variant (BENCHMARK_ENABLE=1) compresses the frames of
+fzip_trace.h one at a time as they would arrive, and reports the cycles per
+frame and the compression ratio. Record bus traffic with
+
+    candump -L can0 > bus.log
+
+and regenerate the table with
+
+    python scripts/fzip_trace.py bus.log -o fzip_trace.h
+
+Keep the log short, the table is stored in flash: 600 frames of 8 to 64
+bytes take about 14 KB.
+"""
+
+import argparse
+import sys
+
+from wake_trace import parse_log
+
+# CANFD_FRAME_FLAG_xxx of canfd_frame.h
+FLAG_XTD = 0x01
+FLAG_FDF = 0x02
+FLAG_BRS = 0x04
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument("log", help="candump -L log")
+    parser.add_argument("-o", "--output", default="fzip_trace.h",
+                        help="generated header (default fzip_trace.h)")
+    parser.add_argument("--tick-us", type=float, default=2.0,
+                        help="microseconds per controller timestamp tick "
+                        "(default 2, one bit time at 500 kbit/s)")
+    args = parser.parse_args()
+
+    frames = list(parse_log(args.log))
+    if not frames:
+        sys.exit("no frames found in %s" % args.log)
+
+    start = frames[0][0]
+    rows = []
+    data = []
+    for time, ident, fd, brs, payload in frames:
+        tick = int(round((time - start) * 1e6 / args.tick_us)) & 0xFFFF
+        flags = ((FLAG_XTD if ident & 0x80000000 else 0) |
+                 (FLAG_FDF if fd else 0) | (FLAG_BRS if brs else 0))
+        rows.append("    { 0x%08XU, %5uU, 0x%04XU, %2uU, 0x%02XU },"
+                    % (ident & 0x1FFFFFFF, len(data), tick, len(payload),
+                       flags))
+        data.extend(payload)
+
+    body = []
+    for idx in range(0, len(data), 11):
+        body.append("    " + " ".join("0x%02XU," % b
+                                      for b in data[idx:idx + 11]))
+
+    with open(args.output, "w") as out:
+        out.write(HEADER % {"log": args.log.replace("\\", "/").split("/")[-1],
+                            "count": len(rows), "bytes": len(data),
+                            "rows": "\n".join(rows),
+                            "data": "\n".join(body)})
+    print("%d frames, %d payload bytes" % (len(rows), len(data)))
+
+
+HEADER = """\
+/******************************************************************************
+* File Name:   fzip_trace.h
+*
+* Description: Frames replayed by the compression benchmark. Generated by
+*              scripts/fzip_trace.py from %(log)s; do not edit.
+*
+*******************************************************************************/
+
+#ifndef FZIP_TRACE_H_
+#define FZIP_TRACE_H_
+
+/* %(count)u frames: ID, offset in fzip_trace_data, timestamp, length and
+ * CANFD_FRAME_FLAG_xxx */
+static const bench_fzip_frame_t fzip_trace[] =
+{
+%(rows)s
+};
+
+/* %(bytes)u payload bytes */
+static const uint8_t fzip_trace_data[] =
+{
+%(data)s
+};
+
+#endif /* FZIP_TRACE_H_ */
+
+/* [] END OF FILE */
+"""
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,294 @@
+#!/usr/bin/env python3
+################################################################################
+# \file hoptrace_collect.py
+# \version 1.0
+#
+# \brief
+# Rebuilds the per-hop latency of traced frames from the UART logs of the
+# nodes.
+#
+# \copyright
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+"""Rebuild the per-hop latency of traced frames from the UART logs of the nodes.
+
+Every node built with HOPTRACE_ENABLE=1 prints one line per RX and TX of a
+traced frame, and its clock:
+
+    HOP CLOCK <node> <cpu_hz>
+    HOP <node> <R|T> <cycles> <origin> <corr_id> <hops> <CAN ID>
+
+Save the terminal output of each node to a file and run
+
+    python scripts/hoptrace_collect.py node1.log node2.log node3.log
+
+The events of one trace share the node that started it and its correlation
+ID. The number of hops in the trailer orders them: the TX that added hop h
+comes before the RX of a frame with h hops, which comes before the TX that
+adds hop h + 1 on the receiving node.
+
+The cycle counters of the nodes run from different crystals and start at
+different times. Times held on a node need only its own clock. For the bus
+segments, the offset between two nodes is taken from traces that go from
+one to the other and back, as in NTP: half the difference of the two
+one-way delays. A line fitted through the offsets of the fastest quarter of
+the round trips follows the drift between the crystals. Bus delays that
+differ between the two directions come out as their average.
+Nodes with no round trip to the others are left out of the bus segments.
+"""
+
+import argparse
+import collections
+import csv
+import re
+import sys
+
+CLOCK_RE = re.compile(r"HOP CLOCK (\d+) (\d+)")
+EVENT_RE = re.compile(r"HOP (\d+) ([RT]) ([0-9a-fA-F]{8}) (\d+) "
+                      r"([0-9a-fA-F]{4}) (\d+) ([0-9a-fA-F]+)")
+
+# Clock of the nodes without a HOP CLOCK line, in Hz
+DEFAULT_HZ = 180000000
+
+Event = collections.namedtuple("Event", "node kind time origin corr hops id")
+
+
+def parse_logs(paths, default_hz):
+    """Returns the events of all logs with the cycle counts in us.
+
+    The 32-bit cycle counter of each node is unwrapped in the order of its
+    lines, so each log must hold the lines of a node in the order printed.
+    """
+    clocks = {}
+    raw = collections.defaultdict(list)
+    for path in paths:
+        with open(path, "r", errors="replace") as log:
+            for line in log:
+                match = CLOCK_RE.search(line)
+                if match:
+                    clocks[int(match.group(1))] = int(match.group(2))
+                    continue
+                match = EVENT_RE.search(line)
+                if match:
+                    raw[int(match.group(1))].append(match.groups())
+
+    events = []
+    for node, lines in raw.items():
+        hz = clocks.get(node, default_hz)
+        last = None
+        wraps = 0
+        for _, kind, cycles, origin, corr, hops, ident in lines:
+            cycles = int(cycles, 16)
+            if last is not None and cycles < last:
+                wraps += 1
+            last = cycles
+            events.append(Event(node, kind,
+                                ((wraps << 32) + cycles) * 1e6 / hz,
+                                int(origin), int(corr, 16), int(hops),
+                                int(ident, 16)))
+    return events
+
+
+def group_traces(events):
+    """Groups the events by trace and orders each trace by hop."""
+    traces = collections.defaultdict(list)
+    for event in events:
+        traces[(event.origin, event.corr)].append(event)
+    for trace in traces.values():
+        trace.sort(key=lambda e: (e.hops, e.kind == "R", e.time))
+    return traces
+
+
+def bus_pairs(trace):
+    """Yields (tx, rx) for every frame of a trace received by a node."""
+    for rx in trace:
+        if rx.kind != "R":
+            continue
+        senders = [tx for tx in trace if tx.kind == "T" and
+                   tx.hops == rx.hops and tx.node != rx.node]
+        if senders:
+            yield senders[-1], rx
+
+
+def held_pairs(trace):
+    """Yields (rx, tx) for every frame a node continued."""
+    for tx in trace:
+        if tx.kind != "T":
+            continue
+        receptions = [rx for rx in trace if rx.kind == "R" and
+                      rx.node == tx.node and rx.hops < tx.hops]
+        if receptions:
+            yield receptions[-1], tx
+
+
+def fit_line(points):
+    """Least squares line through (x, y) points; a constant for one point."""
+    count = len(points)
+    mean_x = sum(x for x, _ in points) / count
+    mean_y = sum(y for _, y in points) / count
+    var = sum((x - mean_x) ** 2 for x, _ in points)
+    if count < 2 or var == 0:
+        return mean_y, 0.0
+    slope = sum((x - mean_x) * (y - mean_y) for x, y in points) / var
+    return mean_y - slope * mean_x, slope
+
+
+def fit_offsets(traces):
+    """Fits the clock offset of every pair of nodes with round trips.
+
+    Returns {(a, b): (intercept, slope, samples)} where, in us, the clock
+    of b reads intercept + slope * t more than the clock of a at time t of a.
+    """
+    samples = collections.defaultdict(list)
+    for trace in traces.values():
+        pairs = list(bus_pairs(trace))
+        for tx, rx in pairs:
+            if tx.node > rx.node:
+                continue
+            # The way back may come before or after in the trace
+            for back_tx, back_rx in pairs:
+                if back_tx.node == rx.node and back_rx.node == tx.node:
+                    out = rx.time - tx.time
+                    back = back_rx.time - back_tx.time
+                    samples[(tx.node, rx.node)].append(
+                        (out + back, tx.time, (out - back) / 2))
+                    break
+
+    fits = {}
+    for pair, points in samples.items():
+        points.sort()
+        fastest = points[:max(1, len(points) // 4)]
+        intercept, slope = fit_line([(t, offset) for _, t, offset in fastest])
+        fits[pair] = (intercept, slope, len(points))
+    return fits
+
+
+def align_clocks(nodes, fits):
+    """Returns {node: function from node time to reference time} and
+    {node: reference node}.
+
+    The reference is the lowest node number of each group of nodes linked
+    by round trips. Nodes without round trips map to themselves, and their
+    bus segments are not reported.
+    """
+    links = collections.defaultdict(list)
+    for (a, b), (intercept, slope, _) in fits.items():
+        # time_b = time_a + intercept + slope * time_a
+        links[a].append((b, lambda t, i=intercept, s=slope: (t - i) / (1 + s)))
+        links[b].append((a, lambda t, i=intercept, s=slope: t + i + s * t))
+
+    to_ref = {}
+    groups = {}
+    for root in sorted(nodes):
+        if root in to_ref:
+            continue
+        to_ref[root] = lambda t: t
+        groups[root] = root
+        queue = [root]
+        while queue:
+            node = queue.pop(0)
+            for peer, to_node in links[node]:
+                if peer not in to_ref:
+                    parent = to_ref[node]
+                    to_ref[peer] = (lambda t, f=to_node, p=parent: p(f(t)))
+                    groups[peer] = root
+                    queue.append(peer)
+    return to_ref, groups
+
+
+def percentile(values, fraction):
+    values = sorted(values)
+    return values[min(len(values) - 1, int(fraction * len(values)))]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("logs", nargs="+", help="UART logs of the nodes")
+    parser.add_argument("--hz", type=int, default=DEFAULT_HZ,
+                        help="clock of nodes without a HOP CLOCK line")
+    parser.add_argument("--traces", type=int, default=0, metavar="N",
+                        help="print the first N traces hop by hop")
+    parser.add_argument("--csv", metavar="FILE",
+                        help="write one row per segment of every trace")
+    args = parser.parse_args()
+
+    events = parse_logs(args.logs, args.hz)
+    if not events:
+        sys.exit("no HOP lines found")
+    traces = group_traces(events)
+    fits = fit_offsets(traces)
+    nodes = {event.node for event in events}
+    to_ref, groups = align_clocks(nodes, fits)
+
+    for (a, b), (intercept, slope, count) in sorted(fits.items()):
+        print("clock: node %d = node %d %+.1f us, drift %+.1f ppm "
+              "(%d round trips)" % (b, a, intercept, slope * 1e6, count))
+
+    segments = collections.defaultdict(list)
+    rows = []
+    shown = 0
+    for key in sorted(traces, key=lambda k: min(to_ref[e.node](e.time)
+                                                for e in traces[k])):
+        trace = traces[key]
+        parts = []
+        for tx, rx in bus_pairs(trace):
+            if groups[tx.node] != groups[rx.node]:
+                continue
+            parts.append((tx.hops, 1, "bus %d -> %d" % (tx.node, rx.node),
+                          "0x%03x" % rx.id,
+                          to_ref[rx.node](rx.time) -
+                          to_ref[tx.node](tx.time)))
+        for rx, tx in held_pairs(trace):
+            parts.append((rx.hops, 2, "node %d" % tx.node,
+                          "0x%03x -> 0x%03x" % (rx.id, tx.id),
+                          tx.time - rx.time))
+        first = [e for e in trace if e.kind == "T" and e.hops == 1]
+        last = [e for e in trace if e.kind == "R"]
+        if first and last and groups[first[0].node] == groups[last[-1].node]:
+            parts.append((99, 3, "end to end %d -> %d" % (first[0].node,
+                                                         last[-1].node),
+                          "", to_ref[last[-1].node](last[-1].time) -
+                          to_ref[first[0].node](first[0].time)))
+        parts.sort()
+        for _, _, name, ids, value in parts:
+            segments[(name, ids)].append(value)
+            rows.append((key[0], key[1], name, ids, "%.1f" % value))
+        if shown < args.traces:
+            print("trace %d.%d: %s" % (key[0], key[1], ", ".join(
+                "%s %.1f us" % (name, value)
+                for _, _, name, _, value in parts)))
+            shown += 1
+
+    print("%-22s %-16s %6s %9s %9s %9s %9s" % ("segment", "IDs", "count",
+                                               "mean us", "p50 us",
+                                               "p99 us", "max us"))
+    # In the order of the path, end to end last
+    for (name, ids), values in sorted(
+            segments.items(), key=lambda item: item[0][0].startswith("end")):
+        print("%-22s %-16s %6d %9.1f %9.1f %9.1f %9.1f" % (
+            name, ids, len(values), sum(values) / len(values),
+            percentile(values, 0.5), percentile(values, 0.99), max(values)))
+
+    if args.csv:
+        with open(args.csv, "w", newline="") as out:
+            writer = csv.writer(out)
+            writer.writerow(["origin", "corr_id", "segment", "ids", "us"])
+            writer.writerows(rows)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,330 @@
+#!/usr/bin/env python3
+################################################################################
+# \file size_report.py
+# \version 1.0
+#
+# \brief
+# Reports flash/RAM usage per module and worst-case ISR stack usage, and
+# checks both against budgets.
+#
+# \copyright
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+"""Flash/RAM footprint per module and worst-case ISR stack usage.
+
+Runs as a post-build step of the GCC_ARM build (see the Makefile) and can
+also be started by hand:
+
+    python scripts/size_report.py build/APP_KIT_PSC3M5_EVK/Debug/app.map \\
+        --budget scripts/size_budget.json
+
+Footprint: every input section in the linker map is attributed to a module
+by matching its object file path against the patterns in the budget file.
+.text and .rodata count as flash, .data as flash and RAM, .bss as RAM.
+
+Stack: the build writes GCC call graph files (-fcallgraph-info=su) next to
+the objects. For each ISR root listed in the budget file, the worst-case
+stack depth is the deepest path through the static call graph, plus the
+exception frame pushed by the core on entry. Calls through function
+pointers are resolved with the "indirect" table of the budget file, and
+functions without call graph data (C library, assembly) take the stack
+bytes of their deepest path from its "frames" table. Listed indirect
+targets that are not in the build are skipped. An indirect call or a
+called function missing from these tables, or a recursion, leaves the
+depth unknown and fails the check. A root
+marked "optional" belongs to a feature that can be compiled out, and is
+skipped when it is not in the build. ISRs of different priorities can nest,
+so the deepest ISR of each priority level is added up for the worst-case
+stack on top of the thread stack.
+
+The script exits with status 1 if a module or an ISR exceeds its budget, or
+if the stack of an ISR is not known.
+"""
+
+import argparse
+import fnmatch
+import json
+import os
+import re
+import sys
+
+# Bytes stacked by the Cortex-M33 on exception entry (basic frame; the FPU
+# context is not stacked with VFP_SELECT=softfloat)
+EXCEPTION_FRAME = 32
+
+SECTION_KINDS = (
+    (".text", "text"),
+    (".rodata", "rodata"),
+    (".data", "data"),
+    (".ramfunc", "data"),
+    (".bss", "bss"),
+    ("COMMON", "bss"),
+    (".noinit", "bss"),
+)
+
+SECTION_RE = re.compile(r"^ (\S+)\s*$")
+ENTRY_RE = re.compile(r"^ (\S+)?\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(.+)$")
+
+
+def section_kind(name):
+    for prefix, kind in SECTION_KINDS:
+        if name == prefix or name.startswith(prefix + "."):
+            return kind
+    return None
+
+
+def parse_map(path):
+    """Returns a list of (object, kind, size) from a GNU ld map file."""
+    entries = []
+    pending = None
+    in_map = False
+    with open(path, "r", errors="replace") as src:
+        for line in src:
+            line = line.rstrip("\n")
+            if line.startswith("Linker script and memory map"):
+                in_map = True
+                continue
+            if not in_map:
+                continue
+            match = SECTION_RE.match(line)
+            if match:
+                # Long section names put the address on the next line
+                pending = match.group(1)
+                continue
+            match = ENTRY_RE.match(line)
+            if match:
+                name = match.group(1) or pending
+                pending = None
+                kind = section_kind(name or "")
+                size = int(match.group(3), 16)
+                obj = match.group(4).strip()
+                if kind and size and not obj.startswith("load address"):
+                    entries.append((obj, kind, size))
+                continue
+            pending = None
+    return entries
+
+
+def module_of(obj, modules):
+    path = obj.replace("\\", "/")
+    for name, spec in modules.items():
+        for pattern in spec.get("match", []):
+            if fnmatch.fnmatch(path, pattern):
+                return name
+    return "other"
+
+
+def footprint(entries, modules):
+    usage = {}
+    for obj, kind, size in entries:
+        mod = module_of(obj, modules)
+        usage.setdefault(mod, {"text": 0, "rodata": 0, "data": 0, "bss": 0})
+        usage[mod][kind] += size
+    for sizes in usage.values():
+        sizes["flash"] = sizes["text"] + sizes["rodata"] + sizes["data"]
+        sizes["ram"] = sizes["data"] + sizes["bss"]
+    return usage
+
+
+NODE_RE = re.compile(r'node: \{ title: "([^"]+)" label: "([^"]*)"')
+EDGE_RE = re.compile(r'edge: \{ sourcename: "([^"]+)" targetname: "([^"]+)"')
+STACK_RE = re.compile(r"\\n(\d+) bytes \(([a-z,]+)\)")
+
+
+def parse_callgraph(build_dir):
+    """Returns (frames, calls) from all .ci files below build_dir.
+
+    frames maps a function title to (stack bytes, qualifier); calls maps a
+    title to the set of callee titles. Static functions are titled
+    "file:name", external ones by name only.
+    """
+    frames = {}
+    calls = {}
+    for root, _, files in os.walk(build_dir):
+        for name in files:
+            if not name.endswith(".ci"):
+                continue
+            with open(os.path.join(root, name), "r", errors="replace") as src:
+                for line in src:
+                    match = NODE_RE.search(line)
+                    if match:
+                        stack = STACK_RE.search(match.group(2))
+                        if stack:
+                            frames[match.group(1)] = (int(stack.group(1)),
+                                                      stack.group(2))
+                        continue
+                    match = EDGE_RE.search(line)
+                    if match:
+                        calls.setdefault(match.group(1), set()).add(
+                            match.group(2))
+    return frames, calls
+
+
+def short_name(title):
+    return title.rsplit(":", 1)[-1]
+
+
+def worst_stack(root, frames, calls, indirect, known):
+    """Returns (bytes, path, notes, errors) of the deepest call chain from
+    root. errors lists what the depth misses: a non-empty list fails."""
+    by_name = {}
+    for title in frames:
+        by_name.setdefault(short_name(title), title)
+    notes = set()
+    errors = set()
+    memo = {}
+
+    def resolve(title):
+        if title in frames:
+            return title
+        return by_name.get(short_name(title))
+
+    def visit(title, active):
+        if title in memo:
+            return memo[title]
+        if title in active:
+            errors.add("recursion through %s (unbounded)" % short_name(title))
+            return 0, []
+        size, qualifier = frames[title]
+        if qualifier != "static":
+            notes.add("%s uses %s stack" % (short_name(title), qualifier))
+        targets = set(calls.get(title, ()))
+        listed = set()
+        if "__indirect_call" in targets:
+            targets.discard("__indirect_call")
+            if short_name(title) not in indirect:
+                errors.add("unresolved indirect call in %s" %
+                           short_name(title))
+            # Listed targets of features compiled out are not in the build
+            listed = set(indirect.get(short_name(title), [])) - targets
+        best = (0, [])
+        for target in targets | listed:
+            resolved = resolve(target)
+            if resolved is not None:
+                depth, path = visit(resolved, active | {title})
+            elif short_name(target) in known:
+                depth, path = known[short_name(target)], [short_name(target)]
+            elif target in listed:
+                continue
+            else:
+                errors.add("no stack data for %s" % short_name(target))
+                continue
+            if depth > best[0]:
+                best = (depth, path)
+        result = (size + best[0], [short_name(title)] + best[1])
+        memo[title] = result
+        return result
+
+    start = resolve(root)
+    if start is None:
+        return None, [], set(), {"no stack data for %s" % root}
+    depth, path = visit(start, frozenset())
+    return depth + EXCEPTION_FRAME, path, notes, errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("map", help="GNU ld map file of the application")
+    parser.add_argument("--budget", required=True, help="budget JSON file")
+    parser.add_argument("--build-dir", help="directory searched for .ci "
+                        "files (default: directory of the map file)")
+    args = parser.parse_args()
+
+    with open(args.budget, "r") as src:
+        budget = json.load(src)
+    modules = budget.get("modules", {})
+    failures = []
+
+    usage = footprint(parse_map(args.map), modules)
+    print("%-14s %8s %8s %8s %8s %9s %9s" % ("module", "text", "rodata",
+                                           "data", "bss", "flash", "ram"))
+    total = {"text": 0, "rodata": 0, "data": 0, "bss": 0, "flash": 0, "ram": 0}
+    for mod in list(modules) + ["other"]:
+        if mod not in usage:
+            continue
+        sizes = usage[mod]
+        limits = modules.get(mod, {})
+        marks = []
+        for kind in ("flash", "ram"):
+            total[kind] += sizes[kind]
+            if kind in limits and sizes[kind] > limits[kind]:
+                marks.append("%s over budget %d" % (kind, limits[kind]))
+                failures.append("%s %s %d > %d" % (mod, kind, sizes[kind],
+                                                   limits[kind]))
+        for kind in ("text", "rodata", "data", "bss"):
+            total[kind] += sizes[kind]
+        print("%-14s %8d %8d %8d %8d %9d %9d  %s" % (
+            mod, sizes["text"], sizes["rodata"], sizes["data"], sizes["bss"],
+            sizes["flash"], sizes["ram"], ", ".join(marks)))
+    print("%-14s %8d %8d %8d %8d %9d %9d" % (
+        "total", total["text"], total["rodata"], total["data"], total["bss"],
+        total["flash"], total["ram"]))
+
+    stacks = budget.get("stack", {})
+    if stacks:
+        frames, calls = parse_callgraph(args.build_dir or
+                                        os.path.dirname(args.map) or ".")
+        indirect = budget.get("indirect", {})
+        known = budget.get("frames", {})
+        levels = {}
+        print()
+        print("%-24s %4s %8s %8s  %s" % ("ISR", "prio", "stack", "budget",
+                                         "deepest path"))
+        for root, spec in stacks.items():
+            limit = spec["budget"]
+            depth, path, notes, errors = worst_stack(root, frames, calls,
+                                                     indirect, known)
+            if depth is None and spec.get("optional"):
+                print("%-24s %4d %8s %8d  not in this build" % (
+                    root, spec["priority"], "-", limit))
+                continue
+            if depth is None:
+                print("%-24s %4d %8s %8d  %s" % (root, spec["priority"], "?",
+                                                 limit,
+                                                 "; ".join(sorted(errors))))
+                failures.append("%s stack unknown" % root)
+                continue
+            level = spec["priority"]
+            levels[level] = max(levels.get(level, 0), depth)
+            mark = ""
+            if depth > limit:
+                mark = "  OVER BUDGET"
+                failures.append("%s stack %d > %d" % (root, depth, limit))
+            print("%-24s %4d %8d %8d  %s%s" % (root, level, depth, limit,
+                                               " > ".join(path), mark))
+            for note in sorted(notes):
+                print("%-24s %4s %8s %8s  note: %s" % ("", "", "", "", note))
+            for error in sorted(errors):
+                print("%-24s %4s %8s %8s  error: %s" % ("", "", "", "", error))
+                failures.append("%s stack unknown: %s" % (root, error))
+        nested = sum(levels.values())
+        limit = budget.get("stack_nested")
+        print("%-24s %4s %8d %8s" % ("all ISRs nested", "", nested,
+                                     limit if limit is not None else "-"))
+        if limit is not None and nested > limit:
+            failures.append("nested ISR stack %d > %d" % (nested, limit))
+
+    if failures:
+        print()
+        print("size check failed:")
+        for failure in failures:
+            print("  " + failure)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
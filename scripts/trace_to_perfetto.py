@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+################################################################################
+# \file trace_to_perfetto.py
+# \version 1.0
+#
+# \brief
+# Converts event trace dumps from the debug UART to Chrome trace JSON.
+#
+# \copyright
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+"""Convert event trace dumps captured from the debug UART to Chrome trace JSON.
+
+The firmware (built with TRACE_ENABLE=1) prints blocks of the form
+
+    TRACE BEGIN <cpu_hz> <count>
+    TRACE NAME <event> <track> <name>
+    T <timestamp> <type> <event> <arg>
+    TRACE END
+
+Save the terminal output to a file and run
+
+    python scripts/trace_to_perfetto.py uart.log -o trace.json
+
+Open the result in https://ui.perfetto.dev or chrome://tracing. Every track
+(main loop, GPIO ISR, CAN FD ISR, bus) is shown as one row, so ISR nesting,
+handler durations and frame timings line up on one timeline. Each capture is
+shown as its own process with its own time base: the counter may wrap any
+number of times while a capture is printed, so the time between two
+captures is unknown.
+"""
+
+import argparse
+import json
+import sys
+
+# Row names for the TRACE_TRACK_xxx values in trace.h
+TRACK_NAMES = {
+    0: "main loop",
+    1: "gpio_interrupt_handler",
+    2: "isr_canfd",
+    3: "bus",
+}
+
+# Events whose argument is a CAN identifier
+FRAME_EVENTS = ("frame_rx", "frame_tx")
+
+# Record holding the upper 16 bits of the argument of the next record
+ARG_HIGH = "h"
+
+
+def parse_captures(lines):
+    """Yields (cpu_hz, names, records) for every complete dump in the log.
+
+    Arguments split over an ARG_HIGH record and the record after it are
+    joined again."""
+    capture = None
+    high = 0
+    for line in lines:
+        fields = line.strip().split()
+        if not fields:
+            continue
+        if fields[:2] == ["TRACE", "BEGIN"]:
+            capture = (int(fields[2]), {}, [])
+            high = 0
+        elif capture is None:
+            continue
+        elif fields[:2] == ["TRACE", "NAME"]:
+            capture[1][int(fields[2])] = (int(fields[3]), " ".join(fields[4:]))
+        elif fields[0] == "T" and len(fields) == 5:
+            arg = int(fields[4], 16)
+            if fields[2] == ARG_HIGH:
+                high = arg << 16
+                continue
+            capture[2].append((int(fields[1], 16), fields[2],
+                               int(fields[3], 16), high | arg))
+            high = 0
+        elif fields[:2] == ["TRACE", "END"]:
+            yield capture
+            capture = None
+
+
+def to_chrome_events(captures):
+    """Converts the captures to a list of Chrome trace events, one process
+    per capture."""
+    events = []
+    for pid, (cpu_hz, names, records) in enumerate(captures, 1):
+        cycles_per_us = cpu_hz / 1e6
+        tracks = set()
+        # The unwrap starts again with each capture: the counter may have
+        # wrapped any number of times since the previous one was recorded
+        epoch = None
+        last = None
+        wraps = 0
+        for timestamp, ph, event, arg in records:
+            # The DWT counter is 32 bits wide; unwrap it into one timeline
+            if last is not None and timestamp < last:
+                wraps += 1
+            last = timestamp
+            cycles = (wraps << 32) + timestamp
+            if epoch is None:
+                epoch = cycles
+            track, name = names.get(event, (0, "event_%d" % event))
+            tracks.add(track)
+            entry = {
+                "name": name,
+                "ph": ph,
+                "ts": (cycles - epoch) / cycles_per_us,
+                "pid": pid,
+                "tid": track,
+            }
+            if ph == "i":
+                entry["s"] = "t"
+                if name in FRAME_EVENTS:
+                    entry["name"] = ("%s 0x%03x" if arg <= 0x7FF else
+                                     "%s 0x%08x") % (name, arg)
+                entry["args"] = {"arg": arg}
+            events.append(entry)
+        events.append({"name": "process_name", "ph": "M", "pid": pid,
+                       "args": {"name": "capture %d" % (pid - 1)}})
+        for track in sorted(tracks):
+            events.append({"name": "thread_name", "ph": "M", "pid": pid,
+                           "tid": track, "args": {
+                               "name": TRACK_NAMES.get(track,
+                                                       "track %d" % track)}})
+            events.append({"name": "thread_sort_index", "ph": "M",
+                           "pid": pid, "tid": track,
+                           "args": {"sort_index": track}})
+    return events
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("log", help="UART log containing TRACE blocks")
+    parser.add_argument("-o", "--output", default="-",
+                        help="output JSON file (default: stdout)")
+    parser.add_argument("-c", "--capture", type=int,
+                        help="convert only the N-th capture (0 based)")
+    args = parser.parse_args()
+
+    with open(args.log, "r", errors="replace") as log:
+        captures = list(parse_captures(log))
+    if not captures:
+        sys.exit("no complete TRACE block found in %s" % args.log)
+    if args.capture is not None:
+        captures = [captures[args.capture]]
+
+    trace = {"traceEvents": to_chrome_events(captures),
+             "displayTimeUnit": "ns"}
+    if args.output == "-":
+        json.dump(trace, sys.stdout)
+    else:
+        with open(args.output, "w") as out:
+            json.dump(trace, out)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+################################################################################
+# \file wake_trace.py
+# \version 1.0
+#
+# \brief
+# Generates the selective wake-up replay table from a candump log.
+#
+# \copyright
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+"""Convert a candump log to the wake-up replay table of the benchmark variant.
+
+The benchmark variant (BENCHMARK_ENABLE=1 with NM_ENABLE=1) replays the table
+in wake_trace.h through the CAN FD channel in internal loopback, configured
+as during selective bus sleep, and counts wake-ups. Record the traffic of a
+sleeping vehicle or test bench with
+
+    candump -L can0 > sleep.log
+
+and regenerate the table with
+
+    python scripts/wake_trace.py sleep.log -o wake_trace.h
+
+Every frame is marked with whether it should wake the node, using the same
+patterns as NM_WAKE_LIST in nm.h. Pass --pattern to override them when the
+list is changed. The firmware reports false wake-ups (woke, but not marked)
+and missed wake-ups (marked, but did not wake).
+"""
+
+import argparse
+import re
+import sys
+
+# ID/ID_MASK:VALUE/MASK of NM_WAKE_LIST; VALUE and MASK cover payload bytes
+# 0 to 7 with byte 0 least significant
+DEFAULT_PATTERNS = (
+    "500/7C0:14000/14000",  # PN_REQUEST: PNI bit and cluster 0x01
+    "7DF/7FF:0/0",          # DIAG_REQUEST
+)
+
+# Payload bytes kept per frame; the wake-up check does not look further
+DATA_MAX = 8
+
+LINE_RE = re.compile(r"^\((?P<time>[0-9.]+)\)\s+\S+\s+"
+                     r"(?P<id>[0-9A-Fa-f]+)#(?P<fd>#[0-9A-Fa-f])?"
+                     r"(?P<data>[0-9A-Fa-fR]*)")
+
+
+def parse_pattern(text):
+    """Returns (id, id_mask, value, mask) from ID/ID_MASK:VALUE/MASK."""
+    ident, payload = text.split(":")
+    ident, id_mask = ident.split("/")
+    value, mask = payload.split("/")
+    return int(ident, 16), int(id_mask, 16), int(value, 16), int(mask, 16)
+
+
+def parse_log(path):
+    """Yields (time, id, fd, brs, data) for every data frame in the log."""
+    with open(path, "r") as src:
+        for line in src:
+            match = LINE_RE.match(line.strip())
+            if not match or "R" in match.group("data"):
+                continue
+            fd_flags = match.group("fd")
+            brs = fd_flags is not None and bool(int(fd_flags[1], 16) & 0x1)
+            ident = int(match.group("id"), 16)
+            if len(match.group("id")) > 3:
+                # Extended frames never pass the wake-up filters
+                ident |= 0x80000000
+            yield (float(match.group("time")), ident, fd_flags is not None,
+                   brs, bytes.fromhex(match.group("data")))
+
+
+def should_wake(ident, data, patterns):
+    """Mirrors nm_wake_match()."""
+    if ident & 0x80000000:
+        return False
+    payload = int.from_bytes(data[:DATA_MAX].ljust(DATA_MAX, b"\0"), "little")
+    return any(((ident ^ pid) & pid_mask) == 0 and (payload & mask) == value
+               for pid, pid_mask, value, mask in patterns)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("log", help="candump -L log")
+    parser.add_argument("-o", "--output", default="wake_trace.h",
+                        help="generated header (default wake_trace.h)")
+    parser.add_argument("--pattern", action="append",
+                        help="wake-up pattern ID/ID_MASK:VALUE/MASK in hex, "
+                        "repeatable (default: NM_WAKE_LIST)")
+    args = parser.parse_args()
+
+    patterns = [parse_pattern(p) for p in (args.pattern or DEFAULT_PATTERNS)]
+    frames = list(parse_log(args.log))
+    if not frames:
+        sys.exit("no frames found in %s" % args.log)
+
+    rows = []
+    wakes = 0
+    for _, ident, fd, brs, data in frames:
+        if ident & 0x80000000:
+            continue
+        wake = should_wake(ident, data, patterns)
+        wakes += wake
+        flags = ["CANFD_FRAME_FLAG_FDF" if fd else None,
+                 "CANFD_FRAME_FLAG_BRS" if brs else None]
+        flags = " | ".join(f for f in flags if f) or "0U"
+        body = ", ".join("0x%02XU" % b for b in data[:DATA_MAX])
+        rows.append("    { 0x%03XU, %2uU, %s, %s,\n      { %s } },"
+                    % (ident, len(data), flags, "true" if wake else "false",
+                       body))
+
+    with open(args.output, "w") as out:
+        out.write(HEADER % {"log": args.log.replace("\\", "/").split("/")[-1],
+                            "count": len(rows), "wakes": wakes,
+                            "rows": "\n".join(rows)})
+    print("%d frames, %d wake-up frames" % (len(rows), wakes))
+
+
+HEADER = """\
+/******************************************************************************
+* File Name:   wake_trace.h
+*
+* Description: Frames replayed by the selective wake-up benchmark. Generated
+*              by scripts/wake_trace.py from %(log)s; do not edit.
+*
+*******************************************************************************/
+
+#ifndef WAKE_TRACE_H_
+#define WAKE_TRACE_H_
+
+/* %(count)u standard frames, %(wakes)u of them wake-up frames */
+static const bench_wake_frame_t wake_trace[] =
+{
+%(rows)s
+};
+
+#endif /* WAKE_TRACE_H_ */
+
+/* [] END OF FILE */
+"""
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,221 @@
+/******************************************************************************
+* File Name:   sensor_stream.c
+*
+* Description: This file contains the sensor snapshot stream built on the
+*              multicast stream protocol.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "sensor_stream.h"
+
+#if (MSTREAM_ENABLE)
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Snapshot being sent, or being reassembled */
+static uint8_t sensor_snapshot[SENSOR_STREAM_SNAPSHOT_SIZE];
+
+#if (0 == MSTREAM_NODE)
+static mstream_tx_t sensor_tx;
+static uint32_t     sensor_snapshot_count;
+static uint32_t     sensor_snapshot_start;
+#else
+static mstream_rx_t sensor_rx;
+static uint32_t     sensor_crc_errors;
+#endif /* 0 == MSTREAM_NODE */
+
+#if (0 == MSTREAM_NODE)
+/*******************************************************************************
+* Function Name: sensor_stream_fill
+********************************************************************************
+* Summary:
+* Fills the next snapshot. Stands in for real sensor data: a counter pattern
+* followed by its CRC-16, which the receivers check.
+*
+*******************************************************************************/
+static void sensor_stream_fill(void)
+{
+    const uint32_t len = SENSOR_STREAM_SNAPSHOT_SIZE - 2U;
+    uint16_t crc;
+
+    for (uint32_t idx = 0U; idx < len; idx++)
+    {
+        sensor_snapshot[idx] = (uint8_t)(sensor_snapshot_count + idx);
+    }
+
+    crc = canfd_crc16(CANFD_CRC16_INIT, sensor_snapshot, len);
+    sensor_snapshot[len] = (uint8_t)(crc >> 8);
+    sensor_snapshot[len + 1U] = (uint8_t)crc;
+    sensor_snapshot_count++;
+}
+#else
+/*******************************************************************************
+* Function Name: sensor_stream_on_message
+********************************************************************************
+* Summary:
+* Checks the CRC-16 of every complete snapshot.
+*
+*******************************************************************************/
+static void sensor_stream_on_message(const uint8_t *data, uint32_t len,
+                                     bool ok)
+{
+    if (ok && (len >= 2U) &&
+        (0U != canfd_crc16(CANFD_CRC16_INIT, data, len)))
+    {
+        /* CRC over data and stored CRC is zero for an intact snapshot */
+        sensor_crc_errors++;
+    }
+}
+#endif /* 0 == MSTREAM_NODE */
+#endif /* MSTREAM_ENABLE */
+
+/*******************************************************************************
+* Function Name: sensor_stream_init
+********************************************************************************
+* Summary:
+* Sets up this board as the sender or as a receiver of the snapshot stream.
+*
+* Parameters:
+*  send         Frame transmit function
+*  now_ms       Current time
+*
+*******************************************************************************/
+void sensor_stream_init(mstream_send_fn_t send, uint32_t now_ms)
+{
+#if (MSTREAM_ENABLE)
+#if (0 == MSTREAM_NODE)
+    mstream_tx_init(&sensor_tx, SENSOR_STREAM_DATA_ID, send, now_ms);
+    sensor_snapshot_start = now_ms;
+#else
+    mstream_rx_init(&sensor_rx, SENSOR_STREAM_DATA_ID, (uint8_t)MSTREAM_NODE,
+                    SENSOR_STREAM_NACK_ID + MSTREAM_NODE, send,
+                    sensor_snapshot, sizeof(sensor_snapshot),
+                    sensor_stream_on_message);
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* 0 == MSTREAM_NODE */
+#else
+    CY_UNUSED_PARAMETER(send);
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* MSTREAM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: sensor_stream_on_frame
+********************************************************************************
+* Summary:
+* Passes a received stream frame to the sender (NACKs) or the receiver (data
+* and sync frames).
+*
+* Parameters:
+*  frame        Received frame
+*  now_ms       Current time
+*
+*******************************************************************************/
+void sensor_stream_on_frame(const canfd_frame_t *frame, uint32_t now_ms)
+{
+#if (MSTREAM_ENABLE)
+#if (0 == MSTREAM_NODE)
+    mstream_tx_on_frame(&sensor_tx, frame);
+    CY_UNUSED_PARAMETER(now_ms);
+#else
+    mstream_rx_on_frame(&sensor_rx, frame, now_ms);
+#endif /* 0 == MSTREAM_NODE */
+#else
+    CY_UNUSED_PARAMETER(frame);
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* MSTREAM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: sensor_stream_poll
+********************************************************************************
+* Summary:
+* Called from the main loop. The sender starts a new snapshot every
+* SENSOR_STREAM_PERIOD_MS once the previous one is out; both sides then run
+* the protocol.
+*
+* Parameters:
+*  now_ms       Current time
+*
+*******************************************************************************/
+void sensor_stream_poll(uint32_t now_ms)
+{
+#if (MSTREAM_ENABLE)
+#if (0 == MSTREAM_NODE)
+    if ((!mstream_tx_busy(&sensor_tx)) &&
+        ((now_ms - sensor_snapshot_start) >= SENSOR_STREAM_PERIOD_MS))
+    {
+        sensor_snapshot_start = now_ms;
+        sensor_stream_fill();
+        (void)mstream_tx_write(&sensor_tx, sensor_snapshot,
+                               sizeof(sensor_snapshot));
+    }
+    mstream_tx_poll(&sensor_tx, now_ms);
+#else
+    mstream_rx_poll(&sensor_rx, now_ms);
+#endif /* 0 == MSTREAM_NODE */
+#else
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* MSTREAM_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: sensor_stream_report
+********************************************************************************
+* Summary:
+* Prints the stream counters on the debug UART.
+*
+*******************************************************************************/
+void sensor_stream_report(void)
+{
+#if (MSTREAM_ENABLE)
+#if (0 == MSTREAM_NODE)
+    mstream_tx_report(&sensor_tx);
+#else
+    mstream_rx_report(&sensor_rx);
+    printf("Snapshot CRC errors: %lu\r\n\r\n",
+           (unsigned long)sensor_crc_errors);
+#endif /* 0 == MSTREAM_NODE */
+#endif /* MSTREAM_ENABLE */
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,101 @@
+/******************************************************************************
+* File Name:   sensor_stream.h
+*
+* Description: This file contains the interface of the sensor snapshot stream
+*              sent from one board to up to eight others.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef SENSOR_STREAM_H_
+#define SENSOR_STREAM_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "mstream.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make MSTREAM_ENABLE=1") to stream sensor
+ * snapshots over the multicast stream protocol */
+#ifndef MSTREAM_ENABLE
+#define MSTREAM_ENABLE          (0)
+#endif
+
+/* 0 makes this board the sender, 1 to 8 a receiver with that number */
+#ifndef MSTREAM_NODE
+#define MSTREAM_NODE            (0)
+#endif
+
+/* CAN ID of the snapshot stream. NACKs use SENSOR_STREAM_NACK_ID + receiver
+ * number, a higher priority than the data, so that receivers are heard while
+ * the sender keeps the bus busy. */
+#define SENSOR_STREAM_DATA_ID   (0x200U)
+#define SENSOR_STREAM_NACK_ID   (0x1F0U)
+
+/* Snapshot size, including the CRC-16 in the last two bytes */
+#ifndef SENSOR_STREAM_SNAPSHOT_SIZE
+#define SENSOR_STREAM_SNAPSHOT_SIZE     (512U)
+#endif
+
+/* Time from the start of one snapshot to the start of the next */
+#ifndef SENSOR_STREAM_PERIOD_MS
+#define SENSOR_STREAM_PERIOD_MS (50U)
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void sensor_stream_init(mstream_send_fn_t send, uint32_t now_ms);
+void sensor_stream_on_frame(const canfd_frame_t *frame, uint32_t now_ms);
+void sensor_stream_poll(uint32_t now_ms);
+void sensor_stream_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SENSOR_STREAM_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,328 @@
+/******************************************************************************
+* File Name:   seqmon.c
+*
+* Description: Sequence monitor. Checks the sequence numbers carried in the
+*              payload of the monitored streams and counts lost, late and
+*              duplicate frames, each loss against the FIFO, pool and bus
+*              error events seen with it.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "seqmon.h"
+#include "stats.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SEQMON_STREAM_ENTRY(name, id, offset, bits)                            \
+    [SEQMON_STREAM_##name] = { (id), (offset), (bits), #name },
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t    id;
+    uint8_t     offset;
+    uint8_t     bits;
+    const char *name;
+} seqmon_stream_cfg_t;
+
+/* Receive state of one stream. Bit n of seen stands for sequence number
+ * expected - 1 - n. */
+typedef struct
+{
+    uint32_t expected;
+    uint32_t seen;
+    uint32_t events[SEQMON_EVENT_COUNT];    /* At the previous frame */
+    bool     synced;
+} seqmon_state_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const seqmon_stream_cfg_t seqmon_streams[SEQMON_STREAM_COUNT] =
+{
+    SEQMON_STREAM_LIST(SEQMON_STREAM_ENTRY)
+};
+
+static seqmon_state_t   seqmon_state[SEQMON_STREAM_COUNT];
+static seqmon_stats_t   seqmon_stats[SEQMON_STREAM_COUNT];
+
+/* Written from interrupt context only */
+static volatile uint32_t seqmon_events[SEQMON_EVENT_COUNT];
+
+/*******************************************************************************
+* Function Name: seqmon_sync
+********************************************************************************
+* Summary:
+* Starts a stream at a sequence number.
+*
+*******************************************************************************/
+static void seqmon_sync(seqmon_state_t *state, uint32_t seq, uint32_t mask)
+{
+    state->expected = (seq + 1U) & mask;
+    state->seen = 1U;
+    state->synced = true;
+}
+
+/*******************************************************************************
+* Function Name: seqmon_count_gap
+********************************************************************************
+* Summary:
+* Counts a run of missing frames against the event seen since the previous
+* frame of the stream.
+*
+*******************************************************************************/
+static void seqmon_count_gap(const seqmon_state_t *state,
+                             seqmon_stats_t *stats, uint32_t count)
+{
+    stats->lost += count;
+    stats->gaps++;
+    if (count > stats->gap_max)
+    {
+        stats->gap_max = count;
+    }
+    STATS_ADD(SEQMON_LOST, count);
+    STATS_INC(SEQMON_GAPS);
+    STATS_PEAK(SEQMON_GAP_MAX, count);
+
+    if ((seqmon_events[SEQMON_EVENT_FIFO_LOST] !=
+         state->events[SEQMON_EVENT_FIFO_LOST]) ||
+        (seqmon_events[SEQMON_EVENT_POOL_FULL] !=
+         state->events[SEQMON_EVENT_POOL_FULL]))
+    {
+        stats->lost_local += count;
+    }
+    else if (seqmon_events[SEQMON_EVENT_BUS_ERROR] !=
+             state->events[SEQMON_EVENT_BUS_ERROR])
+    {
+        stats->lost_error += count;
+    }
+    else
+    {
+        stats->lost_bus += count;
+    }
+}
+
+/*******************************************************************************
+* Function Name: seqmon_on_frame
+********************************************************************************
+* Summary:
+* Checks the sequence number of a received frame. Frames of other IDs and
+* frames too short to hold the number are ignored. The work per frame does
+* not depend on the gap: a newer number shifts the window, an older one tests
+* one bit.
+*
+* Parameters:
+*  id           CAN ID
+*  data         Payload
+*  len          Payload length
+*
+*******************************************************************************/
+void seqmon_on_frame(uint32_t id, const uint8_t *data, uint8_t len)
+{
+    const seqmon_stream_cfg_t *cfg;
+    seqmon_state_t *state;
+    seqmon_stats_t *stats;
+    uint32_t stream;
+    uint32_t mask;
+    uint32_t seq = 0U;
+    uint32_t delta;
+
+    for (stream = 0U; stream < SEQMON_STREAM_COUNT; stream++)
+    {
+        if (seqmon_streams[stream].id == id)
+        {
+            break;
+        }
+    }
+    if (SEQMON_STREAM_COUNT == stream)
+    {
+        return;
+    }
+
+    cfg = &seqmon_streams[stream];
+    if (len < (cfg->offset + (cfg->bits / 8U)))
+    {
+        return;
+    }
+    for (uint32_t idx = 0U; idx < (cfg->bits / 8U); idx++)
+    {
+        seq |= (uint32_t)data[cfg->offset + idx] << (idx * 8U);
+    }
+
+    state = &seqmon_state[stream];
+    stats = &seqmon_stats[stream];
+    mask = (32U == cfg->bits) ? 0xFFFFFFFFUL : ((1UL << cfg->bits) - 1U);
+    delta = (seq - state->expected) & mask;
+
+    if (!state->synced)
+    {
+        stats->received++;
+        seqmon_sync(state, seq, mask);
+    }
+    else if (delta <= (mask >> 1))
+    {
+        /* The expected frame, or a newer one after a gap */
+        stats->received++;
+        if (delta > SEQMON_GAP_MAX)
+        {
+            stats->resyncs++;
+            seqmon_sync(state, seq, mask);
+        }
+        else
+        {
+            if (0U != delta)
+            {
+                seqmon_count_gap(state, stats, delta);
+            }
+            state->seen = ((delta + 1U) >= SEQMON_WINDOW) ? 1U :
+                          ((state->seen << (delta + 1U)) | 1U);
+            state->expected = (seq + 1U) & mask;
+        }
+    }
+    else
+    {
+        uint32_t back = (state->expected - 1U - seq) & mask;
+
+        if (back >= SEQMON_WINDOW)
+        {
+            /* Far behind: the sender started again */
+            stats->received++;
+            stats->resyncs++;
+            seqmon_sync(state, seq, mask);
+        }
+        else if (0U != (state->seen & (1UL << back)))
+        {
+            stats->duplicates++;
+        }
+        else
+        {
+            stats->received++;
+            stats->late++;
+            state->seen |= 1UL << back;
+        }
+    }
+
+    for (uint32_t event = 0U; event < SEQMON_EVENT_COUNT; event++)
+    {
+        state->events[event] = seqmon_events[event];
+    }
+}
+
+/*******************************************************************************
+* Function Name: seqmon_on_event
+********************************************************************************
+* Summary:
+* Counts an event that can explain lost frames. Called from the interrupt
+* that saw it.
+*
+* Parameters:
+*  event        Event
+*
+*******************************************************************************/
+void seqmon_on_event(seqmon_event_t event)
+{
+    seqmon_events[event]++;
+}
+
+/*******************************************************************************
+* Function Name: seqmon_get_stats
+********************************************************************************
+* Summary:
+* Copies the counters of a stream.
+*
+*******************************************************************************/
+void seqmon_get_stats(uint32_t stream, seqmon_stats_t *stats)
+{
+    *stats = seqmon_stats[stream];
+}
+
+/*******************************************************************************
+* Function Name: seqmon_get_events
+********************************************************************************
+* Summary:
+* Returns the number of events of a kind since start-up.
+*
+*******************************************************************************/
+uint32_t seqmon_get_events(seqmon_event_t event)
+{
+    return seqmon_events[event];
+}
+
+/*******************************************************************************
+* Function Name: seqmon_report
+********************************************************************************
+* Summary:
+* Prints the counters of the streams that were received, and the events.
+*
+*******************************************************************************/
+void seqmon_report(void)
+{
+    printf("Loss events: FIFO full %lu, pool full %lu, bus errors %lu\r\n",
+           (unsigned long)seqmon_events[SEQMON_EVENT_FIFO_LOST],
+           (unsigned long)seqmon_events[SEQMON_EVENT_POOL_FULL],
+           (unsigned long)seqmon_events[SEQMON_EVENT_BUS_ERROR]);
+
+    for (uint32_t stream = 0U; stream < SEQMON_STREAM_COUNT; stream++)
+    {
+        const seqmon_stats_t *stats = &seqmon_stats[stream];
+
+        if (!seqmon_state[stream].synced)
+        {
+            continue;
+        }
+        printf("  %-8s %lu received, %lu lost in %lu gaps (max %lu; local "
+               "%lu, error %lu, bus %lu), %lu late, %lu duplicates, "
+               "%lu resyncs\r\n", seqmon_streams[stream].name,
+               (unsigned long)stats->received, (unsigned long)stats->lost,
+               (unsigned long)stats->gaps, (unsigned long)stats->gap_max,
+               (unsigned long)stats->lost_local,
+               (unsigned long)stats->lost_error,
+               (unsigned long)stats->lost_bus, (unsigned long)stats->late,
+               (unsigned long)stats->duplicates,
+               (unsigned long)stats->resyncs);
+    }
+}
+
+/* [] END OF FILE */
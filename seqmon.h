@@ -0,0 +1,141 @@
+/******************************************************************************
+* File Name:   seqmon.h
+*
+* Description: Interface of the sequence monitor: per-stream gap, duplicate
+*              and reorder detection on received frames, with loss statistics.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef SEQMON_H_
+#define SEQMON_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make SEQMON_ENABLE=1") to number the frames of
+ * this node and check the numbers of the received streams */
+#ifndef SEQMON_ENABLE
+#define SEQMON_ENABLE           (0)
+#endif
+
+/* Sequence numbers remembered per stream, one bit each, to tell late
+ * frames from duplicates */
+#define SEQMON_WINDOW           (32U)
+
+/* A forward jump larger than this restarts the stream instead of counting
+ * the frames in between as lost */
+#ifndef SEQMON_GAP_MAX
+#define SEQMON_GAP_MAX          (1024U)
+#endif
+
+/* List of monitored streams: X(identifier, CAN ID, byte offset, bits).
+ * The sequence number is an unsigned little-endian counter of 8, 16 or 32
+ * bits at the offset in the payload. The node frames carry one in byte 0
+ * when SEQMON_ENABLE is set; the traffic generator of the shell always
+ * puts its 32-bit frame count first. */
+#define SEQMON_STREAM_LIST(X)                                                  \
+    X(NODE_1,       0x001U, 0U,  8U)                                           \
+    X(NODE_2,       0x002U, 0U,  8U)                                           \
+    X(GEN,          0x100U, 0U, 32U)
+
+#define SEQMON_STREAM_ENUM(name, id, offset, bits)      SEQMON_STREAM_##name,
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef enum
+{
+    SEQMON_STREAM_LIST(SEQMON_STREAM_ENUM)
+    SEQMON_STREAM_COUNT
+} seqmon_stream_t;
+
+/* Events that explain lost frames, reported from interrupt context */
+typedef enum
+{
+    SEQMON_EVENT_FIFO_LOST,         /* RX FIFO full, message lost */
+    SEQMON_EVENT_POOL_FULL,         /* No free frame in the pub/sub pool */
+    SEQMON_EVENT_BUS_ERROR,         /* Protocol error, error passive or
+                                     * bus-off */
+    SEQMON_EVENT_COUNT
+} seqmon_event_t;
+
+/* Counters of one stream. Lost frames are counted by the event seen since
+ * the previous frame of the stream: local if the FIFO or the pool
+ * overflowed, error if the controller saw a bus error, and bus otherwise,
+ * that is lost before they reached this node. */
+typedef struct
+{
+    uint32_t received;
+    uint32_t lost;                  /* Missing at a gap */
+    uint32_t gaps;                  /* Runs of missing frames */
+    uint32_t gap_max;               /* Longest run */
+    uint32_t lost_local;
+    uint32_t lost_error;
+    uint32_t lost_bus;
+    uint32_t late;                  /* Arrived after a newer frame, so
+                                     * also counted as lost */
+    uint32_t duplicates;
+    uint32_t resyncs;               /* Restarts of the sender */
+} seqmon_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void seqmon_on_frame(uint32_t id, const uint8_t *data, uint8_t len);
+void seqmon_on_event(seqmon_event_t event);
+void seqmon_get_stats(uint32_t stream, seqmon_stats_t *stats);
+uint32_t seqmon_get_events(seqmon_event_t event);
+void seqmon_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SEQMON_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,701 @@
+/******************************************************************************
+* File Name:   shell.c
+*
+* Description: This file contains the command shell on the debug UART, which
+*              controls the node and prints statistics at run time.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cybsp.h"
+#include "cycle_counter.h"
+#include "trace.h"
+#include "flog.h"
+#include "hoptrace.h"
+#include "datarate.h"
+#include "adcstream_can.h"
+#include "stats.h"
+#include "shell.h"
+
+#if (SHELL_ENABLE)
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* List of commands: X(identifier, name, arguments, description). Each
+ * command is handled by shell_cmd_<identifier>(). */
+#define SHELL_COMMAND_LIST(X)                                                  \
+    X(HELP,    "help",    "",                                                  \
+      "List the commands")                                                     \
+    X(STATS,   "stats",   "",                                                  \
+      "Print the statistics registry")                                         \
+    X(FILTER,  "filter",  "<id> <mask> reject|off",                            \
+      "Set the standard ID filter")                                            \
+    X(GEN,     "gen",     "<id> <len> <period us> | off",                      \
+      "Send frames; period 0 saturates the bus")                               \
+    X(BITRATE, "bitrate", "<nominal div> <data div>",                          \
+      "Set the bit rate prescalers")                                           \
+    X(TRACE,   "trace",   "",                                                  \
+      "Dump and re-arm the event trace")                                       \
+    X(CPU,     "cpu",     "",                                                  \
+      "Print the CPU load of the shell since the last call")                    \
+    X(LOG,     "log",     "[<ms> [count]]",                                    \
+      "Print the frame log counters, or the records from a log time")          \
+    X(HOPTRACE, "hoptrace", "<id> [mask] on|off",                              \
+      "Trace the latency of standard IDs across nodes")                        \
+    X(ADCLOAD, "adcload", "<percent>",                                         \
+      "Set the bus load cap of the ADC stream")
+
+#define SHELL_COMMAND_PROTO(id, name, args, text)                              \
+    static void shell_cmd_##id(uint32_t argc, char *argv[]);
+#define SHELL_COMMAND_ENTRY(id, name, args, text)                              \
+    { (name), (args), (text), shell_cmd_##id },
+
+#define SHELL_CYCLES_TO_US(cycles)                                             \
+    ((cycles) / (SystemCoreClock / 1000000U))
+
+/* Filter element set by the filter command */
+#define SHELL_FILTER_INDEX      (0U)
+
+/* Records printed by the log command by default */
+#define SHELL_LOG_COUNT         (10U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    const char *args;
+    const char *text;
+    void      (*fn)(uint32_t argc, char *argv[]);
+} shell_command_t;
+
+/* Traffic generator state */
+typedef struct
+{
+    bool          active;
+    canfd_frame_t frame;
+    uint32_t      period;       /* Cycles between frames, 0 = back to back */
+    uint32_t      next;         /* Cycle count of the next frame */
+    uint32_t      sent;         /* Running number of the next frame */
+} shell_gen_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+SHELL_COMMAND_LIST(SHELL_COMMAND_PROTO)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const shell_command_t shell_commands[] =
+{
+    SHELL_COMMAND_LIST(SHELL_COMMAND_ENTRY)
+};
+
+static const cy_stc_sysint_t shell_irq_cfg =
+{
+    .intrSrc = DEBUG_UART_IRQ,
+    .intrPriority = SHELL_INTR_PRIORITY
+};
+
+static CANFD_Type                    *shell_base;
+static uint32_t                       shell_chan;
+static const cy_stc_canfd_config_t   *shell_config;
+static cy_stc_canfd_context_t        *shell_context;
+static shell_send_fn_t                shell_send;
+
+/* Characters from the UART interrupt; written at head by the interrupt and
+ * read at tail by the main loop */
+static uint8_t                        shell_rx[SHELL_RX_SIZE];
+static volatile uint32_t              shell_rx_head;
+static volatile uint32_t              shell_rx_tail;
+
+/* Command line being typed */
+static char                           shell_line[SHELL_LINE_SIZE];
+static uint32_t                       shell_line_len;
+
+static shell_gen_t                    shell_gen;
+
+/* CPU cycles spent in the UART interrupt, in line handling and commands,
+ * and in the traffic generator, and cycles elapsed since the cpu command */
+static volatile uint32_t              shell_isr_cycles;
+static uint64_t                       shell_cmd_cycles;
+static uint64_t                       shell_gen_cycles;
+static uint64_t                       shell_elapsed;
+static uint32_t                       shell_last_poll;
+
+/*******************************************************************************
+* Function Name: shell_isr
+********************************************************************************
+* Summary:
+* UART RX interrupt. Only moves the received characters into the buffer for
+* the main loop.
+*
+*******************************************************************************/
+static void shell_isr(void)
+{
+    uint32_t start = cycle_counter_get();
+
+    while (0U != Cy_SCB_UART_GetNumInRxFifo(DEBUG_UART_HW))
+    {
+        uint32_t ch = Cy_SCB_UART_Get(DEBUG_UART_HW);
+        uint32_t next = (shell_rx_head + 1U) % SHELL_RX_SIZE;
+
+        if (next == shell_rx_tail)
+        {
+            STATS_INC(SHELL_RX_DROPPED);
+        }
+        else
+        {
+            shell_rx[shell_rx_head] = (uint8_t)ch;
+            shell_rx_head = next;
+        }
+    }
+    Cy_SCB_ClearRxInterrupt(DEBUG_UART_HW, CY_SCB_RX_INTR_NOT_EMPTY);
+
+    shell_isr_cycles += cycle_counter_get() - start;
+}
+
+/*******************************************************************************
+* Function Name: shell_parse_u32
+********************************************************************************
+* Summary:
+* Parses a decimal, or with 0x prefix hexadecimal, number.
+*
+* Return:
+*  true if the whole word is a number
+*
+*******************************************************************************/
+static bool shell_parse_u32(const char *text, uint32_t *value)
+{
+    char *end;
+
+    *value = (uint32_t)strtoul(text, &end, 0);
+    return (end != text) && ('\0' == *end);
+}
+
+/*******************************************************************************
+* Function Name: shell_usage
+********************************************************************************
+* Summary:
+* Prints the arguments of a command.
+*
+*******************************************************************************/
+static void shell_usage(const char *name)
+{
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(shell_commands) / sizeof(shell_commands[0]));
+         idx++)
+    {
+        if (0 == strcmp(name, shell_commands[idx].name))
+        {
+            printf("usage: %s %s\r\n", name, shell_commands[idx].args);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: shell_execute
+********************************************************************************
+* Summary:
+* Splits a command line into words and runs the matching command.
+*
+*******************************************************************************/
+static void shell_execute(char *line)
+{
+    char *argv[SHELL_ARGS_MAX];
+    uint32_t argc = 0U;
+    char *word = strtok(line, " \t");
+
+    while ((NULL != word) && (argc < SHELL_ARGS_MAX))
+    {
+        argv[argc++] = word;
+        word = strtok(NULL, " \t");
+    }
+
+    if (0U == argc)
+    {
+        return;
+    }
+
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(shell_commands) / sizeof(shell_commands[0]));
+         idx++)
+    {
+        if (0 == strcmp(argv[0], shell_commands[idx].name))
+        {
+            shell_commands[idx].fn(argc, argv);
+            return;
+        }
+    }
+
+    printf("unknown command '%s', try help\r\n", argv[0]);
+}
+
+/*******************************************************************************
+* Function Name: shell_gen_poll
+********************************************************************************
+* Summary:
+* Sends the next generator frame when it is due and the TX buffer is free.
+*
+*******************************************************************************/
+static void shell_gen_poll(void)
+{
+    uint32_t now = cycle_counter_get();
+
+    if (!shell_gen.active ||
+        ((0U != shell_gen.period) && ((int32_t)(now - shell_gen.next) < 0)))
+    {
+        return;
+    }
+
+    /* Running number in the first payload bytes */
+    memcpy(shell_gen.frame.data, &shell_gen.sent,
+           (shell_gen.frame.len < sizeof(shell_gen.sent)) ?
+           shell_gen.frame.len : sizeof(shell_gen.sent));
+
+    if (!shell_send(&shell_gen.frame))
+    {
+        STATS_INC(SHELL_GEN_BUSY);
+        return;
+    }
+
+    shell_gen.sent++;
+    STATS_INC(SHELL_GEN_SENT);
+    shell_gen.next += shell_gen.period;
+    if ((int32_t)(now - shell_gen.next) > (int32_t)shell_gen.period)
+    {
+        /* Fell behind, e.g. while a command printed; do not burst */
+        shell_gen.next = now + shell_gen.period;
+    }
+}
+
+/*******************************************************************************
+* Commands
+*******************************************************************************/
+static void shell_cmd_HELP(uint32_t argc, char *argv[])
+{
+    CY_UNUSED_PARAMETER(argc);
+    CY_UNUSED_PARAMETER(argv);
+
+    for (uint32_t idx = 0U;
+         idx < (uint32_t)(sizeof(shell_commands) / sizeof(shell_commands[0]));
+         idx++)
+    {
+        printf("%-8s %-30s %s\r\n", shell_commands[idx].name,
+               shell_commands[idx].args, shell_commands[idx].text);
+    }
+}
+
+static void shell_cmd_STATS(uint32_t argc, char *argv[])
+{
+    CY_UNUSED_PARAMETER(argc);
+    CY_UNUSED_PARAMETER(argv);
+
+#if (STATS_ENABLE)
+    stats_report();
+#else
+    printf("STATS: off, build with STATS_ENABLE=1\r\n");
+#endif /* STATS_ENABLE */
+}
+
+static void shell_cmd_FILTER(uint32_t argc, char *argv[])
+{
+    cy_stc_id_filter_t filter =
+    {
+        .sfid2 = 0U,
+        .sfid1 = 0U,
+        .sfec = CY_CANFD_SFEC_DISABLE,
+        .sft = CY_CANFD_SFT_CLASSIC_FILTER
+    };
+
+    if ((4U != argc) || !shell_parse_u32(argv[1], &filter.sfid1) ||
+        !shell_parse_u32(argv[2], &filter.sfid2) ||
+        (filter.sfid1 > 0x7FFU) || (filter.sfid2 > 0x7FFU))
+    {
+        shell_usage(argv[0]);
+        return;
+    }
+
+    if (0 == strcmp(argv[3], "reject"))
+    {
+        filter.sfec = CY_CANFD_SFEC_REJECT_ID;
+    }
+    else if (0 != strcmp(argv[3], "off"))
+    {
+        shell_usage(argv[0]);
+        return;
+    }
+
+    /* Frames matching no filter still go to RX FIFO 0 */
+    Cy_CANFD_SidFilterSetup(shell_base, shell_chan, &filter,
+                            SHELL_FILTER_INDEX, shell_context);
+    printf("filter %lu: id 0x%03lx mask 0x%03lx %s\r\n",
+           (unsigned long)SHELL_FILTER_INDEX, (unsigned long)filter.sfid1,
+           (unsigned long)filter.sfid2, argv[3]);
+}
+
+static void shell_cmd_GEN(uint32_t argc, char *argv[])
+{
+    uint32_t id;
+    uint32_t len;
+    uint32_t period_us;
+
+    if ((2U == argc) && (0 == strcmp(argv[1], "off")))
+    {
+        shell_gen.active = false;
+        printf("generator off, %lu frames sent\r\n",
+               (unsigned long)shell_gen.sent);
+        return;
+    }
+
+    /* shell_gen_poll() compares cycle counts as signed differences, so the
+     * period must stay below half the range of the counter */
+    if ((4U != argc) || !shell_parse_u32(argv[1], &id) ||
+        !shell_parse_u32(argv[2], &len) ||
+        !shell_parse_u32(argv[3], &period_us) ||
+        (id > 0x7FFU) || (len > CANFD_MAX_DATA_LEN) ||
+        (period_us > ((uint32_t)INT32_MAX / (SystemCoreClock / 1000000U))))
+    {
+        shell_usage(argv[0]);
+        return;
+    }
+
+    memset(&shell_gen.frame, 0, sizeof(shell_gen.frame));
+    shell_gen.frame.id = id;
+    /* Round up to the next length a DLC can encode */
+    shell_gen.frame.len = canfd_dlc_to_len(canfd_len_to_dlc(len));
+    if (shell_gen.frame.len > CANFD_CLASSIC_MAX_DATA_LEN)
+    {
+        shell_gen.frame.flags = CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS;
+    }
+    shell_gen.period = period_us * (SystemCoreClock / 1000000U);
+    shell_gen.next = cycle_counter_get();
+    shell_gen.sent = 0U;
+    shell_gen.active = true;
+
+    printf("generator: id 0x%03lx, %u bytes, every %lu us\r\n",
+           (unsigned long)id, shell_gen.frame.len, (unsigned long)period_us);
+}
+
+static void shell_cmd_BITRATE(uint32_t argc, char *argv[])
+{
+#if (DATARATE_ENABLE)
+    /* The adaptation owns the data phase and would write its own setting
+     * back on its next poll */
+    CY_UNUSED_PARAMETER(argc);
+    printf("%s: the data rate adaptation sets the bit rate, build with "
+           "DATARATE_ENABLE=0 to set it here\r\n", argv[0]);
+#else
+    cy_stc_canfd_bitrate_t nominal = *shell_config->bitrate;
+    cy_stc_canfd_bitrate_t data = *shell_config->fastBitrate;
+    uint32_t nominal_div;
+    uint32_t data_div;
+
+    /* The prescaler fields hold the divider minus one */
+    if ((3U != argc) || !shell_parse_u32(argv[1], &nominal_div) ||
+        !shell_parse_u32(argv[2], &data_div) ||
+        (nominal_div < 1U) || (nominal_div > 512U) ||
+        (data_div < 1U) || (data_div > 32U))
+    {
+        shell_usage(argv[0]);
+        printf("configured: nominal div %u, data div %u\r\n",
+               nominal.prescaler + 1U, data.prescaler + 1U);
+        return;
+    }
+
+    nominal.prescaler = (uint16_t)(nominal_div - 1U);
+    data.prescaler = (uint16_t)(data_div - 1U);
+
+    (void)Cy_CANFD_ConfigChangesEnable(shell_base, shell_chan);
+    Cy_CANFD_SetBitrate(shell_base, shell_chan, &nominal);
+    Cy_CANFD_SetFastBitrate(shell_base, shell_chan, &data);
+    (void)Cy_CANFD_ConfigChangesDisable(shell_base, shell_chan);
+
+    /* The time segments are kept, so the bit rate scales with 1/divider */
+    printf("bit rate: nominal x%lu/%lu, data x%lu/%lu of the configured\r\n",
+           (unsigned long)(shell_config->bitrate->prescaler + 1U),
+           (unsigned long)nominal_div,
+           (unsigned long)(shell_config->fastBitrate->prescaler + 1U),
+           (unsigned long)data_div);
+#endif /* DATARATE_ENABLE */
+}
+
+static void shell_cmd_TRACE(uint32_t argc, char *argv[])
+{
+    CY_UNUSED_PARAMETER(argc);
+    CY_UNUSED_PARAMETER(argv);
+
+    trace_dump();
+    trace_init();
+}
+
+static void shell_cmd_CPU(uint32_t argc, char *argv[])
+{
+    uint32_t primask = __get_PRIMASK();
+    uint64_t isr;
+    uint64_t busy;
+
+    CY_UNUSED_PARAMETER(argc);
+    CY_UNUSED_PARAMETER(argv);
+
+    __disable_irq();
+    isr = shell_isr_cycles;
+    shell_isr_cycles = 0U;
+    __set_PRIMASK(primask);
+
+    if (0U == shell_elapsed)
+    {
+        return;
+    }
+
+    /* In hundredths of a percent of the time the CPU was awake */
+    busy = ((isr + shell_cmd_cycles) * 10000U) / shell_elapsed;
+    printf("SHELL: %lu us awake: interrupt %lu us, commands %lu us, "
+           "generator %lu us; shell load %lu.%02lu%%\r\n",
+           (unsigned long)SHELL_CYCLES_TO_US(shell_elapsed),
+           (unsigned long)SHELL_CYCLES_TO_US(isr),
+           (unsigned long)SHELL_CYCLES_TO_US(shell_cmd_cycles),
+           (unsigned long)SHELL_CYCLES_TO_US(shell_gen_cycles),
+           (unsigned long)(busy / 100U), (unsigned long)(busy % 100U));
+
+    shell_cmd_cycles = 0U;
+    shell_gen_cycles = 0U;
+    shell_elapsed = 0U;
+}
+
+static void shell_cmd_LOG(uint32_t argc, char *argv[])
+{
+    static flog_cursor_t cursor;
+    flog_record_t record;
+    flog_stats_t stats;
+    uint32_t ts;
+    uint32_t count = SHELL_LOG_COUNT;
+
+    if ((argc > 3U) || ((argc >= 2U) && !shell_parse_u32(argv[1], &ts)) ||
+        ((argc == 3U) && !shell_parse_u32(argv[2], &count)))
+    {
+        shell_usage(argv[0]);
+        return;
+    }
+
+    if (1U == argc)
+    {
+        flog_get_stats(&stats);
+        printf("LOG: %lu records, %lu dropped, %lu sectors used, "
+               "%lu erases, %lu damaged pages at mount\r\n",
+               (unsigned long)stats.records, (unsigned long)stats.dropped,
+               (unsigned long)stats.sectors_used, (unsigned long)stats.erases,
+               (unsigned long)stats.torn_pages);
+        return;
+    }
+
+    if (!flog_seek(ts, &cursor))
+    {
+        printf("log: no record at or after %lu ms\r\n", (unsigned long)ts);
+        return;
+    }
+    while ((0U != count) && flog_next(&cursor, &record))
+    {
+        printf("%10lu %08lx %02x [%u]", (unsigned long)record.ts,
+               (unsigned long)record.id, (unsigned int)record.flags,
+               (unsigned int)record.len);
+        for (uint32_t idx = 0U; idx < record.len; idx++)
+        {
+            printf(" %02x", (unsigned int)record.data[idx]);
+        }
+        printf("\r\n");
+        count--;
+    }
+}
+
+static void shell_cmd_HOPTRACE(uint32_t argc, char *argv[])
+{
+    uint32_t id;
+    uint32_t mask = 0x7FFU;
+    bool on;
+
+    if ((argc < 3U) || (argc > 4U) || !shell_parse_u32(argv[1], &id) ||
+        ((4U == argc) && !shell_parse_u32(argv[2], &mask)) ||
+        (id > 0x7FFU) || (mask > 0x7FFU))
+    {
+        shell_usage(argv[0]);
+        return;
+    }
+
+    on = (0 == strcmp(argv[argc - 1U], "on"));
+    if (!on && (0 != strcmp(argv[argc - 1U], "off")))
+    {
+        shell_usage(argv[0]);
+        return;
+    }
+
+    /* The other nodes must switch the same IDs */
+    hoptrace_enable(id, mask, on);
+    printf("hoptrace: id 0x%03lx mask 0x%03lx %s\r\n", (unsigned long)id,
+           (unsigned long)mask, on ? "on" : "off");
+}
+
+static void shell_cmd_ADCLOAD(uint32_t argc, char *argv[])
+{
+    uint32_t load_pct;
+
+    if ((2U != argc) || !shell_parse_u32(argv[1], &load_pct) ||
+        (0U == load_pct) || (load_pct > 100U))
+    {
+        shell_usage(argv[0]);
+        return;
+    }
+
+    adcstream_can_set_load(load_pct);
+    printf("adcload: %lu%%\r\n", (unsigned long)load_pct);
+}
+#endif /* SHELL_ENABLE */
+
+/*******************************************************************************
+* Function Name: shell_init
+********************************************************************************
+* Summary:
+* Enables the UART RX interrupt and prints the prompt.
+*
+* Parameters:
+*  base         CAN FD block
+*  chan         CAN FD channel, initialized
+*  config       Channel configuration, the base of the bitrate command
+*  context      Channel context
+*  send         Frame transmit function of the traffic generator
+*
+*******************************************************************************/
+void shell_init(CANFD_Type *base, uint32_t chan,
+                const cy_stc_canfd_config_t *config,
+                cy_stc_canfd_context_t *context, shell_send_fn_t send)
+{
+#if (SHELL_ENABLE)
+    shell_base = base;
+    shell_chan = chan;
+    shell_config = config;
+    shell_context = context;
+    shell_send = send;
+
+    cycle_counter_init();
+    shell_last_poll = cycle_counter_get();
+
+    (void)Cy_SysInt_Init(&shell_irq_cfg, shell_isr);
+    NVIC_ClearPendingIRQ(shell_irq_cfg.intrSrc);
+    NVIC_EnableIRQ(shell_irq_cfg.intrSrc);
+    Cy_SCB_ClearRxInterrupt(DEBUG_UART_HW, CY_SCB_RX_INTR_NOT_EMPTY);
+    Cy_SCB_SetRxInterruptMask(DEBUG_UART_HW, CY_SCB_RX_INTR_NOT_EMPTY);
+
+    printf("Shell ready, type help\r\n> ");
+#else
+    CY_UNUSED_PARAMETER(base);
+    CY_UNUSED_PARAMETER(chan);
+    CY_UNUSED_PARAMETER(config);
+    CY_UNUSED_PARAMETER(context);
+    CY_UNUSED_PARAMETER(send);
+#endif /* SHELL_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: shell_poll
+********************************************************************************
+* Summary:
+* Called from the main loop. Echoes the received characters and runs at most
+* one complete command line per call, so a burst of input never holds up
+* the other work of the loop. Also runs the traffic generator.
+*
+*******************************************************************************/
+void shell_poll(void)
+{
+#if (SHELL_ENABLE)
+    uint32_t start = cycle_counter_get();
+    uint32_t gen_start;
+
+    shell_elapsed += start - shell_last_poll;
+    shell_last_poll = start;
+
+    while (shell_rx_tail != shell_rx_head)
+    {
+        char ch = (char)shell_rx[shell_rx_tail];
+
+        shell_rx_tail = (shell_rx_tail + 1U) % SHELL_RX_SIZE;
+
+        if (('\r' == ch) || ('\n' == ch))
+        {
+            if (0U == shell_line_len)
+            {
+                continue;
+            }
+            printf("\r\n");
+            shell_line[shell_line_len] = '\0';
+            shell_line_len = 0U;
+            shell_execute(shell_line);
+            printf("> ");
+            break;
+        }
+        else if ((('\b' == ch) || ('\x7F' == ch)) && (0U != shell_line_len))
+        {
+            shell_line_len--;
+            printf("\b \b");
+        }
+        else if ((ch >= ' ') && (ch < '\x7F') &&
+                 (shell_line_len < (SHELL_LINE_SIZE - 1U)))
+        {
+            shell_line[shell_line_len++] = ch;
+            (void)putchar(ch);
+        }
+    }
+    (void)fflush(stdout);
+
+    gen_start = cycle_counter_get();
+    shell_gen_poll();
+    shell_last_poll = cycle_counter_get();
+
+    shell_cmd_cycles += gen_start - start;
+    shell_gen_cycles += shell_last_poll - gen_start;
+    shell_elapsed += shell_last_poll - start;
+#endif /* SHELL_ENABLE */
+}
+
+/* [] END OF FILE */
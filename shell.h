@@ -0,0 +1,103 @@
+/******************************************************************************
+* File Name:   shell.h
+*
+* Description: This file contains the interface of the command shell on the
+*              debug UART.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef SHELL_H_
+#define SHELL_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "canfd_frame.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make SHELL_ENABLE=1") to accept commands on the
+ * debug UART */
+#ifndef SHELL_ENABLE
+#define SHELL_ENABLE            (0)
+#endif
+
+/* Characters buffered between the UART interrupt and the main loop. Input
+ * beyond this while a command runs is dropped and counted. */
+#ifndef SHELL_RX_SIZE
+#define SHELL_RX_SIZE           (64U)
+#endif
+
+/* Longest command line, including the terminating zero */
+#ifndef SHELL_LINE_SIZE
+#define SHELL_LINE_SIZE         (64U)
+#endif
+
+/* Most words on a command line, including the command */
+#define SHELL_ARGS_MAX          (6U)
+
+/* Priority of the UART RX interrupt, below the CAN FD and GPIO interrupts */
+#define SHELL_INTR_PRIORITY     (3U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Sends one frame; returns false if the controller cannot take it now */
+typedef bool (*shell_send_fn_t)(const canfd_frame_t *frame);
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void shell_init(CANFD_Type *base, uint32_t chan,
+                const cy_stc_canfd_config_t *config,
+                cy_stc_canfd_context_t *context, shell_send_fn_t send);
+void shell_poll(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SHELL_H_ */
+
+/* [] END OF FILE */
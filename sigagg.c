@@ -0,0 +1,258 @@
+/******************************************************************************
+* File Name:   sigagg.c
+*
+* Description: This file contains the running minimum, maximum, mean and
+*              variance of a signal over a time window, and the summary frame
+*              that carries them.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+#include "sigagg.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SIGAGG_SAMPLE_MIN       (-32768L)
+#define SIGAGG_SAMPLE_MAX       (32767L)
+
+/*******************************************************************************
+* Function Name: sigagg_put_u16
+********************************************************************************
+* Summary:
+* Writes a 16-bit value, little endian.
+*
+*******************************************************************************/
+static void sigagg_put_u16(uint8_t *data, uint32_t value)
+{
+    data[0] = (uint8_t)value;
+    data[1] = (uint8_t)(value >> 8U);
+}
+
+/*******************************************************************************
+* Function Name: sigagg_get_u16
+********************************************************************************
+* Summary:
+* Reads a 16-bit value, little endian.
+*
+*******************************************************************************/
+static uint32_t sigagg_get_u16(const uint8_t *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8U);
+}
+
+/*******************************************************************************
+* Function Name: sigagg_put_float
+********************************************************************************
+* Summary:
+* Writes a single precision value, little endian.
+*
+*******************************************************************************/
+static void sigagg_put_float(uint8_t *data, float value)
+{
+    uint32_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    sigagg_put_u16(data, bits);
+    sigagg_put_u16(&data[2], bits >> 16U);
+}
+
+/*******************************************************************************
+* Function Name: sigagg_get_float
+********************************************************************************
+* Summary:
+* Reads a single precision value, little endian.
+*
+*******************************************************************************/
+static float sigagg_get_float(const uint8_t *data)
+{
+    uint32_t bits = sigagg_get_u16(data) | (sigagg_get_u16(&data[2]) << 16U);
+    float value;
+
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/*******************************************************************************
+* Function Name: sigagg_reset
+********************************************************************************
+* Summary:
+* Starts a new window.
+*
+*******************************************************************************/
+void sigagg_reset(sigagg_acc_t *acc)
+{
+    memset(acc, 0, sizeof(*acc));
+    acc->min = SIGAGG_SAMPLE_MAX;
+    acc->max = SIGAGG_SAMPLE_MIN;
+}
+
+/*******************************************************************************
+* Function Name: sigagg_add
+********************************************************************************
+* Summary:
+* Adds a sample to the window: a compare for the minimum and the maximum,
+* and two additions and a multiplication for the sums, whatever the number
+* of samples. Samples outside the 16-bit range are clamped.
+*
+* Parameters:
+*  acc          Window
+*  sample       Sample
+*
+* Return:
+*  true once the window holds SIGAGG_COUNT_MAX samples and must be closed
+*
+*******************************************************************************/
+bool sigagg_add(sigagg_acc_t *acc, int32_t sample)
+{
+    if (sample > SIGAGG_SAMPLE_MAX)
+    {
+        sample = SIGAGG_SAMPLE_MAX;
+        acc->flags |= SIGAGG_FLAG_CLAMPED;
+    }
+    else if (sample < SIGAGG_SAMPLE_MIN)
+    {
+        sample = SIGAGG_SAMPLE_MIN;
+        acc->flags |= SIGAGG_FLAG_CLAMPED;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    if (acc->count >= SIGAGG_COUNT_MAX)
+    {
+        return true;
+    }
+    acc->count++;
+    acc->min = (sample < acc->min) ? sample : acc->min;
+    acc->max = (sample > acc->max) ? sample : acc->max;
+    acc->sum += sample;
+    acc->sum_sq += (uint64_t)((int64_t)sample * sample);
+    if (acc->count >= SIGAGG_COUNT_MAX)
+    {
+        acc->flags |= SIGAGG_FLAG_FULL;
+        return true;
+    }
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: sigagg_summarize
+********************************************************************************
+* Summary:
+* Computes the summary of a window. The sum of squared deviations,
+* count * sum_sq - sum^2, is taken in exact integers before the one
+* division, so that a large mean with small variations keeps its variance,
+* which single precision running sums would lose.
+*
+* Parameters:
+*  acc          Window
+*  seq          Window number
+*  summary      Set to the summary
+*
+* Return:
+*  false if the window has no samples
+*
+*******************************************************************************/
+bool sigagg_summarize(const sigagg_acc_t *acc, uint8_t seq,
+                      sigagg_summary_t *summary)
+{
+    uint64_t squares;
+    uint64_t count = acc->count;
+
+    if (0U == acc->count)
+    {
+        return false;
+    }
+
+    summary->count = (uint16_t)acc->count;
+    summary->min = (int16_t)acc->min;
+    summary->max = (int16_t)acc->max;
+    summary->mean = (float)acc->sum / (float)acc->count;
+    summary->seq = seq;
+    summary->flags = acc->flags;
+
+    /* n * sum_sq - sum^2, both below 2^62 */
+    squares = (count * acc->sum_sq) -
+              (uint64_t)(acc->sum * acc->sum);
+    summary->variance = (count < 2U) ? 0.0f :
+                        ((float)squares / ((float)count * (float)(count - 1U)));
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: sigagg_pack
+********************************************************************************
+* Summary:
+* Writes a summary as the SIGAGG_SUMMARY_LEN bytes of its frame.
+*
+*******************************************************************************/
+void sigagg_pack(const sigagg_summary_t *summary, uint8_t *data)
+{
+    sigagg_put_u16(&data[0], summary->count);
+    sigagg_put_u16(&data[2], (uint16_t)summary->min);
+    sigagg_put_u16(&data[4], (uint16_t)summary->max);
+    sigagg_put_float(&data[6], summary->mean);
+    sigagg_put_float(&data[10], summary->variance);
+    data[14] = summary->seq;
+    data[15] = summary->flags;
+}
+
+/*******************************************************************************
+* Function Name: sigagg_unpack
+********************************************************************************
+* Summary:
+* Reads a summary from the payload of its frame.
+*
+*******************************************************************************/
+void sigagg_unpack(const uint8_t *data, sigagg_summary_t *summary)
+{
+    summary->count = (uint16_t)sigagg_get_u16(&data[0]);
+    summary->min = (int16_t)sigagg_get_u16(&data[2]);
+    summary->max = (int16_t)sigagg_get_u16(&data[4]);
+    summary->mean = sigagg_get_float(&data[6]);
+    summary->variance = sigagg_get_float(&data[10]);
+    summary->seq = data[14];
+    summary->flags = data[15];
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,128 @@
+/******************************************************************************
+* File Name:   sigagg.h
+*
+* Description: This file contains the running minimum, maximum, mean and
+*              variance of a signal over a time window, and the summary frame
+*              that carries them.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef SIGAGG_H_
+#define SIGAGG_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* Only the C library, so that host/ can build the simulator */
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make SIGAGG_ENABLE=1") to send the signals of
+ * SIGAGG_CAN_SIGNAL_LIST as one summary per window instead of every sample */
+#ifndef SIGAGG_ENABLE
+#define SIGAGG_ENABLE           (0)
+#endif
+
+/* A window closes early at this many samples, the most a summary counts */
+#define SIGAGG_COUNT_MAX        (0xFFFFU)
+
+/* Summary payload, little endian:
+ *   0  count       samples in the window (16 bits)
+ *   2  min         smallest sample (signed 16 bits)
+ *   4  max         largest sample (signed 16 bits)
+ *   6  mean        IEEE 754 single precision
+ *   10 variance    IEEE 754 single precision, sample variance (n - 1)
+ *   14 seq         window number, counts up per signal
+ *   15 flags       SIGAGG_FLAG_xxx */
+#define SIGAGG_SUMMARY_LEN      (16U)
+
+/* The window closed at SIGAGG_COUNT_MAX samples, before its time */
+#define SIGAGG_FLAG_FULL        (0x01U)
+/* Samples outside the 16-bit range were clamped */
+#define SIGAGG_FLAG_CLAMPED     (0x02U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Running sums of a window. The sums are exact: 16-bit samples, at most
+ * SIGAGG_COUNT_MAX of them, keep count * sum_sq below 2^62. */
+typedef struct
+{
+    uint32_t count;
+    int32_t  min;
+    int32_t  max;
+    int64_t  sum;
+    uint64_t sum_sq;
+    uint8_t  flags;
+} sigagg_acc_t;
+
+typedef struct
+{
+    uint16_t count;
+    int16_t  min;
+    int16_t  max;
+    float    mean;
+    float    variance;
+    uint8_t  seq;
+    uint8_t  flags;
+} sigagg_summary_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void sigagg_reset(sigagg_acc_t *acc);
+bool sigagg_add(sigagg_acc_t *acc, int32_t sample);
+bool sigagg_summarize(const sigagg_acc_t *acc, uint8_t seq,
+                      sigagg_summary_t *summary);
+void sigagg_pack(const sigagg_summary_t *summary, uint8_t *data);
+void sigagg_unpack(const uint8_t *data, sigagg_summary_t *summary);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SIGAGG_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,346 @@
+/******************************************************************************
+* File Name:   sigagg_can.c
+*
+* Description: This file contains the windows of the aggregated signals of the
+*              node and the summary frames sent in place of their samples.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "sigagg_can.h"
+#include "stats.h"
+
+#if (SIGAGG_ENABLE)
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    sigagg_acc_t     acc;
+    uint32_t         start_ms;
+    uint8_t          seq;
+    bool             pending;       /* Summary closed, not sent yet */
+    sigagg_summary_t summary;
+    uint32_t         samples;
+    uint32_t         sent;
+    uint32_t         lost;          /* Summaries replaced before their TX */
+} sigagg_can_state_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+#define SIGAGG_CAN_WINDOW(name, window_ms)    (window_ms),
+static const uint32_t sigagg_can_window_ms[SIGAGG_CAN_SIGNAL_COUNT] =
+{
+    SIGAGG_CAN_SIGNAL_LIST(SIGAGG_CAN_WINDOW)
+};
+#undef SIGAGG_CAN_WINDOW
+
+#define SIGAGG_CAN_NAME(name, window_ms)    #name,
+static const char *const sigagg_can_names[SIGAGG_CAN_SIGNAL_COUNT] =
+{
+    SIGAGG_CAN_SIGNAL_LIST(SIGAGG_CAN_NAME)
+};
+#undef SIGAGG_CAN_NAME
+
+static sigagg_can_send_fn_t sigagg_can_send;
+static uint8_t              sigagg_can_node;
+static bool                 sigagg_can_running;
+static sigagg_can_state_t   sigagg_can_states[SIGAGG_CAN_SIGNAL_COUNT];
+
+/* Last summary received per node and signal */
+static sigagg_summary_t     sigagg_can_rx[SIGAGG_CAN_NODE_MAX]
+                                         [SIGAGG_CAN_SIGNAL_MAX];
+static bool                 sigagg_can_rx_valid[SIGAGG_CAN_NODE_MAX]
+                                               [SIGAGG_CAN_SIGNAL_MAX];
+static uint32_t             sigagg_can_received;
+
+/*******************************************************************************
+* Function Name: sigagg_can_close
+********************************************************************************
+* Summary:
+* Closes the window of a signal, keeps its summary for the TX and opens the
+* next window.
+*
+*******************************************************************************/
+static void sigagg_can_close(sigagg_can_state_t *state, uint32_t now_ms)
+{
+    sigagg_summary_t summary;
+
+    if (sigagg_summarize(&state->acc, state->seq, &summary))
+    {
+        if (state->pending)
+        {
+            state->lost++;
+            STATS_INC(SIGAGG_LOST);
+        }
+        state->summary = summary;
+        state->pending = true;
+        state->seq++;
+    }
+    sigagg_reset(&state->acc);
+    state->start_ms = now_ms;
+}
+
+/*******************************************************************************
+* Function Name: sigagg_can_send_summary
+********************************************************************************
+* Summary:
+* Sends the summary of a signal. It goes out as an FD frame with bit rate
+* switching unless the frame format choice picks a faster one.
+*
+*******************************************************************************/
+static bool sigagg_can_send_summary(uint32_t signal,
+                                    const sigagg_summary_t *summary)
+{
+    canfd_frame_t frame;
+
+    memset(&frame, 0, sizeof(frame));
+    frame.id = SIGAGG_CAN_ID_BASE +
+               ((uint32_t)(sigagg_can_node - 1U) * SIGAGG_CAN_SIGNAL_MAX) +
+               signal;
+    frame.len = SIGAGG_SUMMARY_LEN;
+    frame.flags = CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS;
+    sigagg_pack(summary, frame.data);
+    return sigagg_can_send(&frame);
+}
+#endif /* SIGAGG_ENABLE */
+
+/*******************************************************************************
+* Function Name: sigagg_can_init
+********************************************************************************
+* Summary:
+* Opens the first window of every signal.
+*
+* Parameters:
+*  node         Node number, from 1 to SIGAGG_CAN_NODE_MAX
+*  send         Sends a frame through the application TX buffer
+*  now_ms       Current time
+*
+*******************************************************************************/
+void sigagg_can_init(uint8_t node, sigagg_can_send_fn_t send,
+                     uint32_t now_ms)
+{
+#if (SIGAGG_ENABLE)
+    if ((node < 1U) || (node > SIGAGG_CAN_NODE_MAX) ||
+        (SIGAGG_CAN_SIGNAL_COUNT > SIGAGG_CAN_SIGNAL_MAX))
+    {
+        printf("Aggregation: node %u or signal count out of range, off\r\n",
+               (unsigned)node);
+        return;
+    }
+
+    sigagg_can_node = node;
+    sigagg_can_send = send;
+    memset(sigagg_can_states, 0, sizeof(sigagg_can_states));
+    for (uint32_t signal = 0U; signal < SIGAGG_CAN_SIGNAL_COUNT; signal++)
+    {
+        sigagg_reset(&sigagg_can_states[signal].acc);
+        sigagg_can_states[signal].start_ms = now_ms;
+    }
+    sigagg_can_running = true;
+#else
+    CY_UNUSED_PARAMETER(node);
+    CY_UNUSED_PARAMETER(send);
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* SIGAGG_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: sigagg_can_add
+********************************************************************************
+* Summary:
+* Adds a sample of a signal to its window. The cost does not depend on the
+* number of samples. A window full before its time is closed by the next
+* sigagg_can_poll(). Called by the main loop.
+*
+* Parameters:
+*  signal       Signal
+*  sample       Sample, clamped to 16 bits
+*
+*******************************************************************************/
+void sigagg_can_add(sigagg_can_signal_t signal, int32_t sample)
+{
+#if (SIGAGG_ENABLE)
+    if (sigagg_can_running && (signal < SIGAGG_CAN_SIGNAL_COUNT))
+    {
+        (void)sigagg_add(&sigagg_can_states[signal].acc, sample);
+        sigagg_can_states[signal].samples++;
+    }
+#else
+    CY_UNUSED_PARAMETER(signal);
+    CY_UNUSED_PARAMETER(sample);
+#endif /* SIGAGG_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: sigagg_can_poll
+********************************************************************************
+* Summary:
+* Closes the windows whose time is up or that are full, and sends the
+* summaries. A summary the TX buffer could not take is sent again by the
+* next call; one not sent before the next window closes is replaced and
+* counted as lost. Called by the main loop.
+*
+* Parameters:
+*  now_ms       Current time
+*
+*******************************************************************************/
+void sigagg_can_poll(uint32_t now_ms)
+{
+#if (SIGAGG_ENABLE)
+    if (!sigagg_can_running)
+    {
+        return;
+    }
+
+    for (uint32_t signal = 0U; signal < SIGAGG_CAN_SIGNAL_COUNT; signal++)
+    {
+        sigagg_can_state_t *state = &sigagg_can_states[signal];
+
+        if (((uint32_t)(now_ms - state->start_ms) >=
+             sigagg_can_window_ms[signal]) ||
+            (state->acc.count >= SIGAGG_COUNT_MAX))
+        {
+            sigagg_can_close(state, now_ms);
+        }
+        if (state->pending &&
+            sigagg_can_send_summary(signal, &state->summary))
+        {
+            state->pending = false;
+            state->sent++;
+            STATS_INC(SIGAGG_SENT);
+        }
+    }
+#else
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* SIGAGG_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: sigagg_can_on_frame
+********************************************************************************
+* Summary:
+* Keeps the summaries sent by the other nodes.
+*
+* Parameters:
+*  frame        Received frame
+*
+*******************************************************************************/
+void sigagg_can_on_frame(const canfd_frame_t *frame)
+{
+#if (SIGAGG_ENABLE)
+    uint32_t index = frame->id - SIGAGG_CAN_ID_BASE;
+    uint32_t node = index / SIGAGG_CAN_SIGNAL_MAX;
+    uint32_t signal = index % SIGAGG_CAN_SIGNAL_MAX;
+
+    if ((!sigagg_can_running) || (frame->id < SIGAGG_CAN_ID_BASE) ||
+        (node >= SIGAGG_CAN_NODE_MAX) || (SIGAGG_SUMMARY_LEN != frame->len))
+    {
+        return;
+    }
+    sigagg_unpack(frame->data, &sigagg_can_rx[node][signal]);
+    sigagg_can_rx_valid[node][signal] = true;
+    sigagg_can_received++;
+#else
+    CY_UNUSED_PARAMETER(frame);
+#endif /* SIGAGG_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: sigagg_can_report
+********************************************************************************
+* Summary:
+* Prints the samples and summaries of every signal of this node, and the
+* last summaries received from the other nodes.
+*
+*******************************************************************************/
+void sigagg_can_report(void)
+{
+#if (SIGAGG_ENABLE)
+    if (!sigagg_can_running)
+    {
+        return;
+    }
+
+    printf("Aggregation: %lu summaries received\r\n",
+           (unsigned long)sigagg_can_received);
+    for (uint32_t signal = 0U; signal < SIGAGG_CAN_SIGNAL_COUNT; signal++)
+    {
+        const sigagg_can_state_t *state = &sigagg_can_states[signal];
+
+        printf("  %-10s %lu ms: %lu samples in %lu summaries, %lu lost\r\n",
+               sigagg_can_names[signal],
+               (unsigned long)sigagg_can_window_ms[signal],
+               (unsigned long)state->samples, (unsigned long)state->sent,
+               (unsigned long)state->lost);
+    }
+    for (uint32_t node = 0U; node < SIGAGG_CAN_NODE_MAX; node++)
+    {
+        for (uint32_t signal = 0U; signal < SIGAGG_CAN_SIGNAL_MAX; signal++)
+        {
+            const sigagg_summary_t *summary = &sigagg_can_rx[node][signal];
+            /* The mean in hundredths, as printf has no floating point */
+            int32_t centi = (int32_t)(summary->mean * 100.0f);
+            uint32_t mag = (uint32_t)((centi < 0) ? -centi : centi);
+
+            if (!sigagg_can_rx_valid[node][signal])
+            {
+                continue;
+            }
+            printf("  node %lu %-10s #%u: n %u min %d max %d "
+                   "mean %s%lu.%02lu var %lu%s\r\n", (unsigned long)(node + 1U),
+                   (signal < SIGAGG_CAN_SIGNAL_COUNT) ?
+                   sigagg_can_names[signal] : "?",
+                   (unsigned)summary->seq, (unsigned)summary->count,
+                   (int)summary->min, (int)summary->max,
+                   (centi < 0) ? "-" : "", (unsigned long)(mag / 100U),
+                   (unsigned long)(mag % 100U),
+                   (unsigned long)summary->variance,
+                   (0U != (summary->flags & SIGAGG_FLAG_CLAMPED)) ?
+                   " clamped" : "");
+        }
+    }
+#endif /* SIGAGG_ENABLE */
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,105 @@
+/******************************************************************************
+* File Name:   sigagg_can.h
+*
+* Description: This file contains the windows of the aggregated signals of the
+*              node and the summary frames sent in place of their samples.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef SIGAGG_CAN_H_
+#define SIGAGG_CAN_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "canfd_frame.h"
+#include "sigagg.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Aggregated signals: X(identifier, window in ms). The application adds the
+ * samples with sigagg_can_add(SIGAGG_CAN_SIGNAL_<identifier>, value), and
+ * one summary frame per window goes on the bus in their place. The demo
+ * signals are the time of a main loop pass in us and the frames each pass
+ * dispatched. */
+#define SIGAGG_CAN_SIGNAL_LIST(X)                                              \
+    X(LOOP_US,      100U)                                                      \
+    X(DISPATCH,     1000U)
+
+/* Summary frames: SIGAGG_CAN_ID_BASE + (node - 1) * SIGAGG_CAN_SIGNAL_MAX +
+ * signal, with a SIGAGG_SUMMARY_LEN byte payload */
+#define SIGAGG_CAN_ID_BASE      (0x0C0U)
+#define SIGAGG_CAN_SIGNAL_MAX   (8U)
+#define SIGAGG_CAN_NODE_MAX     (2U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+#define SIGAGG_CAN_SIGNAL_ENUM(name, window_ms)    SIGAGG_CAN_SIGNAL_##name,
+typedef enum
+{
+    SIGAGG_CAN_SIGNAL_LIST(SIGAGG_CAN_SIGNAL_ENUM)
+    SIGAGG_CAN_SIGNAL_COUNT
+} sigagg_can_signal_t;
+#undef SIGAGG_CAN_SIGNAL_ENUM
+
+/* Sends a frame through the application TX buffer */
+typedef bool (*sigagg_can_send_fn_t)(const canfd_frame_t *frame);
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void sigagg_can_init(uint8_t node, sigagg_can_send_fn_t send,
+                     uint32_t now_ms);
+void sigagg_can_add(sigagg_can_signal_t signal, int32_t sample);
+void sigagg_can_poll(uint32_t now_ms);
+void sigagg_can_on_frame(const canfd_frame_t *frame);
+void sigagg_can_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SIGAGG_CAN_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,191 @@
+/******************************************************************************
+* File Name:   stack_monitor.c
+*
+* Description: This file contains the stack painting and high-water
+*              measurement of the main stack.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "stack_monitor.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Bounds of the main stack, which is also used by all interrupt handlers */
+#if defined(__ARMCC_VERSION)
+extern uint32_t Image$$ARM_LIB_STACK$$ZI$$Base;
+extern uint32_t Image$$ARM_LIB_STACK$$ZI$$Limit;
+#define STACK_MONITOR_BOTTOM    (&Image$$ARM_LIB_STACK$$ZI$$Base)
+#define STACK_MONITOR_TOP       (&Image$$ARM_LIB_STACK$$ZI$$Limit)
+#elif defined(__ICCARM__)
+#pragma section = "CSTACK"
+#define STACK_MONITOR_BOTTOM    ((uint32_t *)__section_begin("CSTACK"))
+#define STACK_MONITOR_TOP       ((uint32_t *)__section_end("CSTACK"))
+#else
+extern uint32_t __StackLimit;
+extern uint32_t __StackTop;
+#define STACK_MONITOR_BOTTOM    (&__StackLimit)
+#define STACK_MONITOR_TOP       (&__StackTop)
+#endif
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+#if (STACK_MONITOR_ENABLE)
+/* Lowest stack word found in use by stack_monitor_poll(), and the next word
+ * of its sweep up from the bottom */
+static const uint32_t *stack_monitor_mark;
+static const uint32_t *stack_monitor_cursor;
+#endif /* STACK_MONITOR_ENABLE */
+
+/*******************************************************************************
+* Function Name: stack_monitor_init
+********************************************************************************
+* Summary:
+* Paints the unused part of the main stack with STACK_PAINT_PATTERN. Call it
+* once at start-up; the words below the current stack pointer are free at
+* that point, and interrupts are masked while painting so that no exception
+* frame is overwritten.
+*
+*******************************************************************************/
+void stack_monitor_init(void)
+{
+#if (STACK_MONITOR_ENABLE)
+    uint32_t primask = __get_PRIMASK();
+    uint32_t *word = STACK_MONITOR_BOTTOM;
+
+    __disable_irq();
+    while ((uintptr_t)word < (uintptr_t)__get_MSP())
+    {
+        *word++ = STACK_PAINT_PATTERN;
+    }
+    __set_PRIMASK(primask);
+
+    stack_monitor_mark = STACK_MONITOR_TOP;
+    stack_monitor_cursor = STACK_MONITOR_BOTTOM;
+#endif /* STACK_MONITOR_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: stack_monitor_size
+********************************************************************************
+* Summary:
+* Returns the size of the main stack.
+*
+* Return:
+*  Stack size in bytes
+*
+*******************************************************************************/
+uint32_t stack_monitor_size(void)
+{
+    return (uint32_t)((uintptr_t)STACK_MONITOR_TOP -
+                      (uintptr_t)STACK_MONITOR_BOTTOM);
+}
+
+/*******************************************************************************
+* Function Name: stack_monitor_high_water
+********************************************************************************
+* Summary:
+* Returns the deepest stack use since stack_monitor_init(), found by scanning
+* up from the bottom for the first word that is no longer painted.
+*
+* Return:
+*  Stack high-water mark in bytes, or 0 if the monitor is disabled
+*
+*******************************************************************************/
+uint32_t stack_monitor_high_water(void)
+{
+#if (STACK_MONITOR_ENABLE)
+    const uint32_t *word = STACK_MONITOR_BOTTOM;
+
+    while ((word < STACK_MONITOR_TOP) && (STACK_PAINT_PATTERN == *word))
+    {
+        word++;
+    }
+
+    return (uint32_t)((uintptr_t)STACK_MONITOR_TOP - (uintptr_t)word);
+#else
+    return 0U;
+#endif /* STACK_MONITOR_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: stack_monitor_poll
+********************************************************************************
+* Summary:
+* Prints the stack high-water mark on the debug UART whenever it has grown.
+* Call it from the main loop. Each call checks at most
+* STACK_MONITOR_SCAN_WORDS words of a sweep up from the bottom of the stack.
+* The sweep ends at the first word in use, which is the new mark, or at the
+* last mark, so a call costs the same whatever the stack size and a deeper
+* use shows up within one sweep.
+*
+*******************************************************************************/
+void stack_monitor_poll(void)
+{
+#if (STACK_MONITOR_ENABLE)
+    for (uint32_t count = 0U; count < STACK_MONITOR_SCAN_WORDS; count++)
+    {
+        const uint32_t *word = stack_monitor_cursor;
+
+        if (word >= stack_monitor_mark)
+        {
+            stack_monitor_cursor = STACK_MONITOR_BOTTOM;
+            return;
+        }
+        if (STACK_PAINT_PATTERN != *word)
+        {
+            uint32_t used = (uint32_t)((uintptr_t)STACK_MONITOR_TOP -
+                                       (uintptr_t)word);
+
+            stack_monitor_mark = word;
+            stack_monitor_cursor = STACK_MONITOR_BOTTOM;
+            printf("Stack high-water mark: %lu of %lu bytes\r\n\r\n",
+                   (unsigned long)used, (unsigned long)stack_monitor_size());
+            return;
+        }
+        stack_monitor_cursor = word + 1;
+    }
+#endif /* STACK_MONITOR_ENABLE */
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,87 @@
+/******************************************************************************
+* File Name:   stack_monitor.h
+*
+* Description: This file contains the interface of the run-time stack high-
+*              water monitor.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef STACK_MONITOR_H_
+#define STACK_MONITOR_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make STACK_MONITOR_ENABLE=1") to measure the
+ * stack high-water mark at run time */
+#ifndef STACK_MONITOR_ENABLE
+#define STACK_MONITOR_ENABLE    (0)
+#endif
+
+/* Value written to every unused stack word at start-up */
+#define STACK_PAINT_PATTERN     (0xC5C5C5C5UL)
+
+/* Stack words stack_monitor_poll() checks per call at most */
+#ifndef STACK_MONITOR_SCAN_WORDS
+#define STACK_MONITOR_SCAN_WORDS    (32U)
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void     stack_monitor_init(void);
+uint32_t stack_monitor_size(void);
+uint32_t stack_monitor_high_water(void);
+void     stack_monitor_poll(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* STACK_MONITOR_H_ */
+
+/* [] END OF FILE */
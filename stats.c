@@ -0,0 +1,305 @@
+/******************************************************************************
+* File Name:   stats.c
+*
+* Description: This file contains the registry of the counters, gauges and
+*              peaks of the application, and their export over CAN and the
+*              debug UART.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "stats.h"
+#include "cycle_counter.h"
+
+#if (STATS_ENABLE)
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* The frame header holds indexes and counts in single bytes */
+_Static_assert(STATS_COUNT <= 255, "the registry must fit the frame header");
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    const char      *name;
+    stats_kind_t     kind;
+} stats_info_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+volatile uint32_t stats_values[STATS_COUNT];
+
+#define STATS_INFO(id, kind, name)      { (name), STATS_KIND_##kind },
+static const stats_info_t stats_info[STATS_COUNT] =
+{
+    STATS_LIST(STATS_INFO)
+};
+#undef STATS_INFO
+
+static const char *const stats_kind_names[] =
+{
+    "counter", "gauge", "peak"
+};
+
+static stats_send_fn_t  stats_send;
+static uint32_t         stats_can_id;
+static uint32_t         stats_start_ms;
+static uint32_t         stats_last_ms;
+
+/* Snapshot on its way to the bus, and the index of its next value */
+static uint32_t         stats_shadow[STATS_COUNT];
+static uint32_t         stats_next = STATS_COUNT;
+static uint8_t          stats_seq;
+
+/*******************************************************************************
+* Function Name: stats_take
+********************************************************************************
+* Summary:
+* Copies the registry into the shadow that the frames are sent from. The
+* copy is one word load per entry with interrupts enabled: an interrupt that
+* updates an entry meanwhile is not delayed, and the snapshot gets either
+* the old or the new value of that entry.
+*
+*******************************************************************************/
+static void stats_take(void)
+{
+    uint32_t start = cycle_counter_get();
+
+    stats_snapshot(stats_shadow);
+    STATS_PEAK(SNAPSHOT_CYCLES, cycle_counter_get() - start);
+    STATS_INC(SNAPSHOTS);
+    stats_seq++;
+    stats_next = 0U;
+}
+
+/*******************************************************************************
+* Function Name: stats_send_next
+********************************************************************************
+* Summary:
+* Sends the next frame of the snapshot. A frame the TX buffer cannot take is
+* sent again on the next call.
+*
+*******************************************************************************/
+static void stats_send_next(void)
+{
+    canfd_frame_t frame;
+    uint32_t count = stats_encode(&frame, stats_seq, stats_shadow, stats_next,
+                                  STATS_COUNT);
+
+    frame.id = stats_can_id;
+    if (stats_send(&frame))
+    {
+        stats_next += count;
+    }
+}
+#endif /* STATS_ENABLE */
+
+/*******************************************************************************
+* Function Name: stats_init
+********************************************************************************
+* Summary:
+* Clears the registry and starts the snapshot period.
+*
+* Parameters:
+*  node         Node number, added to STATS_CAN_BASE_ID
+*  send         Sends a frame through the application TX buffer
+*  now_ms       Current time
+*
+*******************************************************************************/
+void stats_init(uint8_t node, stats_send_fn_t send, uint32_t now_ms)
+{
+#if (STATS_ENABLE)
+    for (uint32_t idx = 0U; idx < (uint32_t)STATS_COUNT; idx++)
+    {
+        stats_values[idx] = 0U;
+    }
+    stats_send = send;
+    stats_can_id = STATS_CAN_BASE_ID + node;
+    stats_start_ms = now_ms;
+    stats_last_ms = now_ms;
+#else
+    CY_UNUSED_PARAMETER(node);
+    CY_UNUSED_PARAMETER(send);
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* STATS_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: stats_snapshot
+********************************************************************************
+* Summary:
+* Copies the current values of the registry.
+*
+* Parameters:
+*  values       STATS_COUNT words
+*
+*******************************************************************************/
+void stats_snapshot(uint32_t *values)
+{
+#if (STATS_ENABLE)
+    for (uint32_t idx = 0U; idx < (uint32_t)STATS_COUNT; idx++)
+    {
+        values[idx] = stats_values[idx];
+    }
+#else
+    CY_UNUSED_PARAMETER(values);
+#endif /* STATS_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: stats_encode
+********************************************************************************
+* Summary:
+* Encodes the values of a snapshot from first on into the payload of one
+* frame, as many as fit, and sets its format. The ID is left to the caller.
+*
+* Parameters:
+*  frame        Frame to fill in
+*  seq          Snapshot number
+*  values       Values of the snapshot
+*  first        Index of the first value of the frame
+*  total        Values in the snapshot, at most 255
+*
+* Return:
+*  Values in the frame
+*
+*******************************************************************************/
+uint32_t stats_encode(canfd_frame_t *frame, uint8_t seq,
+                      const uint32_t *values, uint32_t first, uint32_t total)
+{
+    uint32_t count = total - first;
+
+    count = (count > STATS_CAN_VALUES) ? STATS_CAN_VALUES : count;
+
+    memset(frame, 0, sizeof(*frame));
+    frame->flags = CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS;
+    frame->data[0] = seq;
+    frame->data[1] = (uint8_t)first;
+    frame->data[2] = (uint8_t)count;
+    frame->data[3] = (uint8_t)total;
+
+    for (uint32_t idx = 0U; idx < count; idx++)
+    {
+        uint32_t value = values[first + idx];
+        uint8_t *out = &frame->data[STATS_CAN_HEADER_LEN + (idx * 4U)];
+
+        out[0] = (uint8_t)value;
+        out[1] = (uint8_t)(value >> 8U);
+        out[2] = (uint8_t)(value >> 16U);
+        out[3] = (uint8_t)(value >> 24U);
+    }
+
+    /* The length must be one the DLC can code: pad with zeros */
+    frame->len = canfd_dlc_to_len(canfd_len_to_dlc(STATS_CAN_HEADER_LEN +
+                                                   (count * 4U)));
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: stats_poll
+********************************************************************************
+* Summary:
+* Takes a snapshot every STATS_CAN_PERIOD_MS and sends at most one frame of
+* it per call, so a call costs at most one copy of the registry and one
+* frame. A snapshot still going out when the next one is due is finished
+* first, and the one due is skipped and counted. Called by the main loop.
+*
+* Parameters:
+*  now_ms       Current time
+*
+*******************************************************************************/
+void stats_poll(uint32_t now_ms)
+{
+#if (STATS_ENABLE)
+    STATS_SET(UPTIME_MS, now_ms - stats_start_ms);
+
+    if ((now_ms - stats_last_ms) >= STATS_CAN_PERIOD_MS)
+    {
+        stats_last_ms = now_ms;
+        if (stats_next < (uint32_t)STATS_COUNT)
+        {
+            STATS_INC(EXPORT_SKIPPED);
+        }
+        else
+        {
+            stats_take();
+        }
+    }
+
+    if (stats_next < (uint32_t)STATS_COUNT)
+    {
+        stats_send_next();
+    }
+#else
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* STATS_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: stats_report
+********************************************************************************
+* Summary:
+* Prints a snapshot of the registry on the debug UART.
+*
+*******************************************************************************/
+void stats_report(void)
+{
+#if (STATS_ENABLE)
+    uint32_t values[STATS_COUNT];
+
+    stats_snapshot(values);
+    printf("STATS: %u entries, snapshot %u on ID 0x%03lX\r\n",
+           (unsigned int)STATS_COUNT, (unsigned int)stats_seq,
+           (unsigned long)stats_can_id);
+    for (uint32_t idx = 0U; idx < (uint32_t)STATS_COUNT; idx++)
+    {
+        printf("STATS:   %-20s %-7s %lu\r\n", stats_info[idx].name,
+               stats_kind_names[stats_info[idx].kind],
+               (unsigned long)values[idx]);
+    }
+#endif /* STATS_ENABLE */
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,275 @@
+/******************************************************************************
+* File Name:   stats.h
+*
+* Description: This file contains the registry of the counters, gauges and
+*              peaks of the application, and their export over CAN and the
+*              debug UART.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef STATS_H_
+#define STATS_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "canfd_frame.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make STATS_ENABLE=1") to keep the counters of
+ * STATS_LIST and send snapshots of them on the bus */
+#ifndef STATS_ENABLE
+#define STATS_ENABLE            (0)
+#endif
+
+/* Registry: X(identifier, kind, name). A COUNTER counts up, a GAUGE holds
+ * the last value set, a PEAK the largest value seen. Modules add their
+ * entries here and update them with the STATS_xxx() macros below. */
+#define STATS_LIST(X)                                                          \
+    X(RX_FRAMES,        COUNTER,    "rx_frames")                               \
+    X(RX_POOL_FULL,     COUNTER,    "rx_pool_full")                            \
+    X(RX_FIFO_LOST,     COUNTER,    "rx_fifo_lost")                            \
+    X(BUS_ERRORS,       COUNTER,    "bus_errors")                              \
+    X(ISR_CYCLES_MAX,   PEAK,       "isr_cycles_max")                          \
+    X(DISPATCHED,       COUNTER,    "dispatched")                              \
+    X(TX_FRAMES,        COUNTER,    "tx_frames")                               \
+    X(TX_BUSY,          COUNTER,    "tx_busy")                                 \
+    X(TX_FAILED,        COUNTER,    "tx_failed")                               \
+    X(BUTTON_FRAMES,    COUNTER,    "button_frames")                           \
+    X(UPTIME_MS,        GAUGE,      "uptime_ms")                               \
+    X(SNAPSHOTS,        COUNTER,    "snapshots")                               \
+    X(SNAPSHOT_CYCLES,  PEAK,       "snapshot_cycles_max")                     \
+    X(EXPORT_SKIPPED,   COUNTER,    "export_skipped")                          \
+    X(PUBSUB_PUBLISHED, COUNTER,    "pubsub_published")                        \
+    X(PUBSUB_UNMATCHED, COUNTER,    "pubsub_unmatched")                        \
+    X(SEQMON_LOST,      COUNTER,    "seqmon_lost")                             \
+    X(SEQMON_GAPS,      COUNTER,    "seqmon_gaps")                             \
+    X(SEQMON_GAP_MAX,   PEAK,       "seqmon_gap_max")                          \
+    X(REDUND_FAILOVERS, COUNTER,    "redund_failovers")                        \
+    X(NM_PDU_TX,        COUNTER,    "nm_pdu_tx")                               \
+    X(NM_PDU_RX,        COUNTER,    "nm_pdu_rx")                               \
+    X(NM_WAKE_FRAMES,   COUNTER,    "nm_wake_frames")                          \
+    X(NM_FALSE_WAKES,   COUNTER,    "nm_false_wakes")                          \
+    X(RPC_CALLS,        COUNTER,    "rpc_calls")                               \
+    X(RPC_TIMEOUTS,     COUNTER,    "rpc_timeouts")                            \
+    X(RPC_RETRIES,      COUNTER,    "rpc_retries")                             \
+    X(RPC_SERVED,       COUNTER,    "rpc_served")                              \
+    X(SHELL_GEN_SENT,   COUNTER,    "shell_gen_sent")                          \
+    X(SHELL_GEN_BUSY,   COUNTER,    "shell_gen_busy")                          \
+    X(SHELL_RX_DROPPED, COUNTER,    "shell_rx_dropped")                        \
+    X(MSTREAM_RESENT,   COUNTER,    "mstream_resent")                          \
+    X(MSTREAM_GIVEN_UP, COUNTER,    "mstream_given_up")                        \
+    X(MSTREAM_RX_LOST,  COUNTER,    "mstream_rx_lost")                         \
+    X(MSTREAM_MSG_BAD,  COUNTER,    "mstream_msg_bad")                         \
+    X(FLOG_RECORDS,     COUNTER,    "flog_records")                            \
+    X(FLOG_DROPPED,     COUNTER,    "flog_dropped")                            \
+    X(FZIP_RAW_BYTES,   COUNTER,    "fzip_raw_bytes")                          \
+    X(FZIP_WIRE_BYTES,  COUNTER,    "fzip_wire_bytes")                         \
+    X(TTCAN_PROBES,     COUNTER,    "ttcan_probes")                            \
+    X(TTCAN_REARMED,    COUNTER,    "ttcan_rearmed")                           \
+    X(RXDMA_TRANSFERS,  COUNTER,    "rxdma_transfers")                         \
+    X(RXDMA_RING_FULL,  COUNTER,    "rxdma_ring_full")                         \
+    X(RXDMA_BATCH_MAX,  PEAK,       "rxdma_batch_max")                         \
+    X(TXFMT_CHANGED,    COUNTER,    "txfmt_changed")                           \
+    X(TXFMT_REFUSED,    COUNTER,    "txfmt_refused")                           \
+    X(DATARATE_ERRORS,  COUNTER,    "datarate_errors")                         \
+    X(DATARATE_CHANGES, COUNTER,    "datarate_changes")                        \
+    X(HOPTRACE_NO_ROOM, COUNTER,    "hoptrace_no_room")                        \
+    X(HOPTRACE_BAD,     COUNTER,    "hoptrace_bad")                            \
+    X(HOPTRACE_DROPPED, COUNTER,    "hoptrace_dropped")                        \
+    X(SIGAGG_SENT,      COUNTER,    "sigagg_sent")                             \
+    X(SIGAGG_LOST,      COUNTER,    "sigagg_lost")                             \
+    X(DSP_GAPS,         COUNTER,    "dsp_gaps")                                \
+    X(DSP_SKIPPED,      COUNTER,    "dsp_skipped")                             \
+    X(ADCSTREAM_DROPS,  COUNTER,    "adcstream_drops")                         \
+    X(ADCSTREAM_BUSY,   COUNTER,    "adcstream_busy")                          \
+    X(CANCRYPT_BAD_TAG, COUNTER,    "cancrypt_bad_tag")                        \
+    X(CANCRYPT_REPLAYS, COUNTER,    "cancrypt_replays")                        \
+    X(CANCRYPT_UNSENT,  COUNTER,    "cancrypt_unsent")
+
+/* Snapshot frames: ID STATS_CAN_BASE_ID + node, at the lowest priority of
+ * the application. Payload: snapshot number, index of the first value,
+ * values in the frame, values in the registry, then the values as 32-bit
+ * little-endian words. */
+#define STATS_CAN_BASE_ID       (0x700U)
+#define STATS_CAN_HEADER_LEN    (4U)
+#define STATS_CAN_VALUES                                                       \
+    ((CANFD_MAX_DATA_LEN - STATS_CAN_HEADER_LEN) / 4U)
+
+/* Time between two snapshots on the bus */
+#ifndef STATS_CAN_PERIOD_MS
+#define STATS_CAN_PERIOD_MS     (1000U)
+#endif
+
+/* Updates, safe from interrupts and the main loop. A counter or peak is one
+ * load-exclusive and store-exclusive pair, retried if an interrupt came in
+ * between, so no update is lost and no interrupt is masked. */
+#if (STATS_ENABLE)
+#define STATS_INC(id)           stats_add(STATS_##id, 1U)
+#define STATS_ADD(id, n)        stats_add(STATS_##id, (n))
+#define STATS_SET(id, value)    stats_set(STATS_##id, (value))
+#define STATS_PEAK(id, value)   stats_peak(STATS_##id, (value))
+#define STATS_FOLLOW(id, total, last)                                          \
+    stats_follow(STATS_##id, (total), (last))
+#else
+#define STATS_INC(id)
+#define STATS_ADD(id, n)
+#define STATS_SET(id, value)
+#define STATS_PEAK(id, value)
+#define STATS_FOLLOW(id, total, last)
+#endif /* STATS_ENABLE */
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+#define STATS_ENUM(id, kind, name)      STATS_##id,
+typedef enum
+{
+    STATS_LIST(STATS_ENUM)
+    STATS_COUNT
+} stats_id_t;
+#undef STATS_ENUM
+
+typedef enum
+{
+    STATS_KIND_COUNTER,
+    STATS_KIND_GAUGE,
+    STATS_KIND_PEAK
+} stats_kind_t;
+
+/* Sends a frame through the application TX buffer */
+typedef bool (*stats_send_fn_t)(const canfd_frame_t *frame);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+#if (STATS_ENABLE)
+/* Current values, one word each. Use the STATS_xxx() macros to update. */
+extern volatile uint32_t stats_values[STATS_COUNT];
+
+/*******************************************************************************
+* Function Name: stats_add
+********************************************************************************
+* Summary:
+* Adds to a counter atomically.
+*
+*******************************************************************************/
+__STATIC_FORCEINLINE void stats_add(stats_id_t id, uint32_t n)
+{
+    volatile uint32_t *word = &stats_values[id];
+
+    while (0U != __STREXW(__LDREXW(word) + n, word))
+    {
+    }
+}
+
+/*******************************************************************************
+* Function Name: stats_set
+********************************************************************************
+* Summary:
+* Sets a gauge; an aligned word store is atomic.
+*
+*******************************************************************************/
+__STATIC_FORCEINLINE void stats_set(stats_id_t id, uint32_t value)
+{
+    stats_values[id] = value;
+}
+
+/*******************************************************************************
+* Function Name: stats_peak
+********************************************************************************
+* Summary:
+* Raises a peak to a value atomically.
+*
+*******************************************************************************/
+__STATIC_FORCEINLINE void stats_peak(stats_id_t id, uint32_t value)
+{
+    volatile uint32_t *word = &stats_values[id];
+
+    do
+    {
+        if (value <= __LDREXW(word))
+        {
+            __CLREX();
+            return;
+        }
+    } while (0U != __STREXW(value, word));
+}
+
+/*******************************************************************************
+* Function Name: stats_follow
+********************************************************************************
+* Summary:
+* Adds to a counter what a total kept by a module grew by since the last
+* call. For the modules that only use the C library, so that their host
+* simulators build without the registry; their glue calls it from the main
+* loop.
+*
+*******************************************************************************/
+__STATIC_FORCEINLINE void stats_follow(stats_id_t id, uint32_t total,
+                                       uint32_t *last)
+{
+    stats_add(id, total - *last);
+    *last = total;
+}
+#endif /* STATS_ENABLE */
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void stats_init(uint8_t node, stats_send_fn_t send, uint32_t now_ms);
+void stats_snapshot(uint32_t *values);
+uint32_t stats_encode(canfd_frame_t *frame, uint8_t seq,
+                      const uint32_t *values, uint32_t first, uint32_t total);
+void stats_poll(uint32_t now_ms);
+void stats_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* STATS_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,152 @@
+/******************************************************************************
+* File Name:   trace.c
+*
+* Description: This file contains the event tracer buffer and the UART dump
+*              used by the host trace converter.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "trace.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TRACE_EVENT_NAME(name, track, text) { (track), (text) },
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    uint8_t     track;
+    const char *name;
+} trace_event_info_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+#if (TRACE_ENABLE)
+trace_buffer_t trace_buffer;
+
+static const trace_event_info_t trace_event_info[TRACE_EV_COUNT] =
+{
+    TRACE_EVENT_LIST(TRACE_EVENT_NAME)
+};
+#endif /* TRACE_ENABLE */
+
+/*******************************************************************************
+* Function Name: trace_init
+********************************************************************************
+* Summary:
+* Starts the cycle counter and arms the trace buffer for a new capture.
+*
+*******************************************************************************/
+void trace_init(void)
+{
+    cycle_counter_init();
+#if (TRACE_ENABLE)
+    trace_buffer.count = 0U;
+#endif /* TRACE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: trace_poll
+********************************************************************************
+* Summary:
+* Called from the main loop. Once the buffer has no room left for the largest
+* event, dumps it over the debug UART and re-arms it. Dumping happens outside
+* interrupt context only.
+*
+*******************************************************************************/
+void trace_poll(void)
+{
+#if (TRACE_ENABLE)
+    if ((trace_buffer.count + TRACE_RECORDS_MAX) > TRACE_BUFFER_SIZE)
+    {
+        trace_dump();
+        trace_buffer.count = 0U;
+    }
+#endif /* TRACE_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: trace_dump
+********************************************************************************
+* Summary:
+* Prints the captured events as one text block which the host script
+* scripts/trace_to_perfetto.py converts to Chrome trace JSON. The block starts
+* with the CPU clock and the event names, followed by one line per record:
+* timestamp, type, event and argument, all in hex. An 'h' record holds the
+* upper half of the argument of the record after it.
+*
+*******************************************************************************/
+void trace_dump(void)
+{
+#if (TRACE_ENABLE)
+    uint32_t count = trace_buffer.count;
+
+    if (count > TRACE_BUFFER_SIZE)
+    {
+        count = TRACE_BUFFER_SIZE;
+    }
+
+    printf("TRACE BEGIN %lu %lu\r\n", (unsigned long)SystemCoreClock,
+                                      (unsigned long)count);
+
+    for (uint32_t ev = 0U; ev < (uint32_t)TRACE_EV_COUNT; ev++)
+    {
+        printf("TRACE NAME %lu %u %s\r\n", (unsigned long)ev,
+               trace_event_info[ev].track, trace_event_info[ev].name);
+    }
+
+    for (uint32_t idx = 0U; idx < count; idx++)
+    {
+        const trace_record_t *record = &trace_buffer.records[idx];
+        printf("T %08lx %c %02x %04x\r\n", (unsigned long)record->timestamp,
+               (char)record->type, record->event, record->arg);
+    }
+
+    printf("TRACE END\r\n");
+#endif /* TRACE_ENABLE */
+}
+
+/* [] END OF FILE */
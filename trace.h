@@ -0,0 +1,205 @@
+/******************************************************************************
+* File Name:   trace.h
+*
+* Description: This file contains the interface of the event tracer which
+*              records begin, end and instant events with cycle timestamps
+*              into a RAM buffer.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "cycle_counter.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make TRACE_ENABLE=1") to record events */
+#ifndef TRACE_ENABLE
+#define TRACE_ENABLE            (0)
+#endif
+
+/* Number of events held in RAM */
+#ifndef TRACE_BUFFER_SIZE
+#define TRACE_BUFFER_SIZE       (512U)
+#endif
+
+/* Event types, matching the Chrome trace "ph" field on the host side */
+#define TRACE_TYPE_BEGIN        ((uint8_t)'B')
+#define TRACE_TYPE_END          ((uint8_t)'E')
+#define TRACE_TYPE_INSTANT      ((uint8_t)'i')
+
+/* Upper 16 bits of the argument of the record that follows it. Only written
+ * for arguments above 0xFFFF, such as 29-bit extended CAN IDs. */
+#define TRACE_TYPE_ARG_HIGH     ((uint8_t)'h')
+
+/* Records one event can take: the event and the upper half of its argument */
+#define TRACE_RECORDS_MAX       (2U)
+
+/* Timeline tracks. Each track becomes one row in the trace viewer. */
+#define TRACE_TRACK_MAIN        (0U)
+#define TRACE_TRACK_ISR_GPIO    (1U)
+#define TRACE_TRACK_ISR_CANFD   (2U)
+#define TRACE_TRACK_BUS         (3U)
+
+/* List of traced events: X(identifier, track, display name).
+ * The names and tracks are sent with every dump, so the host converter does
+ * not need to be updated when events are added here. */
+#define TRACE_EVENT_LIST(X)                                                    \
+    X(ISR_GPIO,      TRACE_TRACK_ISR_GPIO,  "gpio_interrupt_handler")          \
+    X(ISR_CANFD,     TRACE_TRACK_ISR_CANFD, "isr_canfd")                       \
+    X(RX_CALLBACK,   TRACE_TRACK_ISR_CANFD, "canfd_rx_callback")               \
+    X(MAIN_TX,       TRACE_TRACK_MAIN,      "main_tx")                         \
+    X(DISPATCH,      TRACE_TRACK_MAIN,      "pubsub_dispatch")                 \
+    X(FRAME_RX,      TRACE_TRACK_BUS,       "frame_rx")                        \
+    X(FRAME_TX,      TRACE_TRACK_BUS,       "frame_tx")
+
+#define TRACE_EVENT_ENUM(name, track, text) TRACE_EV_##name,
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Event identifiers */
+typedef enum
+{
+    TRACE_EVENT_LIST(TRACE_EVENT_ENUM)
+    TRACE_EV_COUNT
+} trace_event_t;
+
+/* One recorded event, 8 bytes */
+typedef struct
+{
+    uint32_t timestamp;         /* DWT cycle count */
+    uint8_t  type;              /* TRACE_TYPE_xxx */
+    uint8_t  event;             /* trace_event_t */
+    uint16_t arg;               /* Event specific argument, e.g. CAN ID;
+                                 * upper half in a TRACE_TYPE_ARG_HIGH
+                                 * record before it if above 0xFFFF */
+} trace_record_t;
+
+/* RAM trace buffer. Recording stops when the buffer is full until the main
+ * loop has dumped it, so a dump is always one contiguous capture. */
+typedef struct
+{
+    volatile uint32_t count;
+    trace_record_t    records[TRACE_BUFFER_SIZE];
+} trace_buffer_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern trace_buffer_t trace_buffer;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void trace_init(void);
+void trace_poll(void);
+void trace_dump(void);
+
+/*******************************************************************************
+* Function Name: trace_record
+********************************************************************************
+* Summary:
+* Appends one event to the trace buffer. The slots are reserved and filled
+* with interrupts masked, so nested ISRs never interleave partial records.
+* The cost is a handful of cycles: one counter read, one compare and one
+* 8-byte store. An argument above 0xFFFF takes a second record, written
+* first, that holds its upper half.
+*
+* Parameters:
+*  type     TRACE_TYPE_BEGIN, TRACE_TYPE_END or TRACE_TYPE_INSTANT
+*  event    Event identifier
+*  arg      Event argument
+*
+*******************************************************************************/
+__STATIC_FORCEINLINE void trace_record(uint8_t type, trace_event_t event,
+                                       uint32_t arg)
+{
+    uint32_t records = (arg > 0xFFFFU) ? 2U : 1U;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t index = trace_buffer.count;
+    if ((index + records) <= TRACE_BUFFER_SIZE)
+    {
+        trace_record_t *record = &trace_buffer.records[index];
+        uint32_t timestamp = cycle_counter_get();
+        if (records > 1U)
+        {
+            record->timestamp = timestamp;
+            record->type = TRACE_TYPE_ARG_HIGH;
+            record->event = (uint8_t)event;
+            record->arg = (uint16_t)(arg >> 16U);
+            record++;
+        }
+        record->timestamp = timestamp;
+        record->type = type;
+        record->event = (uint8_t)event;
+        record->arg = (uint16_t)arg;
+        trace_buffer.count = index + records;
+    }
+    __set_PRIMASK(primask);
+}
+
+#if (TRACE_ENABLE)
+#define TRACE_BEGIN(ev)         trace_record(TRACE_TYPE_BEGIN, TRACE_EV_##ev, 0U)
+#define TRACE_END(ev)           trace_record(TRACE_TYPE_END, TRACE_EV_##ev, 0U)
+#define TRACE_INSTANT(ev, arg)  trace_record(TRACE_TYPE_INSTANT, TRACE_EV_##ev, \
+                                             (uint32_t)(arg))
+#else
+#define TRACE_BEGIN(ev)
+#define TRACE_END(ev)
+#define TRACE_INSTANT(ev, arg)
+#endif /* TRACE_ENABLE */
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* TRACE_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,392 @@
+/******************************************************************************
+* File Name:   ttcan.c
+*
+* Description: Time-triggered CAN schedule: validates the system matrix,
+*              compiles the trigger list of a node for the trigger memory, and
+*              computes worst-case frame times.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stddef.h>
+#include "ttcan.h"
+#include "txfmt.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TTCAN_WINDOW_ENTRY(name, kind, start, length, repeat, offset, node,    \
+                           id, len)                                            \
+    [TTCAN_WINDOW_##name] = { #name, (start), (length), (id),                  \
+                              TTCAN_WINDOW_##kind, (repeat), (offset),         \
+                              (node), (len) },
+
+/* Trigger memory element fields */
+#define TTCAN_TM_TIME_MARK_Pos  (16U)
+#define TTCAN_TM_CYCLE_CODE_Pos (8U)
+#define TTCAN_TM_TYPE_Pos       (0U)
+#define TTCAN_TM_BUFFER_Pos     (16U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const ttcan_window_t ttcan_windows[TTCAN_WINDOW_COUNT] =
+{
+    TTCAN_WINDOW_LIST(TTCAN_WINDOW_ENTRY)
+};
+
+const ttcan_matrix_t ttcan_matrix =
+{
+    .windows = ttcan_windows,
+    .count = (uint8_t)TTCAN_WINDOW_COUNT,
+    .cycles = (uint8_t)TTCAN_MATRIX_CYCLES,
+    .cycle_ntu = (uint16_t)TTCAN_CYCLE_NTU
+};
+
+static const char *const ttcan_error_names[] =
+{
+    [TTCAN_OK] = "ok",
+    [TTCAN_ERROR_CYCLES] = "matrix cycles",
+    [TTCAN_ERROR_REPEAT] = "repeat or offset",
+    [TTCAN_ERROR_BOUNDS] = "outside the cycle",
+    [TTCAN_ERROR_LENGTH] = "shorter than its frame",
+    [TTCAN_ERROR_OVERLAP] = "overlaps an earlier window",
+    [TTCAN_ERROR_NODE] = "no sending node",
+    [TTCAN_ERROR_TRIGGERS] = "too many triggers or buffers"
+};
+
+/*******************************************************************************
+* Function Name: ttcan_is_power_of_two
+********************************************************************************
+* Summary:
+* Checks for a power of two from 1 to 64.
+*
+*******************************************************************************/
+static bool ttcan_is_power_of_two(uint32_t value)
+{
+    return (0U != value) && (value <= 64U) &&
+           (0U == (value & (value - 1U)));
+}
+
+/*******************************************************************************
+* Function Name: ttcan_ns_to_ntu
+********************************************************************************
+* Summary:
+* Converts a time to NTU, rounded up.
+*
+*******************************************************************************/
+static uint32_t ttcan_ns_to_ntu(uint32_t ns)
+{
+    return (ns + TTCAN_NTU_NS - 1U) / TTCAN_NTU_NS;
+}
+
+/*******************************************************************************
+* Function Name: ttcan_frame_ns
+********************************************************************************
+* Summary:
+* Returns the longest time a data frame with an 11-bit ID can take on the
+* bus, with the most stuff bits it can have and the intermission after it.
+* CAN FD frames are sent with bit rate switching.
+*
+* Parameters:
+*  len          Payload length
+*  fd           CAN FD frame rather than a classic one
+*
+* Return:
+*  Frame time in ns
+*
+*******************************************************************************/
+uint32_t ttcan_frame_ns(uint8_t len, bool fd)
+{
+    static const txfmt_rates_t rates = { TTCAN_NOMINAL_BPS, TTCAN_DATA_BPS };
+
+    return txfmt_frame_ns(&rates, fd ? TXFMT_FD_BRS : TXFMT_CLASSIC, len,
+                          false);
+}
+
+/*******************************************************************************
+* Function Name: ttcan_share_cycle
+********************************************************************************
+* Summary:
+* Checks whether two windows are open in a common basic cycle. With powers
+* of two, they are when their offsets agree modulo the smaller repeat.
+*
+*******************************************************************************/
+static bool ttcan_share_cycle(const ttcan_window_t *a, const ttcan_window_t *b)
+{
+    uint32_t repeat = (a->repeat < b->repeat) ? a->repeat : b->repeat;
+
+    return ((a->offset % repeat) == (b->offset % repeat));
+}
+
+/*******************************************************************************
+* Function Name: ttcan_validate
+********************************************************************************
+* Summary:
+* Checks a system matrix: the repeats fit the matrix, every window lies
+* between the reference message and the end of the cycle and fits its
+* longest frame started as late as the TX enable window allows, and no two
+* windows open in the same cycle share time.
+*
+* Parameters:
+*  matrix       System matrix
+*  window       Set to the index of the first bad window
+*
+* Return:
+*  TTCAN_OK or the first error found
+*
+*******************************************************************************/
+ttcan_error_t ttcan_validate(const ttcan_matrix_t *matrix, uint32_t *window)
+{
+    uint32_t ref_ntu = ttcan_ns_to_ntu(ttcan_frame_ns(TTCAN_REF_LEN, false)) +
+                       TTCAN_TX_ENABLE_NTU;
+
+    *window = 0U;
+    if (!ttcan_is_power_of_two(matrix->cycles))
+    {
+        return TTCAN_ERROR_CYCLES;
+    }
+    if (matrix->count > TTCAN_WINDOWS_MAX)
+    {
+        return TTCAN_ERROR_TRIGGERS;
+    }
+
+    for (uint32_t idx = 0U; idx < matrix->count; idx++)
+    {
+        const ttcan_window_t *w = &matrix->windows[idx];
+        uint32_t frame_ntu = ttcan_ns_to_ntu(ttcan_frame_ns(w->len, true));
+
+        *window = idx;
+        if ((!ttcan_is_power_of_two(w->repeat)) ||
+            (w->repeat > matrix->cycles) || (w->offset >= w->repeat))
+        {
+            return TTCAN_ERROR_REPEAT;
+        }
+        if ((w->start < ref_ntu) ||
+            (((uint32_t)w->start + w->length) > matrix->cycle_ntu))
+        {
+            return TTCAN_ERROR_BOUNDS;
+        }
+        if (w->length < (frame_ntu + TTCAN_TX_ENABLE_NTU))
+        {
+            return TTCAN_ERROR_LENGTH;
+        }
+        if ((TTCAN_WINDOW_EXCLUSIVE == w->kind) && (0U == w->node))
+        {
+            return TTCAN_ERROR_NODE;
+        }
+
+        for (uint32_t prev = 0U; prev < idx; prev++)
+        {
+            const ttcan_window_t *p = &matrix->windows[prev];
+
+            if (ttcan_share_cycle(w, p) &&
+                (w->start < (p->start + p->length)) &&
+                (p->start < (w->start + w->length)))
+            {
+                return TTCAN_ERROR_OVERLAP;
+            }
+        }
+    }
+
+    return TTCAN_OK;
+}
+
+/*******************************************************************************
+* Function Name: ttcan_add_trigger
+********************************************************************************
+* Summary:
+* Inserts a trigger into the list, which is kept in time mark order.
+*
+*******************************************************************************/
+static bool ttcan_add_trigger(ttcan_schedule_t *schedule, uint32_t time_mark,
+                              uint32_t cycle_code, uint32_t type,
+                              uint32_t buffer)
+{
+    uint32_t pos = schedule->count;
+
+    if (TTCAN_TRIGGERS_MAX == pos)
+    {
+        return false;
+    }
+
+    while ((pos > 0U) &&
+           (schedule->triggers[pos - 1U].time_mark > time_mark))
+    {
+        schedule->triggers[pos] = schedule->triggers[pos - 1U];
+        pos--;
+    }
+
+    schedule->triggers[pos].time_mark = (uint16_t)time_mark;
+    schedule->triggers[pos].cycle_code = (uint8_t)cycle_code;
+    schedule->triggers[pos].type = (uint8_t)type;
+    schedule->triggers[pos].buffer = (uint8_t)buffer;
+    schedule->count++;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: ttcan_compile
+********************************************************************************
+* Summary:
+* Validates a system matrix and compiles the trigger list of one node: a
+* single-shot Tx trigger for each exclusive window of the node, an
+* arbitration trigger on buffer 0 for each arbitrating window, the
+* reference trigger on the time master and a watch trigger after it.
+*
+* Parameters:
+*  matrix       System matrix
+*  node         Node to compile for
+*  schedule     Receives the trigger list
+*
+* Return:
+*  TTCAN_OK or the error that stopped the compiler
+*
+*******************************************************************************/
+ttcan_error_t ttcan_compile(const ttcan_matrix_t *matrix, uint8_t node,
+                            ttcan_schedule_t *schedule)
+{
+    uint32_t window;
+    uint32_t buffer = TTCAN_BUFFER_FIRST;
+    ttcan_error_t error = ttcan_validate(matrix, &window);
+    bool ok = true;
+
+    schedule->count = 0U;
+    schedule->tx_triggers = 0U;
+    schedule->buffers = (uint8_t)TTCAN_BUFFER_FIRST;
+    for (uint32_t idx = 0U; idx < TTCAN_WINDOWS_MAX; idx++)
+    {
+        schedule->window_buffer[idx] = -1;
+    }
+    if (TTCAN_OK != error)
+    {
+        return error;
+    }
+
+    if (TTCAN_MASTER_NODE == node)
+    {
+        ok = ttcan_add_trigger(schedule, matrix->cycle_ntu, 1U,
+                               TTCAN_TRIGGER_TX_REF, TTCAN_BUFFER_REF);
+    }
+    ok = ok && ttcan_add_trigger(schedule,
+                                 (uint32_t)matrix->cycle_ntu + TTCAN_WATCH_NTU,
+                                 1U, TTCAN_TRIGGER_WATCH, 0U);
+
+    for (uint32_t idx = 0U; (idx < matrix->count) && ok; idx++)
+    {
+        const ttcan_window_t *w = &matrix->windows[idx];
+        uint32_t cycle_code = (uint32_t)w->repeat + w->offset;
+
+        if (TTCAN_WINDOW_ARBITRATING == w->kind)
+        {
+            ok = ttcan_add_trigger(schedule, w->start, cycle_code,
+                                   TTCAN_TRIGGER_TX_ARBITRATION,
+                                   TTCAN_BUFFER_EVENT);
+        }
+        else if (node == w->node)
+        {
+            schedule->window_buffer[idx] = (int8_t)buffer;
+            ok = (buffer < TTCAN_BUFFERS_MAX) &&
+                 ttcan_add_trigger(schedule, w->start, cycle_code,
+                                   TTCAN_TRIGGER_TX_SINGLE, buffer);
+            buffer++;
+        }
+        else
+        {
+            continue;
+        }
+
+        schedule->tx_triggers += (uint16_t)(matrix->cycles / w->repeat);
+    }
+
+    schedule->buffers = (uint8_t)buffer;
+
+    return ok ? TTCAN_OK : TTCAN_ERROR_TRIGGERS;
+}
+
+/*******************************************************************************
+* Function Name: ttcan_trigger_encode
+********************************************************************************
+* Summary:
+* Encodes a trigger as the two words of a trigger memory element.
+*
+*******************************************************************************/
+void ttcan_trigger_encode(const ttcan_trigger_t *trigger, uint32_t words[2])
+{
+    words[0] = ((uint32_t)trigger->time_mark << TTCAN_TM_TIME_MARK_Pos) |
+               ((uint32_t)trigger->cycle_code << TTCAN_TM_CYCLE_CODE_Pos) |
+               ((uint32_t)trigger->type << TTCAN_TM_TYPE_Pos);
+    words[1] = (uint32_t)trigger->buffer << TTCAN_TM_BUFFER_Pos;
+}
+
+/*******************************************************************************
+* Function Name: ttcan_error_name
+********************************************************************************
+* Summary:
+* Returns a short description of a validation error.
+*
+*******************************************************************************/
+const char *ttcan_error_name(ttcan_error_t error)
+{
+    return ttcan_error_names[error];
+}
+
+/*******************************************************************************
+* Function Name: ttcan_jitter_add
+********************************************************************************
+* Summary:
+* Adds the deviation of one interval from the period of its stream.
+*
+*******************************************************************************/
+void ttcan_jitter_add(ttcan_jitter_t *jitter, int32_t deviation)
+{
+    if ((0U == jitter->count) || (deviation < jitter->min))
+    {
+        jitter->min = deviation;
+    }
+    if ((0U == jitter->count) || (deviation > jitter->max))
+    {
+        jitter->max = deviation;
+    }
+    jitter->count++;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,239 @@
+/******************************************************************************
+* File Name:   ttcan.h
+*
+* Description: TTCAN system matrix, trigger list and jitter statistics
+*              interface.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef TTCAN_H_
+#define TTCAN_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make TTCAN_ENABLE=1") to run the channel in
+ * TTCAN level 1 with the system matrix below */
+#ifndef TTCAN_ENABLE
+#define TTCAN_ENABLE            (0)
+#endif
+
+/* Network time unit (NTU) in ns. Time marks and windows count NTUs from the
+ * start of the reference message. */
+#define TTCAN_NTU_NS            (1000U)
+
+/* Length of a basic cycle, in NTU. The reference trigger of the time master
+ * sits at this time mark and starts the next cycle. */
+#define TTCAN_CYCLE_NTU         (5000U)
+
+/* Basic cycles in the system matrix: 1, 2, 4, 8, 16, 32 or 64 */
+#define TTCAN_MATRIX_CYCLES     (4U)
+
+/* A frame may start up to this many NTU after its time mark: 1 to 16 */
+#define TTCAN_TX_ENABLE_NTU     (8U)
+
+/* The watch trigger fires if no reference message has started a new cycle
+ * this many NTU after the expected one */
+#define TTCAN_WATCH_NTU         (200U)
+
+/* Bit rates the frame times are computed with. They must match the bit
+ * timing of the channel in the design. */
+#ifndef TTCAN_NOMINAL_BPS
+#define TTCAN_NOMINAL_BPS       (500000UL)
+#endif
+#ifndef TTCAN_DATA_BPS
+#define TTCAN_DATA_BPS          (2000000UL)
+#endif
+
+/* Reference message: a classic frame with the cycle count in its first
+ * byte, sent by the time master */
+#define TTCAN_REF_ID            (0x080U)
+#define TTCAN_REF_LEN           (1U)
+#define TTCAN_MASTER_NODE       (1U)
+
+/* TX buffers. Buffer 0 stays with the event-triggered frames of the
+ * application, which are sent in the arbitrating windows. The exclusive
+ * windows of a node take the buffers after the reference buffer, in list
+ * order. */
+#define TTCAN_BUFFER_EVENT      (0U)
+#define TTCAN_BUFFER_REF        (1U)
+#define TTCAN_BUFFER_FIRST      (2U)
+
+/* Limits of the controller */
+#define TTCAN_TRIGGERS_MAX      (64U)
+#define TTCAN_BUFFERS_MAX       (32U)
+
+/* Windows a system matrix can have */
+#define TTCAN_WINDOWS_MAX       (16U)
+
+/* Window kinds */
+#define TTCAN_WINDOW_EXCLUSIVE      (0U)    /* One frame of one node */
+#define TTCAN_WINDOW_ARBITRATING    (1U)    /* One frame, all nodes compete */
+
+/* System matrix: X(identifier, kind, start, length, repeat, offset, node,
+ * CAN ID, payload length).
+ * start and length are in NTU. A window is open in the basic cycles whose
+ * count modulo repeat equals offset; repeat is a power of two up to
+ * TTCAN_MATRIX_CYCLES. An exclusive window carries the frame with the CAN
+ * ID and payload length from the node; an arbitrating window carries one
+ * frame from buffer 0 of any node, of up to the payload length. Time that
+ * no window covers is left free. */
+#define TTCAN_WINDOW_LIST(X)                                                   \
+    X(CTRL_1,   EXCLUSIVE,      400U,  300U, 1U, 0U, 1U, 0x090U,  8U)          \
+    X(CTRL_2,   EXCLUSIVE,      700U,  300U, 1U, 0U, 2U, 0x091U,  8U)          \
+    X(STATUS_1, EXCLUSIVE,     1000U,  400U, 4U, 0U, 1U, 0x092U, 32U)          \
+    X(STATUS_2, EXCLUSIVE,     1000U,  400U, 4U, 2U, 2U, 0x093U, 32U)          \
+    X(EVENT_A,  ARBITRATING,   1500U,  600U, 1U, 0U, 0U, 0x000U, 64U)          \
+    X(EVENT_B,  ARBITRATING,   3000U,  600U, 1U, 0U, 0U, 0x000U, 64U)
+
+#define TTCAN_WINDOW_ENUM(name, kind, start, length, repeat, offset, node,     \
+                          id, len)                  TTCAN_WINDOW_##name,
+
+/* Trigger types of the trigger memory */
+#define TTCAN_TRIGGER_TX_REF        (0U)
+#define TTCAN_TRIGGER_TX_SINGLE     (2U)
+#define TTCAN_TRIGGER_TX_ARBITRATION (4U)
+#define TTCAN_TRIGGER_WATCH         (6U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef enum
+{
+    TTCAN_WINDOW_LIST(TTCAN_WINDOW_ENUM)
+    TTCAN_WINDOW_COUNT
+} ttcan_window_id_t;
+
+typedef struct
+{
+    const char *name;
+    uint16_t    start;          /* NTU after the reference message */
+    uint16_t    length;         /* NTU */
+    uint16_t    id;
+    uint8_t     kind;
+    uint8_t     repeat;
+    uint8_t     offset;
+    uint8_t     node;           /* Sender of an exclusive window */
+    uint8_t     len;            /* Largest payload in the window */
+} ttcan_window_t;
+
+typedef struct
+{
+    const ttcan_window_t *windows;
+    uint8_t               count;
+    uint8_t               cycles;   /* Basic cycles in the matrix */
+    uint16_t              cycle_ntu;
+} ttcan_matrix_t;
+
+typedef enum
+{
+    TTCAN_OK,
+    TTCAN_ERROR_CYCLES,         /* Not a power of two up to 64 */
+    TTCAN_ERROR_REPEAT,         /* Bad repeat or offset */
+    TTCAN_ERROR_BOUNDS,         /* Over the reference message or past the
+                                 * end of the cycle */
+    TTCAN_ERROR_LENGTH,         /* Shorter than its frame */
+    TTCAN_ERROR_OVERLAP,        /* Shares time with an earlier window */
+    TTCAN_ERROR_NODE,           /* Exclusive window of no node */
+    TTCAN_ERROR_TRIGGERS        /* More windows, triggers or buffers
+                                 * than the controller has */
+} ttcan_error_t;
+
+/* One trigger memory element before encoding */
+typedef struct
+{
+    uint16_t time_mark;         /* NTU */
+    uint8_t  cycle_code;        /* Repeat + offset */
+    uint8_t  type;
+    uint8_t  buffer;
+} ttcan_trigger_t;
+
+/* Trigger list of one node, in time mark order */
+typedef struct
+{
+    ttcan_trigger_t triggers[TTCAN_TRIGGERS_MAX];
+    uint8_t         count;
+    uint8_t         buffers;            /* TX buffers used */
+    uint16_t        tx_triggers;        /* Tx triggers per matrix cycle */
+    int8_t          window_buffer[TTCAN_WINDOWS_MAX];   /* -1 if the node
+                                                         * sends nothing in
+                                                         * the window */
+} ttcan_schedule_t;
+
+/* Deviation of the time between two frames of a periodic stream from its
+ * period, in ns */
+typedef struct
+{
+    uint32_t count;
+    int32_t  min;
+    int32_t  max;
+} ttcan_jitter_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern const ttcan_matrix_t ttcan_matrix;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint32_t ttcan_frame_ns(uint8_t len, bool fd);
+ttcan_error_t ttcan_validate(const ttcan_matrix_t *matrix, uint32_t *window);
+ttcan_error_t ttcan_compile(const ttcan_matrix_t *matrix, uint8_t node,
+                            ttcan_schedule_t *schedule);
+void ttcan_trigger_encode(const ttcan_trigger_t *trigger, uint32_t words[2]);
+const char *ttcan_error_name(ttcan_error_t error);
+void ttcan_jitter_add(ttcan_jitter_t *jitter, int32_t deviation);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* TTCAN_H_ */
+
+/* [] END OF FILE */
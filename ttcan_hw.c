@@ -0,0 +1,553 @@
+/******************************************************************************
+* File Name:   ttcan_hw.c
+*
+* Description: CAN FD channel glue of the time-triggered schedule: writes the
+*              trigger memory, switches the channel to TTCAN level 1, keeps
+*              the scheduled frames requested and measures the jitter of the
+*              received periodic frames.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "nm.h"
+#include "ttcan_hw.h"
+#include "stats.h"
+
+#if (TTCAN_ENABLE)
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Operating modes of TTOCF.OM */
+#define TTCAN_HW_MODE_EVENT     (0U)
+#define TTCAN_HW_MODE_LEVEL_1   (1U)
+
+/* Channel clocks per NTU; the time unit ratio of TURCF is this fraction,
+ * NC / DC, with NC = 0x10000 + NCL */
+#define TTCAN_HW_TUR            (TTCAN_HW_CAN_CLOCK_HZ /                      \
+                                 (1000000000UL / TTCAN_NTU_NS))
+#define TTCAN_HW_NC_MIN         (0x10000UL)
+#define TTCAN_HW_NC_MAX         (0x1FFFFUL)
+#define TTCAN_HW_DC_MAX         (0x3FFFUL)
+
+/* The RX timestamp counts nominal bit times */
+#define TTCAN_HW_TS_NS          (1000000000UL / TTCAN_NOMINAL_BPS)
+#define TTCAN_HW_TSS_COUNTER    (1U)
+
+/* Standard IDs sit in bits 28:18 of the reference message ID */
+#define TTCAN_HW_STD_ID_Pos     (18U)
+
+/* Period of the probe frame and of the exclusive frames sent every cycle */
+#define TTCAN_HW_PERIOD_NS      ((uint32_t)TTCAN_CYCLE_NTU * TTCAN_NTU_NS)
+#define TTCAN_HW_PERIOD_MS      (TTCAN_HW_PERIOD_NS / 1000000UL)
+
+/* Exclusive frame payload: counter, little endian */
+#define TTCAN_HW_COUNTER_SIZE   (4U)
+
+#if (TTCAN_HW_TUR < 4UL)
+#error "TTCAN_HW_CAN_CLOCK_HZ is too low for the network time unit"
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Receiver side of a periodic stream of the other node */
+typedef struct
+{
+    uint32_t       id;
+    uint32_t       period_ns;
+    bool           started;
+    uint16_t       last_ts;
+    ttcan_jitter_t jitter;
+} ttcan_hw_stream_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static CANFD_Type                  *ttcan_hw_base;
+static uint32_t                     ttcan_hw_chan;
+static const cy_stc_canfd_config_t *ttcan_hw_config;
+static cy_stc_canfd_context_t      *ttcan_hw_context;
+static ttcan_hw_send_fn_t           ttcan_hw_send;
+static uint8_t                      ttcan_hw_node;
+
+static ttcan_schedule_t             ttcan_hw_schedule;
+static bool                         ttcan_hw_running;
+
+/* Buffer of the reference and exclusive frames, set up before each
+ * request */
+static cy_stc_canfd_t0_t            ttcan_hw_t0;
+static cy_stc_canfd_t1_t            ttcan_hw_t1;
+static uint32_t                     ttcan_hw_data[CANFD_MAX_DATA_LEN /
+                                                  sizeof(uint32_t)];
+static cy_stc_canfd_tx_buffer_t     ttcan_hw_tx =
+{
+    .t0_f = &ttcan_hw_t0,
+    .t1_f = &ttcan_hw_t1,
+    .data_area_f = ttcan_hw_data
+};
+
+static uint32_t                     ttcan_hw_counter;
+static uint32_t                     ttcan_hw_next_ms;
+static uint32_t                     ttcan_hw_rearmed;
+
+/* Time-triggered frame of the other node and its event-triggered probe */
+static ttcan_hw_stream_t            ttcan_hw_rx_tt;
+static ttcan_hw_stream_t            ttcan_hw_rx_et;
+
+/*******************************************************************************
+* Function Name: ttcan_hw_mram_offset
+********************************************************************************
+* Summary:
+* Returns the message RAM offset of the trigger memory: right after the TX
+* buffers of the channel, which PDL places last. Returns 0 if the trigger
+* list does not fit in the message RAM of the channel.
+*
+*******************************************************************************/
+static uint32_t ttcan_hw_mram_offset(void)
+{
+    static const uint8_t data_size[] = { 8U, 12U, 16U, 20U, 24U, 32U, 48U, 64U };
+    uint32_t txbc = CANFD_TXBC(ttcan_hw_base, ttcan_hw_chan);
+    uint32_t buffers = _FLD2VAL(CANFD_CH_M_TTCAN_TXBC_NDTB, txbc) +
+                       _FLD2VAL(CANFD_CH_M_TTCAN_TXBC_TFQS, txbc);
+    uint32_t element = 8U + data_size[_FLD2VAL(CANFD_CH_M_TTCAN_TXESC_TBDS,
+                                      CANFD_TXESC(ttcan_hw_base,
+                                                  ttcan_hw_chan))];
+    uint32_t offset = (txbc & CANFD_CH_M_TTCAN_TXBC_TBSA_Msk) +
+                      (buffers * element);
+    uint32_t end = (CANFD_SIDFC(ttcan_hw_base, ttcan_hw_chan) &
+                    CANFD_CH_M_TTCAN_SIDFC_FLSSA_Msk) +
+                   ttcan_hw_config->messageRAMsize;
+
+    return ((offset + (ttcan_hw_schedule.count * 8U)) <= end) ? offset : 0U;
+}
+
+/*******************************************************************************
+* Function Name: ttcan_hw_configure
+********************************************************************************
+* Summary:
+* Writes the trigger list into the message RAM and switches the channel to
+* TTCAN level 1: reference message, matrix limits, time unit ratio, and the
+* time master role on node 1. The RX timestamp is set to count nominal bit
+* times for the jitter statistics.
+*
+* Return:
+*  true if the channel runs time-triggered
+*
+*******************************************************************************/
+static bool ttcan_hw_configure(void)
+{
+    uint32_t offset = ttcan_hw_mram_offset();
+    volatile uint32_t *element;
+    uint32_t dc = TTCAN_HW_DC_MAX;
+    uint32_t words[2];
+
+    if (0U == offset)
+    {
+        printf("TTCAN: no message RAM left for %u triggers\r\n",
+               (unsigned)ttcan_hw_schedule.count);
+        return false;
+    }
+
+    /* The section registers hold the low 16 bits of message RAM
+     * addresses */
+    element = (volatile uint32_t *)((ttcan_hw_config->messageRAMaddress &
+                                     ~0xFFFFUL) + offset);
+    for (uint32_t idx = 0U; idx < ttcan_hw_schedule.count; idx++)
+    {
+        ttcan_trigger_encode(&ttcan_hw_schedule.triggers[idx], words);
+        element[2U * idx] = words[0];
+        element[(2U * idx) + 1U] = words[1];
+    }
+
+    /* Largest denominator that keeps the numerator in range */
+    while ((TTCAN_HW_TUR * dc) > TTCAN_HW_NC_MAX)
+    {
+        dc >>= 1;
+    }
+
+    (void)Cy_CANFD_ConfigChangesEnable(ttcan_hw_base, ttcan_hw_chan);
+
+    CANFD_TSCC(ttcan_hw_base, ttcan_hw_chan) =
+        _VAL2FLD(CANFD_CH_M_TTCAN_TSCC_TSS, TTCAN_HW_TSS_COUNTER);
+    CANFD_TTTMC(ttcan_hw_base, ttcan_hw_chan) =
+        _VAL2FLD(CANFD_CH_M_TTCAN_TTTMC_TMSA, offset >> 2) |
+        _VAL2FLD(CANFD_CH_M_TTCAN_TTTMC_TME, ttcan_hw_schedule.count);
+    CANFD_TTRMC(ttcan_hw_base, ttcan_hw_chan) =
+        _VAL2FLD(CANFD_CH_M_TTCAN_TTRMC_RID,
+                 (uint32_t)TTCAN_REF_ID << TTCAN_HW_STD_ID_Pos);
+    CANFD_TTMLM(ttcan_hw_base, ttcan_hw_chan) =
+        _VAL2FLD(CANFD_CH_M_TTCAN_TTMLM_CCM, TTCAN_MATRIX_CYCLES - 1U) |
+        _VAL2FLD(CANFD_CH_M_TTCAN_TTMLM_TXEW, TTCAN_TX_ENABLE_NTU - 1U) |
+        _VAL2FLD(CANFD_CH_M_TTCAN_TTMLM_ENTT, ttcan_hw_schedule.tx_triggers);
+    CANFD_TURCF(ttcan_hw_base, ttcan_hw_chan) =
+        _VAL2FLD(CANFD_CH_M_TTCAN_TURCF_NCL,
+                 (TTCAN_HW_TUR * dc) - TTCAN_HW_NC_MIN) |
+        _VAL2FLD(CANFD_CH_M_TTCAN_TURCF_DC, dc) |
+        CANFD_CH_M_TTCAN_TURCF_ELT_Msk;
+    CANFD_TTOCF(ttcan_hw_base, ttcan_hw_chan) =
+        _VAL2FLD(CANFD_CH_M_TTCAN_TTOCF_OM, TTCAN_HW_MODE_LEVEL_1) |
+        ((TTCAN_MASTER_NODE == ttcan_hw_node) ?
+         CANFD_CH_M_TTCAN_TTOCF_TM_Msk : 0U);
+
+    (void)Cy_CANFD_ConfigChangesDisable(ttcan_hw_base, ttcan_hw_chan);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: ttcan_hw_arm
+********************************************************************************
+* Summary:
+* Sets up a TX buffer of the schedule and requests it, if the controller is
+* not still holding the previous request. The request waits for the trigger
+* of the buffer.
+*
+* Parameters:
+*  buffer       TX buffer
+*  id           CAN ID
+*  len          Payload length
+*  fd           CAN FD frame with bit rate switching
+*
+*******************************************************************************/
+static void ttcan_hw_arm(uint32_t buffer, uint32_t id, uint8_t len, bool fd)
+{
+    canfd_frame_t frame;
+
+    if (CY_CANFD_TX_BUFFER_PENDING ==
+        Cy_CANFD_GetTxBufferStatus(ttcan_hw_base, ttcan_hw_chan,
+                                   (uint8_t)buffer))
+    {
+        return;
+    }
+
+    frame.id = id;
+    frame.timestamp = 0U;
+    frame.len = len;
+    frame.flags = fd ? (CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS) : 0U;
+    frame.bus = 0U;
+    frame.reserved = 0U;
+    memset(frame.data, 0, len);
+    for (uint32_t idx = 0U; (idx < TTCAN_HW_COUNTER_SIZE) && (idx < len); idx++)
+    {
+        frame.data[idx] = (uint8_t)(ttcan_hw_counter >> (idx * 8U));
+    }
+
+    canfd_frame_to_tx_buffer(&frame, &ttcan_hw_tx);
+    ttcan_hw_t0.esi = CY_CANFD_ESI_ERROR_ACTIVE;
+    ttcan_hw_t1.efc = false;
+    ttcan_hw_t1.mm = 0U;
+
+    if (CY_CANFD_SUCCESS ==
+        Cy_CANFD_UpdateAndTransmitMsgBuffer(ttcan_hw_base, ttcan_hw_chan,
+                                            &ttcan_hw_tx, (uint8_t)buffer,
+                                            ttcan_hw_context))
+    {
+        ttcan_hw_rearmed++;
+        STATS_INC(TTCAN_REARMED);
+    }
+}
+
+/*******************************************************************************
+* Function Name: ttcan_hw_stream_init
+********************************************************************************
+* Summary:
+* Sets up the receiver of a periodic stream.
+*
+*******************************************************************************/
+static void ttcan_hw_stream_init(ttcan_hw_stream_t *stream, uint32_t id,
+                                 uint32_t period_ns)
+{
+    memset(stream, 0, sizeof(*stream));
+    stream->id = id;
+    stream->period_ns = period_ns;
+}
+
+/*******************************************************************************
+* Function Name: ttcan_hw_stream_add
+********************************************************************************
+* Summary:
+* Adds the interval since the previous frame of a stream. An interval more
+* than half a period off, after a lost frame, only restarts the stream.
+*
+*******************************************************************************/
+static void ttcan_hw_stream_add(ttcan_hw_stream_t *stream, uint16_t ts)
+{
+    int32_t deviation = (int32_t)((uint16_t)(ts - stream->last_ts) *
+                                  TTCAN_HW_TS_NS) - (int32_t)stream->period_ns;
+
+    if (stream->started &&
+        (((deviation < 0) ? -deviation : deviation) <
+         (int32_t)(stream->period_ns / 2U)))
+    {
+        ttcan_jitter_add(&stream->jitter, deviation);
+    }
+    stream->started = true;
+    stream->last_ts = ts;
+}
+
+/*******************************************************************************
+* Function Name: ttcan_hw_print_stream
+********************************************************************************
+* Summary:
+* Prints the jitter of a received stream in microseconds.
+*
+*******************************************************************************/
+static void ttcan_hw_print_stream(const char *name,
+                                  const ttcan_hw_stream_t *stream)
+{
+    if (0U == stream->jitter.count)
+    {
+        return;
+    }
+    printf("  %s 0x%03lx: %lu intervals, %ld to %ld us from the period, "
+           "%ld us peak to peak\r\n", name, (unsigned long)stream->id,
+           (unsigned long)stream->jitter.count,
+           (long)(stream->jitter.min / 1000),
+           (long)(stream->jitter.max / 1000),
+           (long)((stream->jitter.max - stream->jitter.min) / 1000));
+}
+#endif /* TTCAN_ENABLE */
+
+/*******************************************************************************
+* Function Name: ttcan_hw_init
+********************************************************************************
+* Summary:
+* Compiles the system matrix for this node and starts time-triggered
+* operation. The channel stays event-triggered if the matrix does not
+* validate or the design has too few TX buffers for it. Call it after the
+* channel has been initialized and before its interrupt is enabled.
+*
+* Parameters:
+*  base         CAN FD block
+*  chan         CAN FD channel
+*  config       Channel configuration
+*  context      Channel context
+*  node         Node number; node 1 is the time master
+*  send         Sends a frame through the application TX buffer
+*
+*******************************************************************************/
+void ttcan_hw_init(CANFD_Type *base, uint32_t chan,
+                   const cy_stc_canfd_config_t *config,
+                   cy_stc_canfd_context_t *context, uint8_t node,
+                   ttcan_hw_send_fn_t send)
+{
+#if (TTCAN_ENABLE)
+    ttcan_error_t error;
+    uint8_t other = (1U == node) ? 2U : 1U;
+
+    ttcan_hw_base = base;
+    ttcan_hw_chan = chan;
+    ttcan_hw_config = config;
+    ttcan_hw_context = context;
+    ttcan_hw_send = send;
+    ttcan_hw_node = node;
+
+    ttcan_hw_stream_init(&ttcan_hw_rx_tt,
+                         ttcan_matrix.windows[(1U == other) ?
+                                              TTCAN_WINDOW_CTRL_1 :
+                                              TTCAN_WINDOW_CTRL_2].id,
+                         TTCAN_HW_PERIOD_NS);
+    ttcan_hw_stream_init(&ttcan_hw_rx_et, TTCAN_HW_PROBE_ID + other,
+                         TTCAN_HW_PERIOD_NS);
+
+    error = ttcan_compile(&ttcan_matrix, node, &ttcan_hw_schedule);
+    if (TTCAN_OK != error)
+    {
+        uint32_t window;
+
+        (void)ttcan_validate(&ttcan_matrix, &window);
+        printf("TTCAN: system matrix window %s: %s\r\n",
+               ttcan_matrix.windows[window].name, ttcan_error_name(error));
+        return;
+    }
+    if (config->noOfTxBuffers < ttcan_hw_schedule.buffers)
+    {
+        printf("TTCAN: the schedule needs %u TX buffers, the design has "
+               "%lu\r\n", (unsigned)ttcan_hw_schedule.buffers,
+               (unsigned long)config->noOfTxBuffers);
+        return;
+    }
+
+    ttcan_hw_running = ttcan_hw_configure();
+#else
+    CY_UNUSED_PARAMETER(base);
+    CY_UNUSED_PARAMETER(chan);
+    CY_UNUSED_PARAMETER(config);
+    CY_UNUSED_PARAMETER(context);
+    CY_UNUSED_PARAMETER(node);
+    CY_UNUSED_PARAMETER(send);
+#endif /* TTCAN_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: ttcan_hw_poll
+********************************************************************************
+* Summary:
+* Requests the reference frame and the exclusive frames of this node again
+* once they were sent, and sends the event-triggered probe frame once per
+* basic cycle. A channel that network management restarted is switched
+* back to time-triggered operation. Nothing is sent while the network
+* sleeps.
+*
+* Parameters:
+*  now_ms       Current time
+*
+*******************************************************************************/
+void ttcan_hw_poll(uint32_t now_ms)
+{
+#if (TTCAN_ENABLE)
+    canfd_frame_t frame;
+
+    if ((!ttcan_hw_running) || (!nm_tx_allowed()))
+    {
+        return;
+    }
+
+    if (TTCAN_HW_MODE_EVENT ==
+        _FLD2VAL(CANFD_CH_M_TTCAN_TTOCF_OM,
+                 CANFD_TTOCF(ttcan_hw_base, ttcan_hw_chan)))
+    {
+        ttcan_hw_running = ttcan_hw_configure();
+        return;
+    }
+
+    if (TTCAN_MASTER_NODE == ttcan_hw_node)
+    {
+        ttcan_hw_arm(TTCAN_BUFFER_REF, TTCAN_REF_ID, TTCAN_REF_LEN, false);
+    }
+    for (uint32_t idx = 0U; idx < ttcan_matrix.count; idx++)
+    {
+        if (ttcan_hw_schedule.window_buffer[idx] >= 0)
+        {
+            ttcan_hw_arm((uint32_t)ttcan_hw_schedule.window_buffer[idx],
+                         ttcan_matrix.windows[idx].id,
+                         ttcan_matrix.windows[idx].len, true);
+        }
+    }
+
+    if ((int32_t)(now_ms - ttcan_hw_next_ms) >= 0)
+    {
+        frame.id = TTCAN_HW_PROBE_ID + ttcan_hw_node;
+        frame.timestamp = 0U;
+        frame.len = TTCAN_HW_COUNTER_SIZE;
+        frame.flags = CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS;
+        frame.bus = 0U;
+        frame.reserved = 0U;
+        for (uint32_t idx = 0U; idx < TTCAN_HW_COUNTER_SIZE; idx++)
+        {
+            frame.data[idx] = (uint8_t)(ttcan_hw_counter >> (idx * 8U));
+        }
+        if (ttcan_hw_send(&frame))
+        {
+            ttcan_hw_next_ms = now_ms + TTCAN_HW_PERIOD_MS;
+            ttcan_hw_counter++;
+            STATS_INC(TTCAN_PROBES);
+        }
+    }
+#else
+    CY_UNUSED_PARAMETER(now_ms);
+#endif /* TTCAN_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: ttcan_hw_on_frame
+********************************************************************************
+* Summary:
+* Measures the interval between frames of the time-triggered control frame
+* of the other node and of its event-triggered probe, from the RX timestamps
+* the controller takes at the start of each frame.
+*
+* Parameters:
+*  frame        Received frame
+*
+*******************************************************************************/
+void ttcan_hw_on_frame(const canfd_frame_t *frame)
+{
+#if (TTCAN_ENABLE)
+    if (frame->id == ttcan_hw_rx_tt.id)
+    {
+        ttcan_hw_stream_add(&ttcan_hw_rx_tt, (uint16_t)frame->timestamp);
+    }
+    else if (frame->id == ttcan_hw_rx_et.id)
+    {
+        ttcan_hw_stream_add(&ttcan_hw_rx_et, (uint16_t)frame->timestamp);
+    }
+#else
+    CY_UNUSED_PARAMETER(frame);
+#endif /* TTCAN_ENABLE */
+}
+
+/*******************************************************************************
+* Function Name: ttcan_hw_report
+********************************************************************************
+* Summary:
+* Prints the state of time-triggered operation and the jitter of the
+* time-triggered and the event-triggered frames of the other node.
+*
+*******************************************************************************/
+void ttcan_hw_report(void)
+{
+#if (TTCAN_ENABLE)
+    uint32_t status;
+
+    if (!ttcan_hw_running)
+    {
+        printf("TTCAN: not running, the channel is event-triggered\r\n");
+        return;
+    }
+
+    status = CANFD_TTOST(ttcan_hw_base, ttcan_hw_chan);
+    printf("TTCAN: level 1 %s, %u triggers, cycle %lu, sync state %lu, "
+           "error level %lu, %lu frames requested\r\n",
+           (TTCAN_MASTER_NODE == ttcan_hw_node) ? "time master" : "time slave",
+           (unsigned)ttcan_hw_schedule.count,
+           (unsigned long)_FLD2VAL(CANFD_CH_M_TTCAN_TTCTC_CC,
+                                   CANFD_TTCTC(ttcan_hw_base, ttcan_hw_chan)),
+           (unsigned long)_FLD2VAL(CANFD_CH_M_TTCAN_TTOST_SYS, status),
+           (unsigned long)_FLD2VAL(CANFD_CH_M_TTCAN_TTOST_EL, status),
+           (unsigned long)ttcan_hw_rearmed);
+    ttcan_hw_print_stream("time-triggered ", &ttcan_hw_rx_tt);
+    ttcan_hw_print_stream("event-triggered", &ttcan_hw_rx_et);
+#endif /* TTCAN_ENABLE */
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,92 @@
+/******************************************************************************
+* File Name:   ttcan_hw.h
+*
+* Description: Time-triggered operation of the CAN FD channel interface.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef TTCAN_HW_H_
+#define TTCAN_HW_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "canfd_frame.h"
+#include "ttcan.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Frequency of the channel clock (clock_can) set in the design. It sets
+ * the length of the network time unit. */
+#ifndef TTCAN_HW_CAN_CLOCK_HZ
+#define TTCAN_HW_CAN_CLOCK_HZ   (24000000UL)
+#endif
+
+/* Event-triggered frame each node sends once per basic cycle from the main
+ * loop, for the jitter comparison: TTCAN_HW_PROBE_ID + node number */
+#define TTCAN_HW_PROBE_ID       (0x09CU)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Sends a frame through the application TX buffer */
+typedef bool (*ttcan_hw_send_fn_t)(const canfd_frame_t *frame);
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void ttcan_hw_init(CANFD_Type *base, uint32_t chan,
+                   const cy_stc_canfd_config_t *config,
+                   cy_stc_canfd_context_t *context, uint8_t node,
+                   ttcan_hw_send_fn_t send);
+void ttcan_hw_poll(uint32_t now_ms);
+void ttcan_hw_on_frame(const canfd_frame_t *frame);
+void ttcan_hw_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* TTCAN_HW_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,377 @@
+/******************************************************************************
+* File Name:   txfmt.c
+*
+* Description: This file contains the frame-length model and the per-message
+*              choice of the classic, CAN FD or CAN FD with bit rate switching
+*              format.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stddef.h>
+#include <stdio.h>
+#include "txfmt.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TXFMT_LISTENER_ENTRY(name, id, mask, formats)                          \
+    { #name, (id), (mask), (formats) },
+
+/* Frame fields in bits, without stuff bits. The arbitration phase of a CAN
+ * FD frame runs from SOF to BRS, the data phase from ESI to the CRC
+ * delimiter; CRC delimiter, ACK, EOF and intermission are at the nominal
+ * rate again. */
+#define TXFMT_CLASSIC_HEAD_BITS (19U)       /* SOF to DLC */
+#define TXFMT_CLASSIC_CRC_BITS  (16U)       /* CRC and delimiter */
+#define TXFMT_FD_ARB_BITS       (17U)       /* SOF to BRS */
+#define TXFMT_FD_HEAD_BITS      (5U)        /* ESI and DLC */
+#define TXFMT_FD_STUFF_COUNT    (4U)        /* Stuff count and parity */
+#define TXFMT_TAIL_BITS         (12U)       /* ACK, EOF, intermission */
+/* Bits a 29-bit identifier adds: SRR, IDE and the 18-bit extension, with
+ * r1 in place of IDE in a classic frame */
+#define TXFMT_XTD_CLASSIC_BITS  (20U)
+#define TXFMT_XTD_FD_BITS       (19U)
+
+#define TXFMT_CLASSIC_MAX_LEN   (8U)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    uint32_t id;
+    uint32_t mask;
+    uint32_t formats;
+} txfmt_listener_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const txfmt_listener_t txfmt_listeners[] =
+{
+    TXFMT_LISTENER_LIST(TXFMT_LISTENER_ENTRY)
+    { NULL, 0U, 0U, TXFMT_SET_ALL }
+};
+
+/* CAN FD payload lengths above 8 bytes, DLC 9 to 15 */
+static const uint8_t txfmt_fd_lengths[] = { 12U, 16U, 20U, 24U, 32U, 48U, 64U };
+
+#if (TXFMT_ENABLE)
+static const char *const txfmt_names[TXFMT_COUNT] =
+{
+    "classic", "FD", "FD+BRS"
+};
+#endif /* TXFMT_ENABLE */
+
+static txfmt_rates_t txfmt_rates = { TXFMT_NOMINAL_BPS, TXFMT_DATA_BPS };
+
+static txfmt_stats_t txfmt_stats;
+
+/*******************************************************************************
+* Function Name: txfmt_fd_len
+********************************************************************************
+* Summary:
+* Returns the length a CAN FD frame carries for a payload, which is padded
+* up to the next length a DLC can encode.
+*
+*******************************************************************************/
+uint8_t txfmt_fd_len(uint8_t len)
+{
+    if (len <= TXFMT_CLASSIC_MAX_LEN)
+    {
+        return len;
+    }
+    for (uint32_t idx = 0U; idx < sizeof(txfmt_fd_lengths); idx++)
+    {
+        if (len <= txfmt_fd_lengths[idx])
+        {
+            return txfmt_fd_lengths[idx];
+        }
+    }
+    return txfmt_fd_lengths[sizeof(txfmt_fd_lengths) - 1U];
+}
+
+/*******************************************************************************
+* Function Name: txfmt_bits_ns
+********************************************************************************
+* Summary:
+* Converts a number of bits at a bit rate to ns.
+*
+*******************************************************************************/
+static uint32_t txfmt_bits_ns(uint32_t bits, uint32_t bps)
+{
+    return (uint32_t)(((uint64_t)bits * 1000000000ULL) / bps);
+}
+
+/*******************************************************************************
+* Function Name: txfmt_frame_ns
+********************************************************************************
+* Summary:
+* Returns the longest time a data frame can take on the bus, with the most
+* stuff bits it can have and the intermission after it. A remote frame is
+* a classic frame without the data field.
+*
+* Parameters:
+*  rates        Bit rates of the channel
+*  format       Frame format
+*  len          Payload length; CAN FD payloads are padded to a DLC length
+*  xtd          29-bit identifier
+*
+* Return:
+*  Frame time in ns
+*
+*******************************************************************************/
+uint32_t txfmt_frame_ns(const txfmt_rates_t *rates, txfmt_format_t format,
+                        uint8_t len, bool xtd)
+{
+    uint32_t arb;
+    uint32_t bits;
+    uint32_t crc;
+    uint32_t data_bps;
+
+    if (TXFMT_CLASSIC == format)
+    {
+        /* One stuff bit per four bits after the first five, up to the end
+         * of the CRC */
+        bits = TXFMT_CLASSIC_HEAD_BITS + (8U * len) + TXFMT_CLASSIC_CRC_BITS +
+               (xtd ? TXFMT_XTD_CLASSIC_BITS : 0U);
+        bits += (bits - 2U) / 4U;
+        return txfmt_bits_ns(bits + TXFMT_TAIL_BITS, rates->nominal_bps);
+    }
+
+    /* The CRC field has a fixed stuff bit before every fourth bit */
+    len = txfmt_fd_len(len);
+    crc = (len > 16U) ? 21U : 17U;
+    arb = TXFMT_FD_ARB_BITS + (xtd ? TXFMT_XTD_FD_BITS : 0U);
+    bits = TXFMT_FD_HEAD_BITS + (8U * len);
+    data_bps = (TXFMT_FD_BRS == format) ? rates->data_bps : rates->nominal_bps;
+
+    return txfmt_bits_ns(arb + ((arb - 1U) / 4U) + TXFMT_TAIL_BITS + 1U,
+                         rates->nominal_bps) +
+           txfmt_bits_ns(bits + (bits / 4U) + TXFMT_FD_STUFF_COUNT + crc +
+                         ((TXFMT_FD_STUFF_COUNT + crc + 3U) / 4U), data_bps);
+}
+
+/*******************************************************************************
+* Function Name: txfmt_allowed
+********************************************************************************
+* Summary:
+* Returns the formats all listeners of an identifier accept.
+*
+*******************************************************************************/
+uint32_t txfmt_allowed(uint32_t id)
+{
+    uint32_t formats = TXFMT_BUS_FORMATS;
+
+    for (const txfmt_listener_t *entry = txfmt_listeners;
+         NULL != entry->name; entry++)
+    {
+        if ((id & entry->mask) == (entry->id & entry->mask))
+        {
+            formats &= entry->formats;
+        }
+    }
+    return formats;
+}
+
+/*******************************************************************************
+* Function Name: txfmt_select
+********************************************************************************
+* Summary:
+* Picks the format that puts a frame on the bus for the least time. Classic
+* frames carry 8 bytes at most, and only they have a remote form.
+*
+* Parameters:
+*  rates        Bit rates of the channel
+*  formats      Formats to choose from
+*  len          Payload length
+*  xtd          29-bit identifier
+*  rtr          Remote frame
+*
+* Return:
+*  Format, or TXFMT_COUNT if none of the formats can carry the frame
+*
+*******************************************************************************/
+txfmt_format_t txfmt_select(const txfmt_rates_t *rates, uint32_t formats,
+                            uint8_t len, bool xtd, bool rtr)
+{
+    txfmt_format_t best = TXFMT_COUNT;
+    uint32_t best_ns = UINT32_MAX;
+
+    if (rtr)
+    {
+        formats &= TXFMT_SET(TXFMT_CLASSIC);
+    }
+    if (len > TXFMT_CLASSIC_MAX_LEN)
+    {
+        formats &= ~TXFMT_SET(TXFMT_CLASSIC);
+    }
+
+    for (uint32_t format = 0U; format < (uint32_t)TXFMT_COUNT; format++)
+    {
+        uint32_t ns;
+
+        if (0U == (formats & TXFMT_SET(format)))
+        {
+            continue;
+        }
+        ns = txfmt_frame_ns(rates, (txfmt_format_t)format,
+                            rtr ? 0U : len, xtd);
+        if (ns < best_ns)
+        {
+            best_ns = ns;
+            best = (txfmt_format_t)format;
+        }
+    }
+    return best;
+}
+
+/*******************************************************************************
+* Function Name: txfmt_choose
+********************************************************************************
+* Summary:
+* Chooses the format of a frame to send at the current bit rates, and counts
+* the bus time against the format its producer set. Called by the transmit
+* path of the main loop only.
+*
+* Parameters:
+*  id           Identifier
+*  len          Payload length
+*  xtd          29-bit identifier
+*  rtr          Remote frame
+*  fixed        Format the producer set
+*
+* Return:
+*  Format to send in, or TXFMT_COUNT if the frame must not be sent
+*
+*******************************************************************************/
+txfmt_format_t txfmt_choose(uint32_t id, uint8_t len, bool xtd, bool rtr,
+                            txfmt_format_t fixed)
+{
+    txfmt_format_t format = txfmt_select(&txfmt_rates, txfmt_allowed(id),
+                                         len, xtd, rtr);
+    uint8_t bus_len = rtr ? 0U : len;
+
+    if (TXFMT_COUNT == format)
+    {
+        txfmt_stats.refused++;
+        return TXFMT_COUNT;
+    }
+
+    txfmt_stats.frames++;
+    txfmt_stats.sent[format]++;
+    if (format != fixed)
+    {
+        txfmt_stats.changed++;
+    }
+    txfmt_stats.fixed_ns += txfmt_frame_ns(&txfmt_rates, fixed, bus_len, xtd);
+    txfmt_stats.chosen_ns += txfmt_frame_ns(&txfmt_rates, format, bus_len,
+                                            xtd);
+    return format;
+}
+
+/*******************************************************************************
+* Function Name: txfmt_set_rates
+********************************************************************************
+* Summary:
+* Sets the bit rates the choice is made for, after the bit timing of the
+* channel changed.
+*
+*******************************************************************************/
+void txfmt_set_rates(const txfmt_rates_t *rates)
+{
+    txfmt_rates = *rates;
+}
+
+/*******************************************************************************
+* Function Name: txfmt_get_rates
+********************************************************************************
+* Summary:
+* Returns the bit rates the choice is made for.
+*
+*******************************************************************************/
+void txfmt_get_rates(txfmt_rates_t *rates)
+{
+    *rates = txfmt_rates;
+}
+
+/*******************************************************************************
+* Function Name: txfmt_get_stats
+********************************************************************************
+* Summary:
+* Returns the counters since start-up.
+*
+*******************************************************************************/
+void txfmt_get_stats(txfmt_stats_t *stats)
+{
+    *stats = txfmt_stats;
+}
+
+/*******************************************************************************
+* Function Name: txfmt_report
+********************************************************************************
+* Summary:
+* Prints the frames sent per format and the bus time the choice saved.
+*
+*******************************************************************************/
+void txfmt_report(void)
+{
+#if (TXFMT_ENABLE)
+    const txfmt_stats_t *stats = &txfmt_stats;
+    int64_t saved_ns = (int64_t)stats->fixed_ns - (int64_t)stats->chosen_ns;
+
+    printf("Frame format: %lu sent (", (unsigned long)stats->frames);
+    for (uint32_t format = 0U; format < (uint32_t)TXFMT_COUNT; format++)
+    {
+        printf("%s%lu %s", (0U == format) ? "" : ", ",
+               (unsigned long)stats->sent[format], txfmt_names[format]);
+    }
+    printf("), %lu changed, %lu refused\r\n", (unsigned long)stats->changed,
+           (unsigned long)stats->refused);
+    printf("  bus time %lu us, %lu us as produced, %ld us saved\r\n",
+           (unsigned long)(stats->chosen_ns / 1000U),
+           (unsigned long)(stats->fixed_ns / 1000U),
+           (long)(saved_ns / 1000));
+#endif /* TXFMT_ENABLE */
+}
+
+/* [] END OF FILE */
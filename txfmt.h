@@ -0,0 +1,154 @@
+/******************************************************************************
+* File Name:   txfmt.h
+*
+* Description: This file contains the frame-length model and the per-message
+*              choice of the classic, CAN FD or CAN FD with bit rate switching
+*              format.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef TXFMT_H_
+#define TXFMT_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (for example with "make TXFMT_ENABLE=1") to choose the format of
+ * each sent frame, classic, CAN FD or CAN FD with bit rate switching, as
+ * the one that takes the least bus time among those its listeners accept.
+ * Otherwise frames go out in the format their producer set. */
+#ifndef TXFMT_ENABLE
+#define TXFMT_ENABLE            (0)
+#endif
+
+/* Bit rates of the channel in the design: 500 kbit/s in the arbitration
+ * phase and 2 Mbit/s in the data phase */
+#ifndef TXFMT_NOMINAL_BPS
+#define TXFMT_NOMINAL_BPS       (500000UL)
+#endif
+#ifndef TXFMT_DATA_BPS
+#define TXFMT_DATA_BPS          (2000000UL)
+#endif
+
+/* Format sets, one bit per txfmt_format_t */
+#define TXFMT_SET(format)       (1UL << (format))
+#define TXFMT_SET_ALL           (TXFMT_SET(TXFMT_CLASSIC) |                    \
+                                 TXFMT_SET(TXFMT_FD) |                         \
+                                 TXFMT_SET(TXFMT_FD_BRS))
+
+/* Formats every node on the bus tolerates. A classic CAN controller that
+ * is not FD tolerant answers any CAN FD frame with an error frame, so a
+ * bus with one of them is limited to TXFMT_SET(TXFMT_CLASSIC) whatever the
+ * identifier. */
+#ifndef TXFMT_BUS_FORMATS
+#define TXFMT_BUS_FORMATS       TXFMT_SET_ALL
+#endif
+
+/* List of listeners with limited capabilities: X(identifier, ID, mask,
+ * formats). A frame whose ID matches the ID under the mask is sent in one
+ * of the formats only; a frame that matches several entries, in one that
+ * all of them accept. The default entry stands for an FD tolerant classic
+ * node that reads the diagnostic range 0x700 to 0x7FF. */
+#ifndef TXFMT_LISTENER_LIST
+#define TXFMT_LISTENER_LIST(X)                                                 \
+    X(DIAG,         0x700U, 0x700U, TXFMT_SET(TXFMT_CLASSIC))
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Frame formats, from the simplest. Ties in bus time go to the simpler. */
+typedef enum
+{
+    TXFMT_CLASSIC,                  /* Classic CAN, at most 8 bytes */
+    TXFMT_FD,                       /* CAN FD at the nominal rate only */
+    TXFMT_FD_BRS,                   /* CAN FD, data phase at the data rate */
+    TXFMT_COUNT
+} txfmt_format_t;
+
+typedef struct
+{
+    uint32_t nominal_bps;
+    uint32_t data_bps;
+} txfmt_rates_t;
+
+/* Frames sent since start-up, and their bus time in the format the
+ * producer set and in the one that was chosen */
+typedef struct
+{
+    uint32_t frames;
+    uint32_t changed;               /* Sent in another format */
+    uint32_t refused;               /* No accepted format fits */
+    uint32_t sent[TXFMT_COUNT];
+    uint64_t fixed_ns;
+    uint64_t chosen_ns;
+} txfmt_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint8_t txfmt_fd_len(uint8_t len);
+uint32_t txfmt_frame_ns(const txfmt_rates_t *rates, txfmt_format_t format,
+                        uint8_t len, bool xtd);
+uint32_t txfmt_allowed(uint32_t id);
+txfmt_format_t txfmt_select(const txfmt_rates_t *rates, uint32_t formats,
+                            uint8_t len, bool xtd, bool rtr);
+txfmt_format_t txfmt_choose(uint32_t id, uint8_t len, bool xtd, bool rtr,
+                            txfmt_format_t fixed);
+void txfmt_set_rates(const txfmt_rates_t *rates);
+void txfmt_get_rates(txfmt_rates_t *rates);
+void txfmt_get_stats(txfmt_stats_t *stats);
+void txfmt_report(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* TXFMT_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,107 @@
+/******************************************************************************
+* File Name:   wake_trace.h
+*
+* Description: Frames replayed by the selective wake-up benchmark. Generated
+*              by scripts/wake_trace.py from wake_sample.log; do not edit.
+*
+*******************************************************************************/
+
+#ifndef WAKE_TRACE_H_
+#define WAKE_TRACE_H_
+
+/* 44 standard frames, 8 of them wake-up frames */
+static const bench_wake_frame_t wake_trace[] =
+{
+    { 0x100U,  8U, 0U, false,
+      { 0x66U, 0x36U, 0xA4U, 0x62U, 0x71U, 0xECU, 0xB1U, 0x71U } },
+    { 0x200U, 16U, CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS, false,
+      { 0x72U, 0xEEU, 0xDCU, 0x3DU, 0x02U, 0x25U, 0xDCU, 0xF0U } },
+    { 0x504U,  8U, 0U, false,
+      { 0x04U, 0x40U, 0x02U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU } },
+    { 0x506U,  8U, 0U, false,
+      { 0x06U, 0x00U, 0x00U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU } },
+    { 0x100U,  8U, 0U, false,
+      { 0x75U, 0x14U, 0xEAU, 0xABU, 0x51U, 0x1DU, 0x86U, 0x35U } },
+    { 0x7E0U,  8U, 0U, false,
+      { 0x02U, 0x3EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U } },
+    { 0x530U,  8U, 0U, false,
+      { 0x30U, 0x50U, 0x02U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU } },
+    { 0x300U, 12U, CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS, false,
+      { 0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U } },
+    { 0x300U, 12U, CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS, false,
+      { 0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U } },
+    { 0x50AU,  3U, 0U, true,
+      { 0x0AU, 0x40U, 0x01U } },
+    { 0x300U, 12U, CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS, false,
+      { 0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U } },
+    { 0x100U,  8U, 0U, false,
+      { 0x5AU, 0x8DU, 0x4BU, 0xF3U, 0xE6U, 0x34U, 0x50U, 0x1DU } },
+    { 0x200U, 16U, CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS, false,
+      { 0xA1U, 0x67U, 0x5CU, 0x0AU, 0xB1U, 0xC4U, 0x46U, 0x59U } },
+    { 0x504U,  8U, 0U, false,
+      { 0x04U, 0x40U, 0x02U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU } },
+    { 0x506U,  8U, 0U, false,
+      { 0x06U, 0x00U, 0x00U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU } },
+    { 0x100U,  8U, 0U, false,
+      { 0x4EU, 0x8BU, 0x73U, 0xDDU, 0xE2U, 0xAFU, 0x7FU, 0x70U } },
+    { 0x7E0U,  8U, 0U, false,
+      { 0x02U, 0x3EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U } },
+    { 0x530U,  8U, 0U, false,
+      { 0x30U, 0x50U, 0x02U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU } },
+    { 0x300U, 12U, CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS, false,
+      { 0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U } },
+    { 0x300U, 12U, CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS, false,
+      { 0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U } },
+    { 0x50AU,  3U, 0U, true,
+      { 0x0AU, 0x40U, 0x01U } },
+    { 0x300U, 12U, CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS, false,
+      { 0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U } },
+    { 0x100U,  8U, 0U, false,
+      { 0xFEU, 0x48U, 0xF0U, 0x83U, 0xECU, 0x6CU, 0x53U, 0x63U } },
+    { 0x200U, 16U, CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS, false,
+      { 0x65U, 0xAEU, 0x23U, 0x7AU, 0x63U, 0xA2U, 0x3FU, 0x15U } },
+    { 0x504U,  8U, 0U, false,
+      { 0x04U, 0x40U, 0x02U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU } },
+    { 0x506U,  8U, 0U, false,
+      { 0x06U, 0x00U, 0x00U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU } },
+    { 0x100U,  8U, 0U, false,
+      { 0x01U, 0x52U, 0x2AU, 0x8CU, 0x4BU, 0x1BU, 0x0AU, 0x6CU } },
+    { 0x7E0U,  8U, 0U, false,
+      { 0x02U, 0x3EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U } },
+    { 0x530U,  8U, 0U, false,
+      { 0x30U, 0x50U, 0x02U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU } },
+    { 0x505U,  8U, 0U, true,
+      { 0x05U, 0x50U, 0x03U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU } },
+    { 0x7DFU,  8U, 0U, true,
+      { 0x02U, 0x3EU, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U } },
+    { 0x50AU,  3U, 0U, true,
+      { 0x0AU, 0x40U, 0x01U } },
+    { 0x300U, 12U, CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS, false,
+      { 0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U } },
+    { 0x100U,  8U, 0U, false,
+      { 0x70U, 0x28U, 0x2EU, 0xAFU, 0x57U, 0x36U, 0x12U, 0x4AU } },
+    { 0x200U, 16U, CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS, false,
+      { 0x37U, 0x74U, 0x38U, 0x7FU, 0x83U, 0xF0U, 0x5AU, 0x2CU } },
+    { 0x504U,  8U, 0U, false,
+      { 0x04U, 0x40U, 0x02U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU } },
+    { 0x506U,  8U, 0U, false,
+      { 0x06U, 0x00U, 0x00U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU } },
+    { 0x100U,  8U, 0U, false,
+      { 0x40U, 0xD6U, 0xC7U, 0xAEU, 0x7CU, 0xA9U, 0x6CU, 0x89U } },
+    { 0x7E0U,  8U, 0U, false,
+      { 0x02U, 0x3EU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U } },
+    { 0x530U,  8U, 0U, false,
+      { 0x30U, 0x50U, 0x02U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU } },
+    { 0x505U,  8U, 0U, true,
+      { 0x05U, 0x50U, 0x03U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU } },
+    { 0x7DFU,  8U, 0U, true,
+      { 0x02U, 0x3EU, 0x80U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U } },
+    { 0x50AU,  3U, 0U, true,
+      { 0x0AU, 0x40U, 0x01U } },
+    { 0x300U, 12U, CANFD_FRAME_FLAG_FDF | CANFD_FRAME_FLAG_BRS, false,
+      { 0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U } },
+};
+
+#endif /* WAKE_TRACE_H_ */
+
+/* [] END OF FILE */